@@ -0,0 +1,151 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "host_sim.h"
+
+static const char *TAG = "HOST_SIM";
+
+static host_sim_config_t host_sim_config;
+static bool host_sim_config_loaded = false;
+
+static int32_t *host_sim_mic_samples = NULL;    // SIM_MIC_WAV 的第一个声道, 满幅 int32
+static size_t host_sim_mic_count = 0;
+static size_t host_sim_mic_position = 0;
+static double host_sim_tone_phase = 0.0;
+
+static uint32_t host_sim_read_le(const uint8_t *data, int bytes)
+{
+    uint32_t value = 0;
+    for (int i = bytes - 1; i >= 0; i--)
+        value = (value << 8) | data[i];
+    return value;
+}
+
+// 整个文件读入内存: 只在启动时调用一次, 模拟期间不再碰磁盘
+static void host_sim_load_wav(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        ESP_LOGE(TAG, "Cannot open %s, using a %d Hz tone.", path, HOST_SIM_TONE_HZ);
+        return;
+    }
+
+    uint8_t header[12];
+    uint8_t chunk[8];
+    uint32_t channels = 0;
+    uint32_t bits = 0;
+    uint32_t sample_rate = 0;
+
+    if ((fread(header, 1, sizeof(header), file) != sizeof(header)) ||
+        (memcmp(header, "RIFF", 4) != 0) || (memcmp(header + 8, "WAVE", 4) != 0))
+    {
+        ESP_LOGE(TAG, "%s is not a WAV file.", path);
+        fclose(file);
+        return;
+    }
+
+    while (fread(chunk, 1, sizeof(chunk), file) == sizeof(chunk))
+    {
+        uint32_t size = host_sim_read_le(chunk + 4, 4);
+
+        if (memcmp(chunk, "fmt ", 4) == 0)
+        {
+            uint8_t fmt[16];
+            if ((size < sizeof(fmt)) || (fread(fmt, 1, sizeof(fmt), file) != sizeof(fmt)))
+                break;
+            channels = host_sim_read_le(fmt + 2, 2);
+            sample_rate = host_sim_read_le(fmt + 4, 4);
+            bits = host_sim_read_le(fmt + 14, 2);
+            fseek(file, (long)(size - sizeof(fmt) + (size & 1)), SEEK_CUR);
+        }
+        else if (memcmp(chunk, "data", 4) == 0)
+        {
+            if ((channels == 0) || ((bits != 16) && (bits != 24) && (bits != 32)))
+                break;
+            uint32_t frame_bytes = channels * bits / 8;
+            uint8_t *data = malloc(size);
+            size = (uint32_t)fread(data, 1, size, file);
+            host_sim_mic_count = size / frame_bytes;
+            host_sim_mic_samples = malloc(host_sim_mic_count * sizeof(int32_t));
+            for (size_t i = 0; i < host_sim_mic_count; i++)
+                host_sim_mic_samples[i] = (int32_t)(host_sim_read_le(data + i * frame_bytes, bits / 8) << (32 - bits));
+            free(data);
+            break;
+        }
+        else
+        {
+            fseek(file, (long)(size + (size & 1)), SEEK_CUR);
+        }
+    }
+    fclose(file);
+
+    if (host_sim_mic_count == 0)
+    {
+        free(host_sim_mic_samples);
+        host_sim_mic_samples = NULL;
+        ESP_LOGE(TAG, "%s: unsupported format (%lu ch, %lu bit), using a %d Hz tone.", path,
+                 (unsigned long)channels, (unsigned long)bits, HOST_SIM_TONE_HZ);
+        return;
+    }
+    // 不做重采样: 采样率不同时音高会变, 但时序和数据量仍按 I2S 通道的采样率
+    ESP_LOGI(TAG, "Microphone: %s, %u samples at %lu Hz (channel 0 of %lu).", path, (unsigned)host_sim_mic_count,
+             (unsigned long)sample_rate, (unsigned long)channels);
+}
+
+const host_sim_config_t *host_sim_get_config(void)
+{
+    if (host_sim_config_loaded)
+        return &host_sim_config;
+
+    const char *speed = getenv("SIM_SPEED");
+    host_sim_config.speed = (speed != NULL) ? atof(speed) : 1.0;
+    if (host_sim_config.speed < 0)
+        host_sim_config.speed = 1.0;
+    host_sim_config.mic_wav = getenv("SIM_MIC_WAV");
+    host_sim_config.buttons = getenv("SIM_BUTTONS");
+    host_sim_config_loaded = true;
+
+    if (host_sim_config.mic_wav != NULL)
+        host_sim_load_wav(host_sim_config.mic_wav);
+    if (host_sim_config.speed > 0)
+        ESP_LOGI(TAG, "Audio clock at %.2fx real time.", host_sim_config.speed);
+    else
+        ESP_LOGI(TAG, "Audio clock unpaced.");
+    return &host_sim_config;
+}
+
+int64_t host_sim_audio_time_us(int64_t start_us)
+{
+    const host_sim_config_t *config = host_sim_get_config();
+
+    if (config->speed <= 0)
+        return -1;
+    return (int64_t)((double)(esp_timer_get_time() - start_us) * config->speed);
+}
+
+void host_sim_mic_fill(int32_t *samples, size_t count, uint32_t sample_rate)
+{
+    if (host_sim_mic_samples != NULL)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            samples[i] = host_sim_mic_samples[host_sim_mic_position++];
+            if (host_sim_mic_position == host_sim_mic_count)
+                host_sim_mic_position = 0;
+        }
+        return;
+    }
+
+    double step = 2.0 * M_PI * HOST_SIM_TONE_HZ / (double)sample_rate;
+    for (size_t i = 0; i < count; i++)
+    {
+        samples[i] = (int32_t)(sin(host_sim_tone_phase) * HOST_SIM_TONE_LEVEL * 2147483647.0);
+        host_sim_tone_phase += step;
+        if (host_sim_tone_phase >= 2.0 * M_PI)
+            host_sim_tone_phase -= 2.0 * M_PI;
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef HOST_SIM_H
+#define HOST_SIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+/**
+ * 主机模拟 (idf.py --preview set-target linux) 的运行参数, 第一次使用时从环境变量读取:
+ *   SIM_SPEED      音频时钟倍速: 1 = 实时 (默认), 4 = 4 倍速, 0 = 不限速 (I2S 读写立即完成)
+ *   SIM_MIC_WAV    麦克风输入, PCM 16/24/32 位 WAV, 多声道时取第一个声道, 读完后从头循环;
+ *                  未设置时生成 HOST_SIM_TONE_HZ 的正弦波
+ *   SIM_BUTTONS    按键脚本, 每行 "<毫秒> <按键序号> [按住毫秒]" 或 "<毫秒> quit", # 开头为注释.
+ *                  时间从启动开始按墙上时间计; 按键序号是 gpio_isr_handler_add() 的注册顺序,
+ *                  即 gpio_button.c 中 button_gpios[] 的下标. 按下 (下降沿) 和松开 (上升沿) 按
+ *                  gpio_config() 的中断类型调用中断回调
+ */
+#define HOST_SIM_TONE_HZ            440
+#define HOST_SIM_TONE_LEVEL         0.25    // 满幅的比例
+#define HOST_SIM_HOLD_MS            100     // 按键默认按住时间, 需长于 gpio_button 的去抖复查
+#define HOST_SIM_MAX_BUTTONS        8
+#define HOST_SIM_MAX_EVENTS         256
+#define HOST_SIM_BUTTON_TASK_PRIO   12      // 高于所有业务任务, 模拟中断的及时性
+
+typedef struct {
+    double speed;
+    const char *mic_wav;
+    const char *buttons;
+} host_sim_config_t;
+
+const host_sim_config_t *host_sim_get_config(void);
+
+/**
+ * @brief 按音频时钟换算: 启动后经过的音频时间 (us), 不限速时返回 -1
+ */
+int64_t host_sim_audio_time_us(int64_t start_us);
+
+/**
+ * @brief 取麦克风的下一批样本 (满幅 int32, 左对齐), 采样率只用于生成正弦波
+ */
+void host_sim_mic_fill(int32_t *samples, size_t count, uint32_t sample_rate);
+
+/**
+ * @brief 按下或松开第 button 个按键 (注册顺序, 同 SIM_BUTTONS), 按中断类型在调用者的上下文中
+ * 调用中断回调. 按键脚本和主机测试 (test/host) 都通过它产生边沿
+ */
+esp_err_t host_sim_button_set(int button, bool pressed);
+
+#endif // HOST_SIM_H
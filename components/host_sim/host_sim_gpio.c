@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/gpio.h"
+#include "host_sim.h"
+
+static const char *TAG = "HOST_SIM_GPIO";
+
+typedef struct {
+    uint32_t at_ms;
+    int button;                         // -1: 退出
+    uint32_t hold_ms;
+} host_sim_button_event_t;
+
+typedef struct {
+    gpio_num_t gpio_num;
+    gpio_isr_t handler;
+    void *arg;
+} host_sim_isr_t;
+
+static uint8_t host_sim_gpio_levels[GPIO_NUM_MAX];
+static gpio_int_type_t host_sim_gpio_intr_types[GPIO_NUM_MAX];
+static host_sim_isr_t host_sim_isrs[HOST_SIM_MAX_BUTTONS];
+static int host_sim_isr_count = 0;
+static bool host_sim_isr_installed = false;
+
+static host_sim_button_event_t host_sim_button_events[HOST_SIM_MAX_EVENTS];
+static int host_sim_button_event_count = 0;
+
+static int host_sim_load_buttons(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    char line[128];
+    int count = 0;
+
+    if (file == NULL)
+    {
+        ESP_LOGE(TAG, "Cannot open button script %s.", path);
+        return 0;
+    }
+    while ((fgets(line, sizeof(line), file) != NULL) && (count < HOST_SIM_MAX_EVENTS))
+    {
+        host_sim_button_event_t *event = &host_sim_button_events[count];
+        char action[16];
+        unsigned at_ms, hold_ms = HOST_SIM_HOLD_MS;
+        int fields = sscanf(line, "%u %15s %u", &at_ms, action, &hold_ms);
+
+        if ((fields < 2) || (line[0] == '#'))
+            continue;
+        event->at_ms = at_ms;
+        event->hold_ms = hold_ms;
+        event->button = (strcmp(action, "quit") == 0) ? -1 : atoi(action);
+        count++;
+    }
+    fclose(file);
+    ESP_LOGI(TAG, "Loaded %d button events from %s.", count, path);
+    return count;
+}
+
+// 按脚本改变电平并调用中断回调, 回调运行在本任务中 (相当于中断上下文)
+static void host_sim_button_task(void *arg)
+{
+    for (int i = 0; i < host_sim_button_event_count; i++)
+    {
+        const host_sim_button_event_t *event = &host_sim_button_events[i];
+        int64_t wait_ms = (int64_t)event->at_ms - esp_timer_get_time() / 1000;
+
+        if (wait_ms > 0)
+            vTaskDelay(pdMS_TO_TICKS(wait_ms));
+
+        if (event->button < 0)
+        {
+            ESP_LOGI(TAG, "Script finished, exiting.");
+            fflush(stdout);
+            exit(0);
+        }
+        if (host_sim_button_set(event->button, true) != ESP_OK)
+        {
+            ESP_LOGW(TAG, "Button %d has no interrupt handler.", event->button);
+            continue;
+        }
+        vTaskDelay(pdMS_TO_TICKS(event->hold_ms));
+        host_sim_button_set(event->button, false);
+    }
+    vTaskDelete(NULL);
+}
+
+esp_err_t host_sim_button_set(int button, bool pressed)
+{
+    if ((button < 0) || (button >= host_sim_isr_count) || (host_sim_isrs[button].handler == NULL))
+        return ESP_ERR_INVALID_ARG;
+
+    // 按键低有效: 按下是下降沿, 松开是上升沿
+    const host_sim_isr_t *isr = &host_sim_isrs[button];
+    gpio_int_type_t intr_type = host_sim_gpio_intr_types[isr->gpio_num];
+    host_sim_gpio_levels[isr->gpio_num] = pressed ? 0 : 1;
+    if ((intr_type == GPIO_INTR_ANYEDGE) || (intr_type == (pressed ? GPIO_INTR_NEGEDGE : GPIO_INTR_POSEDGE)))
+        isr->handler(isr->arg);
+    return ESP_OK;
+}
+
+esp_err_t gpio_config(const gpio_config_t *config)
+{
+    if (config == NULL)
+        return ESP_ERR_INVALID_ARG;
+    for (int i = 0; i < GPIO_NUM_MAX; i++)
+    {
+        if (config->pin_bit_mask & (1ULL << i))
+        {
+            host_sim_gpio_levels[i] = config->pull_up_en ? 1 : 0;
+            host_sim_gpio_intr_types[i] = config->intr_type;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags)
+{
+    const host_sim_config_t *config = host_sim_get_config();
+
+    if (host_sim_isr_installed)
+        return ESP_ERR_INVALID_STATE;
+    host_sim_isr_installed = true;
+
+    if (config->buttons == NULL)
+        return ESP_OK;
+    host_sim_button_event_count = host_sim_load_buttons(config->buttons);
+    if (xTaskCreate(host_sim_button_task, "sim_button", 4096, NULL, HOST_SIM_BUTTON_TASK_PRIO, NULL) != pdPASS)
+        return ESP_ERR_NO_MEM;
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void *args)
+{
+    if ((gpio_num < 0) || (gpio_num >= GPIO_NUM_MAX) || (isr_handler == NULL))
+        return ESP_ERR_INVALID_ARG;
+    if (!host_sim_isr_installed)
+        return ESP_ERR_INVALID_STATE;
+    if (host_sim_isr_count >= HOST_SIM_MAX_BUTTONS)
+        return ESP_ERR_NO_MEM;
+
+    host_sim_isrs[host_sim_isr_count++] = (host_sim_isr_t){ gpio_num, isr_handler, args };
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t gpio_num)
+{
+    for (int i = 0; i < host_sim_isr_count; i++)
+    {
+        if (host_sim_isrs[i].gpio_num == gpio_num)
+            host_sim_isrs[i].handler = NULL;
+    }
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num)
+{
+    if ((gpio_num < 0) || (gpio_num >= GPIO_NUM_MAX))
+        return 0;
+    return host_sim_gpio_levels[gpio_num];
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    if ((gpio_num < 0) || (gpio_num >= GPIO_NUM_MAX))
+        return ESP_ERR_INVALID_ARG;
+    host_sim_gpio_levels[gpio_num] = level ? 1 : 0;
+    return ESP_OK;
+}
@@ -0,0 +1,287 @@
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/i2s_std.h"
+#include "host_sim.h"
+
+static const char *TAG = "HOST_SIM_I2S";
+
+#define HOST_SIM_I2S_FILL_BLOCK     256
+
+struct i2s_channel_obj_t {
+    i2s_port_t port;
+    bool is_tx;
+    bool initialized;
+    bool enabled;
+    uint32_t sample_rate;
+    uint32_t channels;
+    uint32_t sample_bytes;              // DMA 中每个样本的字节数 (ESP32-S3: data_bit_width 向上取整到字节, 24bit 为 3)
+    uint32_t frame_bytes;               // 一个采样时刻所有声道的字节数
+    uint32_t dma_frame_num;             // 一个 DMA 描述符的帧数, 数据按描述符为单位到达
+    uint32_t dma_frames;                // 整个 DMA 环的帧数
+    int64_t start_us;                   // enable 的时刻
+    uint64_t position;                  // enable 以来读出 / 写入的帧数
+    uint64_t total_frames;
+    uint32_t overruns;                  // RX: 读得太慢, DMA 覆盖了未读数据; TX: 写得太慢, DMA 空转
+};
+
+// 音频时钟走到现在, DMA 已经完成的帧数 (按描述符取整); 不限速时返回 -1
+static int64_t host_sim_i2s_clock(const struct i2s_channel_obj_t *channel)
+{
+    int64_t audio_us = host_sim_audio_time_us(channel->start_us);
+
+    if (audio_us < 0)
+        return -1;
+    int64_t frames = audio_us * channel->sample_rate / 1000000;
+    return frames - frames % channel->dma_frame_num;
+}
+
+static int64_t host_sim_i2s_deadline(uint32_t timeout_ms)
+{
+    if (timeout_ms == portMAX_DELAY)
+        return INT64_MAX;
+    return esp_timer_get_time() + (int64_t)timeout_ms * 1000;
+}
+
+static void host_sim_i2s_wait(const struct i2s_channel_obj_t *channel, uint64_t frames, int64_t deadline_us)
+{
+    double speed = host_sim_get_config()->speed;
+    int64_t wait_us = (int64_t)((double)frames * 1000000.0 / channel->sample_rate / speed);
+    int64_t left_us = deadline_us - esp_timer_get_time();
+
+    if (wait_us > left_us)
+        wait_us = left_us;
+    TickType_t ticks = pdMS_TO_TICKS((wait_us + 999) / 1000);
+    vTaskDelay(ticks > 0 ? ticks : 1);
+}
+
+static void host_sim_i2s_fill(struct i2s_channel_obj_t *channel, uint8_t *dest, size_t frames)
+{
+    int32_t block[HOST_SIM_I2S_FILL_BLOCK];
+
+    while (frames > 0)
+    {
+        size_t count = (frames < HOST_SIM_I2S_FILL_BLOCK) ? frames : HOST_SIM_I2S_FILL_BLOCK;
+        host_sim_mic_fill(block, count, channel->sample_rate);
+        for (size_t i = 0; i < count; i++)
+        {
+            // 小端: 高位字节在 int32 的末尾, 与硬件一样取每个槽位的高 data_bit_width 位
+            for (uint32_t c = 0; c < channel->channels; c++)
+            {
+                memcpy(dest, (const uint8_t *)&block[i] + sizeof(int32_t) - channel->sample_bytes, channel->sample_bytes);
+                dest += channel->sample_bytes;
+            }
+        }
+        frames -= count;
+    }
+}
+
+esp_err_t i2s_new_channel(const i2s_chan_config_t *chan_cfg, i2s_chan_handle_t *ret_tx_handle,
+                          i2s_chan_handle_t *ret_rx_handle)
+{
+    i2s_chan_handle_t *handles[2] = { ret_tx_handle, ret_rx_handle };
+
+    if ((chan_cfg == NULL) || ((ret_tx_handle == NULL) && (ret_rx_handle == NULL)))
+        return ESP_ERR_INVALID_ARG;
+
+    host_sim_get_config();
+    for (int i = 0; i < 2; i++)
+    {
+        if (handles[i] == NULL)
+            continue;
+        struct i2s_channel_obj_t *channel = calloc(1, sizeof(*channel));
+        if (channel == NULL)
+            return ESP_ERR_NO_MEM;
+        channel->port = chan_cfg->id;
+        channel->is_tx = (i == 0);
+        channel->dma_frame_num = (chan_cfg->dma_frame_num > 0) ? chan_cfg->dma_frame_num : 240;
+        channel->dma_frames = channel->dma_frame_num * ((chan_cfg->dma_desc_num > 0) ? chan_cfg->dma_desc_num : 6);
+        *handles[i] = channel;
+    }
+    return ESP_OK;
+}
+
+esp_err_t i2s_del_channel(i2s_chan_handle_t handle)
+{
+    if (handle == NULL)
+        return ESP_ERR_INVALID_ARG;
+    if (handle->enabled)
+        return ESP_ERR_INVALID_STATE;
+    free(handle);
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_init_std_mode(i2s_chan_handle_t handle, const i2s_std_config_t *std_cfg)
+{
+    if ((handle == NULL) || (std_cfg == NULL))
+        return ESP_ERR_INVALID_ARG;
+    if (handle->initialized)
+        return ESP_ERR_INVALID_STATE;
+
+    handle->initialized = true;
+    esp_err_t err = i2s_channel_reconfig_std_slot(handle, &std_cfg->slot_cfg);
+    if (err == ESP_OK)
+        err = i2s_channel_reconfig_std_clock(handle, &std_cfg->clk_cfg);
+    return err;
+}
+
+esp_err_t i2s_channel_reconfig_std_clock(i2s_chan_handle_t handle, const i2s_std_clk_config_t *clk_cfg)
+{
+    if ((handle == NULL) || (clk_cfg == NULL) || (clk_cfg->sample_rate_hz == 0))
+        return ESP_ERR_INVALID_ARG;
+    if (!handle->initialized || handle->enabled)
+        return ESP_ERR_INVALID_STATE;
+    handle->sample_rate = clk_cfg->sample_rate_hz;
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_reconfig_std_slot(i2s_chan_handle_t handle, const i2s_std_slot_config_t *slot_cfg)
+{
+    if ((handle == NULL) || (slot_cfg == NULL))
+        return ESP_ERR_INVALID_ARG;
+    if (!handle->initialized || handle->enabled)
+        return ESP_ERR_INVALID_STATE;
+
+    // 槽位宽度只影响线上的时钟, DMA 里每个样本按数据位宽打包
+    if ((slot_cfg->slot_bit_width != I2S_SLOT_BIT_WIDTH_AUTO) &&
+        ((uint32_t)slot_cfg->slot_bit_width < (uint32_t)slot_cfg->data_bit_width))
+        return ESP_ERR_INVALID_ARG;
+    handle->sample_bytes = ((uint32_t)slot_cfg->data_bit_width + 7) / 8;
+    handle->channels = (slot_cfg->slot_mode == I2S_SLOT_MODE_STEREO) ? 2 : 1;
+    handle->frame_bytes = handle->sample_bytes * handle->channels;
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_enable(i2s_chan_handle_t handle)
+{
+    if (handle == NULL)
+        return ESP_ERR_INVALID_ARG;
+    if (!handle->initialized || handle->enabled)
+        return ESP_ERR_INVALID_STATE;
+
+    handle->enabled = true;
+    handle->start_us = esp_timer_get_time();
+    handle->position = 0;
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_disable(i2s_chan_handle_t handle)
+{
+    if (handle == NULL)
+        return ESP_ERR_INVALID_ARG;
+    if (!handle->enabled)
+        return ESP_ERR_INVALID_STATE;
+
+    handle->enabled = false;
+    handle->total_frames += handle->position;
+    ESP_LOGD(TAG, "I2S%d %s disabled: %llu frames, %lu %s so far.", handle->port, handle->is_tx ? "TX" : "RX",
+             (unsigned long long)handle->total_frames, (unsigned long)handle->overruns,
+             handle->is_tx ? "underruns" : "overruns");
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_read(i2s_chan_handle_t handle, void *dest, size_t size, size_t *bytes_read,
+                           uint32_t timeout_ms)
+{
+    if ((handle == NULL) || handle->is_tx || (dest == NULL))
+        return ESP_ERR_INVALID_ARG;
+    if (!handle->enabled)
+        return ESP_ERR_INVALID_STATE;
+
+    uint64_t frames = size / handle->frame_bytes;
+    uint64_t done = 0;
+    esp_err_t err = ESP_OK;
+
+    // 和驱动一样逐个 DMA 描述符拷贝, 超时是等待下一个描述符的时间, 不是整次读取的时间
+    int64_t deadline_us = host_sim_i2s_deadline(timeout_ms);
+    while (done < frames)
+    {
+        int64_t clock = host_sim_i2s_clock(handle);
+        uint64_t count = frames - done;
+
+        if (clock >= 0)
+        {
+            if ((uint64_t)clock - handle->position > handle->dma_frames)
+            {
+                // 读得太慢: DMA 环覆盖了最旧的数据
+                handle->position = (uint64_t)clock - handle->dma_frames;
+                handle->overruns++;
+            }
+            if ((uint64_t)clock == handle->position)
+            {
+                if (esp_timer_get_time() >= deadline_us)
+                {
+                    err = ESP_ERR_TIMEOUT;
+                    break;
+                }
+                host_sim_i2s_wait(handle, (count < handle->dma_frame_num) ? count : handle->dma_frame_num, deadline_us);
+                continue;
+            }
+            if (count > (uint64_t)clock - handle->position)
+                count = (uint64_t)clock - handle->position;
+        }
+        host_sim_i2s_fill(handle, (uint8_t *)dest + done * handle->frame_bytes, count);
+        handle->position += count;
+        done += count;
+        deadline_us = host_sim_i2s_deadline(timeout_ms);
+    }
+
+    if (bytes_read != NULL)
+        *bytes_read = done * handle->frame_bytes;
+    return err;
+}
+
+esp_err_t i2s_channel_write(i2s_chan_handle_t handle, const void *src, size_t size, size_t *bytes_written,
+                            uint32_t timeout_ms)
+{
+    if ((handle == NULL) || !handle->is_tx || (src == NULL))
+        return ESP_ERR_INVALID_ARG;
+    if (!handle->enabled)
+        return ESP_ERR_INVALID_STATE;
+
+    uint64_t frames = size / handle->frame_bytes;
+    uint64_t done = 0;
+    esp_err_t err = ESP_OK;
+
+    // 播放的数据直接丢弃, 只按音频时钟模拟 DMA 环的占用
+    int64_t deadline_us = host_sim_i2s_deadline(timeout_ms);
+    while (done < frames)
+    {
+        int64_t clock = host_sim_i2s_clock(handle);
+        uint64_t count = frames - done;
+
+        if (clock >= 0)
+        {
+            if ((uint64_t)clock > handle->position)
+            {
+                // 写得太慢: DMA 已经放完了所有数据, 中间播放的是静音
+                if (handle->position > 0)
+                    handle->overruns++;
+                handle->position = (uint64_t)clock;
+            }
+            uint64_t room = handle->dma_frames - (handle->position - (uint64_t)clock);
+            if (room == 0)
+            {
+                if (esp_timer_get_time() >= deadline_us)
+                {
+                    err = ESP_ERR_TIMEOUT;
+                    break;
+                }
+                host_sim_i2s_wait(handle, (count < handle->dma_frame_num) ? count : handle->dma_frame_num, deadline_us);
+                continue;
+            }
+            if (count > room)
+                count = room;
+        }
+        handle->position += count;
+        done += count;
+        deadline_us = host_sim_i2s_deadline(timeout_ms);
+    }
+
+    if (bytes_written != NULL)
+        *bytes_written = done * handle->frame_bytes;
+    return err;
+}
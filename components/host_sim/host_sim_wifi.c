@@ -0,0 +1,79 @@
+#include <string.h>
+#include <arpa/inet.h>
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_wifi.h"
+
+static const char *TAG = "HOST_SIM_WIFI";
+
+ESP_EVENT_DEFINE_BASE(WIFI_EVENT);
+ESP_EVENT_DEFINE_BASE(IP_EVENT);
+
+struct esp_netif_obj {
+    esp_netif_ip_info_t ip_info;
+};
+
+static struct esp_netif_obj host_sim_netif;
+static bool host_sim_wifi_started = false;
+
+esp_err_t esp_netif_init(void)
+{
+    return ESP_OK;
+}
+
+esp_netif_t *esp_netif_create_default_wifi_sta(void)
+{
+    // 本机回环: 接收端 (script/tcp_receiver.py 等) 跑在同一台主机上
+    host_sim_netif.ip_info.ip.addr = inet_addr("127.0.0.1");
+    host_sim_netif.ip_info.netmask.addr = inet_addr("255.0.0.0");
+    host_sim_netif.ip_info.gw.addr = inet_addr("127.0.0.1");
+    return &host_sim_netif;
+}
+
+esp_err_t esp_wifi_init(const wifi_init_config_t *config)
+{
+    return (config != NULL) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_wifi_set_mode(wifi_mode_t mode)
+{
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_config(wifi_interface_t interface, wifi_config_t *conf)
+{
+    if (conf == NULL)
+        return ESP_ERR_INVALID_ARG;
+    ESP_LOGI(TAG, "Simulated station for SSID \"%.32s\".", (const char *)conf->sta.ssid);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_start(void)
+{
+    host_sim_wifi_started = true;
+    return esp_event_post(WIFI_EVENT, WIFI_EVENT_STA_START, NULL, 0, portMAX_DELAY);
+}
+
+esp_err_t esp_wifi_stop(void)
+{
+    host_sim_wifi_started = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_connect(void)
+{
+    ip_event_got_ip_t event = {
+        .esp_netif = &host_sim_netif,
+        .ip_changed = true,
+    };
+
+    if (!host_sim_wifi_started)
+        return ESP_ERR_INVALID_STATE;
+    event.ip_info = host_sim_netif.ip_info;
+    return esp_event_post(IP_EVENT, IP_EVENT_STA_GOT_IP, &event, sizeof(event), portMAX_DELAY);
+}
+
+esp_err_t esp_wifi_disconnect(void)
+{
+    return esp_event_post(WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, NULL, 0, portMAX_DELAY);
+}
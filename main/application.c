@@ -1,85 +1,203 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "i2s_audio.h"
-#include "wav_audio.h"
 #include "gpio_button.h"
 #include "network_socket.h"
+#include "audio_convert.h"
+#include "audio_pool.h"
+#include "audio_playback.h"
+#include "stream_frame.h"
+#include "audio_trace.h"
+#ifdef CONFIG_AUDIO_RECORDER
+#include "audio_recorder.h"
+#endif
 
 static const char *TAG = "APPLICATION";
 
-#define APP_WAV_HEADER_SIZE        44
+#ifdef CONFIG_AUDIO_STREAM_ADPCM
+#define APP_STREAM_FORMAT          I2S_AUDIO_FORMAT_ADPCM
+#else
+#define APP_STREAM_FORMAT          I2S_AUDIO_FORMAT_PCM16
+#endif
 
-static size_t count = 16000;
-static char data_buffer[131072];
-static char send_buffer[65580];
-static int32_t *pcm_data = (int32_t *)(data_buffer);
-static int16_t *pcm16_data = (int16_t *)(send_buffer);
+#ifdef CONFIG_AUDIO_HISTORY
+#define APP_PREROLL_SAMPLES(rate)  (CONFIG_AUDIO_HISTORY_PREROLL_MS * ((rate) / 1000))
+#endif
 
-void application_create_wav_audio_header(int count, char *output)
+#define APP_CLIP_MS                1000
+#define APP_CLIP_TIMEOUT_MS        1000
+#define APP_PLAYBACK_POLL_MS       20
+
+// 提示音: -12dB, 成功/开为高音, 失败/关为低音
+#define APP_TONE_GAIN              (AUDIO_MIXER_GAIN_UNITY / 4)
+#define APP_TONE_MS                80
+#define APP_TONE_HIGH_HZ           1000
+#define APP_TONE_LOW_HZ            500
+
+// 一次按键录音 (int32) 最多占满一个 AUDIO_POOL_CLIP 块: 16kHz 下正好 1 秒, 采样率更高时录音相应缩短
+#define APP_CLIP_MAX_SAMPLES       (AUDIO_POOL_CLIP_SIZE / sizeof(int32_t))
+
+static size_t application_clip_samples(uint32_t sample_rate)
 {
-    RiffChunk *riff = (RiffChunk *)(output);
-    FmtChunk *fmt = (FmtChunk *)(output + 12);
-    DataChunk *data = (DataChunk *)(output + 36);
-
-    memcpy(riff->chunkId, "RIFF", 4);
-    riff->chunkSize = count * 2 + 36;
-    memcpy(riff->format, "WAVE", 4);
-
-    memcpy(fmt->subchunk1Id, "fmt ", 4);
-    fmt->subchunk1Size = 16;
-    fmt->audioFormat = 1;
-    fmt->numChannels = 1;
-    fmt->sampleRate = 16000;
-    fmt->byteRate = 32000;
-    fmt->blockAlign = 2;
-    fmt->bitsPerSample = 16;
-
-    memcpy(data->subchunk2Id, "data", 4);
-    data->subchunk2Size = count * 2;
+    size_t samples = (size_t)sample_rate * APP_CLIP_MS / 1000;
+
+    if (samples <= APP_CLIP_MAX_SAMPLES)
+        return samples;
+    ESP_LOGW(TAG, "Clip shortened to %lu ms at %lu Hz (pool block holds %u samples).",
+             (unsigned long)(APP_CLIP_MAX_SAMPLES * 1000 / sample_rate), (unsigned long)sample_rate,
+             (unsigned)APP_CLIP_MAX_SAMPLES);
+    return APP_CLIP_MAX_SAMPLES;
 }
 
-void application_audio_data_process(int count, char *input, char *output)
+/**
+ * @brief 经播放服务回放录音并等到播完, 期间被取消就淡出停止. 声部持有块的一个引用,
+ * 播完后不再读它, 之后才能原地转换.
+ */
+static void application_play_clip(uint8_t gpio_num, audio_block_t *clip, size_t count, uint32_t sample_rate)
 {
-    int32_t *iptr = (int32_t *)(input);
-    int16_t *optr = (int16_t *)(output + APP_WAV_HEADER_SIZE);
-    for (int i = 0; i < count; i++)
+    int voice = audio_playback_clip(clip, count, sample_rate, AUDIO_MIXER_GAIN_UNITY);
+
+    if (voice < 0)
+    {
+        ESP_LOGW(TAG, "Speaker busy, clip not played.");
+        return;
+    }
+    while (audio_playback_wait(voice, APP_PLAYBACK_POLL_MS) == ESP_ERR_TIMEOUT)
     {
-        int32_t value = iptr[i] >> 12;
-        optr[i] = (value > INT16_MAX) ? INT16_MAX : (value < -INT16_MAX) ? -INT16_MAX : (int16_t)value;
+        if (gpio_button_action_cancelled(gpio_num))
+        {
+            audio_playback_stop(voice);
+            return;
+        }
     }
+    AUDIO_TRACE1(CLIP_PLAYED, count);
 }
 
+/**
+ * @brief 按键录音 APP_CLIP_MS (受块大小限制), 回放后发布. 在按键执行任务中运行; 录音期间再按一次会取消这次,
+ * 在读取之后和回放期间检查, 被取消的录音不再回放和发布.
+ */
 void application_button_boot_callback(uint8_t gpio_num)
 {
-    ESP_LOGW(TAG, ">>> Button Boot (GPIO %d) Pressed! - Executing action A.", gpio_num);
-    i2s_audio_read_data(pcm_data, count);
-    ESP_LOGI(TAG, "Success read %d samples!", count);
-    i2s_audio_play_data(pcm_data, count);
-    ESP_LOGI(TAG, "Success play %d samples!", count);
+    int64_t start_us = esp_timer_get_time();
+    // 采集配置可以在运行时切换, 录音和回放都按触发时的采样率
+    uint32_t sample_rate = i2s_audio_mic_sample_rate();
+    size_t count = application_clip_samples(sample_rate);
+
+    AUDIO_TRACE2(BUTTON_PRESSED, 0, gpio_num);
+    // 上一次发布持有自己的引用, 这里取一个新块即可, 不需要等发布完成
+    audio_block_t *clip = audio_pool_acquire(AUDIO_POOL_CLIP, APP_CLIP_TIMEOUT_MS);
+    if (clip == NULL)
+    {
+        AUDIO_TRACE0(CLIP_NO_BUFFER);
+        return;
+    }
+    int32_t *pcm_data = (int32_t *)clip->data;
+    // PCM16 原地覆盖 int32 采样, 不再需要单独的发送缓冲区
+    int16_t *pcm16_data = (int16_t *)clip->data;
+
+#ifdef CONFIG_AUDIO_HISTORY
+    // 触发前的预录 + 触发后的剩余部分, 总长仍为 count; 预录不超过整段录音
+    size_t preroll = APP_PREROLL_SAMPLES(sample_rate);
+    preroll = (preroll > count) ? count : preroll;
+    if (i2s_audio_history_snapshot(pcm_data, preroll, count - preroll, 2000) != ESP_OK)
+    {
+        audio_pool_release(clip);
+        return;
+    }
+#else
+    if (i2s_audio_read_data(pcm_data, count) != ESP_OK)
+    {
+        audio_pool_release(clip);
+        return;
+    }
+#endif
+    AUDIO_TRACE1(CLIP_READ, count);
+    if (!gpio_button_action_cancelled(gpio_num))
+        application_play_clip(gpio_num, clip, count, sample_rate);
+    if (gpio_button_action_cancelled(gpio_num))
+    {
+        AUDIO_TRACE1(CLIP_CANCELLED, (esp_timer_get_time() - start_us) / 1000);
+        audio_pool_release(clip);
+        return;
+    }
     i2s_audio_convert_data(pcm_data, pcm16_data, count);
-    ESP_LOGI(TAG, "Success convert %d samples!", count);
-    network_socket_data_publish(pcm16_data, count * 2);
-    ESP_LOGI(TAG, "Success send %d bytes!", count * 2);
+    AUDIO_TRACE1(CLIP_CONVERTED, count);
+    clip->len = count * 2;
+    network_socket_data_publish_block(clip, STREAM_CODEC_PCM16, sample_rate);
+    AUDIO_TRACE1(CLIP_QUEUED, count * 2);
+    audio_pool_release(clip);
 }
 
 void application_button_up_callback(uint8_t gpio_num)
 {
-    ESP_LOGW(TAG, ">>> Button Up (GPIO %d) Pressed! - Executing action B.", gpio_num);
-    i2s_audio_stream_data(0);
+    AUDIO_TRACE2(BUTTON_PRESSED, 1, gpio_num);
+    i2s_audio_stream_data(I2S_AUDIO_FORMAT_RAW32);
+}
+
+/**
+ * @brief 长按按键 1: 依次切换采集配置 (audio_profile), 播放使用同名配置的 DMA 深度. 流进行中不切换.
+ */
+void application_button_up_long_callback(uint8_t gpio_num)
+{
+    audio_profile_id_t id = (audio_profile_id_t)((i2s_audio_mic_get_profile(NULL) + 1) % AUDIO_PROFILE_MAX);
+    audio_profile_dma_t dma;
+    esp_err_t err = i2s_audio_mic_set_profile(id);
+
+    if (err != ESP_OK)
+    {
+        ESP_LOGW(TAG, ">>> Button 1 (GPIO %u) long press: profile not changed (%s).", gpio_num, esp_err_to_name(err));
+        audio_playback_tone(APP_TONE_LOW_HZ, APP_TONE_MS, APP_TONE_GAIN);
+        return;
+    }
+    i2s_audio_mic_get_profile(&dma);
+    ESP_LOGW(TAG, ">>> Button 1 (GPIO %u) long press: microphone profile %s, %lu Hz, DMA latency %lu us.", gpio_num,
+             audio_profile_get(id)->name, (unsigned long)i2s_audio_mic_sample_rate(), (unsigned long)dma.latency_us);
+    // 先切换播放配置: 提示音本身也是一个声部, 会让播放服务拒绝切换
+    if (audio_playback_set_profile(id) != ESP_OK)
+        ESP_LOGW(TAG, "Speaker busy, speaker profile not changed.");
+    audio_playback_tone(APP_TONE_HIGH_HZ, APP_TONE_MS, APP_TONE_GAIN);
 }
 
 void application_button_down_callback(uint8_t gpio_num)
 {
-    ESP_LOGW(TAG, ">>> Button Down (GPIO %d) Pressed! - Executing action C.", gpio_num);
-    i2s_audio_stream_data(1);
+    AUDIO_TRACE2(BUTTON_PRESSED, 2, gpio_num);
+    i2s_audio_stream_data(APP_STREAM_FORMAT);
+}
+
+void application_button_down_long_callback(uint8_t gpio_num)
+{
+    bool enable = !i2s_audio_get_vad_gate();
+
+    i2s_audio_set_vad_gate(enable);
+    ESP_LOGW(TAG, ">>> Button 2 (GPIO %u) long press: VAD gate %s.", gpio_num, enable ? "on" : "off");
+    audio_playback_tone(enable ? APP_TONE_HIGH_HZ : APP_TONE_LOW_HZ, APP_TONE_MS, APP_TONE_GAIN);
 }
 
 esp_err_t application_init(void)
 {
-    gpio_button_set_callback_func(0, application_button_boot_callback);
+    // 录音中再按一次: 放弃这次, 重新录; 流开关执行中的重复按键直接丢弃
+    gpio_button_set_action(0, BUTTON_EVENT_PRESS, application_button_boot_callback, BUTTON_ACTION_RESTART);
     gpio_button_set_callback_func(1, application_button_up_callback);
-    gpio_button_set_callback_func(2, application_button_down_callback);    
+    gpio_button_set_action(1, BUTTON_EVENT_LONG_PRESS, application_button_up_long_callback, BUTTON_ACTION_COALESCE);
+    gpio_button_set_callback_func(2, application_button_down_callback);
+    gpio_button_set_action(2, BUTTON_EVENT_LONG_PRESS, application_button_down_long_callback, BUTTON_ACTION_COALESCE);
+
+#ifdef CONFIG_AUDIO_HISTORY
+    i2s_audio_history_start(CONFIG_AUDIO_HISTORY_MS);
+#endif
+
+#ifdef CONFIG_AUDIO_RECORDER
+    // 没有存储卡时只是不录音, 流式发送照常工作
+    if (audio_recorder_init(AUDIO_RECORDER_FORMAT) == ESP_OK)
+    {
+#ifdef CONFIG_AUDIO_RECORDER_UPLOAD_ON_BOOT
+        audio_recorder_upload_start();
+#endif
+    }
+#endif
 
     return ESP_OK;
 }
@@ -0,0 +1,98 @@
+#include "audio_adpcm.h"
+
+static const int16_t audio_adpcm_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+    12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t audio_adpcm_index_table[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+void audio_adpcm_reset(audio_adpcm_state_t *state)
+{
+    state->predictor = 0;
+    state->step_index = 0;
+}
+
+// 解码一个码字并更新状态; 编码端用同一函数重建预测值, 保证两端一致
+static inline int16_t audio_adpcm_step(audio_adpcm_state_t *state, uint8_t code)
+{
+    int32_t step = audio_adpcm_step_table[state->step_index];
+    int32_t diff = step >> 3;
+    int32_t predictor = state->predictor;
+    int index;
+
+    if (code & 4) diff += step;
+    if (code & 2) diff += step >> 1;
+    if (code & 1) diff += step >> 2;
+    predictor += (code & 8) ? -diff : diff;
+    predictor = (predictor > INT16_MAX) ? INT16_MAX : (predictor < INT16_MIN) ? INT16_MIN : predictor;
+
+    index = state->step_index + audio_adpcm_index_table[code];
+    index = (index < 0) ? 0 : (index > 88) ? 88 : index;
+
+    state->predictor = (int16_t)predictor;
+    state->step_index = (int8_t)index;
+    return state->predictor;
+}
+
+static inline uint8_t audio_adpcm_encode_sample(audio_adpcm_state_t *state, int16_t sample)
+{
+    int32_t step = audio_adpcm_step_table[state->step_index];
+    int32_t diff = sample - state->predictor;
+    uint8_t code = 0;
+
+    if (diff < 0)
+    {
+        code = 8;
+        diff = -diff;
+    }
+    if (diff >= step)
+    {
+        code |= 4;
+        diff -= step;
+    }
+    step >>= 1;
+    if (diff >= step)
+    {
+        code |= 2;
+        diff -= step;
+    }
+    step >>= 1;
+    if (diff >= step)
+    {
+        code |= 1;
+    }
+
+    audio_adpcm_step(state, code);
+    return code;
+}
+
+int audio_adpcm_encode(audio_adpcm_state_t *state, const int16_t *pcm, int samples, uint8_t *output)
+{
+    int bytes = samples / 2;
+
+    for (int i = 0; i < bytes; i++)
+    {
+        uint8_t lo = audio_adpcm_encode_sample(state, pcm[2 * i]);
+        uint8_t hi = audio_adpcm_encode_sample(state, pcm[2 * i + 1]);
+        output[i] = (uint8_t)(lo | (hi << 4));
+    }
+    return bytes;
+}
+
+int audio_adpcm_decode(audio_adpcm_state_t *state, const uint8_t *input, int bytes, int16_t *pcm)
+{
+    for (int i = 0; i < bytes; i++)
+    {
+        pcm[2 * i] = audio_adpcm_step(state, input[i] & 0x0F);
+        pcm[2 * i + 1] = audio_adpcm_step(state, input[i] >> 4);
+    }
+    return bytes * 2;
+}
@@ -0,0 +1,23 @@
+#ifndef AUDIO_ADPCM_H
+#define AUDIO_ADPCM_H
+
+#include <stdint.h>
+
+/**
+ * IMA-ADPCM 流式编解码, 4bit/样本 (4:1).
+ * 预测值和步长索引在块之间延续, 所以流中不需要块头;
+ * 编码端和解码端都必须从 audio_adpcm_reset() 的初始状态开始.
+ * 字节内低 4 位是较早的样本 (与 IMA WAV 一致).
+ */
+typedef struct {
+    int16_t predictor;
+    int8_t step_index;
+} audio_adpcm_state_t;
+
+void audio_adpcm_reset(audio_adpcm_state_t *state);
+
+// samples 必须为偶数, 输出 samples / 2 字节
+int audio_adpcm_encode(audio_adpcm_state_t *state, const int16_t *pcm, int samples, uint8_t *output);
+int audio_adpcm_decode(audio_adpcm_state_t *state, const uint8_t *input, int bytes, int16_t *pcm);
+
+#endif // AUDIO_ADPCM_H
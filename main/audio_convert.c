@@ -0,0 +1,155 @@
+#include <math.h>
+#include <string.h>
+#include "audio_convert.h"
+
+static inline int32_t audio_convert_saturate(int32_t value)
+{
+    value = (value > INT16_MAX) ? INT16_MAX : value;
+    value = (value < -INT16_MAX) ? -INT16_MAX : value;
+    return value;
+}
+
+void audio_convert_int32_to_int16(const int32_t *input, int16_t *output, int samples, int shift)
+{
+    int i = 0;
+
+    // 每次先读 4 个再写 4 个, 原地转换时写入位置始终落后于读取位置
+    for (; i + 4 <= samples; i += 4)
+    {
+        int32_t v0 = input[i + 0] >> shift;
+        int32_t v1 = input[i + 1] >> shift;
+        int32_t v2 = input[i + 2] >> shift;
+        int32_t v3 = input[i + 3] >> shift;
+        output[i + 0] = (int16_t)audio_convert_saturate(v0);
+        output[i + 1] = (int16_t)audio_convert_saturate(v1);
+        output[i + 2] = (int16_t)audio_convert_saturate(v2);
+        output[i + 3] = (int16_t)audio_convert_saturate(v3);
+    }
+
+    for (; i < samples; i++)
+    {
+        output[i] = (int16_t)audio_convert_saturate(input[i] >> shift);
+    }
+}
+
+void audio_convert_unpack_to_int32(const uint8_t *packed, int32_t *output, int samples, int sample_bytes)
+{
+    if (sample_bytes == 2)
+    {
+        for (int i = 0; i < samples; i++)
+        {
+            uint32_t value = (uint32_t)packed[2 * i] | ((uint32_t)packed[2 * i + 1] << 8);
+            output[i] = (int32_t)(value << 16);
+        }
+    }
+    else if (sample_bytes == 3)
+    {
+        for (int i = 0; i < samples; i++)
+        {
+            uint32_t value = (uint32_t)packed[3 * i] | ((uint32_t)packed[3 * i + 1] << 8) | ((uint32_t)packed[3 * i + 2] << 16);
+            output[i] = (int32_t)(value << 8);
+        }
+    }
+    else if ((const void *)packed != (const void *)output)
+    {
+        memcpy(output, packed, (size_t)samples * sizeof(int32_t));
+    }
+}
+
+void audio_condition_default_config(audio_condition_config_t *config, int sample_rate)
+{
+    audio_condition_set_levels(config, AUDIO_CONDITION_DEFAULT_TARGET_DBFS, AUDIO_CONDITION_DEFAULT_MAX_GAIN_DB);
+    config->attack_samples = sample_rate / 1000 * AUDIO_CONDITION_DEFAULT_ATTACK_MS;
+    config->release_samples = sample_rate / 1000 * AUDIO_CONDITION_DEFAULT_RELEASE_MS;
+}
+
+void audio_condition_set_levels(audio_condition_config_t *config, int target_dbfs, int max_gain_db)
+{
+    config->target_peak = (int32_t)(INT16_MAX * powf(10.0f, target_dbfs / 20.0f));
+    config->max_gain = (int32_t)(AUDIO_CONDITION_GAIN_ONE * powf(10.0f, max_gain_db / 20.0f));
+}
+
+void audio_condition_init(audio_condition_t *cond, const audio_condition_config_t *config)
+{
+    cond->config = *config;
+    cond->dc_q6 = 0;
+    cond->gain = AUDIO_CONDITION_GAIN_ONE;
+    cond->gain_next = AUDIO_CONDITION_GAIN_ONE;
+    cond->primed = false;
+}
+
+static inline int32_t audio_condition_soft_limit(int32_t value)
+{
+    int32_t magnitude = (value < 0) ? -value : value;
+
+    if (magnitude <= AUDIO_CONDITION_LIMIT_KNEE)
+        return value;
+
+    // 超出部分按 over*room/(over+room) 压缩, room 是拐点到满幅的余量; 除法只在拐点以上发生
+    int32_t room = INT16_MAX - AUDIO_CONDITION_LIMIT_KNEE;
+    int32_t over = magnitude - AUDIO_CONDITION_LIMIT_KNEE;
+    over = (over > (1 << 17)) ? (1 << 17) : over;
+    magnitude = AUDIO_CONDITION_LIMIT_KNEE + over * room / (over + room);
+    return (value < 0) ? -magnitude : magnitude;
+}
+
+/**
+ * @brief 按本块峰值计算下一块结束时的增益: 目标增益让峰值落在 target_peak,
+ * 向目标靠近的比例 samples/(samples+tau) 近似 1-exp(-samples/tau).
+ */
+static void audio_condition_update_gain(audio_condition_t *cond, int32_t peak, int samples)
+{
+    int32_t gain = cond->gain;
+    int32_t target = gain;
+
+    if ((peak >> 4) >= AUDIO_CONDITION_NOISE_FLOOR)
+    {
+        // 输出 = y * gain >> 20 (y 是 24bit 域), 峰值落在 target_peak 需要 gain = target_peak << 20 / peak
+        int64_t wanted = ((int64_t)cond->config.target_peak << 20) / peak;
+        wanted = (wanted > cond->config.max_gain) ? cond->config.max_gain : wanted;
+        wanted = (wanted < AUDIO_CONDITION_MIN_GAIN) ? AUDIO_CONDITION_MIN_GAIN : wanted;
+        target = (int32_t)wanted;
+    }
+
+    int32_t tau = (target < gain) ? cond->config.attack_samples : cond->config.release_samples;
+    int32_t coef = (int32_t)(((int64_t)samples << 16) / (samples + tau));
+    cond->gain_next = gain + (int32_t)(((int64_t)(target - gain) * coef) >> 16);
+}
+
+void audio_convert_condition_int32_to_int16(audio_condition_t *cond, const int32_t *input, int16_t *output, int samples)
+{
+    if (samples <= 0)
+        return;
+
+    int32_t dc = cond->dc_q6;
+    int32_t gain = cond->gain;
+    int32_t step = (cond->gain_next - gain) / samples;
+    int32_t peak = 0;
+
+    // 第一个样本作为 DC 初值, 避免会话开头麦克风偏置产生的阶跃
+    if (!cond->primed)
+    {
+        dc = (input[0] >> 8) << 6;
+        cond->primed = true;
+    }
+
+    // 逐个样本先读后写, 原地转换时写入位置 (2i 字节) 始终不超过读取位置 (4i 字节)
+    for (int i = 0; i < samples; i++)
+    {
+        int32_t x = input[i] >> 8;                  // 24bit 有效数据
+        int32_t y = x - (dc >> 6);
+        dc += ((x << 6) - dc) >> AUDIO_CONDITION_DC_SHIFT;
+
+        int32_t magnitude = (y < 0) ? -y : y;
+        peak = (magnitude > peak) ? magnitude : peak;
+
+        // 单位增益时 >> 20 等于原来的 >> 12: 24bit 域再右移 4 位, 加上 Q16
+        gain += step;
+        int32_t value = (int32_t)(((int64_t)y * gain) >> 20);
+        output[i] = (int16_t)audio_condition_soft_limit(value);
+    }
+
+    cond->dc_q6 = dc;
+    cond->gain = cond->gain_next;
+    audio_condition_update_gain(cond, peak, samples);
+}
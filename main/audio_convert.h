@@ -0,0 +1,67 @@
+#ifndef AUDIO_CONVERT_H
+#define AUDIO_CONVERT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// INMP441 一类麦克风: 24bit 有效数据左对齐在 32bit 槽里, 右移 12 位得到 PCM16
+#define AUDIO_CONVERT_DEFAULT_SHIFT     12
+
+/**
+ * @brief int32 → int16 转换内核: 算术右移 shift 位后饱和到 [-INT16_MAX, INT16_MAX].
+ *
+ * 支持原地转换 (output == (int16_t *)input), 因为第 i 个输出只覆盖
+ * 已经读过的输入字节. 循环体无分支, Xtensa 上可编译为 MIN/MAX 指令.
+ * 32kHz 下每秒音频的耗时见 test/host 的基准, 只占帧周期的很小一部分, 所以没有 PIE 汇编版本.
+ */
+void audio_convert_int32_to_int16(const int32_t *input, int16_t *output, int samples, int shift);
+
+/**
+ * @brief 把 DMA 中按 sample_bytes (2/3/4) 打包的小端样本展开成左对齐的 int32.
+ *
+ * 支持原地展开: 打包数据放在 output 缓冲区的末尾 (偏移 samples * (4 - sample_bytes) 字节),
+ * 第 i 个输出只覆盖已经读过的打包字节.
+ */
+void audio_convert_unpack_to_int32(const uint8_t *packed, int32_t *output, int samples, int sample_bytes);
+
+// 信号调理: DC 高通 + 块自适应增益 + 软限幅, 与上面的转换在同一遍循环里完成
+#define AUDIO_CONDITION_DC_SHIFT        10          // DC 估计的时间常数 2^10 样本 (16kHz 时截止约 2.5Hz)
+#define AUDIO_CONDITION_GAIN_ONE        (1 << 16)   // 增益 Q16
+#define AUDIO_CONDITION_MIN_GAIN        (1 << 10)   // -36dB: 满幅的 24bit 输入按 >> 12 换算比 PCM16 满幅高 24dB
+#define AUDIO_CONDITION_DEFAULT_TARGET_DBFS     (-9)
+#define AUDIO_CONDITION_DEFAULT_MAX_GAIN_DB     24
+#define AUDIO_CONDITION_DEFAULT_ATTACK_MS       10
+#define AUDIO_CONDITION_DEFAULT_RELEASE_MS      1500
+#define AUDIO_CONDITION_NOISE_FLOOR     128         // 块峰值 (PCM16, 增益前) 低于此值时保持增益, 不放大底噪
+#define AUDIO_CONDITION_LIMIT_KNEE      24576       // 软限幅起点 (约 -2.5dBFS), 之上渐近逼近 INT16_MAX
+
+typedef struct {
+    int32_t target_peak;            // 块峰值的目标 (PCM16)
+    int32_t max_gain;               // Q16
+    int32_t attack_samples;         // 增益下降的时间常数
+    int32_t release_samples;        // 增益回升的时间常数
+} audio_condition_config_t;
+
+typedef struct {
+    audio_condition_config_t config;
+    int32_t dc_q6;                  // DC 估计, 24bit 域左移 6 位保留小数
+    int32_t gain;                   // 上一块结束时的增益 (Q16)
+    int32_t gain_next;              // 本块结束时要达到的增益, 块内线性过渡
+    bool primed;
+} audio_condition_t;
+
+void audio_condition_default_config(audio_condition_config_t *config, int sample_rate);
+void audio_condition_set_levels(audio_condition_config_t *config, int target_dbfs, int max_gain_db);
+void audio_condition_init(audio_condition_t *cond, const audio_condition_config_t *config);
+
+/**
+ * @brief 带调理的 int32 → int16 转换, 每个样本依次经过:
+ * DC 高通 (x - 低通(x)), 增益 (块内从上一块的增益线性过渡到由上一块峰值算出的增益),
+ * 软限幅 (拐点以上按 K + over*room/(over+room) 压缩, 输出不超过 INT16_MAX).
+ *
+ * 增益比信号晚一块: 突发的大声块先由软限幅兜住, 下一块起增益按 attack 下降;
+ * 静音 (峰值低于噪声门限) 时增益保持不变. 全部为整数运算, 支持原地转换.
+ */
+void audio_convert_condition_int32_to_int16(audio_condition_t *cond, const int32_t *input, int16_t *output, int samples);
+
+#endif // AUDIO_CONVERT_H
@@ -0,0 +1,242 @@
+#include <stdio.h>
+#include <string.h>
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "audio_downlink.h"
+#include "audio_adpcm.h"
+#include "audio_resample.h"
+#include "i2s_audio.h"
+#include "audio_playback.h"
+#include "network_socket.h"
+#include "stream_frame.h"
+#include "audio_metrics.h"
+
+static const char *TAG = "AUDIO_DOWNLINK";
+
+#define AUDIO_DOWNLINK_DECODE_BYTES     256     // PCM16 128 样本 / ADPCM 512 样本
+
+static uint8_t audio_downlink_recv_buffer[AUDIO_DOWNLINK_RECV_SIZE];
+static uint8_t audio_downlink_payload[AUDIO_DOWNLINK_MAX_PAYLOAD] __attribute__((aligned(4)));
+static uint8_t audio_downlink_ring_storage[AUDIO_DOWNLINK_RING_SIZE];
+static int16_t audio_downlink_decode_buffer[AUDIO_DOWNLINK_DECODE_BYTES * 2];
+static int16_t audio_downlink_resample_buffer[AUDIO_DOWNLINK_DECODE_BYTES * 4 + 1];
+
+static stream_frame_parser_t audio_downlink_parser;
+static audio_jitter_t audio_downlink_jitter;
+static audio_adpcm_state_t audio_downlink_adpcm;
+static audio_resample_t audio_downlink_resample;
+static audio_downlink_stats_t audio_downlink_stats;
+static uint16_t audio_downlink_session_id = 0;
+static uint8_t audio_downlink_codec = STREAM_CODEC_PCM16;
+static volatile bool audio_downlink_flag = false;
+static TaskHandle_t audio_downlink_rx_task_handle = NULL;
+static int audio_downlink_voice = -1;
+
+// 重采样到播放采样率后推入抖动缓冲, 样本序号按输出采样率换算
+static void audio_downlink_push_pcm16(const int16_t *pcm, int samples, uint32_t sample_index, int64_t now)
+{
+    int out = audio_resample_process(&audio_downlink_resample, pcm, samples, audio_downlink_resample_buffer,
+                                     sizeof(audio_downlink_resample_buffer) / sizeof(int16_t));
+    uint32_t out_index = (uint32_t)(((uint64_t)sample_index * audio_downlink_resample.out_rate) /
+                                    audio_downlink_resample.in_rate);
+    audio_jitter_push(&audio_downlink_jitter, audio_downlink_resample_buffer, out, out_index, now);
+}
+
+static void audio_downlink_push(const stream_frame_header_t *header, const uint8_t *payload, int64_t now)
+{
+    uint32_t sample_index = header->sample_index;
+
+    // 按 AUDIO_DOWNLINK_DECODE_BYTES 分块, ADPCM 先解码 (2 样本/字节)
+    for (uint32_t offset = 0; offset < header->payload_len; offset += AUDIO_DOWNLINK_DECODE_BYTES)
+    {
+        int bytes = header->payload_len - offset;
+        bytes = (bytes > AUDIO_DOWNLINK_DECODE_BYTES) ? AUDIO_DOWNLINK_DECODE_BYTES : bytes;
+        if (audio_downlink_codec == STREAM_CODEC_ADPCM)
+        {
+            int samples = audio_adpcm_decode(&audio_downlink_adpcm, payload + offset, bytes, audio_downlink_decode_buffer);
+            audio_downlink_push_pcm16(audio_downlink_decode_buffer, samples, sample_index, now);
+            sample_index += samples;
+        }
+        else
+        {
+            int samples = bytes / sizeof(int16_t);
+            audio_downlink_push_pcm16((const int16_t *)(payload + offset), samples, sample_index, now);
+            sample_index += samples;
+        }
+    }
+}
+
+static void audio_downlink_on_frame(const stream_frame_header_t *header, const uint8_t *payload, void *ctx)
+{
+    int64_t now = esp_timer_get_time();
+
+    switch (header->type)
+    {
+    case STREAM_FRAME_SESSION:
+    {
+        stream_frame_session_t session;
+        if (header->payload_len < sizeof(session))
+        {
+            audio_downlink_stats.parse_errors++;
+            return;
+        }
+        memcpy(&session, payload, sizeof(session));
+        if ((session.codec != STREAM_CODEC_PCM16) && (session.codec != STREAM_CODEC_ADPCM))
+        {
+            ESP_LOGW(TAG, "Unsupported downlink codec %u.", session.codec);
+            audio_downlink_session_id = 0;
+            return;
+        }
+        // 流声部的采样率固定为扬声器采样率, 以便和其它声部混音, 只接受能重采样过去的会话
+        if (audio_resample_init(&audio_downlink_resample, session.sample_rate, I2S_AUDIO_SPK_SAMPLE_RATE) != ESP_OK)
+        {
+            ESP_LOGW(TAG, "Unsupported downlink sample rate %lu Hz.", (unsigned long)session.sample_rate);
+            audio_downlink_session_id = 0;
+            return;
+        }
+        audio_downlink_session_id = header->session_id;
+        audio_downlink_codec = session.codec;
+        audio_adpcm_reset(&audio_downlink_adpcm);
+        audio_jitter_start_session(&audio_downlink_jitter, I2S_AUDIO_SPK_SAMPLE_RATE);
+        audio_downlink_stats.sessions++;
+        ESP_LOGI(TAG, "Downlink session %u: codec %u, %lu Hz.", header->session_id, session.codec,
+                 (unsigned long)session.sample_rate);
+        break;
+    }
+    case STREAM_FRAME_AUDIO:
+        if ((audio_downlink_session_id == 0) || (header->session_id != audio_downlink_session_id))
+            return;
+        audio_downlink_stats.frames++;
+        audio_downlink_push(header, payload, now);
+        break;
+    case STREAM_FRAME_METRICS:
+        // 服务器请求指标快照, 由上行发送任务在下一个块之后发出
+        audio_metrics_request();
+        break;
+    case STREAM_FRAME_END:
+        if (header->session_id == audio_downlink_session_id)
+        {
+            audio_jitter_end_session(&audio_downlink_jitter);
+            audio_downlink_session_id = 0;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief 接收任务: 只在连接上读数据并解析, 不会阻塞上行发送 (recv 不占用发送锁).
+ */
+static void audio_downlink_rx_task(void *arg)
+{
+    ESP_LOGI(TAG, "audio_downlink_rx_task() start!");
+    audio_metrics_register_task();
+
+    while (audio_downlink_flag)
+    {
+        int n = network_socket_recv(audio_downlink_recv_buffer, sizeof(audio_downlink_recv_buffer),
+                                    AUDIO_DOWNLINK_RECV_TIMEOUT_MS);
+        if (n < 0)
+        {
+            // 连接断开: 等待连接管理任务重连, 丢弃半帧
+            stream_frame_parser_reset(&audio_downlink_parser);
+            vTaskDelay(pdMS_TO_TICKS(AUDIO_DOWNLINK_RECV_TIMEOUT_MS));
+            continue;
+        }
+        if (n == 0)
+            continue;
+
+        audio_downlink_stats.bytes += n;
+        if (stream_frame_parser_feed(&audio_downlink_parser, audio_downlink_recv_buffer, n) != ESP_OK)
+            audio_downlink_stats.parse_errors++;
+    }
+
+    // 等流声部淡出结束, 之后播放任务不再访问抖动缓冲, 下次 start 可以重新初始化
+    audio_playback_stop(audio_downlink_voice);
+    audio_playback_wait(audio_downlink_voice, AUDIO_DOWNLINK_STOP_TIMEOUT_MS);
+    audio_downlink_voice = -1;
+    audio_downlink_get_stats(&audio_downlink_stats);
+    ESP_LOGI(TAG, "audio_downlink_rx_task() stop! sessions %lu, frames %lu, resyncs %lu",
+             (unsigned long)audio_downlink_stats.sessions, (unsigned long)audio_downlink_stats.frames,
+             (unsigned long)audio_downlink_parser.resyncs);
+    ESP_LOGI(TAG, "Downlink playback: underruns %lu, trimmed %lu, jitter %lu us, max depth %lu",
+             (unsigned long)audio_downlink_stats.jitter.underruns, (unsigned long)audio_downlink_stats.jitter.trimmed,
+             (unsigned long)audio_downlink_stats.jitter.jitter_us, (unsigned long)audio_downlink_stats.jitter.max_depth);
+    audio_metrics_unregister_task();
+    audio_downlink_rx_task_handle = NULL;
+    vTaskDelete(NULL);
+}
+
+// 流声部的来源, 在播放任务中调用; 抖动缓冲的消费者只有这一个
+static int audio_downlink_pull(void *ctx, int16_t *out, int samples)
+{
+    return audio_jitter_pop(&audio_downlink_jitter, out, samples);
+}
+
+esp_err_t audio_downlink_start(void)
+{
+    audio_jitter_config_t config;
+
+    if (NETWORK_SOCKET_USE_UDP)
+    {
+        ESP_LOGW(TAG, "Downlink playback needs the TCP transport.");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (audio_downlink_rx_task_handle || (audio_downlink_voice >= 0))
+    {
+        ESP_LOGW(TAG, "Downlink is still running.");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    audio_jitter_default_config(&config);
+    if ((audio_jitter_init(&audio_downlink_jitter, &config, audio_downlink_ring_storage,
+                           sizeof(audio_downlink_ring_storage)) != ESP_OK) ||
+        (stream_frame_parser_init(&audio_downlink_parser, audio_downlink_payload, sizeof(audio_downlink_payload),
+                                  audio_downlink_on_frame, NULL) != ESP_OK))
+    {
+        return ESP_FAIL;
+    }
+    memset(&audio_downlink_stats, 0, sizeof(audio_downlink_stats));
+    audio_downlink_session_id = 0;
+
+    audio_downlink_voice = audio_playback_stream(audio_downlink_pull, NULL, I2S_AUDIO_SPK_SAMPLE_RATE,
+                                                 AUDIO_MIXER_GAIN_UNITY);
+    if (audio_downlink_voice < 0)
+    {
+        ESP_LOGW(TAG, "No playback voice for the downlink.");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    audio_downlink_flag = true;
+    if (xTaskCreate(audio_downlink_rx_task, "AudioDownlinkTask", 3072, NULL, AUDIO_DOWNLINK_RX_TASK_PRIO,
+                    &audio_downlink_rx_task_handle) != pdPASS)
+    {
+        // 没有接收任务来收尾, 在这里释放流声部, 否则下次 start 一直返回 INVALID_STATE
+        audio_downlink_flag = false;
+        audio_playback_stop(audio_downlink_voice);
+        audio_playback_wait(audio_downlink_voice, AUDIO_DOWNLINK_STOP_TIMEOUT_MS);
+        audio_downlink_voice = -1;
+        ESP_LOGE(TAG, "Failed to create the downlink task.");
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t audio_downlink_stop(void)
+{
+    audio_downlink_flag = false;
+    return ESP_OK;
+}
+
+esp_err_t audio_downlink_get_stats(audio_downlink_stats_t *stats)
+{
+    if (stats == NULL)
+        return ESP_ERR_INVALID_ARG;
+    if (stats != &audio_downlink_stats)
+        *stats = audio_downlink_stats;
+    audio_jitter_get_stats(&audio_downlink_jitter, &stats->jitter);
+    return ESP_OK;
+}
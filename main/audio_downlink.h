@@ -0,0 +1,33 @@
+#ifndef AUDIO_DOWNLINK_H
+#define AUDIO_DOWNLINK_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "audio_jitter.h"
+
+/**
+ * 下行播放: 在上行流会话期间, 从同一连接接收服务器下发的分帧音频 (stream_frame.h),
+ * 经自适应抖动缓冲后作为 audio_playback 的一个流声部播放, 可以和提示音/录音回放同时发声.
+ * 下行会话支持 PCM16 / IMA-ADPCM, 16k/24k/8k 会话经 audio_resample 转为扬声器采样率,
+ * 其它采样率的会话被忽略.
+ */
+#define AUDIO_DOWNLINK_RECV_SIZE            1024
+#define AUDIO_DOWNLINK_MAX_PAYLOAD          4096
+#define AUDIO_DOWNLINK_RING_SIZE            32768   // 16K 样本, 16kHz 下约 1s
+#define AUDIO_DOWNLINK_RECV_TIMEOUT_MS      100
+#define AUDIO_DOWNLINK_RX_TASK_PRIO         5
+#define AUDIO_DOWNLINK_STOP_TIMEOUT_MS      1000
+
+typedef struct {
+    uint32_t sessions;
+    uint32_t frames;
+    uint32_t bytes;
+    uint32_t parse_errors;
+    audio_jitter_stats_t jitter;
+} audio_downlink_stats_t;
+
+esp_err_t audio_downlink_start(void);
+esp_err_t audio_downlink_stop(void);
+esp_err_t audio_downlink_get_stats(audio_downlink_stats_t *stats);
+
+#endif // AUDIO_DOWNLINK_H
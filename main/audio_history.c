@@ -0,0 +1,71 @@
+#include <string.h>
+#include "audio_history.h"
+
+esp_err_t audio_history_init(audio_history_t *history, int32_t *storage, uint32_t samples)
+{
+    if ((history == NULL) || (storage == NULL) || (samples == 0) || ((samples & (samples - 1)) != 0))
+        return ESP_ERR_INVALID_ARG;
+
+    history->buffer = storage;
+    history->size = samples;
+    history->mask = samples - 1;
+    atomic_init(&history->total, 0);
+    atomic_init(&history->reserved, 0);
+    return ESP_OK;
+}
+
+void audio_history_write(audio_history_t *history, const int32_t *data, int samples)
+{
+    uint32_t total = atomic_load_explicit(&history->total, memory_order_relaxed);
+
+    // 一次写入超过缓冲区长度时只保留最后 size 个样本
+    if ((uint32_t)samples > history->size)
+    {
+        total += (uint32_t)samples - history->size;
+        data += samples - history->size;
+        samples = history->size;
+    }
+
+    atomic_store_explicit(&history->reserved, total + (uint32_t)samples, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    uint32_t offset = total & history->mask;
+    uint32_t first = history->size - offset;
+    first = (first > (uint32_t)samples) ? (uint32_t)samples : first;
+    memcpy(history->buffer + offset, data, first * sizeof(int32_t));
+    memcpy(history->buffer, data + first, (samples - first) * sizeof(int32_t));
+
+    atomic_store_explicit(&history->total, total + (uint32_t)samples, memory_order_release);
+}
+
+uint32_t audio_history_total(audio_history_t *history)
+{
+    return atomic_load_explicit(&history->total, memory_order_acquire);
+}
+
+esp_err_t audio_history_copy(audio_history_t *history, uint32_t start, int samples, int32_t *out)
+{
+    if ((uint32_t)samples > history->size)
+        return ESP_ERR_INVALID_SIZE;
+
+    uint32_t total = audio_history_total(history);
+    if ((uint32_t)(total - start) > (uint32_t)INT32_MAX)
+        return ESP_ERR_NOT_FOUND;           // start 在 total 之后
+    if ((total - start) < (uint32_t)samples)
+        return ESP_ERR_NOT_FOUND;
+    if ((total - start) > history->size)
+        return ESP_ERR_INVALID_STATE;
+
+    uint32_t offset = start & history->mask;
+    uint32_t first = history->size - offset;
+    first = (first > (uint32_t)samples) ? (uint32_t)samples : first;
+    memcpy(out, history->buffer + offset, first * sizeof(int32_t));
+    memcpy(out + first, history->buffer, (samples - first) * sizeof(int32_t));
+
+    // 拷贝期间写入端可能已经绕回覆盖了起点
+    atomic_thread_fence(memory_order_acquire);
+    uint32_t reserved = atomic_load_explicit(&history->reserved, memory_order_relaxed);
+    if ((reserved - start) > history->size)
+        return ESP_ERR_INVALID_STATE;
+    return ESP_OK;
+}
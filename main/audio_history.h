@@ -0,0 +1,36 @@
+#ifndef AUDIO_HISTORY_H
+#define AUDIO_HISTORY_H
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include "esp_err.h"
+
+/**
+ * 覆盖式历史缓冲 (int32 原始采样), 用于始终开启的麦克风预录.
+ *
+ * 写入端永不阻塞, 旧数据直接被覆盖. 读取端按绝对样本序号取一段数据:
+ * total 是已写入的样本总数 (uint32 回绕, 用无符号差值比较), 用 size - 1 掩码得到
+ * 实际位置, 所以 size 必须是 2 的幂 (回绕时位置仍然连续).
+ * 写入端先推进 reserved 再写数据, 读取端拷贝完成后检查 reserved,
+ * 拷贝期间被覆盖 (包括正在写入的块) 则返回错误 (类似 seqlock).
+ */
+typedef struct {
+    int32_t *buffer;
+    uint32_t size;                  // 样本数
+    uint32_t mask;
+    atomic_uint total;              // 已写完的样本总数
+    atomic_uint reserved;           // 正在写入的末尾 (写入前先推进), 读取端据此判断是否被覆盖
+} audio_history_t;
+
+esp_err_t audio_history_init(audio_history_t *history, int32_t *storage, uint32_t samples);
+void audio_history_write(audio_history_t *history, const int32_t *data, int samples);
+uint32_t audio_history_total(audio_history_t *history);
+
+/**
+ * @brief 拷贝 [start, start + samples) 范围的样本.
+ * @return ESP_OK; ESP_ERR_NOT_FOUND 表示还没写到; ESP_ERR_INVALID_STATE 表示已被覆盖;
+ *         ESP_ERR_INVALID_SIZE 表示范围超过缓冲区长度.
+ */
+esp_err_t audio_history_copy(audio_history_t *history, uint32_t start, int samples, int32_t *out);
+
+#endif // AUDIO_HISTORY_H
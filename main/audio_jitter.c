@@ -0,0 +1,140 @@
+#include <string.h>
+#include "audio_jitter.h"
+
+static uint32_t audio_jitter_ms_to_samples(uint32_t ms, uint32_t sample_rate)
+{
+    return (uint32_t)(((uint64_t)ms * sample_rate) / 1000);
+}
+
+static void audio_jitter_update_target(audio_jitter_t *jitter)
+{
+    uint32_t min = audio_jitter_ms_to_samples(jitter->config.min_ms, jitter->sample_rate);
+    uint32_t max = audio_jitter_ms_to_samples(jitter->config.max_ms, jitter->sample_rate);
+    uint64_t extra_us = (uint64_t)(jitter->jitter_q4_us >> 4) * jitter->config.multiplier;
+    uint32_t target = min + (uint32_t)((extra_us * jitter->sample_rate) / 1000000);
+
+    atomic_store(&jitter->target, (target > max) ? max : target);
+}
+
+void audio_jitter_default_config(audio_jitter_config_t *config)
+{
+    config->min_ms = AUDIO_JITTER_DEFAULT_MIN_MS;
+    config->max_ms = AUDIO_JITTER_DEFAULT_MAX_MS;
+    config->multiplier = AUDIO_JITTER_DEFAULT_MULTIPLIER;
+}
+
+esp_err_t audio_jitter_init(audio_jitter_t *jitter, const audio_jitter_config_t *config,
+                            void *storage, size_t size)
+{
+    if ((jitter == NULL) || (config == NULL) || (config->min_ms > config->max_ms))
+        return ESP_ERR_INVALID_ARG;
+
+    memset(jitter, 0, sizeof(*jitter));
+    esp_err_t err = audio_ring_init(&jitter->ring, storage, size);
+    if (err != ESP_OK)
+        return err;
+
+    jitter->config = *config;
+    jitter->buffering = true;
+    atomic_init(&jitter->draining, false);
+    audio_jitter_start_session(jitter, 16000);
+    return ESP_OK;
+}
+
+void audio_jitter_start_session(audio_jitter_t *jitter, uint32_t sample_rate)
+{
+    jitter->sample_rate = sample_rate ? sample_rate : 16000;
+    jitter->have_transit = false;
+    // 保留上一会话的抖动估计, 网络状况通常不会随会话改变
+    audio_jitter_update_target(jitter);
+    atomic_store(&jitter->draining, false);
+}
+
+int audio_jitter_push(audio_jitter_t *jitter, const int16_t *pcm, int samples,
+                      uint32_t sample_index, int64_t arrival_us)
+{
+    int64_t media_us = ((int64_t)sample_index * 1000000) / jitter->sample_rate;
+    int64_t transit_us = arrival_us - media_us;
+
+    if (jitter->have_transit)
+    {
+        int64_t d = transit_us - jitter->last_transit_us;
+        if (d < 0)
+            d = -d;
+        // Q4 定点: J += (|D| - J) / 16
+        jitter->jitter_q4_us += d - ((jitter->jitter_q4_us + 8) >> 4);
+        audio_jitter_update_target(jitter);
+    }
+    jitter->last_transit_us = transit_us;
+    jitter->have_transit = true;
+
+    size_t bytes = audio_ring_write(&jitter->ring, pcm, (size_t)samples * sizeof(int16_t));
+    int written = (int)(bytes / sizeof(int16_t));
+    jitter->overflows += (uint32_t)(samples - written);
+    return written;
+}
+
+void audio_jitter_end_session(audio_jitter_t *jitter)
+{
+    atomic_store(&jitter->draining, true);
+}
+
+uint32_t audio_jitter_depth(audio_jitter_t *jitter)
+{
+    return (uint32_t)(audio_ring_used(&jitter->ring) / sizeof(int16_t));
+}
+
+int audio_jitter_pop(audio_jitter_t *jitter, int16_t *out, int samples)
+{
+    uint32_t depth = audio_jitter_depth(jitter);
+    uint32_t target = atomic_load(&jitter->target);
+    bool draining = atomic_load(&jitter->draining);
+
+    if (depth > jitter->max_depth)
+        jitter->max_depth = depth;
+
+    if (jitter->buffering)
+    {
+        if ((depth < target) && !(draining && (depth > 0)))
+        {
+            memset(out, 0, (size_t)samples * sizeof(int16_t));
+            jitter->silence += (uint32_t)samples;
+            return 0;
+        }
+        jitter->buffering = false;
+    }
+
+    // 突发到达后深度远超目标: 每次丢弃一小段, 避免一次性跳变
+    if (!draining && (depth > target + target / 2))
+    {
+        uint32_t trim = depth - target;
+        uint32_t limit = (uint32_t)samples / AUDIO_JITTER_TRIM_DIVISOR;
+        trim = (trim > limit) ? limit : trim;
+        audio_ring_read_consume(&jitter->ring, trim * sizeof(int16_t));
+        jitter->trimmed += trim;
+    }
+
+    size_t bytes = audio_ring_read(&jitter->ring, out, (size_t)samples * sizeof(int16_t));
+    int got = (int)(bytes / sizeof(int16_t));
+    if (got < samples)
+    {
+        memset(out + got, 0, (size_t)(samples - got) * sizeof(int16_t));
+        jitter->silence += (uint32_t)(samples - got);
+        jitter->buffering = true;
+        // 会话正常播完不算欠载
+        if (!draining)
+            jitter->underruns++;
+    }
+    return got;
+}
+
+void audio_jitter_get_stats(audio_jitter_t *jitter, audio_jitter_stats_t *stats)
+{
+    stats->underruns = jitter->underruns;
+    stats->overflows = jitter->overflows;
+    stats->trimmed = jitter->trimmed;
+    stats->silence = jitter->silence;
+    stats->max_depth = jitter->max_depth;
+    stats->jitter_us = (uint32_t)(jitter->jitter_q4_us >> 4);
+    stats->target = atomic_load(&jitter->target);
+}
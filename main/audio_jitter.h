@@ -0,0 +1,90 @@
+#ifndef AUDIO_JITTER_H
+#define AUDIO_JITTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include "esp_err.h"
+#include "audio_ring.h"
+
+/**
+ * 自适应抖动缓冲 (PCM16 单声道).
+ *
+ * 生产者 (网络接收) 调用 push, 按 RFC 3550 方式估计到达抖动 J:
+ *   D = (到达时间 - 媒体时间) 的相邻差, J += (|D| - J) / 16
+ * 目标深度 = min + J * multiplier, 限制在 [min, max] 之间.
+ * 消费者 (播放) 调用 pop: 缓冲中深度达到目标前输出静音; 欠载时补静音并重新缓冲;
+ * 深度超过目标 1.5 倍时每次少量丢弃样本, 逐步收回多余时延.
+ * 底层是 SPSC 环形缓冲区, push/pop 分别只能在一个任务里调用.
+ */
+#define AUDIO_JITTER_DEFAULT_MIN_MS         40
+#define AUDIO_JITTER_DEFAULT_MAX_MS         400
+#define AUDIO_JITTER_DEFAULT_MULTIPLIER     3
+#define AUDIO_JITTER_TRIM_DIVISOR           16      // 每次 pop 最多丢弃请求长度的 1/16
+
+typedef struct {
+    uint32_t min_ms;
+    uint32_t max_ms;
+    uint32_t multiplier;
+} audio_jitter_config_t;
+
+typedef struct {
+    uint32_t underruns;             // 播放中途缓冲被取空的次数
+    uint32_t overflows;             // 缓冲区满, 丢弃的推入样本数
+    uint32_t trimmed;               // 为降低时延丢弃的样本数
+    uint32_t silence;               // 缓冲/欠载期间输出的静音样本数
+    uint32_t max_depth;             // 观察到的最大深度 (样本)
+    uint32_t jitter_us;             // 当前抖动估计
+    uint32_t target;                // 当前目标深度 (样本)
+} audio_jitter_stats_t;
+
+typedef struct {
+    audio_ring_t ring;
+    audio_jitter_config_t config;
+    // 生产者状态
+    uint32_t sample_rate;
+    bool have_transit;
+    int64_t last_transit_us;
+    int64_t jitter_q4_us;
+    uint32_t overflows;
+    // 生产者写, 消费者读
+    atomic_uint target;
+    atomic_bool draining;
+    // 消费者状态
+    bool buffering;
+    uint32_t underruns;
+    uint32_t trimmed;
+    uint32_t silence;
+    uint32_t max_depth;
+} audio_jitter_t;
+
+void audio_jitter_default_config(audio_jitter_config_t *config);
+esp_err_t audio_jitter_init(audio_jitter_t *jitter, const audio_jitter_config_t *config,
+                            void *storage, size_t size);
+
+/**
+ * @brief 生产者: 开始新的会话 (新的采样率和时间基准), 保留已缓冲的样本.
+ */
+void audio_jitter_start_session(audio_jitter_t *jitter, uint32_t sample_rate);
+
+/**
+ * @brief 生产者: 推入一段样本. sample_index 为第一个样本在会话中的序号, arrival_us 为到达时刻.
+ * 返回实际写入的样本数.
+ */
+int audio_jitter_push(audio_jitter_t *jitter, const int16_t *pcm, int samples,
+                      uint32_t sample_index, int64_t arrival_us);
+
+/**
+ * @brief 生产者: 会话结束, 允许消费者把不足目标深度的剩余样本播完.
+ */
+void audio_jitter_end_session(audio_jitter_t *jitter);
+
+/**
+ * @brief 消费者: 取出 samples 个样本, 不足部分填静音. 返回真实样本数.
+ */
+int audio_jitter_pop(audio_jitter_t *jitter, int16_t *out, int samples);
+
+uint32_t audio_jitter_depth(audio_jitter_t *jitter);
+void audio_jitter_get_stats(audio_jitter_t *jitter, audio_jitter_stats_t *stats);
+
+#endif // AUDIO_JITTER_H
@@ -0,0 +1,372 @@
+#include <string.h>
+#include <stdatomic.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/semphr.h"
+#include "audio_metrics.h"
+
+static const char *TAG = "AUDIO_METRICS";
+
+#ifdef CONFIG_AUDIO_METRICS
+
+typedef struct {
+    atomic_uint count;
+    atomic_uint max_us;
+    uint64_t sum_us;                    // 每个阶段只由一个任务记录, 64 位和不用原子操作
+    atomic_uint buckets[AUDIO_METRICS_BUCKETS];
+} audio_metrics_stage_state_t;
+
+typedef struct {
+    TaskHandle_t handle;                // NULL 表示任务已注销, 条目保留高水位
+    audio_metrics_task_t info;
+    uint32_t last_runtime;
+    uint32_t last_total;
+} audio_metrics_task_state_t;
+
+static atomic_uint audio_metrics_counters[AUDIO_METRICS_COUNTER_MAX];
+static audio_metrics_stage_state_t audio_metrics_stages[AUDIO_METRICS_STAGE_MAX];
+static atomic_uint audio_metrics_depth[AUDIO_METRICS_QUEUE_MAX];
+static atomic_uint audio_metrics_depth_high[AUDIO_METRICS_QUEUE_MAX];
+static audio_metrics_task_state_t audio_metrics_tasks[AUDIO_METRICS_MAX_TASKS];
+static SemaphoreHandle_t audio_metrics_mutex = NULL;
+static esp_timer_handle_t audio_metrics_timer = NULL;
+static atomic_bool audio_metrics_pending = false;
+static audio_metrics_snapshot_t audio_metrics_log_snapshot;
+
+static const char *audio_metrics_counter_names[AUDIO_METRICS_COUNTER_MAX] = {
+    [AUDIO_METRICS_FRAMES_CAPTURED]   = "captured",
+    [AUDIO_METRICS_FRAMES_SENT]       = "sent",
+    [AUDIO_METRICS_CAPTURE_OVERRUNS]  = "overruns",
+    [AUDIO_METRICS_I2S_SHORT_READS]   = "short_reads",
+    [AUDIO_METRICS_PARTIAL_SENDS]     = "partial_sends",
+    [AUDIO_METRICS_SEND_ERRORS]       = "send_errors",
+    [AUDIO_METRICS_CONNECTS]          = "connects",
+    [AUDIO_METRICS_CONNECT_FAILURES]  = "connect_failures",
+    [AUDIO_METRICS_DISCONNECTS]       = "disconnects",
+    [AUDIO_METRICS_PUBLISH_DROPS]     = "publish_drops",
+    [AUDIO_METRICS_UDP_DROPS]         = "udp_drops",
+};
+
+static const char *audio_metrics_stage_names[AUDIO_METRICS_STAGE_MAX] = {
+    [AUDIO_METRICS_STAGE_READ]    = "read",
+    [AUDIO_METRICS_STAGE_CONVERT] = "convert",
+    [AUDIO_METRICS_STAGE_ENCODE]  = "encode",
+    [AUDIO_METRICS_STAGE_SEND]    = "send",
+};
+
+static const char *audio_metrics_queue_names[AUDIO_METRICS_QUEUE_MAX] = {
+    [AUDIO_METRICS_QUEUE_READY]   = "ready",
+    [AUDIO_METRICS_QUEUE_PUBLISH] = "publish",
+};
+
+static void audio_metrics_update_max(atomic_uint *max, uint32_t value)
+{
+    unsigned current = atomic_load_explicit(max, memory_order_relaxed);
+    while ((value > current) &&
+           !atomic_compare_exchange_weak_explicit(max, &current, value, memory_order_relaxed, memory_order_relaxed))
+        ;
+}
+
+void audio_metrics_count(audio_metrics_counter_t counter)
+{
+    atomic_fetch_add_explicit(&audio_metrics_counters[counter], 1, memory_order_relaxed);
+}
+
+void audio_metrics_add(audio_metrics_counter_t counter, uint32_t value)
+{
+    atomic_fetch_add_explicit(&audio_metrics_counters[counter], value, memory_order_relaxed);
+}
+
+void audio_metrics_record_us(audio_metrics_stage_t stage, uint32_t us)
+{
+    audio_metrics_stage_state_t *state = &audio_metrics_stages[stage];
+    int bucket = us ? (31 - __builtin_clz(us)) : 0;
+
+    if (bucket >= AUDIO_METRICS_BUCKETS)
+        bucket = AUDIO_METRICS_BUCKETS - 1;
+    atomic_fetch_add_explicit(&state->buckets[bucket], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&state->count, 1, memory_order_relaxed);
+    state->sum_us += us;
+    audio_metrics_update_max(&state->max_us, us);
+}
+
+void audio_metrics_queue_depth(audio_metrics_queue_t queue, uint32_t depth)
+{
+    atomic_store_explicit(&audio_metrics_depth[queue], depth, memory_order_relaxed);
+    audio_metrics_update_max(&audio_metrics_depth_high[queue], depth);
+}
+
+// 调用者持有 audio_metrics_mutex
+static void audio_metrics_sample_task(audio_metrics_task_state_t *task)
+{
+    uint32_t stack_free = uxTaskGetStackHighWaterMark(task->handle);
+
+    if ((task->info.stack_free_min == 0) || (stack_free < task->info.stack_free_min))
+        task->info.stack_free_min = stack_free;
+
+#ifdef CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    // 运行时计数器和总时间用同一个时钟, 比值就是这段时间内占单核的比例
+    uint32_t runtime = ulTaskGetRunTimeCounter(task->handle);
+    uint32_t total = portGET_RUN_TIME_COUNTER_VALUE();
+    if ((task->last_total != 0) && (total != task->last_total))
+    {
+        uint64_t permille = (uint64_t)(runtime - task->last_runtime) * 1000 / (total - task->last_total);
+        task->info.cpu_permille = (permille > 1000) ? 1000 : (uint16_t)permille;
+        if (task->info.cpu_permille > task->info.cpu_peak_permille)
+            task->info.cpu_peak_permille = task->info.cpu_permille;
+    }
+    task->last_runtime = runtime;
+    task->last_total = total;
+#else
+    task->info.cpu_permille = 0xFFFF;
+    task->info.cpu_peak_permille = 0xFFFF;
+#endif
+}
+
+void audio_metrics_register_task(void)
+{
+    const char *name = pcTaskGetName(NULL);
+    audio_metrics_task_state_t *slot = NULL;
+
+    if (audio_metrics_mutex == NULL)
+        return;
+
+    xSemaphoreTake(audio_metrics_mutex, portMAX_DELAY);
+    for (int i = 0; i < AUDIO_METRICS_MAX_TASKS; i++)
+    {
+        audio_metrics_task_state_t *task = &audio_metrics_tasks[i];
+        if (strncmp(task->info.name, name, AUDIO_METRICS_TASK_NAME_LEN) == 0)
+        {
+            slot = task;
+            break;
+        }
+        if ((slot == NULL) && (task->info.name[0] == '\0'))
+            slot = task;
+    }
+    if (slot)
+    {
+        strncpy(slot->info.name, name, AUDIO_METRICS_TASK_NAME_LEN - 1);
+        slot->handle = xTaskGetCurrentTaskHandle();
+        slot->last_total = 0;
+    }
+    xSemaphoreGive(audio_metrics_mutex);
+}
+
+void audio_metrics_unregister_task(void)
+{
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+
+    if (audio_metrics_mutex == NULL)
+        return;
+
+    xSemaphoreTake(audio_metrics_mutex, portMAX_DELAY);
+    for (int i = 0; i < AUDIO_METRICS_MAX_TASKS; i++)
+    {
+        if (audio_metrics_tasks[i].handle == self)
+        {
+            audio_metrics_sample_task(&audio_metrics_tasks[i]);
+            audio_metrics_tasks[i].handle = NULL;
+        }
+    }
+    xSemaphoreGive(audio_metrics_mutex);
+}
+
+esp_err_t audio_metrics_snapshot(audio_metrics_snapshot_t *snapshot)
+{
+    if (snapshot == NULL)
+        return ESP_ERR_INVALID_ARG;
+    if (audio_metrics_mutex == NULL)
+        return ESP_ERR_INVALID_STATE;
+
+    memset(snapshot, 0, sizeof(*snapshot));
+    snapshot->version = AUDIO_METRICS_VERSION;
+    snapshot->counters = AUDIO_METRICS_COUNTER_MAX;
+    snapshot->stages = AUDIO_METRICS_STAGE_MAX;
+    snapshot->buckets = AUDIO_METRICS_BUCKETS;
+    snapshot->queues = AUDIO_METRICS_QUEUE_MAX;
+    snapshot->tasks = AUDIO_METRICS_MAX_TASKS;
+    snapshot->uptime_us = esp_timer_get_time();
+
+    for (int i = 0; i < AUDIO_METRICS_COUNTER_MAX; i++)
+        snapshot->counter[i] = atomic_load_explicit(&audio_metrics_counters[i], memory_order_relaxed);
+
+    for (int s = 0; s < AUDIO_METRICS_STAGE_MAX; s++)
+    {
+        audio_metrics_stage_state_t *state = &audio_metrics_stages[s];
+        audio_metrics_histogram_t *histogram = &snapshot->stage[s];
+        histogram->count = atomic_load_explicit(&state->count, memory_order_relaxed);
+        histogram->max_us = atomic_load_explicit(&state->max_us, memory_order_relaxed);
+        histogram->sum_us = state->sum_us;
+        for (int b = 0; b < AUDIO_METRICS_BUCKETS; b++)
+            histogram->buckets[b] = atomic_load_explicit(&state->buckets[b], memory_order_relaxed);
+    }
+
+    for (int q = 0; q < AUDIO_METRICS_QUEUE_MAX; q++)
+    {
+        snapshot->queue[q].depth = (uint16_t)atomic_load_explicit(&audio_metrics_depth[q], memory_order_relaxed);
+        snapshot->queue[q].high_water = (uint16_t)atomic_load_explicit(&audio_metrics_depth_high[q], memory_order_relaxed);
+    }
+
+    xSemaphoreTake(audio_metrics_mutex, portMAX_DELAY);
+    for (int i = 0; i < AUDIO_METRICS_MAX_TASKS; i++)
+    {
+        if (audio_metrics_tasks[i].handle)
+            audio_metrics_sample_task(&audio_metrics_tasks[i]);
+        snapshot->task[i] = audio_metrics_tasks[i].info;
+    }
+    xSemaphoreGive(audio_metrics_mutex);
+    return ESP_OK;
+}
+
+// 直方图分位数的上界: 第一个累计数达到 count * permille / 1000 的桶的上沿
+static uint32_t audio_metrics_percentile_us(const audio_metrics_histogram_t *histogram, uint32_t permille)
+{
+    uint64_t target = ((uint64_t)histogram->count * permille + 999) / 1000;
+    uint64_t seen = 0;
+
+    for (int b = 0; b < AUDIO_METRICS_BUCKETS - 1; b++)
+    {
+        seen += histogram->buckets[b];
+        if (seen >= target)
+            return 2u << b;
+    }
+    return histogram->max_us;
+}
+
+void audio_metrics_log(void)
+{
+    audio_metrics_snapshot_t *snapshot = &audio_metrics_log_snapshot;
+    char line[192];
+    int len = 0;
+
+    if (audio_metrics_snapshot(snapshot) != ESP_OK)
+        return;
+
+    for (int i = 0; (i < AUDIO_METRICS_COUNTER_MAX) && (len < (int)sizeof(line)); i++)
+        len += snprintf(line + len, sizeof(line) - len, "%s%s %lu", i ? ", " : "",
+                        audio_metrics_counter_names[i], (unsigned long)snapshot->counter[i]);
+    ESP_LOGI(TAG, "%s", line);
+
+    for (int s = 0; s < AUDIO_METRICS_STAGE_MAX; s++)
+    {
+        const audio_metrics_histogram_t *histogram = &snapshot->stage[s];
+        if (histogram->count == 0)
+            continue;
+        ESP_LOGI(TAG, "%-8s n %lu, mean %lu us, p50 <%lu us, p99 <%lu us, max %lu us", audio_metrics_stage_names[s],
+                 (unsigned long)histogram->count, (unsigned long)(histogram->sum_us / histogram->count),
+                 (unsigned long)audio_metrics_percentile_us(histogram, 500),
+                 (unsigned long)audio_metrics_percentile_us(histogram, 990), (unsigned long)histogram->max_us);
+    }
+
+    for (int q = 0; q < AUDIO_METRICS_QUEUE_MAX; q++)
+        ESP_LOGI(TAG, "queue %-8s depth %u, high water %u", audio_metrics_queue_names[q],
+                 snapshot->queue[q].depth, snapshot->queue[q].high_water);
+
+    for (int i = 0; i < AUDIO_METRICS_MAX_TASKS; i++)
+    {
+        const audio_metrics_task_t *task = &snapshot->task[i];
+        if (task->name[0] == '\0')
+            continue;
+        if (task->cpu_permille == 0xFFFF)
+            ESP_LOGI(TAG, "task %-16s stack free min %lu", task->name, (unsigned long)task->stack_free_min);
+        else
+            ESP_LOGI(TAG, "task %-16s stack free min %lu, cpu %u.%u%% (peak %u.%u%%)", task->name,
+                     (unsigned long)task->stack_free_min, task->cpu_permille / 10, task->cpu_permille % 10,
+                     task->cpu_peak_permille / 10, task->cpu_peak_permille % 10);
+    }
+}
+
+void audio_metrics_reset(void)
+{
+    for (int i = 0; i < AUDIO_METRICS_COUNTER_MAX; i++)
+        atomic_store_explicit(&audio_metrics_counters[i], 0, memory_order_relaxed);
+    for (int s = 0; s < AUDIO_METRICS_STAGE_MAX; s++)
+    {
+        audio_metrics_stage_state_t *state = &audio_metrics_stages[s];
+        atomic_store_explicit(&state->count, 0, memory_order_relaxed);
+        atomic_store_explicit(&state->max_us, 0, memory_order_relaxed);
+        state->sum_us = 0;
+        for (int b = 0; b < AUDIO_METRICS_BUCKETS; b++)
+            atomic_store_explicit(&state->buckets[b], 0, memory_order_relaxed);
+    }
+    for (int q = 0; q < AUDIO_METRICS_QUEUE_MAX; q++)
+        atomic_store_explicit(&audio_metrics_depth_high[q], 0, memory_order_relaxed);
+}
+
+void audio_metrics_request(void)
+{
+    atomic_store_explicit(&audio_metrics_pending, true, memory_order_relaxed);
+}
+
+bool audio_metrics_take_request(void)
+{
+    // 先用普通读判断, 没有请求时不做原子交换
+    if (!atomic_load_explicit(&audio_metrics_pending, memory_order_relaxed))
+        return false;
+    return atomic_exchange_explicit(&audio_metrics_pending, false, memory_order_relaxed);
+}
+
+static void audio_metrics_timer_callback(void *arg)
+{
+    audio_metrics_log();
+    audio_metrics_request();
+}
+
+esp_err_t audio_metrics_init(void)
+{
+    if (audio_metrics_mutex != NULL)
+        return ESP_OK;
+
+    audio_metrics_mutex = xSemaphoreCreateMutex();
+    if (audio_metrics_mutex == NULL)
+        return ESP_ERR_NO_MEM;
+
+    if (AUDIO_METRICS_DUMP_PERIOD_S > 0)
+    {
+        const esp_timer_create_args_t timer_args = {
+            .callback = audio_metrics_timer_callback,
+            .name = "audio_metrics",
+        };
+        esp_err_t err = esp_timer_create(&timer_args, &audio_metrics_timer);
+        if (err == ESP_OK)
+            err = esp_timer_start_periodic(audio_metrics_timer, (uint64_t)AUDIO_METRICS_DUMP_PERIOD_S * 1000000);
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(TAG, "Failed to start dump timer: %s", esp_err_to_name(err));
+            return err;
+        }
+    }
+    return ESP_OK;
+}
+
+#else
+
+esp_err_t audio_metrics_init(void)
+{
+    return ESP_OK;
+}
+
+esp_err_t audio_metrics_snapshot(audio_metrics_snapshot_t *snapshot)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+void audio_metrics_log(void)
+{
+    ESP_LOGI(TAG, "Metrics disabled (CONFIG_AUDIO_METRICS).");
+}
+
+void audio_metrics_reset(void)
+{
+}
+
+void audio_metrics_request(void)
+{
+}
+
+bool audio_metrics_take_request(void)
+{
+    return false;
+}
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef AUDIO_METRICS_H
+#define AUDIO_METRICS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+/**
+ * 流水线指标: 计数器, 各阶段耗时直方图, 队列深度和任务栈/CPU 高水位.
+ * 记录一次指标只是一次 relaxed 原子加 (直方图再加一次 clz 求桶号), 可以放在每个音频块的路径上.
+ * 快照可以周期性打印, 也可以作为 STREAM_FRAME_METRICS 帧发给服务器.
+ * 关闭 CONFIG_AUDIO_METRICS 时记录接口编译为空.
+ */
+#define AUDIO_METRICS_VERSION           1
+#define AUDIO_METRICS_BUCKETS           16      // 桶 b: [2^b, 2^(b+1)) us, 桶 0 含 0us, 最后一桶含 >= 32.768 ms
+#define AUDIO_METRICS_MAX_TASKS         8
+#define AUDIO_METRICS_TASK_NAME_LEN     16
+
+#ifdef CONFIG_AUDIO_METRICS
+#define AUDIO_METRICS_DUMP_PERIOD_S     CONFIG_AUDIO_METRICS_DUMP_PERIOD_S
+#else
+#define AUDIO_METRICS_DUMP_PERIOD_S     0
+#endif
+
+typedef enum {
+    AUDIO_METRICS_FRAMES_CAPTURED,
+    AUDIO_METRICS_FRAMES_SENT,
+    AUDIO_METRICS_CAPTURE_OVERRUNS,     // 没有空闲帧, 采集数据被丢弃
+    AUDIO_METRICS_I2S_SHORT_READS,      // I2S 读取出错或不足一帧
+    AUDIO_METRICS_PARTIAL_SENDS,        // sendmsg 只写入一部分, 需要继续发送
+    AUDIO_METRICS_SEND_ERRORS,
+    AUDIO_METRICS_CONNECTS,
+    AUDIO_METRICS_CONNECT_FAILURES,
+    AUDIO_METRICS_DISCONNECTS,
+    AUDIO_METRICS_PUBLISH_DROPS,        // 发布队列满, 片段被丢弃
+    AUDIO_METRICS_UDP_DROPS,            // lwIP 缓冲耗尽, 数据报被丢弃
+    AUDIO_METRICS_COUNTER_MAX,
+} audio_metrics_counter_t;
+
+typedef enum {
+    AUDIO_METRICS_STAGE_READ,           // i2s_channel_read (包括等待 DMA)
+    AUDIO_METRICS_STAGE_CONVERT,        // int32 -> PCM16
+    AUDIO_METRICS_STAGE_ENCODE,         // 重采样 + ADPCM
+    AUDIO_METRICS_STAGE_SEND,           // 一帧的 sendmsg
+    AUDIO_METRICS_STAGE_MAX,
+} audio_metrics_stage_t;
+
+typedef enum {
+    AUDIO_METRICS_QUEUE_READY,          // 采集 -> 发送的就绪队列
+    AUDIO_METRICS_QUEUE_PUBLISH,        // 片段发布队列
+    AUDIO_METRICS_QUEUE_MAX,
+} audio_metrics_queue_t;
+
+#pragma pack(1)
+typedef struct {
+    uint32_t count;
+    uint32_t max_us;
+    uint64_t sum_us;
+    uint32_t buckets[AUDIO_METRICS_BUCKETS];
+} audio_metrics_histogram_t;
+
+typedef struct {
+    uint16_t depth;                     // 最近一次记录的深度
+    uint16_t high_water;
+} audio_metrics_queue_depth_t;
+
+typedef struct {
+    char name[AUDIO_METRICS_TASK_NAME_LEN];
+    uint32_t stack_free_min;            // 字节, 0 表示未知
+    uint16_t cpu_permille;              // 最近一个采样周期占单核的千分比, 0xFFFF 表示未启用运行时统计
+    uint16_t cpu_peak_permille;
+} audio_metrics_task_t;
+
+// 网络快照: 小端, 各数组长度写在头部, 接收端按长度解析, 新增字段只追加在末尾
+typedef struct {
+    uint8_t version;
+    uint8_t counters;
+    uint8_t stages;
+    uint8_t buckets;
+    uint8_t queues;
+    uint8_t tasks;
+    uint16_t reserved;
+    uint64_t uptime_us;
+    uint32_t counter[AUDIO_METRICS_COUNTER_MAX];
+    audio_metrics_histogram_t stage[AUDIO_METRICS_STAGE_MAX];
+    audio_metrics_queue_depth_t queue[AUDIO_METRICS_QUEUE_MAX];
+    audio_metrics_task_t task[AUDIO_METRICS_MAX_TASKS];
+} audio_metrics_snapshot_t;
+#pragma pack()
+
+// 计时起点/终点用 audio_metrics_now(), 关闭指标时连 esp_timer_get_time() 也不调用
+#ifdef CONFIG_AUDIO_METRICS
+#define audio_metrics_now()                     esp_timer_get_time()
+
+void audio_metrics_count(audio_metrics_counter_t counter);
+void audio_metrics_add(audio_metrics_counter_t counter, uint32_t value);
+void audio_metrics_record_us(audio_metrics_stage_t stage, uint32_t us);
+void audio_metrics_queue_depth(audio_metrics_queue_t queue, uint32_t depth);
+
+/**
+ * @brief 登记当前任务, 快照时采样它的栈和 CPU 高水位. 自行删除的任务在 vTaskDelete 前注销,
+ * 同名任务再次登记时沿用原来的条目, 高水位跨会话保留.
+ */
+void audio_metrics_register_task(void);
+void audio_metrics_unregister_task(void);
+#else
+#define audio_metrics_now()                     ((int64_t)0)
+#define audio_metrics_count(counter)            ((void)0)
+#define audio_metrics_add(counter, value)       ((void)0)
+#define audio_metrics_record_us(stage, us)      ((void)sizeof(us))
+#define audio_metrics_queue_depth(queue, depth) ((void)0)
+#define audio_metrics_register_task()           ((void)0)
+#define audio_metrics_unregister_task()         ((void)0)
+#endif
+
+esp_err_t audio_metrics_init(void);
+esp_err_t audio_metrics_snapshot(audio_metrics_snapshot_t *snapshot);
+void audio_metrics_log(void);
+void audio_metrics_reset(void);
+
+/**
+ * @brief 请求在流里发送一个快照帧 (周期打印时和服务器请求时置位), 发送任务取走并清除.
+ */
+void audio_metrics_request(void);
+bool audio_metrics_take_request(void);
+
+#endif // AUDIO_METRICS_H
@@ -0,0 +1,339 @@
+#include <string.h>
+#include <math.h>
+#include "audio_mixer.h"
+
+#define AUDIO_MIXER_SINE_SIZE       (1 << AUDIO_MIXER_SINE_BITS)
+#define AUDIO_MIXER_LIMIT           ((int32_t)INT16_MAX << AUDIO_MIXER_FRAC_BITS)
+
+// 多一项保护, 插值时 index + 1 不用回绕
+static int16_t audio_mixer_sine[AUDIO_MIXER_SINE_SIZE + 1];
+static bool audio_mixer_sine_ready = false;
+
+static audio_mixer_voice_t *audio_mixer_lookup(const audio_mixer_t *mixer, int voice)
+{
+    if ((mixer == NULL) || (voice < 0))
+        return NULL;
+
+    audio_mixer_voice_t *v = (audio_mixer_voice_t *)&mixer->voices[voice % AUDIO_MIXER_MAX_VOICES];
+    if ((v->kind == AUDIO_MIXER_VOICE_IDLE) || (v->generation != voice / AUDIO_MIXER_MAX_VOICES))
+        return NULL;
+    return v;
+}
+
+static int audio_mixer_add(audio_mixer_t *mixer, const audio_mixer_voice_config_t *config,
+                           audio_mixer_kind_t kind, const void *data, int length)
+{
+    if ((mixer == NULL) || (config == NULL) || (config->gain < 0) || (config->gain > AUDIO_MIXER_GAIN_UNITY))
+        return -1;
+
+    for (int slot = 0; slot < AUDIO_MIXER_MAX_VOICES; slot++)
+    {
+        audio_mixer_voice_t *v = &mixer->voices[slot];
+        if (v->kind != AUDIO_MIXER_VOICE_IDLE)
+            continue;
+
+        uint16_t generation = (v->generation + 1) & 0x7FFF;
+        memset(v, 0, sizeof(*v));
+        v->generation = generation;
+        v->gain = config->gain;
+        v->gain_current = config->gain;
+        v->pull = config->pull;
+        v->done = config->done;
+        v->ctx = config->ctx;
+        v->data = data;
+        v->length = length;
+        v->kind = kind;
+        return (int)generation * AUDIO_MIXER_MAX_VOICES + slot;
+    }
+    return -1;
+}
+
+static void audio_mixer_finish(audio_mixer_voice_t *v)
+{
+    v->kind = AUDIO_MIXER_VOICE_IDLE;
+    if (v->done)
+        v->done(v->ctx);
+}
+
+esp_err_t audio_mixer_init(audio_mixer_t *mixer, uint32_t sample_rate)
+{
+    if ((mixer == NULL) || (sample_rate == 0))
+        return ESP_ERR_INVALID_ARG;
+
+    if (!audio_mixer_sine_ready)
+    {
+        for (int i = 0; i <= AUDIO_MIXER_SINE_SIZE; i++)
+        {
+            audio_mixer_sine[i] = (int16_t)lrintf(INT16_MAX * sinf(2.0f * (float)M_PI * i / AUDIO_MIXER_SINE_SIZE));
+        }
+        audio_mixer_sine_ready = true;
+    }
+    memset(mixer, 0, sizeof(*mixer));
+    mixer->sample_rate = sample_rate;
+    return ESP_OK;
+}
+
+esp_err_t audio_mixer_set_rate(audio_mixer_t *mixer, uint32_t sample_rate)
+{
+    if ((mixer == NULL) || (sample_rate == 0))
+        return ESP_ERR_INVALID_ARG;
+    if ((sample_rate != mixer->sample_rate) && (audio_mixer_active_count(mixer) > 0))
+        return ESP_ERR_INVALID_STATE;
+    mixer->sample_rate = sample_rate;
+    return ESP_OK;
+}
+
+int audio_mixer_add_tone(audio_mixer_t *mixer, const audio_mixer_voice_config_t *config,
+                         uint32_t freq_hz, uint32_t duration_ms)
+{
+    if ((mixer == NULL) || (freq_hz == 0) || (freq_hz >= mixer->sample_rate / 2))
+        return -1;
+
+    int length = (int)(((uint64_t)duration_ms * mixer->sample_rate) / 1000);
+    if (length <= 0)
+        return -1;
+
+    int voice = audio_mixer_add(mixer, config, AUDIO_MIXER_VOICE_TONE, NULL, length);
+    if (voice >= 0)
+        mixer->voices[voice % AUDIO_MIXER_MAX_VOICES].phase_step =
+            (uint32_t)(((uint64_t)freq_hz << 32) / mixer->sample_rate);
+    return voice;
+}
+
+int audio_mixer_add_pcm16(audio_mixer_t *mixer, const audio_mixer_voice_config_t *config,
+                          const int16_t *pcm, int samples)
+{
+    if ((pcm == NULL) || (samples <= 0))
+        return -1;
+    return audio_mixer_add(mixer, config, AUDIO_MIXER_VOICE_PCM16, pcm, samples);
+}
+
+int audio_mixer_add_pcm32(audio_mixer_t *mixer, const audio_mixer_voice_config_t *config,
+                          const int32_t *pcm, int samples)
+{
+    if ((pcm == NULL) || (samples <= 0))
+        return -1;
+    return audio_mixer_add(mixer, config, AUDIO_MIXER_VOICE_PCM32, pcm, samples);
+}
+
+int audio_mixer_add_pull(audio_mixer_t *mixer, const audio_mixer_voice_config_t *config)
+{
+    if ((config == NULL) || (config->pull == NULL))
+        return -1;
+    return audio_mixer_add(mixer, config, AUDIO_MIXER_VOICE_PULL, NULL, 0);
+}
+
+esp_err_t audio_mixer_set_gain(audio_mixer_t *mixer, int voice, int32_t gain)
+{
+    if ((gain < 0) || (gain > AUDIO_MIXER_GAIN_UNITY))
+        return ESP_ERR_INVALID_ARG;
+
+    audio_mixer_voice_t *v = audio_mixer_lookup(mixer, voice);
+    if (v == NULL)
+        return ESP_ERR_NOT_FOUND;
+    v->gain = gain;
+    return ESP_OK;
+}
+
+esp_err_t audio_mixer_stop(audio_mixer_t *mixer, int voice)
+{
+    audio_mixer_voice_t *v = audio_mixer_lookup(mixer, voice);
+    if (v == NULL)
+        return ESP_ERR_NOT_FOUND;
+    v->stopping = true;
+    return ESP_OK;
+}
+
+bool audio_mixer_voice_active(const audio_mixer_t *mixer, int voice)
+{
+    return audio_mixer_lookup(mixer, voice) != NULL;
+}
+
+int audio_mixer_active_count(const audio_mixer_t *mixer)
+{
+    int count = 0;
+
+    for (int slot = 0; slot < AUDIO_MIXER_MAX_VOICES; slot++)
+    {
+        if (mixer->voices[slot].kind != AUDIO_MIXER_VOICE_IDLE)
+            count++;
+    }
+    return count;
+}
+
+// 正弦表查表 + 线性插值, 起止 AUDIO_MIXER_TONE_FADE 个样本线性淡入淡出
+static void audio_mixer_tone(audio_mixer_voice_t *v, int16_t *out, int samples)
+{
+    uint32_t phase = v->phase;
+
+    for (int i = 0; i < samples; i++)
+    {
+        uint32_t index = phase >> (32 - AUDIO_MIXER_SINE_BITS);
+        int32_t frac = (phase >> (16 - AUDIO_MIXER_SINE_BITS)) & 0xFFFF;
+        int32_t a = audio_mixer_sine[index];
+        int32_t s = a + (((audio_mixer_sine[index + 1] - a) * frac) >> 16);
+        int k = v->position + i;
+        int edge = (k < v->length - 1 - k) ? k : v->length - 1 - k;
+        if (edge < AUDIO_MIXER_TONE_FADE)
+            s = (s * edge) / AUDIO_MIXER_TONE_FADE;
+        out[i] = (int16_t)s;
+        phase += v->phase_step;
+    }
+    v->phase = phase;
+}
+
+/**
+ * @brief 取声部本块的来源样本, 返回真实样本数 (之后的部分不参与累加).
+ */
+static int audio_mixer_source(audio_mixer_t *mixer, audio_mixer_voice_t *v, int samples, const int16_t **src)
+{
+    int n = samples;
+
+    if (v->kind != AUDIO_MIXER_VOICE_PULL)
+    {
+        n = v->length - v->position;
+        n = (n > samples) ? samples : n;
+    }
+
+    *src = mixer->scratch;
+    switch (v->kind)
+    {
+    case AUDIO_MIXER_VOICE_TONE:
+        audio_mixer_tone(v, mixer->scratch, n);
+        break;
+    case AUDIO_MIXER_VOICE_PCM16:
+        *src = (const int16_t *)v->data + v->position;
+        break;
+    case AUDIO_MIXER_VOICE_PCM32:
+    {
+        const int32_t *pcm = (const int32_t *)v->data + v->position;
+        for (int i = 0; i < n; i++)
+        {
+            mixer->scratch[i] = (int16_t)(pcm[i] >> 16);
+        }
+        break;
+    }
+    case AUDIO_MIXER_VOICE_PULL:
+        n = v->pull(v->ctx, mixer->scratch, samples);
+        n = (n < 0) ? 0 : ((n > samples) ? samples : n);
+        break;
+    default:
+        n = 0;
+        break;
+    }
+    if (v->kind != AUDIO_MIXER_VOICE_PULL)
+        v->position += n;
+    return n;
+}
+
+/**
+ * @brief 把一个声部累加进 acc. 增益在整块 (samples) 上从 gain_current 线性过渡到目标,
+ * 常量增益和单位增益走各自的快速循环.
+ */
+static void audio_mixer_accumulate(int32_t *acc, const int16_t *src, int n, int samples, int32_t g0, int32_t g1)
+{
+    const int shift = 15 - AUDIO_MIXER_FRAC_BITS;
+
+    if (g0 == g1)
+    {
+        if (g0 == AUDIO_MIXER_GAIN_UNITY)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                acc[i] += (int32_t)src[i] << AUDIO_MIXER_FRAC_BITS;
+            }
+        }
+        else
+        {
+            for (int i = 0; i < n; i++)
+            {
+                acc[i] += ((int32_t)src[i] * g0) >> shift;
+            }
+        }
+        return;
+    }
+
+    // 增益 Q8 小数累加, 第 samples - 1 个样本正好到达 g1
+    int32_t step = ((g1 - g0) * 256) / samples;
+    int32_t g = (g0 << 8) + step;
+    for (int i = 0; i < n; i++)
+    {
+        acc[i] += ((int32_t)src[i] * (g >> 8)) >> shift;
+        g += step;
+    }
+}
+
+static int audio_mixer_mix(audio_mixer_t *mixer, int samples)
+{
+    int active = 0;
+
+    for (int slot = 0; slot < AUDIO_MIXER_MAX_VOICES; slot++)
+    {
+        audio_mixer_voice_t *v = &mixer->voices[slot];
+        if (v->kind == AUDIO_MIXER_VOICE_IDLE)
+            continue;
+
+        if (active++ == 0)
+            memset(mixer->acc, 0, samples * sizeof(int32_t));
+
+        const int16_t *src;
+        int32_t target = v->stopping ? 0 : v->gain;
+        int n = audio_mixer_source(mixer, v, samples, &src);
+        audio_mixer_accumulate(mixer->acc, src, n, samples, v->gain_current, target);
+        v->gain_current = target;
+
+        if (v->stopping || ((v->kind != AUDIO_MIXER_VOICE_PULL) && (v->position >= v->length)))
+            audio_mixer_finish(v);
+    }
+    return active;
+}
+
+int audio_mixer_render(audio_mixer_t *mixer, int32_t *out, int samples)
+{
+    if ((mixer == NULL) || (out == NULL) || (samples <= 0) || (samples > AUDIO_MIXER_MAX_BLOCK))
+        return 0;
+
+    int active = audio_mixer_mix(mixer, samples);
+    if (active == 0)
+    {
+        memset(out, 0, samples * sizeof(int32_t));
+        return 0;
+    }
+
+    uint32_t clipped = 0;
+    for (int i = 0; i < samples; i++)
+    {
+        int32_t v = mixer->acc[i];
+        clipped += (v > AUDIO_MIXER_LIMIT) | (v < -AUDIO_MIXER_LIMIT);
+        v = (v > AUDIO_MIXER_LIMIT) ? AUDIO_MIXER_LIMIT : v;
+        v = (v < -AUDIO_MIXER_LIMIT) ? -AUDIO_MIXER_LIMIT : v;
+        out[i] = v << (16 - AUDIO_MIXER_FRAC_BITS);
+    }
+    mixer->clipped += clipped;
+    return active;
+}
+
+int audio_mixer_render16(audio_mixer_t *mixer, int16_t *out, int samples)
+{
+    if ((mixer == NULL) || (out == NULL) || (samples <= 0) || (samples > AUDIO_MIXER_MAX_BLOCK))
+        return 0;
+
+    int active = audio_mixer_mix(mixer, samples);
+    if (active == 0)
+    {
+        memset(out, 0, samples * sizeof(int16_t));
+        return 0;
+    }
+
+    uint32_t clipped = 0;
+    for (int i = 0; i < samples; i++)
+    {
+        int32_t v = mixer->acc[i];
+        clipped += (v > AUDIO_MIXER_LIMIT) | (v < -AUDIO_MIXER_LIMIT);
+        v = (v > AUDIO_MIXER_LIMIT) ? AUDIO_MIXER_LIMIT : v;
+        v = (v < -AUDIO_MIXER_LIMIT) ? -AUDIO_MIXER_LIMIT : v;
+        out[i] = (int16_t)(v >> AUDIO_MIXER_FRAC_BITS);
+    }
+    mixer->clipped += clipped;
+    return active;
+}
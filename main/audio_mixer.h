@@ -0,0 +1,113 @@
+#ifndef AUDIO_MIXER_H
+#define AUDIO_MIXER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+/**
+ * 多声部混音 (单声道, 单一输出采样率).
+ *
+ * 每个声部是一个 PCM16 来源: 提示音 (正弦, 起止淡入淡出), PCM16/int32 片段 (播完结束),
+ * 或拉取回调 (流, 直到 stop). 每个声部有 Q15 增益, 变化在下一块内线性过渡,
+ * stop 在下一块内淡出到 0 后结束, 不产生咔嗒声.
+ *
+ * 累加器比 int16 多保留 AUDIO_MIXER_FRAC_BITS 位, 全部声部加完后统一饱和:
+ * render 输出左对齐的 int32 (I2S TX), render16 输出 int16. 没有活动声部时输出静音.
+ * 本模块不加锁, 由调用者 (audio_playback) 串行化.
+ */
+#define AUDIO_MIXER_MAX_VOICES      4       // 提示音 + 录音回放 + 下行流 + 1 个备用
+#define AUDIO_MIXER_MAX_BLOCK       480     // 48kHz 下 10ms
+#define AUDIO_MIXER_GAIN_UNITY      32768   // Q15, 增益范围 [0, UNITY]
+#define AUDIO_MIXER_FRAC_BITS       8
+#define AUDIO_MIXER_TONE_FADE       64      // 提示音起止的淡入淡出样本数
+#define AUDIO_MIXER_SINE_BITS       8       // 正弦表 256 项, 相邻两项线性插值
+
+typedef enum {
+    AUDIO_MIXER_VOICE_IDLE = 0,
+    AUDIO_MIXER_VOICE_TONE,
+    AUDIO_MIXER_VOICE_PCM16,
+    AUDIO_MIXER_VOICE_PCM32,            // 左对齐的 int32 (I2S 采集格式), 取高 16 位
+    AUDIO_MIXER_VOICE_PULL,
+} audio_mixer_kind_t;
+
+/**
+ * @brief 流声部的来源: 写 samples 个样本到 out, 返回真实样本数, 不足部分由混音器补静音.
+ * 在 render 中调用.
+ */
+typedef int (*audio_mixer_pull_t)(void *ctx, int16_t *out, int samples);
+
+/**
+ * @brief 声部结束 (播完或 stop 淡出完成) 时在 render 中调用, 之后声部不再访问它的数据.
+ */
+typedef void (*audio_mixer_done_t)(void *ctx);
+
+typedef struct {
+    int32_t gain;                       // Q15
+    audio_mixer_pull_t pull;            // 仅流声部
+    audio_mixer_done_t done;            // 可为 NULL
+    void *ctx;                          // 传给 pull 和 done
+} audio_mixer_voice_config_t;
+
+typedef struct {
+    audio_mixer_kind_t kind;
+    uint16_t generation;                // 句柄中的代数, 槽位复用后旧句柄失效
+    bool stopping;
+    int32_t gain;                       // 目标增益
+    int32_t gain_current;               // 上一块结束时的增益, 块内线性过渡到 gain
+    audio_mixer_pull_t pull;
+    audio_mixer_done_t done;
+    void *ctx;
+    const void *data;                   // 片段
+    int length;                         // 片段/提示音的总样本数
+    int position;
+    uint32_t phase;                     // 提示音相位, 高 AUDIO_MIXER_SINE_BITS 位为表索引
+    uint32_t phase_step;
+} audio_mixer_voice_t;
+
+typedef struct {
+    uint32_t sample_rate;
+    audio_mixer_voice_t voices[AUDIO_MIXER_MAX_VOICES];
+    int32_t acc[AUDIO_MIXER_MAX_BLOCK];
+    int16_t scratch[AUDIO_MIXER_MAX_BLOCK];
+    uint32_t clipped;                   // 饱和的输出样本数
+} audio_mixer_t;
+
+esp_err_t audio_mixer_init(audio_mixer_t *mixer, uint32_t sample_rate);
+
+/**
+ * @brief 改变输出采样率, 只能在没有活动声部时进行 (否则返回 ESP_ERR_INVALID_STATE).
+ */
+esp_err_t audio_mixer_set_rate(audio_mixer_t *mixer, uint32_t sample_rate);
+
+/**
+ * @brief 添加声部, 返回句柄 (>= 0). 没有空闲槽位或参数无效时返回 -1, 不调用 done.
+ * 片段数据在声部结束前必须保持有效.
+ */
+int audio_mixer_add_tone(audio_mixer_t *mixer, const audio_mixer_voice_config_t *config,
+                         uint32_t freq_hz, uint32_t duration_ms);
+int audio_mixer_add_pcm16(audio_mixer_t *mixer, const audio_mixer_voice_config_t *config,
+                          const int16_t *pcm, int samples);
+int audio_mixer_add_pcm32(audio_mixer_t *mixer, const audio_mixer_voice_config_t *config,
+                          const int32_t *pcm, int samples);
+int audio_mixer_add_pull(audio_mixer_t *mixer, const audio_mixer_voice_config_t *config);
+
+esp_err_t audio_mixer_set_gain(audio_mixer_t *mixer, int voice, int32_t gain);
+
+/**
+ * @brief 在下一块内淡出并结束声部. 已结束的句柄返回 ESP_ERR_NOT_FOUND.
+ */
+esp_err_t audio_mixer_stop(audio_mixer_t *mixer, int voice);
+
+bool audio_mixer_voice_active(const audio_mixer_t *mixer, int voice);
+int audio_mixer_active_count(const audio_mixer_t *mixer);
+
+/**
+ * @brief 混出 samples (<= AUDIO_MIXER_MAX_BLOCK) 个样本, 返回参与混音的声部数.
+ * render 输出左对齐 int32 (int16 满幅 << 16, 低位保留增益带来的小数位), render16 输出 int16,
+ * 都饱和到 [-INT16_MAX, INT16_MAX] 对应的范围.
+ */
+int audio_mixer_render(audio_mixer_t *mixer, int32_t *out, int samples);
+int audio_mixer_render16(audio_mixer_t *mixer, int16_t *out, int samples);
+
+#endif // AUDIO_MIXER_H
@@ -0,0 +1,207 @@
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "audio_metrics.h"
+#include "audio_pipeline.h"
+
+static const char *TAG = "AUDIO_PIPELINE";
+
+static void audio_pipeline_forward(audio_element_t *next, audio_block_t *frame)
+{
+    // 队列长度不小于块池容量时这里不会阻塞: 在途的块数受池限制
+    xQueueSend(next->input, &frame, portMAX_DELAY);
+    if (frame == NULL)
+        return;
+
+    UBaseType_t depth = uxQueueMessagesWaiting(next->input);
+    if (depth > next->stats.queue_high_water)
+        next->stats.queue_high_water = depth;
+    if (next->metrics_queue >= 0)
+        audio_metrics_queue_depth((audio_metrics_queue_t)next->metrics_queue, depth);
+}
+
+static void audio_pipeline_element_task(void *arg)
+{
+    audio_element_t *element = (audio_element_t *)arg;
+    audio_pipeline_t *pipeline = element->pipeline;
+    int64_t start_us = esp_timer_get_time();
+    audio_block_t *frame;
+    bool failed = false;
+
+    audio_metrics_register_task();
+    if ((element->open != NULL) && (element->open(element) != ESP_OK))
+    {
+        ESP_LOGE(TAG, "%s: open failed, stopping %s.", element->name, pipeline->name);
+        failed = true;
+        audio_pipeline_stop(pipeline);
+    }
+
+    while (1)
+    {
+        frame = NULL;
+        if (element->kind == AUDIO_ELEMENT_SOURCE)
+        {
+            if (failed || !pipeline->running)
+                break;
+        }
+        else
+        {
+            xQueueReceive(element->input, &frame, portMAX_DELAY);
+            if (frame == NULL)
+                break;
+            // open 失败: 不调用 process(), 只把上游已送出的帧还回池, 直到结束标记
+            if (failed)
+            {
+                audio_pool_release(frame);
+                continue;
+            }
+        }
+
+        int64_t process_us = esp_timer_get_time();
+        if (element->process(element, &frame) != ESP_OK)
+            element->stats.errors++;
+        element->stats.busy_us += esp_timer_get_time() - process_us;
+        element->stats.frames++;
+
+        if (frame == NULL)
+            continue;
+        if (element->next != NULL)
+            audio_pipeline_forward(element->next, frame);
+        else
+            audio_pool_release(frame);
+    }
+
+    if (element->close != NULL)
+        element->close(element);
+    element->stats.lifetime_us = esp_timer_get_time() - start_us;
+    element->stats.stack_free = uxTaskGetStackHighWaterMark(NULL);
+    audio_metrics_unregister_task();
+
+    if (element->next != NULL)
+    {
+        audio_pipeline_forward(element->next, NULL);
+        xTaskNotifyGive(pipeline->sink_task);
+    }
+    else
+    {
+        // 汇最后退出: 等上游都结束后统计才完整
+        for (int i = 1; i < pipeline->count; i++)
+            ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+        audio_pipeline_log_stats(pipeline);
+        pipeline->active = false;
+    }
+    vTaskDelete(NULL);
+}
+
+esp_err_t audio_pipeline_run(audio_pipeline_t *pipeline, const char *name, audio_element_t **elements, int count,
+                             bool *started)
+{
+    if (started != NULL)
+        *started = false;
+    if ((pipeline == NULL) || (elements == NULL) || (count < 2) || (count > AUDIO_PIPELINE_MAX_ELEMENTS))
+        return ESP_ERR_INVALID_ARG;
+    if (pipeline->active)
+        return ESP_ERR_INVALID_STATE;
+    for (int i = 0; i < count; i++)
+    {
+        audio_element_kind_t kind = (i == 0) ? AUDIO_ELEMENT_SOURCE :
+                                    (i == count - 1) ? AUDIO_ELEMENT_SINK : AUDIO_ELEMENT_TRANSFORM;
+        if ((elements[i]->kind != kind) || (elements[i]->process == NULL))
+        {
+            ESP_LOGE(TAG, "%s: element %s cannot be at position %d.", name, elements[i]->name, i);
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    pipeline->name = name;
+    pipeline->count = count;
+    for (int i = 0; i < count; i++)
+    {
+        audio_element_t *element = elements[i];
+
+        // 队列在第一次运行时创建, 之后的会话复用
+        if ((i > 0) && (element->input == NULL))
+        {
+            element->input = xQueueCreate(element->queue_len, sizeof(audio_block_t *));
+            if (element->input == NULL)
+            {
+                ESP_LOGE(TAG, "%s: failed to create the input queue of %s.", name, element->name);
+                return ESP_ERR_NO_MEM;
+            }
+        }
+        if (element->input != NULL)
+            xQueueReset(element->input);
+        element->next = (i < count - 1) ? elements[i + 1] : NULL;
+        element->pipeline = pipeline;
+        memset(&element->stats, 0, sizeof(element->stats));
+        pipeline->elements[i] = element;
+    }
+
+    pipeline->running = true;
+    pipeline->active = true;
+    for (int i = count - 1; i >= 0; i--)
+    {
+        audio_element_t *element = elements[i];
+        // 单核目标 (或主机模拟) 上绑定到不存在的核会断言失败, 退回不绑定
+        BaseType_t core = ((element->core >= 0) && (element->core < portNUM_PROCESSORS)) ? element->core : tskNO_AFFINITY;
+        TaskHandle_t handle = NULL;
+
+        if (xTaskCreatePinnedToCore(audio_pipeline_element_task, element->name, element->stack_size, element,
+                                    element->priority, &handle, core) != pdPASS)
+        {
+            // 已创建的下游任务在等输入, 送一个结束标记让它们正常退出
+            ESP_LOGE(TAG, "%s: failed to create the task of %s.", name, element->name);
+            pipeline->running = false;
+            if (i == count - 1)
+            {
+                pipeline->active = false;
+                return ESP_ERR_NO_MEM;
+            }
+            for (int j = 0; j <= i; j++)
+                xTaskNotifyGive(pipeline->sink_task);
+            audio_pipeline_forward(elements[i + 1], NULL);
+            return ESP_ERR_NO_MEM;
+        }
+        if (i == count - 1)
+        {
+            pipeline->sink_task = handle;
+            if (started != NULL)
+                *started = true;
+        }
+    }
+    return ESP_OK;
+}
+
+void audio_pipeline_stop(audio_pipeline_t *pipeline)
+{
+    pipeline->running = false;
+}
+
+bool audio_pipeline_is_running(const audio_pipeline_t *pipeline)
+{
+    return pipeline->running;
+}
+
+bool audio_pipeline_is_active(const audio_pipeline_t *pipeline)
+{
+    return pipeline->active;
+}
+
+void audio_pipeline_log_stats(const audio_pipeline_t *pipeline)
+{
+    for (int i = 0; i < pipeline->count; i++)
+    {
+        const audio_element_t *element = pipeline->elements[i];
+        const audio_element_stats_t *stats = &element->stats;
+        uint64_t lifetime_us = (stats->lifetime_us > 0) ? stats->lifetime_us : 1;
+        uint32_t busy = (uint32_t)(stats->busy_us * 10000 / lifetime_us);     // 0.01%
+        uint32_t io = (uint32_t)(stats->io_wait_us * 10000 / lifetime_us);
+
+        ESP_LOGI(TAG, "%s: %-14s core %2d prio %2u stack %5lu: %6lu frames, %lu errors, busy %3lu.%02lu%% "
+                 "(io %3lu.%02lu%%), queue max %lu, stack free %lu",
+                 pipeline->name, element->name, element->core, (unsigned)element->priority,
+                 (unsigned long)element->stack_size, (unsigned long)stats->frames, (unsigned long)stats->errors,
+                 (unsigned long)(busy / 100), (unsigned long)(busy % 100), (unsigned long)(io / 100), (unsigned long)(io % 100),
+                 (unsigned long)stats->queue_high_water, (unsigned long)stats->stack_free);
+    }
+}
@@ -0,0 +1,101 @@
+#ifndef AUDIO_PIPELINE_H
+#define AUDIO_PIPELINE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "audio_pool.h"
+
+/**
+ * 音频流水线: 源 -> 变换 ... -> 汇, 每个元素一个任务, 元素之间用有界队列传递 audio_pool 块的指针.
+ * 每个元素声明自己的核亲和性, 优先级和栈大小; 元素只实现 process(), 收发队列, 结束标记,
+ * 指标登记和利用率统计都由框架完成.
+ *
+ * 块的所有权: process() 返回后 *frame 非 NULL 就交给下一个元素 (汇之后由框架释放);
+ * 元素丢弃一个块时自己释放引用并把 *frame 置 NULL. 源每次调用时 *frame 为 NULL.
+ * 停止时源退出循环, NULL 作为结束标记沿队列传下去, 每个元素收到后调用 close() 再退出.
+ */
+#define AUDIO_PIPELINE_MAX_ELEMENTS     4
+#define AUDIO_PIPELINE_CORE_ANY         (-1)
+
+typedef struct audio_element audio_element_t;
+typedef struct audio_pipeline audio_pipeline_t;
+
+typedef enum {
+    AUDIO_ELEMENT_SOURCE,
+    AUDIO_ELEMENT_TRANSFORM,
+    AUDIO_ELEMENT_SINK,
+} audio_element_kind_t;
+
+typedef esp_err_t (*audio_element_open_t)(audio_element_t *element);
+typedef esp_err_t (*audio_element_process_t)(audio_element_t *element, audio_block_t **frame);
+typedef void (*audio_element_close_t)(audio_element_t *element);
+
+typedef struct {
+    uint32_t frames;                    // process() 的调用次数
+    uint32_t errors;                    // 其中返回错误的次数
+    uint64_t busy_us;                   // process() 内的时间
+    uint64_t io_wait_us;                // 其中阻塞在 I2S / 网络上的时间, 由元素自己累加
+    uint64_t lifetime_us;               // 任务从 open 到 close 的时间
+    uint32_t queue_high_water;          // 输入队列的最大深度
+    uint32_t stack_free;                // 字节, 任务退出时的栈高水位
+} audio_element_stats_t;
+
+struct audio_element {
+    const char *name;                   // 同时是任务名
+    audio_element_kind_t kind;
+    audio_element_open_t open;          // 可选, 在元素自己的任务里调用; 失败时停止流水线, 之后收到的帧不经 process() 直接释放
+    audio_element_process_t process;
+    audio_element_close_t close;        // 可选, 收到结束标记 (源: 停止请求) 后调用, open 失败时也调用
+    void *ctx;
+
+    int core;                           // AUDIO_PIPELINE_CORE_ANY 或核号, 超出核数时不绑定
+    UBaseType_t priority;
+    uint32_t stack_size;
+    int queue_len;                      // 输入队列长度, 源不需要
+    int metrics_queue;                  // 输入队列深度记入的 audio_metrics_queue_t, -1 不记录
+
+    // 以下由框架维护
+    QueueHandle_t input;
+    audio_element_t *next;
+    audio_pipeline_t *pipeline;
+    audio_element_stats_t stats;
+};
+
+struct audio_pipeline {
+    const char *name;
+    audio_element_t *elements[AUDIO_PIPELINE_MAX_ELEMENTS];
+    int count;
+    volatile bool running;              // false: 已请求停止
+    volatile bool active;               // 还有元素任务没有退出
+    TaskHandle_t sink_task;             // 上游元素退出时通知汇, 汇最后退出并输出统计
+};
+
+/**
+ * @brief 按顺序连接元素并启动各自的任务 (从汇到源创建, 源开始产出时下游都已就绪).
+ * 第一个必须是源, 最后一个必须是汇. 流水线还在运行时返回 ESP_ERR_INVALID_STATE.
+ *
+ * @param started 可为 NULL. 返回时为 true 表示汇的任务已经启动: 即使返回错误 (上游任务创建失败),
+ *                流水线也会自行结束并调用已启动元素的 close(), 调用者不能再清理这些元素的资源;
+ *                为 false 时没有任何任务启动, 清理由调用者负责. 不要用 audio_pipeline_is_active() 判断,
+ *                汇可能在返回前就已退出.
+ */
+esp_err_t audio_pipeline_run(audio_pipeline_t *pipeline, const char *name, audio_element_t **elements, int count,
+                             bool *started);
+
+/**
+ * @brief 请求停止: 源在当前 process() 返回后退出, 已在队列中的块由下游照常处理.
+ */
+void audio_pipeline_stop(audio_pipeline_t *pipeline);
+bool audio_pipeline_is_running(const audio_pipeline_t *pipeline);
+bool audio_pipeline_is_active(const audio_pipeline_t *pipeline);
+
+/**
+ * @brief 打印每个元素的放置和利用率: busy 是 process() 占任务存活时间的比例, io 是其中阻塞等待的部分.
+ */
+void audio_pipeline_log_stats(const audio_pipeline_t *pipeline);
+
+#endif // AUDIO_PIPELINE_H
@@ -0,0 +1,221 @@
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "audio_playback.h"
+#include "i2s_audio.h"
+#include "audio_metrics.h"
+#include "audio_trace.h"
+
+static const char *TAG = "AUDIO_PLAYBACK";
+
+static audio_mixer_t audio_playback_mixer;
+static int32_t audio_playback_buffer[AUDIO_MIXER_MAX_BLOCK];
+static SemaphoreHandle_t audio_playback_mutex = NULL;
+static SemaphoreHandle_t audio_playback_profile_done = NULL;
+static audio_profile_id_t audio_playback_profile_request = AUDIO_PROFILE_MAX;
+static esp_err_t audio_playback_profile_result = ESP_OK;
+static TaskHandle_t audio_playback_task_handle = NULL;
+
+static void audio_playback_release_clip(void *ctx)
+{
+    audio_pool_release((audio_block_t *)ctx);
+}
+
+// 调用者持有 audio_playback_mutex. 混音器空闲时才能换采样率, TX 时钟由播放任务在下一块前切换
+static bool audio_playback_accept_rate(uint32_t sample_rate)
+{
+    if (audio_mixer_set_rate(&audio_playback_mixer, sample_rate) == ESP_OK)
+        return true;
+    ESP_LOGW(TAG, "Mixer busy at %lu Hz, %lu Hz voice refused.",
+             (unsigned long)audio_playback_mixer.sample_rate, (unsigned long)sample_rate);
+    return false;
+}
+
+// 调用者持有 audio_playback_mutex, 通道在停止状态下重建, 期间没有声部
+static void audio_playback_apply_profile(uint32_t sample_rate)
+{
+    if (audio_mixer_active_count(&audio_playback_mixer) > 0)
+    {
+        audio_playback_profile_result = ESP_ERR_INVALID_STATE;
+    }
+    else
+    {
+        i2s_audio_spk_stop();
+        audio_playback_profile_result = i2s_audio_spk_set_profile(audio_playback_profile_request);
+        i2s_audio_spk_start(sample_rate);
+    }
+    audio_playback_profile_request = AUDIO_PROFILE_MAX;
+    xSemaphoreGive(audio_playback_profile_done);
+}
+
+/**
+ * @brief 播放任务: 由 I2S DMA 节拍驱动, 每次混出 10ms 写入. 混音在锁内完成 (不阻塞),
+ * 写 DMA 在锁外, 其它任务添加/停止声部最多等一次混音的时间.
+ */
+static void audio_playback_task(void *arg)
+{
+    uint32_t rate = audio_playback_mixer.sample_rate;
+
+    ESP_LOGI(TAG, "audio_playback_task() start!");
+    audio_metrics_register_task();
+    i2s_audio_spk_start(rate);
+
+    while (1)
+    {
+        xSemaphoreTake(audio_playback_mutex, portMAX_DELAY);
+        if (audio_playback_mixer.sample_rate != rate)
+        {
+            rate = audio_playback_mixer.sample_rate;
+            i2s_audio_spk_start(rate);
+        }
+        if (audio_playback_profile_request != AUDIO_PROFILE_MAX)
+            audio_playback_apply_profile(rate);
+
+        int samples = (int)(rate * AUDIO_PLAYBACK_BLOCK_MS / 1000);
+        audio_mixer_render(&audio_playback_mixer, audio_playback_buffer, samples);
+        xSemaphoreGive(audio_playback_mutex);
+
+        if (i2s_audio_spk_write(audio_playback_buffer, samples, AUDIO_PLAYBACK_WRITE_TIMEOUT_MS) != ESP_OK)
+        {
+            AUDIO_TRACE0(SPEAKER_TIMEOUT);
+        }
+    }
+}
+
+esp_err_t audio_playback_start(void)
+{
+    if (audio_playback_task_handle)
+        return ESP_ERR_INVALID_STATE;
+
+    audio_playback_mutex = xSemaphoreCreateMutex();
+    audio_playback_profile_done = xSemaphoreCreateBinary();
+    if ((audio_playback_mutex == NULL) || (audio_playback_profile_done == NULL))
+        return ESP_ERR_NO_MEM;
+
+    esp_err_t err = audio_mixer_init(&audio_playback_mixer, I2S_AUDIO_SPK_SAMPLE_RATE);
+    if (err != ESP_OK)
+        return err;
+
+    if (xTaskCreate(audio_playback_task, "AudioPlaybackTask", 3072, NULL, AUDIO_PLAYBACK_TASK_PRIO,
+                    &audio_playback_task_handle) != pdPASS)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "audio_playback_start() Success! %d voices, %d ms blocks.", AUDIO_MIXER_MAX_VOICES,
+             AUDIO_PLAYBACK_BLOCK_MS);
+    return ESP_OK;
+}
+
+int audio_playback_tone(uint32_t freq_hz, uint32_t duration_ms, int32_t gain)
+{
+    audio_mixer_voice_config_t config = { .gain = gain };
+
+    if (audio_playback_task_handle == NULL)
+        return -1;
+
+    xSemaphoreTake(audio_playback_mutex, portMAX_DELAY);
+    int voice = audio_mixer_add_tone(&audio_playback_mixer, &config, freq_hz, duration_ms);
+    xSemaphoreGive(audio_playback_mutex);
+    return voice;
+}
+
+int audio_playback_clip(audio_block_t *clip, int samples, uint32_t sample_rate, int32_t gain)
+{
+    audio_mixer_voice_config_t config = { .gain = gain, .done = audio_playback_release_clip, .ctx = clip };
+    int voice = -1;
+
+    if ((audio_playback_task_handle == NULL) || (clip == NULL))
+        return -1;
+
+    xSemaphoreTake(audio_playback_mutex, portMAX_DELAY);
+    if (audio_playback_accept_rate(sample_rate))
+    {
+        audio_pool_retain(clip);
+        voice = audio_mixer_add_pcm32(&audio_playback_mixer, &config, (const int32_t *)clip->data, samples);
+        if (voice < 0)
+            audio_pool_release(clip);
+    }
+    xSemaphoreGive(audio_playback_mutex);
+    return voice;
+}
+
+int audio_playback_stream(audio_mixer_pull_t pull, void *ctx, uint32_t sample_rate, int32_t gain)
+{
+    audio_mixer_voice_config_t config = { .gain = gain, .pull = pull, .ctx = ctx };
+    int voice = -1;
+
+    if (audio_playback_task_handle == NULL)
+        return -1;
+
+    xSemaphoreTake(audio_playback_mutex, portMAX_DELAY);
+    if (audio_playback_accept_rate(sample_rate))
+        voice = audio_mixer_add_pull(&audio_playback_mixer, &config);
+    xSemaphoreGive(audio_playback_mutex);
+    return voice;
+}
+
+esp_err_t audio_playback_set_gain(int voice, int32_t gain)
+{
+    if (audio_playback_task_handle == NULL)
+        return ESP_ERR_INVALID_STATE;
+
+    xSemaphoreTake(audio_playback_mutex, portMAX_DELAY);
+    esp_err_t err = audio_mixer_set_gain(&audio_playback_mixer, voice, gain);
+    xSemaphoreGive(audio_playback_mutex);
+    return err;
+}
+
+esp_err_t audio_playback_stop(int voice)
+{
+    if (audio_playback_task_handle == NULL)
+        return ESP_ERR_INVALID_STATE;
+
+    xSemaphoreTake(audio_playback_mutex, portMAX_DELAY);
+    esp_err_t err = audio_mixer_stop(&audio_playback_mixer, voice);
+    xSemaphoreGive(audio_playback_mutex);
+    return err;
+}
+
+esp_err_t audio_playback_wait(int voice, int timeout_ms)
+{
+    int waited = 0;
+
+    if (audio_playback_task_handle == NULL)
+        return ESP_OK;
+
+    while (1)
+    {
+        xSemaphoreTake(audio_playback_mutex, portMAX_DELAY);
+        bool active = audio_mixer_voice_active(&audio_playback_mixer, voice);
+        xSemaphoreGive(audio_playback_mutex);
+        if (!active)
+            return ESP_OK;
+        if (waited >= timeout_ms)
+            return ESP_ERR_TIMEOUT;
+        vTaskDelay(pdMS_TO_TICKS(AUDIO_PLAYBACK_WAIT_POLL_MS));
+        waited += AUDIO_PLAYBACK_WAIT_POLL_MS;
+    }
+}
+
+esp_err_t audio_playback_set_profile(audio_profile_id_t id)
+{
+    if (audio_profile_get(id) == NULL)
+        return ESP_ERR_INVALID_ARG;
+    // 播放任务启动前 TX 通道还没有使能, 直接切换
+    if (audio_playback_task_handle == NULL)
+        return i2s_audio_spk_set_profile(id);
+
+    xSemaphoreTake(audio_playback_mutex, portMAX_DELAY);
+    if ((audio_mixer_active_count(&audio_playback_mixer) > 0) || (audio_playback_profile_request != AUDIO_PROFILE_MAX))
+    {
+        xSemaphoreGive(audio_playback_mutex);
+        return ESP_ERR_INVALID_STATE;
+    }
+    audio_playback_profile_request = id;
+    xSemaphoreGive(audio_playback_mutex);
+
+    if (xSemaphoreTake(audio_playback_profile_done, pdMS_TO_TICKS(AUDIO_PLAYBACK_PROFILE_TIMEOUT_MS)) != pdTRUE)
+        return ESP_ERR_TIMEOUT;
+    return audio_playback_profile_result;
+}
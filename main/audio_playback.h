@@ -0,0 +1,62 @@
+#ifndef AUDIO_PLAYBACK_H
+#define AUDIO_PLAYBACK_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "audio_mixer.h"
+#include "audio_pool.h"
+#include "audio_profile.h"
+
+/**
+ * 常驻播放服务: 启动后 I2S TX 通道一直使能, 播放任务每 10ms 从 audio_mixer 取一块写入 DMA,
+ * 没有声部时写静音. 提示音, 录音回放和下行流都是混音器的声部, 可以同时发声,
+ * 不再有每次播放的通道开关 (启动延迟和爆音).
+ *
+ * 输出采样率默认 I2S_AUDIO_SPK_SAMPLE_RATE. 片段/流的采样率不同时, 只有混音器空闲才切换 TX 时钟,
+ * 否则拒绝 (ESP_ERR_INVALID_STATE 或返回 -1); 提示音总是按当前输出采样率合成.
+ * 声部句柄见 audio_mixer.h, 所有接口可在任意任务中调用.
+ */
+#define AUDIO_PLAYBACK_BLOCK_MS             10
+#define AUDIO_PLAYBACK_TASK_PRIO            7
+#define AUDIO_PLAYBACK_WRITE_TIMEOUT_MS     1000
+#define AUDIO_PLAYBACK_WAIT_POLL_MS         10
+#define AUDIO_PLAYBACK_PROFILE_TIMEOUT_MS   2000
+
+esp_err_t audio_playback_start(void);
+
+/**
+ * @brief 播放提示音, 返回声部句柄, 失败返回 -1.
+ */
+int audio_playback_tone(uint32_t freq_hz, uint32_t duration_ms, int32_t gain);
+
+/**
+ * @brief 回放按键录音块 (左对齐 int32). 声部持有块的一个引用, 结束时释放,
+ * 调用者可以立即 release 自己的引用. 返回声部句柄, 失败返回 -1.
+ */
+int audio_playback_clip(audio_block_t *clip, int samples, uint32_t sample_rate, int32_t gain);
+
+/**
+ * @brief 打开流声部: 播放任务每块调用 pull 取 PCM16, 直到 audio_playback_stop.
+ * pull 在播放任务中运行, 不能阻塞. 返回声部句柄, 失败返回 -1.
+ */
+int audio_playback_stream(audio_mixer_pull_t pull, void *ctx, uint32_t sample_rate, int32_t gain);
+
+esp_err_t audio_playback_set_gain(int voice, int32_t gain);
+
+/**
+ * @brief 在下一块内淡出并结束声部, 不等待. 之后用 audio_playback_wait 确认它已不再访问数据.
+ */
+esp_err_t audio_playback_stop(int voice);
+
+/**
+ * @brief 等待声部结束: 结束 (或句柄已失效) 返回 ESP_OK, 超时返回 ESP_ERR_TIMEOUT.
+ */
+esp_err_t audio_playback_wait(int voice, int timeout_ms);
+
+/**
+ * @brief 切换扬声器配置 (DMA 深度). 由播放任务在块之间停止/重建/重启 TX 通道,
+ * 有声部在播放时返回 ESP_ERR_INVALID_STATE.
+ */
+esp_err_t audio_playback_set_profile(audio_profile_id_t id);
+
+#endif // AUDIO_PLAYBACK_H
@@ -0,0 +1,178 @@
+#include <string.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "audio_pool.h"
+
+static const char *TAG = "AUDIO_POOL";
+
+typedef struct {
+    const char *name;
+    uint32_t block_size;
+    uint32_t blocks;
+    bool psram;                 // 期望放在 PSRAM; 否则内部 RAM 且 DMA 可用
+    uint32_t internal_blocks;   // 期望 PSRAM 但没有时, 在内部 RAM 里只分配这么多块
+} audio_pool_config_t;
+
+typedef struct {
+    audio_block_t *headers;
+    uint8_t *storage;
+    QueueHandle_t free_queue;
+    uint32_t blocks;
+    atomic_uint in_use;
+    atomic_uint high_water;
+    atomic_uint acquire_failures;
+    bool psram;
+} audio_pool_t;
+
+static const audio_pool_config_t audio_pool_config[AUDIO_POOL_CLASS_MAX] = {
+    [AUDIO_POOL_FRAME] = { "frame", AUDIO_POOL_FRAME_SIZE, AUDIO_POOL_FRAME_COUNT, false },
+    [AUDIO_POOL_CLIP]  = { "clip",  AUDIO_POOL_CLIP_SIZE,  AUDIO_POOL_CLIP_COUNT,  true, AUDIO_POOL_CLIP_INTERNAL_COUNT },
+};
+
+// 块头 (引用计数等) 始终放在内部 RAM, 只有数据区按类别放置
+static audio_block_t audio_pool_frame_headers[AUDIO_POOL_FRAME_COUNT];
+static audio_block_t audio_pool_clip_headers[AUDIO_POOL_CLIP_COUNT];
+static audio_pool_t audio_pools[AUDIO_POOL_CLASS_MAX] = {
+    [AUDIO_POOL_FRAME] = { .headers = audio_pool_frame_headers },
+    [AUDIO_POOL_CLIP]  = { .headers = audio_pool_clip_headers },
+};
+
+static uint8_t *audio_pool_alloc_storage(const audio_pool_config_t *config, audio_pool_t *pool)
+{
+    uint8_t *storage = NULL;
+
+    pool->blocks = config->blocks;
+#ifdef CONFIG_SPIRAM
+    if (config->psram)
+        storage = heap_caps_aligned_alloc(16, (size_t)config->block_size * pool->blocks, MALLOC_CAP_SPIRAM);
+#endif
+    pool->psram = (storage != NULL);
+    if (storage != NULL)
+        return storage;
+
+    // 退回内部 RAM 的类别不做 DMA, 只要求字节可访问
+    uint32_t caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA;
+    if (config->psram)
+    {
+        pool->blocks = config->internal_blocks;
+        caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+    }
+    return heap_caps_aligned_alloc(16, (size_t)config->block_size * pool->blocks, caps);
+}
+
+esp_err_t audio_pool_init(void)
+{
+    for (int c = 0; c < AUDIO_POOL_CLASS_MAX; c++)
+    {
+        const audio_pool_config_t *config = &audio_pool_config[c];
+        audio_pool_t *pool = &audio_pools[c];
+
+        if (pool->free_queue != NULL)
+            continue;
+
+        pool->storage = audio_pool_alloc_storage(config, pool);
+        pool->free_queue = xQueueCreate(pool->blocks, sizeof(audio_block_t *));
+        if ((pool->storage == NULL) || (pool->free_queue == NULL))
+        {
+            ESP_LOGE(TAG, "Failed to allocate %s pool (%lu x %lu bytes).", config->name,
+                     (unsigned long)pool->blocks, (unsigned long)config->block_size);
+            return ESP_ERR_NO_MEM;
+        }
+
+        atomic_init(&pool->in_use, 0);
+        atomic_init(&pool->high_water, 0);
+        atomic_init(&pool->acquire_failures, 0);
+        for (uint32_t i = 0; i < pool->blocks; i++)
+        {
+            audio_block_t *block = &pool->headers[i];
+            block->pool_class = (uint8_t)c;
+            block->index = (uint8_t)i;
+            atomic_init(&block->refs, 0);
+            block->data = pool->storage + (size_t)i * config->block_size;
+            xQueueSend(pool->free_queue, &block, 0);
+        }
+        ESP_LOGI(TAG, "%s pool: %lu x %lu bytes in %s.", config->name, (unsigned long)pool->blocks,
+                 (unsigned long)config->block_size, pool->psram ? "PSRAM" : "internal RAM");
+    }
+    return ESP_OK;
+}
+
+audio_block_t *audio_pool_acquire(audio_pool_class_t pool_class, int timeout_ms)
+{
+    audio_pool_t *pool = &audio_pools[pool_class];
+    audio_block_t *block = NULL;
+
+    if ((pool->free_queue == NULL) ||
+        (xQueueReceive(pool->free_queue, &block, pdMS_TO_TICKS(timeout_ms)) != pdPASS))
+    {
+        atomic_fetch_add_explicit(&pool->acquire_failures, 1, memory_order_relaxed);
+        return NULL;
+    }
+
+    atomic_store_explicit(&block->refs, 1, memory_order_relaxed);
+    block->len = 0;
+
+    unsigned in_use = atomic_fetch_add_explicit(&pool->in_use, 1, memory_order_relaxed) + 1;
+    unsigned high = atomic_load_explicit(&pool->high_water, memory_order_relaxed);
+    while ((in_use > high) &&
+           !atomic_compare_exchange_weak_explicit(&pool->high_water, &high, in_use,
+                                                  memory_order_relaxed, memory_order_relaxed))
+        ;
+    return block;
+}
+
+void audio_pool_retain(audio_block_t *block)
+{
+    atomic_fetch_add_explicit(&block->refs, 1, memory_order_relaxed);
+}
+
+void audio_pool_release(audio_block_t *block)
+{
+    if (block == NULL)
+        return;
+
+    // acq_rel: 其他持有者对块数据的写入在归还前完成
+    if (atomic_fetch_sub_explicit(&block->refs, 1, memory_order_acq_rel) != 1)
+        return;
+
+    audio_pool_t *pool = &audio_pools[block->pool_class];
+    atomic_fetch_sub_explicit(&pool->in_use, 1, memory_order_relaxed);
+    xQueueSend(pool->free_queue, &block, 0);
+}
+
+size_t audio_pool_block_size(audio_pool_class_t pool_class)
+{
+    return audio_pool_config[pool_class].block_size;
+}
+
+esp_err_t audio_pool_get_stats(audio_pool_class_t pool_class, audio_pool_stats_t *stats)
+{
+    if ((stats == NULL) || (pool_class >= AUDIO_POOL_CLASS_MAX))
+        return ESP_ERR_INVALID_ARG;
+
+    const audio_pool_config_t *config = &audio_pool_config[pool_class];
+    audio_pool_t *pool = &audio_pools[pool_class];
+    stats->name = config->name;
+    stats->block_size = config->block_size;
+    stats->blocks = pool->blocks;
+    stats->in_use = atomic_load_explicit(&pool->in_use, memory_order_relaxed);
+    stats->high_water = atomic_load_explicit(&pool->high_water, memory_order_relaxed);
+    stats->acquire_failures = atomic_load_explicit(&pool->acquire_failures, memory_order_relaxed);
+    stats->psram = pool->psram;
+    return ESP_OK;
+}
+
+void audio_pool_log_stats(void)
+{
+    audio_pool_stats_t stats;
+
+    for (int c = 0; c < AUDIO_POOL_CLASS_MAX; c++)
+    {
+        audio_pool_get_stats((audio_pool_class_t)c, &stats);
+        ESP_LOGI(TAG, "%s pool: %lu/%lu in use, high water %lu, %lu acquire failures (%s).", stats.name,
+                 (unsigned long)stats.in_use, (unsigned long)stats.blocks, (unsigned long)stats.high_water,
+                 (unsigned long)stats.acquire_failures, stats.psram ? "PSRAM" : "internal RAM");
+    }
+}
@@ -0,0 +1,65 @@
+#ifndef AUDIO_POOL_H
+#define AUDIO_POOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include "esp_err.h"
+
+/**
+ * 固定块音频缓冲池.
+ *
+ * 每个类别一次性分配一整块连续存储, 切成等长的块, 空闲块指针放在 FreeRTOS 队列里,
+ * 取/还都是 O(1), 运行期间不会产生碎片. 每个类别显式指定放在内部 RAM (DMA 可用)
+ * 还是 PSRAM (没有 PSRAM 时退回内部 RAM, 块数可以更少, 见 AUDIO_POOL_CLIP_INTERNAL_COUNT).
+ *
+ * 块带引用计数: 采集得到的一块可以同时交给播放/转换/发送, 各自 retain, 用完 release,
+ * 最后一个 release 的人把块还回池里, 中间不需要拷贝.
+ */
+typedef enum {
+    AUDIO_POOL_FRAME = 0,       // 流采集帧: 1024 x int32, 内部 RAM
+    AUDIO_POOL_CLIP,            // 按键录音: 1s x int32, 优先 PSRAM
+    AUDIO_POOL_CLASS_MAX,
+} audio_pool_class_t;
+
+#define AUDIO_POOL_FRAME_SIZE       4096
+#define AUDIO_POOL_FRAME_COUNT      14      // 8 帧在途 + 6 帧 VAD 预录
+#define AUDIO_POOL_CLIP_SIZE        64000
+#define AUDIO_POOL_CLIP_COUNT       2       // 一块在录, 一块可能还在发布队列里
+#define AUDIO_POOL_CLIP_INTERNAL_COUNT  1   // 没有 PSRAM 时只留一块, 上一次发布完成前新的录音等待取块
+
+typedef struct {
+    uint8_t pool_class;
+    uint8_t index;
+    atomic_int refs;
+    uint32_t sequence;
+    int64_t timestamp_us;
+    size_t len;                 // 有效字节数, 由使用者填写
+    void *data;                 // 块存储, 至少 4 字节对齐
+} audio_block_t;
+
+typedef struct {
+    const char *name;
+    uint32_t block_size;
+    uint32_t blocks;
+    uint32_t in_use;
+    uint32_t high_water;        // 同时在用的最大块数
+    uint32_t acquire_failures;  // 取块失败 (池空) 次数
+    bool psram;
+} audio_pool_stats_t;
+
+esp_err_t audio_pool_init(void);
+
+/**
+ * @brief 取一个空闲块, 引用计数为 1. 池空时最多等待 timeout_ms, 超时返回 NULL.
+ */
+audio_block_t *audio_pool_acquire(audio_pool_class_t pool_class, int timeout_ms);
+void audio_pool_retain(audio_block_t *block);
+void audio_pool_release(audio_block_t *block);
+
+size_t audio_pool_block_size(audio_pool_class_t pool_class);
+esp_err_t audio_pool_get_stats(audio_pool_class_t pool_class, audio_pool_stats_t *stats);
+void audio_pool_log_stats(void);
+
+#endif // AUDIO_POOL_H
@@ -0,0 +1,54 @@
+#include <stddef.h>
+#include "audio_profile.h"
+
+static const audio_profile_t audio_profile_table[AUDIO_PROFILE_MAX] = {
+    [AUDIO_PROFILE_LOW_LATENCY] = { "low-latency", 16000, 32, 4, 16000 },
+    [AUDIO_PROFILE_BALANCED]    = { "balanced",    16000, 32, 8, 128000 },
+    [AUDIO_PROFILE_DEEP]        = { "deep",        16000, 24, 8, 512000 },
+    [AUDIO_PROFILE_8K]          = { "8k",          8000,  32, 8, 128000 },
+    [AUDIO_PROFILE_24K]         = { "24k",         24000, 32, 8, 128000 },
+    [AUDIO_PROFILE_48K]         = { "48k",         48000, 32, 8, 128000 },
+};
+
+const audio_profile_t *audio_profile_get(audio_profile_id_t id)
+{
+    if (((int)id < 0) || (id >= AUDIO_PROFILE_MAX))
+        return NULL;
+    return &audio_profile_table[id];
+}
+
+esp_err_t audio_profile_dma_size(const audio_profile_t *profile, int channels, audio_profile_dma_t *dma)
+{
+    if ((profile == NULL) || (dma == NULL) || (channels < 1) || (channels > 2))
+        return ESP_ERR_INVALID_ARG;
+
+    switch (profile->sample_rate)
+    {
+    case 8000: case 16000: case 24000: case 48000:
+        break;
+    default:
+        return ESP_ERR_INVALID_ARG;
+    }
+    if ((profile->data_bits != 16) && (profile->data_bits != 24) && (profile->data_bits != 32))
+        return ESP_ERR_INVALID_ARG;
+
+    uint32_t sample_bytes = profile->data_bits / 8;
+    uint32_t frame_bytes = sample_bytes * (uint32_t)channels;
+    uint32_t max_frames = AUDIO_PROFILE_DMA_MAX_BYTES / frame_bytes;
+    uint32_t frames = (uint32_t)(((uint64_t)profile->target_latency_us * profile->sample_rate + 999999) / 1000000);
+    uint32_t desc_num = (profile->min_desc > AUDIO_PROFILE_DMA_MIN_DESC) ? profile->min_desc : AUDIO_PROFILE_DMA_MIN_DESC;
+
+    if (desc_num < (frames + max_frames - 1) / max_frames)
+        desc_num = (frames + max_frames - 1) / max_frames;
+    uint32_t frame_num = (frames + desc_num - 1) / desc_num;
+    if (frame_num < 2)
+        return ESP_ERR_INVALID_ARG;
+
+    dma->desc_num = desc_num;
+    dma->frame_num = frame_num;
+    dma->sample_bytes = sample_bytes;
+    dma->period_us = (uint32_t)((uint64_t)frame_num * 1000000 / profile->sample_rate);
+    dma->latency_us = (uint32_t)((uint64_t)desc_num * frame_num * 1000000 / profile->sample_rate);
+    dma->dma_bytes = desc_num * frame_num * frame_bytes;
+    return ESP_OK;
+}
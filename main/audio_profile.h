@@ -0,0 +1,57 @@
+#ifndef AUDIO_PROFILE_H
+#define AUDIO_PROFILE_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * I2S 采集/播放配置: 采样率, DMA 中每个样本的位宽, 以及由目标延迟推出的 DMA 描述符数和帧数.
+ *
+ * 槽位始终是 32bit (INMP441 需要每声道 32 个 BCLK), data_bits 只决定 DMA 里每个样本的字节数:
+ * ESP32-S3 上 24bit 打包成 3 字节, 16bit 为 2 字节, 读出后再展开成左对齐的 int32.
+ * 我们只保留高 20 位 (>> 12), 24bit 不损失精度而 DMA 内存和带宽少 1/4.
+ */
+#define AUDIO_PROFILE_DMA_MAX_BYTES     4092    // 一个 DMA 描述符的最大字节数
+#define AUDIO_PROFILE_DMA_MIN_DESC      2
+#define AUDIO_PROFILE_SLOT_BITS         32
+
+typedef enum {
+    AUDIO_PROFILE_LOW_LATENCY = 0,      // 16kHz, 4 x 4ms: 数据最快 4ms 可读, 但只能容忍 16ms 的读取停顿
+    AUDIO_PROFILE_BALANCED,             // 16kHz, 8 x 16ms: 原来的固定配置
+    AUDIO_PROFILE_DEEP,                 // 16kHz 24bit, 8 x 64ms: 中断最少, 容忍 512ms 停顿
+    AUDIO_PROFILE_8K,
+    AUDIO_PROFILE_24K,
+    AUDIO_PROFILE_48K,
+    AUDIO_PROFILE_MAX
+} audio_profile_id_t;
+
+typedef struct {
+    const char *name;
+    uint32_t sample_rate;
+    uint8_t data_bits;                  // 16 / 24 / 32
+    uint8_t min_desc;                   // 描述符数下限, 决定数据到达的粒度
+    uint32_t target_latency_us;         // 整个 DMA 环的目标时长
+} audio_profile_t;
+
+typedef struct {
+    uint32_t desc_num;
+    uint32_t frame_num;                 // 每个描述符的帧数
+    uint32_t sample_bytes;              // DMA 中每个样本的字节数
+    uint32_t period_us;                 // 一个描述符的时长: 数据到达 (RX) / 被取走 (TX) 的粒度
+    uint32_t latency_us;                // 整个环的时长: TX 的缓冲延迟, RX 能容忍的最长读取停顿
+    uint32_t dma_bytes;                 // 整个 DMA 环占用的内存
+} audio_profile_dma_t;
+
+/**
+ * @brief 取配置表中的一项, id 无效时返回 NULL.
+ */
+const audio_profile_t *audio_profile_get(audio_profile_id_t id);
+
+/**
+ * @brief 由目标延迟推出 DMA 配置: 总帧数 = ceil(目标延迟 * 采样率), 描述符数取 min_desc 与
+ * 单描述符字节上限所需个数的较大者, 帧数向上取整. 实际延迟不小于目标延迟.
+ * 采样率不是 8/16/24/48kHz, 位宽不是 16/24/32 或目标延迟不足一个描述符两帧时返回 ESP_ERR_INVALID_ARG.
+ */
+esp_err_t audio_profile_dma_size(const audio_profile_t *profile, int channels, audio_profile_dma_t *dma);
+
+#endif // AUDIO_PROFILE_H
@@ -0,0 +1,676 @@
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/uio.h>
+#include <stdatomic.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "audio_recorder.h"
+#include "audio_storage.h"
+#include "wav_audio.h"
+#include "network_socket.h"
+#include "audio_metrics.h"
+
+static const char *TAG = "AUDIO_RECORDER";
+
+typedef enum {
+    AUDIO_RECORDER_MSG_OPEN,
+    AUDIO_RECORDER_MSG_DATA,
+    AUDIO_RECORDER_MSG_CLOSE,
+} audio_recorder_msg_type_t;
+
+typedef struct {
+    uint8_t type;
+    int8_t buffer;
+    uint32_t len;
+    uint32_t data_size;             // CLOSE: WAV 数据字节数, 用于回写头部
+    bool wav;
+    bool recover;                   // CLOSE: 补发的恢复关闭, 不回写头部
+    wav_audio_format_t format;
+    char path[AUDIO_RECORDER_PATH_MAX];
+} audio_recorder_msg_t;
+
+static int audio_recorder_format = AUDIO_RECORDER_FORMAT_WAV;
+static uint8_t *audio_recorder_buffers[AUDIO_RECORDER_BUFFER_COUNT];
+static QueueHandle_t audio_recorder_free_queue = NULL;
+static QueueHandle_t audio_recorder_msg_queue = NULL;
+static uint32_t audio_recorder_next_index = 0;
+
+// 采集侧, 写任务和上传任务都会更新, 与 audio_metrics 一样用原子计数
+typedef struct {
+    atomic_uint files;
+    atomic_uint bytes_written;
+    atomic_uint frames_dropped;
+    atomic_uint write_errors;
+    atomic_uint max_stall_us;
+    atomic_uint max_write_us;
+    atomic_uint files_uploaded;
+    atomic_uint closes_dropped;
+    atomic_uint files_recovered;
+} audio_recorder_counters_t;
+
+static audio_recorder_counters_t audio_recorder_stats;
+
+// 连接的使用者: 流和批量上传互斥, 检查和占用在一次比较交换中完成
+#define AUDIO_RECORDER_LINK_IDLE        0
+#define AUDIO_RECORDER_LINK_STREAM      1
+#define AUDIO_RECORDER_LINK_UPLOAD      2
+static atomic_int audio_recorder_link = AUDIO_RECORDER_LINK_IDLE;
+
+// 写任务每处理完一个 CLOSE (回写头部, fsync, close) 计数一次并释放信号量
+static SemaphoreHandle_t audio_recorder_closed = NULL;
+static atomic_uint audio_recorder_closes_sent;
+static atomic_uint audio_recorder_closes_done;
+static atomic_bool audio_recorder_recover = false;     // 有 CLOSE 丢失, 上传前补发一个
+
+// 以下只由采集侧 (流发送任务) 访问
+static bool audio_recorder_recording = false;
+static int audio_recorder_active = -1;
+static size_t audio_recorder_fill = 0;
+static bool audio_recorder_wav = false;
+static wav_audio_format_t audio_recorder_wav_format;
+static uint32_t audio_recorder_data_size = 0;
+
+// 录音文件名 R0000001.WAV / R0000001.FRM (FAT 8.3 格式)
+static bool audio_recorder_parse_name(const char *name, uint32_t *index, bool *wav)
+{
+    unsigned long value;
+    char ext[4];
+
+    if ((strlen(name) != 12) || (sscanf(name, "R%7lu.%3s", &value, ext) != 2))
+        return false;
+    if (strcmp(ext, "WAV") == 0)
+        *wav = true;
+    else if (strcmp(ext, "FRM") == 0)
+        *wav = false;
+    else
+        return false;
+    *index = (uint32_t)value;
+    return true;
+}
+
+static void audio_recorder_make_path(char *path, uint32_t index, bool wav)
+{
+    snprintf(path, AUDIO_RECORDER_PATH_MAX, "%s/R%07lu.%s", audio_storage_base_path(),
+             (unsigned long)(index % 10000000), wav ? "WAV" : "FRM");
+}
+
+static void audio_recorder_count(atomic_uint *counter, uint32_t value)
+{
+    atomic_fetch_add_explicit(counter, value, memory_order_relaxed);
+}
+
+static void audio_recorder_update_max(atomic_uint *max, uint32_t value)
+{
+    unsigned current = atomic_load_explicit(max, memory_order_relaxed);
+    while ((value > current) &&
+           !atomic_compare_exchange_weak_explicit(max, &current, value, memory_order_relaxed, memory_order_relaxed))
+        ;
+}
+
+static int audio_recorder_write_all(int fd, const uint8_t *data, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t n = write(fd, data, len);
+        if (n <= 0)
+            return -1;
+        data += n;
+        len -= n;
+    }
+    return 0;
+}
+
+/**
+ * @brief 写任务: 按顺序执行打开/写入/关闭, 文件系统的延迟只影响这里.
+ */
+static void audio_recorder_task(void *arg)
+{
+    audio_recorder_msg_t msg;
+    uint8_t header[WAV_AUDIO_HEADER_SIZE];
+    int fd = -1;
+
+    audio_metrics_register_task();
+    while (1)
+    {
+        xQueueReceive(audio_recorder_msg_queue, &msg, portMAX_DELAY);
+
+        if (msg.type == AUDIO_RECORDER_MSG_OPEN)
+        {
+            // 上一个文件的 CLOSE 丢失: 保留流式头直接关闭
+            if (fd >= 0)
+            {
+                fsync(fd);
+                close(fd);
+                audio_recorder_count(&audio_recorder_stats.files_recovered, 1);
+            }
+            fd = open(msg.path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0)
+            {
+                ESP_LOGE(TAG, "Failed to create %s.", msg.path);
+                audio_recorder_count(&audio_recorder_stats.write_errors, 1);
+            }
+        }
+        else if (msg.type == AUDIO_RECORDER_MSG_DATA)
+        {
+            if (fd >= 0)
+            {
+                int64_t start_us = esp_timer_get_time();
+                if (audio_recorder_write_all(fd, audio_recorder_buffers[msg.buffer], msg.len) != 0)
+                {
+                    ESP_LOGE(TAG, "Write failed, closing file.");
+                    audio_recorder_count(&audio_recorder_stats.write_errors, 1);
+                    close(fd);
+                    fd = -1;
+                }
+                else
+                {
+                    audio_recorder_update_max(&audio_recorder_stats.max_write_us,
+                                              (uint32_t)(esp_timer_get_time() - start_us));
+                    audio_recorder_count(&audio_recorder_stats.bytes_written, msg.len);
+                }
+            }
+            xQueueSend(audio_recorder_free_queue, &msg.buffer, 0);
+        }
+        else
+        {
+            if (fd >= 0)
+            {
+                // WAV 开头写的是流式头, 这里回写真实大小; 断电时文件仍可按流式头读出
+                if (msg.wav && (wav_audio_build_header(&msg.format, msg.data_size, header) == ESP_OK) &&
+                    ((lseek(fd, 0, SEEK_SET) != 0) || (audio_recorder_write_all(fd, header, sizeof(header)) != 0)))
+                    audio_recorder_count(&audio_recorder_stats.write_errors, 1);
+                fsync(fd);
+                close(fd);
+                fd = -1;
+                audio_recorder_count(msg.recover ? &audio_recorder_stats.files_recovered : &audio_recorder_stats.files, 1);
+            }
+            atomic_fetch_add(&audio_recorder_closes_done, 1);
+            xSemaphoreGive(audio_recorder_closed);
+        }
+    }
+}
+
+static void audio_recorder_submit(void)
+{
+    audio_recorder_msg_t msg = {
+        .type = AUDIO_RECORDER_MSG_DATA,
+        .buffer = (int8_t)audio_recorder_active,
+        .len = audio_recorder_fill,
+    };
+
+    if (xQueueSend(audio_recorder_msg_queue, &msg, 0) != pdPASS)
+    {
+        // 消息队列满 (写任务严重滞后): 这一块数据丢弃
+        audio_recorder_count(&audio_recorder_stats.frames_dropped, 1);
+        xQueueSend(audio_recorder_free_queue, &msg.buffer, 0);
+    }
+    audio_recorder_active = -1;
+    audio_recorder_fill = 0;
+}
+
+// 当前缓冲区的剩余空间 + 空闲缓冲区
+static size_t audio_recorder_available(void)
+{
+    size_t available = uxQueueMessagesWaiting(audio_recorder_free_queue) * AUDIO_RECORDER_BUFFER_SIZE;
+
+    if (audio_recorder_active >= 0)
+        available += AUDIO_RECORDER_BUFFER_SIZE - audio_recorder_fill;
+    return available;
+}
+
+/**
+ * @brief 把一帧 (若干段) 追加到写后缓冲. 空间不足时整帧丢弃, 文件里不会出现半帧.
+ */
+static esp_err_t audio_recorder_append(const struct iovec *iov, int iovcnt)
+{
+    size_t needed = 0;
+
+    for (int i = 0; i < iovcnt; i++)
+        needed += iov[i].iov_len;
+    if (needed > audio_recorder_available())
+    {
+        audio_recorder_count(&audio_recorder_stats.frames_dropped, 1);
+        return ESP_ERR_NO_MEM;
+    }
+
+    for (int i = 0; i < iovcnt; i++)
+    {
+        const uint8_t *data = (const uint8_t *)iov[i].iov_base;
+        size_t len = iov[i].iov_len;
+
+        while (len > 0)
+        {
+            if (audio_recorder_active < 0)
+            {
+                int8_t index;
+                xQueueReceive(audio_recorder_free_queue, &index, 0);
+                audio_recorder_active = index;
+            }
+
+            size_t n = AUDIO_RECORDER_BUFFER_SIZE - audio_recorder_fill;
+            n = (n > len) ? len : n;
+            memcpy(audio_recorder_buffers[audio_recorder_active] + audio_recorder_fill, data, n);
+            audio_recorder_fill += n;
+            data += n;
+            len -= n;
+
+            if (audio_recorder_fill == AUDIO_RECORDER_BUFFER_SIZE)
+                audio_recorder_submit();
+        }
+    }
+    return ESP_OK;
+}
+
+static void audio_recorder_close(void)
+{
+    audio_recorder_msg_t msg = {
+        .type = AUDIO_RECORDER_MSG_CLOSE,
+        .data_size = audio_recorder_data_size,
+        .wav = audio_recorder_wav,
+        .format = audio_recorder_wav_format,
+    };
+
+    if (audio_recorder_active >= 0)
+        audio_recorder_submit();
+    // 不等待写任务: 队列满时文件保留开头的流式头, 仍可读出, 由下一个 OPEN 或上传前补发的 CLOSE 关闭
+    if (xQueueSend(audio_recorder_msg_queue, &msg, 0) == pdPASS)
+    {
+        atomic_fetch_add(&audio_recorder_closes_sent, 1);
+    }
+    else
+    {
+        audio_recorder_count(&audio_recorder_stats.closes_dropped, 1);
+        atomic_store(&audio_recorder_recover, true);
+    }
+    audio_recorder_recording = false;
+}
+
+static esp_err_t audio_recorder_open(const stream_frame_session_t *session)
+{
+    audio_recorder_msg_t msg = { .type = AUDIO_RECORDER_MSG_OPEN };
+
+    audio_recorder_wav = (audio_recorder_format == AUDIO_RECORDER_FORMAT_WAV);
+    if (audio_recorder_wav && (session->codec == STREAM_CODEC_ADPCM))
+    {
+        ESP_LOGW(TAG, "ADPCM session, recording framed instead of WAV.");
+        audio_recorder_wav = false;
+    }
+
+    // 文件开头 (WAV 头或 SESSION 帧) 放不下时整个会话不录, 否则文件无法解析
+    size_t needed = audio_recorder_wav ? WAV_AUDIO_HEADER_SIZE
+                                       : sizeof(stream_frame_header_t) + sizeof(stream_frame_session_t);
+    if (needed > audio_recorder_available())
+    {
+        audio_recorder_count(&audio_recorder_stats.frames_dropped, 1);
+        return ESP_ERR_NO_MEM;
+    }
+    audio_recorder_wav_format.format = WAV_AUDIO_FORMAT_PCM;
+    audio_recorder_wav_format.channels = session->channels;
+    audio_recorder_wav_format.sample_rate = session->sample_rate;
+    audio_recorder_wav_format.bits_per_sample = session->bits_per_sample;
+    audio_recorder_data_size = 0;
+
+    audio_recorder_make_path(msg.path, audio_recorder_next_index++, audio_recorder_wav);
+    if (xQueueSend(audio_recorder_msg_queue, &msg, 0) != pdPASS)
+        return ESP_FAIL;
+    audio_recorder_recording = true;
+    ESP_LOGI(TAG, "Recording to %s.", msg.path);
+
+    if (audio_recorder_wav)
+    {
+        uint8_t header[WAV_AUDIO_HEADER_SIZE];
+        struct iovec iov = { .iov_base = header, .iov_len = sizeof(header) };
+        wav_audio_build_header(&audio_recorder_wav_format, WAV_AUDIO_STREAMING_SIZE, header);
+        audio_recorder_append(&iov, 1);
+    }
+    return ESP_OK;
+}
+
+esp_err_t audio_recorder_record_frame(const stream_frame_header_t *header, const void *payload, size_t len)
+{
+    int64_t start_us = esp_timer_get_time();
+    struct iovec iov[2] = {
+        { .iov_base = (void *)header, .iov_len = sizeof(*header) },
+        { .iov_base = (void *)payload, .iov_len = len },
+    };
+    esp_err_t err = ESP_OK;
+
+    if (audio_recorder_msg_queue == NULL)
+        return ESP_ERR_INVALID_STATE;
+
+    if (header->type == STREAM_FRAME_SESSION)
+    {
+        if (audio_recorder_recording)
+            audio_recorder_close();
+        if (len < sizeof(stream_frame_session_t))
+            return ESP_ERR_INVALID_ARG;
+        err = audio_recorder_open((const stream_frame_session_t *)payload);
+    }
+    if (!audio_recorder_recording)
+        return err;
+
+    if (!audio_recorder_wav)
+    {
+        err = audio_recorder_append(iov, len ? 2 : 1);
+    }
+    else if ((header->type == STREAM_FRAME_AUDIO) && (len > 0))
+    {
+        err = audio_recorder_append(&iov[1], 1);
+        if (err == ESP_OK)
+            audio_recorder_data_size += len;
+    }
+
+    if (header->type == STREAM_FRAME_END)
+        audio_recorder_close();
+
+    audio_recorder_update_max(&audio_recorder_stats.max_stall_us, (uint32_t)(esp_timer_get_time() - start_us));
+    return err;
+}
+
+bool audio_recorder_is_recording(void)
+{
+    return audio_recorder_recording;
+}
+
+bool audio_recorder_is_uploading(void)
+{
+    return atomic_load(&audio_recorder_link) == AUDIO_RECORDER_LINK_UPLOAD;
+}
+
+static bool audio_recorder_claim_link(int owner)
+{
+    int expected = AUDIO_RECORDER_LINK_IDLE;
+    return atomic_compare_exchange_strong(&audio_recorder_link, &expected, owner);
+}
+
+static void audio_recorder_release_link(int owner)
+{
+    int expected = owner;
+    atomic_compare_exchange_strong(&audio_recorder_link, &expected, AUDIO_RECORDER_LINK_IDLE);
+}
+
+esp_err_t audio_recorder_stream_begin(void)
+{
+    return audio_recorder_claim_link(AUDIO_RECORDER_LINK_STREAM) ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+void audio_recorder_stream_end(void)
+{
+    audio_recorder_release_link(AUDIO_RECORDER_LINK_STREAM);
+}
+
+/**
+ * @brief 等待写任务处理完所有已发出的 CLOSE. 消息按顺序处理, 此时之前的数据也都已写入,
+ * 文件头已回写并关闭. 调用者占用着连接, 期间不会开始新的录音.
+ */
+static esp_err_t audio_recorder_wait_idle(int timeout_ms)
+{
+    TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(timeout_ms);
+
+    if (atomic_exchange(&audio_recorder_recover, false))
+    {
+        audio_recorder_msg_t msg = { .type = AUDIO_RECORDER_MSG_CLOSE, .recover = true };
+        if (xQueueSend(audio_recorder_msg_queue, &msg, pdMS_TO_TICKS(timeout_ms)) != pdPASS)
+        {
+            atomic_store(&audio_recorder_recover, true);
+            return ESP_ERR_TIMEOUT;
+        }
+        atomic_fetch_add(&audio_recorder_closes_sent, 1);
+    }
+
+    while (atomic_load(&audio_recorder_closes_done) != atomic_load(&audio_recorder_closes_sent))
+    {
+        TickType_t remaining = deadline - xTaskGetTickCount();
+        if ((int32_t)remaining <= 0)
+            return ESP_ERR_TIMEOUT;
+        xSemaphoreTake(audio_recorder_closed, remaining);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t audio_recorder_upload_framed(int fd, uint8_t *chunk)
+{
+    uint32_t connection = network_socket_connection();
+    struct iovec iov = { .iov_base = chunk };
+    ssize_t n;
+
+    if (connection == 0)
+        return ESP_FAIL;
+    while ((n = read(fd, chunk, AUDIO_RECORDER_UPLOAD_CHUNK)) > 0)
+    {
+        iov.iov_len = n;
+        if (network_socket_sendv_conn(connection, &iov, 1) != n)
+            return ESP_FAIL;
+    }
+    return (n == 0) ? ESP_OK : ESP_FAIL;
+}
+
+static int audio_recorder_fd_read(void *ctx, void *data, size_t len)
+{
+    return (int)read(*(int *)ctx, data, len);
+}
+
+/**
+ * @brief WAV 录音按分帧会话上传: SESSION + 若干 AUDIO + END, 接收端每个会话存一个文件.
+ */
+static esp_err_t audio_recorder_upload_wav(int fd, uint8_t *chunk)
+{
+    wav_audio_source_t source = { .read = audio_recorder_fd_read, .ctx = &fd };
+    wav_audio_reader_t reader;
+    stream_frame_header_t header;
+    stream_frame_session_t session;
+    struct iovec iov[2] = {
+        { .iov_base = &header, .iov_len = sizeof(header) },
+        { .iov_base = chunk, .iov_len = 0 },
+    };
+
+    esp_err_t err = wav_audio_reader_open(&reader, &source);
+    if (err != ESP_OK)
+        return err;
+    if ((reader.format.format != WAV_AUDIO_FORMAT_PCM) || (reader.format.channels != 1) ||
+        ((reader.format.bits_per_sample != 16) && (reader.format.bits_per_sample != 32)))
+        return ESP_ERR_NOT_SUPPORTED;
+
+    uint8_t codec = (reader.format.bits_per_sample == 16) ? STREAM_CODEC_PCM16 : STREAM_CODEC_RAW32;
+    uint16_t session_id = stream_frame_next_session_id();
+    uint32_t connection = network_socket_connection();
+    int64_t now = esp_timer_get_time();
+    uint32_t sequence = 0;
+    uint32_t sample_index = 0;
+    int n;
+
+    stream_frame_build_session(&session, codec, reader.format.sample_rate, now);
+    stream_frame_build_header(&header, STREAM_FRAME_SESSION, session_id, 0, 0, sizeof(session), now);
+    iov[1] = (struct iovec){ .iov_base = &session, .iov_len = sizeof(session) };
+    // 一个文件一个会话, 中途重连时不续到新连接上
+    if ((connection == 0) || (network_socket_sendv_conn(connection, iov, 2) != (int)(sizeof(header) + sizeof(session))))
+        return ESP_FAIL;
+
+    iov[1].iov_base = chunk;
+    while ((n = wav_audio_reader_read(&reader, chunk, AUDIO_RECORDER_UPLOAD_CHUNK)) > 0)
+    {
+        stream_frame_build_header(&header, STREAM_FRAME_AUDIO, session_id, sequence++, sample_index, n, now);
+        iov[1].iov_len = n;
+        if (network_socket_sendv_conn(connection, iov, 2) != (int)sizeof(header) + n)
+            return ESP_FAIL;
+        sample_index += n / reader.block_align;
+    }
+    if (n < 0)
+        return ESP_FAIL;
+
+    stream_frame_build_header(&header, STREAM_FRAME_END, session_id, sequence, sample_index, 0, now);
+    return (network_socket_sendv_conn(connection, iov, 1) == (int)sizeof(header)) ? ESP_OK : ESP_FAIL;
+}
+
+// 找序号大于 after 的最旧录音, 没有时返回 false
+static bool audio_recorder_find_next(uint32_t after, bool first, uint32_t *index, bool *wav)
+{
+    DIR *dir = opendir(audio_storage_base_path());
+    struct dirent *entry;
+    bool found = false;
+
+    if (dir == NULL)
+        return false;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        uint32_t value;
+        bool is_wav;
+        if (!audio_recorder_parse_name(entry->d_name, &value, &is_wav))
+            continue;
+        if ((!first && (value <= after)) || (found && (value >= *index)))
+            continue;
+        *index = value;
+        *wav = is_wav;
+        found = true;
+    }
+    closedir(dir);
+    return found;
+}
+
+esp_err_t audio_recorder_upload(void)
+{
+#if NETWORK_SOCKET_USE_UDP
+    return ESP_ERR_NOT_SUPPORTED;
+#else
+    char path[AUDIO_RECORDER_PATH_MAX];
+    uint32_t index = 0;
+    bool wav;
+    bool first = true;
+    esp_err_t err = ESP_OK;
+
+    // 录音只在流进行中发生, 占到连接就不会再有录音开始
+    if ((audio_recorder_msg_queue == NULL) || !audio_recorder_claim_link(AUDIO_RECORDER_LINK_UPLOAD))
+        return ESP_ERR_INVALID_STATE;
+    if (network_socket_init() < 0)
+    {
+        audio_recorder_release_link(AUDIO_RECORDER_LINK_UPLOAD);
+        return ESP_FAIL;
+    }
+
+    uint8_t *chunk = heap_caps_malloc(AUDIO_RECORDER_UPLOAD_CHUNK, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if ((chunk == NULL) || (audio_recorder_wait_idle(5000) != ESP_OK))
+    {
+        free(chunk);
+        audio_recorder_release_link(AUDIO_RECORDER_LINK_UPLOAD);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    while (audio_recorder_find_next(index, first, &index, &wav))
+    {
+        first = false;
+        audio_recorder_make_path(path, index, wav);
+        int fd = open(path, O_RDONLY);
+        if (fd < 0)
+            continue;
+
+        int64_t start_us = esp_timer_get_time();
+        err = wav ? audio_recorder_upload_wav(fd, chunk) : audio_recorder_upload_framed(fd, chunk);
+        close(fd);
+
+        if (err == ESP_OK)
+        {
+            ESP_LOGI(TAG, "Uploaded %s in %lld ms.", path, (long long)((esp_timer_get_time() - start_us) / 1000));
+            unlink(path);
+            audio_recorder_count(&audio_recorder_stats.files_uploaded, 1);
+        }
+        else if (err == ESP_ERR_NOT_SUPPORTED)
+        {
+            ESP_LOGW(TAG, "Skipping %s: unsupported format.", path);
+        }
+        else
+        {
+            ESP_LOGE(TAG, "Upload of %s failed, keeping remaining files.", path);
+            break;
+        }
+    }
+
+    free(chunk);
+    audio_recorder_release_link(AUDIO_RECORDER_LINK_UPLOAD);
+    return (err == ESP_ERR_NOT_SUPPORTED) ? ESP_OK : err;
+#endif
+}
+
+static void audio_recorder_upload_task(void *arg)
+{
+    // network_socket_init() 每次最多等待 NETWORK_SOCKET_CONNECT_TIMEOUT_MS
+    while (network_socket_init() < 0)
+        vTaskDelay(pdMS_TO_TICKS(5000));
+
+    if (audio_recorder_upload() != ESP_OK)
+        ESP_LOGW(TAG, "Bulk upload incomplete.");
+    vTaskDelete(NULL);
+}
+
+esp_err_t audio_recorder_upload_start(void)
+{
+    if (xTaskCreate(audio_recorder_upload_task, "RecorderUpload", 4096, NULL, 2, NULL) != pdPASS)
+        return ESP_FAIL;
+    return ESP_OK;
+}
+
+esp_err_t audio_recorder_init(int format)
+{
+    uint32_t index;
+    bool wav;
+
+    if (audio_recorder_msg_queue != NULL)
+        return ESP_OK;
+
+    esp_err_t err = audio_storage_mount();
+    if (err != ESP_OK)
+        return err;
+
+    audio_recorder_format = format;
+    audio_recorder_free_queue = xQueueCreate(AUDIO_RECORDER_BUFFER_COUNT, sizeof(int8_t));
+    audio_recorder_msg_queue = xQueueCreate(AUDIO_RECORDER_QUEUE_LEN, sizeof(audio_recorder_msg_t));
+    audio_recorder_closed = xSemaphoreCreateBinary();
+    if ((audio_recorder_free_queue == NULL) || (audio_recorder_msg_queue == NULL) || (audio_recorder_closed == NULL))
+        return ESP_ERR_NO_MEM;
+
+    // 缓冲区放在内部 RAM: SD 卡 SPI 传输需要 DMA 可用的内存, 否则驱动还要再拷贝一次
+    for (int8_t i = 0; i < AUDIO_RECORDER_BUFFER_COUNT; i++)
+    {
+        audio_recorder_buffers[i] = heap_caps_aligned_alloc(4, AUDIO_RECORDER_BUFFER_SIZE,
+                                                            MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+        if (audio_recorder_buffers[i] == NULL)
+            return ESP_ERR_NO_MEM;
+        xQueueSend(audio_recorder_free_queue, &i, 0);
+    }
+
+    // 接着已有录音的最大序号往后编号
+    if (audio_recorder_find_next(0, true, &index, &wav))
+    {
+        audio_recorder_next_index = index + 1;
+        while (audio_recorder_find_next(index, false, &index, &wav))
+            audio_recorder_next_index = index + 1;
+    }
+
+    xTaskCreate(audio_recorder_task, "RecorderTask", 3072, NULL, AUDIO_RECORDER_TASK_PRIO, NULL);
+    ESP_LOGI(TAG, "Recorder ready (%s), next file index %lu.",
+             (format == AUDIO_RECORDER_FORMAT_WAV) ? "wav" : "framed", (unsigned long)audio_recorder_next_index);
+    return ESP_OK;
+}
+
+esp_err_t audio_recorder_get_stats(audio_recorder_stats_t *stats)
+{
+    if (stats == NULL)
+        return ESP_ERR_INVALID_ARG;
+    stats->files = atomic_load(&audio_recorder_stats.files);
+    stats->bytes_written = atomic_load(&audio_recorder_stats.bytes_written);
+    stats->frames_dropped = atomic_load(&audio_recorder_stats.frames_dropped);
+    stats->write_errors = atomic_load(&audio_recorder_stats.write_errors);
+    stats->max_stall_us = atomic_load(&audio_recorder_stats.max_stall_us);
+    stats->max_write_us = atomic_load(&audio_recorder_stats.max_write_us);
+    stats->files_uploaded = atomic_load(&audio_recorder_stats.files_uploaded);
+    stats->closes_dropped = atomic_load(&audio_recorder_stats.closes_dropped);
+    stats->files_recovered = atomic_load(&audio_recorder_stats.files_recovered);
+    return ESP_OK;
+}
@@ -0,0 +1,79 @@
+#ifndef AUDIO_RECORDER_H
+#define AUDIO_RECORDER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+#include "stream_frame.h"
+
+/**
+ * 本地录音: 作为分帧流的另一个消费者, SESSION 帧打开新文件, END 帧关闭文件.
+ * 文件格式:
+ *   - WAV: 只保存 AUDIO 负载 (RAW32 -> 32bit PCM, PCM16 -> 16bit PCM). ADPCM 会话退回分帧格式.
+ *   - 分帧 (.FRM): 原样保存所有帧, 保留 VAD 边界和时间戳, 可以直接回放给 tcp_receiver.py.
+ *
+ * 写后缓冲: 采集侧只做 memcpy, 写满的缓冲区交给低优先级写任务; 每次写入文件的都是整块
+ * (AUDIO_RECORDER_BUFFER_SIZE, 扇区/簇对齐), 只有文件最后一块不满. 没有空闲缓冲区时整帧丢弃
+ * 并计数, 不会阻塞采集.
+ */
+#define AUDIO_RECORDER_BUFFER_SIZE      (16 * 1024)     // 32 个扇区, 等于 FAT 簇大小
+#define AUDIO_RECORDER_BUFFER_COUNT     2
+#define AUDIO_RECORDER_QUEUE_LEN        8
+#define AUDIO_RECORDER_TASK_PRIO        3
+#define AUDIO_RECORDER_PATH_MAX         32
+#define AUDIO_RECORDER_UPLOAD_CHUNK     4096
+
+#define AUDIO_RECORDER_FORMAT_WAV       0
+#define AUDIO_RECORDER_FORMAT_FRAMED    1
+
+#ifdef CONFIG_AUDIO_RECORDER_FORMAT_FRAMED
+#define AUDIO_RECORDER_FORMAT           AUDIO_RECORDER_FORMAT_FRAMED
+#else
+#define AUDIO_RECORDER_FORMAT           AUDIO_RECORDER_FORMAT_WAV
+#endif
+
+typedef struct {
+    uint32_t files;             // 完成的文件数
+    uint32_t bytes_written;     // 写入文件系统的字节数
+    uint32_t frames_dropped;    // 没有空闲缓冲区而丢弃的帧数
+    uint32_t write_errors;
+    uint32_t max_stall_us;      // 采集侧单次调用的最长耗时
+    uint32_t max_write_us;      // 文件系统单次写入的最长耗时
+    uint32_t files_uploaded;
+    uint32_t closes_dropped;    // 消息队列满而丢失的关闭请求, 文件保留流式头
+    uint32_t files_recovered;   // 没有收到关闭请求, 按流式头保存的文件
+} audio_recorder_stats_t;
+
+esp_err_t audio_recorder_init(int format);
+
+/**
+ * @brief 记录一帧 (由流发送路径调用), 只做内存拷贝, 不等待文件系统写入.
+ */
+esp_err_t audio_recorder_record_frame(const stream_frame_header_t *header, const void *payload, size_t len);
+
+bool audio_recorder_is_recording(void);
+bool audio_recorder_is_uploading(void);
+
+/**
+ * @brief 流和批量上传共用一个连接, 二者互斥. 流开始前调用 begin, 上传进行中返回
+ * ESP_ERR_INVALID_STATE; 流的最后一帧记录之后调用 end.
+ */
+esp_err_t audio_recorder_stream_begin(void);
+void audio_recorder_stream_end(void);
+
+/**
+ * @brief 批量上传: 通过当前连接把所有已完成的录音逐个作为分帧会话发送, 成功后删除.
+ * 流进行中返回 ESP_ERR_INVALID_STATE; UDP 模式下返回 ESP_ERR_NOT_SUPPORTED.
+ */
+esp_err_t audio_recorder_upload(void);
+
+/**
+ * @brief 后台上传一次: 等待连接可用后调用 audio_recorder_upload().
+ */
+esp_err_t audio_recorder_upload_start(void);
+
+esp_err_t audio_recorder_get_stats(audio_recorder_stats_t *stats);
+
+#endif // AUDIO_RECORDER_H
@@ -0,0 +1,127 @@
+#include <string.h>
+#include "audio_resample.h"
+#include "resample_tables.h"
+
+typedef struct {
+    uint32_t in_rate;
+    uint32_t out_rate;
+    int up;
+    int down;
+    int taps;
+    const int16_t *coef;
+} audio_resample_table_t;
+
+static const audio_resample_table_t audio_resample_tables[] = {
+    { 24000, 16000, RESAMPLE_3_2_L, RESAMPLE_3_2_M, RESAMPLE_3_2_TAPS, &resample_3_2_coef[0][0] },
+    { 16000,  8000, RESAMPLE_2_1_L, RESAMPLE_2_1_M, RESAMPLE_2_1_TAPS, &resample_2_1_coef[0][0] },
+    {  8000, 16000, RESAMPLE_1_2_L, RESAMPLE_1_2_M, RESAMPLE_1_2_TAPS, &resample_1_2_coef[0][0] },
+};
+
+/**
+ * @brief 定点 MAC: Q15 系数 x PCM16, 32 位累加 (每相系数和约为 1.0, 不会溢出).
+ * 按 4 展开, 编译器可以映射到 S3 的 MAC 指令; 抽头数都是 4 的倍数.
+ */
+static inline int32_t audio_resample_dot(const int16_t *x, const int16_t *h, int taps)
+{
+    int32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+    for (int i = 0; i < taps; i += 4)
+    {
+        acc0 += (int32_t)x[i] * h[i];
+        acc1 += (int32_t)x[i + 1] * h[i + 1];
+        acc2 += (int32_t)x[i + 2] * h[i + 2];
+        acc3 += (int32_t)x[i + 3] * h[i + 3];
+    }
+    return acc0 + acc1 + acc2 + acc3;
+}
+
+static inline int16_t audio_resample_round(int32_t acc)
+{
+    acc = (acc + (1 << 14)) >> 15;
+    if (acc > INT16_MAX)
+        return INT16_MAX;
+    if (acc < INT16_MIN)
+        return INT16_MIN;
+    return (int16_t)acc;
+}
+
+esp_err_t audio_resample_init(audio_resample_t *rs, uint32_t in_rate, uint32_t out_rate)
+{
+    if (rs == NULL)
+        return ESP_ERR_INVALID_ARG;
+
+    memset(rs, 0, sizeof(*rs));
+    rs->in_rate = in_rate;
+    rs->out_rate = out_rate;
+    if (in_rate == out_rate)
+    {
+        rs->up = 1;
+        rs->down = 1;
+        return ESP_OK;
+    }
+
+    for (size_t i = 0; i < sizeof(audio_resample_tables) / sizeof(audio_resample_tables[0]); i++)
+    {
+        const audio_resample_table_t *t = &audio_resample_tables[i];
+        if ((t->in_rate == in_rate) && (t->out_rate == out_rate))
+        {
+            rs->up = t->up;
+            rs->down = t->down;
+            rs->taps = t->taps;
+            rs->coef = t->coef;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+void audio_resample_reset(audio_resample_t *rs)
+{
+    memset(rs->history, 0, sizeof(rs->history));
+    rs->phase = 0;
+    rs->pos = 0;
+}
+
+int audio_resample_max_output(const audio_resample_t *rs, int in_samples)
+{
+    return (in_samples * rs->up + rs->down - 1) / rs->down + 1;
+}
+
+int audio_resample_process(audio_resample_t *rs, const int16_t *in, int in_samples,
+                           int16_t *out, int out_capacity)
+{
+    if (out_capacity < audio_resample_max_output(rs, in_samples))
+        return -1;
+
+    if (rs->coef == NULL)
+    {
+        memcpy(out, in, (size_t)in_samples * sizeof(int16_t));
+        return in_samples;
+    }
+
+    const int taps = rs->taps;
+    const int up = rs->up;
+    const int down = rs->down;
+    int phase = rs->phase;
+    int pos = rs->pos;
+    int produced = 0;
+
+    for (int i = 0; i < in_samples; i++)
+    {
+        // 双写: 写完后 history[pos .. pos+taps-1] 就是按时间顺序排列的最近 taps 个样本
+        rs->history[pos] = in[i];
+        rs->history[pos + taps] = in[i];
+        pos = (pos + 1 == taps) ? 0 : pos + 1;
+
+        const int16_t *window = &rs->history[pos];
+        while (phase < up)
+        {
+            out[produced++] = audio_resample_round(audio_resample_dot(window, rs->coef + phase * taps, taps));
+            phase += down;
+        }
+        phase -= up;
+    }
+
+    rs->phase = phase;
+    rs->pos = pos;
+    return produced;
+}
@@ -0,0 +1,43 @@
+#ifndef AUDIO_RESAMPLE_H
+#define AUDIO_RESAMPLE_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * 流式多相 FIR 重采样 (PCM16 单声道), 系数由 script/resample_tables.py 生成.
+ * 支持 24k->16k (3:2), 16k->8k (2:1), 8k->16k (1:2); 输入输出采样率相同时直通.
+ *
+ * 延迟线用 "双写" 方式保存最近 TAPS 个样本 (每个样本同时写在 pos 和 pos+TAPS),
+ * 任意时刻都有一段连续的窗口, 内循环是纯粹的 int16 x int16 -> int32 点积.
+ * 状态跨块保存, 输入块长度任意.
+ */
+#define AUDIO_RESAMPLE_MAX_TAPS     32
+
+typedef struct {
+    uint32_t in_rate;
+    uint32_t out_rate;
+    int up;                         // L
+    int down;                       // M
+    int taps;                       // 每相抽头数
+    const int16_t *coef;            // [up][taps]
+    int phase;                      // 下一个输出相对当前输入的上采样偏移
+    int pos;                        // 延迟线写位置
+    int16_t history[2 * AUDIO_RESAMPLE_MAX_TAPS] __attribute__((aligned(16)));
+} audio_resample_t;
+
+esp_err_t audio_resample_init(audio_resample_t *rs, uint32_t in_rate, uint32_t out_rate);
+void audio_resample_reset(audio_resample_t *rs);
+
+/**
+ * @brief 处理 in_samples 个输入样本所需的最大输出空间.
+ */
+int audio_resample_max_output(const audio_resample_t *rs, int in_samples);
+
+/**
+ * @brief 重采样一块数据, 返回输出样本数. out_capacity 不足时返回 -1 (不修改状态).
+ */
+int audio_resample_process(audio_resample_t *rs, const int16_t *in, int in_samples,
+                           int16_t *out, int out_capacity);
+
+#endif // AUDIO_RESAMPLE_H
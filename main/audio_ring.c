@@ -0,0 +1,113 @@
+#include <string.h>
+#include "audio_ring.h"
+
+esp_err_t audio_ring_init(audio_ring_t *ring, void *storage, size_t size)
+{
+    if ((ring == NULL) || (storage == NULL) || (size == 0) || ((size & (size - 1)) != 0))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ring->buffer = (uint8_t *)storage;
+    ring->size = size;
+    ring->mask = size - 1;
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    return ESP_OK;
+}
+
+// 仅在生产者和消费者都停止时调用
+void audio_ring_reset(audio_ring_t *ring)
+{
+    atomic_store_explicit(&ring->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&ring->tail, 0, memory_order_relaxed);
+}
+
+size_t audio_ring_used(audio_ring_t *ring)
+{
+    size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    return head - tail;
+}
+
+size_t audio_ring_free(audio_ring_t *ring)
+{
+    return ring->size - audio_ring_used(ring);
+}
+
+size_t audio_ring_write_span(audio_ring_t *ring, void **span)
+{
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    size_t offset = head & ring->mask;
+    size_t space = ring->size - (head - tail);
+    size_t contiguous = ring->size - offset;
+
+    *span = ring->buffer + offset;
+    return (space < contiguous) ? space : contiguous;
+}
+
+void audio_ring_write_commit(audio_ring_t *ring, size_t len)
+{
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    atomic_store_explicit(&ring->head, head + len, memory_order_release);
+}
+
+size_t audio_ring_read_span(audio_ring_t *ring, const void **span)
+{
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    size_t offset = tail & ring->mask;
+    size_t avail = head - tail;
+    size_t contiguous = ring->size - offset;
+
+    *span = ring->buffer + offset;
+    return (avail < contiguous) ? avail : contiguous;
+}
+
+void audio_ring_read_consume(audio_ring_t *ring, size_t len)
+{
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    atomic_store_explicit(&ring->tail, tail + len, memory_order_release);
+}
+
+size_t audio_ring_write(audio_ring_t *ring, const void *data, size_t len)
+{
+    const uint8_t *src = (const uint8_t *)data;
+    size_t total = 0;
+    void *span;
+
+    // 最多两段: 环尾部一段, 回绕后一段
+    for (int i = 0; (i < 2) && (total < len); i++)
+    {
+        size_t n = audio_ring_write_span(ring, &span);
+        if (n == 0)
+            break;
+        if (n > len - total)
+            n = len - total;
+        memcpy(span, src + total, n);
+        audio_ring_write_commit(ring, n);
+        total += n;
+    }
+    return total;
+}
+
+size_t audio_ring_read(audio_ring_t *ring, void *data, size_t len)
+{
+    uint8_t *dst = (uint8_t *)data;
+    size_t total = 0;
+    const void *span;
+
+    for (int i = 0; (i < 2) && (total < len); i++)
+    {
+        size_t n = audio_ring_read_span(ring, &span);
+        if (n == 0)
+            break;
+        if (n > len - total)
+            n = len - total;
+        memcpy(dst + total, span, n);
+        audio_ring_read_consume(ring, n);
+        total += n;
+    }
+    return total;
+}
@@ -0,0 +1,40 @@
+#ifndef AUDIO_RING_H
+#define AUDIO_RING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include "esp_err.h"
+
+/**
+ * 单生产者/单消费者 (SPSC) 无锁环形缓冲区.
+ *
+ * head 只由生产者写, tail 只由消费者写, 两者都是单调递增的字节计数,
+ * 用 size - 1 掩码得到实际偏移, 所以 size 必须是 2 的幂.
+ * span 接口返回连续可读/可写区域, 调用者可以直接把 DMA 或 send() 指向它,
+ * 完成后再 commit/consume 实际处理的字节数.
+ */
+typedef struct {
+    uint8_t *buffer;
+    size_t size;
+    size_t mask;
+    atomic_size_t head;
+    atomic_size_t tail;
+} audio_ring_t;
+
+esp_err_t audio_ring_init(audio_ring_t *ring, void *storage, size_t size);
+void audio_ring_reset(audio_ring_t *ring);
+size_t audio_ring_used(audio_ring_t *ring);
+size_t audio_ring_free(audio_ring_t *ring);
+
+// 拷贝接口: 返回实际写入/读出的字节数 (可能小于 len)
+size_t audio_ring_write(audio_ring_t *ring, const void *data, size_t len);
+size_t audio_ring_read(audio_ring_t *ring, void *data, size_t len);
+
+// 零拷贝接口: 返回连续区域长度, 0 表示满/空
+size_t audio_ring_write_span(audio_ring_t *ring, void **span);
+void audio_ring_write_commit(audio_ring_t *ring, size_t len);
+size_t audio_ring_read_span(audio_ring_t *ring, const void **span);
+void audio_ring_read_consume(audio_ring_t *ring, size_t len);
+
+#endif // AUDIO_RING_H
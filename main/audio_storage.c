@@ -0,0 +1,93 @@
+#include <errno.h>
+#include <sys/stat.h>
+#include "esp_log.h"
+#include "audio_storage.h"
+#ifndef CONFIG_IDF_TARGET_LINUX
+#include "esp_vfs_fat.h"
+#include "sdmmc_cmd.h"
+#include "driver/sdspi_host.h"
+#endif
+
+static const char *TAG = "AUDIO_STORAGE";
+
+#ifdef CONFIG_IDF_TARGET_LINUX
+
+esp_err_t audio_storage_mount(void)
+{
+    if ((mkdir(AUDIO_STORAGE_BASE_PATH, 0755) != 0) && (errno != EEXIST))
+    {
+        ESP_LOGE(TAG, "Failed to create %s: errno %d", AUDIO_STORAGE_BASE_PATH, errno);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t audio_storage_unmount(void)
+{
+    return ESP_OK;
+}
+
+#else
+
+static sdmmc_card_t *audio_storage_card = NULL;
+static sdmmc_host_t audio_storage_host = SDSPI_HOST_DEFAULT();
+
+esp_err_t audio_storage_mount(void)
+{
+    if (audio_storage_card != NULL)
+        return ESP_OK;
+
+    spi_bus_config_t bus_cfg = {
+        .mosi_io_num = AUDIO_STORAGE_SD_GPIO_MOSI,
+        .miso_io_num = AUDIO_STORAGE_SD_GPIO_MISO,
+        .sclk_io_num = AUDIO_STORAGE_SD_GPIO_SCLK,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+        .max_transfer_sz = AUDIO_STORAGE_ALLOCATION_UNIT,
+    };
+    esp_err_t err = spi_bus_initialize(audio_storage_host.slot, &bus_cfg, SDSPI_DEFAULT_DMA);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "spi_bus_initialize failed: %s", esp_err_to_name(err));
+        return err;
+    }
+
+    sdspi_device_config_t slot_cfg = SDSPI_DEVICE_CONFIG_DEFAULT();
+    slot_cfg.gpio_cs = AUDIO_STORAGE_SD_GPIO_CS;
+    slot_cfg.host_id = audio_storage_host.slot;
+
+    esp_vfs_fat_sdmmc_mount_config_t mount_cfg = {
+        .format_if_mount_failed = false,
+        .max_files = AUDIO_STORAGE_MAX_FILES,
+        .allocation_unit_size = AUDIO_STORAGE_ALLOCATION_UNIT,
+    };
+    err = esp_vfs_fat_sdspi_mount(AUDIO_STORAGE_BASE_PATH, &audio_storage_host, &slot_cfg, &mount_cfg,
+                                  &audio_storage_card);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to mount SD card: %s", esp_err_to_name(err));
+        spi_bus_free(audio_storage_host.slot);
+        return err;
+    }
+    ESP_LOGI(TAG, "SD card mounted at %s, %llu MB.", AUDIO_STORAGE_BASE_PATH,
+             ((uint64_t)audio_storage_card->csd.capacity * audio_storage_card->csd.sector_size) >> 20);
+    return ESP_OK;
+}
+
+esp_err_t audio_storage_unmount(void)
+{
+    if (audio_storage_card == NULL)
+        return ESP_OK;
+
+    esp_vfs_fat_sdcard_unmount(AUDIO_STORAGE_BASE_PATH, audio_storage_card);
+    spi_bus_free(audio_storage_host.slot);
+    audio_storage_card = NULL;
+    return ESP_OK;
+}
+
+#endif
+
+const char *audio_storage_base_path(void)
+{
+    return AUDIO_STORAGE_BASE_PATH;
+}
@@ -0,0 +1,31 @@
+#ifndef AUDIO_STORAGE_H
+#define AUDIO_STORAGE_H
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+/**
+ * 录音存储: 只负责挂载. 挂载后通过 VFS 用 POSIX 接口 (open/write/lseek/fsync/opendir) 访问,
+ * 所以录音模块在 Linux 上对着普通目录也能直接编译运行.
+ *
+ * 设备上使用 SPI 模式的 SD 卡 + FAT. 簇大小等于录音缓冲区大小, 每次写入都是整簇对齐的.
+ */
+#ifdef CONFIG_IDF_TARGET_LINUX
+#define AUDIO_STORAGE_BASE_PATH         "./sdcard"
+#else
+#include "driver/gpio.h"
+#define AUDIO_STORAGE_BASE_PATH         "/sdcard"
+#define AUDIO_STORAGE_SD_GPIO_MOSI      GPIO_NUM_11
+#define AUDIO_STORAGE_SD_GPIO_SCLK      GPIO_NUM_12
+#define AUDIO_STORAGE_SD_GPIO_MISO      GPIO_NUM_13
+#define AUDIO_STORAGE_SD_GPIO_CS        GPIO_NUM_10
+#endif
+
+#define AUDIO_STORAGE_MAX_FILES         4
+#define AUDIO_STORAGE_ALLOCATION_UNIT   (16 * 1024)
+
+esp_err_t audio_storage_mount(void);
+esp_err_t audio_storage_unmount(void);
+const char *audio_storage_base_path(void);
+
+#endif // AUDIO_STORAGE_H
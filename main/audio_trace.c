@@ -0,0 +1,200 @@
+#include <stdio.h>
+#include <stdatomic.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "audio_trace.h"
+#ifdef CONFIG_IDF_TARGET_LINUX
+// 主机模拟只有一个核
+#define audio_trace_core_id()   0
+#else
+#include "esp_cpu.h"
+#define audio_trace_core_id()   esp_cpu_get_core_id()
+#endif
+
+#ifndef CONFIG_AUDIO_TRACE_BINARY
+typedef struct {
+    const char *tag;
+    esp_log_level_t level;
+    const char *format;
+} audio_trace_format_t;
+
+static const audio_trace_format_t audio_trace_formats[AUDIO_TRACE_EVENT_MAX] = {
+#define AUDIO_TRACE_EVENT(name, tag, level, format) [AUDIO_TRACE_##name] = { tag, level, format },
+#include "audio_trace_events.h"
+#undef AUDIO_TRACE_EVENT
+};
+#endif
+
+// 展开一条记录: 文本模式按格式表打印, 时间戳是事件发生的时刻而不是打印的时刻
+static void audio_trace_emit(const audio_trace_record_t *record)
+{
+#ifdef CONFIG_AUDIO_TRACE_BINARY
+    printf(AUDIO_TRACE_BINARY_PREFIX "%08lx%04x%02x%02x%08lx%08lx%08lx\n", (unsigned long)record->timestamp_us,
+           record->id, record->nargs, record->core, (unsigned long)record->args[0],
+           (unsigned long)record->args[1], (unsigned long)record->args[2]);
+#else
+    char message[128];
+
+    if (record->id >= AUDIO_TRACE_EVENT_MAX)
+        return;
+    const audio_trace_format_t *format = &audio_trace_formats[record->id];
+    // 多余的参数会被忽略, 所有格式都按 3 个参数传
+    snprintf(message, sizeof(message), format->format, record->args[0], record->args[1], record->args[2]);
+    ESP_LOG_LEVEL(format->level, format->tag, "[%lu.%03lu] %s", (unsigned long)(record->timestamp_us / 1000),
+                  (unsigned long)(record->timestamp_us % 1000), message);
+#endif
+}
+
+#ifdef CONFIG_AUDIO_TRACE
+
+static const char *TAG = "AUDIO_TRACE";
+
+typedef struct {
+    atomic_uint seq;                    // 槽位序号 + 1, 写完最后更新; 0 表示正在写
+    audio_trace_record_t record;
+} audio_trace_slot_t;
+
+typedef struct {
+    audio_trace_slot_t slots[AUDIO_TRACE_RING_RECORDS];
+    atomic_uint head;                   // 已预留的记录总数
+    uint32_t tail;                      // 已展开的记录总数, 只由 audio_trace_flush() 访问
+} audio_trace_ring_t;
+
+static audio_trace_ring_t audio_trace_rings[portNUM_PROCESSORS];
+static SemaphoreHandle_t audio_trace_mutex = NULL;
+
+void audio_trace_event(uint16_t id, uint8_t nargs, uint32_t a0, uint32_t a1, uint32_t a2)
+{
+    uint32_t core = audio_trace_core_id();
+    audio_trace_ring_t *ring = &audio_trace_rings[core];
+    uint32_t index = atomic_fetch_add_explicit(&ring->head, 1, memory_order_relaxed);
+    audio_trace_slot_t *slot = &ring->slots[index & (AUDIO_TRACE_RING_RECORDS - 1)];
+
+    // 先标记正在写: 读者看到 0 或旧序号就不会取走半条记录
+    atomic_store_explicit(&slot->seq, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    slot->record.timestamp_us = (uint32_t)esp_timer_get_time();
+    slot->record.id = id;
+    slot->record.nargs = nargs;
+    slot->record.core = (uint8_t)core;
+    slot->record.args[0] = a0;
+    slot->record.args[1] = a1;
+    slot->record.args[2] = a2;
+    atomic_store_explicit(&slot->seq, index + 1, memory_order_release);
+}
+
+static void audio_trace_drain(audio_trace_ring_t *ring, uint32_t core)
+{
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    uint32_t lost = 0;
+    audio_trace_record_t record;
+
+    if (head - ring->tail > AUDIO_TRACE_RING_RECORDS)
+    {
+        lost = head - ring->tail - AUDIO_TRACE_RING_RECORDS;
+        ring->tail = head - AUDIO_TRACE_RING_RECORDS;
+    }
+
+    while (ring->tail != head)
+    {
+        audio_trace_slot_t *slot = &ring->slots[ring->tail & (AUDIO_TRACE_RING_RECORDS - 1)];
+        uint32_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+
+        if (seq != ring->tail + 1)
+        {
+            // 0 或更旧的序号: 写入者已预留但还没写完, 下次再取; 更新的序号: 已被覆盖
+            if ((seq == 0) || ((int32_t)(seq - (ring->tail + 1)) < 0))
+                break;
+            lost++;
+            ring->tail++;
+            continue;
+        }
+
+        record = slot->record;
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&slot->seq, memory_order_relaxed) != seq)
+        {
+            lost++;
+            ring->tail++;
+            continue;
+        }
+        ring->tail++;
+        audio_trace_emit(&record);
+    }
+
+    if (lost)
+    {
+        record = (audio_trace_record_t){
+            .timestamp_us = (uint32_t)esp_timer_get_time(),
+            .id = AUDIO_TRACE_TRACE_LOST,
+            .nargs = 2,
+            .core = (uint8_t)core,
+            .args = { lost, core },
+        };
+        audio_trace_emit(&record);
+    }
+}
+
+void audio_trace_flush(void)
+{
+    if (audio_trace_mutex == NULL)
+        return;
+
+    xSemaphoreTake(audio_trace_mutex, portMAX_DELAY);
+    for (uint32_t core = 0; core < portNUM_PROCESSORS; core++)
+        audio_trace_drain(&audio_trace_rings[core], core);
+    xSemaphoreGive(audio_trace_mutex);
+}
+
+static void audio_trace_task(void *arg)
+{
+    while (1)
+    {
+        vTaskDelay(pdMS_TO_TICKS(AUDIO_TRACE_FLUSH_MS));
+        audio_trace_flush();
+    }
+}
+
+esp_err_t audio_trace_init(void)
+{
+    if (audio_trace_mutex != NULL)
+        return ESP_OK;
+
+    audio_trace_mutex = xSemaphoreCreateMutex();
+    if (audio_trace_mutex == NULL)
+        return ESP_ERR_NO_MEM;
+    if (xTaskCreate(audio_trace_task, "AudioTraceTask", 3072, NULL, AUDIO_TRACE_TASK_PRIO, NULL) != pdPASS)
+    {
+        ESP_LOGE(TAG, "Failed to create trace task.");
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+#else
+
+void audio_trace_event(uint16_t id, uint8_t nargs, uint32_t a0, uint32_t a1, uint32_t a2)
+{
+    audio_trace_record_t record = {
+        .timestamp_us = (uint32_t)esp_timer_get_time(),
+        .id = id,
+        .nargs = nargs,
+        .core = (uint8_t)audio_trace_core_id(),
+        .args = { a0, a1, a2 },
+    };
+    audio_trace_emit(&record);
+}
+
+void audio_trace_flush(void)
+{
+}
+
+esp_err_t audio_trace_init(void)
+{
+    return ESP_OK;
+}
+
+#endif
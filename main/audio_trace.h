@@ -0,0 +1,54 @@
+#ifndef AUDIO_TRACE_H
+#define AUDIO_TRACE_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+/**
+ * 延迟的二进制跟踪: 热路径上只把 (事件 ID, 时间戳, 最多 3 个整数参数) 写进当前核的环形缓冲,
+ * 不做任何格式化, 也不碰 UART. 低优先级的后台任务把记录按 audio_trace_events.h 的格式表展开打印,
+ * 或者 (CONFIG_AUDIO_TRACE_BINARY) 原样输出为 "@T" 十六进制行, 由 script/trace_decode.py 在主机上展开.
+ *
+ * 每个核一个环, 写入者用原子加预留槽位, 多个任务和中断可以同时写. 环满时覆盖最旧的记录,
+ * 后台任务发现被覆盖时输出一条 TRACE_LOST.
+ * 关闭 CONFIG_AUDIO_TRACE 时退回到调用处直接格式化打印 (与 ESP_LOG 相同的开销).
+ */
+#define AUDIO_TRACE_MAX_ARGS            3
+#define AUDIO_TRACE_RING_RECORDS        256     // 每个核, 2 的幂
+#define AUDIO_TRACE_FLUSH_MS            50
+#define AUDIO_TRACE_TASK_PRIO           1
+#define AUDIO_TRACE_BINARY_PREFIX       "@T"
+
+typedef enum {
+#define AUDIO_TRACE_EVENT(name, tag, level, format) AUDIO_TRACE_##name,
+#include "audio_trace_events.h"
+#undef AUDIO_TRACE_EVENT
+    AUDIO_TRACE_EVENT_MAX,
+} audio_trace_id_t;
+
+#pragma pack(1)
+// 二进制输出的记录格式 (小端, 20 字节), 与 script/trace_decode.py 保持一致
+typedef struct {
+    uint32_t timestamp_us;              // esp_timer 时间的低 32 位
+    uint16_t id;
+    uint8_t nargs;
+    uint8_t core;
+    uint32_t args[AUDIO_TRACE_MAX_ARGS];
+} audio_trace_record_t;
+#pragma pack()
+
+#define AUDIO_TRACE0(name)              audio_trace_event(AUDIO_TRACE_##name, 0, 0, 0, 0)
+#define AUDIO_TRACE1(name, a)           audio_trace_event(AUDIO_TRACE_##name, 1, (uint32_t)(a), 0, 0)
+#define AUDIO_TRACE2(name, a, b)        audio_trace_event(AUDIO_TRACE_##name, 2, (uint32_t)(a), (uint32_t)(b), 0)
+#define AUDIO_TRACE3(name, a, b, c)     audio_trace_event(AUDIO_TRACE_##name, 3, (uint32_t)(a), (uint32_t)(b), (uint32_t)(c))
+
+esp_err_t audio_trace_init(void);
+void audio_trace_event(uint16_t id, uint8_t nargs, uint32_t a0, uint32_t a1, uint32_t a2);
+
+/**
+ * @brief 立即展开所有已提交的记录 (后台任务也调用它), 例如在 abort() 之前.
+ */
+void audio_trace_flush(void);
+
+#endif // AUDIO_TRACE_H
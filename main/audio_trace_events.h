@@ -0,0 +1,31 @@
+// 跟踪事件表 (X-macro), 不加头文件保护: audio_trace.h 用它生成事件 ID, audio_trace.c 生成格式表,
+// script/trace_decode.py 解析同一个文件还原二进制记录. 只在末尾追加新事件, 已有事件的顺序就是 ID.
+//
+// AUDIO_TRACE_EVENT(名字, 模块 TAG, 日志级别, 格式)
+// 格式最多 3 个参数, 只用 %u %d %x (参数都按 32 位记录).
+
+AUDIO_TRACE_EVENT(TRACE_LOST,           "AUDIO_TRACE",      ESP_LOG_WARN,   "%u trace records lost on core %u")
+AUDIO_TRACE_EVENT(BUTTON_PRESSED,       "APPLICATION",      ESP_LOG_WARN,   ">>> Button %u (GPIO %u) Pressed!")
+AUDIO_TRACE_EVENT(CLIP_NO_BUFFER,       "APPLICATION",      ESP_LOG_WARN,   "No free clip buffer, previous clips are still being published.")
+AUDIO_TRACE_EVENT(CLIP_READ,            "APPLICATION",      ESP_LOG_INFO,   "Success read %u samples!")
+AUDIO_TRACE_EVENT(CLIP_PLAYED,          "APPLICATION",      ESP_LOG_INFO,   "Success play %u samples!")
+AUDIO_TRACE_EVENT(CLIP_CONVERTED,       "APPLICATION",      ESP_LOG_INFO,   "Success convert %u samples!")
+AUDIO_TRACE_EVENT(CLIP_QUEUED,          "APPLICATION",      ESP_LOG_INFO,   "Queued %u bytes for publishing!")
+AUDIO_TRACE_EVENT(I2S_READ_SHORT,       "I2S_AUDIO",        ESP_LOG_WARN,   "Read data: expected %u bytes, got %u bytes")
+AUDIO_TRACE_EVENT(I2S_WRITE_SHORT,      "I2S_AUDIO",        ESP_LOG_WARN,   "Write data: Wrote %u bytes, expected %u bytes.")
+AUDIO_TRACE_EVENT(HISTORY_READ_SHORT,   "I2S_AUDIO",        ESP_LOG_WARN,   "History read: expected %u bytes, got %u bytes")
+AUDIO_TRACE_EVENT(STREAM_SEND_FAILED,   "I2S_AUDIO",        ESP_LOG_ERROR,  "Send data: expected %u bytes, sent %d bytes")
+AUDIO_TRACE_EVENT(STREAM_PROGRESS,      "I2S_AUDIO",        ESP_LOG_INFO,   "Successfully sent %u samples, %u overruns!")
+AUDIO_TRACE_EVENT(SPEAKER_TIMEOUT,      "AUDIO_PLAYBACK",   ESP_LOG_WARN,   "Speaker write timed out.")
+AUDIO_TRACE_EVENT(SOCKET_SEND_ERROR,    "NETWORK_SOCKET",   ESP_LOG_ERROR,  "Error occurred during sending: %d")
+AUDIO_TRACE_EVENT(SOCKET_NOT_CONNECTED, "NETWORK_SOCKET",   ESP_LOG_ERROR,  "Socket is not initialized or connected.")
+AUDIO_TRACE_EVENT(UDP_DROPPED,          "NETWORK_SOCKET",   ESP_LOG_WARN,   "Datagram dropped (%d), %u so far.")
+AUDIO_TRACE_EVENT(PUBLISH_FAILED,       "NETWORK_SOCKET",   ESP_LOG_ERROR,  "Transmission failed or incomplete!")
+AUDIO_TRACE_EVENT(PUBLISHED,            "NETWORK_SOCKET",   ESP_LOG_INFO,   "Published %u bytes: queued %u ms, sent in %u ms.")
+AUDIO_TRACE_EVENT(PUBLISH_QUEUE_FULL,   "NETWORK_SOCKET",   ESP_LOG_ERROR,  "Publish queue full, dropping %u bytes.")
+AUDIO_TRACE_EVENT(BUTTON_EVENT,         "GPIO_BUTTON",      ESP_LOG_INFO,   "Button %u event %u detected %u ms after the first edge.")
+AUDIO_TRACE_EVENT(BUTTON_ACTION_START,  "GPIO_BUTTON",      ESP_LOG_INFO,   "Button %u event %u action started %u us after the first edge.")
+AUDIO_TRACE_EVENT(BUTTON_ACTION_DONE,   "GPIO_BUTTON",      ESP_LOG_INFO,   "Button %u event %u action finished in %u ms.")
+AUDIO_TRACE_EVENT(BUTTON_ACTION_DROPPED, "GPIO_BUTTON",     ESP_LOG_WARN,   "Button %u event %u dropped, the same action is still running.")
+AUDIO_TRACE_EVENT(BUTTON_ACTION_CANCEL, "GPIO_BUTTON",      ESP_LOG_WARN,   "Button %u event %u cancels the running action.")
+AUDIO_TRACE_EVENT(CLIP_CANCELLED,       "APPLICATION",      ESP_LOG_WARN,   "Clip cancelled after %u ms.")
@@ -0,0 +1,111 @@
+#include <string.h>
+#include "audio_vad.h"
+
+void audio_vad_default_config(audio_vad_config_t *config)
+{
+    config->hangover_blocks = AUDIO_VAD_DEFAULT_HANGOVER;
+    config->preroll_blocks = AUDIO_VAD_DEFAULT_PREROLL;
+    config->ratio_q4 = AUDIO_VAD_DEFAULT_RATIO_Q4;
+    config->min_energy = AUDIO_VAD_DEFAULT_MIN_ENERGY;
+    config->use_zcr = true;
+    config->zcr_max_q8 = AUDIO_VAD_DEFAULT_ZCR_MAX_Q8;
+}
+
+esp_err_t audio_vad_init(audio_vad_t *vad, const audio_vad_config_t *config)
+{
+    if ((config->preroll_blocks < 0) || (config->preroll_blocks > AUDIO_VAD_MAX_PREROLL) ||
+        (config->hangover_blocks < 0))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    vad->config = *config;
+    audio_vad_reset(vad);
+    return ESP_OK;
+}
+
+void audio_vad_reset(audio_vad_t *vad)
+{
+    vad->noise_floor = vad->config.min_energy;
+    vad->last_energy = 0;
+    vad->last_zcr_q8 = 0;
+    vad->hangover = 0;
+    vad->speech = false;
+    vad->primed = false;
+    vad->prime_blocks = 0;
+    vad->prime_min = UINT32_MAX;
+}
+
+audio_vad_event_t audio_vad_process(audio_vad_t *vad, const int16_t *pcm, int samples)
+{
+    const audio_vad_config_t *cfg = &vad->config;
+    uint64_t sum = 0;
+    uint32_t crossings = 0;
+    bool active;
+
+    if (samples <= 0)
+        return AUDIO_VAD_EVENT_NONE;
+
+    // 单次遍历: 能量 (均方) 与过零次数
+    for (int i = 0; i < samples; i++)
+    {
+        int32_t s = pcm[i];
+        sum += (uint32_t)(s * s);
+        if (i > 0)
+            crossings += ((pcm[i - 1] ^ pcm[i]) < 0);
+    }
+    vad->last_energy = (uint32_t)(sum / samples);
+    vad->last_zcr_q8 = (crossings << 8) / samples;
+
+    active = (vad->last_energy >= cfg->min_energy) &&
+             ((uint64_t)vad->last_energy * 16 >= (uint64_t)vad->noise_floor * cfg->ratio_q4);
+    if (active && cfg->use_zcr && (vad->last_zcr_q8 > (vad->primed ? cfg->zcr_max_q8 : AUDIO_VAD_PRIME_ZCR_MAX_Q8)))
+        active = false;
+
+    if (!vad->primed)
+    {
+        // 第一个非语音块初始化噪声底; 一直是 "语音" (持续的低频噪声或不停顿地说话) 时取最小的块
+        if (vad->last_energy < vad->prime_min)
+            vad->prime_min = vad->last_energy;
+        if (!active || (++vad->prime_blocks >= AUDIO_VAD_PRIME_BLOCKS))
+        {
+            vad->noise_floor = active ? vad->prime_min : vad->last_energy;
+            vad->primed = true;
+        }
+    }
+    // 噪声底只在非语音块上更新: 下降快 (1/4), 上升慢 (1/32)
+    else if (!active)
+    {
+        if (vad->last_energy < vad->noise_floor)
+            vad->noise_floor -= (vad->noise_floor - vad->last_energy) >> 2;
+        else
+            vad->noise_floor += (vad->last_energy - vad->noise_floor) >> 5;
+    }
+
+    if (active)
+    {
+        vad->hangover = cfg->hangover_blocks;
+        if (!vad->speech)
+        {
+            vad->speech = true;
+            return AUDIO_VAD_EVENT_START;
+        }
+        return AUDIO_VAD_EVENT_NONE;
+    }
+
+    if (vad->speech)
+    {
+        if (vad->hangover > 0)
+        {
+            vad->hangover--;
+            return AUDIO_VAD_EVENT_NONE;
+        }
+        vad->speech = false;
+        return AUDIO_VAD_EVENT_END;
+    }
+    return AUDIO_VAD_EVENT_NONE;
+}
+
+bool audio_vad_is_speech(const audio_vad_t *vad)
+{
+    return vad->speech;
+}
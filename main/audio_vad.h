@@ -0,0 +1,57 @@
+#ifndef AUDIO_VAD_H
+#define AUDIO_VAD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#define AUDIO_VAD_DEFAULT_HANGOVER      8       // 静音判定前保持的块数 (8 x 64ms)
+#define AUDIO_VAD_DEFAULT_PREROLL       4       // 起点前补发的块数
+#define AUDIO_VAD_MAX_PREROLL           6
+#define AUDIO_VAD_DEFAULT_RATIO_Q4      64      // 能量需高于噪声底 4 倍 (Q4), 约 6dB
+#define AUDIO_VAD_DEFAULT_MIN_ENERGY    2500    // 绝对能量下限 (约 50 LSB RMS)
+#define AUDIO_VAD_DEFAULT_ZCR_MAX_Q8    128     // 过零率上限 0.5 (Q8), 超过视为宽带噪声
+#define AUDIO_VAD_PRIME_ZCR_MAX_Q8      48      // 噪声底未知时只认浊音样的块 (过零率 < 0.19)
+#define AUDIO_VAD_PRIME_BLOCKS          16      // 约 1s 内没有静音块时, 用其中能量最小的块作噪声底
+
+typedef enum {
+    AUDIO_VAD_EVENT_NONE = 0,
+    AUDIO_VAD_EVENT_START,          // 本块为语音段第一块
+    AUDIO_VAD_EVENT_END,            // 上一块为语音段最后一块, 本块已是静音
+} audio_vad_event_t;
+
+typedef struct {
+    int hangover_blocks;
+    int preroll_blocks;
+    uint32_t ratio_q4;
+    uint32_t min_energy;
+    bool use_zcr;
+    uint32_t zcr_max_q8;
+} audio_vad_config_t;
+
+typedef struct {
+    audio_vad_config_t config;
+    uint32_t noise_floor;
+    uint32_t last_energy;
+    uint32_t last_zcr_q8;
+    int hangover;
+    bool speech;
+    bool primed;                    // 噪声底已由静音块初始化
+    int prime_blocks;
+    uint32_t prime_min;
+} audio_vad_t;
+
+void audio_vad_default_config(audio_vad_config_t *config);
+esp_err_t audio_vad_init(audio_vad_t *vad, const audio_vad_config_t *config);
+void audio_vad_reset(audio_vad_t *vad);
+
+/**
+ * @brief 处理一个 PCM16 块, 更新自适应噪声底和语音状态.
+ * 门控的流通常从用户已经开口说话开始, 所以噪声底不从第一块初始化: 先假定为 min_energy,
+ * 由第一个非语音块初始化; 在此之前只有浊音样的块 (低过零率) 算语音, 避免噪声开门.
+ * @return 状态变化事件; 当前是否处于语音段用 audio_vad_is_speech() 查询.
+ */
+audio_vad_event_t audio_vad_process(audio_vad_t *vad, const int16_t *pcm, int samples);
+bool audio_vad_is_speech(const audio_vad_t *vad);
+
+#endif // AUDIO_VAD_H
@@ -1,8 +1,10 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
 #include "freertos/task.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include "audio_trace.h"
 #include "gpio_button.h"
 
 static const char *TAG = "GPIO_BUTTON";
@@ -22,90 +24,325 @@ void gpio_button_2_default_callback(uint8_t gpio_num)
     ESP_LOGW(TAG, ">>> Button 2 (GPIO %d) Pressed! - Executing action C.", gpio_num);
 }
 
+typedef enum {
+    BUTTON_STATE_IDLE = 0,
+    BUTTON_STATE_PRESS_DEBOUNCE,
+    BUTTON_STATE_PRESSED,               // 已确认按下, 等松开或长按超时
+    BUTTON_STATE_RELEASE_DEBOUNCE,
+    BUTTON_STATE_WAIT_DOUBLE,           // 单击已松开, 等第二次按下
+} button_state_t;
+
+// 每个按键的手势状态机, 只在按键任务中访问
+typedef struct {
+    button_state_t state;
+    int64_t deadline_us;                // 当前状态的定时, 0 表示没有
+    int64_t first_edge_us;              // 本次手势的第一个下降沿, 动作延迟从这里算
+    int64_t release_us;
+    bool second_click;
+    bool fired;                         // 这次按下已经触发过事件 (按下即触发 / 长按 / 双击)
+} button_fsm_t;
+
+// 每个按键的动作槽: 同一按键同时最多一个动作在执行, 一个在排队, 一个等执行中的动作结束
+typedef struct {
+    button_callback_t func[BUTTON_EVENT_MAX];
+    button_action_policy_t policy[BUTTON_EVENT_MAX];
+    int queued_event;                   // -1 表示没有
+    int running_event;
+    int pending_event;
+    int64_t queued_edge_us;
+    int64_t pending_edge_us;
+    volatile bool cancel;
+} button_action_t;
+
 static QueueHandle_t button_event_queue = NULL;
+static QueueHandle_t button_action_queue = NULL;
+static SemaphoreHandle_t button_action_mutex = NULL;
 static const gpio_num_t button_gpios[GPIO_BUTTON_NUM] = {GPIO_BUTTON_0, GPIO_BUTTON_1, GPIO_BUTTON_2};
-static uint64_t last_press_time_ms[GPIO_BUTTON_NUM] = {0};
-static button_callback_t gpio_callback_func[GPIO_BUTTON_NUM] =
-{gpio_button_0_default_callback, gpio_button_1_default_callback, gpio_button_2_default_callback};
+static button_fsm_t button_fsms[GPIO_BUTTON_NUM];
+static button_action_t button_actions[GPIO_BUTTON_NUM] = {
+    { .func = { gpio_button_0_default_callback } },
+    { .func = { gpio_button_1_default_callback } },
+    { .func = { gpio_button_2_default_callback } },
+};
 
 /**
  * @brief GPIO Interrupt Service Routine (ISR)
  * NOTE: This runs in an interrupt context (high priority), keep it short!
- * It only queues the event; actual processing is done in the task.
+ * It only queues the edge; debouncing and gesture detection are done in the task.
  */
 static void IRAM_ATTR gpio_isr_handler(void* arg)
 {
-    uint32_t gpio_num = (uint32_t) arg;
-    
-    // Check if the current reading is 'pressed' (Active-Low)
-    if (gpio_get_level((gpio_num_t)gpio_num) == BUTTON_PRESSED) {
-        
-        button_event_t event = {
-            .gpio_num = (uint8_t)gpio_num,
-            // Use time since boot for simple tracking
-            .press_time_ms = (uint32_t)(esp_timer_get_time() / 1000)
-        };
-        
-        // Send the event to the queue from the ISR
-        xQueueSendFromISR(button_event_queue, &event, NULL);
+    uint32_t gpio_num = (uint32_t)(uintptr_t) arg;
+    BaseType_t task_woken = pdFALSE;
+
+    button_event_t event = {
+        .gpio_num = (uint8_t)gpio_num,
+        .level = (uint8_t)gpio_get_level((gpio_num_t)gpio_num),
+        .edge_time_us = esp_timer_get_time()
+    };
+
+    // Send the edge to the queue and switch to the button task right away instead of on the next tick
+    xQueueSendFromISR(button_event_queue, &event, &task_woken);
+    portYIELD_FROM_ISR(task_woken);
+}
+
+static int gpio_button_index(uint8_t gpio_num)
+{
+    for (int i = 0; i < GPIO_BUTTON_NUM; i++)
+    {
+        if (button_gpios[i] == gpio_num)
+            return i;
+    }
+    return -1;
+}
+
+/**
+ * @brief 把事件交给执行任务. 只改动作槽, 不等待, 按键任务不会被动作阻塞.
+ */
+static void gpio_button_submit(int index, button_event_type_t event, int64_t first_edge_us)
+{
+    button_action_t *action = &button_actions[index];
+
+    AUDIO_TRACE3(BUTTON_EVENT, index, event, (uint32_t)((esp_timer_get_time() - first_edge_us) / 1000));
+    if (action->func[event] == NULL)
+        return;
+
+    xSemaphoreTake(button_action_mutex, portMAX_DELAY);
+    if (action->queued_event >= 0)
+    {
+        // 还没开始执行: 合并成最新的一次
+        action->queued_event = event;
+        action->queued_edge_us = first_edge_us;
+    }
+    else if (action->running_event < 0)
+    {
+        action->queued_event = event;
+        action->queued_edge_us = first_edge_us;
+        xQueueSend(button_action_queue, &index, 0);
+    }
+    else if (action->policy[event] == BUTTON_ACTION_RESTART)
+    {
+        AUDIO_TRACE2(BUTTON_ACTION_CANCEL, index, event);
+        action->cancel = true;
+        action->pending_event = event;
+        action->pending_edge_us = first_edge_us;
+    }
+    else if (action->running_event == (int)event)
+    {
+        AUDIO_TRACE2(BUTTON_ACTION_DROPPED, index, event);
+    }
+    else
+    {
+        action->pending_event = event;
+        action->pending_edge_us = first_edge_us;
+    }
+    xSemaphoreGive(button_action_mutex);
+}
+
+/**
+ * @brief 动作执行任务. 执行队列里每个按键最多出现一次, 所以同一按键的动作不会并行.
+ */
+static void gpio_button_worker_task(void* arg)
+{
+    int index;
+
+    while (1) {
+        if (xQueueReceive(button_action_queue, &index, portMAX_DELAY) != pdPASS)
+            continue;
+
+        button_action_t *action = &button_actions[index];
+        xSemaphoreTake(button_action_mutex, portMAX_DELAY);
+        int event = action->queued_event;
+        int64_t edge_us = action->queued_edge_us;
+        button_callback_t func = action->func[event];
+        action->queued_event = -1;
+        action->running_event = event;
+        action->cancel = false;
+        xSemaphoreGive(button_action_mutex);
+
+        int64_t start_us = esp_timer_get_time();
+        AUDIO_TRACE3(BUTTON_ACTION_START, index, event, (uint32_t)(start_us - edge_us));
+        if (func != NULL)
+            func(button_gpios[index]);
+        AUDIO_TRACE3(BUTTON_ACTION_DONE, index, event, (uint32_t)((esp_timer_get_time() - start_us) / 1000));
+
+        xSemaphoreTake(button_action_mutex, portMAX_DELAY);
+        action->running_event = -1;
+        if (action->pending_event >= 0)
+        {
+            action->queued_event = action->pending_event;
+            action->queued_edge_us = action->pending_edge_us;
+            action->pending_event = -1;
+            xQueueSend(button_action_queue, &index, 0);
+        }
+        xSemaphoreGive(button_action_mutex);
+    }
+}
+
+static void gpio_button_fire(int index, button_event_type_t event)
+{
+    button_fsms[index].fired = true;
+    gpio_button_submit(index, event, button_fsms[index].first_edge_us);
+}
+
+static void gpio_button_on_edge(int index, const button_event_t *event)
+{
+    button_fsm_t *fsm = &button_fsms[index];
+    bool pressed = (event->level == BUTTON_PRESSED);
+
+    switch (fsm->state) {
+    case BUTTON_STATE_IDLE:
+        if (!pressed)
+            break;
+        fsm->first_edge_us = event->edge_time_us;
+        fsm->second_click = false;
+        fsm->state = BUTTON_STATE_PRESS_DEBOUNCE;
+        fsm->deadline_us = event->edge_time_us + DEBOUNCE_TIME_MS * 1000;
+        break;
+    case BUTTON_STATE_WAIT_DOUBLE:
+        if (!pressed)
+            break;
+        fsm->second_click = true;
+        fsm->state = BUTTON_STATE_PRESS_DEBOUNCE;
+        fsm->deadline_us = event->edge_time_us + DEBOUNCE_TIME_MS * 1000;
+        break;
+    case BUTTON_STATE_PRESSED:
+        if (pressed)
+            break;
+        fsm->state = BUTTON_STATE_RELEASE_DEBOUNCE;
+        fsm->deadline_us = event->edge_time_us + DEBOUNCE_TIME_MS * 1000;
+        break;
+    case BUTTON_STATE_PRESS_DEBOUNCE:
+    case BUTTON_STATE_RELEASE_DEBOUNCE:
+        // 抖动: 从最后一个边沿重新计时, 到时再读一次电平
+        fsm->deadline_us = event->edge_time_us + DEBOUNCE_TIME_MS * 1000;
+        break;
+    }
+}
+
+static void gpio_button_on_timeout(int index, int64_t now_us)
+{
+    button_fsm_t *fsm = &button_fsms[index];
+    const button_action_t *action = &button_actions[index];
+    bool pressed = (gpio_get_level(button_gpios[index]) == BUTTON_PRESSED);
+    // 没有长按和双击动作时按下即触发, 不必等松开
+    bool gestures = (action->func[BUTTON_EVENT_LONG_PRESS] != NULL) || (action->func[BUTTON_EVENT_DOUBLE_CLICK] != NULL);
+
+    fsm->deadline_us = 0;
+    switch (fsm->state) {
+    case BUTTON_STATE_PRESS_DEBOUNCE:
+        if (!pressed)
+        {
+            // 毛刺, 回到原来的状态
+            fsm->state = fsm->second_click ? BUTTON_STATE_WAIT_DOUBLE : BUTTON_STATE_IDLE;
+            if (fsm->second_click)
+                fsm->deadline_us = fsm->release_us + DOUBLE_CLICK_TIME_MS * 1000;
+            break;
+        }
+        fsm->state = BUTTON_STATE_PRESSED;
+        fsm->fired = false;
+        if (fsm->second_click)
+            gpio_button_fire(index, BUTTON_EVENT_DOUBLE_CLICK);
+        else if (!gestures)
+            gpio_button_fire(index, BUTTON_EVENT_PRESS);
+        else if (action->func[BUTTON_EVENT_LONG_PRESS] != NULL)
+            fsm->deadline_us = fsm->first_edge_us + LONG_PRESS_TIME_MS * 1000;
+        break;
+    case BUTTON_STATE_PRESSED:
+        gpio_button_fire(index, BUTTON_EVENT_LONG_PRESS);
+        break;
+    case BUTTON_STATE_RELEASE_DEBOUNCE:
+        if (pressed)
+        {
+            fsm->state = BUTTON_STATE_PRESSED;
+            if (!fsm->fired && (action->func[BUTTON_EVENT_LONG_PRESS] != NULL))
+                fsm->deadline_us = fsm->first_edge_us + LONG_PRESS_TIME_MS * 1000;
+            break;
+        }
+        fsm->release_us = now_us;
+        fsm->state = BUTTON_STATE_IDLE;
+        if (fsm->fired)
+            break;
+        if (action->func[BUTTON_EVENT_DOUBLE_CLICK] != NULL)
+        {
+            fsm->state = BUTTON_STATE_WAIT_DOUBLE;
+            fsm->deadline_us = now_us + DOUBLE_CLICK_TIME_MS * 1000;
+        }
+        else
+        {
+            gpio_button_fire(index, BUTTON_EVENT_PRESS);
+        }
+        break;
+    case BUTTON_STATE_WAIT_DOUBLE:
+        fsm->state = BUTTON_STATE_IDLE;
+        gpio_button_fire(index, BUTTON_EVENT_PRESS);
+        break;
+    case BUTTON_STATE_IDLE:
+        break;
     }
 }
 
 /**
- * @brief Dedicated FreeRTOS task to handle button events and debounce.
+ * @brief Button task: runs the per-button state machines.
+ * It waits for edges from the ISR with the nearest state deadline as timeout, so debounce,
+ * long-press and double-click windows are all timer driven. Actions never run here.
  */
 static void gpio_button_task(void* arg)
 {
     button_event_t event;
-    int button_index = -1;
-    uint64_t current_time_ms;
-    
+
     ESP_LOGI(TAG, "Button processing task started.");
 
     while (1) {
-        // Wait forever (or a timeout) for a button event from the ISR
-        if (xQueueReceive(button_event_queue, &event, portMAX_DELAY) == pdPASS) {
-            
-            // 1. Find the index of the button that generated the interrupt
-            for(int i = 0; i < GPIO_BUTTON_NUM; i++) {
-                if(button_gpios[i] == event.gpio_num) {
-                    button_index = i;
-                    break;
-                }
-            }
-
-            if (button_index == -1) continue; // Should not happen
-
-            // 2. Perform Software Debouncing Check
-            current_time_ms = esp_timer_get_time() / 1000;
-            
-            // Check if enough time has passed since the last stable press for this button
-            if (current_time_ms - last_press_time_ms[button_index] > DEBOUNCE_TIME_MS)
-            {
-                // 3. Final Check (Reading the GPIO again in the task context)
-                // This confirms the state is still active after the delay.
-                if (gpio_get_level(event.gpio_num) == BUTTON_PRESSED)
-                {
-                    gpio_callback_func[button_index](event.gpio_num);
-                    // Update the stable press time
-                    last_press_time_ms[button_index] = current_time_ms;
-                }
-            }
+        int64_t next_us = 0;
+        TickType_t wait = portMAX_DELAY;
+
+        for (int i = 0; i < GPIO_BUTTON_NUM; i++)
+        {
+            if ((button_fsms[i].deadline_us > 0) && ((next_us == 0) || (button_fsms[i].deadline_us < next_us)))
+                next_us = button_fsms[i].deadline_us;
+        }
+        if (next_us > 0)
+        {
+            int64_t left_us = next_us - esp_timer_get_time();
+            // 向上取整到 tick, 否则会提前醒来空转
+            wait = (left_us > 0) ? (TickType_t)((left_us * configTICK_RATE_HZ + 999999) / 1000000) : 0;
+        }
+
+        if (xQueueReceive(button_event_queue, &event, wait) == pdPASS)
+        {
+            int index = gpio_button_index(event.gpio_num);
+            if (index >= 0)
+                gpio_button_on_edge(index, &event);
+        }
+
+        int64_t now_us = esp_timer_get_time();
+        for (int i = 0; i < GPIO_BUTTON_NUM; i++)
+        {
+            if ((button_fsms[i].deadline_us > 0) && (button_fsms[i].deadline_us <= now_us))
+                gpio_button_on_timeout(i, now_us);
         }
     }
 }
 
 /**
- * @brief Initializes the GPIOs, ISR, Queue, and Task
+ * @brief Initializes the GPIOs, ISR, Queues, and the action slots
  */
 esp_err_t gpio_button_init(void)
 {
-    // 1. Create the queue before the ISR is installed
-    button_event_queue = xQueueCreate(10, sizeof(button_event_t));
-    if (button_event_queue == NULL) {
-        ESP_LOGE(TAG, "Failed to create button event queue.");
+    // 1. Create the queues before the ISR is installed (每次按键至少两个边沿, 再留出抖动的余量)
+    button_event_queue = xQueueCreate(16, sizeof(button_event_t));
+    button_action_queue = xQueueCreate(GPIO_BUTTON_NUM, sizeof(int));
+    button_action_mutex = xSemaphoreCreateMutex();
+    if ((button_event_queue == NULL) || (button_action_queue == NULL) || (button_action_mutex == NULL)) {
+        ESP_LOGE(TAG, "Failed to create button queues.");
         return ESP_FAIL;
     }
+    for (int i = 0; i < GPIO_BUTTON_NUM; i++) {
+        button_actions[i].queued_event = -1;
+        button_actions[i].running_event = -1;
+        button_actions[i].pending_event = -1;
+    }
 
     // 2. Install the global GPIO ISR handler
     gpio_install_isr_service(0);
@@ -113,7 +350,7 @@ esp_err_t gpio_button_init(void)
     // 3. Configure each button GPIO
     for (int i = 0; i < GPIO_BUTTON_NUM; i++) {
         gpio_config_t io_conf = {};
-        io_conf.intr_type = GPIO_INTR_NEGEDGE; // Trigger on falling edge (press)
+        io_conf.intr_type = GPIO_INTR_ANYEDGE; // Press and release, for long-press and double-click
         io_conf.mode = GPIO_MODE_INPUT;
         io_conf.pin_bit_mask = (1ULL << button_gpios[i]);
         io_conf.pull_down_en = 0;
@@ -121,29 +358,47 @@ esp_err_t gpio_button_init(void)
         gpio_config(&io_conf);
 
         // 4. Hook the ISR to the specific GPIO pin
-        gpio_isr_handler_add(button_gpios[i], gpio_isr_handler, (void*) button_gpios[i]);
+        gpio_isr_handler_add(button_gpios[i], gpio_isr_handler, (void*)(uintptr_t) button_gpios[i]);
     }
     return ESP_OK;
 }
 
 esp_err_t gpio_button_set_callback_func(int index, button_callback_t cbFunc)
 {
-    ESP_LOGI(TAG, "gpio_button_set_callback_func(%d).", index);
-    if ((index >= 0) && (index < GPIO_BUTTON_NUM))
-    {
-        gpio_callback_func[index] = cbFunc;
-    }
-    else
+    return gpio_button_set_action(index, BUTTON_EVENT_PRESS, cbFunc, BUTTON_ACTION_COALESCE);
+}
+
+esp_err_t gpio_button_set_action(int index, button_event_type_t event, button_callback_t cbFunc,
+                                 button_action_policy_t policy)
+{
+    ESP_LOGI(TAG, "gpio_button_set_action(%d, %d).", index, event);
+    if ((index < 0) || (index >= GPIO_BUTTON_NUM) || (event < 0) || (event >= BUTTON_EVENT_MAX))
     {
-        ESP_LOGW(TAG, "Invalid index when gpio_button_set_callback_func(%d).", index);
+        ESP_LOGW(TAG, "Invalid index when gpio_button_set_action(%d, %d).", index, event);
+        return ESP_ERR_INVALID_ARG;
     }
+    xSemaphoreTake(button_action_mutex, portMAX_DELAY);
+    button_actions[index].func[event] = cbFunc;
+    button_actions[index].policy[event] = policy;
+    xSemaphoreGive(button_action_mutex);
     return ESP_OK;
 }
 
+/**
+ * @brief 动作里轮询: 同一按键来了 BUTTON_ACTION_RESTART 事件时返回 true, 动作应尽快收尾返回.
+ */
+bool gpio_button_action_cancelled(uint8_t gpio_num)
+{
+    int index = gpio_button_index(gpio_num);
+
+    return (index >= 0) && button_actions[index].cancel;
+}
 
 esp_err_t gpio_button_start(void)
 {
-    xTaskCreate(gpio_button_task, "button_task", 4096, NULL, 10, NULL);
-    
+    xTaskCreate(gpio_button_task, "button_task", 4096, NULL, GPIO_BUTTON_TASK_PRIO, NULL);
+    for (int i = 0; i < GPIO_BUTTON_WORKER_NUM; i++)
+        xTaskCreate(gpio_button_worker_task, "button_worker", GPIO_BUTTON_WORKER_STACK, NULL, GPIO_BUTTON_WORKER_PRIO, NULL);
+
     return ESP_OK;
-}
\ No newline at end of file
+}
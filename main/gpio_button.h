@@ -1,6 +1,7 @@
 #ifndef GPIO_BUTTON_H
 #define GPIO_BUTTON_H
 
+#include <stdbool.h>
 #include "esp_err.h"
 #include "driver/gpio.h"
 
@@ -10,17 +11,42 @@
 #define GPIO_BUTTON_NUM     3
 
 #define BUTTON_PRESSED      0
-#define DEBOUNCE_TIME_MS    50
+#define DEBOUNCE_TIME_MS    30          // 电平稳定这么久才认为按下 / 松开, 期间的抖动只推迟判定
+#define LONG_PRESS_TIME_MS  800
+#define DOUBLE_CLICK_TIME_MS 300        // 松开后等待第二次按下的窗口
 
+#define GPIO_BUTTON_TASK_PRIO       10
+#define GPIO_BUTTON_WORKER_NUM      2   // 不同按键的动作可以并行, 同一按键的动作总是串行
+#define GPIO_BUTTON_WORKER_PRIO     4
+#define GPIO_BUTTON_WORKER_STACK    4096
+
+// 中断送给按键任务的边沿
 typedef struct {
     uint8_t gpio_num;
-    uint32_t press_time_ms;
+    uint8_t level;
+    int64_t edge_time_us;
 } button_event_t;
 
+typedef enum {
+    BUTTON_EVENT_PRESS = 0,         // 没注册长按/双击时按下即触发, 否则松开 (或双击窗口结束) 后触发
+    BUTTON_EVENT_LONG_PRESS,
+    BUTTON_EVENT_DOUBLE_CLICK,
+    BUTTON_EVENT_MAX
+} button_event_type_t;
+
+// 动作还在执行时同一按键又产生事件的处理方式; 排队未执行的事件总是被新事件替换
+typedef enum {
+    BUTTON_ACTION_COALESCE = 0,     // 同一事件直接丢弃, 不同事件等当前动作结束后执行
+    BUTTON_ACTION_RESTART,          // 请求取消当前动作 (见 gpio_button_action_cancelled), 结束后执行新事件
+} button_action_policy_t;
+
 typedef void (*button_callback_t)(uint8_t gpio_num);
 
 esp_err_t gpio_button_init(void);
 esp_err_t gpio_button_start(void);
 esp_err_t gpio_button_set_callback_func(int index, button_callback_t cbFunc);
+esp_err_t gpio_button_set_action(int index, button_event_type_t event, button_callback_t cbFunc,
+                                 button_action_policy_t policy);
+bool gpio_button_action_cancelled(uint8_t gpio_num);
 
-#endif // GPIO_BUTTON_H
\ No newline at end of file
+#endif // GPIO_BUTTON_H
@@ -1,21 +1,113 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "esp_log.h"
 #include "driver/i2s_std.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "i2s_audio.h"
+#include "audio_convert.h"
+#include "audio_vad.h"
+#include "audio_adpcm.h"
+#include "audio_resample.h"
+#include "audio_history.h"
+#include "audio_pool.h"
 #include "network_socket.h"
+#include "stream_frame.h"
+#include "audio_downlink.h"
+#include "audio_metrics.h"
+#include "audio_pipeline.h"
+#include "audio_trace.h"
+#ifdef CONFIG_AUDIO_RECORDER
+#include "audio_recorder.h"
+#endif
 
 static const char *TAG = "I2S_AUDIO";
 
+#if CONFIG_AUDIO_PIPELINE_READER_PRIO <= I2S_AUDIO_HISTORY_TASK_PRIO
+#error "CONFIG_AUDIO_PIPELINE_READER_PRIO must be above I2S_AUDIO_HISTORY_TASK_PRIO"
+#endif
+
+#if defined(CONFIG_AUDIO_MIC_PROFILE_LOW_LATENCY)
+#define I2S_AUDIO_MIC_BOOT_PROFILE  AUDIO_PROFILE_LOW_LATENCY
+#elif defined(CONFIG_AUDIO_MIC_PROFILE_DEEP)
+#define I2S_AUDIO_MIC_BOOT_PROFILE  AUDIO_PROFILE_DEEP
+#elif defined(CONFIG_AUDIO_MIC_PROFILE_8K)
+#define I2S_AUDIO_MIC_BOOT_PROFILE  AUDIO_PROFILE_8K
+#elif defined(CONFIG_AUDIO_MIC_PROFILE_24K)
+#define I2S_AUDIO_MIC_BOOT_PROFILE  AUDIO_PROFILE_24K
+#elif defined(CONFIG_AUDIO_MIC_PROFILE_48K)
+#define I2S_AUDIO_MIC_BOOT_PROFILE  AUDIO_PROFILE_48K
+#else
+#define I2S_AUDIO_MIC_BOOT_PROFILE  AUDIO_PROFILE_BALANCED
+#endif
+
+#if defined(CONFIG_AUDIO_SPK_PROFILE_LOW_LATENCY)
+#define I2S_AUDIO_SPK_BOOT_PROFILE  AUDIO_PROFILE_LOW_LATENCY
+#elif defined(CONFIG_AUDIO_SPK_PROFILE_DEEP)
+#define I2S_AUDIO_SPK_BOOT_PROFILE  AUDIO_PROFILE_DEEP
+#else
+#define I2S_AUDIO_SPK_BOOT_PROFILE  AUDIO_PROFILE_BALANCED
+#endif
+
 static i2s_chan_handle_t rx_handle = NULL;
 static i2s_chan_handle_t tx_handle = NULL;
+static bool tx_running = false;
+static uint32_t tx_sample_rate = I2S_AUDIO_SPK_SAMPLE_RATE;
+// 当前的采集/播放配置 (audio_profile), 只在通道空闲时切换
+static audio_profile_id_t rx_profile_id = AUDIO_PROFILE_MAX;
+static audio_profile_dma_t rx_dma;
+static uint32_t rx_sample_rate = 0;
+static audio_profile_id_t tx_profile_id = AUDIO_PROFILE_MAX;
+static audio_profile_dma_t tx_dma;
+// TX 通道状态 (使能, 时钟, 重建) 的切换互斥; 持续播放期间的写入不需要
+static SemaphoreHandle_t tx_mutex = NULL;
+// RX 通道可能同时被历史任务和流采集任务使用: 引用计数决定使能/关闭, 读锁保证同一时刻只有一个读者
+static int rx_users = 0;
+static SemaphoreHandle_t rx_ref_mutex = NULL;
+static SemaphoreHandle_t rx_read_mutex = NULL;
+
+// 流水线: 读取 -> 转换 -> 发送 (RAW32 没有转换), 帧来自 audio_pool 的 FRAME 类
+static audio_pipeline_t i2s_audio_pipeline;
+static int32_t  i2s_audio_drop_buffer[I2S_AUDIO_BUFFER_SAMPLES];
+static bool i2s_audio_network_ok = false;
+static uint32_t i2s_audio_connection = 0;          // 会话所在的连接, 断线重连后不再发送
+static int32_t  i2s_audio_data_format = I2S_AUDIO_FORMAT_RAW32;
+static uint8_t  i2s_audio_adpcm_buffer[I2S_AUDIO_ADPCM_SIZE];
+static audio_adpcm_state_t i2s_audio_adpcm_state;
+#ifdef CONFIG_AUDIO_STREAM_CONDITIONING
+static audio_condition_t i2s_audio_condition;
+#endif
+static audio_resample_t i2s_audio_resample;
+static int16_t  i2s_audio_resample_buffer[I2S_AUDIO_BUFFER_SAMPLES + 1];
+static uint32_t i2s_audio_stream_rate = 0;
+static bool i2s_audio_stream_convert = false;
+static bool i2s_audio_stream_gated = false;
+static uint64_t i2s_audio_send_wait_us = 0;
+static i2s_audio_stream_stats_t i2s_audio_stats;
+static uint16_t i2s_audio_session_id = 0;
+
+#ifdef CONFIG_AUDIO_STREAM_VAD_GATE
+static bool i2s_audio_vad_gate_flag = true;
+#else
+static bool i2s_audio_vad_gate_flag = false;
+#endif
+static audio_vad_t i2s_audio_vad;
+// 预录直接持有已转换为 PCM16 的采集块 (引用计数), 不再拷贝
+static audio_block_t *i2s_audio_preroll_blocks[AUDIO_VAD_MAX_PREROLL];
+static int i2s_audio_preroll_count = 0;
+static int i2s_audio_preroll_head = 0;
 
-static int16_t  i2s_audio_pcm16_buffer[I2S_AUDIO_BUFFER_SAMPLES];
-static int32_t  i2s_audio_raw_buffer[I2S_AUDIO_BUFFER_SAMPLES];
-static int32_t  i2s_audio_data_stream_flag = false;
-static int32_t  i2s_audio_data_convert_flag = false;
-static TaskHandle_t i2s_audio_stream_task_handle = NULL;
+static audio_history_t i2s_audio_history;
+static bool i2s_audio_history_running = false;
+static int i2s_audio_history_ms = 0;
+// 快照期间不能换历史缓冲 (切换采集配置时按新采样率重新分配); 加锁顺序: 历史锁 -> 读锁
+static SemaphoreHandle_t i2s_audio_history_mutex = NULL;
+static int32_t  i2s_audio_history_block[I2S_AUDIO_HISTORY_BLOCK_SAMPLES];
 
 // ================== 错误检查 ==================
 static void check_esp_err(esp_err_t err, const char* msg)
@@ -26,22 +118,25 @@ static void check_esp_err(esp_err_t err, const char* msg)
     }
 }
 
-esp_err_t i2s_audio_mic_init()
+static esp_err_t i2s_audio_mic_create(const audio_profile_t *profile, const audio_profile_dma_t *dma)
 {
     i2s_chan_config_t chan_cfg = {
         .id = (i2s_port_t)0,
         .role = I2S_ROLE_MASTER,
-        .dma_desc_num = 8,
-        .dma_frame_num = 256,
+        .dma_desc_num = dma->desc_num,
+        .dma_frame_num = dma->frame_num,
         .auto_clear_after_cb = true,
         .auto_clear_before_cb = false,
         .intr_priority = 0,
     };
-    check_esp_err(i2s_new_channel(&chan_cfg, NULL, &rx_handle), "i2s_new_channel_rx");
+    esp_err_t err = i2s_new_channel(&chan_cfg, NULL, &rx_handle);
+    if (err != ESP_OK)
+        return err;
 
+    // 槽位固定 32bit, data_bit_width 只决定 DMA 里每个样本的字节数
     i2s_std_config_t std_cfg = {
         .clk_cfg = {
-            .sample_rate_hz = (uint32_t)I2S_AUDIO_MIC_SAMPLE_RATE,
+            .sample_rate_hz = profile->sample_rate,
             .clk_src = I2S_CLK_SRC_DEFAULT,
             .mclk_multiple = I2S_MCLK_MULTIPLE_256,
             #ifdef   I2S_HW_VERSION_2
@@ -49,8 +144,8 @@ esp_err_t i2s_audio_mic_init()
             #endif
         },
         .slot_cfg = {
-            .data_bit_width = I2S_DATA_BIT_WIDTH_32BIT,
-            .slot_bit_width = I2S_SLOT_BIT_WIDTH_AUTO,
+            .data_bit_width = (i2s_data_bit_width_t)profile->data_bits,
+            .slot_bit_width = I2S_SLOT_BIT_WIDTH_32BIT,
             .slot_mode = I2S_SLOT_MODE_MONO,
             .slot_mask = I2S_STD_SLOT_LEFT,
             .ws_width = I2S_DATA_BIT_WIDTH_32BIT,
@@ -75,19 +170,62 @@ esp_err_t i2s_audio_mic_init()
             }
         },
     };
-    check_esp_err(i2s_channel_init_std_mode(rx_handle, &std_cfg), "i2s_channel_init_std_mode_rx");
+    err = i2s_channel_init_std_mode(rx_handle, &std_cfg);
+    if (err != ESP_OK)
+    {
+        i2s_del_channel(rx_handle);
+        rx_handle = NULL;
+    }
+    return err;
+}
+
+static esp_err_t i2s_audio_mic_apply_profile(audio_profile_id_t id)
+{
+    const audio_profile_t *profile = audio_profile_get(id);
+    audio_profile_dma_t dma;
+    esp_err_t err = audio_profile_dma_size(profile, 1, &dma);
+
+    if (err == ESP_OK)
+        err = i2s_audio_mic_create(profile, &dma);
+    if (err != ESP_OK)
+        return err;
+
+    rx_profile_id = id;
+    rx_dma = dma;
+    rx_sample_rate = profile->sample_rate;
+    ESP_LOGI(TAG, "Microphone profile %s: %lu Hz, %u-bit DMA samples, %lu x %lu frames (%lu bytes), "
+             "period %lu us, latency %lu us.", profile->name, (unsigned long)profile->sample_rate,
+             (unsigned)profile->data_bits, (unsigned long)dma.desc_num, (unsigned long)dma.frame_num,
+             (unsigned long)dma.dma_bytes, (unsigned long)dma.period_us, (unsigned long)dma.latency_us);
+    return ESP_OK;
+}
+
+esp_err_t i2s_audio_mic_init()
+{
+    rx_ref_mutex = xSemaphoreCreateMutex();
+    rx_read_mutex = xSemaphoreCreateMutex();
+    if ((rx_ref_mutex == NULL) || (rx_read_mutex == NULL))
+    {
+        ESP_LOGE(TAG, "Failed to create RX mutexes.");
+        return ESP_FAIL;
+    }
+    check_esp_err(i2s_audio_mic_apply_profile(I2S_AUDIO_MIC_BOOT_PROFILE), "i2s_audio_mic_apply_profile");
     ESP_LOGI(TAG, "i2s_audio_mic_init() Success!");
     return ESP_OK;
 }
 
-esp_err_t i2s_audio_spk_init()
+static esp_err_t i2s_audio_spk_create(uint32_t sample_rate, const audio_profile_dma_t *dma)
 {
     i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_1, I2S_ROLE_MASTER);
-    check_esp_err(i2s_new_channel(&chan_cfg, &tx_handle, NULL), "i2s_new_channel_tx");
+    chan_cfg.dma_desc_num = dma->desc_num;
+    chan_cfg.dma_frame_num = dma->frame_num;
+    esp_err_t err = i2s_new_channel(&chan_cfg, &tx_handle, NULL);
+    if (err != ESP_OK)
+        return err;
 
     i2s_std_config_t std_cfg = {
         .clk_cfg = {
-            .sample_rate_hz = (uint32_t)I2S_AUDIO_SPK_SAMPLE_RATE,
+            .sample_rate_hz = sample_rate,
             .clk_src = I2S_CLK_SRC_DEFAULT,
             .mclk_multiple = I2S_MCLK_MULTIPLE_256,
             #ifdef   I2S_HW_VERSION_2
@@ -122,125 +260,925 @@ esp_err_t i2s_audio_spk_init()
         },
     };
 
-    check_esp_err(i2s_channel_init_std_mode(tx_handle, &std_cfg), "i2s_channel_init_std_mode_tx");
+    err = i2s_channel_init_std_mode(tx_handle, &std_cfg);
+    if (err != ESP_OK)
+    {
+        i2s_del_channel(tx_handle);
+        tx_handle = NULL;
+    }
+    return err;
+}
+
+/**
+ * @brief 播放数据都是 int32, 配置里的位宽对 TX 不适用; 采样率只作为默认值, 持续播放时按流的采样率重设.
+ */
+static esp_err_t i2s_audio_spk_apply_profile(audio_profile_id_t id, uint32_t sample_rate)
+{
+    const audio_profile_t *profile = audio_profile_get(id);
+    audio_profile_t tx_profile;
+    audio_profile_dma_t dma;
+
+    if (profile == NULL)
+        return ESP_ERR_INVALID_ARG;
+    tx_profile = *profile;
+    tx_profile.data_bits = 32;
+    tx_profile.sample_rate = sample_rate;
+    esp_err_t err = audio_profile_dma_size(&tx_profile, 1, &dma);
+    if (err == ESP_OK)
+        err = i2s_audio_spk_create(sample_rate, &dma);
+    if (err != ESP_OK)
+        return err;
+
+    tx_profile_id = id;
+    tx_dma = dma;
+    tx_sample_rate = sample_rate;
+    ESP_LOGI(TAG, "Speaker profile %s: %lu Hz, %lu x %lu frames (%lu bytes), period %lu us, latency %lu us.",
+             profile->name, (unsigned long)sample_rate, (unsigned long)dma.desc_num, (unsigned long)dma.frame_num,
+             (unsigned long)dma.dma_bytes, (unsigned long)dma.period_us, (unsigned long)dma.latency_us);
+    return ESP_OK;
+}
+
+esp_err_t i2s_audio_spk_init()
+{
+    tx_mutex = xSemaphoreCreateMutex();
+    if (tx_mutex == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create the TX mutex.");
+        return ESP_FAIL;
+    }
+    check_esp_err(i2s_audio_spk_apply_profile(I2S_AUDIO_SPK_BOOT_PROFILE, I2S_AUDIO_SPK_SAMPLE_RATE),
+                  "i2s_audio_spk_apply_profile");
     ESP_LOGI(TAG, "i2s_audio_spk_init() Success!");
     return ESP_OK;
 }
 
-esp_err_t i2s_audio_convert_data(int32_t *input, int16_t *output, int samples)
+// 覆盖 history_ms 所需的样本数, 向上取 2 的幂, 例如 16kHz 下 2000ms -> 32768 样本 (2048ms)
+static uint32_t i2s_audio_history_samples(int history_ms, uint32_t sample_rate)
+{
+    uint32_t samples = 1;
+
+    while (samples < (uint32_t)history_ms * (sample_rate / 1000))
+        samples <<= 1;
+    return samples;
+}
+
+// 历史缓冲优先放在 PSRAM, 没有 PSRAM 时退回内部 RAM
+static int32_t *i2s_audio_history_alloc(uint32_t samples, const char **placement)
 {
-    for (int i = 0; i < samples; i++)
+    int32_t *storage = NULL;
+
+    *placement = "PSRAM";
+#ifdef CONFIG_SPIRAM
+    storage = heap_caps_calloc(samples, sizeof(int32_t), MALLOC_CAP_SPIRAM);
+#endif
+    if (storage == NULL)
+    {
+        *placement = "internal RAM";
+        storage = heap_caps_calloc(samples, sizeof(int32_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if (storage == NULL)
+        ESP_LOGE(TAG, "Failed to allocate %lu bytes of audio history.", (unsigned long)samples * sizeof(int32_t));
+    return storage;
+}
+
+/**
+ * @brief 切换采集配置: 删除并按新的 DMA 深度重建 RX 通道. 流进行中返回 ESP_ERR_INVALID_STATE.
+ * 常开采集时持有读锁, 历史任务停在两次读取之间; 历史缓冲随后清空, 旧数据的采样率已经不对.
+ * 采样率变化时历史缓冲按新采样率重新分配, 保持同样的时长; 分配不到返回 ESP_ERR_NO_MEM, 配置不变.
+ * 新配置无法建立时恢复原配置并返回错误.
+ */
+esp_err_t i2s_audio_mic_set_profile(audio_profile_id_t id)
+{
+    const audio_profile_t *profile = audio_profile_get(id);
+    int32_t *history_storage = NULL;
+    uint32_t history_samples = 0;
+    const char *placement = NULL;
+
+    if (profile == NULL)
+        return ESP_ERR_INVALID_ARG;
+    if (id == rx_profile_id)
+        return ESP_OK;
+    // 流的读取元素整个会话都持有读锁, 不在这里等
+    if (audio_pipeline_is_active(&i2s_audio_pipeline))
+        return ESP_ERR_INVALID_STATE;
+
+    // 等进行中的快照结束, 之后才能换掉历史缓冲
+    if (i2s_audio_history_running)
+        xSemaphoreTake(i2s_audio_history_mutex, portMAX_DELAY);
+    xSemaphoreTake(rx_read_mutex, portMAX_DELAY);
+    // 拿到读锁后再检查一次: 期间可能刚开始一个流
+    if (audio_pipeline_is_active(&i2s_audio_pipeline))
+    {
+        xSemaphoreGive(rx_read_mutex);
+        if (i2s_audio_history_running)
+            xSemaphoreGive(i2s_audio_history_mutex);
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (i2s_audio_history_running)
     {
-        int32_t value = input[i] >> 12;
-        output[i] = (value > INT16_MAX) ? INT16_MAX : (value < -INT16_MAX) ? -INT16_MAX : (int16_t)value;
+        history_samples = i2s_audio_history_samples(i2s_audio_history_ms, profile->sample_rate);
+        if (history_samples != i2s_audio_history.size)
+            history_storage = i2s_audio_history_alloc(history_samples, &placement);
+        // 变小时分配不到也可以继续用原来的缓冲, 变大时不行
+        if ((history_storage == NULL) && (history_samples > i2s_audio_history.size))
+        {
+            xSemaphoreGive(rx_read_mutex);
+            xSemaphoreGive(i2s_audio_history_mutex);
+            return ESP_ERR_NO_MEM;
+        }
     }
+    xSemaphoreTake(rx_ref_mutex, portMAX_DELAY);
+    if (rx_users > 0)
+        check_esp_err(i2s_channel_disable(rx_handle), "i2s_channel_disable_rx");
+    check_esp_err(i2s_del_channel(rx_handle), "i2s_del_channel_rx");
+
+    audio_profile_id_t previous = rx_profile_id;
+    esp_err_t err = i2s_audio_mic_apply_profile(id);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Microphone profile %d failed: %s", (int)id, esp_err_to_name(err));
+        check_esp_err(i2s_audio_mic_apply_profile(previous), "i2s_audio_mic_apply_profile");
+    }
+    if (rx_users > 0)
+        check_esp_err(i2s_channel_enable(rx_handle), "i2s_channel_enable_rx");
+    if (i2s_audio_history_running)
+    {
+        if ((err == ESP_OK) && (history_storage != NULL))
+        {
+            free(i2s_audio_history.buffer);
+            audio_history_init(&i2s_audio_history, history_storage, history_samples);
+            ESP_LOGI(TAG, "Audio history %lu ms in %s.", (unsigned long)history_samples / (rx_sample_rate / 1000),
+                     placement);
+        }
+        else
+        {
+            free(history_storage);
+            audio_history_init(&i2s_audio_history, i2s_audio_history.buffer, i2s_audio_history.size);
+        }
+    }
+    xSemaphoreGive(rx_ref_mutex);
+    xSemaphoreGive(rx_read_mutex);
+    if (i2s_audio_history_running)
+        xSemaphoreGive(i2s_audio_history_mutex);
+    return err;
+}
+
+/**
+ * @brief 切换播放配置 (DMA 深度), 保持当前采样率. TX 使能期间返回 ESP_ERR_INVALID_STATE,
+ * 由 audio_playback_set_profile() 在块之间停下 TX 后调用.
+ */
+esp_err_t i2s_audio_spk_set_profile(audio_profile_id_t id)
+{
+    if (audio_profile_get(id) == NULL)
+        return ESP_ERR_INVALID_ARG;
+
+    xSemaphoreTake(tx_mutex, portMAX_DELAY);
+    if (tx_running)
+    {
+        xSemaphoreGive(tx_mutex);
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_err_t err = ESP_OK;
+    if (id != tx_profile_id)
+    {
+        audio_profile_id_t previous = tx_profile_id;
+        check_esp_err(i2s_del_channel(tx_handle), "i2s_del_channel_tx");
+        err = i2s_audio_spk_apply_profile(id, tx_sample_rate);
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(TAG, "Speaker profile %d failed: %s", (int)id, esp_err_to_name(err));
+            check_esp_err(i2s_audio_spk_apply_profile(previous, tx_sample_rate), "i2s_audio_spk_apply_profile");
+        }
+    }
+    xSemaphoreGive(tx_mutex);
+    return err;
+}
+
+audio_profile_id_t i2s_audio_mic_get_profile(audio_profile_dma_t *dma)
+{
+    if (dma != NULL)
+        *dma = rx_dma;
+    return rx_profile_id;
+}
+
+audio_profile_id_t i2s_audio_spk_get_profile(audio_profile_dma_t *dma)
+{
+    if (dma != NULL)
+        *dma = tx_dma;
+    return tx_profile_id;
+}
+
+uint32_t i2s_audio_mic_sample_rate(void)
+{
+    return rx_sample_rate;
+}
+
+#ifdef CONFIG_AUDIO_STREAM_CONDITIONING
+static void i2s_audio_condition_init(audio_condition_t *cond)
+{
+    audio_condition_config_t config;
+    audio_condition_default_config(&config, rx_sample_rate);
+    audio_condition_set_levels(&config, CONFIG_AUDIO_CONDITION_TARGET_DBFS, CONFIG_AUDIO_CONDITION_MAX_GAIN_DB);
+    audio_condition_init(cond, &config);
+}
+#endif
+
+esp_err_t i2s_audio_convert_data(int32_t *input, int16_t *output, int samples)
+{
+#ifdef CONFIG_AUDIO_STREAM_CONDITIONING
+    // 单独的片段没有历史: 只有 DC 高通和软限幅起作用, 增益保持单位增益
+    audio_condition_t cond;
+    i2s_audio_condition_init(&cond);
+    audio_convert_condition_int32_to_int16(&cond, input, output, samples);
+#else
+    audio_convert_int32_to_int16(input, output, samples, AUDIO_CONVERT_DEFAULT_SHIFT);
+#endif
     return ESP_OK;
 }
 
-esp_err_t i2s_audio_read_data(int32_t *buffer, int samples)
+static void i2s_audio_rx_acquire(void)
 {
+    xSemaphoreTake(rx_ref_mutex, portMAX_DELAY);
+    if (rx_users++ == 0)
+        check_esp_err(i2s_channel_enable(rx_handle), "i2s_channel_enable_rx");
+    xSemaphoreGive(rx_ref_mutex);
+}
+
+static void i2s_audio_rx_release(void)
+{
+    xSemaphoreTake(rx_ref_mutex, portMAX_DELAY);
+    if (--rx_users == 0)
+        check_esp_err(i2s_channel_disable(rx_handle), "i2s_channel_disable_rx");
+    xSemaphoreGive(rx_ref_mutex);
+}
+
+/**
+ * @brief 读 samples 个样本到 int32 缓冲区, 调用者持有读锁. DMA 样本不足 4 字节时
+ * 读到缓冲区末尾再原地展开成左对齐的 int32, 下游看到的格式与配置无关.
+ */
+static esp_err_t i2s_audio_rx_read(int32_t *buffer, int samples, int *samples_read, uint32_t timeout)
+{
+    size_t sample_bytes = rx_dma.sample_bytes;
+    uint8_t *packed = (uint8_t *)buffer + (size_t)samples * (sizeof(int32_t) - sample_bytes);
     size_t bytes_read = 0;
-    size_t bytes_to_read = (size_t)samples * sizeof(int32_t);
 
-    check_esp_err(i2s_channel_enable(rx_handle), "i2s_channel_enable_rx");
-    check_esp_err(i2s_channel_read(rx_handle, buffer, bytes_to_read, &bytes_read, pdMS_TO_TICKS(1000)), "i2s_channel_read");
-    if (bytes_read != bytes_to_read)
+    esp_err_t err = i2s_channel_read(rx_handle, packed, (size_t)samples * sample_bytes, &bytes_read, timeout);
+    *samples_read = (int)(bytes_read / sample_bytes);
+    audio_convert_unpack_to_int32(packed, buffer, *samples_read, (int)sample_bytes);
+    return err;
+}
+
+esp_err_t i2s_audio_read_data(int32_t *buffer, int samples)
+{
+    int samples_read = 0;
+
+    // 麦克风常开时直接从历史缓冲取触发之后的数据, 不再重复使能/关闭通道
+    if (i2s_audio_history_running)
+        return i2s_audio_history_snapshot(buffer, 0, samples, 1000 + samples / (rx_sample_rate / 1000));
+
+    if (xSemaphoreTake(rx_read_mutex, 0) != pdTRUE)
     {
-        ESP_LOGW(TAG, "Read data: expected %u bytes, got %u bytes", bytes_to_read, bytes_read);
-        return ESP_FAIL;
+        ESP_LOGW(TAG, "Microphone is owned by the capture stream.");
+        return ESP_ERR_INVALID_STATE;
+    }
+    i2s_audio_rx_acquire();
+    // 读超时只让这次录音失败, 由调用者放弃, 不能让按键任务 abort
+    esp_err_t err = i2s_audio_rx_read(buffer, samples, &samples_read, pdMS_TO_TICKS(1000));
+    i2s_audio_rx_release();
+    xSemaphoreGive(rx_read_mutex);
+    if (samples_read != samples)
+    {
+        AUDIO_TRACE2(I2S_READ_SHORT, samples * sizeof(int32_t), samples_read * sizeof(int32_t));
+        return (err != ESP_OK) ? err : ESP_FAIL;
     }
-    check_esp_err(i2s_channel_disable(rx_handle), "i2s_channel_disable_rx");
+    return err;
+}
+
+// 调用者持有 tx_mutex, 通道处于关闭状态
+static void i2s_audio_spk_set_rate(uint32_t sample_rate)
+{
+    if (sample_rate == tx_sample_rate)
+        return;
+
+    i2s_std_clk_config_t clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(sample_rate);
+    check_esp_err(i2s_channel_reconfig_std_clock(tx_handle, &clk_cfg), "i2s_channel_reconfig_std_clock");
+    tx_sample_rate = sample_rate;
+    ESP_LOGI(TAG, "Speaker sample rate %lu Hz.", (unsigned long)sample_rate);
+}
+
+/**
+ * @brief 持续播放: 打开 TX 通道并保持使能, 采样率不同时先在停止状态下重新配置时钟.
+ * 只由 audio_playback 的播放任务使用.
+ */
+esp_err_t i2s_audio_spk_start(uint32_t sample_rate)
+{
+    xSemaphoreTake(tx_mutex, portMAX_DELAY);
+    if (tx_running)
+        check_esp_err(i2s_channel_disable(tx_handle), "i2s_channel_disable_tx");
+    i2s_audio_spk_set_rate(sample_rate);
+    check_esp_err(i2s_channel_enable(tx_handle), "i2s_channel_enable_tx");
+    tx_running = true;
+    xSemaphoreGive(tx_mutex);
     return ESP_OK;
 }
 
-esp_err_t i2s_audio_play_data(int32_t *buffer, int samples)
+esp_err_t i2s_audio_spk_write(const int32_t *buffer, int samples, int timeout_ms)
 {
     size_t bytes_written = 0;
     size_t size_bytes = (size_t)samples * sizeof(int32_t);
 
-    check_esp_err(i2s_channel_enable(tx_handle), "i2s_channel_enable_tx");
-    check_esp_err(i2s_channel_write(tx_handle, (const void *)buffer, size_bytes, &bytes_written, pdMS_TO_TICKS(1000)), "i2s_channel_write");
-    if (bytes_written != size_bytes)
+    if (!tx_running)
+        return ESP_ERR_INVALID_STATE;
+
+    esp_err_t err = i2s_channel_write(tx_handle, buffer, size_bytes, &bytes_written, pdMS_TO_TICKS(timeout_ms));
+    if ((err == ESP_OK) && (bytes_written != size_bytes))
+        err = ESP_ERR_TIMEOUT;
+    return err;
+}
+
+esp_err_t i2s_audio_spk_stop(void)
+{
+    xSemaphoreTake(tx_mutex, portMAX_DELAY);
+    if (tx_running)
     {
-        ESP_LOGW(TAG, "Write data: Wrote %u bytes, expected %u bytes.", bytes_written, size_bytes);
-        return ESP_FAIL;
+        check_esp_err(i2s_channel_disable(tx_handle), "i2s_channel_disable_tx");
+        tx_running = false;
     }
-    check_esp_err(i2s_channel_disable(tx_handle), "i2s_channel_disable_tx");
+    xSemaphoreGive(tx_mutex);
     return ESP_OK;
 }
 
-void i2s_audio_data_stream_task(void *arg)
+/**
+ * @brief 历史任务: 麦克风常开, 按小块读入覆盖式历史缓冲.
+ * 每块的读取和写入都持有读锁; 流采集任务 (优先级更高) 开始后拿走读锁, 历史改由采集任务写入.
+ * 切换采集配置时也拿读锁, 清空历史缓冲时不会有写入.
+ */
+static void i2s_audio_history_task(void *arg)
 {
-    char *send_buffer = i2s_audio_data_convert_flag ? (char *)i2s_audio_pcm16_buffer : (char *)i2s_audio_raw_buffer;
-    size_t bytes_to_send = i2s_audio_data_convert_flag ? I2S_AUDIO_PCM16_SIZE : I2S_AUDIO_BUFFER_SIZE;
-    size_t bytes_to_read = I2S_AUDIO_BUFFER_SIZE;
-    size_t bytes_read = 0;
-    size_t bytes_sent = 0;
-    int i = 0;
+    int samples_read = 0;
 
-    ESP_LOGI(TAG, "i2s_audio_data_stream_task() start!");
+    ESP_LOGI(TAG, "i2s_audio_history_task() start!");
+    audio_metrics_register_task();
 
-    while (i2s_audio_data_stream_flag)
+    while (1)
     {
-        check_esp_err(i2s_channel_read(rx_handle, i2s_audio_raw_buffer, bytes_to_read, &bytes_read, pdMS_TO_TICKS(1000)), "i2s_channel_read");
-        if (bytes_read != bytes_to_read)
-        {
-            ESP_LOGE(TAG, "Read data: expected %u bytes, got %u bytes", bytes_to_read, bytes_read);
-            i2s_audio_stream_task_handle = NULL;
-            vTaskDelete(NULL);
-            return;
-        }
+        xSemaphoreTake(rx_read_mutex, portMAX_DELAY);
+        esp_err_t err = i2s_audio_rx_read(i2s_audio_history_block, I2S_AUDIO_HISTORY_BLOCK_SAMPLES, &samples_read,
+                                          pdMS_TO_TICKS(1000));
+        if ((err == ESP_OK) && (samples_read == I2S_AUDIO_HISTORY_BLOCK_SAMPLES))
+            audio_history_write(&i2s_audio_history, i2s_audio_history_block, I2S_AUDIO_HISTORY_BLOCK_SAMPLES);
+        xSemaphoreGive(rx_read_mutex);
 
-        if (i2s_audio_data_convert_flag)
+        if ((err != ESP_OK) || (samples_read != I2S_AUDIO_HISTORY_BLOCK_SAMPLES))
+            AUDIO_TRACE2(HISTORY_READ_SHORT, sizeof(i2s_audio_history_block), samples_read * sizeof(int32_t));
+    }
+}
+
+/**
+ * @brief 启动常开采集. 历史缓冲按当前采样率分配, 切换采集配置时按新采样率重新分配.
+ */
+esp_err_t i2s_audio_history_start(int history_ms)
+{
+    const char *placement;
+
+    if (i2s_audio_history_running)
+        return ESP_OK;
+
+    if ((i2s_audio_history_mutex == NULL) && ((i2s_audio_history_mutex = xSemaphoreCreateMutex()) == NULL))
+        return ESP_ERR_NO_MEM;
+    uint32_t samples = i2s_audio_history_samples(history_ms, rx_sample_rate);
+    int32_t *storage = i2s_audio_history_alloc(samples, &placement);
+    if (storage == NULL)
+        return ESP_ERR_NO_MEM;
+    audio_history_init(&i2s_audio_history, storage, samples);
+    i2s_audio_history_ms = history_ms;
+
+    i2s_audio_rx_acquire();
+    i2s_audio_history_running = true;
+    xTaskCreate(i2s_audio_history_task, "AudioHistoryTask", 3072, NULL, I2S_AUDIO_HISTORY_TASK_PRIO, NULL);
+    ESP_LOGI(TAG, "Audio history %lu ms in %s.", (unsigned long)samples / (rx_sample_rate / 1000), placement);
+    return ESP_OK;
+}
+
+/**
+ * @brief 以调用时刻为触发点, 取 pre_samples 个历史样本加 post_samples 个后续样本.
+ * 刚启动时历史不足的部分为静音. 等待后续样本最多 timeout_ms.
+ */
+esp_err_t i2s_audio_history_snapshot(int32_t *buffer, int pre_samples, int post_samples, int timeout_ms)
+{
+    if (!i2s_audio_history_running)
+        return ESP_ERR_INVALID_STATE;
+
+    xSemaphoreTake(i2s_audio_history_mutex, portMAX_DELAY);
+    uint32_t start = audio_history_total(&i2s_audio_history) - (uint32_t)pre_samples;
+    int64_t deadline = esp_timer_get_time() + (int64_t)timeout_ms * 1000;
+    esp_err_t err;
+
+    while ((err = audio_history_copy(&i2s_audio_history, start, pre_samples + post_samples, buffer)) == ESP_ERR_NOT_FOUND)
+    {
+        if (esp_timer_get_time() > deadline)
         {
-            i2s_audio_convert_data(i2s_audio_raw_buffer, i2s_audio_pcm16_buffer, I2S_AUDIO_BUFFER_SAMPLES);
+            err = ESP_ERR_TIMEOUT;
+            break;
         }
+        vTaskDelay(pdMS_TO_TICKS(I2S_AUDIO_HISTORY_POLL_MS));
+    }
+    xSemaphoreGive(i2s_audio_history_mutex);
+    if ((err != ESP_OK) && (err != ESP_ERR_TIMEOUT))
+        ESP_LOGW(TAG, "History snapshot failed: %s", esp_err_to_name(err));
+    return err;
+}
+
+/**
+ * @brief 读取元素 (源): 只负责把 I2S DMA 数据搬进帧池, 不做转换也不碰网络.
+ * 没有空闲帧时仍然读取 (读入丢弃缓冲区) 以保持 DMA 环不溢出, 并记录 overrun.
+ * 整个流期间持有读锁; 常开模式下同时把数据写入历史缓冲, 历史不会中断.
+ */
+static esp_err_t i2s_audio_reader_open(audio_element_t *element)
+{
+    xSemaphoreTake(rx_read_mutex, portMAX_DELAY);
+    return ESP_OK;
+}
+
+static esp_err_t i2s_audio_reader_process(audio_element_t *element, audio_block_t **frame)
+{
+    int samples_read = 0;
+    int32_t *target = i2s_audio_drop_buffer;
+    audio_block_t *block = audio_pool_acquire(AUDIO_POOL_FRAME, 0);
+
+    if (block)
+    {
+        target = (int32_t *)block->data;
+    }
+
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t err = i2s_audio_rx_read(target, I2S_AUDIO_BUFFER_SAMPLES, &samples_read, pdMS_TO_TICKS(1000));
+    uint32_t read_us = (uint32_t)(esp_timer_get_time() - start_us);
+    element->stats.io_wait_us += read_us;
+    audio_metrics_record_us(AUDIO_METRICS_STAGE_READ, read_us);
+    if ((err != ESP_OK) || (samples_read != I2S_AUDIO_BUFFER_SAMPLES))
+    {
+        i2s_audio_stats.read_short++;
+        audio_metrics_count(AUDIO_METRICS_I2S_SHORT_READS);
+        audio_pool_release(block);
+        return (err != ESP_OK) ? err : ESP_FAIL;
+    }
+
+    if (i2s_audio_history_running)
+        audio_history_write(&i2s_audio_history, target, I2S_AUDIO_BUFFER_SAMPLES);
+
+    if (!block)
+    {
+        i2s_audio_stats.capture_overruns++;
+        audio_metrics_count(AUDIO_METRICS_CAPTURE_OVERRUNS);
+        return ESP_OK;
+    }
+
+    block->timestamp_us = esp_timer_get_time();
+    block->sequence = i2s_audio_stats.frames_captured + i2s_audio_stats.capture_overruns;
+    block->len = I2S_AUDIO_BUFFER_SIZE;
+    i2s_audio_stats.frames_captured++;
+    audio_metrics_count(AUDIO_METRICS_FRAMES_CAPTURED);
+    *frame = block;
+    return ESP_OK;
+}
+
+static void i2s_audio_reader_close(audio_element_t *element)
+{
+    xSemaphoreGive(rx_read_mutex);
+}
+
+#ifdef CONFIG_AUDIO_STREAM_CONDITIONING
+static esp_err_t i2s_audio_converter_open(audio_element_t *element)
+{
+    // DC 估计和增益在会话内跨块延续, 每个会话从单位增益重新开始
+    i2s_audio_condition_init(&i2s_audio_condition);
+    return ESP_OK;
+}
+#endif
+
+/**
+ * @brief 转换元素: int32 -> PCM16, 原地覆盖块内的采样, 之后 VAD 预录直接持有这个块.
+ * 启用信号调理时 DC 高通, 增益和软限幅在同一遍转换里完成.
+ */
+static esp_err_t i2s_audio_converter_process(audio_element_t *element, audio_block_t **frame)
+{
+    audio_block_t *block = *frame;
+    int64_t start_us = audio_metrics_now();
+
+#ifdef CONFIG_AUDIO_STREAM_CONDITIONING
+    audio_convert_condition_int32_to_int16(&i2s_audio_condition, (const int32_t *)block->data,
+                                           (int16_t *)block->data, I2S_AUDIO_BUFFER_SAMPLES);
+#else
+    i2s_audio_convert_data((int32_t *)block->data, (int16_t *)block->data, I2S_AUDIO_BUFFER_SAMPLES);
+#endif
+    block->len = I2S_AUDIO_BUFFER_SAMPLES * sizeof(int16_t);
+    audio_metrics_record_us(AUDIO_METRICS_STAGE_CONVERT, (uint32_t)(audio_metrics_now() - start_us));
+    return ESP_OK;
+}
+
+/**
+ * @brief 发送一帧: 帧头和负载作为两段 iovec 一次提交.
+ * 启用本地录音时每一帧先交给录音器; 网络断开后只停止网络发送, 录音继续.
+ */
+static esp_err_t i2s_audio_send_frame(uint8_t type, uint32_t sequence, int64_t capture_time_us,
+                                      const void *payload, size_t len)
+{
+    stream_frame_header_t header;
+    struct iovec iov[2] = {
+        { .iov_base = &header, .iov_len = sizeof(header) },
+        { .iov_base = (void *)payload, .iov_len = len },
+    };
+    size_t total = sizeof(header) + len;
+
+    uint32_t block_samples = I2S_AUDIO_BUFFER_SAMPLES * (i2s_audio_stream_rate / 1000) / (rx_sample_rate / 1000);
+    stream_frame_build_header(&header, type, i2s_audio_session_id, sequence,
+                              sequence * block_samples, len, capture_time_us);
+#ifdef CONFIG_AUDIO_RECORDER
+    audio_recorder_record_frame(&header, payload, len);
+    if (!i2s_audio_network_ok)
+        return ESP_OK;
+#endif
+    int64_t start_us = esp_timer_get_time();
+    int bytes_sent = network_socket_sendv_conn(i2s_audio_connection, iov, len ? 2 : 1);
+    uint32_t send_us = (uint32_t)(esp_timer_get_time() - start_us);
+    i2s_audio_send_wait_us += send_us;
+    audio_metrics_record_us(AUDIO_METRICS_STAGE_SEND, send_us);
+    if (bytes_sent != (int)total)
+    {
+        AUDIO_TRACE2(STREAM_SEND_FAILED, total, bytes_sent);
+        i2s_audio_stats.send_errors++;
+        i2s_audio_network_ok = false;
+#ifdef CONFIG_AUDIO_RECORDER
+        return ESP_OK;
+#else
+        audio_pipeline_stop(&i2s_audio_pipeline);
+        return ESP_FAIL;
+#endif
+    }
+    return ESP_OK;
+}
+
+static esp_err_t i2s_audio_send_session(void)
+{
+    stream_frame_session_t session;
+    int64_t now = esp_timer_get_time();
+
+    i2s_audio_session_id = stream_frame_next_session_id();
+    stream_frame_build_session(&session, (uint8_t)i2s_audio_data_format, i2s_audio_stream_rate, now);
+    return i2s_audio_send_frame(STREAM_FRAME_SESSION, 0, now, &session, sizeof(session));
+}
+
+// 发送一个 PCM16 块: 需要时先降采样, ADPCM 模式下再编码 (重采样和编码器状态都跨块延续)
+static esp_err_t i2s_audio_send_pcm16(const int16_t *pcm, uint32_t sequence, int64_t capture_time_us)
+{
+    int samples = I2S_AUDIO_BUFFER_SAMPLES;
+    const void *payload = pcm;
+    size_t len;
+    int64_t start_us = audio_metrics_now();
+
+    if (i2s_audio_stream_rate != rx_sample_rate)
+    {
+        samples = audio_resample_process(&i2s_audio_resample, pcm, samples, i2s_audio_resample_buffer,
+                                         sizeof(i2s_audio_resample_buffer) / sizeof(int16_t));
+        pcm = i2s_audio_resample_buffer;
+        payload = pcm;
+    }
+    len = samples * sizeof(int16_t);
+    if (i2s_audio_data_format == I2S_AUDIO_FORMAT_ADPCM)
+    {
+        len = audio_adpcm_encode(&i2s_audio_adpcm_state, pcm, samples, i2s_audio_adpcm_buffer);
+        payload = i2s_audio_adpcm_buffer;
+    }
+    audio_metrics_record_us(AUDIO_METRICS_STAGE_ENCODE, (uint32_t)(audio_metrics_now() - start_us));
+    return i2s_audio_send_frame(STREAM_FRAME_AUDIO, sequence, capture_time_us, payload, len);
+}
+
+// 指标快照作为 METRICS 帧插在音频帧之间, 快照较大 (约 600 字节), 不放在任务栈上
+static void i2s_audio_send_metrics(uint32_t sequence)
+{
+#ifdef CONFIG_AUDIO_METRICS
+    static audio_metrics_snapshot_t snapshot;
+
+    if (audio_metrics_snapshot(&snapshot) == ESP_OK)
+        i2s_audio_send_frame(STREAM_FRAME_METRICS, sequence, esp_timer_get_time(), &snapshot, sizeof(snapshot));
+#endif
+}
+
+static void i2s_audio_preroll_push(audio_block_t *block)
+{
+    // 只保留 preroll_blocks 个块, 多余的尽早还给采集
+    int keep = i2s_audio_vad.config.preroll_blocks;
+    if (keep > AUDIO_VAD_MAX_PREROLL)
+        keep = AUDIO_VAD_MAX_PREROLL;
+    if (keep <= 0)
+        return;
+
+    if (i2s_audio_preroll_count == keep)
+    {
+        int oldest = (i2s_audio_preroll_head - keep + AUDIO_VAD_MAX_PREROLL) % AUDIO_VAD_MAX_PREROLL;
+        audio_pool_release(i2s_audio_preroll_blocks[oldest]);
+        i2s_audio_preroll_blocks[oldest] = NULL;
+        i2s_audio_preroll_count--;
+    }
+    audio_pool_retain(block);
+    i2s_audio_preroll_blocks[i2s_audio_preroll_head] = block;
+    i2s_audio_preroll_head = (i2s_audio_preroll_head + 1) % AUDIO_VAD_MAX_PREROLL;
+    i2s_audio_preroll_count++;
+}
+
+static void i2s_audio_preroll_clear(void)
+{
+    for (int i = 0; i < AUDIO_VAD_MAX_PREROLL; i++)
+    {
+        audio_pool_release(i2s_audio_preroll_blocks[i]);
+        i2s_audio_preroll_blocks[i] = NULL;
+    }
+    i2s_audio_preroll_count = 0;
+    i2s_audio_preroll_head = 0;
+}
+
+/**
+ * @brief 语音段开始: 发送 VAD_START 帧, 再按时间顺序补发预录块.
+ */
+static esp_err_t i2s_audio_preroll_flush(const audio_block_t *block)
+{
+    int count = i2s_audio_preroll_count;
+    int slot = (i2s_audio_preroll_head - count + AUDIO_VAD_MAX_PREROLL) % AUDIO_VAD_MAX_PREROLL;
+    const audio_block_t *first = count ? i2s_audio_preroll_blocks[slot] : block;
+    esp_err_t err = i2s_audio_send_frame(STREAM_FRAME_VAD_START, first->sequence, first->timestamp_us, NULL, 0);
+
+    for (int i = 0; (i < count) && (err == ESP_OK); i++)
+    {
+        audio_block_t *pre = i2s_audio_preroll_blocks[slot];
+        err = i2s_audio_send_pcm16((const int16_t *)pre->data, pre->sequence, pre->timestamp_us);
+        if (err == ESP_OK)
+            i2s_audio_stats.frames_sent++;
+        slot = (slot + 1) % AUDIO_VAD_MAX_PREROLL;
+    }
+    i2s_audio_stats.frames_gated -= count;
+    i2s_audio_preroll_clear();
+    return err;
+}
+
+/**
+ * @brief 门控模式: 只发送语音段, 静音块进入预录缓冲.
+ * @return true 表示当前块需要发送
+ */
+static bool i2s_audio_vad_gate(audio_block_t *block)
+{
+    audio_vad_event_t event = audio_vad_process(&i2s_audio_vad, (const int16_t *)block->data, I2S_AUDIO_BUFFER_SAMPLES);
+
+    if (event == AUDIO_VAD_EVENT_START)
+    {
+        i2s_audio_stats.vad_segments++;
+        if (i2s_audio_preroll_flush(block) != ESP_OK)
+            return false;
+    }
+    else if (event == AUDIO_VAD_EVENT_END)
+    {
+        i2s_audio_send_frame(STREAM_FRAME_VAD_END, block->sequence, block->timestamp_us, NULL, 0);
+    }
+
+    if (audio_vad_is_speech(&i2s_audio_vad))
+        return true;
+
+    i2s_audio_preroll_push(block);
+    i2s_audio_stats.frames_gated++;
+    return false;
+}
+
+/**
+ * @brief 发送元素 (汇): 会话开始时发送 SESSION 帧, 之后每块按需门控, 重采样/编码后发送.
+ * 网络卡顿只会让发送元素的输入队列变深, 不会阻塞 I2S 读取.
+ */
+static esp_err_t i2s_audio_sender_open(audio_element_t *element)
+{
+    i2s_audio_stream_convert = (i2s_audio_data_format != I2S_AUDIO_FORMAT_RAW32);
+    i2s_audio_stream_gated = i2s_audio_stream_convert && i2s_audio_vad_gate_flag;
+
+    ESP_LOGI(TAG, "Stream start! (format %ld, VAD gate %s)",
+             (long)i2s_audio_data_format, i2s_audio_stream_gated ? "on" : "off");
+
+    audio_adpcm_reset(&i2s_audio_adpcm_state);
+    i2s_audio_stream_rate = rx_sample_rate;
+#ifdef CONFIG_AUDIO_STREAM_8K
+    if (i2s_audio_stream_convert)
+        i2s_audio_stream_rate = I2S_AUDIO_STREAM_8K_SAMPLE_RATE;
+#endif
+    if (audio_resample_init(&i2s_audio_resample, rx_sample_rate, i2s_audio_stream_rate) != ESP_OK)
+    {
+        // 重采样器只有固定的几种比例, 其它采集采样率按原采样率发送
+        ESP_LOGW(TAG, "No resampler for %lu -> %lu Hz, streaming at %lu Hz.", (unsigned long)rx_sample_rate,
+                 (unsigned long)i2s_audio_stream_rate, (unsigned long)rx_sample_rate);
+        i2s_audio_stream_rate = rx_sample_rate;
+        check_esp_err(audio_resample_init(&i2s_audio_resample, rx_sample_rate, rx_sample_rate), "audio_resample_init");
+    }
+    i2s_audio_connection = network_socket_connection();
+    i2s_audio_send_session();
+
+    if (i2s_audio_stream_gated)
+    {
+        audio_vad_config_t vad_config;
+        audio_vad_default_config(&vad_config);
+        audio_vad_init(&i2s_audio_vad, &vad_config);
+        i2s_audio_preroll_clear();
+    }
+    // 只统计 process() 内的发送等待, 与元素的 busy 时间可比
+    i2s_audio_send_wait_us = 0;
+    return ESP_OK;
+}
 
-        bytes_sent = network_socket_send(send_buffer, bytes_to_send);
-        if (bytes_sent != bytes_to_send)
+static esp_err_t i2s_audio_sender_process(audio_element_t *element, audio_block_t **frame)
+{
+    audio_block_t *block = *frame;
+    esp_err_t err = ESP_OK;
+
+    // 停止后队列里剩下的块不再发送
+    if (audio_pipeline_is_running(&i2s_audio_pipeline) &&
+        (!i2s_audio_stream_gated || i2s_audio_vad_gate(block)))
+    {
+        err = i2s_audio_stream_convert ? i2s_audio_send_pcm16((const int16_t *)block->data, block->sequence, block->timestamp_us)
+                                       : i2s_audio_send_frame(STREAM_FRAME_AUDIO, block->sequence, block->timestamp_us,
+                                                              block->data, block->len);
+        if (err == ESP_OK)
         {
-            ESP_LOGE(TAG, "Send data: expected %u bytes, sent %u bytes", bytes_to_send, bytes_sent);
-            i2s_audio_stream_task_handle = NULL;
-            vTaskDelete(NULL);
-            return;
+            i2s_audio_stats.frames_sent++;
+            audio_metrics_count(AUDIO_METRICS_FRAMES_SENT);
+            if ((i2s_audio_stats.frames_sent % 160) == 0)
+                AUDIO_TRACE2(STREAM_PROGRESS, i2s_audio_stats.frames_sent * I2S_AUDIO_BUFFER_SAMPLES,
+                             i2s_audio_stats.capture_overruns);
         }
-        i++;
-        if ((i % 160) == 0)
-            ESP_LOGI(TAG, "Succcessfully sent %d samples!", i * 1024);
     }
+    if (audio_metrics_take_request())
+        i2s_audio_send_metrics(block->sequence);
+    return err;
+}
 
-    network_socket_close();
-    check_esp_err(i2s_channel_disable(rx_handle), "i2s_channel_disable_rx");
-    ESP_LOGI(TAG, "i2s_audio_data_stream_task() stop!");
+static void i2s_audio_sender_close(audio_element_t *element)
+{
+    element->stats.io_wait_us = i2s_audio_send_wait_us;
+    i2s_audio_preroll_clear();
 
-    i2s_audio_stream_task_handle = NULL;
-    vTaskDelete(NULL);
+    // 发送失败时连接已被丢弃, 不再发送结束帧 (录音时结束帧仍要写入文件)
+#ifdef CONFIG_AUDIO_RECORDER
+    if (i2s_audio_network_ok || audio_recorder_is_recording())
+#else
+    if (i2s_audio_network_ok)
+#endif
+    {
+        uint32_t sequence = i2s_audio_stats.frames_captured + i2s_audio_stats.capture_overruns;
+        if (i2s_audio_stream_gated && audio_vad_is_speech(&i2s_audio_vad))
+            i2s_audio_send_frame(STREAM_FRAME_VAD_END, sequence, esp_timer_get_time(), NULL, 0);
+        i2s_audio_send_metrics(sequence);
+        i2s_audio_send_frame(STREAM_FRAME_END, sequence, esp_timer_get_time(), NULL, 0);
+    }
+#ifdef CONFIG_AUDIO_RECORDER
+    audio_recorder_stream_end();
+#endif
+
+    i2s_audio_rx_release();
+#ifdef CONFIG_AUDIO_STREAM_DOWNLINK
+    audio_downlink_stop();
+#endif
+    i2s_audio_stats.queue_high_water = element->stats.queue_high_water;
+    ESP_LOGI(TAG, "Stream stop! captured %lu, sent %lu, gated %lu, overruns %lu, max queue %lu",
+             (unsigned long)i2s_audio_stats.frames_captured, (unsigned long)i2s_audio_stats.frames_sent,
+             (unsigned long)i2s_audio_stats.frames_gated, (unsigned long)i2s_audio_stats.capture_overruns,
+             (unsigned long)i2s_audio_stats.queue_high_water);
+    audio_pool_log_stats();
 }
 
-esp_err_t i2s_audio_stream_data(int pcm16_flag)
+// 各元素的核/优先级/栈在 Kconfig 的 "Pipeline task placement" 中设置.
+// 转换和发送的输入队列能放下所有帧加结束标记, 转发时不会阻塞
+static audio_element_t i2s_audio_reader = {
+    .name = "AudioReader",
+    .kind = AUDIO_ELEMENT_SOURCE,
+    .open = i2s_audio_reader_open,
+    .process = i2s_audio_reader_process,
+    .close = i2s_audio_reader_close,
+    .core = CONFIG_AUDIO_PIPELINE_READER_CORE,
+    .priority = CONFIG_AUDIO_PIPELINE_READER_PRIO,
+    .stack_size = CONFIG_AUDIO_PIPELINE_READER_STACK,
+    .metrics_queue = -1,
+};
+
+static audio_element_t i2s_audio_converter = {
+    .name = "AudioConverter",
+    .kind = AUDIO_ELEMENT_TRANSFORM,
+#ifdef CONFIG_AUDIO_STREAM_CONDITIONING
+    .open = i2s_audio_converter_open,
+#endif
+    .process = i2s_audio_converter_process,
+    .core = CONFIG_AUDIO_PIPELINE_CONVERTER_CORE,
+    .priority = CONFIG_AUDIO_PIPELINE_CONVERTER_PRIO,
+    .stack_size = CONFIG_AUDIO_PIPELINE_CONVERTER_STACK,
+    .queue_len = AUDIO_POOL_FRAME_COUNT + 1,
+    .metrics_queue = -1,
+};
+
+static audio_element_t i2s_audio_sender = {
+    .name = "AudioSender",
+    .kind = AUDIO_ELEMENT_SINK,
+    .open = i2s_audio_sender_open,
+    .process = i2s_audio_sender_process,
+    .close = i2s_audio_sender_close,
+    .core = CONFIG_AUDIO_PIPELINE_SENDER_CORE,
+    .priority = CONFIG_AUDIO_PIPELINE_SENDER_PRIO,
+    .stack_size = CONFIG_AUDIO_PIPELINE_SENDER_STACK,
+    .queue_len = AUDIO_POOL_FRAME_COUNT + 1,
+    .metrics_queue = AUDIO_METRICS_QUEUE_READY,
+};
+
+esp_err_t i2s_audio_stream_data(int format)
 {
-    if (i2s_audio_stream_task_handle)
+    if (audio_pipeline_is_active(&i2s_audio_pipeline))
     {
         ESP_LOGI(TAG, "Stopping I2S Audio streaming.....");
-        i2s_audio_data_stream_flag = false;
+        audio_pipeline_stop(&i2s_audio_pipeline);
         return ESP_OK;
     }
 
-    check_esp_err(i2s_channel_enable(rx_handle), "i2s_channel_enable_rx");
-    if (network_socket_init() < 0)
+    if ((format < I2S_AUDIO_FORMAT_RAW32) || (format > I2S_AUDIO_FORMAT_ADPCM))
+    {
+        ESP_LOGE(TAG, "Unsupported stream format %d.", format);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(&i2s_audio_stats, 0, sizeof(i2s_audio_stats));
+
+#ifdef CONFIG_AUDIO_RECORDER
+    // 批量上传占用同一个连接
+    if (audio_recorder_stream_begin() != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Upload in progress, streaming refused.");
+        return ESP_ERR_INVALID_STATE;
+    }
+#endif
+
+    i2s_audio_network_ok = (network_socket_init() >= 0);
+    if (!i2s_audio_network_ok)
     {
+#ifdef CONFIG_AUDIO_RECORDER
+        ESP_LOGW(TAG, "Failed to connect to host, recording locally only.");
+#else
         ESP_LOGE(TAG, "Failed to connect to host.");
         return ESP_FAIL;
+#endif
     }
+    i2s_audio_rx_acquire();
+#ifdef CONFIG_AUDIO_STREAM_DOWNLINK
+    // 下行播放失败不影响上行采集
+    if (i2s_audio_network_ok)
+        audio_downlink_start();
+#endif
 
-    i2s_audio_data_stream_flag = true;
-    i2s_audio_data_convert_flag = pcm16_flag;
-    xTaskCreate(i2s_audio_data_stream_task, "AudioStreamTask", 4096, NULL, 5, &i2s_audio_stream_task_handle);
-    return ESP_OK;
+    i2s_audio_data_format = format;
+    // RAW32 不转换, 读取直接连到发送
+    audio_element_t *elements[] = { &i2s_audio_reader, &i2s_audio_converter, &i2s_audio_sender };
+    int count = 3;
+    if (format == I2S_AUDIO_FORMAT_RAW32)
+    {
+        elements[1] = &i2s_audio_sender;
+        count = 2;
+    }
+    bool started = false;
+    esp_err_t err = audio_pipeline_run(&i2s_audio_pipeline, "AudioStream", elements, count, &started);
+    if (!started)
+    {
+        // 一个任务都没起来, 收尾由这里完成; 否则发送元素的 close() 会做
+        i2s_audio_rx_release();
+#ifdef CONFIG_AUDIO_STREAM_DOWNLINK
+        audio_downlink_stop();
+#endif
+#ifdef CONFIG_AUDIO_RECORDER
+        audio_recorder_stream_end();
+#endif
+    }
+    return err;
 }
 
 esp_err_t i2s_audio_stop_stream()
 {
-    i2s_audio_data_stream_flag = false;
+    audio_pipeline_stop(&i2s_audio_pipeline);
+    return ESP_OK;
+}
+
+esp_err_t i2s_audio_set_vad_gate(bool enable)
+{
+    i2s_audio_vad_gate_flag = enable;
+    return ESP_OK;
+}
+
+bool i2s_audio_get_vad_gate(void)
+{
+    return i2s_audio_vad_gate_flag;
+}
+
+esp_err_t i2s_audio_get_stream_stats(i2s_audio_stream_stats_t *stats)
+{
+    if (stats == NULL)
+        return ESP_ERR_INVALID_ARG;
+    *stats = i2s_audio_stats;
     return ESP_OK;
 }
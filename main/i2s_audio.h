@@ -6,6 +6,7 @@
 #include "driver/i2s_std.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "audio_profile.h"
 
 #define I2S_AUDIO_MIC_GPIO_WS       GPIO_NUM_4
 #define I2S_AUDIO_MIC_GPIO_SCK      GPIO_NUM_5
@@ -14,19 +15,62 @@
 #define I2S_AUDIO_SPK_GPIO_BCLK     GPIO_NUM_15
 #define I2S_AUDIO_SPK_GPIO_LRCK     GPIO_NUM_16
 
-#define I2S_AUDIO_MIC_SAMPLE_RATE   16000
+// 麦克风采样率由采集配置 (audio_profile) 决定, 运行时用 i2s_audio_mic_sample_rate() 取得
 #define I2S_AUDIO_SPK_SAMPLE_RATE   16000
 
+// CONFIG_AUDIO_STREAM_8K: 转换后的流 (PCM16/ADPCM) 发送前用 audio_resample 降到 8kHz,
+// 重采样器不支持的采集采样率按原采样率发送
+#define I2S_AUDIO_STREAM_8K_SAMPLE_RATE 8000
+
 #define I2S_AUDIO_BUFFER_SAMPLES    1024
 #define I2S_AUDIO_BUFFER_SIZE       4096
 #define I2S_AUDIO_PCM16_SIZE    	2048
+#define I2S_AUDIO_ADPCM_SIZE        512
+
+// i2s_audio_stream_data() 的流格式
+#define I2S_AUDIO_FORMAT_RAW32      0   // 原始 int32, 64 KB/s
+#define I2S_AUDIO_FORMAT_PCM16      1   // PCM16, 32 KB/s
+#define I2S_AUDIO_FORMAT_ADPCM      2   // IMA-ADPCM 4bit, 8 KB/s
+
+// 读取→转换→发送流水线 (audio_pipeline): 帧来自 audio_pool (AUDIO_POOL_FRAME_COUNT), 扣除 VAD 预录占用后
+// 决定可承受的网络卡顿 (8 x 64ms = 512ms). 各元素任务的核/优先级/栈由 Kconfig 设置
+
+// 常开采集: 历史任务优先级必须低于读取元素, 流开始时读取元素才能立即拿到读锁
+#define I2S_AUDIO_HISTORY_BLOCK_SAMPLES 256     // 16ms
+#define I2S_AUDIO_HISTORY_TASK_PRIO     5
+#define I2S_AUDIO_HISTORY_POLL_MS       10
+
+typedef struct {
+    uint32_t frames_captured;   // 成功从 I2S 读出的帧数
+    uint32_t frames_sent;       // 成功发送的帧数
+    uint32_t capture_overruns;  // 没有空闲帧, 被丢弃的采集帧数
+    uint32_t read_short;        // I2S 读取不足一帧的次数
+    uint32_t send_errors;       // 发送失败次数
+    uint32_t queue_high_water;  // 待发送队列的最大深度
+    uint32_t frames_gated;      // VAD 门控下未发送的静音帧数
+    uint32_t vad_segments;      // VAD 检测到的语音段数
+} i2s_audio_stream_stats_t;
 
 esp_err_t i2s_audio_mic_init(void);
 esp_err_t i2s_audio_spk_init(void);
 esp_err_t i2s_audio_convert_data(int32_t *input, int16_t *output, int samples);
 esp_err_t i2s_audio_read_data(int32_t *buffer, int samples);
-esp_err_t i2s_audio_play_data(int32_t *buffer, int samples);
-esp_err_t i2s_audio_stream_data(int pcm16_flag);
+esp_err_t i2s_audio_spk_start(uint32_t sample_rate);
+esp_err_t i2s_audio_spk_write(const int32_t *buffer, int samples, int timeout_ms);
+esp_err_t i2s_audio_spk_stop(void);
+esp_err_t i2s_audio_stream_data(int format);
 esp_err_t i2s_audio_stop_stream();
+esp_err_t i2s_audio_set_vad_gate(bool enable);
+bool i2s_audio_get_vad_gate(void);
+esp_err_t i2s_audio_get_stream_stats(i2s_audio_stream_stats_t *stats);
+esp_err_t i2s_audio_history_start(int history_ms);
+esp_err_t i2s_audio_history_snapshot(int32_t *buffer, int pre_samples, int post_samples, int timeout_ms);
+
+// 采集/播放配置, 只在空闲时切换 (流进行中 / 持续播放中返回 ESP_ERR_INVALID_STATE)
+esp_err_t i2s_audio_mic_set_profile(audio_profile_id_t id);
+esp_err_t i2s_audio_spk_set_profile(audio_profile_id_t id);
+audio_profile_id_t i2s_audio_mic_get_profile(audio_profile_dma_t *dma);
+audio_profile_id_t i2s_audio_spk_get_profile(audio_profile_dma_t *dma);
+uint32_t i2s_audio_mic_sample_rate(void);
 
 #endif // I2S_AUDIO_H
\ No newline at end of file
@@ -0,0 +1,399 @@
+#include <string.h>
+#include <math.h>
+#include "esp_log.h"
+#include "kws_inference.h"
+
+static const char *TAG = "KWS_INFERENCE";
+
+static int8_t kws_arena[KWS_INFERENCE_ARENA_SIZE] __attribute__((aligned(16)));
+
+static inline int32_t kws_requantize(int32_t acc, int32_t multiplier, int32_t shift)
+{
+    int total = 31 - shift;
+    int64_t value = (int64_t)acc * multiplier;
+    return (int32_t)((value + ((int64_t)1 << (total - 1))) >> total);
+}
+
+static inline int8_t kws_saturate(int32_t value, int32_t min)
+{
+    value = (value < min) ? min : value;
+    value = (value > INT8_MAX) ? INT8_MAX : value;
+    return (int8_t)value;
+}
+
+static int32_t kws_activation_min(const kws_layer_desc_t *desc)
+{
+    return (desc->activation == KWS_ACTIVATION_RELU) ? desc->output_zero_point : INT8_MIN;
+}
+
+static size_t kws_layer_output_size(const kws_layer_t *layer)
+{
+    return (size_t)layer->desc.out_h * layer->desc.out_w * layer->desc.out_c;
+}
+
+static size_t kws_layer_input_size(const kws_layer_t *layer)
+{
+    return (size_t)layer->in_h * layer->in_w * layer->in_c;
+}
+
+/*
+ * 特征图按 HWC 存放. CONV2D 权重为 [out_c][kh][kw][in_c],
+ * DEPTHWISE 权重为 [kh][kw][c] (depth multiplier 固定为 1).
+ */
+static void kws_conv2d(const kws_layer_t *layer)
+{
+    const kws_layer_desc_t *d = &layer->desc;
+    const int32_t act_min = kws_activation_min(d);
+    int8_t *out = layer->output;
+
+    for (int oy = 0; oy < d->out_h; oy++)
+    {
+        for (int ox = 0; ox < d->out_w; ox++)
+        {
+            const int iy0 = oy * d->stride_h - d->pad_top;
+            const int ix0 = ox * d->stride_w - d->pad_left;
+            for (int oc = 0; oc < d->out_c; oc++)
+            {
+                const int8_t *w = layer->weights + (size_t)oc * d->kernel_h * d->kernel_w * layer->in_c;
+                int32_t acc = layer->bias ? layer->bias[oc] : 0;
+                for (int ky = 0; ky < d->kernel_h; ky++)
+                {
+                    const int iy = iy0 + ky;
+                    if ((iy < 0) || (iy >= layer->in_h))
+                        continue;
+                    for (int kx = 0; kx < d->kernel_w; kx++)
+                    {
+                        const int ix = ix0 + kx;
+                        if ((ix < 0) || (ix >= layer->in_w))
+                            continue;
+                        const int8_t *in = layer->input + ((size_t)iy * layer->in_w + ix) * layer->in_c;
+                        const int8_t *wk = w + ((size_t)ky * d->kernel_w + kx) * layer->in_c;
+                        for (int ic = 0; ic < layer->in_c; ic++)
+                        {
+                            acc += (in[ic] - d->input_zero_point) * wk[ic];
+                        }
+                    }
+                }
+                acc = kws_requantize(acc, d->multiplier, d->shift) + d->output_zero_point;
+                *out++ = kws_saturate(acc, act_min);
+            }
+        }
+    }
+}
+
+static void kws_depthwise_conv2d(const kws_layer_t *layer)
+{
+    const kws_layer_desc_t *d = &layer->desc;
+    const int32_t act_min = kws_activation_min(d);
+    int8_t *out = layer->output;
+
+    for (int oy = 0; oy < d->out_h; oy++)
+    {
+        for (int ox = 0; ox < d->out_w; ox++)
+        {
+            const int iy0 = oy * d->stride_h - d->pad_top;
+            const int ix0 = ox * d->stride_w - d->pad_left;
+            for (int c = 0; c < d->out_c; c++)
+            {
+                int32_t acc = layer->bias ? layer->bias[c] : 0;
+                for (int ky = 0; ky < d->kernel_h; ky++)
+                {
+                    const int iy = iy0 + ky;
+                    if ((iy < 0) || (iy >= layer->in_h))
+                        continue;
+                    for (int kx = 0; kx < d->kernel_w; kx++)
+                    {
+                        const int ix = ix0 + kx;
+                        if ((ix < 0) || (ix >= layer->in_w))
+                            continue;
+                        int8_t in = layer->input[((size_t)iy * layer->in_w + ix) * layer->in_c + c];
+                        int8_t w = layer->weights[((size_t)ky * d->kernel_w + kx) * d->out_c + c];
+                        acc += (in - d->input_zero_point) * w;
+                    }
+                }
+                acc = kws_requantize(acc, d->multiplier, d->shift) + d->output_zero_point;
+                *out++ = kws_saturate(acc, act_min);
+            }
+        }
+    }
+}
+
+static void kws_avg_pool2d(const kws_layer_t *layer)
+{
+    const int count = layer->in_h * layer->in_w;
+
+    for (int c = 0; c < layer->in_c; c++)
+    {
+        int32_t sum = 0;
+        for (int i = 0; i < count; i++)
+        {
+            sum += layer->input[(size_t)i * layer->in_c + c];
+        }
+        sum = (sum >= 0) ? (sum + count / 2) / count : (sum - count / 2) / count;
+        layer->output[c] = kws_saturate(sum, INT8_MIN);
+    }
+}
+
+// 权重 [out][in], 输入整体视为一维向量 (隐含 flatten)
+static void kws_dense(const kws_layer_t *layer)
+{
+    const kws_layer_desc_t *d = &layer->desc;
+    const int32_t act_min = kws_activation_min(d);
+    const size_t in_size = kws_layer_input_size(layer);
+
+    for (int o = 0; o < d->out_c; o++)
+    {
+        const int8_t *w = layer->weights + (size_t)o * in_size;
+        int32_t acc = layer->bias ? layer->bias[o] : 0;
+        for (size_t i = 0; i < in_size; i++)
+        {
+            acc += (layer->input[i] - d->input_zero_point) * w[i];
+        }
+        acc = kws_requantize(acc, d->multiplier, d->shift) + d->output_zero_point;
+        layer->output[o] = kws_saturate(acc, act_min);
+    }
+}
+
+// 输出量化固定为 scale = 1/256, zero_point = -128 (与 TFLite 一致)
+static void kws_softmax(const kws_layer_t *layer)
+{
+    const kws_layer_desc_t *d = &layer->desc;
+    const size_t size = kws_layer_input_size(layer);
+    int8_t max_in = INT8_MIN;
+    float sum = 0.0f;
+    float exps[KWS_INFERENCE_MAX_CLASSES];
+
+    for (size_t i = 0; i < size; i++)
+    {
+        if (layer->input[i] > max_in)
+            max_in = layer->input[i];
+    }
+    for (size_t i = 0; i < size; i++)
+    {
+        exps[i] = expf((layer->input[i] - max_in) * d->input_scale);
+        sum += exps[i];
+    }
+    for (size_t i = 0; i < size; i++)
+    {
+        int32_t q = (int32_t)lroundf(exps[i] / sum * 256.0f) - 128;
+        layer->output[i] = kws_saturate(q, INT8_MIN);
+    }
+}
+
+static esp_err_t kws_inference_setup_layer(kws_layer_t *layer, const uint8_t *blob, size_t size)
+{
+    kws_layer_desc_t *d = &layer->desc;
+    size_t weight_count = 0;
+    size_t bias_count = d->out_c;
+
+    if ((d->type == KWS_LAYER_CONV2D) || (d->type == KWS_LAYER_DEPTHWISE_CONV2D))
+    {
+        if ((d->kernel_h == 0) || (d->kernel_w == 0) || (d->stride_h == 0) || (d->stride_w == 0) ||
+            (d->out_h == 0) || (d->out_w == 0) ||
+            ((d->out_h - 1) * d->stride_h - d->pad_top >= layer->in_h) ||
+            ((d->out_w - 1) * d->stride_w - d->pad_left >= layer->in_w))
+            return ESP_ERR_INVALID_ARG;
+    }
+
+    switch (d->type)
+    {
+    case KWS_LAYER_CONV2D:
+        weight_count = (size_t)d->out_c * d->kernel_h * d->kernel_w * layer->in_c;
+        break;
+    case KWS_LAYER_DEPTHWISE_CONV2D:
+        if (d->out_c != layer->in_c)
+            return ESP_ERR_INVALID_SIZE;
+        weight_count = (size_t)d->kernel_h * d->kernel_w * d->out_c;
+        break;
+    case KWS_LAYER_DENSE:
+        d->out_h = 1;
+        d->out_w = 1;
+        weight_count = (size_t)d->out_c * kws_layer_input_size(layer);
+        break;
+    case KWS_LAYER_AVG_POOL2D:
+        d->out_h = 1;
+        d->out_w = 1;
+        d->out_c = layer->in_c;
+        bias_count = 0;
+        break;
+    case KWS_LAYER_SOFTMAX:
+        d->out_h = layer->in_h;
+        d->out_w = layer->in_w;
+        d->out_c = layer->in_c;
+        bias_count = 0;
+        if (kws_layer_input_size(layer) > KWS_INFERENCE_MAX_CLASSES)
+            return ESP_ERR_INVALID_SIZE;
+        break;
+    default:
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    layer->weights = NULL;
+    layer->bias = NULL;
+    if (weight_count)
+    {
+        if ((d->weights_offset > size) || (size - d->weights_offset < weight_count))
+            return ESP_ERR_INVALID_SIZE;
+        layer->weights = (const int8_t *)(blob + d->weights_offset);
+    }
+    if (bias_count && d->bias_offset)
+    {
+        if ((d->bias_offset & 3) || (d->bias_offset > size) || (size - d->bias_offset < bias_count * sizeof(int32_t)))
+            return ESP_ERR_INVALID_SIZE;
+        layer->bias = (const int32_t *)(blob + d->bias_offset);
+    }
+    if ((d->shift > 30) || (d->shift < -31))
+        return ESP_ERR_INVALID_ARG;
+    return ESP_OK;
+}
+
+/**
+ * @brief 解析模型并规划 arena.
+ * 相邻两层的输入/输出分别放在 arena 的两端, 交替翻转, 所以
+ * arena 只需 max(输入 + 输出) 字节, 推理过程中不再分配内存.
+ * blob 需常驻 (通常在 flash 中), 权重直接从中读取.
+ */
+esp_err_t kws_inference_load(kws_model_t *model, const uint8_t *blob, size_t size)
+{
+    const kws_model_header_t *header = (const kws_model_header_t *)blob;
+    uint16_t h, w, c;
+    size_t peak = 0;
+
+    if ((blob == NULL) || (size < sizeof(kws_model_header_t)))
+        return ESP_ERR_INVALID_ARG;
+
+    memcpy(&model->header, header, sizeof(kws_model_header_t));
+    if ((model->header.magic != KWS_MODEL_MAGIC) || (model->header.version != KWS_MODEL_VERSION))
+    {
+        ESP_LOGE(TAG, "Invalid model blob (magic 0x%08lx, version %u).",
+                 (unsigned long)model->header.magic, model->header.version);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if ((model->header.layer_count == 0) || (model->header.layer_count > KWS_INFERENCE_MAX_LAYERS) ||
+        (size < sizeof(kws_model_header_t) + model->header.layer_count * sizeof(kws_layer_desc_t)))
+    {
+        ESP_LOGE(TAG, "Invalid layer count %u.", model->header.layer_count);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    model->layer_count = model->header.layer_count;
+    h = model->header.input_h;
+    w = model->header.input_w;
+    c = model->header.input_c;
+
+    for (int i = 0; i < model->layer_count; i++)
+    {
+        kws_layer_t *layer = &model->layers[i];
+        memcpy(&layer->desc, blob + sizeof(kws_model_header_t) + i * sizeof(kws_layer_desc_t), sizeof(kws_layer_desc_t));
+        layer->in_h = h;
+        layer->in_w = w;
+        layer->in_c = c;
+
+        esp_err_t err = kws_inference_setup_layer(layer, blob, size);
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(TAG, "Layer %d (type %u) is invalid: %s", i, layer->desc.type, esp_err_to_name(err));
+            return err;
+        }
+
+        size_t in_size = kws_layer_input_size(layer);
+        size_t out_size = kws_layer_output_size(layer);
+        if (in_size + out_size > peak)
+            peak = in_size + out_size;
+        h = layer->desc.out_h;
+        w = layer->desc.out_w;
+        c = layer->desc.out_c;
+    }
+
+    if (peak > KWS_INFERENCE_ARENA_SIZE)
+    {
+        ESP_LOGE(TAG, "Model needs %u bytes of arena, only %u available.", (unsigned)peak, (unsigned)KWS_INFERENCE_ARENA_SIZE);
+        return ESP_ERR_NO_MEM;
+    }
+
+    // 偶数层输入在 arena 头部、输出在尾部, 奇数层相反
+    for (int i = 0; i < model->layer_count; i++)
+    {
+        kws_layer_t *layer = &model->layers[i];
+        if (i == 0)
+            layer->input = kws_arena;
+        else
+            layer->input = model->layers[i - 1].output;
+
+        if (layer->input == kws_arena)
+            layer->output = kws_arena + peak - kws_layer_output_size(layer);
+        else
+            layer->output = kws_arena;
+    }
+
+    model->arena_used = peak;
+    ESP_LOGI(TAG, "Model loaded: %d layers, arena %u / %u bytes.", model->layer_count,
+             (unsigned)peak, (unsigned)KWS_INFERENCE_ARENA_SIZE);
+    return ESP_OK;
+}
+
+int8_t *kws_inference_input(kws_model_t *model, size_t *size)
+{
+    if (size)
+        *size = kws_layer_input_size(&model->layers[0]);
+    return model->layers[0].input;
+}
+
+esp_err_t kws_inference_quantize_input(kws_model_t *model, const float *features, size_t count)
+{
+    size_t size;
+    int8_t *input = kws_inference_input(model, &size);
+    const float inv_scale = 1.0f / model->header.input_scale;
+
+    if (count != size)
+        return ESP_ERR_INVALID_SIZE;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        int32_t q = (int32_t)lroundf(features[i] * inv_scale) + model->header.input_zero_point;
+        input[i] = kws_saturate(q, INT8_MIN);
+    }
+    return ESP_OK;
+}
+
+esp_err_t kws_inference_invoke(kws_model_t *model)
+{
+    for (int i = 0; i < model->layer_count; i++)
+    {
+        const kws_layer_t *layer = &model->layers[i];
+        switch (layer->desc.type)
+        {
+        case KWS_LAYER_CONV2D:
+            kws_conv2d(layer);
+            break;
+        case KWS_LAYER_DEPTHWISE_CONV2D:
+            kws_depthwise_conv2d(layer);
+            break;
+        case KWS_LAYER_AVG_POOL2D:
+            kws_avg_pool2d(layer);
+            break;
+        case KWS_LAYER_DENSE:
+            kws_dense(layer);
+            break;
+        case KWS_LAYER_SOFTMAX:
+            kws_softmax(layer);
+            break;
+        default:
+            return ESP_ERR_NOT_SUPPORTED;
+        }
+    }
+    return ESP_OK;
+}
+
+const int8_t *kws_inference_output(kws_model_t *model, size_t *size)
+{
+    const kws_layer_t *last = &model->layers[model->layer_count - 1];
+    if (size)
+        *size = kws_layer_output_size(last);
+    return last->output;
+}
+
+size_t kws_inference_arena_used(kws_model_t *model)
+{
+    return model->arena_used;
+}
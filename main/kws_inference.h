@@ -0,0 +1,94 @@
+#ifndef KWS_INFERENCE_H
+#define KWS_INFERENCE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+// 所有中间激活共用的静态内存池, 大小按模型需要调整 (见 kws_inference_arena_used)
+#define KWS_INFERENCE_ARENA_SIZE    (48 * 1024)
+#define KWS_INFERENCE_MAX_LAYERS    16
+#define KWS_INFERENCE_MAX_CLASSES   32
+
+#define KWS_MODEL_MAGIC             0x3153574B  // "KWS1"
+#define KWS_MODEL_VERSION           1
+
+typedef enum {
+    KWS_LAYER_CONV2D = 0,
+    KWS_LAYER_DEPTHWISE_CONV2D,
+    KWS_LAYER_AVG_POOL2D,           // 全局平均池化
+    KWS_LAYER_DENSE,
+    KWS_LAYER_SOFTMAX,
+} kws_layer_type_t;
+
+typedef enum {
+    KWS_ACTIVATION_NONE = 0,
+    KWS_ACTIVATION_RELU,
+} kws_activation_t;
+
+#pragma pack(1)
+
+// 模型文件头 (24 bytes), 之后紧跟 layer_count 个层描述, 再之后是权重数据
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t layer_count;
+    uint16_t input_h;
+    uint16_t input_w;
+    uint16_t input_c;
+    uint16_t reserved;
+    float input_scale;              // 浮点特征 → int8 的量化参数
+    int32_t input_zero_point;
+} kws_model_header_t;
+
+// 层描述 (44 bytes). 权重对称量化 (零点为 0), 偏置为 int32
+typedef struct {
+    uint8_t type;                   // kws_layer_type_t
+    uint8_t activation;             // kws_activation_t
+    uint8_t kernel_h;
+    uint8_t kernel_w;
+    uint8_t stride_h;
+    uint8_t stride_w;
+    uint8_t pad_top;
+    uint8_t pad_left;
+    uint16_t out_h;
+    uint16_t out_w;
+    uint16_t out_c;
+    uint16_t reserved;
+    int32_t input_zero_point;
+    int32_t output_zero_point;
+    int32_t multiplier;             // Q31 重量化乘数
+    int32_t shift;                  // 正数左移, 负数右移
+    float input_scale;              // 仅 SOFTMAX 使用
+    uint32_t weights_offset;        // 相对模型文件起始处的偏移
+    uint32_t bias_offset;           // 必须 4 字节对齐
+} kws_layer_desc_t;
+
+#pragma pack()
+
+typedef struct {
+    kws_layer_desc_t desc;
+    uint16_t in_h;
+    uint16_t in_w;
+    uint16_t in_c;
+    const int8_t *weights;
+    const int32_t *bias;
+    int8_t *input;                  // arena 中的位置, 由加载时的规划确定
+    int8_t *output;
+} kws_layer_t;
+
+typedef struct {
+    kws_model_header_t header;
+    kws_layer_t layers[KWS_INFERENCE_MAX_LAYERS];
+    int layer_count;
+    size_t arena_used;
+} kws_model_t;
+
+esp_err_t kws_inference_load(kws_model_t *model, const uint8_t *blob, size_t size);
+int8_t *kws_inference_input(kws_model_t *model, size_t *size);
+esp_err_t kws_inference_quantize_input(kws_model_t *model, const float *features, size_t count);
+esp_err_t kws_inference_invoke(kws_model_t *model);
+const int8_t *kws_inference_output(kws_model_t *model, size_t *size);
+size_t kws_inference_arena_used(kws_model_t *model);
+
+#endif // KWS_INFERENCE_H
@@ -6,6 +6,11 @@
 #include "gpio_button.h"
 #include "wifi_station.h"
 #include "application.h"
+#include "network_socket.h"
+#include "audio_pool.h"
+#include "audio_playback.h"
+#include "audio_metrics.h"
+#include "audio_trace.h"
 
 static const char *TAG = "MAIN";
 
@@ -19,11 +24,17 @@ static void check_esp_err(esp_err_t err, const char* msg)
 
 void app_main(void)
 {
+    // 音频缓冲池最先分配, 确保内部 DMA 内存不被 Wi-Fi 缓冲占走
+    check_esp_err(audio_pool_init(), "audio_pool_init()");
+    check_esp_err(audio_metrics_init(), "audio_metrics_init()");
+    check_esp_err(audio_trace_init(), "audio_trace_init()");
     check_esp_err(wav_audio_init(), "wav_audio_init()");
     check_esp_err(gpio_button_init(), "gpio_button_init()");
     check_esp_err(i2s_audio_mic_init(), "i2s_audio_mic_init()");
     check_esp_err(i2s_audio_spk_init(), "i2s_audio_spk_init()");
+    check_esp_err(audio_playback_start(), "audio_playback_start()");
     check_esp_err(wifi_station_init(), "wifi_station_init()");
+    check_esp_err(network_socket_start(), "network_socket_start()");
     check_esp_err(application_init(), "application_init()");
 
     check_esp_err(gpio_button_start(), "gpio_button_start()");
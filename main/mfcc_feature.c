@@ -0,0 +1,246 @@
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "esp_log.h"
+#include "mfcc_feature.h"
+#include "mfcc_tables.h"
+
+static const char *TAG = "MFCC_FEATURE";
+
+#define MFCC_FEATURE_AMIN       1e-10f
+#define MFCC_FEATURE_PAD        (MFCC_FEATURE_N_FFT / 2)
+#define MFCC_FEATURE_MAX_RADIX  5
+
+typedef struct {
+    float r;
+    float i;
+} mfcc_complex_t;
+
+// 400 = 4 x 4 x 5 x 5, 按 {基数, 剩余长度} 成对存放
+static const int mfcc_fft_factors[] = {4, 100, 4, 25, 5, 5, 5, 1};
+
+static mfcc_complex_t mfcc_fft_in[MFCC_FEATURE_N_FFT];
+static mfcc_complex_t mfcc_fft_out[MFCC_FEATURE_N_FFT];
+static float mfcc_power[MFCC_TABLE_N_BINS];
+static float mfcc_discard[MFCC_FEATURE_N_MFCC];
+
+/**
+ * @brief 混合基 DIT FFT (kissfft 的递归结构), 旋转因子来自 mfcc_tables.h.
+ * 基数最大为 5, 通用蝶形的 O(p^2) 代价可以忽略.
+ */
+static void mfcc_fft_work(mfcc_complex_t *out, const mfcc_complex_t *in, int fstride, const int *factors)
+{
+    const int p = factors[0];
+    const int m = factors[1];
+    mfcc_complex_t *out_begin = out;
+    mfcc_complex_t *out_end = out + p * m;
+    mfcc_complex_t scratch[MFCC_FEATURE_MAX_RADIX];
+
+    if (m == 1)
+    {
+        do {
+            *out = *in;
+            in += fstride;
+        } while (++out != out_end);
+    }
+    else
+    {
+        do {
+            mfcc_fft_work(out, in, fstride * p, factors + 2);
+            in += fstride;
+        } while ((out += m) != out_end);
+    }
+
+    out = out_begin;
+    for (int u = 0; u < m; u++)
+    {
+        for (int q = 0, k = u; q < p; q++, k += m)
+        {
+            scratch[q] = out[k];
+        }
+        for (int q1 = 0, k = u; q1 < p; q1++, k += m)
+        {
+            int twidx = 0;
+            mfcc_complex_t acc = scratch[0];
+            for (int q = 1; q < p; q++)
+            {
+                twidx += fstride * k;
+                if (twidx >= MFCC_FEATURE_N_FFT)
+                    twidx -= MFCC_FEATURE_N_FFT;
+                const float tr = mfcc_twiddle[twidx][0];
+                const float ti = mfcc_twiddle[twidx][1];
+                acc.r += scratch[q].r * tr - scratch[q].i * ti;
+                acc.i += scratch[q].r * ti + scratch[q].i * tr;
+            }
+            out[k] = acc;
+        }
+    }
+}
+
+static float *mfcc_feature_log_mel_row(mfcc_feature_t *mfcc, uint32_t frame)
+{
+    return mfcc->log_mel + (frame % MFCC_FEATURE_WINDOW_FRAMES) * MFCC_FEATURE_N_MELS;
+}
+
+static void mfcc_feature_dct(const float *log_mel, float floor_db, float *output)
+{
+    for (int k = 0; k < MFCC_FEATURE_N_MFCC; k++)
+    {
+        float acc = 0.0f;
+        for (int n = 0; n < MFCC_FEATURE_N_MELS; n++)
+        {
+            float value = (log_mel[n] > floor_db) ? log_mel[n] : floor_db;
+            acc += mfcc_dct[k][n] * value;
+        }
+        output[k] = acc;
+    }
+}
+
+// 分析窗已满: 加窗 → FFT → 功率谱 → mel → dB, 结果写入 log-mel 历史
+static void mfcc_feature_compute_frame(mfcc_feature_t *mfcc, float *output)
+{
+    float *log_mel = mfcc_feature_log_mel_row(mfcc, mfcc->frame_count);
+
+    for (int n = 0; n < MFCC_FEATURE_N_FFT; n++)
+    {
+        mfcc_fft_in[n].r = mfcc->samples[n] * mfcc_window[n];
+        mfcc_fft_in[n].i = 0.0f;
+    }
+    mfcc_fft_work(mfcc_fft_out, mfcc_fft_in, 1, mfcc_fft_factors);
+
+    for (int k = 0; k < MFCC_TABLE_N_BINS; k++)
+    {
+        mfcc_power[k] = mfcc_fft_out[k].r * mfcc_fft_out[k].r + mfcc_fft_out[k].i * mfcc_fft_out[k].i;
+    }
+
+    for (int m = 0; m < MFCC_FEATURE_N_MELS; m++)
+    {
+        const float *weights = &mfcc_mel_weights[mfcc_mel_offset[m]];
+        const float *power = &mfcc_power[mfcc_mel_start[m]];
+        float energy = 0.0f;
+        for (int j = 0; j < mfcc_mel_length[m]; j++)
+        {
+            energy += weights[j] * power[j];
+        }
+        log_mel[m] = 10.0f * log10f((energy > MFCC_FEATURE_AMIN) ? energy : MFCC_FEATURE_AMIN);
+        if (log_mel[m] > mfcc->running_max_db)
+            mfcc->running_max_db = log_mel[m];
+    }
+
+    mfcc_feature_dct(log_mel, mfcc->running_max_db - MFCC_FEATURE_TOP_DB, output);
+    mfcc->frame_count++;
+
+    // 帧移: 保留后 N_FFT - HOP 个样本
+    memmove(mfcc->samples, mfcc->samples + MFCC_FEATURE_HOP_LENGTH,
+            (MFCC_FEATURE_N_FFT - MFCC_FEATURE_HOP_LENGTH) * sizeof(float));
+    mfcc->filled = MFCC_FEATURE_N_FFT - MFCC_FEATURE_HOP_LENGTH;
+}
+
+static int mfcc_feature_feed(mfcc_feature_t *mfcc, const int16_t *pcm, int samples, float *output, int max_frames)
+{
+    int frames = 0;
+
+    for (int i = 0; i < samples; i++)
+    {
+        mfcc->samples[mfcc->filled++] = pcm ? (float)pcm[i] / 32768.0f : 0.0f;
+        if (mfcc->filled == MFCC_FEATURE_N_FFT)
+        {
+            if (frames < max_frames)
+            {
+                mfcc_feature_compute_frame(mfcc, output + frames * MFCC_FEATURE_N_MFCC);
+                frames++;
+            }
+            else
+            {
+                // 输出缓冲区满: 帧仍进入 log-mel 历史, 只是不返回流式结果
+                ESP_LOGW(TAG, "Output full, frame %lu not returned", (unsigned long)mfcc->frame_count);
+                mfcc_feature_compute_frame(mfcc, mfcc_discard);
+            }
+        }
+    }
+    return frames;
+}
+
+esp_err_t mfcc_feature_init(mfcc_feature_t *mfcc)
+{
+    mfcc->log_mel = (float *)malloc(MFCC_FEATURE_WINDOW_FRAMES * MFCC_FEATURE_N_MELS * sizeof(float));
+    if (mfcc->log_mel == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate log-mel history.");
+        return ESP_ERR_NO_MEM;
+    }
+    mfcc_feature_reset(mfcc);
+    return ESP_OK;
+}
+
+void mfcc_feature_deinit(mfcc_feature_t *mfcc)
+{
+    free(mfcc->log_mel);
+    mfcc->log_mel = NULL;
+}
+
+void mfcc_feature_reset(mfcc_feature_t *mfcc)
+{
+    // librosa center=True: 第一帧以样本 0 为中心, 前面补 N_FFT/2 个零
+    memset(mfcc->samples, 0, sizeof(mfcc->samples));
+    mfcc->filled = MFCC_FEATURE_PAD;
+    mfcc->frame_count = 0;
+    mfcc->running_max_db = -INFINITY;
+}
+
+int mfcc_feature_push(mfcc_feature_t *mfcc, const int16_t *pcm, int samples, float *output, int max_frames)
+{
+    return mfcc_feature_feed(mfcc, pcm, samples, output, max_frames);
+}
+
+int mfcc_feature_flush(mfcc_feature_t *mfcc, float *output, int max_frames)
+{
+    return mfcc_feature_feed(mfcc, NULL, MFCC_FEATURE_PAD, output, max_frames);
+}
+
+esp_err_t mfcc_feature_get_window(mfcc_feature_t *mfcc, float *output)
+{
+    const int frames = MFCC_FEATURE_WINDOW_FRAMES;
+    const uint32_t first = mfcc->frame_count - frames;
+    float max_db = -INFINITY;
+
+    if (mfcc->frame_count < MFCC_FEATURE_WINDOW_FRAMES)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    for (int t = 0; t < frames; t++)
+    {
+        const float *log_mel = mfcc_feature_log_mel_row(mfcc, first + t);
+        for (int m = 0; m < MFCC_FEATURE_N_MELS; m++)
+        {
+            if (log_mel[m] > max_db)
+                max_db = log_mel[m];
+        }
+    }
+
+    for (int t = 0; t < frames; t++)
+    {
+        mfcc_feature_dct(mfcc_feature_log_mel_row(mfcc, first + t), max_db - MFCC_FEATURE_TOP_DB,
+                         output + t * MFCC_FEATURE_N_MFCC);
+    }
+
+    // 与 mfcc_process.py 相同: 沿时间轴逐系数标准化 (总体标准差)
+    for (int k = 0; k < MFCC_FEATURE_N_MFCC; k++)
+    {
+        float mean = 0.0f;
+        float var = 0.0f;
+        for (int t = 0; t < frames; t++)
+            mean += output[t * MFCC_FEATURE_N_MFCC + k];
+        mean /= frames;
+        for (int t = 0; t < frames; t++)
+        {
+            float d = output[t * MFCC_FEATURE_N_MFCC + k] - mean;
+            var += d * d;
+        }
+        float inv_std = 1.0f / sqrtf(var / frames);
+        for (int t = 0; t < frames; t++)
+            output[t * MFCC_FEATURE_N_MFCC + k] = (output[t * MFCC_FEATURE_N_MFCC + k] - mean) * inv_std;
+    }
+    return ESP_OK;
+}
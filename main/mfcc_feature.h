@@ -0,0 +1,44 @@
+#ifndef MFCC_FEATURE_H
+#define MFCC_FEATURE_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+// 与 script/mfcc_process.py 一致: 25ms 窗, 10ms 帧移, 40 个系数, 1.2s 共 121 帧
+#define MFCC_FEATURE_SAMPLE_RATE    16000
+#define MFCC_FEATURE_N_FFT          400
+#define MFCC_FEATURE_HOP_LENGTH     160
+#define MFCC_FEATURE_N_MELS         128
+#define MFCC_FEATURE_N_MFCC         40
+#define MFCC_FEATURE_WINDOW_FRAMES  121
+#define MFCC_FEATURE_TOP_DB         80.0f
+
+typedef struct {
+    float samples[MFCC_FEATURE_N_FFT];  // 当前分析窗 (含 center 填充)
+    int filled;                         // samples 中已有的样本数
+    uint32_t frame_count;               // 已产生的帧数
+    float running_max_db;               // 流式输出使用的 top_db 参考
+    float *log_mel;                     // 最近 WINDOW_FRAMES 帧的 log-mel, 环形存放
+} mfcc_feature_t;
+
+esp_err_t mfcc_feature_init(mfcc_feature_t *mfcc);
+void mfcc_feature_deinit(mfcc_feature_t *mfcc);
+void mfcc_feature_reset(mfcc_feature_t *mfcc);
+
+/**
+ * @brief 送入 PCM16 样本, 每凑满一个 10ms 帧移输出一帧 MFCC.
+ * 流式帧的 top_db 下限取 "到目前为止的最大值 - 80dB", 不做归一化.
+ * @return 写入 output 的帧数 (每帧 MFCC_FEATURE_N_MFCC 个 float)
+ */
+int mfcc_feature_push(mfcc_feature_t *mfcc, const int16_t *pcm, int samples, float *output, int max_frames);
+
+// 补齐 librosa center=True 的尾部零填充, 输出剩余帧
+int mfcc_feature_flush(mfcc_feature_t *mfcc, float *output, int max_frames);
+
+/**
+ * @brief 用最近 121 帧的 log-mel 计算与 mfcc_process.py 一致的 121x40 特征:
+ * 整窗 top_db 截断, DCT-II (ortho), 再逐系数减均值除标准差.
+ */
+esp_err_t mfcc_feature_get_window(mfcc_feature_t *mfcc, float *output);
+
+#endif // MFCC_FEATURE_H
@@ -0,0 +1,957 @@
+// 由 script/mfcc_tables.py 生成, 请勿手工修改
+#ifndef MFCC_TABLES_H
+#define MFCC_TABLES_H
+
+#include <stdint.h>
+
+#define MFCC_TABLE_N_FFT       400
+#define MFCC_TABLE_N_BINS      201
+#define MFCC_TABLE_N_MELS      128
+#define MFCC_TABLE_N_MFCC      40
+#define MFCC_TABLE_MEL_WEIGHTS 394
+
+static const float mfcc_window[400] = {
+    0.000000000e+00f, 6.168375917e-05f, 2.467198171e-04f, 5.550625190e-04f, 9.866357859e-04f, 1.541333133e-03f, 2.219017698e-03f, 3.019522272e-03f,
+    3.942649343e-03f, 4.988171142e-03f, 6.155829702e-03f, 7.445336923e-03f, 8.856374636e-03f, 1.038859469e-02f, 1.204161903e-02f, 1.381503980e-02f,
+    1.570841944e-02f, 1.772129077e-02f, 1.985315716e-02f, 2.210349260e-02f, 2.447174185e-02f, 2.695732059e-02f, 2.955961552e-02f, 3.227798459e-02f,
+    3.511175706e-02f, 3.806023374e-02f, 4.112268716e-02f, 4.429836168e-02f, 4.758647377e-02f, 5.098621212e-02f, 5.449673791e-02f, 5.811718496e-02f,
+    6.184665998e-02f, 6.568424278e-02f, 6.962898650e-02f, 7.367991782e-02f, 7.783603725e-02f, 8.209631932e-02f, 8.645971286e-02f, 9.092514129e-02f,
+    9.549150281e-02f, 1.001576708e-01f, 1.049224938e-01f, 1.097847963e-01f, 1.147433786e-01f, 1.197970172e-01f, 1.249444652e-01f, 1.301844525e-01f,
+    1.355156863e-01f, 1.409368511e-01f, 1.464466094e-01f, 1.520436017e-01f, 1.577264470e-01f, 1.634937432e-01f, 1.693440673e-01f, 1.752759758e-01f,
+    1.812880051e-01f, 1.873786718e-01f, 1.935464732e-01f, 1.997898873e-01f, 2.061073739e-01f, 2.124973740e-01f, 2.189583111e-01f, 2.254885910e-01f,
+    2.320866025e-01f, 2.387507176e-01f, 2.454792921e-01f, 2.522706658e-01f, 2.591231629e-01f, 2.660350929e-01f, 2.730047501e-01f, 2.800304151e-01f,
+    2.871103542e-01f, 2.942428207e-01f, 3.014260547e-01f, 3.086582838e-01f, 3.159377237e-01f, 3.232625781e-01f, 3.306310399e-01f, 3.380412909e-01f,
+    3.454915028e-01f, 3.529798374e-01f, 3.605044470e-01f, 3.680634750e-01f, 3.756550564e-01f, 3.832773181e-01f, 3.909283793e-01f, 3.986063523e-01f,
+    4.063093427e-01f, 4.140354499e-01f, 4.217827675e-01f, 4.295493840e-01f, 4.373333832e-01f, 4.451328445e-01f, 4.529458433e-01f, 4.607704521e-01f,
+    4.686047402e-01f, 4.764467746e-01f, 4.842946205e-01f, 4.921463413e-01f, 5.000000000e-01f, 5.078536587e-01f, 5.157053795e-01f, 5.235532254e-01f,
+    5.313952598e-01f, 5.392295479e-01f, 5.470541567e-01f, 5.548671555e-01f, 5.626666168e-01f, 5.704506160e-01f, 5.782172325e-01f, 5.859645501e-01f,
+    5.936906573e-01f, 6.013936477e-01f, 6.090716207e-01f, 6.167226819e-01f, 6.243449436e-01f, 6.319365250e-01f, 6.394955530e-01f, 6.470201626e-01f,
+    6.545084972e-01f, 6.619587091e-01f, 6.693689601e-01f, 6.767374219e-01f, 6.840622763e-01f, 6.913417162e-01f, 6.985739453e-01f, 7.057571793e-01f,
+    7.128896458e-01f, 7.199695849e-01f, 7.269952499e-01f, 7.339649071e-01f, 7.408768371e-01f, 7.477293342e-01f, 7.545207079e-01f, 7.612492824e-01f,
+    7.679133975e-01f, 7.745114090e-01f, 7.810416889e-01f, 7.875026260e-01f, 7.938926261e-01f, 8.002101127e-01f, 8.064535268e-01f, 8.126213282e-01f,
+    8.187119949e-01f, 8.247240242e-01f, 8.306559327e-01f, 8.365062568e-01f, 8.422735530e-01f, 8.479563983e-01f, 8.535533906e-01f, 8.590631489e-01f,
+    8.644843137e-01f, 8.698155475e-01f, 8.750555348e-01f, 8.802029828e-01f, 8.852566214e-01f, 8.902152037e-01f, 8.950775062e-01f, 8.998423292e-01f,
+    9.045084972e-01f, 9.090748587e-01f, 9.135402871e-01f, 9.179036807e-01f, 9.221639628e-01f, 9.263200822e-01f, 9.303710135e-01f, 9.343157572e-01f,
+    9.381533400e-01f, 9.418828150e-01f, 9.455032621e-01f, 9.490137879e-01f, 9.524135262e-01f, 9.557016383e-01f, 9.588773128e-01f, 9.619397663e-01f,
+    9.648882429e-01f, 9.677220154e-01f, 9.704403845e-01f, 9.730426794e-01f, 9.755282581e-01f, 9.778965074e-01f, 9.801468428e-01f, 9.822787092e-01f,
+    9.842915806e-01f, 9.861849602e-01f, 9.879583810e-01f, 9.896114053e-01f, 9.911436254e-01f, 9.925546631e-01f, 9.938441703e-01f, 9.950118289e-01f,
+    9.960573507e-01f, 9.969804777e-01f, 9.977809823e-01f, 9.984586669e-01f, 9.990133642e-01f, 9.994449375e-01f, 9.997532802e-01f, 9.999383162e-01f,
+    1.000000000e+00f, 9.999383162e-01f, 9.997532802e-01f, 9.994449375e-01f, 9.990133642e-01f, 9.984586669e-01f, 9.977809823e-01f, 9.969804777e-01f,
+    9.960573507e-01f, 9.950118289e-01f, 9.938441703e-01f, 9.925546631e-01f, 9.911436254e-01f, 9.896114053e-01f, 9.879583810e-01f, 9.861849602e-01f,
+    9.842915806e-01f, 9.822787092e-01f, 9.801468428e-01f, 9.778965074e-01f, 9.755282581e-01f, 9.730426794e-01f, 9.704403845e-01f, 9.677220154e-01f,
+    9.648882429e-01f, 9.619397663e-01f, 9.588773128e-01f, 9.557016383e-01f, 9.524135262e-01f, 9.490137879e-01f, 9.455032621e-01f, 9.418828150e-01f,
+    9.381533400e-01f, 9.343157572e-01f, 9.303710135e-01f, 9.263200822e-01f, 9.221639628e-01f, 9.179036807e-01f, 9.135402871e-01f, 9.090748587e-01f,
+    9.045084972e-01f, 8.998423292e-01f, 8.950775062e-01f, 8.902152037e-01f, 8.852566214e-01f, 8.802029828e-01f, 8.750555348e-01f, 8.698155475e-01f,
+    8.644843137e-01f, 8.590631489e-01f, 8.535533906e-01f, 8.479563983e-01f, 8.422735530e-01f, 8.365062568e-01f, 8.306559327e-01f, 8.247240242e-01f,
+    8.187119949e-01f, 8.126213282e-01f, 8.064535268e-01f, 8.002101127e-01f, 7.938926261e-01f, 7.875026260e-01f, 7.810416889e-01f, 7.745114090e-01f,
+    7.679133975e-01f, 7.612492824e-01f, 7.545207079e-01f, 7.477293342e-01f, 7.408768371e-01f, 7.339649071e-01f, 7.269952499e-01f, 7.199695849e-01f,
+    7.128896458e-01f, 7.057571793e-01f, 6.985739453e-01f, 6.913417162e-01f, 6.840622763e-01f, 6.767374219e-01f, 6.693689601e-01f, 6.619587091e-01f,
+    6.545084972e-01f, 6.470201626e-01f, 6.394955530e-01f, 6.319365250e-01f, 6.243449436e-01f, 6.167226819e-01f, 6.090716207e-01f, 6.013936477e-01f,
+    5.936906573e-01f, 5.859645501e-01f, 5.782172325e-01f, 5.704506160e-01f, 5.626666168e-01f, 5.548671555e-01f, 5.470541567e-01f, 5.392295479e-01f,
+    5.313952598e-01f, 5.235532254e-01f, 5.157053795e-01f, 5.078536587e-01f, 5.000000000e-01f, 4.921463413e-01f, 4.842946205e-01f, 4.764467746e-01f,
+    4.686047402e-01f, 4.607704521e-01f, 4.529458433e-01f, 4.451328445e-01f, 4.373333832e-01f, 4.295493840e-01f, 4.217827675e-01f, 4.140354499e-01f,
+    4.063093427e-01f, 3.986063523e-01f, 3.909283793e-01f, 3.832773181e-01f, 3.756550564e-01f, 3.680634750e-01f, 3.605044470e-01f, 3.529798374e-01f,
+    3.454915028e-01f, 3.380412909e-01f, 3.306310399e-01f, 3.232625781e-01f, 3.159377237e-01f, 3.086582838e-01f, 3.014260547e-01f, 2.942428207e-01f,
+    2.871103542e-01f, 2.800304151e-01f, 2.730047501e-01f, 2.660350929e-01f, 2.591231629e-01f, 2.522706658e-01f, 2.454792921e-01f, 2.387507176e-01f,
+    2.320866025e-01f, 2.254885910e-01f, 2.189583111e-01f, 2.124973740e-01f, 2.061073739e-01f, 1.997898873e-01f, 1.935464732e-01f, 1.873786718e-01f,
+    1.812880051e-01f, 1.752759758e-01f, 1.693440673e-01f, 1.634937432e-01f, 1.577264470e-01f, 1.520436017e-01f, 1.464466094e-01f, 1.409368511e-01f,
+    1.355156863e-01f, 1.301844525e-01f, 1.249444652e-01f, 1.197970172e-01f, 1.147433786e-01f, 1.097847963e-01f, 1.049224938e-01f, 1.001576708e-01f,
+    9.549150281e-02f, 9.092514129e-02f, 8.645971286e-02f, 8.209631932e-02f, 7.783603725e-02f, 7.367991782e-02f, 6.962898650e-02f, 6.568424278e-02f,
+    6.184665998e-02f, 5.811718496e-02f, 5.449673791e-02f, 5.098621212e-02f, 4.758647377e-02f, 4.429836168e-02f, 4.112268716e-02f, 3.806023374e-02f,
+    3.511175706e-02f, 3.227798459e-02f, 2.955961552e-02f, 2.695732059e-02f, 2.447174185e-02f, 2.210349260e-02f, 1.985315716e-02f, 1.772129077e-02f,
+    1.570841944e-02f, 1.381503980e-02f, 1.204161903e-02f, 1.038859469e-02f, 8.856374636e-03f, 7.445336923e-03f, 6.155829702e-03f, 4.988171142e-03f,
+    3.942649343e-03f, 3.019522272e-03f, 2.219017698e-03f, 1.541333133e-03f, 9.866357859e-04f, 5.550625190e-04f, 2.467198171e-04f, 6.168375917e-05f,
+};
+
+static const float mfcc_twiddle[400][2] = {
+    {1.000000000e+00f, -0.000000000e+00f}, {9.998766325e-01f, -1.570731731e-02f}, {9.995065604e-01f, -3.141075908e-02f}, {9.988898750e-01f, -4.710645071e-02f},
+    {9.980267284e-01f, -6.279051953e-02f}, {9.969173337e-01f, -7.845909573e-02f}, {9.955619646e-01f, -9.410831332e-02f}, {9.939609555e-01f, -1.097343111e-01f},
+    {9.921147013e-01f, -1.253332336e-01f}, {9.900236577e-01f, -1.409012319e-01f}, {9.876883406e-01f, -1.564344650e-01f}, {9.851093262e-01f, -1.719291003e-01f},
+    {9.822872507e-01f, -1.873813146e-01f}, {9.792228106e-01f, -2.027872954e-01f}, {9.759167619e-01f, -2.181432414e-01f}, {9.723699204e-01f, -2.334453639e-01f},
+    {9.685831611e-01f, -2.486898872e-01f}, {9.645574185e-01f, -2.638730500e-01f}, {9.602936857e-01f, -2.789911060e-01f}, {9.557930148e-01f, -2.940403252e-01f},
+    {9.510565163e-01f, -3.090169944e-01f}, {9.460853588e-01f, -3.239174182e-01f}, {9.408807690e-01f, -3.387379202e-01f}, {9.354440308e-01f, -3.534748438e-01f},
+    {9.297764859e-01f, -3.681245527e-01f}, {9.238795325e-01f, -3.826834324e-01f}, {9.177546257e-01f, -3.971478906e-01f}, {9.114032766e-01f, -4.115143586e-01f},
+    {9.048270525e-01f, -4.257792916e-01f}, {8.980275758e-01f, -4.399391699e-01f}, {8.910065242e-01f, -4.539904997e-01f}, {8.837656301e-01f, -4.679298143e-01f},
+    {8.763066800e-01f, -4.817536741e-01f}, {8.686315144e-01f, -4.954586684e-01f}, {8.607420270e-01f, -5.090414158e-01f}, {8.526401644e-01f, -5.224985647e-01f},
+    {8.443279255e-01f, -5.358267950e-01f}, {8.358073614e-01f, -5.490228180e-01f}, {8.270805743e-01f, -5.620833779e-01f}, {8.181497174e-01f, -5.750052520e-01f},
+    {8.090169944e-01f, -5.877852523e-01f}, {7.996846585e-01f, -6.004202253e-01f}, {7.901550124e-01f, -6.129070537e-01f}, {7.804304073e-01f, -6.252426563e-01f},
+    {7.705132428e-01f, -6.374239897e-01f}, {7.604059656e-01f, -6.494480483e-01f}, {7.501110696e-01f, -6.613118653e-01f}, {7.396310950e-01f, -6.730125135e-01f},
+    {7.289686274e-01f, -6.845471059e-01f}, {7.181262978e-01f, -6.959127966e-01f}, {7.071067812e-01f, -7.071067812e-01f}, {6.959127966e-01f, -7.181262978e-01f},
+    {6.845471059e-01f, -7.289686274e-01f}, {6.730125135e-01f, -7.396310950e-01f}, {6.613118653e-01f, -7.501110696e-01f}, {6.494480483e-01f, -7.604059656e-01f},
+    {6.374239897e-01f, -7.705132428e-01f}, {6.252426563e-01f, -7.804304073e-01f}, {6.129070537e-01f, -7.901550124e-01f}, {6.004202253e-01f, -7.996846585e-01f},
+    {5.877852523e-01f, -8.090169944e-01f}, {5.750052520e-01f, -8.181497174e-01f}, {5.620833779e-01f, -8.270805743e-01f}, {5.490228180e-01f, -8.358073614e-01f},
+    {5.358267950e-01f, -8.443279255e-01f}, {5.224985647e-01f, -8.526401644e-01f}, {5.090414158e-01f, -8.607420270e-01f}, {4.954586684e-01f, -8.686315144e-01f},
+    {4.817536741e-01f, -8.763066800e-01f}, {4.679298143e-01f, -8.837656301e-01f}, {4.539904997e-01f, -8.910065242e-01f}, {4.399391699e-01f, -8.980275758e-01f},
+    {4.257792916e-01f, -9.048270525e-01f}, {4.115143586e-01f, -9.114032766e-01f}, {3.971478906e-01f, -9.177546257e-01f}, {3.826834324e-01f, -9.238795325e-01f},
+    {3.681245527e-01f, -9.297764859e-01f}, {3.534748438e-01f, -9.354440308e-01f}, {3.387379202e-01f, -9.408807690e-01f}, {3.239174182e-01f, -9.460853588e-01f},
+    {3.090169944e-01f, -9.510565163e-01f}, {2.940403252e-01f, -9.557930148e-01f}, {2.789911060e-01f, -9.602936857e-01f}, {2.638730500e-01f, -9.645574185e-01f},
+    {2.486898872e-01f, -9.685831611e-01f}, {2.334453639e-01f, -9.723699204e-01f}, {2.181432414e-01f, -9.759167619e-01f}, {2.027872954e-01f, -9.792228106e-01f},
+    {1.873813146e-01f, -9.822872507e-01f}, {1.719291003e-01f, -9.851093262e-01f}, {1.564344650e-01f, -9.876883406e-01f}, {1.409012319e-01f, -9.900236577e-01f},
+    {1.253332336e-01f, -9.921147013e-01f}, {1.097343111e-01f, -9.939609555e-01f}, {9.410831332e-02f, -9.955619646e-01f}, {7.845909573e-02f, -9.969173337e-01f},
+    {6.279051953e-02f, -9.980267284e-01f}, {4.710645071e-02f, -9.988898750e-01f}, {3.141075908e-02f, -9.995065604e-01f}, {1.570731731e-02f, -9.998766325e-01f},
+    {6.123233996e-17f, -1.000000000e+00f}, {-1.570731731e-02f, -9.998766325e-01f}, {-3.141075908e-02f, -9.995065604e-01f}, {-4.710645071e-02f, -9.988898750e-01f},
+    {-6.279051953e-02f, -9.980267284e-01f}, {-7.845909573e-02f, -9.969173337e-01f}, {-9.410831332e-02f, -9.955619646e-01f}, {-1.097343111e-01f, -9.939609555e-01f},
+    {-1.253332336e-01f, -9.921147013e-01f}, {-1.409012319e-01f, -9.900236577e-01f}, {-1.564344650e-01f, -9.876883406e-01f}, {-1.719291003e-01f, -9.851093262e-01f},
+    {-1.873813146e-01f, -9.822872507e-01f}, {-2.027872954e-01f, -9.792228106e-01f}, {-2.181432414e-01f, -9.759167619e-01f}, {-2.334453639e-01f, -9.723699204e-01f},
+    {-2.486898872e-01f, -9.685831611e-01f}, {-2.638730500e-01f, -9.645574185e-01f}, {-2.789911060e-01f, -9.602936857e-01f}, {-2.940403252e-01f, -9.557930148e-01f},
+    {-3.090169944e-01f, -9.510565163e-01f}, {-3.239174182e-01f, -9.460853588e-01f}, {-3.387379202e-01f, -9.408807690e-01f}, {-3.534748438e-01f, -9.354440308e-01f},
+    {-3.681245527e-01f, -9.297764859e-01f}, {-3.826834324e-01f, -9.238795325e-01f}, {-3.971478906e-01f, -9.177546257e-01f}, {-4.115143586e-01f, -9.114032766e-01f},
+    {-4.257792916e-01f, -9.048270525e-01f}, {-4.399391699e-01f, -8.980275758e-01f}, {-4.539904997e-01f, -8.910065242e-01f}, {-4.679298143e-01f, -8.837656301e-01f},
+    {-4.817536741e-01f, -8.763066800e-01f}, {-4.954586684e-01f, -8.686315144e-01f}, {-5.090414158e-01f, -8.607420270e-01f}, {-5.224985647e-01f, -8.526401644e-01f},
+    {-5.358267950e-01f, -8.443279255e-01f}, {-5.490228180e-01f, -8.358073614e-01f}, {-5.620833779e-01f, -8.270805743e-01f}, {-5.750052520e-01f, -8.181497174e-01f},
+    {-5.877852523e-01f, -8.090169944e-01f}, {-6.004202253e-01f, -7.996846585e-01f}, {-6.129070537e-01f, -7.901550124e-01f}, {-6.252426563e-01f, -7.804304073e-01f},
+    {-6.374239897e-01f, -7.705132428e-01f}, {-6.494480483e-01f, -7.604059656e-01f}, {-6.613118653e-01f, -7.501110696e-01f}, {-6.730125135e-01f, -7.396310950e-01f},
+    {-6.845471059e-01f, -7.289686274e-01f}, {-6.959127966e-01f, -7.181262978e-01f}, {-7.071067812e-01f, -7.071067812e-01f}, {-7.181262978e-01f, -6.959127966e-01f},
+    {-7.289686274e-01f, -6.845471059e-01f}, {-7.396310950e-01f, -6.730125135e-01f}, {-7.501110696e-01f, -6.613118653e-01f}, {-7.604059656e-01f, -6.494480483e-01f},
+    {-7.705132428e-01f, -6.374239897e-01f}, {-7.804304073e-01f, -6.252426563e-01f}, {-7.901550124e-01f, -6.129070537e-01f}, {-7.996846585e-01f, -6.004202253e-01f},
+    {-8.090169944e-01f, -5.877852523e-01f}, {-8.181497174e-01f, -5.750052520e-01f}, {-8.270805743e-01f, -5.620833779e-01f}, {-8.358073614e-01f, -5.490228180e-01f},
+    {-8.443279255e-01f, -5.358267950e-01f}, {-8.526401644e-01f, -5.224985647e-01f}, {-8.607420270e-01f, -5.090414158e-01f}, {-8.686315144e-01f, -4.954586684e-01f},
+    {-8.763066800e-01f, -4.817536741e-01f}, {-8.837656301e-01f, -4.679298143e-01f}, {-8.910065242e-01f, -4.539904997e-01f}, {-8.980275758e-01f, -4.399391699e-01f},
+    {-9.048270525e-01f, -4.257792916e-01f}, {-9.114032766e-01f, -4.115143586e-01f}, {-9.177546257e-01f, -3.971478906e-01f}, {-9.238795325e-01f, -3.826834324e-01f},
+    {-9.297764859e-01f, -3.681245527e-01f}, {-9.354440308e-01f, -3.534748438e-01f}, {-9.408807690e-01f, -3.387379202e-01f}, {-9.460853588e-01f, -3.239174182e-01f},
+    {-9.510565163e-01f, -3.090169944e-01f}, {-9.557930148e-01f, -2.940403252e-01f}, {-9.602936857e-01f, -2.789911060e-01f}, {-9.645574185e-01f, -2.638730500e-01f},
+    {-9.685831611e-01f, -2.486898872e-01f}, {-9.723699204e-01f, -2.334453639e-01f}, {-9.759167619e-01f, -2.181432414e-01f}, {-9.792228106e-01f, -2.027872954e-01f},
+    {-9.822872507e-01f, -1.873813146e-01f}, {-9.851093262e-01f, -1.719291003e-01f}, {-9.876883406e-01f, -1.564344650e-01f}, {-9.900236577e-01f, -1.409012319e-01f},
+    {-9.921147013e-01f, -1.253332336e-01f}, {-9.939609555e-01f, -1.097343111e-01f}, {-9.955619646e-01f, -9.410831332e-02f}, {-9.969173337e-01f, -7.845909573e-02f},
+    {-9.980267284e-01f, -6.279051953e-02f}, {-9.988898750e-01f, -4.710645071e-02f}, {-9.995065604e-01f, -3.141075908e-02f}, {-9.998766325e-01f, -1.570731731e-02f},
+    {-1.000000000e+00f, -1.224646799e-16f}, {-9.998766325e-01f, 1.570731731e-02f}, {-9.995065604e-01f, 3.141075908e-02f}, {-9.988898750e-01f, 4.710645071e-02f},
+    {-9.980267284e-01f, 6.279051953e-02f}, {-9.969173337e-01f, 7.845909573e-02f}, {-9.955619646e-01f, 9.410831332e-02f}, {-9.939609555e-01f, 1.097343111e-01f},
+    {-9.921147013e-01f, 1.253332336e-01f}, {-9.900236577e-01f, 1.409012319e-01f}, {-9.876883406e-01f, 1.564344650e-01f}, {-9.851093262e-01f, 1.719291003e-01f},
+    {-9.822872507e-01f, 1.873813146e-01f}, {-9.792228106e-01f, 2.027872954e-01f}, {-9.759167619e-01f, 2.181432414e-01f}, {-9.723699204e-01f, 2.334453639e-01f},
+    {-9.685831611e-01f, 2.486898872e-01f}, {-9.645574185e-01f, 2.638730500e-01f}, {-9.602936857e-01f, 2.789911060e-01f}, {-9.557930148e-01f, 2.940403252e-01f},
+    {-9.510565163e-01f, 3.090169944e-01f}, {-9.460853588e-01f, 3.239174182e-01f}, {-9.408807690e-01f, 3.387379202e-01f}, {-9.354440308e-01f, 3.534748438e-01f},
+    {-9.297764859e-01f, 3.681245527e-01f}, {-9.238795325e-01f, 3.826834324e-01f}, {-9.177546257e-01f, 3.971478906e-01f}, {-9.114032766e-01f, 4.115143586e-01f},
+    {-9.048270525e-01f, 4.257792916e-01f}, {-8.980275758e-01f, 4.399391699e-01f}, {-8.910065242e-01f, 4.539904997e-01f}, {-8.837656301e-01f, 4.679298143e-01f},
+    {-8.763066800e-01f, 4.817536741e-01f}, {-8.686315144e-01f, 4.954586684e-01f}, {-8.607420270e-01f, 5.090414158e-01f}, {-8.526401644e-01f, 5.224985647e-01f},
+    {-8.443279255e-01f, 5.358267950e-01f}, {-8.358073614e-01f, 5.490228180e-01f}, {-8.270805743e-01f, 5.620833779e-01f}, {-8.181497174e-01f, 5.750052520e-01f},
+    {-8.090169944e-01f, 5.877852523e-01f}, {-7.996846585e-01f, 6.004202253e-01f}, {-7.901550124e-01f, 6.129070537e-01f}, {-7.804304073e-01f, 6.252426563e-01f},
+    {-7.705132428e-01f, 6.374239897e-01f}, {-7.604059656e-01f, 6.494480483e-01f}, {-7.501110696e-01f, 6.613118653e-01f}, {-7.396310950e-01f, 6.730125135e-01f},
+    {-7.289686274e-01f, 6.845471059e-01f}, {-7.181262978e-01f, 6.959127966e-01f}, {-7.071067812e-01f, 7.071067812e-01f}, {-6.959127966e-01f, 7.181262978e-01f},
+    {-6.845471059e-01f, 7.289686274e-01f}, {-6.730125135e-01f, 7.396310950e-01f}, {-6.613118653e-01f, 7.501110696e-01f}, {-6.494480483e-01f, 7.604059656e-01f},
+    {-6.374239897e-01f, 7.705132428e-01f}, {-6.252426563e-01f, 7.804304073e-01f}, {-6.129070537e-01f, 7.901550124e-01f}, {-6.004202253e-01f, 7.996846585e-01f},
+    {-5.877852523e-01f, 8.090169944e-01f}, {-5.750052520e-01f, 8.181497174e-01f}, {-5.620833779e-01f, 8.270805743e-01f}, {-5.490228180e-01f, 8.358073614e-01f},
+    {-5.358267950e-01f, 8.443279255e-01f}, {-5.224985647e-01f, 8.526401644e-01f}, {-5.090414158e-01f, 8.607420270e-01f}, {-4.954586684e-01f, 8.686315144e-01f},
+    {-4.817536741e-01f, 8.763066800e-01f}, {-4.679298143e-01f, 8.837656301e-01f}, {-4.539904997e-01f, 8.910065242e-01f}, {-4.399391699e-01f, 8.980275758e-01f},
+    {-4.257792916e-01f, 9.048270525e-01f}, {-4.115143586e-01f, 9.114032766e-01f}, {-3.971478906e-01f, 9.177546257e-01f}, {-3.826834324e-01f, 9.238795325e-01f},
+    {-3.681245527e-01f, 9.297764859e-01f}, {-3.534748438e-01f, 9.354440308e-01f}, {-3.387379202e-01f, 9.408807690e-01f}, {-3.239174182e-01f, 9.460853588e-01f},
+    {-3.090169944e-01f, 9.510565163e-01f}, {-2.940403252e-01f, 9.557930148e-01f}, {-2.789911060e-01f, 9.602936857e-01f}, {-2.638730500e-01f, 9.645574185e-01f},
+    {-2.486898872e-01f, 9.685831611e-01f}, {-2.334453639e-01f, 9.723699204e-01f}, {-2.181432414e-01f, 9.759167619e-01f}, {-2.027872954e-01f, 9.792228106e-01f},
+    {-1.873813146e-01f, 9.822872507e-01f}, {-1.719291003e-01f, 9.851093262e-01f}, {-1.564344650e-01f, 9.876883406e-01f}, {-1.409012319e-01f, 9.900236577e-01f},
+    {-1.253332336e-01f, 9.921147013e-01f}, {-1.097343111e-01f, 9.939609555e-01f}, {-9.410831332e-02f, 9.955619646e-01f}, {-7.845909573e-02f, 9.969173337e-01f},
+    {-6.279051953e-02f, 9.980267284e-01f}, {-4.710645071e-02f, 9.988898750e-01f}, {-3.141075908e-02f, 9.995065604e-01f}, {-1.570731731e-02f, 9.998766325e-01f},
+    {-1.836970199e-16f, 1.000000000e+00f}, {1.570731731e-02f, 9.998766325e-01f}, {3.141075908e-02f, 9.995065604e-01f}, {4.710645071e-02f, 9.988898750e-01f},
+    {6.279051953e-02f, 9.980267284e-01f}, {7.845909573e-02f, 9.969173337e-01f}, {9.410831332e-02f, 9.955619646e-01f}, {1.097343111e-01f, 9.939609555e-01f},
+    {1.253332336e-01f, 9.921147013e-01f}, {1.409012319e-01f, 9.900236577e-01f}, {1.564344650e-01f, 9.876883406e-01f}, {1.719291003e-01f, 9.851093262e-01f},
+    {1.873813146e-01f, 9.822872507e-01f}, {2.027872954e-01f, 9.792228106e-01f}, {2.181432414e-01f, 9.759167619e-01f}, {2.334453639e-01f, 9.723699204e-01f},
+    {2.486898872e-01f, 9.685831611e-01f}, {2.638730500e-01f, 9.645574185e-01f}, {2.789911060e-01f, 9.602936857e-01f}, {2.940403252e-01f, 9.557930148e-01f},
+    {3.090169944e-01f, 9.510565163e-01f}, {3.239174182e-01f, 9.460853588e-01f}, {3.387379202e-01f, 9.408807690e-01f}, {3.534748438e-01f, 9.354440308e-01f},
+    {3.681245527e-01f, 9.297764859e-01f}, {3.826834324e-01f, 9.238795325e-01f}, {3.971478906e-01f, 9.177546257e-01f}, {4.115143586e-01f, 9.114032766e-01f},
+    {4.257792916e-01f, 9.048270525e-01f}, {4.399391699e-01f, 8.980275758e-01f}, {4.539904997e-01f, 8.910065242e-01f}, {4.679298143e-01f, 8.837656301e-01f},
+    {4.817536741e-01f, 8.763066800e-01f}, {4.954586684e-01f, 8.686315144e-01f}, {5.090414158e-01f, 8.607420270e-01f}, {5.224985647e-01f, 8.526401644e-01f},
+    {5.358267950e-01f, 8.443279255e-01f}, {5.490228180e-01f, 8.358073614e-01f}, {5.620833779e-01f, 8.270805743e-01f}, {5.750052520e-01f, 8.181497174e-01f},
+    {5.877852523e-01f, 8.090169944e-01f}, {6.004202253e-01f, 7.996846585e-01f}, {6.129070537e-01f, 7.901550124e-01f}, {6.252426563e-01f, 7.804304073e-01f},
+    {6.374239897e-01f, 7.705132428e-01f}, {6.494480483e-01f, 7.604059656e-01f}, {6.613118653e-01f, 7.501110696e-01f}, {6.730125135e-01f, 7.396310950e-01f},
+    {6.845471059e-01f, 7.289686274e-01f}, {6.959127966e-01f, 7.181262978e-01f}, {7.071067812e-01f, 7.071067812e-01f}, {7.181262978e-01f, 6.959127966e-01f},
+    {7.289686274e-01f, 6.845471059e-01f}, {7.396310950e-01f, 6.730125135e-01f}, {7.501110696e-01f, 6.613118653e-01f}, {7.604059656e-01f, 6.494480483e-01f},
+    {7.705132428e-01f, 6.374239897e-01f}, {7.804304073e-01f, 6.252426563e-01f}, {7.901550124e-01f, 6.129070537e-01f}, {7.996846585e-01f, 6.004202253e-01f},
+    {8.090169944e-01f, 5.877852523e-01f}, {8.181497174e-01f, 5.750052520e-01f}, {8.270805743e-01f, 5.620833779e-01f}, {8.358073614e-01f, 5.490228180e-01f},
+    {8.443279255e-01f, 5.358267950e-01f}, {8.526401644e-01f, 5.224985647e-01f}, {8.607420270e-01f, 5.090414158e-01f}, {8.686315144e-01f, 4.954586684e-01f},
+    {8.763066800e-01f, 4.817536741e-01f}, {8.837656301e-01f, 4.679298143e-01f}, {8.910065242e-01f, 4.539904997e-01f}, {8.980275758e-01f, 4.399391699e-01f},
+    {9.048270525e-01f, 4.257792916e-01f}, {9.114032766e-01f, 4.115143586e-01f}, {9.177546257e-01f, 3.971478906e-01f}, {9.238795325e-01f, 3.826834324e-01f},
+    {9.297764859e-01f, 3.681245527e-01f}, {9.354440308e-01f, 3.534748438e-01f}, {9.408807690e-01f, 3.387379202e-01f}, {9.460853588e-01f, 3.239174182e-01f},
+    {9.510565163e-01f, 3.090169944e-01f}, {9.557930148e-01f, 2.940403252e-01f}, {9.602936857e-01f, 2.789911060e-01f}, {9.645574185e-01f, 2.638730500e-01f},
+    {9.685831611e-01f, 2.486898872e-01f}, {9.723699204e-01f, 2.334453639e-01f}, {9.759167619e-01f, 2.181432414e-01f}, {9.792228106e-01f, 2.027872954e-01f},
+    {9.822872507e-01f, 1.873813146e-01f}, {9.851093262e-01f, 1.719291003e-01f}, {9.876883406e-01f, 1.564344650e-01f}, {9.900236577e-01f, 1.409012319e-01f},
+    {9.921147013e-01f, 1.253332336e-01f}, {9.939609555e-01f, 1.097343111e-01f}, {9.955619646e-01f, 9.410831332e-02f}, {9.969173337e-01f, 7.845909573e-02f},
+    {9.980267284e-01f, 6.279051953e-02f}, {9.988898750e-01f, 4.710645071e-02f}, {9.995065604e-01f, 3.141075908e-02f}, {9.998766325e-01f, 1.570731731e-02f},
+};
+
+static const uint16_t mfcc_mel_start[128] = {
+    1, 1, 2, 2, 3, 3, 4, 5, 5, 6, 6, 7, 8, 8, 9, 9, 10, 10, 11, 12, 12, 13, 13, 14, 15, 15, 16, 16, 17, 17, 18, 19, 19, 20, 20, 21, 22, 22, 23, 23, 24, 24, 25, 26, 26, 27, 28, 28, 29, 30, 30, 31, 32, 32, 33, 34, 35, 36, 37, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 48, 49, 50, 51, 52, 54, 55, 56, 58, 59, 60, 62, 63, 65, 66, 68, 70, 71, 73, 75, 77, 79, 80, 82, 84, 86, 89, 91, 93, 95, 98, 100, 102, 105, 107, 110, 113, 115, 118, 121, 124, 127, 130, 133, 136, 140, 143, 147, 150, 154, 158, 161, 165, 169, 174, 178, 182, 187, 191
+};
+
+static const uint16_t mfcc_mel_length[128] = {
+    1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 3, 3, 2, 3, 3, 2, 3, 3, 3, 3, 3, 4, 3, 3, 4, 4, 4, 3, 3, 4, 4, 5, 5, 4, 4, 5, 5, 4, 5, 5, 5, 6, 5, 5, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 8, 7, 7, 8, 9, 9, 8, 9, 9, 9, 9
+};
+
+static const uint16_t mfcc_mel_offset[128] = {
+    0, 1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 13, 14, 15, 16, 17, 18, 19, 21, 22, 23, 24, 25, 27, 28, 29, 30, 31, 32, 33, 35, 36, 37, 38, 39, 41, 42, 43, 44, 45, 46, 47, 49, 50, 51, 53, 54, 55, 57, 58, 59, 61, 62, 63, 65, 67, 69, 71, 72, 73, 75, 77, 79, 81, 83, 85, 87, 89, 92, 95, 97, 99, 101, 104, 107, 109, 112, 115, 117, 120, 123, 126, 129, 132, 136, 139, 142, 146, 150, 154, 157, 160, 164, 168, 173, 178, 182, 186, 191, 196, 200, 205, 210, 215, 221, 226, 231, 237, 243, 249, 255, 261, 267, 274, 281, 288, 295, 302, 310, 317, 324, 332, 341, 350, 358, 367, 376, 385
+};
+
+static const float mfcc_mel_weights[394] = {
+    1.237398633e-02f, 3.039256487e-02f, 2.474797267e-02f, 1.801857854e-02f, 3.712195900e-02f, 5.644592206e-03f, 6.729394127e-03f, 3.603715708e-02f,
+    1.910338046e-02f, 2.366317074e-02f, 3.147736679e-02f, 1.128918441e-02f, 1.084801920e-03f, 4.168174928e-02f, 1.345878825e-02f, 2.930776295e-02f,
+    2.583277459e-02f, 1.693377662e-02f, 3.820676092e-02f, 4.559790286e-03f, 7.814196047e-03f, 3.495235516e-02f, 2.018818238e-02f, 2.257836882e-02f,
+    3.256216871e-02f, 1.020438249e-02f, 2.169603841e-03f, 4.059694736e-02f, 1.454359017e-02f, 2.822296103e-02f, 2.691757651e-02f, 1.584897470e-02f,
+    3.929156284e-02f, 3.474988365e-03f, 8.898997968e-03f, 3.386755324e-02f, 2.127298430e-02f, 2.149356690e-02f, 3.364697063e-02f, 9.119580571e-03f,
+    3.254405761e-03f, 3.951214544e-02f, 1.562839209e-02f, 2.713815911e-02f, 2.800237843e-02f, 1.476417278e-02f, 4.037636476e-02f, 2.380687012e-03f,
+    1.020263784e-02f, 3.161145893e-02f, 2.454700101e-02f, 1.532919269e-02f, 1.665837493e-03f, 3.672905437e-02f, 2.009709915e-02f, 1.693102574e-02f,
+    2.902655431e-03f, 3.284498866e-02f, 2.352004862e-02f, 1.103894419e-02f, 1.072583026e-02f, 2.271829189e-02f, 3.227872585e-02f, 1.162683353e-04f,
+    2.285348238e-02f, 8.563439933e-03f, 1.497978766e-02f, 1.551398234e-02f, 8.514905883e-03f, 2.110680284e-02f, 3.326520248e-03f, 2.547064815e-02f,
+    2.735907907e-02f, 6.585361566e-04f, 2.383812588e-02f, 3.443592459e-03f, 2.122455325e-02f, 5.358421679e-03f, 1.942555665e-02f, 6.493247102e-03f,
+    1.835542045e-02f, 6.931380815e-03f, 1.793504753e-02f, 6.749682705e-03f, 1.809151762e-02f, 6.018991365e-03f, 1.875767283e-02f, 4.804528530e-03f,
+    1.987172863e-02f, 3.166278590e-03f, 2.137690893e-02f, 1.253173486e-03f, 1.159344640e-03f, 2.080361855e-02f, 4.044867930e-03f, 1.755363157e-02f,
+    7.083200397e-03f, 1.407538676e-02f, 1.032655085e-02f, 1.040921461e-02f, 1.373696253e-02f, 6.591876711e-03f, 1.727988240e-02f, 1.468042175e-03f,
+    2.656818988e-03f, 1.809193148e-02f, 5.856557352e-03f, 1.334277945e-02f, 1.028267572e-02f, 8.568003759e-03f, 1.472230797e-02f, 1.040398642e-03f,
+    3.790855709e-03f, 1.714678434e-02f, 6.116092981e-03f, 1.175929056e-02f, 1.113393728e-02f, 6.438578607e-03f, 1.607806250e-02f, 4.239172139e-03f,
+    1.199893810e-03f, 1.275671464e-02f, 9.652990155e-03f, 7.069352463e-03f, 1.494054690e-02f, 4.190248347e-03f, 1.514833890e-03f, 1.200899935e-02f,
+    9.848233326e-03f, 6.102240342e-03f, 1.533857181e-02f, 5.576768499e-03f, 3.682725780e-04f, 9.897494354e-03f, 1.135340463e-02f, 2.051222978e-03f,
+    3.892971461e-03f, 1.297352238e-02f, 8.066316753e-03f, 6.744931998e-03f, 1.385874671e-02f, 5.411905239e-03f, 7.422015626e-04f, 8.987791351e-03f,
+    1.137871405e-02f, 3.329580988e-03f, 2.823135450e-03f, 1.068049250e-02f, 9.433405802e-03f, 1.763255567e-03f, 4.390186075e-03f, 1.187758982e-02f,
+    7.970058323e-03f, 6.610470100e-04f, 5.494666930e-03f, 1.262953613e-02f, 6.939879592e-03f, 6.184019127e-03f, 1.293473180e-02f, 6.297787675e-03f,
+    2.325210227e-05f, 6.502066565e-03f, 1.232661750e-02f, 6.002165150e-03f, 3.154875478e-04f, 6.489255565e-03f, 1.204130236e-02f, 6.014628520e-03f,
+    2.997955637e-04f, 6.182879845e-03f, 1.204272761e-02f, 6.299811772e-03f, 5.568959320e-04f, 1.120470656e-05f, 5.617291713e-03f, 1.122337872e-02f,
+    6.825163240e-03f, 1.352645028e-03f, 4.824100257e-03f, 1.016623204e-02f, 7.560755010e-03f, 2.345903111e-03f, 3.832357305e-03f, 8.922961849e-03f,
+    8.479104127e-03f, 3.509786661e-03f, 2.668731866e-03f, 7.519651999e-03f, 9.555004914e-03f, 4.819661216e-03f, 8.431751844e-05f, 1.357673717e-03f,
+    5.980194665e-03f, 1.060271561e-02f, 6.252985473e-03f, 1.740599197e-03f, 4.326442432e-03f, 8.731318070e-03f, 7.789165184e-03f, 3.489238672e-03f,
+    2.578350835e-03f, 6.775828705e-03f, 9.409416248e-03f, 5.311946113e-03f, 1.214475978e-03f, 7.541119169e-04f, 4.753957069e-03f, 8.753802221e-03f,
+    7.192090317e-03f, 3.287544167e-03f, 2.681797043e-03f, 6.493314754e-03f, 9.114579712e-03f, 5.393873975e-03f, 1.673168238e-03f, 5.739429232e-04f,
+    4.206000343e-03f, 7.838057763e-03f, 7.520229748e-03f, 3.974708540e-03f, 4.291873318e-04f, 1.904644863e-03f, 5.365691643e-03f, 8.826738423e-03f,
+    6.276094678e-03f, 2.897509666e-03f, 2.898852554e-03f, 6.196940504e-03f, 8.566990506e-03f, 5.347481720e-03f, 2.127972934e-03f, 4.475022735e-04f,
+    3.590304097e-03f, 6.733105920e-03f, 7.770236142e-03f, 4.702313687e-03f, 1.634391232e-03f, 1.015360234e-03f, 4.010187372e-03f, 7.005014511e-03f,
+    7.234429978e-03f, 4.310956611e-03f, 1.387483244e-03f, 1.333488584e-03f, 4.187308231e-03f, 7.041127878e-03f, 6.931883349e-03f, 4.146057875e-03f,
+    1.360232401e-03f, 1.428797128e-03f, 4.148248435e-03f, 6.867699743e-03f, 6.837052791e-03f, 4.182394241e-03f, 1.527735690e-03f, 1.326104418e-03f,
+    3.917513942e-03f, 6.508923467e-03f, 6.926396644e-03f, 4.396729195e-03f, 1.867061746e-03f, 1.048277669e-03f, 3.517674089e-03f, 5.987070510e-03f,
+    7.178240466e-03f, 4.767679077e-03f, 2.357117688e-03f, 6.163640713e-04f, 2.969492213e-03f, 5.322620356e-03f, 7.572650754e-03f, 5.275587474e-03f,
+    2.978524193e-03f, 6.814609117e-04f, 4.971399559e-05f, 2.292048198e-03f, 4.534382401e-03f, 6.776716604e-03f, 5.902407391e-03f, 3.713498310e-03f,
+    1.524589228e-03f, 1.502853429e-03f, 3.639610280e-03f, 5.776367130e-03f, 6.631590765e-03f, 4.545743585e-03f, 2.459896404e-03f, 3.740492236e-04f,
+    6.179585952e-04f, 2.654109063e-03f, 4.690259531e-03f, 6.726409999e-03f, 5.460347044e-03f, 3.472709231e-03f, 1.485071417e-03f, 1.592335762e-03f,
+    3.532616767e-03f, 5.472897772e-03f, 6.443682645e-03f, 4.549630140e-03f, 2.655577636e-03f, 7.615251313e-04f, 4.674935156e-04f, 2.316418945e-03f,
+    4.165344374e-03f, 6.014269804e-03f, 5.678447273e-03f, 3.873573736e-03f, 2.068700199e-03f, 2.638266617e-04f, 1.053491057e-03f, 2.815362267e-03f,
+    4.577233478e-03f, 6.339104689e-03f, 5.128156790e-03f, 3.408263346e-03f, 1.688369902e-03f, 1.433500981e-03f, 3.112416806e-03f, 4.791332632e-03f,
+    6.409436688e-03f, 4.770522162e-03f, 3.131607636e-03f, 1.492693110e-03f, 2.932359032e-05f, 1.629189875e-03f, 3.229056160e-03f, 4.828922445e-03f,
+    6.146714364e-03f, 4.584965970e-03f, 3.023217576e-03f, 1.461469182e-03f, 1.360169807e-04f, 1.660555669e-03f, 3.185094356e-03f, 4.709633044e-03f,
+    6.040724042e-03f, 4.552508514e-03f, 3.064292986e-03f, 1.576077458e-03f, 8.786193011e-05f, 9.328097132e-05f, 1.546038763e-03f, 2.998796555e-03f,
+    4.451554346e-03f, 5.904312138e-03f, 4.655660906e-03f, 3.237516046e-03f, 1.819371186e-03f, 4.012263260e-04f, 1.302626344e-03f, 2.686982948e-03f,
+    4.071339552e-03f, 5.455696157e-03f, 4.878324732e-03f, 3.526951355e-03f, 2.175577978e-03f, 8.242046009e-04f, 9.459502754e-04f, 2.265126272e-03f,
+    3.584302269e-03f, 4.903478266e-03f, 5.205697910e-03f, 3.917952168e-03f, 2.630206427e-03f, 1.342460686e-03f, 5.471494443e-05f, 4.903789559e-04f,
+    1.747443288e-03f, 3.004507621e-03f, 4.261571954e-03f, 5.518636286e-03f, 4.397072445e-03f, 3.169958515e-03f, 1.942844586e-03f, 7.157306573e-04f,
+    1.146980592e-03f, 2.344857706e-03f, 3.542734820e-03f, 4.740611934e-03f, 4.951984363e-03f, 3.782647477e-03f, 2.613310591e-03f, 1.443973705e-03f,
+    2.746368193e-04f, 4.756950835e-04f, 1.617171731e-03f, 2.758648379e-03f, 3.900125027e-03f, 5.041601675e-03f, 4.457120795e-03f, 3.342840596e-03f,
+    2.228560398e-03f, 1.114280199e-03f,
+};
+
+static const float mfcc_dct[40][128] = {
+  {
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+    8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f, 8.838834765e-02f,
+  },
+  {
+    1.249905877e-01f, 1.249152981e-01f, 1.247647641e-01f, 1.245390765e-01f, 1.242383713e-01f, 1.238628294e-01f, 1.234126773e-01f, 1.228881859e-01f,
+    1.222896713e-01f, 1.216174940e-01f, 1.208720589e-01f, 1.200538149e-01f, 1.191632550e-01f, 1.182009157e-01f, 1.171673765e-01f, 1.160632601e-01f,
+    1.148892315e-01f, 1.136459979e-01f, 1.123343082e-01f, 1.109549526e-01f, 1.095087618e-01f, 1.079966070e-01f, 1.064193991e-01f, 1.047780882e-01f,
+    1.030736628e-01f, 1.013071498e-01f, 9.947961308e-02f, 9.759215357e-02f, 9.564590820e-02f, 9.364204932e-02f, 9.158178396e-02f, 8.946635316e-02f,
+    8.729703118e-02f, 8.507512472e-02f, 8.280197220e-02f, 8.047894286e-02f, 7.810743602e-02f, 7.568888018e-02f, 7.322473218e-02f, 7.071647635e-02f,
+    6.816562355e-02f, 6.557371033e-02f, 6.294229797e-02f, 6.027297151e-02f, 5.756733887e-02f, 5.482702982e-02f, 5.205369501e-02f, 4.924900501e-02f,
+    4.641464924e-02f, 4.355233503e-02f, 4.066378652e-02f, 3.775074366e-02f, 3.481496117e-02f, 3.185820745e-02f, 2.888226354e-02f, 2.588892202e-02f,
+    2.287998599e-02f, 1.985726792e-02f, 1.682258856e-02f, 1.377777591e-02f, 1.072466404e-02f, 7.665092038e-03f, 4.600902868e-03f, 1.533942286e-03f,
+    -1.533942286e-03f, -4.600902868e-03f, -7.665092038e-03f, -1.072466404e-02f, -1.377777591e-02f, -1.682258856e-02f, -1.985726792e-02f, -2.287998599e-02f,
+    -2.588892202e-02f, -2.888226354e-02f, -3.185820745e-02f, -3.481496117e-02f, -3.775074366e-02f, -4.066378652e-02f, -4.355233503e-02f, -4.641464924e-02f,
+    -4.924900501e-02f, -5.205369501e-02f, -5.482702982e-02f, -5.756733887e-02f, -6.027297151e-02f, -6.294229797e-02f, -6.557371033e-02f, -6.816562355e-02f,
+    -7.071647635e-02f, -7.322473218e-02f, -7.568888018e-02f, -7.810743602e-02f, -8.047894286e-02f, -8.280197220e-02f, -8.507512472e-02f, -8.729703118e-02f,
+    -8.946635316e-02f, -9.158178396e-02f, -9.364204932e-02f, -9.564590820e-02f, -9.759215357e-02f, -9.947961308e-02f, -1.013071498e-01f, -1.030736628e-01f,
+    -1.047780882e-01f, -1.064193991e-01f, -1.079966070e-01f, -1.095087618e-01f, -1.109549526e-01f, -1.123343082e-01f, -1.136459979e-01f, -1.148892315e-01f,
+    -1.160632601e-01f, -1.171673765e-01f, -1.182009157e-01f, -1.191632550e-01f, -1.200538149e-01f, -1.208720589e-01f, -1.216174940e-01f, -1.222896713e-01f,
+    -1.228881859e-01f, -1.234126773e-01f, -1.238628294e-01f, -1.242383713e-01f, -1.245390765e-01f, -1.247647641e-01f, -1.249152981e-01f, -1.249905877e-01f,
+  },
+  {
+    1.249623523e-01f, 1.246613071e-01f, 1.240599418e-01f, 1.231597053e-01f, 1.219627663e-01f, 1.204720082e-01f, 1.186910226e-01f, 1.166240999e-01f,
+    1.142762195e-01f, 1.116530376e-01f, 1.087608739e-01f, 1.056066957e-01f, 1.021981016e-01f, 9.854330345e-02f, 9.465110581e-02f, 9.053088537e-02f,
+    8.619256809e-02f, 8.164660537e-02f, 7.690394882e-02f, 7.197602393e-02f, 6.687470249e-02f, 6.161227403e-02f, 5.620141621e-02f, 5.065516425e-02f,
+    4.498687957e-02f, 3.921021755e-02f, 3.333909468e-02f, 2.738765502e-02f, 2.137023610e-02f, 1.530133440e-02f, 9.195570450e-03f, 3.067653565e-03f,
+    -3.067653565e-03f, -9.195570450e-03f, -1.530133440e-02f, -2.137023610e-02f, -2.738765502e-02f, -3.333909468e-02f, -3.921021755e-02f, -4.498687957e-02f,
+    -5.065516425e-02f, -5.620141621e-02f, -6.161227403e-02f, -6.687470249e-02f, -7.197602393e-02f, -7.690394882e-02f, -8.164660537e-02f, -8.619256809e-02f,
+    -9.053088537e-02f, -9.465110581e-02f, -9.854330345e-02f, -1.021981016e-01f, -1.056066957e-01f, -1.087608739e-01f, -1.116530376e-01f, -1.142762195e-01f,
+    -1.166240999e-01f, -1.186910226e-01f, -1.204720082e-01f, -1.219627663e-01f, -1.231597053e-01f, -1.240599418e-01f, -1.246613071e-01f, -1.249623523e-01f,
+    -1.249623523e-01f, -1.246613071e-01f, -1.240599418e-01f, -1.231597053e-01f, -1.219627663e-01f, -1.204720082e-01f, -1.186910226e-01f, -1.166240999e-01f,
+    -1.142762195e-01f, -1.116530376e-01f, -1.087608739e-01f, -1.056066957e-01f, -1.021981016e-01f, -9.854330345e-02f, -9.465110581e-02f, -9.053088537e-02f,
+    -8.619256809e-02f, -8.164660537e-02f, -7.690394882e-02f, -7.197602393e-02f, -6.687470249e-02f, -6.161227403e-02f, -5.620141621e-02f, -5.065516425e-02f,
+    -4.498687957e-02f, -3.921021755e-02f, -3.333909468e-02f, -2.738765502e-02f, -2.137023610e-02f, -1.530133440e-02f, -9.195570450e-03f, -3.067653565e-03f,
+    3.067653565e-03f, 9.195570450e-03f, 1.530133440e-02f, 2.137023610e-02f, 2.738765502e-02f, 3.333909468e-02f, 3.921021755e-02f, 4.498687957e-02f,
+    5.065516425e-02f, 5.620141621e-02f, 6.161227403e-02f, 6.687470249e-02f, 7.197602393e-02f, 7.690394882e-02f, 8.164660537e-02f, 8.619256809e-02f,
+    9.053088537e-02f, 9.465110581e-02f, 9.854330345e-02f, 1.021981016e-01f, 1.056066957e-01f, 1.087608739e-01f, 1.116530376e-01f, 1.142762195e-01f,
+    1.166240999e-01f, 1.186910226e-01f, 1.204720082e-01f, 1.219627663e-01f, 1.231597053e-01f, 1.240599418e-01f, 1.246613071e-01f, 1.249623523e-01f,
+  },
+  {
+    1.249152981e-01f, 1.242383713e-01f, 1.228881859e-01f, 1.208720589e-01f, 1.182009157e-01f, 1.148892315e-01f, 1.109549526e-01f, 1.064193991e-01f,
+    1.013071498e-01f, 9.564590820e-02f, 8.946635316e-02f, 8.280197220e-02f, 7.568888018e-02f, 6.816562355e-02f, 6.027297151e-02f, 5.205369501e-02f,
+    4.355233503e-02f, 3.481496117e-02f, 2.588892202e-02f, 1.682258856e-02f, 7.665092038e-03f, -1.533942286e-03f, -1.072466404e-02f, -1.985726792e-02f,
+    -2.888226354e-02f, -3.775074366e-02f, -4.641464924e-02f, -5.482702982e-02f, -6.294229797e-02f, -7.071647635e-02f, -7.810743602e-02f, -8.507512472e-02f,
+    -9.158178396e-02f, -9.759215357e-02f, -1.030736628e-01f, -1.079966070e-01f, -1.123343082e-01f, -1.160632601e-01f, -1.191632550e-01f, -1.216174940e-01f,
+    -1.234126773e-01f, -1.245390765e-01f, -1.249905877e-01f, -1.247647641e-01f, -1.238628294e-01f, -1.222896713e-01f, -1.200538149e-01f, -1.171673765e-01f,
+    -1.136459979e-01f, -1.095087618e-01f, -1.047780882e-01f, -9.947961308e-02f, -9.364204932e-02f, -8.729703118e-02f, -8.047894286e-02f, -7.322473218e-02f,
+    -6.557371033e-02f, -5.756733887e-02f, -4.924900501e-02f, -4.066378652e-02f, -3.185820745e-02f, -2.287998599e-02f, -1.377777591e-02f, -4.600902868e-03f,
+    4.600902868e-03f, 1.377777591e-02f, 2.287998599e-02f, 3.185820745e-02f, 4.066378652e-02f, 4.924900501e-02f, 5.756733887e-02f, 6.557371033e-02f,
+    7.322473218e-02f, 8.047894286e-02f, 8.729703118e-02f, 9.364204932e-02f, 9.947961308e-02f, 1.047780882e-01f, 1.095087618e-01f, 1.136459979e-01f,
+    1.171673765e-01f, 1.200538149e-01f, 1.222896713e-01f, 1.238628294e-01f, 1.247647641e-01f, 1.249905877e-01f, 1.245390765e-01f, 1.234126773e-01f,
+    1.216174940e-01f, 1.191632550e-01f, 1.160632601e-01f, 1.123343082e-01f, 1.079966070e-01f, 1.030736628e-01f, 9.759215357e-02f, 9.158178396e-02f,
+    8.507512472e-02f, 7.810743602e-02f, 7.071647635e-02f, 6.294229797e-02f, 5.482702982e-02f, 4.641464924e-02f, 3.775074366e-02f, 2.888226354e-02f,
+    1.985726792e-02f, 1.072466404e-02f, 1.533942286e-03f, -7.665092038e-03f, -1.682258856e-02f, -2.588892202e-02f, -3.481496117e-02f, -4.355233503e-02f,
+    -5.205369501e-02f, -6.027297151e-02f, -6.816562355e-02f, -7.568888018e-02f, -8.280197220e-02f, -8.946635316e-02f, -9.564590820e-02f, -1.013071498e-01f,
+    -1.064193991e-01f, -1.109549526e-01f, -1.148892315e-01f, -1.182009157e-01f, -1.208720589e-01f, -1.228881859e-01f, -1.242383713e-01f, -1.249152981e-01f,
+  },
+  {
+    1.248494320e-01f, 1.236470637e-01f, 1.212539066e-01f, 1.176930081e-01f, 1.129986616e-01f, 1.072160763e-01f, 1.004009414e-01f, 9.261889067e-02f,
+    8.394486936e-02f, 7.446241306e-02f, 6.426284302e-02f, 5.344438668e-02f, 4.211123167e-02f, 3.037252249e-02f, 1.834130931e-02f, 6.133459291e-03f,
+    -6.133459291e-03f, -1.834130931e-02f, -3.037252249e-02f, -4.211123167e-02f, -5.344438668e-02f, -6.426284302e-02f, -7.446241306e-02f, -8.394486936e-02f,
+    -9.261889067e-02f, -1.004009414e-01f, -1.072160763e-01f, -1.129986616e-01f, -1.176930081e-01f, -1.212539066e-01f, -1.236470637e-01f, -1.248494320e-01f,
+    -1.248494320e-01f, -1.236470637e-01f, -1.212539066e-01f, -1.176930081e-01f, -1.129986616e-01f, -1.072160763e-01f, -1.004009414e-01f, -9.261889067e-02f,
+    -8.394486936e-02f, -7.446241306e-02f, -6.426284302e-02f, -5.344438668e-02f, -4.211123167e-02f, -3.037252249e-02f, -1.834130931e-02f, -6.133459291e-03f,
+    6.133459291e-03f, 1.834130931e-02f, 3.037252249e-02f, 4.211123167e-02f, 5.344438668e-02f, 6.426284302e-02f, 7.446241306e-02f, 8.394486936e-02f,
+    9.261889067e-02f, 1.004009414e-01f, 1.072160763e-01f, 1.129986616e-01f, 1.176930081e-01f, 1.212539066e-01f, 1.236470637e-01f, 1.248494320e-01f,
+    1.248494320e-01f, 1.236470637e-01f, 1.212539066e-01f, 1.176930081e-01f, 1.129986616e-01f, 1.072160763e-01f, 1.004009414e-01f, 9.261889067e-02f,
+    8.394486936e-02f, 7.446241306e-02f, 6.426284302e-02f, 5.344438668e-02f, 4.211123167e-02f, 3.037252249e-02f, 1.834130931e-02f, 6.133459291e-03f,
+    -6.133459291e-03f, -1.834130931e-02f, -3.037252249e-02f, -4.211123167e-02f, -5.344438668e-02f, -6.426284302e-02f, -7.446241306e-02f, -8.394486936e-02f,
+    -9.261889067e-02f, -1.004009414e-01f, -1.072160763e-01f, -1.129986616e-01f, -1.176930081e-01f, -1.212539066e-01f, -1.236470637e-01f, -1.248494320e-01f,
+    -1.248494320e-01f, -1.236470637e-01f, -1.212539066e-01f, -1.176930081e-01f, -1.129986616e-01f, -1.072160763e-01f, -1.004009414e-01f, -9.261889067e-02f,
+    -8.394486936e-02f, -7.446241306e-02f, -6.426284302e-02f, -5.344438668e-02f, -4.211123167e-02f, -3.037252249e-02f, -1.834130931e-02f, -6.133459291e-03f,
+    6.133459291e-03f, 1.834130931e-02f, 3.037252249e-02f, 4.211123167e-02f, 5.344438668e-02f, 6.426284302e-02f, 7.446241306e-02f, 8.394486936e-02f,
+    9.261889067e-02f, 1.004009414e-01f, 1.072160763e-01f, 1.129986616e-01f, 1.176930081e-01f, 1.212539066e-01f, 1.236470637e-01f, 1.248494320e-01f,
+  },
+  {
+    1.247647641e-01f, 1.228881859e-01f, 1.191632550e-01f, 1.136459979e-01f, 1.064193991e-01f, 9.759215357e-02f, 8.729703118e-02f, 7.568888018e-02f,
+    6.294229797e-02f, 4.924900501e-02f, 3.481496117e-02f, 1.985726792e-02f, 4.600902868e-03f, -1.072466404e-02f, -2.588892202e-02f, -4.066378652e-02f,
+    -5.482702982e-02f, -6.816562355e-02f, -8.047894286e-02f, -9.158178396e-02f, -1.013071498e-01f, -1.095087618e-01f, -1.160632601e-01f, -1.208720589e-01f,
+    -1.238628294e-01f, -1.249905877e-01f, -1.242383713e-01f, -1.216174940e-01f, -1.171673765e-01f, -1.109549526e-01f, -1.030736628e-01f, -9.364204932e-02f,
+    -8.280197220e-02f, -7.071647635e-02f, -5.756733887e-02f, -4.355233503e-02f, -2.888226354e-02f, -1.377777591e-02f, 1.533942286e-03f, 1.682258856e-02f,
+    3.185820745e-02f, 4.641464924e-02f, 6.027297151e-02f, 7.322473218e-02f, 8.507512472e-02f, 9.564590820e-02f, 1.047780882e-01f, 1.123343082e-01f,
+    1.182009157e-01f, 1.222896713e-01f, 1.245390765e-01f, 1.249152981e-01f, 1.234126773e-01f, 1.200538149e-01f, 1.148892315e-01f, 1.079966070e-01f,
+    9.947961308e-02f, 8.946635316e-02f, 7.810743602e-02f, 6.557371033e-02f, 5.205369501e-02f, 3.775074366e-02f, 2.287998599e-02f, 7.665092038e-03f,
+    -7.665092038e-03f, -2.287998599e-02f, -3.775074366e-02f, -5.205369501e-02f, -6.557371033e-02f, -7.810743602e-02f, -8.946635316e-02f, -9.947961308e-02f,
+    -1.079966070e-01f, -1.148892315e-01f, -1.200538149e-01f, -1.234126773e-01f, -1.249152981e-01f, -1.245390765e-01f, -1.222896713e-01f, -1.182009157e-01f,
+    -1.123343082e-01f, -1.047780882e-01f, -9.564590820e-02f, -8.507512472e-02f, -7.322473218e-02f, -6.027297151e-02f, -4.641464924e-02f, -3.185820745e-02f,
+    -1.682258856e-02f, -1.533942286e-03f, 1.377777591e-02f, 2.888226354e-02f, 4.355233503e-02f, 5.756733887e-02f, 7.071647635e-02f, 8.280197220e-02f,
+    9.364204932e-02f, 1.030736628e-01f, 1.109549526e-01f, 1.171673765e-01f, 1.216174940e-01f, 1.242383713e-01f, 1.249905877e-01f, 1.238628294e-01f,
+    1.208720589e-01f, 1.160632601e-01f, 1.095087618e-01f, 1.013071498e-01f, 9.158178396e-02f, 8.047894286e-02f, 6.816562355e-02f, 5.482702982e-02f,
+    4.066378652e-02f, 2.588892202e-02f, 1.072466404e-02f, -4.600902868e-03f, -1.985726792e-02f, -3.481496117e-02f, -4.924900501e-02f, -6.294229797e-02f,
+    -7.568888018e-02f, -8.729703118e-02f, -9.759215357e-02f, -1.064193991e-01f, -1.136459979e-01f, -1.191632550e-01f, -1.228881859e-01f, -1.247647641e-01f,
+  },
+  {
+    1.246613071e-01f, 1.219627663e-01f, 1.166240999e-01f, 1.087608739e-01f, 9.854330345e-02f, 8.619256809e-02f, 7.197602393e-02f, 5.620141621e-02f,
+    3.921021755e-02f, 2.137023610e-02f, 3.067653565e-03f, -1.530133440e-02f, -3.333909468e-02f, -5.065516425e-02f, -6.687470249e-02f, -8.164660537e-02f,
+    -9.465110581e-02f, -1.056066957e-01f, -1.142762195e-01f, -1.204720082e-01f, -1.240599418e-01f, -1.249623523e-01f, -1.231597053e-01f, -1.186910226e-01f,
+    -1.116530376e-01f, -1.021981016e-01f, -9.053088537e-02f, -7.690394882e-02f, -6.161227403e-02f, -4.498687957e-02f, -2.738765502e-02f, -9.195570450e-03f,
+    9.195570450e-03f, 2.738765502e-02f, 4.498687957e-02f, 6.161227403e-02f, 7.690394882e-02f, 9.053088537e-02f, 1.021981016e-01f, 1.116530376e-01f,
+    1.186910226e-01f, 1.231597053e-01f, 1.249623523e-01f, 1.240599418e-01f, 1.204720082e-01f, 1.142762195e-01f, 1.056066957e-01f, 9.465110581e-02f,
+    8.164660537e-02f, 6.687470249e-02f, 5.065516425e-02f, 3.333909468e-02f, 1.530133440e-02f, -3.067653565e-03f, -2.137023610e-02f, -3.921021755e-02f,
+    -5.620141621e-02f, -7.197602393e-02f, -8.619256809e-02f, -9.854330345e-02f, -1.087608739e-01f, -1.166240999e-01f, -1.219627663e-01f, -1.246613071e-01f,
+    -1.246613071e-01f, -1.219627663e-01f, -1.166240999e-01f, -1.087608739e-01f, -9.854330345e-02f, -8.619256809e-02f, -7.197602393e-02f, -5.620141621e-02f,
+    -3.921021755e-02f, -2.137023610e-02f, -3.067653565e-03f, 1.530133440e-02f, 3.333909468e-02f, 5.065516425e-02f, 6.687470249e-02f, 8.164660537e-02f,
+    9.465110581e-02f, 1.056066957e-01f, 1.142762195e-01f, 1.204720082e-01f, 1.240599418e-01f, 1.249623523e-01f, 1.231597053e-01f, 1.186910226e-01f,
+    1.116530376e-01f, 1.021981016e-01f, 9.053088537e-02f, 7.690394882e-02f, 6.161227403e-02f, 4.498687957e-02f, 2.738765502e-02f, 9.195570450e-03f,
+    -9.195570450e-03f, -2.738765502e-02f, -4.498687957e-02f, -6.161227403e-02f, -7.690394882e-02f, -9.053088537e-02f, -1.021981016e-01f, -1.116530376e-01f,
+    -1.186910226e-01f, -1.231597053e-01f, -1.249623523e-01f, -1.240599418e-01f, -1.204720082e-01f, -1.142762195e-01f, -1.056066957e-01f, -9.465110581e-02f,
+    -8.164660537e-02f, -6.687470249e-02f, -5.065516425e-02f, -3.333909468e-02f, -1.530133440e-02f, 3.067653565e-03f, 2.137023610e-02f, 3.921021755e-02f,
+    5.620141621e-02f, 7.197602393e-02f, 8.619256809e-02f, 9.854330345e-02f, 1.087608739e-01f, 1.166240999e-01f, 1.219627663e-01f, 1.246613071e-01f,
+  },
+  {
+    1.245390765e-01f, 1.208720589e-01f, 1.136459979e-01f, 1.030736628e-01f, 8.946635316e-02f, 7.322473218e-02f, 5.482702982e-02f, 3.481496117e-02f,
+    1.377777591e-02f, -7.665092038e-03f, -2.888226354e-02f, -4.924900501e-02f, -6.816562355e-02f, -8.507512472e-02f, -9.947961308e-02f, -1.109549526e-01f,
+    -1.191632550e-01f, -1.238628294e-01f, -1.249152981e-01f, -1.222896713e-01f, -1.160632601e-01f, -1.064193991e-01f, -9.364204932e-02f, -7.810743602e-02f,
+    -6.027297151e-02f, -4.066378652e-02f, -1.985726792e-02f, 1.533942286e-03f, 2.287998599e-02f, 4.355233503e-02f, 6.294229797e-02f, 8.047894286e-02f,
+    9.564590820e-02f, 1.079966070e-01f, 1.171673765e-01f, 1.228881859e-01f, 1.249905877e-01f, 1.234126773e-01f, 1.182009157e-01f, 1.095087618e-01f,
+    9.759215357e-02f, 8.280197220e-02f, 6.557371033e-02f, 4.641464924e-02f, 2.588892202e-02f, 4.600902868e-03f, -1.682258856e-02f, -3.775074366e-02f,
+    -5.756733887e-02f, -7.568888018e-02f, -9.158178396e-02f, -1.047780882e-01f, -1.148892315e-01f, -1.216174940e-01f, -1.247647641e-01f, -1.242383713e-01f,
+    -1.200538149e-01f, -1.123343082e-01f, -1.013071498e-01f, -8.729703118e-02f, -7.071647635e-02f, -5.205369501e-02f, -3.185820745e-02f, -1.072466404e-02f,
+    1.072466404e-02f, 3.185820745e-02f, 5.205369501e-02f, 7.071647635e-02f, 8.729703118e-02f, 1.013071498e-01f, 1.123343082e-01f, 1.200538149e-01f,
+    1.242383713e-01f, 1.247647641e-01f, 1.216174940e-01f, 1.148892315e-01f, 1.047780882e-01f, 9.158178396e-02f, 7.568888018e-02f, 5.756733887e-02f,
+    3.775074366e-02f, 1.682258856e-02f, -4.600902868e-03f, -2.588892202e-02f, -4.641464924e-02f, -6.557371033e-02f, -8.280197220e-02f, -9.759215357e-02f,
+    -1.095087618e-01f, -1.182009157e-01f, -1.234126773e-01f, -1.249905877e-01f, -1.228881859e-01f, -1.171673765e-01f, -1.079966070e-01f, -9.564590820e-02f,
+    -8.047894286e-02f, -6.294229797e-02f, -4.355233503e-02f, -2.287998599e-02f, -1.533942286e-03f, 1.985726792e-02f, 4.066378652e-02f, 6.027297151e-02f,
+    7.810743602e-02f, 9.364204932e-02f, 1.064193991e-01f, 1.160632601e-01f, 1.222896713e-01f, 1.249152981e-01f, 1.238628294e-01f, 1.191632550e-01f,
+    1.109549526e-01f, 9.947961308e-02f, 8.507512472e-02f, 6.816562355e-02f, 4.924900501e-02f, 2.888226354e-02f, 7.665092038e-03f, -1.377777591e-02f,
+    -3.481496117e-02f, -5.482702982e-02f, -7.322473218e-02f, -8.946635316e-02f, -1.030736628e-01f, -1.136459979e-01f, -1.208720589e-01f, -1.245390765e-01f,
+  },
+  {
+    1.243980908e-01f, 1.196175420e-01f, 1.102401580e-01f, 9.662630667e-02f, 7.929916052e-02f, 5.892459210e-02f, 3.628558466e-02f, 1.225214254e-02f,
+    -1.225214254e-02f, -3.628558466e-02f, -5.892459210e-02f, -7.929916052e-02f, -9.662630667e-02f, -1.102401580e-01f, -1.196175420e-01f, -1.243980908e-01f,
+    -1.243980908e-01f, -1.196175420e-01f, -1.102401580e-01f, -9.662630667e-02f, -7.929916052e-02f, -5.892459210e-02f, -3.628558466e-02f, -1.225214254e-02f,
+    1.225214254e-02f, 3.628558466e-02f, 5.892459210e-02f, 7.929916052e-02f, 9.662630667e-02f, 1.102401580e-01f, 1.196175420e-01f, 1.243980908e-01f,
+    1.243980908e-01f, 1.196175420e-01f, 1.102401580e-01f, 9.662630667e-02f, 7.929916052e-02f, 5.892459210e-02f, 3.628558466e-02f, 1.225214254e-02f,
+    -1.225214254e-02f, -3.628558466e-02f, -5.892459210e-02f, -7.929916052e-02f, -9.662630667e-02f, -1.102401580e-01f, -1.196175420e-01f, -1.243980908e-01f,
+    -1.243980908e-01f, -1.196175420e-01f, -1.102401580e-01f, -9.662630667e-02f, -7.929916052e-02f, -5.892459210e-02f, -3.628558466e-02f, -1.225214254e-02f,
+    1.225214254e-02f, 3.628558466e-02f, 5.892459210e-02f, 7.929916052e-02f, 9.662630667e-02f, 1.102401580e-01f, 1.196175420e-01f, 1.243980908e-01f,
+    1.243980908e-01f, 1.196175420e-01f, 1.102401580e-01f, 9.662630667e-02f, 7.929916052e-02f, 5.892459210e-02f, 3.628558466e-02f, 1.225214254e-02f,
+    -1.225214254e-02f, -3.628558466e-02f, -5.892459210e-02f, -7.929916052e-02f, -9.662630667e-02f, -1.102401580e-01f, -1.196175420e-01f, -1.243980908e-01f,
+    -1.243980908e-01f, -1.196175420e-01f, -1.102401580e-01f, -9.662630667e-02f, -7.929916052e-02f, -5.892459210e-02f, -3.628558466e-02f, -1.225214254e-02f,
+    1.225214254e-02f, 3.628558466e-02f, 5.892459210e-02f, 7.929916052e-02f, 9.662630667e-02f, 1.102401580e-01f, 1.196175420e-01f, 1.243980908e-01f,
+    1.243980908e-01f, 1.196175420e-01f, 1.102401580e-01f, 9.662630667e-02f, 7.929916052e-02f, 5.892459210e-02f, 3.628558466e-02f, 1.225214254e-02f,
+    -1.225214254e-02f, -3.628558466e-02f, -5.892459210e-02f, -7.929916052e-02f, -9.662630667e-02f, -1.102401580e-01f, -1.196175420e-01f, -1.243980908e-01f,
+    -1.243980908e-01f, -1.196175420e-01f, -1.102401580e-01f, -9.662630667e-02f, -7.929916052e-02f, -5.892459210e-02f, -3.628558466e-02f, -1.225214254e-02f,
+    1.225214254e-02f, 3.628558466e-02f, 5.892459210e-02f, 7.929916052e-02f, 9.662630667e-02f, 1.102401580e-01f, 1.196175420e-01f, 1.243980908e-01f,
+  },
+  {
+    1.242383713e-01f, 1.182009157e-01f, 1.064193991e-01f, 8.946635316e-02f, 6.816562355e-02f, 4.355233503e-02f, 1.682258856e-02f, -1.072466404e-02f,
+    -3.775074366e-02f, -6.294229797e-02f, -8.507512472e-02f, -1.030736628e-01f, -1.160632601e-01f, -1.234126773e-01f, -1.247647641e-01f, -1.200538149e-01f,
+    -1.095087618e-01f, -9.364204932e-02f, -7.322473218e-02f, -4.924900501e-02f, -2.287998599e-02f, 4.600902868e-03f, 3.185820745e-02f, 5.756733887e-02f,
+    8.047894286e-02f, 9.947961308e-02f, 1.136459979e-01f, 1.222896713e-01f, 1.249905877e-01f, 1.216174940e-01f, 1.123343082e-01f, 9.759215357e-02f,
+    7.810743602e-02f, 5.482702982e-02f, 2.888226354e-02f, 1.533942286e-03f, -2.588892202e-02f, -5.205369501e-02f, -7.568888018e-02f, -9.564590820e-02f,
+    -1.109549526e-01f, -1.208720589e-01f, -1.249152981e-01f, -1.228881859e-01f, -1.148892315e-01f, -1.013071498e-01f, -8.280197220e-02f, -6.027297151e-02f,
+    -3.481496117e-02f, -7.665092038e-03f, 1.985726792e-02f, 4.641464924e-02f, 7.071647635e-02f, 9.158178396e-02f, 1.079966070e-01f, 1.191632550e-01f,
+    1.245390765e-01f, 1.238628294e-01f, 1.171673765e-01f, 1.047780882e-01f, 8.729703118e-02f, 6.557371033e-02f, 4.066378652e-02f, 1.377777591e-02f,
+    -1.377777591e-02f, -4.066378652e-02f, -6.557371033e-02f, -8.729703118e-02f, -1.047780882e-01f, -1.171673765e-01f, -1.238628294e-01f, -1.245390765e-01f,
+    -1.191632550e-01f, -1.079966070e-01f, -9.158178396e-02f, -7.071647635e-02f, -4.641464924e-02f, -1.985726792e-02f, 7.665092038e-03f, 3.481496117e-02f,
+    6.027297151e-02f, 8.280197220e-02f, 1.013071498e-01f, 1.148892315e-01f, 1.228881859e-01f, 1.249152981e-01f, 1.208720589e-01f, 1.109549526e-01f,
+    9.564590820e-02f, 7.568888018e-02f, 5.205369501e-02f, 2.588892202e-02f, -1.533942286e-03f, -2.888226354e-02f, -5.482702982e-02f, -7.810743602e-02f,
+    -9.759215357e-02f, -1.123343082e-01f, -1.216174940e-01f, -1.249905877e-01f, -1.222896713e-01f, -1.136459979e-01f, -9.947961308e-02f, -8.047894286e-02f,
+    -5.756733887e-02f, -3.185820745e-02f, -4.600902868e-03f, 2.287998599e-02f, 4.924900501e-02f, 7.322473218e-02f, 9.364204932e-02f, 1.095087618e-01f,
+    1.200538149e-01f, 1.247647641e-01f, 1.234126773e-01f, 1.160632601e-01f, 1.030736628e-01f, 8.507512472e-02f, 6.294229797e-02f, 3.775074366e-02f,
+    1.072466404e-02f, -1.682258856e-02f, -4.355233503e-02f, -6.816562355e-02f, -8.946635316e-02f, -1.064193991e-01f, -1.182009157e-01f, -1.242383713e-01f,
+  },
+  {
+    1.240599418e-01f, 1.166240999e-01f, 1.021981016e-01f, 8.164660537e-02f, 5.620141621e-02f, 2.738765502e-02f, -3.067653565e-03f, -3.333909468e-02f,
+    -6.161227403e-02f, -8.619256809e-02f, -1.056066957e-01f, -1.186910226e-01f, -1.246613071e-01f, -1.231597053e-01f, -1.142762195e-01f, -9.854330345e-02f,
+    -7.690394882e-02f, -5.065516425e-02f, -2.137023610e-02f, 9.195570450e-03f, 3.921021755e-02f, 6.687470249e-02f, 9.053088537e-02f, 1.087608739e-01f,
+    1.204720082e-01f, 1.249623523e-01f, 1.219627663e-01f, 1.116530376e-01f, 9.465110581e-02f, 7.197602393e-02f, 4.498687957e-02f, 1.530133440e-02f,
+    -1.530133440e-02f, -4.498687957e-02f, -7.197602393e-02f, -9.465110581e-02f, -1.116530376e-01f, -1.219627663e-01f, -1.249623523e-01f, -1.204720082e-01f,
+    -1.087608739e-01f, -9.053088537e-02f, -6.687470249e-02f, -3.921021755e-02f, -9.195570450e-03f, 2.137023610e-02f, 5.065516425e-02f, 7.690394882e-02f,
+    9.854330345e-02f, 1.142762195e-01f, 1.231597053e-01f, 1.246613071e-01f, 1.186910226e-01f, 1.056066957e-01f, 8.619256809e-02f, 6.161227403e-02f,
+    3.333909468e-02f, 3.067653565e-03f, -2.738765502e-02f, -5.620141621e-02f, -8.164660537e-02f, -1.021981016e-01f, -1.166240999e-01f, -1.240599418e-01f,
+    -1.240599418e-01f, -1.166240999e-01f, -1.021981016e-01f, -8.164660537e-02f, -5.620141621e-02f, -2.738765502e-02f, 3.067653565e-03f, 3.333909468e-02f,
+    6.161227403e-02f, 8.619256809e-02f, 1.056066957e-01f, 1.186910226e-01f, 1.246613071e-01f, 1.231597053e-01f, 1.142762195e-01f, 9.854330345e-02f,
+    7.690394882e-02f, 5.065516425e-02f, 2.137023610e-02f, -9.195570450e-03f, -3.921021755e-02f, -6.687470249e-02f, -9.053088537e-02f, -1.087608739e-01f,
+    -1.204720082e-01f, -1.249623523e-01f, -1.219627663e-01f, -1.116530376e-01f, -9.465110581e-02f, -7.197602393e-02f, -4.498687957e-02f, -1.530133440e-02f,
+    1.530133440e-02f, 4.498687957e-02f, 7.197602393e-02f, 9.465110581e-02f, 1.116530376e-01f, 1.219627663e-01f, 1.249623523e-01f, 1.204720082e-01f,
+    1.087608739e-01f, 9.053088537e-02f, 6.687470249e-02f, 3.921021755e-02f, 9.195570450e-03f, -2.137023610e-02f, -5.065516425e-02f, -7.690394882e-02f,
+    -9.854330345e-02f, -1.142762195e-01f, -1.231597053e-01f, -1.246613071e-01f, -1.186910226e-01f, -1.056066957e-01f, -8.619256809e-02f, -6.161227403e-02f,
+    -3.333909468e-02f, -3.067653565e-03f, 2.738765502e-02f, 5.620141621e-02f, 8.164660537e-02f, 1.021981016e-01f, 1.166240999e-01f, 1.240599418e-01f,
+  },
+  {
+    1.238628294e-01f, 1.148892315e-01f, 9.759215357e-02f, 7.322473218e-02f, 4.355233503e-02f, 1.072466404e-02f, -2.287998599e-02f, -5.482702982e-02f,
+    -8.280197220e-02f, -1.047780882e-01f, -1.191632550e-01f, -1.249152981e-01f, -1.216174940e-01f, -1.095087618e-01f, -8.946635316e-02f, -6.294229797e-02f,
+    -3.185820745e-02f, 1.533942286e-03f, 3.481496117e-02f, 6.557371033e-02f, 9.158178396e-02f, 1.109549526e-01f, 1.222896713e-01f, 1.247647641e-01f,
+    1.182009157e-01f, 1.030736628e-01f, 8.047894286e-02f, 5.205369501e-02f, 1.985726792e-02f, -1.377777591e-02f, -4.641464924e-02f, -7.568888018e-02f,
+    -9.947961308e-02f, -1.160632601e-01f, -1.242383713e-01f, -1.234126773e-01f, -1.136459979e-01f, -9.564590820e-02f, -7.071647635e-02f, -4.066378652e-02f,
+    -7.665092038e-03f, 2.588892202e-02f, 5.756733887e-02f, 8.507512472e-02f, 1.064193991e-01f, 1.200538149e-01f, 1.249905877e-01f, 1.208720589e-01f,
+    1.079966070e-01f, 8.729703118e-02f, 6.027297151e-02f, 2.888226354e-02f, -4.600902868e-03f, -3.775074366e-02f, -6.816562355e-02f, -9.364204932e-02f,
+    -1.123343082e-01f, -1.228881859e-01f, -1.245390765e-01f, -1.171673765e-01f, -1.013071498e-01f, -7.810743602e-02f, -4.924900501e-02f, -1.682258856e-02f,
+    1.682258856e-02f, 4.924900501e-02f, 7.810743602e-02f, 1.013071498e-01f, 1.171673765e-01f, 1.245390765e-01f, 1.228881859e-01f, 1.123343082e-01f,
+    9.364204932e-02f, 6.816562355e-02f, 3.775074366e-02f, 4.600902868e-03f, -2.888226354e-02f, -6.027297151e-02f, -8.729703118e-02f, -1.079966070e-01f,
+    -1.208720589e-01f, -1.249905877e-01f, -1.200538149e-01f, -1.064193991e-01f, -8.507512472e-02f, -5.756733887e-02f, -2.588892202e-02f, 7.665092038e-03f,
+    4.066378652e-02f, 7.071647635e-02f, 9.564590820e-02f, 1.136459979e-01f, 1.234126773e-01f, 1.242383713e-01f, 1.160632601e-01f, 9.947961308e-02f,
+    7.568888018e-02f, 4.641464924e-02f, 1.377777591e-02f, -1.985726792e-02f, -5.205369501e-02f, -8.047894286e-02f, -1.030736628e-01f, -1.182009157e-01f,
+    -1.247647641e-01f, -1.222896713e-01f, -1.109549526e-01f, -9.158178396e-02f, -6.557371033e-02f, -3.481496117e-02f, -1.533942286e-03f, 3.185820745e-02f,
+    6.294229797e-02f, 8.946635316e-02f, 1.095087618e-01f, 1.216174940e-01f, 1.249152981e-01f, 1.191632550e-01f, 1.047780882e-01f, 8.280197220e-02f,
+    5.482702982e-02f, 2.287998599e-02f, -1.072466404e-02f, -4.355233503e-02f, -7.322473218e-02f, -9.759215357e-02f, -1.148892315e-01f, -1.238628294e-01f,
+  },
+  {
+    1.236470637e-01f, 1.129986616e-01f, 9.261889067e-02f, 6.426284302e-02f, 3.037252249e-02f, -6.133459291e-03f, -4.211123167e-02f, -7.446241306e-02f,
+    -1.004009414e-01f, -1.176930081e-01f, -1.248494320e-01f, -1.212539066e-01f, -1.072160763e-01f, -8.394486936e-02f, -5.344438668e-02f, -1.834130931e-02f,
+    1.834130931e-02f, 5.344438668e-02f, 8.394486936e-02f, 1.072160763e-01f, 1.212539066e-01f, 1.248494320e-01f, 1.176930081e-01f, 1.004009414e-01f,
+    7.446241306e-02f, 4.211123167e-02f, 6.133459291e-03f, -3.037252249e-02f, -6.426284302e-02f, -9.261889067e-02f, -1.129986616e-01f, -1.236470637e-01f,
+    -1.236470637e-01f, -1.129986616e-01f, -9.261889067e-02f, -6.426284302e-02f, -3.037252249e-02f, 6.133459291e-03f, 4.211123167e-02f, 7.446241306e-02f,
+    1.004009414e-01f, 1.176930081e-01f, 1.248494320e-01f, 1.212539066e-01f, 1.072160763e-01f, 8.394486936e-02f, 5.344438668e-02f, 1.834130931e-02f,
+    -1.834130931e-02f, -5.344438668e-02f, -8.394486936e-02f, -1.072160763e-01f, -1.212539066e-01f, -1.248494320e-01f, -1.176930081e-01f, -1.004009414e-01f,
+    -7.446241306e-02f, -4.211123167e-02f, -6.133459291e-03f, 3.037252249e-02f, 6.426284302e-02f, 9.261889067e-02f, 1.129986616e-01f, 1.236470637e-01f,
+    1.236470637e-01f, 1.129986616e-01f, 9.261889067e-02f, 6.426284302e-02f, 3.037252249e-02f, -6.133459291e-03f, -4.211123167e-02f, -7.446241306e-02f,
+    -1.004009414e-01f, -1.176930081e-01f, -1.248494320e-01f, -1.212539066e-01f, -1.072160763e-01f, -8.394486936e-02f, -5.344438668e-02f, -1.834130931e-02f,
+    1.834130931e-02f, 5.344438668e-02f, 8.394486936e-02f, 1.072160763e-01f, 1.212539066e-01f, 1.248494320e-01f, 1.176930081e-01f, 1.004009414e-01f,
+    7.446241306e-02f, 4.211123167e-02f, 6.133459291e-03f, -3.037252249e-02f, -6.426284302e-02f, -9.261889067e-02f, -1.129986616e-01f, -1.236470637e-01f,
+    -1.236470637e-01f, -1.129986616e-01f, -9.261889067e-02f, -6.426284302e-02f, -3.037252249e-02f, 6.133459291e-03f, 4.211123167e-02f, 7.446241306e-02f,
+    1.004009414e-01f, 1.176930081e-01f, 1.248494320e-01f, 1.212539066e-01f, 1.072160763e-01f, 8.394486936e-02f, 5.344438668e-02f, 1.834130931e-02f,
+    -1.834130931e-02f, -5.344438668e-02f, -8.394486936e-02f, -1.072160763e-01f, -1.212539066e-01f, -1.248494320e-01f, -1.176930081e-01f, -1.004009414e-01f,
+    -7.446241306e-02f, -4.211123167e-02f, -6.133459291e-03f, 3.037252249e-02f, 6.426284302e-02f, 9.261889067e-02f, 1.129986616e-01f, 1.236470637e-01f,
+  },
+  {
+    1.234126773e-01f, 1.109549526e-01f, 8.729703118e-02f, 5.482702982e-02f, 1.682258856e-02f, -2.287998599e-02f, -6.027297151e-02f, -9.158178396e-02f,
+    -1.136459979e-01f, -1.242383713e-01f, -1.222896713e-01f, -1.079966070e-01f, -8.280197220e-02f, -4.924900501e-02f, -1.072466404e-02f, 2.888226354e-02f,
+    6.557371033e-02f, 9.564590820e-02f, 1.160632601e-01f, 1.247647641e-01f, 1.208720589e-01f, 1.047780882e-01f, 7.810743602e-02f, 4.355233503e-02f,
+    4.600902868e-03f, -3.481496117e-02f, -7.071647635e-02f, -9.947961308e-02f, -1.182009157e-01f, -1.249905877e-01f, -1.191632550e-01f, -1.013071498e-01f,
+    -7.322473218e-02f, -3.775074366e-02f, 1.533942286e-03f, 4.066378652e-02f, 7.568888018e-02f, 1.030736628e-01f, 1.200538149e-01f, 1.249152981e-01f,
+    1.171673765e-01f, 9.759215357e-02f, 6.816562355e-02f, 3.185820745e-02f, -7.665092038e-03f, -4.641464924e-02f, -8.047894286e-02f, -1.064193991e-01f,
+    -1.216174940e-01f, -1.245390765e-01f, -1.148892315e-01f, -9.364204932e-02f, -6.294229797e-02f, -2.588892202e-02f, 1.377777591e-02f, 5.205369501e-02f,
+    8.507512472e-02f, 1.095087618e-01f, 1.228881859e-01f, 1.238628294e-01f, 1.123343082e-01f, 8.946635316e-02f, 5.756733887e-02f, 1.985726792e-02f,
+    -1.985726792e-02f, -5.756733887e-02f, -8.946635316e-02f, -1.123343082e-01f, -1.238628294e-01f, -1.228881859e-01f, -1.095087618e-01f, -8.507512472e-02f,
+    -5.205369501e-02f, -1.377777591e-02f, 2.588892202e-02f, 6.294229797e-02f, 9.364204932e-02f, 1.148892315e-01f, 1.245390765e-01f, 1.216174940e-01f,
+    1.064193991e-01f, 8.047894286e-02f, 4.641464924e-02f, 7.665092038e-03f, -3.185820745e-02f, -6.816562355e-02f, -9.759215357e-02f, -1.171673765e-01f,
+    -1.249152981e-01f, -1.200538149e-01f, -1.030736628e-01f, -7.568888018e-02f, -4.066378652e-02f, -1.533942286e-03f, 3.775074366e-02f, 7.322473218e-02f,
+    1.013071498e-01f, 1.191632550e-01f, 1.249905877e-01f, 1.182009157e-01f, 9.947961308e-02f, 7.071647635e-02f, 3.481496117e-02f, -4.600902868e-03f,
+    -4.355233503e-02f, -7.810743602e-02f, -1.047780882e-01f, -1.208720589e-01f, -1.247647641e-01f, -1.160632601e-01f, -9.564590820e-02f, -6.557371033e-02f,
+    -2.888226354e-02f, 1.072466404e-02f, 4.924900501e-02f, 8.280197220e-02f, 1.079966070e-01f, 1.222896713e-01f, 1.242383713e-01f, 1.136459979e-01f,
+    9.158178396e-02f, 6.027297151e-02f, 2.287998599e-02f, -1.682258856e-02f, -5.482702982e-02f, -8.729703118e-02f, -1.109549526e-01f, -1.234126773e-01f,
+  },
+  {
+    1.231597053e-01f, 1.087608739e-01f, 8.164660537e-02f, 4.498687957e-02f, 3.067653565e-03f, -3.921021755e-02f, -7.690394882e-02f, -1.056066957e-01f,
+    -1.219627663e-01f, -1.240599418e-01f, -1.116530376e-01f, -8.619256809e-02f, -5.065516425e-02f, -9.195570450e-03f, 3.333909468e-02f, 7.197602393e-02f,
+    1.021981016e-01f, 1.204720082e-01f, 1.246613071e-01f, 1.142762195e-01f, 9.053088537e-02f, 5.620141621e-02f, 1.530133440e-02f, -2.738765502e-02f,
+    -6.687470249e-02f, -9.854330345e-02f, -1.186910226e-01f, -1.249623523e-01f, -1.166240999e-01f, -9.465110581e-02f, -6.161227403e-02f, -2.137023610e-02f,
+    2.137023610e-02f, 6.161227403e-02f, 9.465110581e-02f, 1.166240999e-01f, 1.249623523e-01f, 1.186910226e-01f, 9.854330345e-02f, 6.687470249e-02f,
+    2.738765502e-02f, -1.530133440e-02f, -5.620141621e-02f, -9.053088537e-02f, -1.142762195e-01f, -1.246613071e-01f, -1.204720082e-01f, -1.021981016e-01f,
+    -7.197602393e-02f, -3.333909468e-02f, 9.195570450e-03f, 5.065516425e-02f, 8.619256809e-02f, 1.116530376e-01f, 1.240599418e-01f, 1.219627663e-01f,
+    1.056066957e-01f, 7.690394882e-02f, 3.921021755e-02f, -3.067653565e-03f, -4.498687957e-02f, -8.164660537e-02f, -1.087608739e-01f, -1.231597053e-01f,
+    -1.231597053e-01f, -1.087608739e-01f, -8.164660537e-02f, -4.498687957e-02f, -3.067653565e-03f, 3.921021755e-02f, 7.690394882e-02f, 1.056066957e-01f,
+    1.219627663e-01f, 1.240599418e-01f, 1.116530376e-01f, 8.619256809e-02f, 5.065516425e-02f, 9.195570450e-03f, -3.333909468e-02f, -7.197602393e-02f,
+    -1.021981016e-01f, -1.204720082e-01f, -1.246613071e-01f, -1.142762195e-01f, -9.053088537e-02f, -5.620141621e-02f, -1.530133440e-02f, 2.738765502e-02f,
+    6.687470249e-02f, 9.854330345e-02f, 1.186910226e-01f, 1.249623523e-01f, 1.166240999e-01f, 9.465110581e-02f, 6.161227403e-02f, 2.137023610e-02f,
+    -2.137023610e-02f, -6.161227403e-02f, -9.465110581e-02f, -1.166240999e-01f, -1.249623523e-01f, -1.186910226e-01f, -9.854330345e-02f, -6.687470249e-02f,
+    -2.738765502e-02f, 1.530133440e-02f, 5.620141621e-02f, 9.053088537e-02f, 1.142762195e-01f, 1.246613071e-01f, 1.204720082e-01f, 1.021981016e-01f,
+    7.197602393e-02f, 3.333909468e-02f, -9.195570450e-03f, -5.065516425e-02f, -8.619256809e-02f, -1.116530376e-01f, -1.240599418e-01f, -1.219627663e-01f,
+    -1.056066957e-01f, -7.690394882e-02f, -3.921021755e-02f, 3.067653565e-03f, 4.498687957e-02f, 8.164660537e-02f, 1.087608739e-01f, 1.231597053e-01f,
+  },
+  {
+    1.228881859e-01f, 1.064193991e-01f, 7.568888018e-02f, 3.481496117e-02f, -1.072466404e-02f, -5.482702982e-02f, -9.158178396e-02f, -1.160632601e-01f,
+    -1.249905877e-01f, -1.171673765e-01f, -9.364204932e-02f, -5.756733887e-02f, -1.377777591e-02f, 3.185820745e-02f, 7.322473218e-02f, 1.047780882e-01f,
+    1.222896713e-01f, 1.234126773e-01f, 1.079966070e-01f, 7.810743602e-02f, 3.775074366e-02f, -7.665092038e-03f, -5.205369501e-02f, -8.946635316e-02f,
+    -1.148892315e-01f, -1.249152981e-01f, -1.182009157e-01f, -9.564590820e-02f, -6.027297151e-02f, -1.682258856e-02f, 2.888226354e-02f, 7.071647635e-02f,
+    1.030736628e-01f, 1.216174940e-01f, 1.238628294e-01f, 1.095087618e-01f, 8.047894286e-02f, 4.066378652e-02f, -4.600902868e-03f, -4.924900501e-02f,
+    -8.729703118e-02f, -1.136459979e-01f, -1.247647641e-01f, -1.191632550e-01f, -9.759215357e-02f, -6.294229797e-02f, -1.985726792e-02f, 2.588892202e-02f,
+    6.816562355e-02f, 1.013071498e-01f, 1.208720589e-01f, 1.242383713e-01f, 1.109549526e-01f, 8.280197220e-02f, 4.355233503e-02f, -1.533942286e-03f,
+    -4.641464924e-02f, -8.507512472e-02f, -1.123343082e-01f, -1.245390765e-01f, -1.200538149e-01f, -9.947961308e-02f, -6.557371033e-02f, -2.287998599e-02f,
+    2.287998599e-02f, 6.557371033e-02f, 9.947961308e-02f, 1.200538149e-01f, 1.245390765e-01f, 1.123343082e-01f, 8.507512472e-02f, 4.641464924e-02f,
+    1.533942286e-03f, -4.355233503e-02f, -8.280197220e-02f, -1.109549526e-01f, -1.242383713e-01f, -1.208720589e-01f, -1.013071498e-01f, -6.816562355e-02f,
+    -2.588892202e-02f, 1.985726792e-02f, 6.294229797e-02f, 9.759215357e-02f, 1.191632550e-01f, 1.247647641e-01f, 1.136459979e-01f, 8.729703118e-02f,
+    4.924900501e-02f, 4.600902868e-03f, -4.066378652e-02f, -8.047894286e-02f, -1.095087618e-01f, -1.238628294e-01f, -1.216174940e-01f, -1.030736628e-01f,
+    -7.071647635e-02f, -2.888226354e-02f, 1.682258856e-02f, 6.027297151e-02f, 9.564590820e-02f, 1.182009157e-01f, 1.249152981e-01f, 1.148892315e-01f,
+    8.946635316e-02f, 5.205369501e-02f, 7.665092038e-03f, -3.775074366e-02f, -7.810743602e-02f, -1.079966070e-01f, -1.234126773e-01f, -1.222896713e-01f,
+    -1.047780882e-01f, -7.322473218e-02f, -3.185820745e-02f, 1.377777591e-02f, 5.756733887e-02f, 9.364204932e-02f, 1.171673765e-01f, 1.249905877e-01f,
+    1.160632601e-01f, 9.158178396e-02f, 5.482702982e-02f, 1.072466404e-02f, -3.481496117e-02f, -7.568888018e-02f, -1.064193991e-01f, -1.228881859e-01f,
+  },
+  {
+    1.225981601e-01f, 1.039337015e-01f, 6.944627913e-02f, 2.438629025e-02f, -2.438629025e-02f, -6.944627913e-02f, -1.039337015e-01f, -1.225981601e-01f,
+    -1.225981601e-01f, -1.039337015e-01f, -6.944627913e-02f, -2.438629025e-02f, 2.438629025e-02f, 6.944627913e-02f, 1.039337015e-01f, 1.225981601e-01f,
+    1.225981601e-01f, 1.039337015e-01f, 6.944627913e-02f, 2.438629025e-02f, -2.438629025e-02f, -6.944627913e-02f, -1.039337015e-01f, -1.225981601e-01f,
+    -1.225981601e-01f, -1.039337015e-01f, -6.944627913e-02f, -2.438629025e-02f, 2.438629025e-02f, 6.944627913e-02f, 1.039337015e-01f, 1.225981601e-01f,
+    1.225981601e-01f, 1.039337015e-01f, 6.944627913e-02f, 2.438629025e-02f, -2.438629025e-02f, -6.944627913e-02f, -1.039337015e-01f, -1.225981601e-01f,
+    -1.225981601e-01f, -1.039337015e-01f, -6.944627913e-02f, -2.438629025e-02f, 2.438629025e-02f, 6.944627913e-02f, 1.039337015e-01f, 1.225981601e-01f,
+    1.225981601e-01f, 1.039337015e-01f, 6.944627913e-02f, 2.438629025e-02f, -2.438629025e-02f, -6.944627913e-02f, -1.039337015e-01f, -1.225981601e-01f,
+    -1.225981601e-01f, -1.039337015e-01f, -6.944627913e-02f, -2.438629025e-02f, 2.438629025e-02f, 6.944627913e-02f, 1.039337015e-01f, 1.225981601e-01f,
+    1.225981601e-01f, 1.039337015e-01f, 6.944627913e-02f, 2.438629025e-02f, -2.438629025e-02f, -6.944627913e-02f, -1.039337015e-01f, -1.225981601e-01f,
+    -1.225981601e-01f, -1.039337015e-01f, -6.944627913e-02f, -2.438629025e-02f, 2.438629025e-02f, 6.944627913e-02f, 1.039337015e-01f, 1.225981601e-01f,
+    1.225981601e-01f, 1.039337015e-01f, 6.944627913e-02f, 2.438629025e-02f, -2.438629025e-02f, -6.944627913e-02f, -1.039337015e-01f, -1.225981601e-01f,
+    -1.225981601e-01f, -1.039337015e-01f, -6.944627913e-02f, -2.438629025e-02f, 2.438629025e-02f, 6.944627913e-02f, 1.039337015e-01f, 1.225981601e-01f,
+    1.225981601e-01f, 1.039337015e-01f, 6.944627913e-02f, 2.438629025e-02f, -2.438629025e-02f, -6.944627913e-02f, -1.039337015e-01f, -1.225981601e-01f,
+    -1.225981601e-01f, -1.039337015e-01f, -6.944627913e-02f, -2.438629025e-02f, 2.438629025e-02f, 6.944627913e-02f, 1.039337015e-01f, 1.225981601e-01f,
+    1.225981601e-01f, 1.039337015e-01f, 6.944627913e-02f, 2.438629025e-02f, -2.438629025e-02f, -6.944627913e-02f, -1.039337015e-01f, -1.225981601e-01f,
+    -1.225981601e-01f, -1.039337015e-01f, -6.944627913e-02f, -2.438629025e-02f, 2.438629025e-02f, 6.944627913e-02f, 1.039337015e-01f, 1.225981601e-01f,
+  },
+  {
+    1.222896713e-01f, 1.013071498e-01f, 6.294229797e-02f, 1.377777591e-02f, -3.775074366e-02f, -8.280197220e-02f, -1.136459979e-01f, -1.249905877e-01f,
+    -1.148892315e-01f, -8.507512472e-02f, -4.066378652e-02f, 1.072466404e-02f, 6.027297151e-02f, 9.947961308e-02f, 1.216174940e-01f, 1.228881859e-01f,
+    1.030736628e-01f, 6.557371033e-02f, 1.682258856e-02f, -3.481496117e-02f, -8.047894286e-02f, -1.123343082e-01f, -1.249152981e-01f, -1.160632601e-01f,
+    -8.729703118e-02f, -4.355233503e-02f, 7.665092038e-03f, 5.756733887e-02f, 9.759215357e-02f, 1.208720589e-01f, 1.234126773e-01f, 1.047780882e-01f,
+    6.816562355e-02f, 1.985726792e-02f, -3.185820745e-02f, -7.810743602e-02f, -1.109549526e-01f, -1.247647641e-01f, -1.171673765e-01f, -8.946635316e-02f,
+    -4.641464924e-02f, 4.600902868e-03f, 5.482702982e-02f, 9.564590820e-02f, 1.200538149e-01f, 1.238628294e-01f, 1.064193991e-01f, 7.071647635e-02f,
+    2.287998599e-02f, -2.888226354e-02f, -7.568888018e-02f, -1.095087618e-01f, -1.245390765e-01f, -1.182009157e-01f, -9.158178396e-02f, -4.924900501e-02f,
+    1.533942286e-03f, 5.205369501e-02f, 9.364204932e-02f, 1.191632550e-01f, 1.242383713e-01f, 1.079966070e-01f, 7.322473218e-02f, 2.588892202e-02f,
+    -2.588892202e-02f, -7.322473218e-02f, -1.079966070e-01f, -1.242383713e-01f, -1.191632550e-01f, -9.364204932e-02f, -5.205369501e-02f, -1.533942286e-03f,
+    4.924900501e-02f, 9.158178396e-02f, 1.182009157e-01f, 1.245390765e-01f, 1.095087618e-01f, 7.568888018e-02f, 2.888226354e-02f, -2.287998599e-02f,
+    -7.071647635e-02f, -1.064193991e-01f, -1.238628294e-01f, -1.200538149e-01f, -9.564590820e-02f, -5.482702982e-02f, -4.600902868e-03f, 4.641464924e-02f,
+    8.946635316e-02f, 1.171673765e-01f, 1.247647641e-01f, 1.109549526e-01f, 7.810743602e-02f, 3.185820745e-02f, -1.985726792e-02f, -6.816562355e-02f,
+    -1.047780882e-01f, -1.234126773e-01f, -1.208720589e-01f, -9.759215357e-02f, -5.756733887e-02f, -7.665092038e-03f, 4.355233503e-02f, 8.729703118e-02f,
+    1.160632601e-01f, 1.249152981e-01f, 1.123343082e-01f, 8.047894286e-02f, 3.481496117e-02f, -1.682258856e-02f, -6.557371033e-02f, -1.030736628e-01f,
+    -1.228881859e-01f, -1.216174940e-01f, -9.947961308e-02f, -6.027297151e-02f, -1.072466404e-02f, 4.066378652e-02f, 8.507512472e-02f, 1.148892315e-01f,
+    1.249905877e-01f, 1.136459979e-01f, 8.280197220e-02f, 3.775074366e-02f, -1.377777591e-02f, -6.294229797e-02f, -1.013071498e-01f, -1.222896713e-01f,
+  },
+  {
+    1.219627663e-01f, 9.854330345e-02f, 5.620141621e-02f, 3.067653565e-03f, -5.065516425e-02f, -9.465110581e-02f, -1.204720082e-01f, -1.231597053e-01f,
+    -1.021981016e-01f, -6.161227403e-02f, -9.195570450e-03f, 4.498687957e-02f, 9.053088537e-02f, 1.186910226e-01f, 1.240599418e-01f, 1.056066957e-01f,
+    6.687470249e-02f, 1.530133440e-02f, -3.921021755e-02f, -8.619256809e-02f, -1.166240999e-01f, -1.246613071e-01f, -1.087608739e-01f, -7.197602393e-02f,
+    -2.137023610e-02f, 3.333909468e-02f, 8.164660537e-02f, 1.142762195e-01f, 1.249623523e-01f, 1.116530376e-01f, 7.690394882e-02f, 2.738765502e-02f,
+    -2.738765502e-02f, -7.690394882e-02f, -1.116530376e-01f, -1.249623523e-01f, -1.142762195e-01f, -8.164660537e-02f, -3.333909468e-02f, 2.137023610e-02f,
+    7.197602393e-02f, 1.087608739e-01f, 1.246613071e-01f, 1.166240999e-01f, 8.619256809e-02f, 3.921021755e-02f, -1.530133440e-02f, -6.687470249e-02f,
+    -1.056066957e-01f, -1.240599418e-01f, -1.186910226e-01f, -9.053088537e-02f, -4.498687957e-02f, 9.195570450e-03f, 6.161227403e-02f, 1.021981016e-01f,
+    1.231597053e-01f, 1.204720082e-01f, 9.465110581e-02f, 5.065516425e-02f, -3.067653565e-03f, -5.620141621e-02f, -9.854330345e-02f, -1.219627663e-01f,
+    -1.219627663e-01f, -9.854330345e-02f, -5.620141621e-02f, -3.067653565e-03f, 5.065516425e-02f, 9.465110581e-02f, 1.204720082e-01f, 1.231597053e-01f,
+    1.021981016e-01f, 6.161227403e-02f, 9.195570450e-03f, -4.498687957e-02f, -9.053088537e-02f, -1.186910226e-01f, -1.240599418e-01f, -1.056066957e-01f,
+    -6.687470249e-02f, -1.530133440e-02f, 3.921021755e-02f, 8.619256809e-02f, 1.166240999e-01f, 1.246613071e-01f, 1.087608739e-01f, 7.197602393e-02f,
+    2.137023610e-02f, -3.333909468e-02f, -8.164660537e-02f, -1.142762195e-01f, -1.249623523e-01f, -1.116530376e-01f, -7.690394882e-02f, -2.738765502e-02f,
+    2.738765502e-02f, 7.690394882e-02f, 1.116530376e-01f, 1.249623523e-01f, 1.142762195e-01f, 8.164660537e-02f, 3.333909468e-02f, -2.137023610e-02f,
+    -7.197602393e-02f, -1.087608739e-01f, -1.246613071e-01f, -1.166240999e-01f, -8.619256809e-02f, -3.921021755e-02f, 1.530133440e-02f, 6.687470249e-02f,
+    1.056066957e-01f, 1.240599418e-01f, 1.186910226e-01f, 9.053088537e-02f, 4.498687957e-02f, -9.195570450e-03f, -6.161227403e-02f, -1.021981016e-01f,
+    -1.231597053e-01f, -1.204720082e-01f, -9.465110581e-02f, -5.065516425e-02f, 3.067653565e-03f, 5.620141621e-02f, 9.854330345e-02f, 1.219627663e-01f,
+  },
+  {
+    1.216174940e-01f, 9.564590820e-02f, 4.924900501e-02f, -7.665092038e-03f, -6.294229797e-02f, -1.047780882e-01f, -1.242383713e-01f, -1.171673765e-01f,
+    -8.507512472e-02f, -3.481496117e-02f, 2.287998599e-02f, 7.568888018e-02f, 1.123343082e-01f, 1.249905877e-01f, 1.109549526e-01f, 7.322473218e-02f,
+    1.985726792e-02f, -3.775074366e-02f, -8.729703118e-02f, -1.182009157e-01f, -1.238628294e-01f, -1.030736628e-01f, -6.027297151e-02f, -4.600902868e-03f,
+    5.205369501e-02f, 9.759215357e-02f, 1.222896713e-01f, 1.208720589e-01f, 9.364204932e-02f, 4.641464924e-02f, -1.072466404e-02f, -6.557371033e-02f,
+    -1.064193991e-01f, -1.245390765e-01f, -1.160632601e-01f, -8.280197220e-02f, -3.185820745e-02f, 2.588892202e-02f, 7.810743602e-02f, 1.136459979e-01f,
+    1.249152981e-01f, 1.095087618e-01f, 7.071647635e-02f, 1.682258856e-02f, -4.066378652e-02f, -8.946635316e-02f, -1.191632550e-01f, -1.234126773e-01f,
+    -1.013071498e-01f, -5.756733887e-02f, -1.533942286e-03f, 5.482702982e-02f, 9.947961308e-02f, 1.228881859e-01f, 1.200538149e-01f, 9.158178396e-02f,
+    4.355233503e-02f, -1.377777591e-02f, -6.816562355e-02f, -1.079966070e-01f, -1.247647641e-01f, -1.148892315e-01f, -8.047894286e-02f, -2.888226354e-02f,
+    2.888226354e-02f, 8.047894286e-02f, 1.148892315e-01f, 1.247647641e-01f, 1.079966070e-01f, 6.816562355e-02f, 1.377777591e-02f, -4.355233503e-02f,
+    -9.158178396e-02f, -1.200538149e-01f, -1.228881859e-01f, -9.947961308e-02f, -5.482702982e-02f, 1.533942286e-03f, 5.756733887e-02f, 1.013071498e-01f,
+    1.234126773e-01f, 1.191632550e-01f, 8.946635316e-02f, 4.066378652e-02f, -1.682258856e-02f, -7.071647635e-02f, -1.095087618e-01f, -1.249152981e-01f,
+    -1.136459979e-01f, -7.810743602e-02f, -2.588892202e-02f, 3.185820745e-02f, 8.280197220e-02f, 1.160632601e-01f, 1.245390765e-01f, 1.064193991e-01f,
+    6.557371033e-02f, 1.072466404e-02f, -4.641464924e-02f, -9.364204932e-02f, -1.208720589e-01f, -1.222896713e-01f, -9.759215357e-02f, -5.205369501e-02f,
+    4.600902868e-03f, 6.027297151e-02f, 1.030736628e-01f, 1.238628294e-01f, 1.182009157e-01f, 8.729703118e-02f, 3.775074366e-02f, -1.985726792e-02f,
+    -7.322473218e-02f, -1.109549526e-01f, -1.249905877e-01f, -1.123343082e-01f, -7.568888018e-02f, -2.287998599e-02f, 3.481496117e-02f, 8.507512472e-02f,
+    1.171673765e-01f, 1.242383713e-01f, 1.047780882e-01f, 6.294229797e-02f, 7.665092038e-03f, -4.924900501e-02f, -9.564590820e-02f, -1.216174940e-01f,
+  },
+  {
+    1.212539066e-01f, 9.261889067e-02f, 4.211123167e-02f, -1.834130931e-02f, -7.446241306e-02f, -1.129986616e-01f, -1.248494320e-01f, -1.072160763e-01f,
+    -6.426284302e-02f, -6.133459291e-03f, 5.344438668e-02f, 1.004009414e-01f, 1.236470637e-01f, 1.176930081e-01f, 8.394486936e-02f, 3.037252249e-02f,
+    -3.037252249e-02f, -8.394486936e-02f, -1.176930081e-01f, -1.236470637e-01f, -1.004009414e-01f, -5.344438668e-02f, 6.133459291e-03f, 6.426284302e-02f,
+    1.072160763e-01f, 1.248494320e-01f, 1.129986616e-01f, 7.446241306e-02f, 1.834130931e-02f, -4.211123167e-02f, -9.261889067e-02f, -1.212539066e-01f,
+    -1.212539066e-01f, -9.261889067e-02f, -4.211123167e-02f, 1.834130931e-02f, 7.446241306e-02f, 1.129986616e-01f, 1.248494320e-01f, 1.072160763e-01f,
+    6.426284302e-02f, 6.133459291e-03f, -5.344438668e-02f, -1.004009414e-01f, -1.236470637e-01f, -1.176930081e-01f, -8.394486936e-02f, -3.037252249e-02f,
+    3.037252249e-02f, 8.394486936e-02f, 1.176930081e-01f, 1.236470637e-01f, 1.004009414e-01f, 5.344438668e-02f, -6.133459291e-03f, -6.426284302e-02f,
+    -1.072160763e-01f, -1.248494320e-01f, -1.129986616e-01f, -7.446241306e-02f, -1.834130931e-02f, 4.211123167e-02f, 9.261889067e-02f, 1.212539066e-01f,
+    1.212539066e-01f, 9.261889067e-02f, 4.211123167e-02f, -1.834130931e-02f, -7.446241306e-02f, -1.129986616e-01f, -1.248494320e-01f, -1.072160763e-01f,
+    -6.426284302e-02f, -6.133459291e-03f, 5.344438668e-02f, 1.004009414e-01f, 1.236470637e-01f, 1.176930081e-01f, 8.394486936e-02f, 3.037252249e-02f,
+    -3.037252249e-02f, -8.394486936e-02f, -1.176930081e-01f, -1.236470637e-01f, -1.004009414e-01f, -5.344438668e-02f, 6.133459291e-03f, 6.426284302e-02f,
+    1.072160763e-01f, 1.248494320e-01f, 1.129986616e-01f, 7.446241306e-02f, 1.834130931e-02f, -4.211123167e-02f, -9.261889067e-02f, -1.212539066e-01f,
+    -1.212539066e-01f, -9.261889067e-02f, -4.211123167e-02f, 1.834130931e-02f, 7.446241306e-02f, 1.129986616e-01f, 1.248494320e-01f, 1.072160763e-01f,
+    6.426284302e-02f, 6.133459291e-03f, -5.344438668e-02f, -1.004009414e-01f, -1.236470637e-01f, -1.176930081e-01f, -8.394486936e-02f, -3.037252249e-02f,
+    3.037252249e-02f, 8.394486936e-02f, 1.176930081e-01f, 1.236470637e-01f, 1.004009414e-01f, 5.344438668e-02f, -6.133459291e-03f, -6.426284302e-02f,
+    -1.072160763e-01f, -1.248494320e-01f, -1.129986616e-01f, -7.446241306e-02f, -1.834130931e-02f, 4.211123167e-02f, 9.261889067e-02f, 1.212539066e-01f,
+  },
+  {
+    1.208720589e-01f, 8.946635316e-02f, 3.481496117e-02f, -2.888226354e-02f, -8.507512472e-02f, -1.191632550e-01f, -1.222896713e-01f, -9.364204932e-02f,
+    -4.066378652e-02f, 2.287998599e-02f, 8.047894286e-02f, 1.171673765e-01f, 1.234126773e-01f, 9.759215357e-02f, 4.641464924e-02f, -1.682258856e-02f,
+    -7.568888018e-02f, -1.148892315e-01f, -1.242383713e-01f, -1.013071498e-01f, -5.205369501e-02f, 1.072466404e-02f, 7.071647635e-02f, 1.123343082e-01f,
+    1.247647641e-01f, 1.047780882e-01f, 5.756733887e-02f, -4.600902868e-03f, -6.557371033e-02f, -1.095087618e-01f, -1.249905877e-01f, -1.079966070e-01f,
+    -6.294229797e-02f, -1.533942286e-03f, 6.027297151e-02f, 1.064193991e-01f, 1.249152981e-01f, 1.109549526e-01f, 6.816562355e-02f, 7.665092038e-03f,
+    -5.482702982e-02f, -1.030736628e-01f, -1.245390765e-01f, -1.136459979e-01f, -7.322473218e-02f, -1.377777591e-02f, 4.924900501e-02f, 9.947961308e-02f,
+    1.238628294e-01f, 1.160632601e-01f, 7.810743602e-02f, 1.985726792e-02f, -4.355233503e-02f, -9.564590820e-02f, -1.228881859e-01f, -1.182009157e-01f,
+    -8.280197220e-02f, -2.588892202e-02f, 3.775074366e-02f, 9.158178396e-02f, 1.216174940e-01f, 1.200538149e-01f, 8.729703118e-02f, 3.185820745e-02f,
+    -3.185820745e-02f, -8.729703118e-02f, -1.200538149e-01f, -1.216174940e-01f, -9.158178396e-02f, -3.775074366e-02f, 2.588892202e-02f, 8.280197220e-02f,
+    1.182009157e-01f, 1.228881859e-01f, 9.564590820e-02f, 4.355233503e-02f, -1.985726792e-02f, -7.810743602e-02f, -1.160632601e-01f, -1.238628294e-01f,
+    -9.947961308e-02f, -4.924900501e-02f, 1.377777591e-02f, 7.322473218e-02f, 1.136459979e-01f, 1.245390765e-01f, 1.030736628e-01f, 5.482702982e-02f,
+    -7.665092038e-03f, -6.816562355e-02f, -1.109549526e-01f, -1.249152981e-01f, -1.064193991e-01f, -6.027297151e-02f, 1.533942286e-03f, 6.294229797e-02f,
+    1.079966070e-01f, 1.249905877e-01f, 1.095087618e-01f, 6.557371033e-02f, 4.600902868e-03f, -5.756733887e-02f, -1.047780882e-01f, -1.247647641e-01f,
+    -1.123343082e-01f, -7.071647635e-02f, -1.072466404e-02f, 5.205369501e-02f, 1.013071498e-01f, 1.242383713e-01f, 1.148892315e-01f, 7.568888018e-02f,
+    1.682258856e-02f, -4.641464924e-02f, -9.759215357e-02f, -1.234126773e-01f, -1.171673765e-01f, -8.047894286e-02f, -2.287998599e-02f, 4.066378652e-02f,
+    9.364204932e-02f, 1.222896713e-01f, 1.191632550e-01f, 8.507512472e-02f, 2.888226354e-02f, -3.481496117e-02f, -8.946635316e-02f, -1.208720589e-01f,
+  },
+  {
+    1.204720082e-01f, 8.619256809e-02f, 2.738765502e-02f, -3.921021755e-02f, -9.465110581e-02f, -1.231597053e-01f, -1.166240999e-01f, -7.690394882e-02f,
+    -1.530133440e-02f, 5.065516425e-02f, 1.021981016e-01f, 1.246613071e-01f, 1.116530376e-01f, 6.687470249e-02f, 3.067653565e-03f, -6.161227403e-02f,
+    -1.087608739e-01f, -1.249623523e-01f, -1.056066957e-01f, -5.620141621e-02f, 9.195570450e-03f, 7.197602393e-02f, 1.142762195e-01f, 1.240599418e-01f,
+    9.854330345e-02f, 4.498687957e-02f, -2.137023610e-02f, -8.164660537e-02f, -1.186910226e-01f, -1.219627663e-01f, -9.053088537e-02f, -3.333909468e-02f,
+    3.333909468e-02f, 9.053088537e-02f, 1.219627663e-01f, 1.186910226e-01f, 8.164660537e-02f, 2.137023610e-02f, -4.498687957e-02f, -9.854330345e-02f,
+    -1.240599418e-01f, -1.142762195e-01f, -7.197602393e-02f, -9.195570450e-03f, 5.620141621e-02f, 1.056066957e-01f, 1.249623523e-01f, 1.087608739e-01f,
+    6.161227403e-02f, -3.067653565e-03f, -6.687470249e-02f, -1.116530376e-01f, -1.246613071e-01f, -1.021981016e-01f, -5.065516425e-02f, 1.530133440e-02f,
+    7.690394882e-02f, 1.166240999e-01f, 1.231597053e-01f, 9.465110581e-02f, 3.921021755e-02f, -2.738765502e-02f, -8.619256809e-02f, -1.204720082e-01f,
+    -1.204720082e-01f, -8.619256809e-02f, -2.738765502e-02f, 3.921021755e-02f, 9.465110581e-02f, 1.231597053e-01f, 1.166240999e-01f, 7.690394882e-02f,
+    1.530133440e-02f, -5.065516425e-02f, -1.021981016e-01f, -1.246613071e-01f, -1.116530376e-01f, -6.687470249e-02f, -3.067653565e-03f, 6.161227403e-02f,
+    1.087608739e-01f, 1.249623523e-01f, 1.056066957e-01f, 5.620141621e-02f, -9.195570450e-03f, -7.197602393e-02f, -1.142762195e-01f, -1.240599418e-01f,
+    -9.854330345e-02f, -4.498687957e-02f, 2.137023610e-02f, 8.164660537e-02f, 1.186910226e-01f, 1.219627663e-01f, 9.053088537e-02f, 3.333909468e-02f,
+    -3.333909468e-02f, -9.053088537e-02f, -1.219627663e-01f, -1.186910226e-01f, -8.164660537e-02f, -2.137023610e-02f, 4.498687957e-02f, 9.854330345e-02f,
+    1.240599418e-01f, 1.142762195e-01f, 7.197602393e-02f, 9.195570450e-03f, -5.620141621e-02f, -1.056066957e-01f, -1.249623523e-01f, -1.087608739e-01f,
+    -6.161227403e-02f, 3.067653565e-03f, 6.687470249e-02f, 1.116530376e-01f, 1.246613071e-01f, 1.021981016e-01f, 5.065516425e-02f, -1.530133440e-02f,
+    -7.690394882e-02f, -1.166240999e-01f, -1.231597053e-01f, -9.465110581e-02f, -3.921021755e-02f, 2.738765502e-02f, 8.619256809e-02f, 1.204720082e-01f,
+  },
+  {
+    1.200538149e-01f, 8.280197220e-02f, 1.985726792e-02f, -4.924900501e-02f, -1.030736628e-01f, -1.249152981e-01f, -1.079966070e-01f, -5.756733887e-02f,
+    1.072466404e-02f, 7.568888018e-02f, 1.171673765e-01f, 1.222896713e-01f, 8.946635316e-02f, 2.888226354e-02f, -4.066378652e-02f, -9.759215357e-02f,
+    -1.242383713e-01f, -1.123343082e-01f, -6.557371033e-02f, 1.533942286e-03f, 6.816562355e-02f, 1.136459979e-01f, 1.238628294e-01f, 9.564590820e-02f,
+    3.775074366e-02f, -3.185820745e-02f, -9.158178396e-02f, -1.228881859e-01f, -1.160632601e-01f, -7.322473218e-02f, -7.665092038e-03f, 6.027297151e-02f,
+    1.095087618e-01f, 1.247647641e-01f, 1.013071498e-01f, 4.641464924e-02f, -2.287998599e-02f, -8.507512472e-02f, -1.208720589e-01f, -1.191632550e-01f,
+    -8.047894286e-02f, -1.682258856e-02f, 5.205369501e-02f, 1.047780882e-01f, 1.249905877e-01f, 1.064193991e-01f, 5.482702982e-02f, -1.377777591e-02f,
+    -7.810743602e-02f, -1.182009157e-01f, -1.216174940e-01f, -8.729703118e-02f, -2.588892202e-02f, 4.355233503e-02f, 9.947961308e-02f, 1.245390765e-01f,
+    1.109549526e-01f, 6.294229797e-02f, -4.600902868e-03f, -7.071647635e-02f, -1.148892315e-01f, -1.234126773e-01f, -9.364204932e-02f, -3.481496117e-02f,
+    3.481496117e-02f, 9.364204932e-02f, 1.234126773e-01f, 1.148892315e-01f, 7.071647635e-02f, 4.600902868e-03f, -6.294229797e-02f, -1.109549526e-01f,
+    -1.245390765e-01f, -9.947961308e-02f, -4.355233503e-02f, 2.588892202e-02f, 8.729703118e-02f, 1.216174940e-01f, 1.182009157e-01f, 7.810743602e-02f,
+    1.377777591e-02f, -5.482702982e-02f, -1.064193991e-01f, -1.249905877e-01f, -1.047780882e-01f, -5.205369501e-02f, 1.682258856e-02f, 8.047894286e-02f,
+    1.191632550e-01f, 1.208720589e-01f, 8.507512472e-02f, 2.287998599e-02f, -4.641464924e-02f, -1.013071498e-01f, -1.247647641e-01f, -1.095087618e-01f,
+    -6.027297151e-02f, 7.665092038e-03f, 7.322473218e-02f, 1.160632601e-01f, 1.228881859e-01f, 9.158178396e-02f, 3.185820745e-02f, -3.775074366e-02f,
+    -9.564590820e-02f, -1.238628294e-01f, -1.136459979e-01f, -6.816562355e-02f, -1.533942286e-03f, 6.557371033e-02f, 1.123343082e-01f, 1.242383713e-01f,
+    9.759215357e-02f, 4.066378652e-02f, -2.888226354e-02f, -8.946635316e-02f, -1.222896713e-01f, -1.171673765e-01f, -7.568888018e-02f, -1.072466404e-02f,
+    5.756733887e-02f, 1.079966070e-01f, 1.249152981e-01f, 1.030736628e-01f, 4.924900501e-02f, -1.985726792e-02f, -8.280197220e-02f, -1.200538149e-01f,
+  },
+  {
+    1.196175420e-01f, 7.929916052e-02f, 1.225214254e-02f, -5.892459210e-02f, -1.102401580e-01f, -1.243980908e-01f, -9.662630667e-02f, -3.628558466e-02f,
+    3.628558466e-02f, 9.662630667e-02f, 1.243980908e-01f, 1.102401580e-01f, 5.892459210e-02f, -1.225214254e-02f, -7.929916052e-02f, -1.196175420e-01f,
+    -1.196175420e-01f, -7.929916052e-02f, -1.225214254e-02f, 5.892459210e-02f, 1.102401580e-01f, 1.243980908e-01f, 9.662630667e-02f, 3.628558466e-02f,
+    -3.628558466e-02f, -9.662630667e-02f, -1.243980908e-01f, -1.102401580e-01f, -5.892459210e-02f, 1.225214254e-02f, 7.929916052e-02f, 1.196175420e-01f,
+    1.196175420e-01f, 7.929916052e-02f, 1.225214254e-02f, -5.892459210e-02f, -1.102401580e-01f, -1.243980908e-01f, -9.662630667e-02f, -3.628558466e-02f,
+    3.628558466e-02f, 9.662630667e-02f, 1.243980908e-01f, 1.102401580e-01f, 5.892459210e-02f, -1.225214254e-02f, -7.929916052e-02f, -1.196175420e-01f,
+    -1.196175420e-01f, -7.929916052e-02f, -1.225214254e-02f, 5.892459210e-02f, 1.102401580e-01f, 1.243980908e-01f, 9.662630667e-02f, 3.628558466e-02f,
+    -3.628558466e-02f, -9.662630667e-02f, -1.243980908e-01f, -1.102401580e-01f, -5.892459210e-02f, 1.225214254e-02f, 7.929916052e-02f, 1.196175420e-01f,
+    1.196175420e-01f, 7.929916052e-02f, 1.225214254e-02f, -5.892459210e-02f, -1.102401580e-01f, -1.243980908e-01f, -9.662630667e-02f, -3.628558466e-02f,
+    3.628558466e-02f, 9.662630667e-02f, 1.243980908e-01f, 1.102401580e-01f, 5.892459210e-02f, -1.225214254e-02f, -7.929916052e-02f, -1.196175420e-01f,
+    -1.196175420e-01f, -7.929916052e-02f, -1.225214254e-02f, 5.892459210e-02f, 1.102401580e-01f, 1.243980908e-01f, 9.662630667e-02f, 3.628558466e-02f,
+    -3.628558466e-02f, -9.662630667e-02f, -1.243980908e-01f, -1.102401580e-01f, -5.892459210e-02f, 1.225214254e-02f, 7.929916052e-02f, 1.196175420e-01f,
+    1.196175420e-01f, 7.929916052e-02f, 1.225214254e-02f, -5.892459210e-02f, -1.102401580e-01f, -1.243980908e-01f, -9.662630667e-02f, -3.628558466e-02f,
+    3.628558466e-02f, 9.662630667e-02f, 1.243980908e-01f, 1.102401580e-01f, 5.892459210e-02f, -1.225214254e-02f, -7.929916052e-02f, -1.196175420e-01f,
+    -1.196175420e-01f, -7.929916052e-02f, -1.225214254e-02f, 5.892459210e-02f, 1.102401580e-01f, 1.243980908e-01f, 9.662630667e-02f, 3.628558466e-02f,
+    -3.628558466e-02f, -9.662630667e-02f, -1.243980908e-01f, -1.102401580e-01f, -5.892459210e-02f, 1.225214254e-02f, 7.929916052e-02f, 1.196175420e-01f,
+  },
+  {
+    1.191632550e-01f, 7.568888018e-02f, 4.600902868e-03f, -6.816562355e-02f, -1.160632601e-01f, -1.216174940e-01f, -8.280197220e-02f, -1.377777591e-02f,
+    6.027297151e-02f, 1.123343082e-01f, 1.234126773e-01f, 8.946635316e-02f, 2.287998599e-02f, -5.205369501e-02f, -1.079966070e-01f, -1.245390765e-01f,
+    -9.564590820e-02f, -3.185820745e-02f, 4.355233503e-02f, 1.030736628e-01f, 1.249905877e-01f, 1.013071498e-01f, 4.066378652e-02f, -3.481496117e-02f,
+    -9.759215357e-02f, -1.247647641e-01f, -1.064193991e-01f, -4.924900501e-02f, 2.588892202e-02f, 9.158178396e-02f, 1.238628294e-01f, 1.109549526e-01f,
+    5.756733887e-02f, -1.682258856e-02f, -8.507512472e-02f, -1.222896713e-01f, -1.148892315e-01f, -6.557371033e-02f, 7.665092038e-03f, 7.810743602e-02f,
+    1.200538149e-01f, 1.182009157e-01f, 7.322473218e-02f, 1.533942286e-03f, -7.071647635e-02f, -1.171673765e-01f, -1.208720589e-01f, -8.047894286e-02f,
+    -1.072466404e-02f, 6.294229797e-02f, 1.136459979e-01f, 1.228881859e-01f, 8.729703118e-02f, 1.985726792e-02f, -5.482702982e-02f, -1.095087618e-01f,
+    -1.242383713e-01f, -9.364204932e-02f, -2.888226354e-02f, 4.641464924e-02f, 1.047780882e-01f, 1.249152981e-01f, 9.947961308e-02f, 3.775074366e-02f,
+    -3.775074366e-02f, -9.947961308e-02f, -1.249152981e-01f, -1.047780882e-01f, -4.641464924e-02f, 2.888226354e-02f, 9.364204932e-02f, 1.242383713e-01f,
+    1.095087618e-01f, 5.482702982e-02f, -1.985726792e-02f, -8.729703118e-02f, -1.228881859e-01f, -1.136459979e-01f, -6.294229797e-02f, 1.072466404e-02f,
+    8.047894286e-02f, 1.208720589e-01f, 1.171673765e-01f, 7.071647635e-02f, -1.533942286e-03f, -7.322473218e-02f, -1.182009157e-01f, -1.200538149e-01f,
+    -7.810743602e-02f, -7.665092038e-03f, 6.557371033e-02f, 1.148892315e-01f, 1.222896713e-01f, 8.507512472e-02f, 1.682258856e-02f, -5.756733887e-02f,
+    -1.109549526e-01f, -1.238628294e-01f, -9.158178396e-02f, -2.588892202e-02f, 4.924900501e-02f, 1.064193991e-01f, 1.247647641e-01f, 9.759215357e-02f,
+    3.481496117e-02f, -4.066378652e-02f, -1.013071498e-01f, -1.249905877e-01f, -1.030736628e-01f, -4.355233503e-02f, 3.185820745e-02f, 9.564590820e-02f,
+    1.245390765e-01f, 1.079966070e-01f, 5.205369501e-02f, -2.287998599e-02f, -8.946635316e-02f, -1.234126773e-01f, -1.123343082e-01f, -6.027297151e-02f,
+    1.377777591e-02f, 8.280197220e-02f, 1.216174940e-01f, 1.160632601e-01f, 6.816562355e-02f, -4.600902868e-03f, -7.568888018e-02f, -1.191632550e-01f,
+  },
+  {
+    1.186910226e-01f, 7.197602393e-02f, -3.067653565e-03f, -7.690394882e-02f, -1.204720082e-01f, -1.166240999e-01f, -6.687470249e-02f, 9.195570450e-03f,
+    8.164660537e-02f, 1.219627663e-01f, 1.142762195e-01f, 6.161227403e-02f, -1.530133440e-02f, -8.619256809e-02f, -1.231597053e-01f, -1.116530376e-01f,
+    -5.620141621e-02f, 2.137023610e-02f, 9.053088537e-02f, 1.240599418e-01f, 1.087608739e-01f, 5.065516425e-02f, -2.738765502e-02f, -9.465110581e-02f,
+    -1.246613071e-01f, -1.056066957e-01f, -4.498687957e-02f, 3.333909468e-02f, 9.854330345e-02f, 1.249623523e-01f, 1.021981016e-01f, 3.921021755e-02f,
+    -3.921021755e-02f, -1.021981016e-01f, -1.249623523e-01f, -9.854330345e-02f, -3.333909468e-02f, 4.498687957e-02f, 1.056066957e-01f, 1.246613071e-01f,
+    9.465110581e-02f, 2.738765502e-02f, -5.065516425e-02f, -1.087608739e-01f, -1.240599418e-01f, -9.053088537e-02f, -2.137023610e-02f, 5.620141621e-02f,
+    1.116530376e-01f, 1.231597053e-01f, 8.619256809e-02f, 1.530133440e-02f, -6.161227403e-02f, -1.142762195e-01f, -1.219627663e-01f, -8.164660537e-02f,
+    -9.195570450e-03f, 6.687470249e-02f, 1.166240999e-01f, 1.204720082e-01f, 7.690394882e-02f, 3.067653565e-03f, -7.197602393e-02f, -1.186910226e-01f,
+    -1.186910226e-01f, -7.197602393e-02f, 3.067653565e-03f, 7.690394882e-02f, 1.204720082e-01f, 1.166240999e-01f, 6.687470249e-02f, -9.195570450e-03f,
+    -8.164660537e-02f, -1.219627663e-01f, -1.142762195e-01f, -6.161227403e-02f, 1.530133440e-02f, 8.619256809e-02f, 1.231597053e-01f, 1.116530376e-01f,
+    5.620141621e-02f, -2.137023610e-02f, -9.053088537e-02f, -1.240599418e-01f, -1.087608739e-01f, -5.065516425e-02f, 2.738765502e-02f, 9.465110581e-02f,
+    1.246613071e-01f, 1.056066957e-01f, 4.498687957e-02f, -3.333909468e-02f, -9.854330345e-02f, -1.249623523e-01f, -1.021981016e-01f, -3.921021755e-02f,
+    3.921021755e-02f, 1.021981016e-01f, 1.249623523e-01f, 9.854330345e-02f, 3.333909468e-02f, -4.498687957e-02f, -1.056066957e-01f, -1.246613071e-01f,
+    -9.465110581e-02f, -2.738765502e-02f, 5.065516425e-02f, 1.087608739e-01f, 1.240599418e-01f, 9.053088537e-02f, 2.137023610e-02f, -5.620141621e-02f,
+    -1.116530376e-01f, -1.231597053e-01f, -8.619256809e-02f, -1.530133440e-02f, 6.161227403e-02f, 1.142762195e-01f, 1.219627663e-01f, 8.164660537e-02f,
+    9.195570450e-03f, -6.687470249e-02f, -1.166240999e-01f, -1.204720082e-01f, -7.690394882e-02f, -3.067653565e-03f, 7.197602393e-02f, 1.186910226e-01f,
+  },
+  {
+    1.182009157e-01f, 6.816562355e-02f, -1.072466404e-02f, -8.507512472e-02f, -1.234126773e-01f, -1.095087618e-01f, -4.924900501e-02f, 3.185820745e-02f,
+    9.947961308e-02f, 1.249905877e-01f, 9.759215357e-02f, 2.888226354e-02f, -5.205369501e-02f, -1.109549526e-01f, -1.228881859e-01f, -8.280197220e-02f,
+    -7.665092038e-03f, 7.071647635e-02f, 1.191632550e-01f, 1.171673765e-01f, 6.557371033e-02f, -1.377777591e-02f, -8.729703118e-02f, -1.238628294e-01f,
+    -1.079966070e-01f, -4.641464924e-02f, 3.481496117e-02f, 1.013071498e-01f, 1.249152981e-01f, 9.564590820e-02f, 2.588892202e-02f, -5.482702982e-02f,
+    -1.123343082e-01f, -1.222896713e-01f, -8.047894286e-02f, -4.600902868e-03f, 7.322473218e-02f, 1.200538149e-01f, 1.160632601e-01f, 6.294229797e-02f,
+    -1.682258856e-02f, -8.946635316e-02f, -1.242383713e-01f, -1.064193991e-01f, -4.355233503e-02f, 3.775074366e-02f, 1.030736628e-01f, 1.247647641e-01f,
+    9.364204932e-02f, 2.287998599e-02f, -5.756733887e-02f, -1.136459979e-01f, -1.216174940e-01f, -7.810743602e-02f, -1.533942286e-03f, 7.568888018e-02f,
+    1.208720589e-01f, 1.148892315e-01f, 6.027297151e-02f, -1.985726792e-02f, -9.158178396e-02f, -1.245390765e-01f, -1.047780882e-01f, -4.066378652e-02f,
+    4.066378652e-02f, 1.047780882e-01f, 1.245390765e-01f, 9.158178396e-02f, 1.985726792e-02f, -6.027297151e-02f, -1.148892315e-01f, -1.208720589e-01f,
+    -7.568888018e-02f, 1.533942286e-03f, 7.810743602e-02f, 1.216174940e-01f, 1.136459979e-01f, 5.756733887e-02f, -2.287998599e-02f, -9.364204932e-02f,
+    -1.247647641e-01f, -1.030736628e-01f, -3.775074366e-02f, 4.355233503e-02f, 1.064193991e-01f, 1.242383713e-01f, 8.946635316e-02f, 1.682258856e-02f,
+    -6.294229797e-02f, -1.160632601e-01f, -1.200538149e-01f, -7.322473218e-02f, 4.600902868e-03f, 8.047894286e-02f, 1.222896713e-01f, 1.123343082e-01f,
+    5.482702982e-02f, -2.588892202e-02f, -9.564590820e-02f, -1.249152981e-01f, -1.013071498e-01f, -3.481496117e-02f, 4.641464924e-02f, 1.079966070e-01f,
+    1.238628294e-01f, 8.729703118e-02f, 1.377777591e-02f, -6.557371033e-02f, -1.171673765e-01f, -1.191632550e-01f, -7.071647635e-02f, 7.665092038e-03f,
+    8.280197220e-02f, 1.228881859e-01f, 1.109549526e-01f, 5.205369501e-02f, -2.888226354e-02f, -9.759215357e-02f, -1.249905877e-01f, -9.947961308e-02f,
+    -3.185820745e-02f, 4.924900501e-02f, 1.095087618e-01f, 1.234126773e-01f, 8.507512472e-02f, 1.072466404e-02f, -6.816562355e-02f, -1.182009157e-01f,
+  },
+  {
+    1.176930081e-01f, 6.426284302e-02f, -1.834130931e-02f, -9.261889067e-02f, -1.248494320e-01f, -1.004009414e-01f, -3.037252249e-02f, 5.344438668e-02f,
+    1.129986616e-01f, 1.212539066e-01f, 7.446241306e-02f, -6.133459291e-03f, -8.394486936e-02f, -1.236470637e-01f, -1.072160763e-01f, -4.211123167e-02f,
+    4.211123167e-02f, 1.072160763e-01f, 1.236470637e-01f, 8.394486936e-02f, 6.133459291e-03f, -7.446241306e-02f, -1.212539066e-01f, -1.129986616e-01f,
+    -5.344438668e-02f, 3.037252249e-02f, 1.004009414e-01f, 1.248494320e-01f, 9.261889067e-02f, 1.834130931e-02f, -6.426284302e-02f, -1.176930081e-01f,
+    -1.176930081e-01f, -6.426284302e-02f, 1.834130931e-02f, 9.261889067e-02f, 1.248494320e-01f, 1.004009414e-01f, 3.037252249e-02f, -5.344438668e-02f,
+    -1.129986616e-01f, -1.212539066e-01f, -7.446241306e-02f, 6.133459291e-03f, 8.394486936e-02f, 1.236470637e-01f, 1.072160763e-01f, 4.211123167e-02f,
+    -4.211123167e-02f, -1.072160763e-01f, -1.236470637e-01f, -8.394486936e-02f, -6.133459291e-03f, 7.446241306e-02f, 1.212539066e-01f, 1.129986616e-01f,
+    5.344438668e-02f, -3.037252249e-02f, -1.004009414e-01f, -1.248494320e-01f, -9.261889067e-02f, -1.834130931e-02f, 6.426284302e-02f, 1.176930081e-01f,
+    1.176930081e-01f, 6.426284302e-02f, -1.834130931e-02f, -9.261889067e-02f, -1.248494320e-01f, -1.004009414e-01f, -3.037252249e-02f, 5.344438668e-02f,
+    1.129986616e-01f, 1.212539066e-01f, 7.446241306e-02f, -6.133459291e-03f, -8.394486936e-02f, -1.236470637e-01f, -1.072160763e-01f, -4.211123167e-02f,
+    4.211123167e-02f, 1.072160763e-01f, 1.236470637e-01f, 8.394486936e-02f, 6.133459291e-03f, -7.446241306e-02f, -1.212539066e-01f, -1.129986616e-01f,
+    -5.344438668e-02f, 3.037252249e-02f, 1.004009414e-01f, 1.248494320e-01f, 9.261889067e-02f, 1.834130931e-02f, -6.426284302e-02f, -1.176930081e-01f,
+    -1.176930081e-01f, -6.426284302e-02f, 1.834130931e-02f, 9.261889067e-02f, 1.248494320e-01f, 1.004009414e-01f, 3.037252249e-02f, -5.344438668e-02f,
+    -1.129986616e-01f, -1.212539066e-01f, -7.446241306e-02f, 6.133459291e-03f, 8.394486936e-02f, 1.236470637e-01f, 1.072160763e-01f, 4.211123167e-02f,
+    -4.211123167e-02f, -1.072160763e-01f, -1.236470637e-01f, -8.394486936e-02f, -6.133459291e-03f, 7.446241306e-02f, 1.212539066e-01f, 1.129986616e-01f,
+    5.344438668e-02f, -3.037252249e-02f, -1.004009414e-01f, -1.248494320e-01f, -9.261889067e-02f, -1.834130931e-02f, 6.426284302e-02f, 1.176930081e-01f,
+  },
+  {
+    1.171673765e-01f, 6.027297151e-02f, -2.588892202e-02f, -9.947961308e-02f, -1.247647641e-01f, -8.946635316e-02f, -1.072466404e-02f, 7.322473218e-02f,
+    1.216174940e-01f, 1.109549526e-01f, 4.641464924e-02f, -4.066378652e-02f, -1.079966070e-01f, -1.228881859e-01f, -7.810743602e-02f, 4.600902868e-03f,
+    8.507512472e-02f, 1.242383713e-01f, 1.030736628e-01f, 3.185820745e-02f, -5.482702982e-02f, -1.148892315e-01f, -1.191632550e-01f, -6.557371033e-02f,
+    1.985726792e-02f, 9.564590820e-02f, 1.249905877e-01f, 9.364204932e-02f, 1.682258856e-02f, -6.816562355e-02f, -1.200538149e-01f, -1.136459979e-01f,
+    -5.205369501e-02f, 3.481496117e-02f, 1.047780882e-01f, 1.238628294e-01f, 8.280197220e-02f, 1.533942286e-03f, -8.047894286e-02f, -1.234126773e-01f,
+    -1.064193991e-01f, -3.775074366e-02f, 4.924900501e-02f, 1.123343082e-01f, 1.208720589e-01f, 7.071647635e-02f, -1.377777591e-02f, -9.158178396e-02f,
+    -1.249152981e-01f, -9.759215357e-02f, -2.287998599e-02f, 6.294229797e-02f, 1.182009157e-01f, 1.160632601e-01f, 5.756733887e-02f, -2.888226354e-02f,
+    -1.013071498e-01f, -1.245390765e-01f, -8.729703118e-02f, -7.665092038e-03f, 7.568888018e-02f, 1.222896713e-01f, 1.095087618e-01f, 4.355233503e-02f,
+    -4.355233503e-02f, -1.095087618e-01f, -1.222896713e-01f, -7.568888018e-02f, 7.665092038e-03f, 8.729703118e-02f, 1.245390765e-01f, 1.013071498e-01f,
+    2.888226354e-02f, -5.756733887e-02f, -1.160632601e-01f, -1.182009157e-01f, -6.294229797e-02f, 2.287998599e-02f, 9.759215357e-02f, 1.249152981e-01f,
+    9.158178396e-02f, 1.377777591e-02f, -7.071647635e-02f, -1.208720589e-01f, -1.123343082e-01f, -4.924900501e-02f, 3.775074366e-02f, 1.064193991e-01f,
+    1.234126773e-01f, 8.047894286e-02f, -1.533942286e-03f, -8.280197220e-02f, -1.238628294e-01f, -1.047780882e-01f, -3.481496117e-02f, 5.205369501e-02f,
+    1.136459979e-01f, 1.200538149e-01f, 6.816562355e-02f, -1.682258856e-02f, -9.364204932e-02f, -1.249905877e-01f, -9.564590820e-02f, -1.985726792e-02f,
+    6.557371033e-02f, 1.191632550e-01f, 1.148892315e-01f, 5.482702982e-02f, -3.185820745e-02f, -1.030736628e-01f, -1.242383713e-01f, -8.507512472e-02f,
+    -4.600902868e-03f, 7.810743602e-02f, 1.228881859e-01f, 1.079966070e-01f, 4.066378652e-02f, -4.641464924e-02f, -1.109549526e-01f, -1.216174940e-01f,
+    -7.322473218e-02f, 1.072466404e-02f, 8.946635316e-02f, 1.247647641e-01f, 9.947961308e-02f, 2.588892202e-02f, -6.027297151e-02f, -1.171673765e-01f,
+  },
+  {
+    1.166240999e-01f, 5.620141621e-02f, -3.333909468e-02f, -1.056066957e-01f, -1.231597053e-01f, -7.690394882e-02f, 9.195570450e-03f, 9.053088537e-02f,
+    1.249623523e-01f, 9.465110581e-02f, 1.530133440e-02f, -7.197602393e-02f, -1.219627663e-01f, -1.087608739e-01f, -3.921021755e-02f, 5.065516425e-02f,
+    1.142762195e-01f, 1.186910226e-01f, 6.161227403e-02f, -2.738765502e-02f, -1.021981016e-01f, -1.240599418e-01f, -8.164660537e-02f, 3.067653565e-03f,
+    8.619256809e-02f, 1.246613071e-01f, 9.854330345e-02f, 2.137023610e-02f, -6.687470249e-02f, -1.204720082e-01f, -1.116530376e-01f, -4.498687957e-02f,
+    4.498687957e-02f, 1.116530376e-01f, 1.204720082e-01f, 6.687470249e-02f, -2.137023610e-02f, -9.854330345e-02f, -1.246613071e-01f, -8.619256809e-02f,
+    -3.067653565e-03f, 8.164660537e-02f, 1.240599418e-01f, 1.021981016e-01f, 2.738765502e-02f, -6.161227403e-02f, -1.186910226e-01f, -1.142762195e-01f,
+    -5.065516425e-02f, 3.921021755e-02f, 1.087608739e-01f, 1.219627663e-01f, 7.197602393e-02f, -1.530133440e-02f, -9.465110581e-02f, -1.249623523e-01f,
+    -9.053088537e-02f, -9.195570450e-03f, 7.690394882e-02f, 1.231597053e-01f, 1.056066957e-01f, 3.333909468e-02f, -5.620141621e-02f, -1.166240999e-01f,
+    -1.166240999e-01f, -5.620141621e-02f, 3.333909468e-02f, 1.056066957e-01f, 1.231597053e-01f, 7.690394882e-02f, -9.195570450e-03f, -9.053088537e-02f,
+    -1.249623523e-01f, -9.465110581e-02f, -1.530133440e-02f, 7.197602393e-02f, 1.219627663e-01f, 1.087608739e-01f, 3.921021755e-02f, -5.065516425e-02f,
+    -1.142762195e-01f, -1.186910226e-01f, -6.161227403e-02f, 2.738765502e-02f, 1.021981016e-01f, 1.240599418e-01f, 8.164660537e-02f, -3.067653565e-03f,
+    -8.619256809e-02f, -1.246613071e-01f, -9.854330345e-02f, -2.137023610e-02f, 6.687470249e-02f, 1.204720082e-01f, 1.116530376e-01f, 4.498687957e-02f,
+    -4.498687957e-02f, -1.116530376e-01f, -1.204720082e-01f, -6.687470249e-02f, 2.137023610e-02f, 9.854330345e-02f, 1.246613071e-01f, 8.619256809e-02f,
+    3.067653565e-03f, -8.164660537e-02f, -1.240599418e-01f, -1.021981016e-01f, -2.738765502e-02f, 6.161227403e-02f, 1.186910226e-01f, 1.142762195e-01f,
+    5.065516425e-02f, -3.921021755e-02f, -1.087608739e-01f, -1.219627663e-01f, -7.197602393e-02f, 1.530133440e-02f, 9.465110581e-02f, 1.249623523e-01f,
+    9.053088537e-02f, 9.195570450e-03f, -7.690394882e-02f, -1.231597053e-01f, -1.056066957e-01f, -3.333909468e-02f, 5.620141621e-02f, 1.166240999e-01f,
+  },
+  {
+    1.160632601e-01f, 5.205369501e-02f, -4.066378652e-02f, -1.109549526e-01f, -1.200538149e-01f, -6.294229797e-02f, 2.888226354e-02f, 1.047780882e-01f,
+    1.228881859e-01f, 7.322473218e-02f, -1.682258856e-02f, -9.759215357e-02f, -1.245390765e-01f, -8.280197220e-02f, 4.600902868e-03f, 8.946635316e-02f,
+    1.249905877e-01f, 9.158178396e-02f, 7.665092038e-03f, -8.047894286e-02f, -1.242383713e-01f, -9.947961308e-02f, -1.985726792e-02f, 7.071647635e-02f,
+    1.222896713e-01f, 1.064193991e-01f, 3.185820745e-02f, -6.027297151e-02f, -1.191632550e-01f, -1.123343082e-01f, -4.355233503e-02f, 4.924900501e-02f,
+    1.148892315e-01f, 1.171673765e-01f, 5.482702982e-02f, -3.775074366e-02f, -1.095087618e-01f, -1.208720589e-01f, -6.557371033e-02f, 2.588892202e-02f,
+    1.030736628e-01f, 1.234126773e-01f, 7.568888018e-02f, -1.377777591e-02f, -9.564590820e-02f, -1.247647641e-01f, -8.507512472e-02f, 1.533942286e-03f,
+    8.729703118e-02f, 1.249152981e-01f, 9.364204932e-02f, 1.072466404e-02f, -7.810743602e-02f, -1.238628294e-01f, -1.013071498e-01f, -2.287998599e-02f,
+    6.816562355e-02f, 1.216174940e-01f, 1.079966070e-01f, 3.481496117e-02f, -5.756733887e-02f, -1.182009157e-01f, -1.136459979e-01f, -4.641464924e-02f,
+    4.641464924e-02f, 1.136459979e-01f, 1.182009157e-01f, 5.756733887e-02f, -3.481496117e-02f, -1.079966070e-01f, -1.216174940e-01f, -6.816562355e-02f,
+    2.287998599e-02f, 1.013071498e-01f, 1.238628294e-01f, 7.810743602e-02f, -1.072466404e-02f, -9.364204932e-02f, -1.249152981e-01f, -8.729703118e-02f,
+    -1.533942286e-03f, 8.507512472e-02f, 1.247647641e-01f, 9.564590820e-02f, 1.377777591e-02f, -7.568888018e-02f, -1.234126773e-01f, -1.030736628e-01f,
+    -2.588892202e-02f, 6.557371033e-02f, 1.208720589e-01f, 1.095087618e-01f, 3.775074366e-02f, -5.482702982e-02f, -1.171673765e-01f, -1.148892315e-01f,
+    -4.924900501e-02f, 4.355233503e-02f, 1.123343082e-01f, 1.191632550e-01f, 6.027297151e-02f, -3.185820745e-02f, -1.064193991e-01f, -1.222896713e-01f,
+    -7.071647635e-02f, 1.985726792e-02f, 9.947961308e-02f, 1.242383713e-01f, 8.047894286e-02f, -7.665092038e-03f, -9.158178396e-02f, -1.249905877e-01f,
+    -8.946635316e-02f, -4.600902868e-03f, 8.280197220e-02f, 1.245390765e-01f, 9.759215357e-02f, 1.682258856e-02f, -7.322473218e-02f, -1.228881859e-01f,
+    -1.047780882e-01f, -2.888226354e-02f, 6.294229797e-02f, 1.200538149e-01f, 1.109549526e-01f, 4.066378652e-02f, -5.205369501e-02f, -1.160632601e-01f,
+  },
+  {
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+    1.154849416e-01f, 4.783542905e-02f, -4.783542905e-02f, -1.154849416e-01f, -1.154849416e-01f, -4.783542905e-02f, 4.783542905e-02f, 1.154849416e-01f,
+  },
+  {
+    1.148892315e-01f, 4.355233503e-02f, -5.482702982e-02f, -1.191632550e-01f, -1.095087618e-01f, -3.185820745e-02f, 6.557371033e-02f, 1.222896713e-01f,
+    1.030736628e-01f, 1.985726792e-02f, -7.568888018e-02f, -1.242383713e-01f, -9.564590820e-02f, -7.665092038e-03f, 8.507512472e-02f, 1.249905877e-01f,
+    8.729703118e-02f, -4.600902868e-03f, -9.364204932e-02f, -1.245390765e-01f, -7.810743602e-02f, 1.682258856e-02f, 1.013071498e-01f, 1.228881859e-01f,
+    6.816562355e-02f, -2.888226354e-02f, -1.079966070e-01f, -1.200538149e-01f, -5.756733887e-02f, 4.066378652e-02f, 1.136459979e-01f, 1.160632601e-01f,
+    4.641464924e-02f, -5.205369501e-02f, -1.182009157e-01f, -1.109549526e-01f, -3.481496117e-02f, 6.294229797e-02f, 1.216174940e-01f, 1.047780882e-01f,
+    2.287998599e-02f, -7.322473218e-02f, -1.238628294e-01f, -9.759215357e-02f, -1.072466404e-02f, 8.280197220e-02f, 1.249152981e-01f, 8.946635316e-02f,
+    -1.533942286e-03f, -9.158178396e-02f, -1.247647641e-01f, -8.047894286e-02f, 1.377777591e-02f, 9.947961308e-02f, 1.234126773e-01f, 7.071647635e-02f,
+    -2.588892202e-02f, -1.064193991e-01f, -1.208720589e-01f, -6.027297151e-02f, 3.775074366e-02f, 1.123343082e-01f, 1.171673765e-01f, 4.924900501e-02f,
+    -4.924900501e-02f, -1.171673765e-01f, -1.123343082e-01f, -3.775074366e-02f, 6.027297151e-02f, 1.208720589e-01f, 1.064193991e-01f, 2.588892202e-02f,
+    -7.071647635e-02f, -1.234126773e-01f, -9.947961308e-02f, -1.377777591e-02f, 8.047894286e-02f, 1.247647641e-01f, 9.158178396e-02f, 1.533942286e-03f,
+    -8.946635316e-02f, -1.249152981e-01f, -8.280197220e-02f, 1.072466404e-02f, 9.759215357e-02f, 1.238628294e-01f, 7.322473218e-02f, -2.287998599e-02f,
+    -1.047780882e-01f, -1.216174940e-01f, -6.294229797e-02f, 3.481496117e-02f, 1.109549526e-01f, 1.182009157e-01f, 5.205369501e-02f, -4.641464924e-02f,
+    -1.160632601e-01f, -1.136459979e-01f, -4.066378652e-02f, 5.756733887e-02f, 1.200538149e-01f, 1.079966070e-01f, 2.888226354e-02f, -6.816562355e-02f,
+    -1.228881859e-01f, -1.013071498e-01f, -1.682258856e-02f, 7.810743602e-02f, 1.245390765e-01f, 9.364204932e-02f, 4.600902868e-03f, -8.729703118e-02f,
+    -1.249905877e-01f, -8.507512472e-02f, 7.665092038e-03f, 9.564590820e-02f, 1.242383713e-01f, 7.568888018e-02f, -1.985726792e-02f, -1.030736628e-01f,
+    -1.222896713e-01f, -6.557371033e-02f, 3.185820745e-02f, 1.095087618e-01f, 1.191632550e-01f, 5.482702982e-02f, -4.355233503e-02f, -1.148892315e-01f,
+  },
+  {
+    1.142762195e-01f, 3.921021755e-02f, -6.161227403e-02f, -1.219627663e-01f, -1.021981016e-01f, -1.530133440e-02f, 8.164660537e-02f, 1.249623523e-01f,
+    8.619256809e-02f, -9.195570450e-03f, -9.854330345e-02f, -1.231597053e-01f, -6.687470249e-02f, 3.333909468e-02f, 1.116530376e-01f, 1.166240999e-01f,
+    4.498687957e-02f, -5.620141621e-02f, -1.204720082e-01f, -1.056066957e-01f, -2.137023610e-02f, 7.690394882e-02f, 1.246613071e-01f, 9.053088537e-02f,
+    -3.067653565e-03f, -9.465110581e-02f, -1.240599418e-01f, -7.197602393e-02f, 2.738765502e-02f, 1.087608739e-01f, 1.186910226e-01f, 5.065516425e-02f,
+    -5.065516425e-02f, -1.186910226e-01f, -1.087608739e-01f, -2.738765502e-02f, 7.197602393e-02f, 1.240599418e-01f, 9.465110581e-02f, 3.067653565e-03f,
+    -9.053088537e-02f, -1.246613071e-01f, -7.690394882e-02f, 2.137023610e-02f, 1.056066957e-01f, 1.204720082e-01f, 5.620141621e-02f, -4.498687957e-02f,
+    -1.166240999e-01f, -1.116530376e-01f, -3.333909468e-02f, 6.687470249e-02f, 1.231597053e-01f, 9.854330345e-02f, 9.195570450e-03f, -8.619256809e-02f,
+    -1.249623523e-01f, -8.164660537e-02f, 1.530133440e-02f, 1.021981016e-01f, 1.219627663e-01f, 6.161227403e-02f, -3.921021755e-02f, -1.142762195e-01f,
+    -1.142762195e-01f, -3.921021755e-02f, 6.161227403e-02f, 1.219627663e-01f, 1.021981016e-01f, 1.530133440e-02f, -8.164660537e-02f, -1.249623523e-01f,
+    -8.619256809e-02f, 9.195570450e-03f, 9.854330345e-02f, 1.231597053e-01f, 6.687470249e-02f, -3.333909468e-02f, -1.116530376e-01f, -1.166240999e-01f,
+    -4.498687957e-02f, 5.620141621e-02f, 1.204720082e-01f, 1.056066957e-01f, 2.137023610e-02f, -7.690394882e-02f, -1.246613071e-01f, -9.053088537e-02f,
+    3.067653565e-03f, 9.465110581e-02f, 1.240599418e-01f, 7.197602393e-02f, -2.738765502e-02f, -1.087608739e-01f, -1.186910226e-01f, -5.065516425e-02f,
+    5.065516425e-02f, 1.186910226e-01f, 1.087608739e-01f, 2.738765502e-02f, -7.197602393e-02f, -1.240599418e-01f, -9.465110581e-02f, -3.067653565e-03f,
+    9.053088537e-02f, 1.246613071e-01f, 7.690394882e-02f, -2.137023610e-02f, -1.056066957e-01f, -1.204720082e-01f, -5.620141621e-02f, 4.498687957e-02f,
+    1.166240999e-01f, 1.116530376e-01f, 3.333909468e-02f, -6.687470249e-02f, -1.231597053e-01f, -9.854330345e-02f, -9.195570450e-03f, 8.619256809e-02f,
+    1.249623523e-01f, 8.164660537e-02f, -1.530133440e-02f, -1.021981016e-01f, -1.219627663e-01f, -6.161227403e-02f, 3.921021755e-02f, 1.142762195e-01f,
+  },
+  {
+    1.136459979e-01f, 3.481496117e-02f, -6.816562355e-02f, -1.238628294e-01f, -9.364204932e-02f, 1.533942286e-03f, 9.564590820e-02f, 1.234126773e-01f,
+    6.557371033e-02f, -3.775074366e-02f, -1.148892315e-01f, -1.123343082e-01f, -3.185820745e-02f, 7.071647635e-02f, 1.242383713e-01f, 9.158178396e-02f,
+    -4.600902868e-03f, -9.759215357e-02f, -1.228881859e-01f, -6.294229797e-02f, 4.066378652e-02f, 1.160632601e-01f, 1.109549526e-01f, 2.888226354e-02f,
+    -7.322473218e-02f, -1.245390765e-01f, -8.946635316e-02f, 7.665092038e-03f, 9.947961308e-02f, 1.222896713e-01f, 6.027297151e-02f, -4.355233503e-02f,
+    -1.171673765e-01f, -1.095087618e-01f, -2.588892202e-02f, 7.568888018e-02f, 1.247647641e-01f, 8.729703118e-02f, -1.072466404e-02f, -1.013071498e-01f,
+    -1.216174940e-01f, -5.756733887e-02f, 4.641464924e-02f, 1.182009157e-01f, 1.079966070e-01f, 2.287998599e-02f, -7.810743602e-02f, -1.249152981e-01f,
+    -8.507512472e-02f, 1.377777591e-02f, 1.030736628e-01f, 1.208720589e-01f, 5.482702982e-02f, -4.924900501e-02f, -1.191632550e-01f, -1.064193991e-01f,
+    -1.985726792e-02f, 8.047894286e-02f, 1.249905877e-01f, 8.280197220e-02f, -1.682258856e-02f, -1.047780882e-01f, -1.200538149e-01f, -5.205369501e-02f,
+    5.205369501e-02f, 1.200538149e-01f, 1.047780882e-01f, 1.682258856e-02f, -8.280197220e-02f, -1.249905877e-01f, -8.047894286e-02f, 1.985726792e-02f,
+    1.064193991e-01f, 1.191632550e-01f, 4.924900501e-02f, -5.482702982e-02f, -1.208720589e-01f, -1.030736628e-01f, -1.377777591e-02f, 8.507512472e-02f,
+    1.249152981e-01f, 7.810743602e-02f, -2.287998599e-02f, -1.079966070e-01f, -1.182009157e-01f, -4.641464924e-02f, 5.756733887e-02f, 1.216174940e-01f,
+    1.013071498e-01f, 1.072466404e-02f, -8.729703118e-02f, -1.247647641e-01f, -7.568888018e-02f, 2.588892202e-02f, 1.095087618e-01f, 1.171673765e-01f,
+    4.355233503e-02f, -6.027297151e-02f, -1.222896713e-01f, -9.947961308e-02f, -7.665092038e-03f, 8.946635316e-02f, 1.245390765e-01f, 7.322473218e-02f,
+    -2.888226354e-02f, -1.109549526e-01f, -1.160632601e-01f, -4.066378652e-02f, 6.294229797e-02f, 1.228881859e-01f, 9.759215357e-02f, 4.600902868e-03f,
+    -9.158178396e-02f, -1.242383713e-01f, -7.071647635e-02f, 3.185820745e-02f, 1.123343082e-01f, 1.148892315e-01f, 3.775074366e-02f, -6.557371033e-02f,
+    -1.234126773e-01f, -9.564590820e-02f, -1.533942286e-03f, 9.364204932e-02f, 1.238628294e-01f, 6.816562355e-02f, -3.481496117e-02f, -1.136459979e-01f,
+  },
+  {
+    1.129986616e-01f, 3.037252249e-02f, -7.446241306e-02f, -1.248494320e-01f, -8.394486936e-02f, 1.834130931e-02f, 1.072160763e-01f, 1.176930081e-01f,
+    4.211123167e-02f, -6.426284302e-02f, -1.236470637e-01f, -9.261889067e-02f, 6.133459291e-03f, 1.004009414e-01f, 1.212539066e-01f, 5.344438668e-02f,
+    -5.344438668e-02f, -1.212539066e-01f, -1.004009414e-01f, -6.133459291e-03f, 9.261889067e-02f, 1.236470637e-01f, 6.426284302e-02f, -4.211123167e-02f,
+    -1.176930081e-01f, -1.072160763e-01f, -1.834130931e-02f, 8.394486936e-02f, 1.248494320e-01f, 7.446241306e-02f, -3.037252249e-02f, -1.129986616e-01f,
+    -1.129986616e-01f, -3.037252249e-02f, 7.446241306e-02f, 1.248494320e-01f, 8.394486936e-02f, -1.834130931e-02f, -1.072160763e-01f, -1.176930081e-01f,
+    -4.211123167e-02f, 6.426284302e-02f, 1.236470637e-01f, 9.261889067e-02f, -6.133459291e-03f, -1.004009414e-01f, -1.212539066e-01f, -5.344438668e-02f,
+    5.344438668e-02f, 1.212539066e-01f, 1.004009414e-01f, 6.133459291e-03f, -9.261889067e-02f, -1.236470637e-01f, -6.426284302e-02f, 4.211123167e-02f,
+    1.176930081e-01f, 1.072160763e-01f, 1.834130931e-02f, -8.394486936e-02f, -1.248494320e-01f, -7.446241306e-02f, 3.037252249e-02f, 1.129986616e-01f,
+    1.129986616e-01f, 3.037252249e-02f, -7.446241306e-02f, -1.248494320e-01f, -8.394486936e-02f, 1.834130931e-02f, 1.072160763e-01f, 1.176930081e-01f,
+    4.211123167e-02f, -6.426284302e-02f, -1.236470637e-01f, -9.261889067e-02f, 6.133459291e-03f, 1.004009414e-01f, 1.212539066e-01f, 5.344438668e-02f,
+    -5.344438668e-02f, -1.212539066e-01f, -1.004009414e-01f, -6.133459291e-03f, 9.261889067e-02f, 1.236470637e-01f, 6.426284302e-02f, -4.211123167e-02f,
+    -1.176930081e-01f, -1.072160763e-01f, -1.834130931e-02f, 8.394486936e-02f, 1.248494320e-01f, 7.446241306e-02f, -3.037252249e-02f, -1.129986616e-01f,
+    -1.129986616e-01f, -3.037252249e-02f, 7.446241306e-02f, 1.248494320e-01f, 8.394486936e-02f, -1.834130931e-02f, -1.072160763e-01f, -1.176930081e-01f,
+    -4.211123167e-02f, 6.426284302e-02f, 1.236470637e-01f, 9.261889067e-02f, -6.133459291e-03f, -1.004009414e-01f, -1.212539066e-01f, -5.344438668e-02f,
+    5.344438668e-02f, 1.212539066e-01f, 1.004009414e-01f, 6.133459291e-03f, -9.261889067e-02f, -1.236470637e-01f, -6.426284302e-02f, 4.211123167e-02f,
+    1.176930081e-01f, 1.072160763e-01f, 1.834130931e-02f, -8.394486936e-02f, -1.248494320e-01f, -7.446241306e-02f, 3.037252249e-02f, 1.129986616e-01f,
+  },
+  {
+    1.123343082e-01f, 2.588892202e-02f, -8.047894286e-02f, -1.249152981e-01f, -7.322473218e-02f, 3.481496117e-02f, 1.160632601e-01f, 1.079966070e-01f,
+    1.682258856e-02f, -8.729703118e-02f, -1.242383713e-01f, -6.557371033e-02f, 4.355233503e-02f, 1.191632550e-01f, 1.030736628e-01f, 7.665092038e-03f,
+    -9.364204932e-02f, -1.228881859e-01f, -5.756733887e-02f, 5.205369501e-02f, 1.216174940e-01f, 9.759215357e-02f, -1.533942286e-03f, -9.947961308e-02f,
+    -1.208720589e-01f, -4.924900501e-02f, 6.027297151e-02f, 1.234126773e-01f, 9.158178396e-02f, -1.072466404e-02f, -1.047780882e-01f, -1.182009157e-01f,
+    -4.066378652e-02f, 6.816562355e-02f, 1.245390765e-01f, 8.507512472e-02f, -1.985726792e-02f, -1.095087618e-01f, -1.148892315e-01f, -3.185820745e-02f,
+    7.568888018e-02f, 1.249905877e-01f, 7.810743602e-02f, -2.888226354e-02f, -1.136459979e-01f, -1.109549526e-01f, -2.287998599e-02f, 8.280197220e-02f,
+    1.247647641e-01f, 7.071647635e-02f, -3.775074366e-02f, -1.171673765e-01f, -1.064193991e-01f, -1.377777591e-02f, 8.946635316e-02f, 1.238628294e-01f,
+    6.294229797e-02f, -4.641464924e-02f, -1.200538149e-01f, -1.013071498e-01f, -4.600902868e-03f, 9.564590820e-02f, 1.222896713e-01f, 5.482702982e-02f,
+    -5.482702982e-02f, -1.222896713e-01f, -9.564590820e-02f, 4.600902868e-03f, 1.013071498e-01f, 1.200538149e-01f, 4.641464924e-02f, -6.294229797e-02f,
+    -1.238628294e-01f, -8.946635316e-02f, 1.377777591e-02f, 1.064193991e-01f, 1.171673765e-01f, 3.775074366e-02f, -7.071647635e-02f, -1.247647641e-01f,
+    -8.280197220e-02f, 2.287998599e-02f, 1.109549526e-01f, 1.136459979e-01f, 2.888226354e-02f, -7.810743602e-02f, -1.249905877e-01f, -7.568888018e-02f,
+    3.185820745e-02f, 1.148892315e-01f, 1.095087618e-01f, 1.985726792e-02f, -8.507512472e-02f, -1.245390765e-01f, -6.816562355e-02f, 4.066378652e-02f,
+    1.182009157e-01f, 1.047780882e-01f, 1.072466404e-02f, -9.158178396e-02f, -1.234126773e-01f, -6.027297151e-02f, 4.924900501e-02f, 1.208720589e-01f,
+    9.947961308e-02f, 1.533942286e-03f, -9.759215357e-02f, -1.216174940e-01f, -5.205369501e-02f, 5.756733887e-02f, 1.228881859e-01f, 9.364204932e-02f,
+    -7.665092038e-03f, -1.030736628e-01f, -1.191632550e-01f, -4.355233503e-02f, 6.557371033e-02f, 1.242383713e-01f, 8.729703118e-02f, -1.682258856e-02f,
+    -1.079966070e-01f, -1.160632601e-01f, -3.481496117e-02f, 7.322473218e-02f, 1.249152981e-01f, 8.047894286e-02f, -2.588892202e-02f, -1.123343082e-01f,
+  },
+  {
+    1.116530376e-01f, 2.137023610e-02f, -8.619256809e-02f, -1.240599418e-01f, -6.161227403e-02f, 5.065516425e-02f, 1.219627663e-01f, 9.465110581e-02f,
+    -9.195570450e-03f, -1.056066957e-01f, -1.166240999e-01f, -3.333909468e-02f, 7.690394882e-02f, 1.249623523e-01f, 7.197602393e-02f, -3.921021755e-02f,
+    -1.186910226e-01f, -1.021981016e-01f, -3.067653565e-03f, 9.854330345e-02f, 1.204720082e-01f, 4.498687957e-02f, -6.687470249e-02f, -1.246613071e-01f,
+    -8.164660537e-02f, 2.738765502e-02f, 1.142762195e-01f, 1.087608739e-01f, 1.530133440e-02f, -9.053088537e-02f, -1.231597053e-01f, -5.620141621e-02f,
+    5.620141621e-02f, 1.231597053e-01f, 9.053088537e-02f, -1.530133440e-02f, -1.087608739e-01f, -1.142762195e-01f, -2.738765502e-02f, 8.164660537e-02f,
+    1.246613071e-01f, 6.687470249e-02f, -4.498687957e-02f, -1.204720082e-01f, -9.854330345e-02f, 3.067653565e-03f, 1.021981016e-01f, 1.186910226e-01f,
+    3.921021755e-02f, -7.197602393e-02f, -1.249623523e-01f, -7.690394882e-02f, 3.333909468e-02f, 1.166240999e-01f, 1.056066957e-01f, 9.195570450e-03f,
+    -9.465110581e-02f, -1.219627663e-01f, -5.065516425e-02f, 6.161227403e-02f, 1.240599418e-01f, 8.619256809e-02f, -2.137023610e-02f, -1.116530376e-01f,
+    -1.116530376e-01f, -2.137023610e-02f, 8.619256809e-02f, 1.240599418e-01f, 6.161227403e-02f, -5.065516425e-02f, -1.219627663e-01f, -9.465110581e-02f,
+    9.195570450e-03f, 1.056066957e-01f, 1.166240999e-01f, 3.333909468e-02f, -7.690394882e-02f, -1.249623523e-01f, -7.197602393e-02f, 3.921021755e-02f,
+    1.186910226e-01f, 1.021981016e-01f, 3.067653565e-03f, -9.854330345e-02f, -1.204720082e-01f, -4.498687957e-02f, 6.687470249e-02f, 1.246613071e-01f,
+    8.164660537e-02f, -2.738765502e-02f, -1.142762195e-01f, -1.087608739e-01f, -1.530133440e-02f, 9.053088537e-02f, 1.231597053e-01f, 5.620141621e-02f,
+    -5.620141621e-02f, -1.231597053e-01f, -9.053088537e-02f, 1.530133440e-02f, 1.087608739e-01f, 1.142762195e-01f, 2.738765502e-02f, -8.164660537e-02f,
+    -1.246613071e-01f, -6.687470249e-02f, 4.498687957e-02f, 1.204720082e-01f, 9.854330345e-02f, -3.067653565e-03f, -1.021981016e-01f, -1.186910226e-01f,
+    -3.921021755e-02f, 7.197602393e-02f, 1.249623523e-01f, 7.690394882e-02f, -3.333909468e-02f, -1.166240999e-01f, -1.056066957e-01f, -9.195570450e-03f,
+    9.465110581e-02f, 1.219627663e-01f, 5.065516425e-02f, -6.161227403e-02f, -1.240599418e-01f, -8.619256809e-02f, 2.137023610e-02f, 1.116530376e-01f,
+  },
+  {
+    1.109549526e-01f, 1.682258856e-02f, -9.158178396e-02f, -1.222896713e-01f, -4.924900501e-02f, 6.557371033e-02f, 1.247647641e-01f, 7.810743602e-02f,
+    -3.481496117e-02f, -1.182009157e-01f, -1.013071498e-01f, 1.533942286e-03f, 1.030736628e-01f, 1.171673765e-01f, 3.185820745e-02f, -8.047894286e-02f,
+    -1.245390765e-01f, -6.294229797e-02f, 5.205369501e-02f, 1.228881859e-01f, 8.946635316e-02f, -1.985726792e-02f, -1.123343082e-01f, -1.095087618e-01f,
+    -1.377777591e-02f, 9.364204932e-02f, 1.216174940e-01f, 4.641464924e-02f, -6.816562355e-02f, -1.249152981e-01f, -7.568888018e-02f, 3.775074366e-02f,
+    1.191632550e-01f, 9.947961308e-02f, -4.600902868e-03f, -1.047780882e-01f, -1.160632601e-01f, -2.888226354e-02f, 8.280197220e-02f, 1.242383713e-01f,
+    6.027297151e-02f, -5.482702982e-02f, -1.234126773e-01f, -8.729703118e-02f, 2.287998599e-02f, 1.136459979e-01f, 1.079966070e-01f, 1.072466404e-02f,
+    -9.564590820e-02f, -1.208720589e-01f, -4.355233503e-02f, 7.071647635e-02f, 1.249905877e-01f, 7.322473218e-02f, -4.066378652e-02f, -1.200538149e-01f,
+    -9.759215357e-02f, 7.665092038e-03f, 1.064193991e-01f, 1.148892315e-01f, 2.588892202e-02f, -8.507512472e-02f, -1.238628294e-01f, -5.756733887e-02f,
+    5.756733887e-02f, 1.238628294e-01f, 8.507512472e-02f, -2.588892202e-02f, -1.148892315e-01f, -1.064193991e-01f, -7.665092038e-03f, 9.759215357e-02f,
+    1.200538149e-01f, 4.066378652e-02f, -7.322473218e-02f, -1.249905877e-01f, -7.071647635e-02f, 4.355233503e-02f, 1.208720589e-01f, 9.564590820e-02f,
+    -1.072466404e-02f, -1.079966070e-01f, -1.136459979e-01f, -2.287998599e-02f, 8.729703118e-02f, 1.234126773e-01f, 5.482702982e-02f, -6.027297151e-02f,
+    -1.242383713e-01f, -8.280197220e-02f, 2.888226354e-02f, 1.160632601e-01f, 1.047780882e-01f, 4.600902868e-03f, -9.947961308e-02f, -1.191632550e-01f,
+    -3.775074366e-02f, 7.568888018e-02f, 1.249152981e-01f, 6.816562355e-02f, -4.641464924e-02f, -1.216174940e-01f, -9.364204932e-02f, 1.377777591e-02f,
+    1.095087618e-01f, 1.123343082e-01f, 1.985726792e-02f, -8.946635316e-02f, -1.228881859e-01f, -5.205369501e-02f, 6.294229797e-02f, 1.245390765e-01f,
+    8.047894286e-02f, -3.185820745e-02f, -1.171673765e-01f, -1.030736628e-01f, -1.533942286e-03f, 1.013071498e-01f, 1.182009157e-01f, 3.481496117e-02f,
+    -7.810743602e-02f, -1.247647641e-01f, -6.557371033e-02f, 4.924900501e-02f, 1.222896713e-01f, 9.158178396e-02f, -1.682258856e-02f, -1.109549526e-01f,
+  },
+};
+
+#endif // MFCC_TABLES_H
@@ -1,95 +1,633 @@
 #include <stdio.h>
 #include <string.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_bit_defs.h"
 #include <sys/socket.h>
 #include <netdb.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <sys/uio.h>
 #include "network_socket.h"
+#include "stream_frame.h"
+#include "audio_metrics.h"
+#include "audio_trace.h"
 
 static const char *TAG = "NETWORK_SOCKET";
 
+#define NETWORK_SOCKET_CONNECTED_BIT    BIT0
+#define NETWORK_SOCKET_IDLE_BIT         BIT1
+
+typedef struct {
+    struct iovec iov[NETWORK_SOCKET_PUBLISH_MAX_IOV];
+    int iovcnt;
+    size_t len;
+    uint8_t codec;
+    uint32_t sample_rate;
+    int64_t enqueue_time_us;
+    audio_block_t *block;       // 非 NULL 时发送完成后释放引用
+} network_socket_job_t;
+
 // 全局变量用于存储 socket 文件描述符
 static int s_socket = -1;
+static uint32_t s_connection = 0;      // 连接代数, 每次连上加 1
+static SemaphoreHandle_t s_socket_mutex = NULL;
+static EventGroupHandle_t s_socket_events = NULL;
+static QueueHandle_t s_publish_queue = NULL;
+static TaskHandle_t s_socket_task_handle = NULL;
 
-int network_socket_init()
+#if NETWORK_SOCKET_USE_UDP
+static uint32_t s_udp_packet_seq = 0;
+static uint32_t s_udp_unit_id = 0;
+static uint32_t s_udp_dropped = 0;
+#if NETWORK_SOCKET_UDP_FEC_GROUP > 0
+static uint8_t s_udp_parity[NETWORK_SOCKET_UDP_HEADER_SIZE + NETWORK_SOCKET_UDP_PAYLOAD];
+static size_t s_udp_parity_len = 0;
+static uint32_t s_udp_group_base = 0;
+static int s_udp_group_count = 0;
+#endif
+#endif
+
+static void network_socket_set_options(int sock)
+{
+    int one = 1;
+    int sndbuf = NETWORK_SOCKET_SNDBUF_SIZE;
+    int idle = NETWORK_SOCKET_KEEPALIVE_IDLE_S;
+    int intvl = NETWORK_SOCKET_KEEPALIVE_INTVL_S;
+    int count = NETWORK_SOCKET_KEEPALIVE_COUNT;
+    struct timeval timeout = {
+        .tv_sec = NETWORK_SOCKET_SEND_TIMEOUT_MS / 1000,
+        .tv_usec = (NETWORK_SOCKET_SEND_TIMEOUT_MS % 1000) * 1000,
+    };
+
+    // 这些选项失败不影响功能 (取决于 lwIP 配置), 只记录
+    if (setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one)) != 0)
+        ESP_LOGW(TAG, "TCP_NODELAY not supported: %d", errno);
+    if (setsockopt(sock, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf)) != 0)
+        ESP_LOGD(TAG, "SO_SNDBUF not supported: %d", errno);
+    if (setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout)) != 0)
+        ESP_LOGW(TAG, "SO_SNDTIMEO not supported: %d", errno);
+    if (setsockopt(sock, SOL_SOCKET, SO_KEEPALIVE, &one, sizeof(one)) == 0)
+    {
+        setsockopt(sock, IPPROTO_TCP, TCP_KEEPIDLE, &idle, sizeof(idle));
+        setsockopt(sock, IPPROTO_TCP, TCP_KEEPINTVL, &intvl, sizeof(intvl));
+        setsockopt(sock, IPPROTO_TCP, TCP_KEEPCNT, &count, sizeof(count));
+    }
+}
+
+/**
+ * @brief 非阻塞 connect + select 超时, 成功后恢复阻塞模式.
+ * UDP 模式下 connect 只绑定默认目的地址, 不需要握手.
+ */
+static int network_socket_connect(void)
 {
-    int addr_family = AF_INET;
-    int ip_protocol = IPPROTO_IP;
-    
-    // 1. 设置远程服务器地址信息
     struct sockaddr_in dest_addr;
     dest_addr.sin_addr.s_addr = inet_addr(HOST_IP_ADDR);
     dest_addr.sin_family = AF_INET;
     dest_addr.sin_port = htons(PORT);
 
-    // 2. 创建 socket
-    s_socket = socket(addr_family, SOCK_STREAM, ip_protocol);
-    if (s_socket < 0) {
+#if NETWORK_SOCKET_USE_UDP
+    int udp = socket(AF_INET, SOCK_DGRAM, IPPROTO_IP);
+    if (udp < 0) {
         ESP_LOGE(TAG, "Failed to create socket: %d", errno);
         return -1;
     }
-    ESP_LOGI(TAG, "Socket created, connecting to %s:%d", HOST_IP_ADDR, PORT);
+    if (connect(udp, (struct sockaddr *)&dest_addr, sizeof(dest_addr)) != 0) {
+        ESP_LOGW(TAG, "Socket connection failed: %d", errno);
+        close(udp);
+        return -1;
+    }
+    return udp;
+#else
+    int sock = socket(AF_INET, SOCK_STREAM, IPPROTO_IP);
+    if (sock < 0) {
+        ESP_LOGE(TAG, "Failed to create socket: %d", errno);
+        return -1;
+    }
+
+    int flags = fcntl(sock, F_GETFL, 0);
+    fcntl(sock, F_SETFL, flags | O_NONBLOCK);
+
+    int err = connect(sock, (struct sockaddr *)&dest_addr, sizeof(dest_addr));
+    if ((err != 0) && (errno != EINPROGRESS)) {
+        ESP_LOGW(TAG, "Socket connection failed: %d", errno);
+        close(sock);
+        return -1;
+    }
 
-    // 3. 连接服务器
-    int err = connect(s_socket, (struct sockaddr *)&dest_addr, sizeof(dest_addr));
     if (err != 0) {
-        ESP_LOGE(TAG, "Socket connection failed: %d", errno);
+        fd_set wfds;
+        struct timeval timeout = {
+            .tv_sec = NETWORK_SOCKET_CONNECT_TIMEOUT_MS / 1000,
+            .tv_usec = (NETWORK_SOCKET_CONNECT_TIMEOUT_MS % 1000) * 1000,
+        };
+        int so_error = 0;
+        socklen_t len = sizeof(so_error);
+
+        FD_ZERO(&wfds);
+        FD_SET(sock, &wfds);
+        err = select(sock + 1, NULL, &wfds, NULL, &timeout);
+        if (err <= 0) {
+            ESP_LOGW(TAG, "Socket connection %s.", (err == 0) ? "timed out" : "select failed");
+            close(sock);
+            return -1;
+        }
+        getsockopt(sock, SOL_SOCKET, SO_ERROR, &so_error, &len);
+        if (so_error != 0) {
+            ESP_LOGW(TAG, "Socket connection failed: %d", so_error);
+            close(sock);
+            return -1;
+        }
+    }
+
+    fcntl(sock, F_SETFL, flags & ~O_NONBLOCK);
+    network_socket_set_options(sock);
+    return sock;
+#endif
+}
+
+static void network_socket_drop(void)
+{
+    if (s_socket >= 0) {
+        audio_metrics_count(AUDIO_METRICS_DISCONNECTS);
+        shutdown(s_socket, SHUT_RDWR);
         close(s_socket);
         s_socket = -1;
+    }
+    xEventGroupClearBits(s_socket_events, NETWORK_SOCKET_CONNECTED_BIT);
+}
+
+/**
+ * @brief 分散发送: 一次 sendmsg 提交所有段, 部分写入时跳过已发送的部分继续.
+ * iov 会被修改, 调用者传入副本.
+ */
+static int network_socket_sendv_all(int sock, struct iovec *iov, int iovcnt)
+{
+    size_t total = 0;
+    struct msghdr msg = {0};
+
+    for (int i = 0; i < iovcnt; i++)
+        total += iov[i].iov_len;
+
+    while (iovcnt > 0) {
+        msg.msg_iov = iov;
+        msg.msg_iovlen = iovcnt;
+        int n = sendmsg(sock, &msg, 0);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            AUDIO_TRACE1(SOCKET_SEND_ERROR, errno);
+            audio_metrics_count(AUDIO_METRICS_SEND_ERRORS);
+            return -1;
+        }
+
+        size_t sent = (size_t)n;
+        while ((iovcnt > 0) && (sent >= iov->iov_len)) {
+            sent -= iov->iov_len;
+            iov++;
+            iovcnt--;
+        }
+        if (iovcnt > 0) {
+            audio_metrics_count(AUDIO_METRICS_PARTIAL_SENDS);
+            iov->iov_base = (char *)iov->iov_base + sent;
+            iov->iov_len -= sent;
+        }
+    }
+    return (int)total;
+}
+
+#if NETWORK_SOCKET_USE_UDP
+/**
+ * @brief 发送一个数据报; lwIP 缓冲耗尽 (ENOMEM) 时稍等重试, 仍失败则丢弃而不是阻塞音频.
+ */
+static int network_socket_udp_send(int sock, struct iovec *iov, int iovcnt)
+{
+    struct msghdr msg = {
+        .msg_iov = iov,
+        .msg_iovlen = iovcnt,
+    };
+
+    for (int retry = 0; retry <= NETWORK_SOCKET_UDP_SEND_RETRIES; retry++) {
+        if (sendmsg(sock, &msg, 0) >= 0)
+            return 0;
+        if ((errno != ENOMEM) && (errno != ENOBUFS) && (errno != EAGAIN))
+            break;
+        vTaskDelay(1);
+    }
+    s_udp_dropped++;
+    audio_metrics_count(AUDIO_METRICS_UDP_DROPS);
+    AUDIO_TRACE2(UDP_DROPPED, errno, s_udp_dropped);
+    return -1;
+}
+
+#if NETWORK_SOCKET_UDP_FEC_GROUP > 0
+static void network_socket_udp_parity_add(const void *data, size_t offset, size_t len)
+{
+    const uint8_t *src = (const uint8_t *)data;
+    for (size_t i = 0; i < len; i++)
+        s_udp_parity[offset + i] ^= src[i];
+    if (offset + len > s_udp_parity_len)
+        s_udp_parity_len = offset + len;
+}
+
+static void network_socket_udp_parity_send(int sock)
+{
+    network_socket_udp_header_t *header = (network_socket_udp_header_t *)s_udp_parity;
+    struct iovec iov = {
+        .iov_base = s_udp_parity,
+        .iov_len = s_udp_parity_len,
+    };
+
+    header->magic = NETWORK_SOCKET_UDP_MAGIC;
+    header->flags = NETWORK_SOCKET_UDP_FLAG_PARITY;
+    header->group_size = (uint8_t)s_udp_group_count;
+    header->packet_seq = s_udp_group_base;
+    network_socket_udp_send(sock, &iov, 1);
+
+    memset(s_udp_parity, 0, sizeof(s_udp_parity));
+    s_udp_parity_len = NETWORK_SOCKET_UDP_HEADER_SIZE;
+    s_udp_group_count = 0;
+}
+#endif
+
+/**
+ * @brief 把一个 sendv 单元切成 MTU 大小的数据报 (不经过暂存缓冲区, 直接按 iov 切片).
+ * 单个数据报丢失只影响它所在的单元, 接收端的流帧解析不会失步.
+ */
+static int network_socket_udp_sendv(int sock, const struct iovec *iov, int iovcnt)
+{
+    network_socket_udp_header_t header;
+    struct iovec slice[NETWORK_SOCKET_MAX_IOV + 1];
+    size_t total = 0;
+    size_t consumed = 0;
+    int index = 0;
+
+    for (int i = 0; i < iovcnt; i++)
+        total += iov[i].iov_len;
+
+    int frag_count = (int)((total + NETWORK_SOCKET_UDP_PAYLOAD - 1) / NETWORK_SOCKET_UDP_PAYLOAD);
+    if ((frag_count == 0) || (frag_count > UINT8_MAX)) {
+        ESP_LOGE(TAG, "Cannot fragment %u bytes into datagrams.", (unsigned)total);
+        return -1;
+    }
+
+    header.magic = NETWORK_SOCKET_UDP_MAGIC;
+    header.flags = 0;
+    header.group_size = NETWORK_SOCKET_UDP_FEC_GROUP;
+    header.unit_id = s_udp_unit_id++;
+    header.frag_count = (uint8_t)frag_count;
+
+    for (int frag = 0; frag < frag_count; frag++) {
+        size_t len = total - (size_t)frag * NETWORK_SOCKET_UDP_PAYLOAD;
+        if (len > NETWORK_SOCKET_UDP_PAYLOAD)
+            len = NETWORK_SOCKET_UDP_PAYLOAD;
+
+        header.packet_seq = s_udp_packet_seq++;
+        header.frag_index = (uint8_t)frag;
+        header.payload_len = (uint16_t)len;
+        header.send_time_us = (uint32_t)esp_timer_get_time();
+
+        int n = 0;
+        slice[n++] = (struct iovec){ .iov_base = &header, .iov_len = sizeof(header) };
+        for (size_t need = len; need > 0; ) {
+            size_t take = iov[index].iov_len - consumed;
+            if (take > need)
+                take = need;
+            slice[n++] = (struct iovec){ .iov_base = (char *)iov[index].iov_base + consumed, .iov_len = take };
+            need -= take;
+            consumed += take;
+            if (consumed == iov[index].iov_len) {
+                index++;
+                consumed = 0;
+            }
+        }
+
+#if NETWORK_SOCKET_UDP_FEC_GROUP > 0
+        if (s_udp_group_count == 0) {
+            s_udp_group_base = header.packet_seq;
+            s_udp_parity_len = NETWORK_SOCKET_UDP_HEADER_SIZE;
+        }
+        network_socket_udp_parity_add((const uint8_t *)&header + NETWORK_SOCKET_UDP_PARITY_OFFSET,
+                                      NETWORK_SOCKET_UDP_PARITY_OFFSET,
+                                      NETWORK_SOCKET_UDP_HEADER_SIZE - NETWORK_SOCKET_UDP_PARITY_OFFSET);
+        size_t offset = NETWORK_SOCKET_UDP_HEADER_SIZE;
+        for (int i = 1; i < n; i++) {
+            network_socket_udp_parity_add(slice[i].iov_base, offset, slice[i].iov_len);
+            offset += slice[i].iov_len;
+        }
+#endif
+
+        network_socket_udp_send(sock, slice, n);
+
+#if NETWORK_SOCKET_UDP_FEC_GROUP > 0
+        if (++s_udp_group_count == NETWORK_SOCKET_UDP_FEC_GROUP)
+            network_socket_udp_parity_send(sock);
+#endif
+    }
+    // 数据报丢失由接收端掩盖, 对调用者来说单元总是 "发送成功"
+    return (int)total;
+}
+#endif
+
+static void network_socket_process_job(const network_socket_job_t *job)
+{
+    stream_frame_header_t session_header;
+    stream_frame_session_t session;
+    stream_frame_header_t audio_header;
+    stream_frame_header_t end_header;
+    struct iovec iov[NETWORK_SOCKET_MAX_IOV];
+    uint16_t session_id = stream_frame_next_session_id();
+    int iovcnt = 0;
+
+    stream_frame_build_session(&session, job->codec, job->sample_rate, job->enqueue_time_us);
+    stream_frame_build_header(&session_header, STREAM_FRAME_SESSION, session_id, 0, 0, sizeof(session), job->enqueue_time_us);
+    stream_frame_build_header(&audio_header, STREAM_FRAME_AUDIO, session_id, 0, 0, job->len, job->enqueue_time_us);
+    stream_frame_build_header(&end_header, STREAM_FRAME_END, session_id, 1, 0, 0, job->enqueue_time_us);
+
+    iov[iovcnt++] = (struct iovec){ .iov_base = &session_header, .iov_len = sizeof(session_header) };
+    iov[iovcnt++] = (struct iovec){ .iov_base = &session, .iov_len = sizeof(session) };
+    iov[iovcnt++] = (struct iovec){ .iov_base = &audio_header, .iov_len = sizeof(audio_header) };
+    for (int i = 0; i < job->iovcnt; i++)
+        iov[iovcnt++] = job->iov[i];
+    iov[iovcnt++] = (struct iovec){ .iov_base = &end_header, .iov_len = sizeof(end_header) };
+
+    size_t total = 3 * STREAM_FRAME_HEADER_SIZE + sizeof(session) + job->len;
+    int64_t start_us = esp_timer_get_time();
+    int bytes_sent = network_socket_sendv(iov, iovcnt);
+    audio_pool_release(job->block);
+    if (bytes_sent != (int)total) {
+        AUDIO_TRACE0(PUBLISH_FAILED);
+        return;
+    }
+    AUDIO_TRACE3(PUBLISHED, job->len, (start_us - job->enqueue_time_us) / 1000, (esp_timer_get_time() - start_us) / 1000);
+
+#if NETWORK_SOCKET_CLOSE_AFTER_PUBLISH
+    network_socket_close();
+#endif
+}
+
+/**
+ * @brief 连接管理任务: 断线后按指数退避重连; 连接可用时串行处理发布队列.
+ * 未连接期间发布任务留在队列里, 队列满时由 network_socket_data_publish() 丢弃.
+ */
+static void network_socket_task(void *arg)
+{
+    uint32_t backoff_ms = NETWORK_SOCKET_BACKOFF_MIN_MS;
+    network_socket_job_t job;
+
+    ESP_LOGI(TAG, "network_socket_task() start!");
+    audio_metrics_register_task();
+
+    while (1) {
+        EventBits_t bits = xEventGroupGetBits(s_socket_events);
+        if (!(bits & NETWORK_SOCKET_CONNECTED_BIT)) {
+            int sock = network_socket_connect();
+            if (sock < 0) {
+                audio_metrics_count(AUDIO_METRICS_CONNECT_FAILURES);
+                ESP_LOGW(TAG, "Reconnecting in %lu ms.", (unsigned long)backoff_ms);
+                vTaskDelay(pdMS_TO_TICKS(backoff_ms));
+                backoff_ms = (backoff_ms * 2 > NETWORK_SOCKET_BACKOFF_MAX_MS) ? NETWORK_SOCKET_BACKOFF_MAX_MS : backoff_ms * 2;
+                continue;
+            }
+
+            xSemaphoreTake(s_socket_mutex, portMAX_DELAY);
+            s_socket = sock;
+            s_connection++;
+            xSemaphoreGive(s_socket_mutex);
+            backoff_ms = NETWORK_SOCKET_BACKOFF_MIN_MS;
+            xEventGroupSetBits(s_socket_events, NETWORK_SOCKET_CONNECTED_BIT);
+            audio_metrics_count(AUDIO_METRICS_CONNECTS);
+            ESP_LOGI(TAG, "Successfully connected to %s:%d (%s).", HOST_IP_ADDR, PORT, NETWORK_SOCKET_USE_UDP ? "udp" : "tcp");
+        }
+
+        if (uxQueueMessagesWaiting(s_publish_queue) == 0)
+            xEventGroupSetBits(s_socket_events, NETWORK_SOCKET_IDLE_BIT);
+        if (xQueueReceive(s_publish_queue, &job, pdMS_TO_TICKS(100)) == pdPASS) {
+            xEventGroupClearBits(s_socket_events, NETWORK_SOCKET_IDLE_BIT);
+            network_socket_process_job(&job);
+        }
+    }
+}
+
+int network_socket_start(void)
+{
+    if (s_socket_task_handle)
+        return 0;
+
+    s_socket_mutex = xSemaphoreCreateMutex();
+    s_socket_events = xEventGroupCreate();
+    s_publish_queue = xQueueCreate(NETWORK_SOCKET_PUBLISH_QUEUE_LEN, sizeof(network_socket_job_t));
+    if (!s_socket_mutex || !s_socket_events || !s_publish_queue) {
+        ESP_LOGE(TAG, "Failed to create connection manager resources.");
+        return -1;
+    }
+
+    xEventGroupSetBits(s_socket_events, NETWORK_SOCKET_IDLE_BIT);
+    xTaskCreate(network_socket_task, "socket_task", 4096, NULL, 5, &s_socket_task_handle);
+    return 0;
+}
+
+/**
+ * @brief 启动连接管理 (如未启动) 并等待连接可用, 返回 socket 或 -1.
+ */
+int network_socket_init()
+{
+    if (network_socket_start() < 0)
+        return -1;
+
+    EventBits_t bits = xEventGroupWaitBits(s_socket_events, NETWORK_SOCKET_CONNECTED_BIT, pdFALSE, pdFALSE,
+                                           pdMS_TO_TICKS(NETWORK_SOCKET_CONNECT_TIMEOUT_MS));
+    if (!(bits & NETWORK_SOCKET_CONNECTED_BIT)) {
+        ESP_LOGE(TAG, "Not connected to %s:%d.", HOST_IP_ADDR, PORT);
         return -1;
     }
-    ESP_LOGI(TAG, "Successfully connected to host.");
-    
     return s_socket;
 }
 
 int network_socket_send(const void *data, size_t len)
 {
-    if (s_socket < 0) {
-        ESP_LOGE(TAG, "Socket is not initialized or connected.");
+    struct iovec iov = {
+        .iov_base = (void *)data,
+        .iov_len = len,
+    };
+    return network_socket_sendv(&iov, 1);
+}
+
+int network_socket_sendv_conn(uint32_t connection, const struct iovec *iov, int iovcnt)
+{
+    struct iovec local[NETWORK_SOCKET_MAX_IOV];
+    int bytes_sent = -1;
+
+    if ((iovcnt <= 0) || (iovcnt > NETWORK_SOCKET_MAX_IOV)) {
+        ESP_LOGE(TAG, "Invalid iovec count %d.", iovcnt);
         return -1;
     }
-    
-    // 使用 send() 函数发送数据
-    int bytes_sent = send(s_socket, data, len, 0);
-
-    if (bytes_sent < 0) {
-        ESP_LOGE(TAG, "Error occurred during sending: %d", errno);
+    if (s_socket_mutex == NULL) {
+        ESP_LOGE(TAG, "Socket is not initialized or connected.");
         return -1;
     }
-    
-    if (bytes_sent != len) {
-        // TCP 通常会保证发送完整，但仍需检查
-        ESP_LOGW(TAG, "Warning: Expected %zu bytes, but sent %d bytes.", len, bytes_sent);
+
+    memcpy(local, iov, iovcnt * sizeof(struct iovec));
+    xSemaphoreTake(s_socket_mutex, portMAX_DELAY);
+    if ((s_socket < 0) || ((connection != 0) && (connection != s_connection))) {
+        AUDIO_TRACE0(SOCKET_NOT_CONNECTED);
+    } else {
+#if NETWORK_SOCKET_USE_UDP
+        bytes_sent = network_socket_udp_sendv(s_socket, local, iovcnt);
+#else
+        bytes_sent = network_socket_sendv_all(s_socket, local, iovcnt);
+        if (bytes_sent < 0)
+            network_socket_drop();
+#endif
     }
+    xSemaphoreGive(s_socket_mutex);
     return bytes_sent;
 }
 
+int network_socket_sendv(const struct iovec *iov, int iovcnt)
+{
+    return network_socket_sendv_conn(0, iov, iovcnt);
+}
+
+uint32_t network_socket_connection(void)
+{
+    if (s_socket_mutex == NULL)
+        return 0;
+
+    xSemaphoreTake(s_socket_mutex, portMAX_DELAY);
+    uint32_t connection = (s_socket >= 0) ? s_connection : 0;
+    xSemaphoreGive(s_socket_mutex);
+    return connection;
+}
 
+/**
+ * @brief 结束当前会话: 关闭连接, 后台马上重新建立一个备用连接.
+ */
 void network_socket_close()
 {
+    if (s_socket_mutex == NULL)
+        return;
+
+    xSemaphoreTake(s_socket_mutex, portMAX_DELAY);
     if (s_socket >= 0) {
-        shutdown(s_socket, 0);
-        close(s_socket);
-        s_socket = -1;
+        network_socket_drop();
         ESP_LOGI(TAG, "Socket closed.");
     }
+    xSemaphoreGive(s_socket_mutex);
+}
+
+int network_socket_recv(void *buffer, size_t len, int timeout_ms)
+{
+    fd_set rfds;
+    struct timeval timeout = {
+        .tv_sec = timeout_ms / 1000,
+        .tv_usec = (timeout_ms % 1000) * 1000,
+    };
+
+    if (s_socket_mutex == NULL)
+        return -1;
+
+    xSemaphoreTake(s_socket_mutex, portMAX_DELAY);
+    int sock = s_socket;
+    uint32_t connection = s_connection;
+    xSemaphoreGive(s_socket_mutex);
+    if (sock < 0)
+        return -1;
+
+    FD_ZERO(&rfds);
+    FD_SET(sock, &rfds);
+    int err = select(sock + 1, &rfds, NULL, NULL, &timeout);
+    if (err <= 0)
+        return err;
+
+    int n = recv(sock, buffer, len, 0);
+    if (n <= 0) {
+        ESP_LOGW(TAG, "Connection closed by peer (%d).", (n < 0) ? errno : 0);
+        // 比较连接代数而不是 fd: 期间重连后新 socket 可能复用同一个 fd 号, 不能把它断掉
+        xSemaphoreTake(s_socket_mutex, portMAX_DELAY);
+        if ((s_socket >= 0) && (s_connection == connection))
+            network_socket_drop();
+        xSemaphoreGive(s_socket_mutex);
+        return -1;
+    }
+    return n;
 }
 
 int network_socket_data_publish(const void *data, size_t len)
 {
-    if (network_socket_init() < 0)
-    {
-        ESP_LOGE(TAG, "Failed to connect to host.");
+    struct iovec iov = {
+        .iov_base = (void *)data,
+        .iov_len = len,
+    };
+    return network_socket_data_publishv(&iov, 1, STREAM_CODEC_PCM16, 16000);
+}
+
+static int network_socket_enqueue(const struct iovec *iov, int iovcnt, uint8_t codec, uint32_t sample_rate,
+                                  audio_block_t *block)
+{
+    network_socket_job_t job = {
+        .iovcnt = iovcnt,
+        .len = 0,
+        .codec = codec,
+        .sample_rate = sample_rate,
+        .enqueue_time_us = esp_timer_get_time(),
+        .block = block,
+    };
+
+    if ((iovcnt <= 0) || (iovcnt > NETWORK_SOCKET_PUBLISH_MAX_IOV))
+        return ESP_FAIL;
+    if (network_socket_start() < 0)
         return ESP_FAIL;
+
+    for (int i = 0; i < iovcnt; i++) {
+        job.iov[i] = iov[i];
+        job.len += iov[i].iov_len;
     }
-    
-    int bytes_sent = network_socket_send(data, len);
 
-    if (bytes_sent != len)
+    if (xQueueSend(s_publish_queue, &job, 0) != pdPASS)
     {
-        ESP_LOGE(TAG, "Transmission failed or incomplete!");
+        AUDIO_TRACE1(PUBLISH_QUEUE_FULL, job.len);
+        audio_metrics_count(AUDIO_METRICS_PUBLISH_DROPS);
+        return ESP_FAIL;
     }
-
-    network_socket_close();
+    audio_metrics_queue_depth(AUDIO_METRICS_QUEUE_PUBLISH, uxQueueMessagesWaiting(s_publish_queue));
+    xEventGroupClearBits(s_socket_events, NETWORK_SOCKET_IDLE_BIT);
     return 0;
 }
+
+int network_socket_data_publishv(const struct iovec *iov, int iovcnt, uint8_t codec, uint32_t sample_rate)
+{
+    return network_socket_enqueue(iov, iovcnt, codec, sample_rate, NULL);
+}
+
+int network_socket_data_publish_block(audio_block_t *block, uint8_t codec, uint32_t sample_rate)
+{
+    struct iovec iov = {
+        .iov_base = block->data,
+        .iov_len = block->len,
+    };
+
+    audio_pool_retain(block);
+    int ret = network_socket_enqueue(&iov, 1, codec, sample_rate, block);
+    if (ret != 0)
+        audio_pool_release(block);
+    return ret;
+}
+
+int network_socket_flush(int timeout_ms)
+{
+    if (s_socket_events == NULL)
+        return 0;
+
+    EventBits_t bits = xEventGroupWaitBits(s_socket_events, NETWORK_SOCKET_IDLE_BIT, pdFALSE, pdFALSE,
+                                           pdMS_TO_TICKS(timeout_ms));
+    return (bits & NETWORK_SOCKET_IDLE_BIT) ? 0 : -1;
+}
@@ -1,14 +1,102 @@
 #ifndef NETWORK_SOCKET_H
 #define NETWORK_SOCKET_H
 
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/uio.h>
+#include "sdkconfig.h"
+#include "audio_pool.h"
+
+#ifdef CONFIG_IDF_TARGET_LINUX
+#define HOST_IP_ADDR "127.0.0.1"        // 主机模拟: 接收端跑在本机
+#else
 #define HOST_IP_ADDR "192.168.0.242"
+#endif
 #define PORT 8888
 
+// 连接管理
+#define NETWORK_SOCKET_CONNECT_TIMEOUT_MS   3000
+#define NETWORK_SOCKET_SEND_TIMEOUT_MS      2000
+#define NETWORK_SOCKET_BACKOFF_MIN_MS       250
+#define NETWORK_SOCKET_BACKOFF_MAX_MS       8000
+#define NETWORK_SOCKET_SNDBUF_SIZE          (16 * 1024)
+#define NETWORK_SOCKET_KEEPALIVE_IDLE_S     10
+#define NETWORK_SOCKET_KEEPALIVE_INTVL_S    5
+#define NETWORK_SOCKET_KEEPALIVE_COUNT      3
+
+// 发布队列
+#define NETWORK_SOCKET_PUBLISH_QUEUE_LEN    4
+#define NETWORK_SOCKET_MAX_IOV              8
+#define NETWORK_SOCKET_PUBLISH_MAX_IOV      4
+#define NETWORK_SOCKET_PUBLISH_TIMEOUT_MS   5000
+
+// UDP 传输: 每个 sendv 单元切成不超过 MTU 的数据报, 可选每 N 个数据报附加一个 XOR 校验报
+#ifdef CONFIG_AUDIO_STREAM_TRANSPORT_UDP
+#define NETWORK_SOCKET_USE_UDP              1
+#define NETWORK_SOCKET_UDP_FEC_GROUP        CONFIG_AUDIO_STREAM_UDP_FEC_GROUP
+#else
+#define NETWORK_SOCKET_USE_UDP              0
+#define NETWORK_SOCKET_UDP_FEC_GROUP        0
+#endif
+#define NETWORK_SOCKET_UDP_MAGIC            0x55AA
+#define NETWORK_SOCKET_UDP_PAYLOAD          1400    // 20 字节包头 + 1400 < 1472 (以太网 MTU - IP/UDP 头)
+#define NETWORK_SOCKET_UDP_FLAG_PARITY      0x01
+#define NETWORK_SOCKET_UDP_SEND_RETRIES     3
+
+/**
+ * UDP 数据报头 (小端, 20 字节).
+ * 校验报的 packet_seq 为组内第一个数据报的序号, group_size 为组内数据报个数;
+ * unit_id 到 send_time_us 这 12 个字节与负载一起参与 XOR, 丢失的数据报可以整体恢复.
+ */
+typedef struct __attribute__((packed)) {
+    uint16_t magic;
+    uint8_t flags;
+    uint8_t group_size;
+    uint32_t packet_seq;        // 数据报序号, 用于重排和丢包检测
+    uint32_t unit_id;           // sendv 单元序号 (一个单元包含若干完整的流帧)
+    uint8_t frag_index;
+    uint8_t frag_count;
+    uint16_t payload_len;
+    uint32_t send_time_us;      // 发送时刻 (esp_timer 低 32 位), 用于接收端估计抖动
+} network_socket_udp_header_t;
+
+#define NETWORK_SOCKET_UDP_HEADER_SIZE      20
+#define NETWORK_SOCKET_UDP_PARITY_OFFSET    8
+
+// 每次发布都是一个完整的分帧会话, 接收端按会话切分文件, 连接保持不断
+#define NETWORK_SOCKET_CLOSE_AFTER_PUBLISH  0
+
+int network_socket_start(void);
 int network_socket_init();
 int network_socket_send(const void *data, size_t len);
+int network_socket_sendv(const struct iovec *iov, int iovcnt);
 void network_socket_close();
-int network_socket_data_publish(const void *data, size_t len);
 
+/**
+ * @brief 当前连接的代数 (每次连上加 1), 未连接返回 0.
+ * 接收端按连接切分会话, 流会话记下开始时的代数并用 network_socket_sendv_conn() 发送:
+ * 断线后即使后台已经重连, 也返回 -1, 不会把半个会话续到新连接上. connection 为 0 时不检查.
+ */
+uint32_t network_socket_connection(void);
+int network_socket_sendv_conn(uint32_t connection, const struct iovec *iov, int iovcnt);
 
+/**
+ * @brief 从当前连接接收下行数据, 不占用发送锁. 返回字节数, 0 表示超时, 负值表示未连接或连接已断开.
+ */
+int network_socket_recv(void *buffer, size_t len, int timeout_ms);
+
+/**
+ * @brief 异步发布: 只把任务放入队列, 由连接管理任务在连接可用时发送.
+ * 负载被封装为一个独立会话: SESSION 帧 + AUDIO 帧 + END 帧 (见 stream_frame.h).
+ * network_socket_data_publish() 的负载为 16kHz PCM16.
+ * data (或 iov 指向的各段) 在发送完成前必须保持有效, 复用缓冲区前调用 network_socket_flush().
+ * iov 数组本身会被复制, 调用返回后即可释放.
+ * network_socket_data_publish_block() 发送 block->data 的前 block->len 字节, 发布任务持有一个引用
+ * 直到发送完成, 调用者可以立即 release 自己的引用, 不需要 flush.
+ */
+int network_socket_data_publish(const void *data, size_t len);
+int network_socket_data_publishv(const struct iovec *iov, int iovcnt, uint8_t codec, uint32_t sample_rate);
+int network_socket_data_publish_block(audio_block_t *block, uint8_t codec, uint32_t sample_rate);
+int network_socket_flush(int timeout_ms);
 
-#endif // NETWORK_SOCKET_H
\ No newline at end of file
+#endif // NETWORK_SOCKET_H
@@ -0,0 +1,30 @@
+// 由 script/resample_tables.py 生成, 请勿手工修改
+#ifndef RESAMPLE_TABLES_H
+#define RESAMPLE_TABLES_H
+
+#include <stdint.h>
+
+#define RESAMPLE_3_2_L       2
+#define RESAMPLE_3_2_M       3
+#define RESAMPLE_3_2_TAPS    24
+static const int16_t resample_3_2_coef[2][24] __attribute__((aligned(16))) = {
+    {9, 19, -98, 32, 327, -441, -457, 1565, -390, -3664, 5687, 18912, 13555, -867, -2823, 1403, 575, -786, 75, 245, -102, -30, 24, -1},
+    {-1, 24, -30, -102, 245, 75, -786, 575, 1403, -2823, -867, 13555, 18912, 5687, -3664, -390, 1565, -457, -441, 327, 32, -98, 19, 9},
+};
+
+#define RESAMPLE_2_1_L       1
+#define RESAMPLE_2_1_M       2
+#define RESAMPLE_2_1_TAPS    32
+static const int16_t resample_2_1_coef[1][32] __attribute__((aligned(16))) = {
+    {0, 14, 8, -58, -58, 139, 217, -224, -575, 207, 1242, 138, -2452, -1467, 5751, 13502, 13502, 5751, -1467, -2452, 138, 1242, 207, -575, -224, 217, 139, -58, -58, 8, 14, 0},
+};
+
+#define RESAMPLE_1_2_L       2
+#define RESAMPLE_1_2_M       1
+#define RESAMPLE_1_2_TAPS    16
+static const int16_t resample_1_2_coef[2][16] __attribute__((aligned(16))) = {
+    {27, -117, 279, -447, 413, 275, -2934, 27004, 11502, -4903, 2483, -1150, 435, -117, 15, 1},
+    {1, 15, -117, 435, -1150, 2483, -4903, 11502, 27004, -2934, 275, 413, -447, 279, -117, 27},
+};
+
+#endif // RESAMPLE_TABLES_H
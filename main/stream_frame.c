@@ -0,0 +1,133 @@
+#include <string.h>
+#include <stdbool.h>
+#include "stream_frame.h"
+
+static uint16_t stream_frame_session_counter = 0;
+
+void stream_frame_build_header(stream_frame_header_t *header, uint8_t type, uint16_t session_id,
+                               uint32_t sequence, uint32_t sample_index, uint32_t payload_len,
+                               uint64_t capture_time_us)
+{
+    header->sync = STREAM_FRAME_SYNC;
+    header->type = type;
+    header->flags = 0;
+    header->session_id = session_id;
+    header->reserved = 0;
+    header->sequence = sequence;
+    header->sample_index = sample_index;
+    header->payload_len = payload_len;
+    header->capture_time_us = capture_time_us;
+}
+
+void stream_frame_build_session(stream_frame_session_t *session, uint8_t codec, uint32_t sample_rate,
+                                uint64_t start_time_us)
+{
+    session->version = STREAM_FRAME_VERSION;
+    session->codec = codec;
+    session->channels = 1;
+    session->bits_per_sample = (codec == STREAM_CODEC_RAW32) ? 32 : 16;
+    session->sample_rate = sample_rate;
+    session->start_time_us = start_time_us;
+}
+
+uint16_t stream_frame_next_session_id(void)
+{
+    return ++stream_frame_session_counter;
+}
+
+static bool stream_frame_header_valid(const stream_frame_header_t *header)
+{
+    if ((header->sync != STREAM_FRAME_SYNC) || (header->payload_len > STREAM_FRAME_MAX_PAYLOAD))
+        return false;
+    switch (header->type)
+    {
+    case STREAM_FRAME_SESSION:
+    case STREAM_FRAME_AUDIO:
+    case STREAM_FRAME_VAD_START:
+    case STREAM_FRAME_VAD_END:
+    case STREAM_FRAME_METRICS:
+    case STREAM_FRAME_END:
+        return true;
+    default:
+        return false;
+    }
+}
+
+esp_err_t stream_frame_parser_init(stream_frame_parser_t *parser, uint8_t *buffer, size_t buffer_size,
+                                   stream_frame_callback_t callback, void *ctx)
+{
+    if ((parser == NULL) || (callback == NULL) || ((buffer == NULL) && (buffer_size != 0)))
+        return ESP_ERR_INVALID_ARG;
+
+    parser->buffer = buffer;
+    parser->buffer_size = buffer_size;
+    parser->callback = callback;
+    parser->ctx = ctx;
+    parser->resyncs = 0;
+    stream_frame_parser_reset(parser);
+    return ESP_OK;
+}
+
+void stream_frame_parser_reset(stream_frame_parser_t *parser)
+{
+    parser->have = 0;
+}
+
+esp_err_t stream_frame_parser_feed(stream_frame_parser_t *parser, const void *data, size_t len)
+{
+    const uint8_t *ptr = (const uint8_t *)data;
+    uint8_t *header_bytes = (uint8_t *)&parser->header;
+    esp_err_t result = ESP_OK;
+
+    while (len > 0)
+    {
+        if (parser->have < STREAM_FRAME_HEADER_SIZE)
+        {
+            size_t n = STREAM_FRAME_HEADER_SIZE - parser->have;
+            n = (n < len) ? n : len;
+            memcpy(header_bytes + parser->have, ptr, n);
+            parser->have += n;
+            ptr += n;
+            len -= n;
+
+            // 同步字不对时逐字节滑动, 直到重新对齐
+            while ((parser->have >= 2) && (parser->header.sync != STREAM_FRAME_SYNC))
+            {
+                memmove(header_bytes, header_bytes + 1, parser->have - 1);
+                parser->have--;
+                parser->resyncs++;
+            }
+            if (parser->have < STREAM_FRAME_HEADER_SIZE)
+                continue;
+
+            // 帧头完整但类型或长度无效: 同步字是负载中的巧合, 丢一个字节后继续找
+            if (!stream_frame_header_valid(&parser->header))
+            {
+                memmove(header_bytes, header_bytes + 1, STREAM_FRAME_HEADER_SIZE - 1);
+                parser->have--;
+                parser->resyncs++;
+                continue;
+            }
+        }
+
+        size_t payload_len = parser->header.payload_len;
+        size_t payload_have = parser->have - STREAM_FRAME_HEADER_SIZE;
+        size_t n = payload_len - payload_have;
+        n = (n < len) ? n : len;
+        if ((payload_len <= parser->buffer_size) && (n > 0))
+            memcpy(parser->buffer + payload_have, ptr, n);
+        parser->have += n;
+        ptr += n;
+        len -= n;
+
+        if (parser->have == STREAM_FRAME_HEADER_SIZE + payload_len)
+        {
+            if (payload_len <= parser->buffer_size)
+                parser->callback(&parser->header, parser->buffer, parser->ctx);
+            else
+                result = ESP_ERR_INVALID_SIZE;
+            parser->have = 0;
+        }
+    }
+    return result;
+}
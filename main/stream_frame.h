@@ -0,0 +1,89 @@
+#ifndef STREAM_FRAME_H
+#define STREAM_FRAME_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+/**
+ * 音频流分帧协议 (小端). 每帧 = 28 字节帧头 + payload_len 字节负载.
+ * 一个会话以 SESSION 帧开始 (负载为格式描述), 以 END 帧结束;
+ * 同一连接上可以有多个会话, 帧按 session_id 归属.
+ * sequence 按采集块计数 (包括被丢弃的块), 接收端据此统计丢失.
+ */
+#define STREAM_FRAME_SYNC           0x5AA5
+#define STREAM_FRAME_VERSION        1
+#define STREAM_FRAME_HEADER_SIZE    28
+#define STREAM_FRAME_SESSION_SIZE   16
+#define STREAM_FRAME_MAX_PAYLOAD    (1 << 20)   // 与 script/stream_frame.py MAX_PAYLOAD 一致, 超过视为假帧头
+
+typedef enum {
+    STREAM_FRAME_SESSION = 1,       // 负载: stream_frame_session_t
+    STREAM_FRAME_AUDIO = 2,         // 负载: 按会话 codec 编码的音频
+    STREAM_FRAME_VAD_START = 3,     // 语音段开始, 无负载
+    STREAM_FRAME_VAD_END = 4,       // 语音段结束, 无负载
+    STREAM_FRAME_METRICS = 5,       // 负载: audio_metrics_snapshot_t; 服务器发送空负载的 METRICS 帧请求一次快照
+    STREAM_FRAME_END = 0xFF,        // 会话结束, 无负载
+} stream_frame_type_t;
+
+typedef enum {
+    STREAM_CODEC_RAW32 = 0,
+    STREAM_CODEC_PCM16 = 1,
+    STREAM_CODEC_ADPCM = 2,
+} stream_codec_t;
+
+#pragma pack(1)
+typedef struct {
+    uint16_t sync;
+    uint8_t type;
+    uint8_t flags;
+    uint16_t session_id;
+    uint16_t reserved;
+    uint32_t sequence;
+    uint32_t sample_index;          // 本帧第一个样本在会话中的序号
+    uint32_t payload_len;
+    uint64_t capture_time_us;       // esp_timer 时间, 本帧最后一个样本采集完成时刻
+} stream_frame_header_t;
+
+typedef struct {
+    uint8_t version;
+    uint8_t codec;                  // stream_codec_t
+    uint8_t channels;
+    uint8_t bits_per_sample;        // 解码后的位宽
+    uint32_t sample_rate;
+    uint64_t start_time_us;
+} stream_frame_session_t;
+#pragma pack()
+
+void stream_frame_build_header(stream_frame_header_t *header, uint8_t type, uint16_t session_id,
+                               uint32_t sequence, uint32_t sample_index, uint32_t payload_len,
+                               uint64_t capture_time_us);
+void stream_frame_build_session(stream_frame_session_t *session, uint8_t codec, uint32_t sample_rate,
+                                uint64_t start_time_us);
+uint16_t stream_frame_next_session_id(void);
+
+// ================== 增量解析 ==================
+typedef void (*stream_frame_callback_t)(const stream_frame_header_t *header, const uint8_t *payload, void *ctx);
+
+typedef struct {
+    uint8_t *buffer;                // 负载缓冲区, 由调用者提供
+    size_t buffer_size;
+    size_t have;                    // 当前帧已收到的字节数 (帧头 + 负载)
+    stream_frame_header_t header;
+    stream_frame_callback_t callback;
+    void *ctx;
+    uint32_t resyncs;               // 因帧头无效 (同步字/类型/长度) 而丢弃的字节数
+} stream_frame_parser_t;
+
+esp_err_t stream_frame_parser_init(stream_frame_parser_t *parser, uint8_t *buffer, size_t buffer_size,
+                                   stream_frame_callback_t callback, void *ctx);
+void stream_frame_parser_reset(stream_frame_parser_t *parser);
+
+/**
+ * @brief 送入任意长度的字节流, 每解析出一个完整帧调用一次回调.
+ * 帧头的同步字, 类型或长度 (> STREAM_FRAME_MAX_PAYLOAD) 无效时丢弃一个字节重新同步 (计入 resyncs),
+ * 不会吞掉假帧头声明的负载. 合法但超过 buffer_size 的帧被跳过并返回 ESP_ERR_INVALID_SIZE, 解析继续有效.
+ */
+esp_err_t stream_frame_parser_feed(stream_frame_parser_t *parser, const void *data, size_t len);
+
+#endif // STREAM_FRAME_H
@@ -1,52 +1,366 @@
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
 #include "esp_log.h"
 #include "wav_audio.h"
+#include "audio_convert.h"
 
 static const char *TAG = "WAV_AUDIO";
 
 static char default_header[WAV_AUDIO_HEADER_SIZE];
 
+static const wav_audio_format_t wav_audio_default_format = {
+    .format = WAV_AUDIO_FORMAT_PCM,
+    .channels = WAV_AUDIO_NUM_OF_CHANNELS,
+    .sample_rate = WAV_AUDIO_SAMPLE_RATE,
+    .bits_per_sample = WAV_PCM16_BITS_PER_SAMPLE,
+};
+
 esp_err_t wav_audio_init(void)
 {
-    RiffChunk *riff = (RiffChunk *)(default_header);
-    FmtChunk *fmt = (FmtChunk *)(default_header + 12);
-    DataChunk *data = (DataChunk *)(default_header + 36);
+    wav_audio_build_header(&wav_audio_default_format, WAV_AUDIO_DEFAULT_DATA_SIZE, default_header);
+    ESP_LOGI(TAG, "wav_audio_init() Success!");
+    return ESP_OK;
+}
+
+esp_err_t wav_audio_default_header(char *buffer)
+{
+    memcpy(buffer, default_header, WAV_AUDIO_HEADER_SIZE);
+    return ESP_OK;
+}
+
+const char *wav_audio_get_default_header(void)
+{
+    return default_header;
+}
+
+esp_err_t wav_audio_data_process(char *input, char *output)
+{
+    int32_t *iptr = (int32_t *)(input);
+    int16_t *optr = (int16_t *)(output + WAV_AUDIO_HEADER_SIZE);
+    audio_convert_int32_to_int16(iptr, optr, WAV_AUDIO_DEFAULT_SAMPLE, AUDIO_CONVERT_DEFAULT_SHIFT);
+    memcpy(output, default_header, WAV_AUDIO_HEADER_SIZE);
+    return ESP_OK;
+}
+
+static bool wav_audio_format_valid(const wav_audio_format_t *format)
+{
+    if ((format->channels == 0) || (format->sample_rate == 0))
+        return false;
+    if (format->format == WAV_AUDIO_FORMAT_PCM)
+        return (format->bits_per_sample == 8) || (format->bits_per_sample == 16) ||
+               (format->bits_per_sample == 24) || (format->bits_per_sample == 32);
+    if (format->format == WAV_AUDIO_FORMAT_FLOAT)
+        return (format->bits_per_sample == 32) || (format->bits_per_sample == 64);
+    return false;
+}
+
+static uint16_t wav_audio_block_align(const wav_audio_format_t *format)
+{
+    return format->channels * (format->bits_per_sample / 8);
+}
+
+// RIFF 大小 = "WAVE" + fmt 块 + data 块头 + 数据 (奇数长度补一个填充字节)
+static uint32_t wav_audio_riff_size(uint32_t data_size)
+{
+    if (data_size == WAV_AUDIO_STREAMING_SIZE)
+        return WAV_AUDIO_STREAMING_SIZE;
+    return WAV_AUDIO_CHUNK_SIZE + data_size + (data_size & 1);
+}
+
+esp_err_t wav_audio_build_header(const wav_audio_format_t *format, uint32_t data_size, void *header)
+{
+    if ((format == NULL) || (header == NULL) || !wav_audio_format_valid(format))
+        return ESP_ERR_INVALID_ARG;
+
+    RiffChunk *riff = (RiffChunk *)(header);
+    FmtChunk *fmt = (FmtChunk *)((uint8_t *)header + 12);
+    DataChunk *data = (DataChunk *)((uint8_t *)header + 36);
+    uint16_t block_align = wav_audio_block_align(format);
 
     memcpy(riff->chunkId, "RIFF", 4);
-    riff->chunkSize = WAV_AUDIO_DEFAULT_TRUNK_SIZE;
+    riff->chunkSize = wav_audio_riff_size(data_size);
     memcpy(riff->format, "WAVE", 4);
 
     memcpy(fmt->subchunk1Id, "fmt ", 4);
     fmt->subchunk1Size = 16;
-    fmt->audioFormat = 1;
-    fmt->numChannels = WAV_AUDIO_NUM_OF_CHANNELS;
-    fmt->sampleRate = WAV_AUDIO_SAMPLE_RATE;
-    fmt->byteRate = WAV_PCM16_BYTE_RATE;
-    fmt->blockAlign = WAV_PCM16_BLOCK_ALIGN;
-    fmt->bitsPerSample = WAV_PCM16_BITS_PER_SAMPLE;
+    fmt->audioFormat = format->format;
+    fmt->numChannels = format->channels;
+    fmt->sampleRate = format->sample_rate;
+    fmt->byteRate = format->sample_rate * block_align;
+    fmt->blockAlign = block_align;
+    fmt->bitsPerSample = format->bits_per_sample;
 
     memcpy(data->subchunk2Id, "data", 4);
-    data->subchunk2Size = WAV_AUDIO_DEFAULT_DATA_SIZE;
-    ESP_LOGI(TAG, "wav_audio_init() Success!");
+    data->subchunk2Size = data_size;
     return ESP_OK;
 }
 
-esp_err_t wav_audio_default_header(char *buffer)
+static esp_err_t wav_audio_sink_write(const wav_audio_sink_t *sink, const void *data, size_t len)
 {
-    memcpy(buffer, default_header, WAV_AUDIO_HEADER_SIZE);
+    const uint8_t *ptr = (const uint8_t *)data;
+
+    while (len > 0)
+    {
+        int n = sink->write(sink->ctx, ptr, len);
+        if (n <= 0)
+            return ESP_FAIL;
+        ptr += n;
+        len -= n;
+    }
     return ESP_OK;
 }
 
-esp_err_t wav_audio_data_process(char *input, char *output)
+esp_err_t wav_audio_writer_open(wav_audio_writer_t *writer, const wav_audio_sink_t *sink,
+                                const wav_audio_format_t *format)
 {
-    int32_t *iptr = (int32_t *)(input);
-    int16_t *optr = (int16_t *)(output + WAV_AUDIO_HEADER_SIZE);
-    for (int i = 0; i < WAV_AUDIO_DEFAULT_SAMPLE; i++)
+    uint8_t header[WAV_AUDIO_HEADER_SIZE];
+
+    if ((writer == NULL) || (sink == NULL) || (sink->write == NULL))
+        return ESP_ERR_INVALID_ARG;
+
+    // 占位头使用流式大小: 即使没能 close, 文件也能按流式约定读出
+    esp_err_t err = wav_audio_build_header(format, WAV_AUDIO_STREAMING_SIZE, header);
+    if (err != ESP_OK)
+        return err;
+
+    writer->sink = *sink;
+    writer->format = *format;
+    writer->data_size = 0;
+    writer->open = false;
+    err = wav_audio_sink_write(sink, header, sizeof(header));
+    writer->open = (err == ESP_OK);
+    return err;
+}
+
+esp_err_t wav_audio_writer_write(wav_audio_writer_t *writer, const void *data, size_t len)
+{
+    if ((writer == NULL) || !writer->open)
+        return ESP_ERR_INVALID_STATE;
+    if (len > (size_t)(WAV_AUDIO_STREAMING_SIZE - 1 - WAV_AUDIO_CHUNK_SIZE - writer->data_size))
+        return ESP_ERR_INVALID_SIZE;    // RIFF 大小是 32 位的
+
+    esp_err_t err = wav_audio_sink_write(&writer->sink, data, len);
+    if (err == ESP_OK)
+        writer->data_size += len;
+    return err;
+}
+
+esp_err_t wav_audio_writer_close(wav_audio_writer_t *writer)
+{
+    static const uint8_t pad = 0;
+    esp_err_t err = ESP_OK;
+
+    if ((writer == NULL) || !writer->open)
+        return ESP_ERR_INVALID_STATE;
+    writer->open = false;
+
+    // 流式输出没有大小可言, 填充字节只会被读取端当成一个采样
+    if (writer->sink.seek == NULL)
+        return ESP_OK;
+
+    if (writer->data_size & 1)
+        err = wav_audio_sink_write(&writer->sink, &pad, 1);
+
+    if (err == ESP_OK)
     {
-        int32_t value = iptr[i] >> 12;
-        optr[i] = (value > INT16_MAX) ? INT16_MAX : (value < -INT16_MAX) ? -INT16_MAX : (int16_t)value;
+        uint32_t riff_size = wav_audio_riff_size(writer->data_size);
+        if ((writer->sink.seek(writer->sink.ctx, WAV_AUDIO_RIFF_SIZE_OFFSET) < 0) ||
+            (wav_audio_sink_write(&writer->sink, &riff_size, 4) != ESP_OK) ||
+            (writer->sink.seek(writer->sink.ctx, WAV_AUDIO_DATA_SIZE_OFFSET) < 0) ||
+            (wav_audio_sink_write(&writer->sink, &writer->data_size, 4) != ESP_OK))
+            err = ESP_FAIL;
+    }
+    return err;
+}
+
+static esp_err_t wav_audio_source_read(const wav_audio_source_t *source, void *data, size_t len)
+{
+    uint8_t *ptr = (uint8_t *)data;
+
+    while (len > 0)
+    {
+        int n = source->read(source->ctx, ptr, len);
+        if (n <= 0)
+            return ESP_FAIL;
+        ptr += n;
+        len -= n;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t wav_audio_source_skip(const wav_audio_source_t *source, uint32_t len)
+{
+    uint8_t discard[32];
+
+    while (len > 0)
+    {
+        uint32_t n = (len > sizeof(discard)) ? sizeof(discard) : len;
+        if (wav_audio_source_read(source, discard, n) != ESP_OK)
+            return ESP_FAIL;
+        len -= n;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t wav_audio_reader_parse_fmt(wav_audio_reader_t *reader, uint32_t chunk_size)
+{
+    uint8_t fmt[40];
+    uint32_t len = (chunk_size > sizeof(fmt)) ? sizeof(fmt) : chunk_size;
+
+    if ((chunk_size < 16) || (wav_audio_source_read(&reader->source, fmt, len) != ESP_OK))
+        return ESP_ERR_INVALID_RESPONSE;
+    if ((chunk_size > sizeof(fmt)) &&
+        (wav_audio_source_skip(&reader->source, chunk_size - sizeof(fmt)) != ESP_OK))
+        return ESP_ERR_INVALID_RESPONSE;
+
+    uint16_t format = (uint16_t)(fmt[0] | (fmt[1] << 8));
+    reader->format.channels = (uint16_t)(fmt[2] | (fmt[3] << 8));
+    reader->format.sample_rate = (uint32_t)fmt[4] | ((uint32_t)fmt[5] << 8) | ((uint32_t)fmt[6] << 16) | ((uint32_t)fmt[7] << 24);
+    reader->block_align = (uint16_t)(fmt[12] | (fmt[13] << 8));
+    reader->format.bits_per_sample = (uint16_t)(fmt[14] | (fmt[15] << 8));
+
+    // WAVE_FORMAT_EXTENSIBLE: cbSize(2) validBits(2) channelMask(4) 子格式 GUID(16), GUID 前两个字节是实际格式
+    if (format == WAV_AUDIO_FORMAT_EXTENSIBLE)
+    {
+        if (chunk_size < 40)
+            return ESP_ERR_INVALID_RESPONSE;
+        format = (uint16_t)(fmt[24] | (fmt[25] << 8));
+    }
+    reader->format.format = format;
+
+    if (!wav_audio_format_valid(&reader->format) || (reader->block_align != wav_audio_block_align(&reader->format)))
+    {
+        ESP_LOGW(TAG, "Unsupported WAV format %u, %u ch, %u bits.", format, reader->format.channels,
+                 reader->format.bits_per_sample);
+        return ESP_ERR_NOT_SUPPORTED;
     }
-    memcpy(output, default_header, WAV_AUDIO_HEADER_SIZE);
     return ESP_OK;
 }
+
+esp_err_t wav_audio_reader_open(wav_audio_reader_t *reader, const wav_audio_source_t *source)
+{
+    uint8_t chunk[12];
+    bool have_fmt = false;
+
+    if ((reader == NULL) || (source == NULL) || (source->read == NULL))
+        return ESP_ERR_INVALID_ARG;
+
+    memset(reader, 0, sizeof(*reader));
+    reader->source = *source;
+
+    if ((wav_audio_source_read(source, chunk, 12) != ESP_OK) ||
+        (memcmp(chunk, "RIFF", 4) != 0) || (memcmp(chunk + 8, "WAVE", 4) != 0))
+        return ESP_ERR_INVALID_RESPONSE;
+
+    while (1)
+    {
+        if (wav_audio_source_read(source, chunk, 8) != ESP_OK)
+            return ESP_ERR_INVALID_RESPONSE;
+        uint32_t chunk_size = (uint32_t)chunk[4] | ((uint32_t)chunk[5] << 8) |
+                              ((uint32_t)chunk[6] << 16) | ((uint32_t)chunk[7] << 24);
+
+        if (memcmp(chunk, "fmt ", 4) == 0)
+        {
+            esp_err_t err = wav_audio_reader_parse_fmt(reader, chunk_size);
+            if (err != ESP_OK)
+                return err;
+            if ((chunk_size & 1) && (wav_audio_source_skip(source, 1) != ESP_OK))
+                return ESP_ERR_INVALID_RESPONSE;
+            have_fmt = true;
+        }
+        else if (memcmp(chunk, "data", 4) == 0)
+        {
+            if (!have_fmt)
+                return ESP_ERR_INVALID_RESPONSE;
+            // 流式头: 读到数据源结束为止
+            reader->data_size = chunk_size;
+            reader->streaming = (chunk_size == WAV_AUDIO_STREAMING_SIZE);
+            reader->remaining = chunk_size;
+            return ESP_OK;
+        }
+        else if (wav_audio_source_skip(source, chunk_size + (chunk_size & 1)) != ESP_OK)
+        {
+            return ESP_ERR_INVALID_RESPONSE;
+        }
+    }
+}
+
+int wav_audio_reader_read(wav_audio_reader_t *reader, void *data, size_t len)
+{
+    size_t total = 0;
+
+    len -= len % reader->block_align;
+    if (!reader->streaming && (len > reader->remaining))
+        len = reader->remaining - reader->remaining % reader->block_align;
+
+    while (total < len)
+    {
+        int n = reader->source.read(reader->source.ctx, (uint8_t *)data + total, len - total);
+        if (n < 0)
+            return -1;
+        if (n == 0)
+            break;
+        total += n;
+    }
+
+    // 截断的文件: 丢掉末尾不完整的采样帧
+    total -= total % reader->block_align;
+    if (!reader->streaming)
+        reader->remaining -= total;
+    return (int)total;
+}
+
+static int wav_audio_mem_write(void *ctx, const void *data, size_t len)
+{
+    wav_audio_mem_t *mem = (wav_audio_mem_t *)ctx;
+
+    if (len > mem->size - mem->pos)
+        len = mem->size - mem->pos;
+    if (len == 0)
+        return -1;
+    memcpy(mem->buffer + mem->pos, data, len);
+    mem->pos += len;
+    if (mem->pos > mem->length)
+        mem->length = mem->pos;
+    return (int)len;
+}
+
+static int wav_audio_mem_seek(void *ctx, uint32_t offset)
+{
+    wav_audio_mem_t *mem = (wav_audio_mem_t *)ctx;
+
+    if (offset > mem->length)
+        return -1;
+    mem->pos = offset;
+    return 0;
+}
+
+static int wav_audio_mem_read(void *ctx, void *data, size_t len)
+{
+    wav_audio_mem_t *mem = (wav_audio_mem_t *)ctx;
+
+    if (len > mem->length - mem->pos)
+        len = mem->length - mem->pos;
+    memcpy(data, mem->buffer + mem->pos, len);
+    mem->pos += len;
+    return (int)len;
+}
+
+void wav_audio_mem_init(wav_audio_mem_t *mem, void *buffer, size_t size, size_t length)
+{
+    mem->buffer = (uint8_t *)buffer;
+    mem->size = size;
+    mem->pos = 0;
+    mem->length = length;
+}
+
+void wav_audio_mem_sink(wav_audio_mem_t *mem, wav_audio_sink_t *sink)
+{
+    sink->write = wav_audio_mem_write;
+    sink->seek = wav_audio_mem_seek;
+    sink->ctx = mem;
+}
+
+void wav_audio_mem_source(wav_audio_mem_t *mem, wav_audio_source_t *source)
+{
+    source->read = wav_audio_mem_read;
+    source->ctx = mem;
+}
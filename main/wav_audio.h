@@ -3,7 +3,9 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <string.h>
+#include "esp_err.h"
 
 #pragma pack(1)
 
@@ -35,19 +37,101 @@ typedef struct {
 
 #define WAV_AUDIO_HEADER_SIZE           44
 #define WAV_AUDIO_CHUNK_SIZE            36
+#define WAV_AUDIO_RIFF_SIZE_OFFSET      4
+#define WAV_AUDIO_DATA_SIZE_OFFSET      40
 #define WAV_AUDIO_SAMPLE_RATE 			16000
 #define WAV_AUDIO_DEFAULT_SAMPLE        32768
 #define WAV_AUDIO_DEFAULT_DATA_SIZE     65536
-#define WAV_AUDIO_DEFAULT_FILE_SIZE     65580
-#define WAV_AUDIO_DEFAULT_TRUNK_SIZE    65572
 #define WAV_AUDIO_NUM_OF_CHANNELS 		1
 #define WAV_PCM16_BITS_PER_SAMPLE       16
-#define WAV_PCM16_BYTE_PER_SMAPLE       2
-#define WAV_PCM16_BLOCK_ALIGN           2
-#define WAV_PCM16_BYTE_RATE             32000
+
+// fmt 块的 audioFormat
+#define WAV_AUDIO_FORMAT_PCM            1
+#define WAV_AUDIO_FORMAT_FLOAT          3
+#define WAV_AUDIO_FORMAT_EXTENSIBLE     0xFFFE  // 只在读取时识别, 实际格式取子格式 GUID 的前两个字节
+
+// 不可寻址的输出 (socket) 无法回写大小, RIFF/data 大小填 0xFFFFFFFF, 读取端读到流结束为止
+#define WAV_AUDIO_STREAMING_SIZE        0xFFFFFFFFu
+
+typedef struct {
+    uint16_t format;            // WAV_AUDIO_FORMAT_PCM / WAV_AUDIO_FORMAT_FLOAT
+    uint16_t channels;
+    uint32_t sample_rate;
+    uint16_t bits_per_sample;   // 8/16/24/32 (PCM), 32/64 (float)
+} wav_audio_format_t;
+
+/**
+ * 输出端: write 返回写入的字节数, 负值表示失败.
+ * seek 定位到绝对偏移, 为 NULL 表示不可寻址 (socket 等), 此时使用流式大小约定.
+ */
+typedef struct {
+    int (*write)(void *ctx, const void *data, size_t len);
+    int (*seek)(void *ctx, uint32_t offset);
+    void *ctx;
+} wav_audio_sink_t;
+
+// 输入端: read 返回读到的字节数, 0 表示结束, 负值表示失败
+typedef struct {
+    int (*read)(void *ctx, void *data, size_t len);
+    void *ctx;
+} wav_audio_source_t;
+
+typedef struct {
+    wav_audio_sink_t sink;
+    wav_audio_format_t format;
+    uint32_t data_size;
+    bool open;
+} wav_audio_writer_t;
+
+typedef struct {
+    wav_audio_source_t source;
+    wav_audio_format_t format;
+    uint16_t block_align;
+    uint32_t data_size;         // 头中声明的大小, 流式文件为 WAV_AUDIO_STREAMING_SIZE
+    uint32_t remaining;
+    bool streaming;
+} wav_audio_reader_t;
+
+// 内存缓冲区的 sink/source, 用于把 WAV 写进 (或从) 一块现成的缓冲区
+typedef struct {
+    uint8_t *buffer;
+    size_t size;
+    size_t pos;
+    size_t length;              // 已写入的最大偏移
+} wav_audio_mem_t;
 
 esp_err_t wav_audio_init(void);
 esp_err_t wav_audio_default_header(char *buffer);
+const char *wav_audio_get_default_header(void);     // 用作 iovec 段, 免去拷贝
 esp_err_t wav_audio_data_process(char *input, char *output);
 
-#endif // WAV_AUDIO_H
\ No newline at end of file
+/**
+ * @brief 生成 44 字节的标准头, data_size 为 WAV_AUDIO_STREAMING_SIZE 时生成流式头.
+ */
+esp_err_t wav_audio_build_header(const wav_audio_format_t *format, uint32_t data_size, void *header);
+
+/**
+ * @brief 增量写入: open 写出占位头, write 追加任意长度的数据. 可寻址时 close 补齐奇数长度的
+ * 填充字节并回写 RIFF/data 大小, 否则保留流式大小.
+ */
+esp_err_t wav_audio_writer_open(wav_audio_writer_t *writer, const wav_audio_sink_t *sink,
+                                const wav_audio_format_t *format);
+esp_err_t wav_audio_writer_write(wav_audio_writer_t *writer, const void *data, size_t len);
+esp_err_t wav_audio_writer_close(wav_audio_writer_t *writer);
+
+/**
+ * @brief 解析头部, 跳过 LIST 等其它块, 停在 data 块的起点.
+ * @return ESP_ERR_INVALID_RESPONSE 表示不是 WAV, ESP_ERR_NOT_SUPPORTED 表示不支持的编码.
+ */
+esp_err_t wav_audio_reader_open(wav_audio_reader_t *reader, const wav_audio_source_t *source);
+
+/**
+ * @brief 读取 PCM 数据, 只返回完整的采样帧 (len 向下取整到 block_align). 0 表示数据结束.
+ */
+int wav_audio_reader_read(wav_audio_reader_t *reader, void *data, size_t len);
+
+void wav_audio_mem_init(wav_audio_mem_t *mem, void *buffer, size_t size, size_t length);
+void wav_audio_mem_sink(wav_audio_mem_t *mem, wav_audio_sink_t *sink);
+void wav_audio_mem_source(wav_audio_mem_t *mem, wav_audio_source_t *source);
+
+#endif // WAV_AUDIO_H
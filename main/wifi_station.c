@@ -15,8 +15,10 @@
 #include "esp_event.h"
 #include "esp_log.h"
 #include "nvs_flash.h"
+#ifndef CONFIG_IDF_TARGET_LINUX
 #include "lwip/err.h"
 #include "lwip/sys.h"
+#endif
 #include "wifi_station.h"
 
 #define EXAMPLE_ESP_WIFI_SSID      CONFIG_ESP_WIFI_SSID
@@ -0,0 +1,109 @@
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import tempfile
+
+from sim_bench import DEFAULT_ELF, start_receiver
+
+# 按键到动作的延迟: 主机模拟固件在长动作 (按键录音, 约 2 s) 执行期间接收其它按键,
+# 从设备跟踪日志中取每个动作开始时相对第一个边沿的延迟.
+# 用法: python button_latency.py [--elf build/xxx.elf] [--keep]
+# 需要 CONFIG_AUDIO_TRACE 且不是 CONFIG_AUDIO_TRACE_BINARY (否则先用 trace_decode.py 展开日志).
+
+# (时间 ms, 按键, 按住 ms): 0 = 录音, 1 = RAW32 流开关 (长按: 切换采集配置), 2 = PCM16/ADPCM 流开关 (长按: VAD 门限开关)
+# 模拟按键脚本是顺序执行的, 按住期间后面的事件会顺延
+SCRIPT = [
+    (1000, 0, 80),      # 开始录音
+    (1300, 0, 80),      # 录音期间再按: 取消并重新录音
+    (1500, 2, 900),     # 第二次录音期间长按另一个按键
+    (4500, 1, 80),      # 录音结束后开流
+    (5500, 1, 80),      # 关流
+]
+QUIT_MS = 7000
+
+DETECT_PATTERN = re.compile(r'Button (\d+) event (\d+) detected (\d+) ms after the first edge')
+START_PATTERN = re.compile(r'Button (\d+) event (\d+) action started (\d+) us after the first edge')
+DONE_PATTERN = re.compile(r'Button (\d+) event (\d+) action finished in (\d+) ms')
+EVENT_NAMES = ['press', 'long press', 'double click']
+
+
+def run(args):
+    workdir = tempfile.mkdtemp(prefix='button_latency_')
+    buttons = os.path.join(workdir, 'buttons.txt')
+    with open(buttons, 'w') as f:
+        for at_ms, button, hold_ms in SCRIPT:
+            f.write(f'{at_ms} {button} {hold_ms}\n')
+        f.write(f'{QUIT_MS} quit\n')
+
+    env = dict(os.environ, SIM_SPEED='1', SIM_BUTTONS=buttons)
+    receiver = start_receiver(workdir, args.port)
+    try:
+        with open(os.path.join(workdir, 'device.log'), 'w') as log:
+            subprocess.run([os.path.abspath(args.elf)], cwd=workdir, env=env, stdout=log, stderr=subprocess.STDOUT,
+                           timeout=QUIT_MS / 1000 + 30, check=True)
+    finally:
+        receiver.terminate()
+        receiver.communicate()
+
+    with open(os.path.join(workdir, 'device.log'), errors='replace') as log:
+        device_log = log.read()
+    # 同一按键的动作是串行的: 动作开始对应该按键最近一次检测到的事件, 结束对应最近一次开始
+    actions = []
+    detected = {}
+    running = {}
+    for line in device_log.splitlines():
+        match = DETECT_PATTERN.search(line)
+        if match:
+            detected[match[1]] = int(match[3])
+            continue
+        match = START_PATTERN.search(line)
+        if match:
+            action = {'button': int(match[1]), 'event': int(match[2]), 'latency_ms': int(match[3]) / 1000,
+                      'detect_ms': detected.get(match[1], 0), 'duration_ms': None}
+            running[match[1]] = action
+            actions.append(action)
+            continue
+        match = DONE_PATTERN.search(line)
+        if match and match[1] in running:
+            running.pop(match[1])['duration_ms'] = int(match[3])
+    if not actions:
+        raise RuntimeError(f'no button actions traced, see {workdir}/device.log')
+
+    # 手势本身的等待 (消抖, 长按时间, 双击窗口) 与执行器的排队延迟分开统计
+    dispatch = []
+    for action in actions:
+        dispatch.append(action['latency_ms'] - action['detect_ms'])
+        duration = 'unfinished' if action['duration_ms'] is None else f"{action['duration_ms']} ms"
+        print(f"button {action['button']} {EVENT_NAMES[action['event']]:<12} started {action['latency_ms']:7.1f} ms "
+              f"after the edge (gesture {action['detect_ms']} ms, dispatch {dispatch[-1]:6.1f} ms), ran {duration}")
+
+    result = {
+        'presses': len(SCRIPT),
+        'actions': len(actions),
+        'cancelled': device_log.count('cancels the running action'),
+        'dropped': device_log.count('dropped, the same action is still running'),
+        'press_latency_max_ms': max(a['latency_ms'] for a in actions if a['event'] == 0),
+        'dispatch_max_ms': round(max(dispatch), 1),
+    }
+    print('RESULT ' + json.dumps(result))
+
+    if args.keep:
+        print(f'logs kept in {workdir}')
+    else:
+        shutil.rmtree(workdir, ignore_errors=True)
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Press-to-action latency while a long button action is running')
+    parser.add_argument('--elf', default=DEFAULT_ELF, help='host build of the firmware')
+    parser.add_argument('--port', type=int, default=8888)
+    parser.add_argument('--keep', action='store_true', help='keep the device log')
+    run(parser.parse_args())
+
+
+if __name__ == "__main__":
+    main()
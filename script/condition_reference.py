@@ -0,0 +1,159 @@
+import math
+import os
+import struct
+import sys
+
+# --- 信号调理参考输出: 给 test/host 的 audio_convert_condition_int32_to_int16 对拍用 ---
+# 按 main/audio_convert.h 描述的整数算法逐样本建模 (DC 高通, 块内线性过渡的增益, 软限幅),
+# 用 Python 的任意精度整数, 在与 C 不同的地方 (截断除法, float32 的 powf) 显式模拟,
+# 所以输出与固件逐样本相同. 改动调理算法时先改这里, 重新生成头文件, 再改 C.
+# 输入是只用整数运算生成的合成信号 (C 端 test_audio_convert.c 用同样的算法重建), 每块一种场景:
+# 静音 (增益保持), 小声 (增益慢慢升), 接近满幅 (软限幅兜底, 增益按 attack 下降), 中等, 削顶的过载.
+OUTPUT_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '../test/host/main/condition_golden.h')
+SAMPLE_RATE = 16000
+BLOCK = 1024                                    # I2S_AUDIO_BUFFER_SAMPLES
+LEVELS = [0, 2100, 2100, 188000, 188000, 20000, 20000, 300000]   # 每块三角波的斜率, 24bit 域
+PERIOD = 40                                     # 400Hz
+BIAS = 30000                                    # 麦克风的直流偏置, 24bit 域
+NOISE_SHIFT = 6
+SEED = 2024
+
+# main/audio_convert.h
+DC_SHIFT = 10
+GAIN_ONE = 1 << 16
+MIN_GAIN = 1 << 10
+TARGET_DBFS = -9
+MAX_GAIN_DB = 24
+ATTACK_MS = 10
+RELEASE_MS = 1500
+NOISE_FLOOR = 128
+LIMIT_KNEE = 24576
+INT16_MAX = 32767
+INT24_MAX = (1 << 23) - 1
+
+
+def f32(value):
+    return struct.unpack('<f', struct.pack('<f', value))[0]
+
+
+def c_div(a, b):
+    """C 的整数除法向零截断"""
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b > 0) else -q
+
+
+def synth_signal():
+    """三角波 + 低幅噪声 + 直流偏置, 左对齐在 32bit 槽里 (与 I2S 读到的一样)"""
+    seed = SEED
+    samples = []
+    for n in range(BLOCK * len(LEVELS)):
+        seed = (seed * 1664525 + 1013904223) & 0xFFFFFFFF
+        noise = (seed >> 16) - 32768
+        phase = n % PERIOD
+        tri = 4 * phase - PERIOD if phase < PERIOD // 2 else 3 * PERIOD - 4 * phase
+        value = BIAS + tri * LEVELS[n // BLOCK] + (noise >> NOISE_SHIFT)
+        value = max(-INT24_MAX, min(INT24_MAX, value))
+        samples.append(value << 8)
+    return samples
+
+
+class Conditioner:
+    def __init__(self):
+        # audio_condition_default_config + audio_condition_set_levels: powf 和乘法都是 float32
+        self.target_peak = int(f32(INT16_MAX * f32(10.0 ** f32(TARGET_DBFS / 20.0))))
+        self.max_gain = int(f32(GAIN_ONE * f32(10.0 ** f32(MAX_GAIN_DB / 20.0))))
+        self.attack = SAMPLE_RATE // 1000 * ATTACK_MS
+        self.release = SAMPLE_RATE // 1000 * RELEASE_MS
+        self.dc = 0
+        self.gain = GAIN_ONE
+        self.gain_next = GAIN_ONE
+        self.primed = False
+
+    @staticmethod
+    def soft_limit(value):
+        magnitude = abs(value)
+        if magnitude <= LIMIT_KNEE:
+            return value
+        room = INT16_MAX - LIMIT_KNEE
+        over = min(magnitude - LIMIT_KNEE, 1 << 17)
+        magnitude = LIMIT_KNEE + over * room // (over + room)
+        return -magnitude if value < 0 else magnitude
+
+    def update_gain(self, peak, samples):
+        target = self.gain
+        if (peak >> 4) >= NOISE_FLOOR:
+            wanted = (self.target_peak << 20) // peak
+            target = max(MIN_GAIN, min(self.max_gain, wanted))
+        tau = self.attack if target < self.gain else self.release
+        coef = (samples << 16) // (samples + tau)
+        self.gain_next = self.gain + (((target - self.gain) * coef) >> 16)
+
+    def process(self, block):
+        dc = self.dc
+        gain = self.gain
+        step = c_div(self.gain_next - gain, len(block))
+        peak = 0
+        if not self.primed:
+            dc = (block[0] >> 8) << 6
+            self.primed = True
+
+        output = []
+        for sample in block:
+            x = sample >> 8
+            y = x - (dc >> 6)
+            dc += ((x << 6) - dc) >> DC_SHIFT
+            peak = max(peak, abs(y))
+            gain += step
+            output.append(self.soft_limit((y * gain) >> 20))
+
+        self.dc = dc
+        self.gain = self.gain_next
+        self.update_gain(peak, len(block))
+        return output
+
+
+def main():
+    args = [a for a in sys.argv[1:] if not a.startswith('--')]
+    samples = synth_signal()
+    cond = Conditioner()
+    output = []
+    gains = []
+    for b in range(len(LEVELS)):
+        output += cond.process(samples[b * BLOCK:(b + 1) * BLOCK])
+        gains.append(cond.gain_next)
+
+    out = []
+    out.append('// 由 script/condition_reference.py 生成, 请勿手工修改')
+    out.append('#ifndef CONDITION_GOLDEN_H')
+    out.append('#define CONDITION_GOLDEN_H')
+    out.append('')
+    out.append(f'#define CONDITION_GOLDEN_RATE          {SAMPLE_RATE}')
+    out.append(f'#define CONDITION_GOLDEN_BLOCK         {BLOCK}')
+    out.append(f'#define CONDITION_GOLDEN_BLOCKS        {len(LEVELS)}')
+    out.append(f'#define CONDITION_GOLDEN_SAMPLES       {len(output)}')
+    out.append(f'#define CONDITION_GOLDEN_PERIOD        {PERIOD}')
+    out.append(f'#define CONDITION_GOLDEN_BIAS          {BIAS}')
+    out.append(f'#define CONDITION_GOLDEN_NOISE_SHIFT   {NOISE_SHIFT}')
+    out.append(f'#define CONDITION_GOLDEN_SEED          {SEED}u')
+    out.append('')
+    out.append(f'static const int32_t condition_golden_levels[{len(LEVELS)}] = {{ {", ".join(map(str, LEVELS))} }};')
+    out.append('')
+    out.append('// 每块处理后的 gain_next (Q16)')
+    out.append(f'static const int32_t condition_golden_gain[{len(gains)}] = {{ {", ".join(map(str, gains))} }};')
+    out.append('')
+    out.append(f'static const int16_t condition_golden[{len(output)}] = {{')
+    for i in range(0, len(output), 16):
+        out.append('    ' + ', '.join(str(v) for v in output[i:i + 16]) + ',')
+    out.append('};')
+    out.append('')
+    out.append('#endif // CONDITION_GOLDEN_H')
+
+    path = args[0] if args else OUTPUT_FILE
+    with open(path, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+    peak_db = 20.0 * math.log10(max(abs(v) for v in output) / INT16_MAX)
+    print(f"已生成 {path}: {len(LEVELS)} 块 x {BLOCK}, 输出峰值 {peak_db:.2f} dBFS, 增益 {gains}")
+
+
+if __name__ == '__main__':
+    main()
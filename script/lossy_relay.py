@@ -0,0 +1,94 @@
+import argparse
+import heapq
+import random
+import socket
+import threading
+import time
+
+# 放在设备和接收端之间, 模拟有损 Wi-Fi, 用来比较 TCP / UDP 两种传输的时延和音频缺口.
+# 用法: python lossy_relay.py --loss 0.05 --jitter 30 --target-port 8889
+#       python tcp_receiver.py 8889  (或 python udp_receiver.py 8889)
+# UDP: 每个数据报按概率丢弃, 并加上随机时延 (会产生乱序).
+# TCP: 没法真正丢包, 按同样的概率把后续数据整体推迟一个重传超时, 模拟队头阻塞.
+
+LISTEN_PORT = 8888
+BUFFER_SIZE = 4096
+
+def relay_udp(args):
+    inbound = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    inbound.bind(("0.0.0.0", LISTEN_PORT))
+    outbound = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    target = (args.target_host, args.target_port)
+    pending = []
+    lock = threading.Condition()
+    stats = {"forwarded": 0, "dropped": 0}
+
+    def sender():
+        while True:
+            with lock:
+                while not pending or pending[0][0] > time.monotonic():
+                    lock.wait(0.001 if pending else None)
+                _, _, datagram = heapq.heappop(pending)
+            outbound.sendto(datagram, target)
+
+    threading.Thread(target=sender, daemon=True).start()
+    count = 0
+    while True:
+        datagram, _ = inbound.recvfrom(2048)
+        count += 1
+        if random.random() < args.loss:
+            stats["dropped"] += 1
+            continue
+        stats["forwarded"] += 1
+        due = time.monotonic() + (args.delay + random.uniform(0, args.jitter)) / 1000.0
+        with lock:
+            heapq.heappush(pending, (due, count, datagram))
+            lock.notify()
+        if count % 500 == 0:
+            print(f"udp: forwarded {stats['forwarded']}, dropped {stats['dropped']}")
+
+def relay_tcp_connection(conn, args):
+    outbound = socket.create_connection((args.target_host, args.target_port))
+    stalls = 0
+    with conn, outbound:
+        while True:
+            chunk = conn.recv(BUFFER_SIZE)
+            if not chunk:
+                break
+            # 按 MTU 估算这块数据包含的报文段数, 每段都可能 "丢失" 并触发一次重传等待
+            segments = max(1, len(chunk) // 1460)
+            if any(random.random() < args.loss for _ in range(segments)):
+                stalls += 1
+                time.sleep(args.rto / 1000.0)
+            time.sleep((args.delay + random.uniform(0, args.jitter)) / 1000.0)
+            outbound.sendall(chunk)
+    print(f"tcp: connection closed after {stalls} retransmission stalls")
+
+def relay_tcp(args):
+    with socket.socket(socket.AF_INET, socket.SOCK_STREAM) as server:
+        server.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        server.bind(("0.0.0.0", LISTEN_PORT))
+        server.listen(5)
+        while True:
+            conn, _ = server.accept()
+            threading.Thread(target=relay_tcp_connection, args=(conn, args), daemon=True).start()
+
+def main():
+    parser = argparse.ArgumentParser(description="Lossy relay for comparing TCP and UDP audio transports")
+    parser.add_argument("--loss", type=float, default=0.05, help="packet loss probability")
+    parser.add_argument("--delay", type=float, default=5.0, help="base one-way delay (ms)")
+    parser.add_argument("--jitter", type=float, default=20.0, help="extra random delay (ms)")
+    parser.add_argument("--rto", type=float, default=200.0, help="TCP retransmission stall (ms)")
+    parser.add_argument("--target-host", default="127.0.0.1")
+    parser.add_argument("--target-port", type=int, default=8889)
+    parser.add_argument("--seed", type=int, help="random seed, for repeatable runs")
+    args = parser.parse_args()
+    random.seed(args.seed)
+
+    print(f"Relaying port {LISTEN_PORT} -> {args.target_host}:{args.target_port} "
+          f"(loss {args.loss:.0%}, delay {args.delay} ms + {args.jitter} ms jitter)")
+    threading.Thread(target=relay_udp, args=(args,), daemon=True).start()
+    relay_tcp(args)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,180 @@
+import math
+import os
+import sys
+
+import mfcc_tables as tables
+
+# --- MFCC 参考向量: 给 test/host 的 mfcc_feature 对拍用 ---
+# 输入是只用整数运算生成的合成信号 (C 端 test_mfcc_feature.c 用同样的算法重建, 逐样本相同).
+# 生成两组参考输出:
+#   mfcc_golden        训练管线的输出. 装有 librosa 时直接调用 mfcc_process.extract_mfcc;
+#                      没有时用 numpy/scipy 按 librosa 0.10 feature.mfcc 的默认路径逐步计算
+#                      (stft center=True 零填充 + 周期汉宁窗 + complex64, filters.mel slaney float32,
+#                      power_to_db top_db=80, scipy.fftpack.dct ortho), 不使用 mfcc_tables.py.
+#                      头文件开头记录用的是哪一种.
+#   mfcc_golden_tables 用 mfcc_tables.py 的窗/滤波器组/DCT 和 float64 DFT 计算, 只检查 C 与表的一致性.
+OUTPUT_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '../test/host/main/mfcc_golden.h')
+TARGET_SAMPLES = 19200
+FRAMES = 1 + TARGET_SAMPLES // tables.HOP_LENGTH    # 121
+SEGMENT = 1600                                      # 0.1s 一段, 每段换一种谱形状
+AMIN = 1e-10
+TOP_DB = 80.0
+
+def synth_signal():
+    """低通噪声 + 方波, 每段的截止频率, 基频和电平都不同, 每三段有一段接近静音"""
+    seed = 12345
+    lowpass = 0
+    samples = []
+    for n in range(TARGET_SAMPLES):
+        segment = n // SEGMENT
+        seed = (seed * 1664525 + 1013904223) & 0xFFFFFFFF
+        noise = (seed >> 16) - 32768
+        lowpass += (noise - lowpass) >> (1 + segment % 4)
+        period = 20 + 7 * segment
+        square = 3000 if (n % period) < (period >> 1) else -3000
+        value = (lowpass >> 2) + square
+        if segment % 3 == 2:
+            value >>= 6
+        samples.append(max(-32768, min(32767, value)))
+    return samples
+
+def reference_mfcc(samples):
+    audio = [s / 32768.0 for s in samples]
+    pad = tables.N_FFT // 2
+    padded = [0.0] * pad + audio + [0.0] * pad
+    window = tables.hann_window()
+    filters = tables.mel_filterbank()
+    dct = tables.dct_matrix()
+    cos_table = [math.cos(2.0 * math.pi * i / tables.N_FFT) for i in range(tables.N_FFT)]
+    sin_table = [math.sin(2.0 * math.pi * i / tables.N_FFT) for i in range(tables.N_FFT)]
+
+    log_mel = []
+    for t in range(FRAMES):
+        frame = [padded[t * tables.HOP_LENGTH + n] * window[n] for n in range(tables.N_FFT)]
+        power = []
+        for k in range(tables.N_BINS):
+            re = im = 0.0
+            index = 0
+            for x in frame:
+                re += x * cos_table[index]
+                im -= x * sin_table[index]
+                index += k
+                if index >= tables.N_FFT:
+                    index -= tables.N_FFT
+            power.append(re * re + im * im)
+        mel = []
+        for start, weights in filters:
+            energy = sum(w * power[start + j] for j, w in enumerate(weights))
+            mel.append(10.0 * math.log10(max(AMIN, energy)))
+        log_mel.append(mel)
+
+    floor_db = max(max(row) for row in log_mel) - TOP_DB
+    mfcc = [[sum(c * max(v, floor_db) for c, v in zip(row, mel)) for row in dct] for mel in log_mel]
+    for k in range(tables.N_MFCC):
+        column = [mfcc[t][k] for t in range(FRAMES)]
+        mean = sum(column) / FRAMES
+        std = math.sqrt(sum((v - mean) ** 2 for v in column) / FRAMES)
+        for t in range(FRAMES):
+            mfcc[t][k] = (mfcc[t][k] - mean) / std
+    return mfcc
+
+def librosa_mfcc(samples):
+    import numpy as np
+    import mfcc_process
+    audio = np.array(samples, dtype=np.int16).astype(np.float32) / 32768.0
+    return mfcc_process.extract_mfcc(audio).tolist()
+
+def librosa_path_mfcc(samples):
+    """mfcc_process.extract_mfcc 在 librosa 0.10 下的计算, 数据类型与 librosa 相同"""
+    import numpy as np
+    import scipy.fftpack
+    import scipy.signal
+
+    sr, n_fft, hop, n_mels, n_mfcc = 16000, 400, 160, 128, 40
+    y = np.array(samples, dtype=np.int16).astype(np.float32) / 32768.0
+
+    # librosa.stft: center=True, pad_mode='constant', 周期汉宁窗, 输出 complex64
+    window = scipy.signal.get_window('hann', n_fft, fftbins=True).reshape(-1, 1)
+    y = np.pad(y, n_fft // 2, mode='constant')
+    frames = np.lib.stride_tricks.sliding_window_view(y, n_fft)[::hop].T
+    stft = np.fft.rfft(window * frames, axis=0).astype(np.complex64)
+    power = np.abs(stft) ** 2
+
+    # librosa.filters.mel(htk=False, norm='slaney'), float32
+    f_sp, min_log_hz = 200.0 / 3, 1000.0
+    min_log_mel, logstep = min_log_hz / f_sp, np.log(6.4) / 27.0
+    def hz_to_mel(f):
+        f = np.asanyarray(f, dtype=np.float64)
+        return np.where(f >= min_log_hz, min_log_mel + np.log(np.maximum(f, min_log_hz) / min_log_hz) / logstep, f / f_sp)
+    def mel_to_hz(m):
+        return np.where(m >= min_log_mel, min_log_hz * np.exp(logstep * (m - min_log_mel)), f_sp * m)
+    fftfreqs = np.fft.rfftfreq(n=n_fft, d=1.0 / sr)
+    mel_f = mel_to_hz(np.linspace(hz_to_mel(0.0), hz_to_mel(sr / 2.0), n_mels + 2))
+    fdiff = np.diff(mel_f)
+    ramps = np.subtract.outer(mel_f, fftfreqs)
+    weights = np.zeros((n_mels, 1 + n_fft // 2), dtype=np.float32)
+    for i in range(n_mels):
+        lower = -ramps[i] / fdiff[i]
+        upper = ramps[i + 2] / fdiff[i + 1]
+        weights[i] = np.maximum(0, np.minimum(lower, upper))
+    weights *= (2.0 / (mel_f[2:n_mels + 2] - mel_f[:n_mels]))[:, np.newaxis]
+
+    # librosa.power_to_db(ref=1.0, amin=1e-10, top_db=80)
+    mel = np.einsum('...ft,mf->...mt', power, weights, optimize=True)
+    log_spec = 10.0 * np.log10(np.maximum(AMIN, mel))
+    log_spec = np.maximum(log_spec, log_spec.max() - TOP_DB)
+    mfccs = scipy.fftpack.dct(log_spec, axis=-2, type=2, norm='ortho')[:n_mfcc, :]
+
+    # mfcc_process.extract_mfcc 的标准化
+    mfccs = (mfccs - np.mean(mfccs, axis=1, keepdims=True)) / np.std(mfccs, axis=1, keepdims=True)
+    return mfccs.T.tolist()
+
+def format_matrix(name, mfcc):
+    out = [f'static const float {name}[{FRAMES}][{tables.N_MFCC}] = {{']
+    for row in mfcc:
+        out.append('  {')
+        for i in range(0, len(row), 10):
+            out.append('    ' + ', '.join(f'{v:.5f}f' for v in row[i:i + 10]) + ',')
+        out.append('  },')
+    out.append('};')
+    return out
+
+def main():
+    args = [a for a in sys.argv[1:] if not a.startswith('--')]
+    samples = synth_signal()
+    try:
+        import librosa
+        mfcc = librosa_mfcc(samples)
+        source = f'mfcc_process.extract_mfcc (librosa {librosa.__version__})'
+    except ImportError:
+        import numpy
+        import scipy
+        mfcc = librosa_path_mfcc(samples)
+        source = f'librosa 0.10 feature.mfcc 路径的 numpy {numpy.__version__} / scipy {scipy.__version__} 实现'
+    tables_mfcc = reference_mfcc(samples)
+
+    out = []
+    out.append('// 由 script/mfcc_reference.py 生成, 请勿手工修改')
+    out.append(f'// mfcc_golden: {source}')
+    out.append('// mfcc_golden_tables: mfcc_tables.py + float64 DFT')
+    out.append('#ifndef MFCC_GOLDEN_H')
+    out.append('#define MFCC_GOLDEN_H')
+    out.append('')
+    out.append(f'#define MFCC_GOLDEN_SAMPLES    {TARGET_SAMPLES}')
+    out.append(f'#define MFCC_GOLDEN_SEGMENT    {SEGMENT}')
+    out.append(f'#define MFCC_GOLDEN_FRAMES     {FRAMES}')
+    out.append('')
+    out += format_matrix('mfcc_golden', mfcc)
+    out.append('')
+    out += format_matrix('mfcc_golden_tables', tables_mfcc)
+    out.append('')
+    out.append('#endif // MFCC_GOLDEN_H')
+
+    path = args[0] if args else OUTPUT_FILE
+    with open(path, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+    worst = max(abs(a - b) for ra, rb in zip(mfcc, tables_mfcc) for a, b in zip(ra, rb))
+    print(f"已生成 {path}: {FRAMES}x{tables.N_MFCC}, 参考: {source}, 与表模型的最大差 {worst:.6f}")
+
+if __name__ == '__main__':
+    main()
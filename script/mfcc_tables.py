@@ -0,0 +1,138 @@
+import math
+import os
+import sys
+
+# --- MFCC 参数 (必须与 mfcc_process.py / librosa 默认值保持一致) ---
+SAMPLING_RATE = 16000
+N_MFCC = 40
+N_FFT = int(SAMPLING_RATE * 0.025)      # 400
+HOP_LENGTH = int(SAMPLING_RATE * 0.010) # 160
+N_MELS = 128                            # librosa.feature.melspectrogram 默认值
+N_BINS = N_FFT // 2 + 1
+
+OUTPUT_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '../main/mfcc_tables.h')
+
+# --- Slaney 风格的 mel 刻度 (librosa htk=False) ---
+F_SP = 200.0 / 3
+MIN_LOG_HZ = 1000.0
+MIN_LOG_MEL = MIN_LOG_HZ / F_SP
+LOGSTEP = math.log(6.4) / 27.0
+
+def hz_to_mel(f):
+    if f >= MIN_LOG_HZ:
+        return MIN_LOG_MEL + math.log(f / MIN_LOG_HZ) / LOGSTEP
+    return f / F_SP
+
+def mel_to_hz(m):
+    if m >= MIN_LOG_MEL:
+        return MIN_LOG_HZ * math.exp(LOGSTEP * (m - MIN_LOG_MEL))
+    return F_SP * m
+
+def hann_window():
+    """librosa 使用周期 (fftbins=True) 汉宁窗"""
+    return [0.5 - 0.5 * math.cos(2.0 * math.pi * n / N_FFT) for n in range(N_FFT)]
+
+def mel_filterbank():
+    """等价于 librosa.filters.mel(sr, n_fft, n_mels, norm='slaney'), 返回稀疏形式"""
+    fftfreqs = [i * (SAMPLING_RATE / 2.0) / (N_BINS - 1) for i in range(N_BINS)]
+    min_mel = hz_to_mel(0.0)
+    max_mel = hz_to_mel(SAMPLING_RATE / 2.0)
+    mel_f = [mel_to_hz(min_mel + i * (max_mel - min_mel) / (N_MELS + 1)) for i in range(N_MELS + 2)]
+    fdiff = [mel_f[i + 1] - mel_f[i] for i in range(N_MELS + 1)]
+
+    filters = []
+    for i in range(N_MELS):
+        enorm = 2.0 / (mel_f[i + 2] - mel_f[i])
+        weights = []
+        for k in range(N_BINS):
+            lower = -(mel_f[i] - fftfreqs[k]) / fdiff[i]
+            upper = (mel_f[i + 2] - fftfreqs[k]) / fdiff[i + 1]
+            weights.append(max(0.0, min(lower, upper)) * enorm)
+        nonzero = [k for k in range(N_BINS) if weights[k] > 0.0]
+        if nonzero:
+            start = nonzero[0]
+            filters.append((start, weights[start:nonzero[-1] + 1]))
+        else:
+            filters.append((0, []))
+    return filters
+
+def dct_matrix():
+    """scipy.fft.dct(type=2, norm='ortho') 的前 N_MFCC 行"""
+    rows = []
+    for k in range(N_MFCC):
+        scale = math.sqrt(1.0 / N_MELS) if k == 0 else math.sqrt(2.0 / N_MELS)
+        rows.append([scale * math.cos(math.pi * k * (2 * n + 1) / (2.0 * N_MELS)) for n in range(N_MELS)])
+    return rows
+
+def twiddles():
+    return [(math.cos(-2.0 * math.pi * i / N_FFT), math.sin(-2.0 * math.pi * i / N_FFT)) for i in range(N_FFT)]
+
+def fmt(values, per_line=8):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(f'{v:.9e}f' for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+def main():
+    filters = mel_filterbank()
+    offsets = []
+    flat = []
+    for start, weights in filters:
+        offsets.append(len(flat))
+        flat.extend(weights)
+
+    out = []
+    out.append('// 由 script/mfcc_tables.py 生成, 请勿手工修改')
+    out.append('#ifndef MFCC_TABLES_H')
+    out.append('#define MFCC_TABLES_H')
+    out.append('')
+    out.append('#include <stdint.h>')
+    out.append('')
+    out.append(f'#define MFCC_TABLE_N_FFT       {N_FFT}')
+    out.append(f'#define MFCC_TABLE_N_BINS      {N_BINS}')
+    out.append(f'#define MFCC_TABLE_N_MELS      {N_MELS}')
+    out.append(f'#define MFCC_TABLE_N_MFCC      {N_MFCC}')
+    out.append(f'#define MFCC_TABLE_MEL_WEIGHTS {len(flat)}')
+    out.append('')
+    out.append(f'static const float mfcc_window[{N_FFT}] = {{')
+    out.append(fmt(hann_window()))
+    out.append('};')
+    out.append('')
+    tw = twiddles()
+    out.append(f'static const float mfcc_twiddle[{N_FFT}][2] = {{')
+    for i in range(0, N_FFT, 4):
+        out.append('    ' + ' '.join(f'{{{c:.9e}f, {s:.9e}f}},' for c, s in tw[i:i + 4]))
+    out.append('};')
+    out.append('')
+    out.append(f'static const uint16_t mfcc_mel_start[{N_MELS}] = {{')
+    out.append('    ' + ', '.join(str(s) for s, _ in filters))
+    out.append('};')
+    out.append('')
+    out.append(f'static const uint16_t mfcc_mel_length[{N_MELS}] = {{')
+    out.append('    ' + ', '.join(str(len(w)) for _, w in filters))
+    out.append('};')
+    out.append('')
+    out.append(f'static const uint16_t mfcc_mel_offset[{N_MELS}] = {{')
+    out.append('    ' + ', '.join(str(o) for o in offsets))
+    out.append('};')
+    out.append('')
+    out.append(f'static const float mfcc_mel_weights[{len(flat)}] = {{')
+    out.append(fmt(flat))
+    out.append('};')
+    out.append('')
+    out.append(f'static const float mfcc_dct[{N_MFCC}][{N_MELS}] = {{')
+    for row in dct_matrix():
+        out.append('  {')
+        out.append(fmt(row))
+        out.append('  },')
+    out.append('};')
+    out.append('')
+    out.append('#endif // MFCC_TABLES_H')
+
+    path = sys.argv[1] if len(sys.argv) > 1 else OUTPUT_FILE
+    with open(path, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+    print(f"已生成 {path}: mel 权重 {len(flat)} 个, DCT {N_MFCC}x{N_MELS}")
+
+if __name__ == '__main__':
+    main()
@@ -2,8 +2,13 @@ import asyncio
 import socket
 import os
 import time
+import math
+import struct
 from dotenv import load_dotenv
 
+from stream_frame import (FrameParser, AdpcmDecoder, parse_session, build_frame, build_session,
+                          FRAME_SESSION, FRAME_AUDIO, FRAME_END, CODEC_ADPCM, CODEC_PCM16)
+
 # --- 导入和配置（SDK 模拟类，保持修正后的结构） ---
 
 class MockStreamSession:
@@ -54,8 +59,35 @@ AUDIO_CONFIG = {
     "output_sample_rate_hertz": 24000
 }
 
+TTS_CHUNK_MS = 20       # 下行每帧时长, 按实时节奏发送
+
 # --- 转发和接收逻辑 ---
 
+def synthesize_tts(duration_s=1.0, freq=440.0):
+    """模拟 TTS: 生成一段 24kHz PCM16 正弦音"""
+    rate = AUDIO_CONFIG["output_sample_rate_hertz"]
+    samples = [int(8000 * math.sin(2 * math.pi * freq * n / rate)) for n in range(int(rate * duration_s))]
+    return struct.pack(f'<{len(samples)}h', *samples)
+
+tts_session_id = 0
+
+async def send_tts_audio(loop, tcp_socket, audio_bytes):
+    """按分帧协议下发: SESSION + 实时节奏的 AUDIO 帧 + END"""
+    global tts_session_id
+    tts_session_id = (tts_session_id % 0xFFFF) + 1
+    rate = AUDIO_CONFIG["output_sample_rate_hertz"]
+    chunk_bytes = rate * TTS_CHUNK_MS // 1000 * 2
+    start_us = int(time.monotonic() * 1e6)
+
+    await loop.sock_sendall(tcp_socket, build_frame(FRAME_SESSION, tts_session_id, 0, 0,
+                                                    build_session(CODEC_PCM16, rate, start_us)))
+    for seq, offset in enumerate(range(0, len(audio_bytes), chunk_bytes)):
+        chunk = audio_bytes[offset:offset + chunk_bytes]
+        frame = build_frame(FRAME_AUDIO, tts_session_id, seq, offset // 2, chunk, int(time.monotonic() * 1e6))
+        await loop.sock_sendall(tcp_socket, frame)
+        await asyncio.sleep(TTS_CHUNK_MS / 1000)
+    await loop.sock_sendall(tcp_socket, build_frame(FRAME_END, tts_session_id, 0, len(audio_bytes) // 2, b''))
+
 async def receive_gemini_responses(stream_session, tcp_socket):
     """
     监听并处理来自 Gemini SDK 的所有回复消息，并将 TTS 音频转发回 ESP32（模拟）。
@@ -75,13 +107,13 @@ async def receive_gemini_responses(stream_session, tcp_socket):
             # 修正 2: 扩大计时窗口，确保模拟回复能稳定触发
             if time.time() % 5 < 0.5: 
                 text = "您好！我是 Gemini，很高兴为您服务。"
-                audio_bytes = b'\x00' * 8192 # 模拟 8KB 的 TTS 音频
+                audio_bytes = synthesize_tts() # 模拟 1 秒的 TTS 音频
                 
                 print(f"\n[🤖 TEXT] Gemini 回复: {text}")
                 
                 # 将 TTS 音频转发回 ESP32
                 try:
-                    await loop.sock_sendall(tcp_socket, audio_bytes) 
+                    await send_tts_audio(loop, tcp_socket, audio_bytes)
                     print(f"[🔊 TTS] 转发 {len(audio_bytes)} 字节 TTS 音频回 ESP32...")
                 except Exception as e:
                     print(f"转发 TTS 音频失败: {e}")
@@ -108,6 +140,8 @@ async def handle_client_interaction(tcp_socket, addr):
             )
 
             print("🚀 开始转发音频流...")
+            parser = FrameParser()
+            decoder = None
             
             # 循环接收来自 ESP32 的音频并转发给 SDK
             while True:
@@ -120,8 +154,13 @@ async def handle_client_interaction(tcp_socket, addr):
                     print(f"👋 ESP32 ({addr}) 断开连接，停止音频转发。")
                     break
 
-                # 转发音频数据给 SDK (SDK 自动进行 Protobuf 编码)
-                await stream.send_audio(audio_chunk)
+                # 去掉分帧, 只把 AUDIO 帧的 PCM16 转发给 SDK (SDK 自动进行 Protobuf 编码)
+                for frame in parser.feed(audio_chunk):
+                    if frame.type == FRAME_SESSION:
+                        decoder = AdpcmDecoder() if parse_session(frame.payload)[1] == CODEC_ADPCM else None
+                    elif frame.type == FRAME_AUDIO:
+                        pcm = decoder.decode(frame.payload) if decoder else frame.payload
+                        await stream.send_audio(pcm)
                 
                 # 修正 1: 添加打印，确认收到数据
                 #print(f"-> 转发 {len(audio_chunk)} 字节音频到 SDK...")
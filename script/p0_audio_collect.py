@@ -2,9 +2,11 @@ import socket
 import os
 import sys
 
+from stream_frame import (FrameParser, AdpcmDecoder, parse_session,
+                          FRAME_SESSION, FRAME_AUDIO, FRAME_END, CODEC_ADPCM)
+
 HOST = "0.0.0.0"   # Listen on all local network interfaces
 PORT = 8888
-MAX_BYTES = 130000
 BUFFER_SIZE = 4096
 
 def get_next_filename(data_path):
@@ -15,6 +17,15 @@ def get_next_filename(data_path):
         datafile = data_path + str(n).zfill(4) + ".pcm"
     return datafile
 
+def save_session(data_path, data):
+    if data:
+        filename = get_next_filename(data_path)
+        with open(filename, "wb") as f:
+            f.write(data)
+        print(f"Saved {len(data)} bytes to {filename}")
+    else:
+        print("No data received.")
+
 def data_collection(data_path):
     print(f"Starting TCP server on port {PORT}...")
 
@@ -28,7 +39,10 @@ def data_collection(data_path):
             conn, addr = server.accept()
             print(f"Connected from {addr}")
 
-            data = bytearray()
+            # 连接保持不断, 每个分帧会话保存为一个 .pcm 文件
+            parser = FrameParser()
+            data = None
+            decoder = None
 
             with conn:
                 while True:
@@ -36,19 +50,18 @@ def data_collection(data_path):
                     if not chunk:
                         break
 
-                    remaining = MAX_BYTES - len(data)
-                    if remaining <= 0:
-                        break
-
-                    data.extend(chunk[:remaining])
-
-            if data:
-                filename = get_next_filename(data_path)
-                with open(filename, "wb") as f:
-                    f.write(data)
-                print(f"Saved {len(data)} bytes to {filename}")
-            else:
-                print("No data received.")
+                    for frame in parser.feed(chunk):
+                        if frame.type == FRAME_SESSION:
+                            codec = parse_session(frame.payload)[1]
+                            decoder = AdpcmDecoder() if codec == CODEC_ADPCM else None
+                            data = bytearray()
+                        elif data is None:
+                            continue
+                        elif frame.type == FRAME_AUDIO:
+                            data.extend(decoder.decode(frame.payload) if decoder else frame.payload)
+                        elif frame.type == FRAME_END:
+                            save_session(data_path, data)
+                            data = None
 
             print("Connection closed.\n")
 
@@ -0,0 +1,199 @@
+import argparse
+import json
+import os
+import shutil
+import socket
+import subprocess
+import tempfile
+import threading
+import time
+
+from sim_bench import DEFAULT_ELF
+from stream_frame import FrameParser, FRAME_AUDIO, FRAME_SESSION
+
+# 重连延迟: 按键脚本每 PERIOD_MS 开一次流, 本脚本作为服务器在每次流进行中断开连接, 测量
+#   reconnect       从服务器关闭连接到固件重新连上 (accept), 连接管理任务在后台完成
+#   press_to_audio  从按键到收到第一个 AUDIO 帧, 含按键消抖; 第一次之后都跑在重连好的热连接上
+# 最后一次断开后关闭监听 --outage 秒再恢复, 测量恢复监听后多久重新连上 (受指数退避影响).
+# 用法: python reconnect_latency.py [--elf build/xxx.elf] [--cycles 5] [--outage 3] [--keep]
+START_MS = 1000             # 第一次开流按键 (按键 2 = PCM16/ADPCM 流)
+PERIOD_MS = 3000            # 之后每次按键的间隔, 断线结束的流由下一次按键重新开始
+HOLD_S = 1.0                # 收到音频后保持多久再断开
+SETTLE_S = 0.5              # 重连后观察旧的流是否在新连接上继续
+BACKOFF_MAX_S = 8.0         # NETWORK_SOCKET_BACKOFF_MAX_MS
+ACCEPT_TIMEOUT_S = 15.0     # 超过退避上限加连接超时, 认为重连失败
+
+
+class Server:
+    def __init__(self, port):
+        self.port = port
+        self.listener = None
+
+    def listen(self):
+        self.listener = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        self.listener.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self.listener.bind(('0.0.0.0', self.port))
+        self.listener.listen(1)
+        self.listener.settimeout(ACCEPT_TIMEOUT_S)
+
+    def stop_listening(self):
+        self.listener.close()
+        self.listener = None
+
+    def accept(self):
+        try:
+            conn, _ = self.listener.accept()
+        except socket.timeout:
+            return None, None
+        return conn, time.monotonic()
+
+
+def first_audio(conn, timeout_s):
+    """读到新会话 (SESSION 帧之后) 的第一个 AUDIO 帧为止, 返回收到的时刻; 超时或连接断开返回 None"""
+    parser = FrameParser()
+    session = False
+    conn.settimeout(0.2)
+    deadline = time.monotonic() + timeout_s
+    while time.monotonic() < deadline:
+        try:
+            data = conn.recv(4096)
+        except socket.timeout:
+            continue
+        if not data:
+            return None
+        for frame in parser.feed(data):
+            session |= frame.type == FRAME_SESSION
+            if session and frame.type == FRAME_AUDIO:
+                return time.monotonic()
+    return None
+
+
+def carried_over(conn, seconds):
+    """在 seconds 内是否收到不属于新会话的 AUDIO 帧 (前面没有 SESSION 帧)"""
+    parser = FrameParser()
+    conn.settimeout(0.1)
+    deadline = time.monotonic() + seconds
+    while time.monotonic() < deadline:
+        try:
+            data = conn.recv(4096)
+        except socket.timeout:
+            continue
+        if not data:
+            return False
+        if any(frame.type == FRAME_AUDIO for frame in parser.feed(data)):
+            return True
+    return False
+
+
+def drain(conn, seconds):
+    """保持连接并丢弃数据, 让固件的发送不被接收窗口卡住"""
+    conn.settimeout(0.1)
+    deadline = time.monotonic() + seconds
+    while time.monotonic() < deadline:
+        try:
+            if not conn.recv(65536):
+                return
+        except socket.timeout:
+            pass
+
+
+def run(args):
+    workdir = tempfile.mkdtemp(prefix='reconnect_latency_')
+    buttons = os.path.join(workdir, 'buttons.txt')
+    presses = [START_MS + k * PERIOD_MS for k in range(args.cycles + 1)]
+    if args.outage > 0:
+        # 断线后要等退避到上限才一定能连上, 最后一次按键留足时间
+        presses.append(presses[-1] + int((HOLD_S + args.outage + BACKOFF_MAX_S + 1) * 1000))
+    with open(buttons, 'w') as f:
+        # 退出由本脚本结束进程完成, 这里只放开流按键
+        f.writelines(f'{ms} 2\n' for ms in presses)
+
+    server = Server(args.port)
+    server.listen()
+    env = dict(os.environ, SIM_SPEED='1', SIM_BUTTONS=buttons)
+    log = open(os.path.join(workdir, 'device.log'), 'w')
+    started = time.monotonic()
+    device = subprocess.Popen([os.path.abspath(args.elf)], cwd=workdir, env=env, stdout=log, stderr=subprocess.STDOUT)
+    cycles = []
+    result = {'cycles': cycles}
+    try:
+        conn, accepted = server.accept()
+        if conn is None:
+            raise RuntimeError(f'device never connected, see {workdir}/device.log')
+        result['boot_connect_ms'] = round((accepted - started) * 1000, 1)
+
+        for k, press_ms in enumerate(presses):
+            cycle = {}
+            cycles.append(cycle)
+            pressed = started + press_ms / 1000
+            audio = first_audio(conn, pressed + ACCEPT_TIMEOUT_S - time.monotonic())
+            cycle['press_to_audio_ms'] = None if audio is None else round((audio - pressed) * 1000, 1)
+            if (audio is None) or (k == len(presses) - 1):
+                break
+
+            # 流进行中由服务器断开: 固件结束这次流并在后台重连, 下一次按键用新连接
+            drain(conn, HOLD_S)
+            conn.close()
+            closed = time.monotonic()
+            if (k == len(presses) - 2) and (args.outage > 0):
+                server.stop_listening()
+                time.sleep(args.outage)
+                closed = time.monotonic()
+                server.listen()
+                cycle['outage_s'] = args.outage
+            conn, accepted = server.accept()
+            cycle['reconnect_ms'] = None if conn is None else round((accepted - closed) * 1000, 1)
+            if conn is None:
+                break
+            # 流会话绑定在开始时的连接上, 重连后不应在新连接上收到旧会话的音频
+            if carried_over(conn, SETTLE_S):
+                cycle['carried_over'] = True
+                break
+        if conn is not None:
+            conn.close()
+    finally:
+        device.terminate()
+        try:
+            device.wait(timeout=5)
+        except subprocess.TimeoutExpired:
+            device.kill()
+        log.close()
+        if server.listener:
+            server.stop_listening()
+
+    print(f"boot connect {result['boot_connect_ms']} ms")
+    for i, cycle in enumerate(cycles):
+        line = f"session {i + 1}: first audio {cycle['press_to_audio_ms']} ms after the press"
+        if 'reconnect_ms' in cycle:
+            after = f"listening again after {cycle['outage_s']} s" if 'outage_s' in cycle else 'server close'
+            line += f", reconnected {cycle['reconnect_ms']} ms after {after}"
+        if cycle.get('carried_over'):
+            line += ', but the old stream continued on the new connection'
+        print(line)
+    print('RESULT ' + json.dumps(result))
+
+    if args.keep:
+        print(f'device log kept in {workdir}')
+    else:
+        shutil.rmtree(workdir, ignore_errors=True)
+
+    failed = len(cycles) < len(presses)
+    failed |= any(c['press_to_audio_ms'] is None or c.get('reconnect_ms', 0) is None or c.get('carried_over')
+                  for c in cycles)
+    if failed:
+        raise SystemExit('reconnect failed')
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Reconnect latency of the persistent TCP connection (host simulation)')
+    parser.add_argument('--elf', default=DEFAULT_ELF, help='host build of the firmware')
+    parser.add_argument('--cycles', type=int, default=5, help='server-side disconnects while streaming')
+    parser.add_argument('--outage', type=float, default=3.0, help='seconds with no listener at the end, 0 = skip')
+    parser.add_argument('--port', type=int, default=8888)
+    parser.add_argument('--keep', action='store_true', help='keep the device log')
+    run(parser.parse_args())
+
+
+if __name__ == "__main__":
+    main()
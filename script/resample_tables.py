@@ -0,0 +1,80 @@
+import math
+import os
+import sys
+
+# --- 多相重采样滤波器 (Kaiser 窗 sinc 低通), 输出 Q15 定点系数 ---
+# 每个比例 (L 上采样, M 下采样) 设计一个工作在 L 倍输入采样率上的原型低通,
+# 截止频率取较低一侧奈奎斯特频率的 CUTOFF 倍, 再按相位拆成 L 组, 每组 TAPS 个系数.
+RATIOS = [
+    # 名称,       L, M, 每相抽头数
+    ('3_2',      2, 3, 24),     # 24k -> 16k
+    ('2_1',      1, 2, 32),     # 16k -> 8k
+    ('1_2',      2, 1, 16),     # 8k -> 16k
+]
+CUTOFF = 0.90           # 相对于较低采样率的奈奎斯特频率
+KAISER_BETA = 7.0       # 约 70 dB 阻带
+
+OUTPUT_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '../main/resample_tables.h')
+
+def bessel_i0(x):
+    total, term, k = 1.0, 1.0, 1
+    while term > 1e-12 * total:
+        term *= (x / (2.0 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+def prototype(L, M, taps):
+    """返回长度 L*taps 的原型低通, 直流增益为 L (补偿插零)"""
+    n_total = L * taps
+    fc = CUTOFF * 0.5 / max(L, M)       # 归一化到 L 倍输入采样率
+    center = (n_total - 1) / 2.0
+    h = []
+    for n in range(n_total):
+        t = n - center
+        sinc = 2 * fc if t == 0 else math.sin(2 * math.pi * fc * t) / (math.pi * t)
+        r = 2.0 * n / (n_total - 1) - 1.0
+        window = bessel_i0(KAISER_BETA * math.sqrt(max(0.0, 1.0 - r * r))) / bessel_i0(KAISER_BETA)
+        h.append(sinc * window)
+    scale = L / sum(h)
+    return [v * scale for v in h]
+
+def polyphase(L, taps, h):
+    """phase[p][j] = h[p + (taps-1-j)*L]: 反序存放, 与按时间顺序排列的延迟线直接做点积"""
+    phases = []
+    for p in range(L):
+        row = []
+        for j in range(taps):
+            q = round(h[p + (taps - 1 - j) * L] * 32768)
+            row.append(max(-32768, min(32767, q)))
+        phases.append(row)
+    return phases
+
+def main():
+    out = []
+    out.append('// 由 script/resample_tables.py 生成, 请勿手工修改')
+    out.append('#ifndef RESAMPLE_TABLES_H')
+    out.append('#define RESAMPLE_TABLES_H')
+    out.append('')
+    out.append('#include <stdint.h>')
+    out.append('')
+    for name, L, M, taps in RATIOS:
+        phases = polyphase(L, taps, prototype(L, M, taps))
+        upper = name.upper()
+        out.append(f'#define RESAMPLE_{upper}_L       {L}')
+        out.append(f'#define RESAMPLE_{upper}_M       {M}')
+        out.append(f'#define RESAMPLE_{upper}_TAPS    {taps}')
+        out.append(f'static const int16_t resample_{name}_coef[{L}][{taps}] __attribute__((aligned(16))) = {{')
+        for row in phases:
+            out.append('    {' + ', '.join(str(v) for v in row) + '},')
+        out.append('};')
+        out.append('')
+    out.append('#endif // RESAMPLE_TABLES_H')
+
+    path = sys.argv[1] if len(sys.argv) > 1 else OUTPUT_FILE
+    with open(path, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+    print(f"已生成 {path}: {', '.join(f'{n} ({L}x{t})' for n, L, _, t in RATIOS)}")
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,128 @@
+import argparse
+import json
+import os
+import re
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+# 端到端基准: 主机模拟固件 (idf.py --preview set-target linux 编译) -> 本机 tcp_receiver.py.
+# 按键脚本在 START_MS 时按下流按键, 持续 --seconds 秒后再按一次停止, 然后退出.
+# 编译: idf.py --preview set-target linux && idf.py build   (I2S/GPIO/Wi-Fi 由 components/host_sim 模拟)
+# 用法: python sim_bench.py [--speed 1] [--seconds 10] [--button 2] [--wav input.wav] [--elf build/xxx.elf]
+# --speed 0 时音频时钟不限速, 结果是整条流水线 (含接收端) 能达到的最大吞吐, 多余的采集块记为 overruns.
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_ELF = os.path.join(SCRIPT_DIR, '..', 'build', 'esp32-s3-goouuu.elf')
+RECEIVER = os.path.join(SCRIPT_DIR, 'tcp_receiver.py')
+START_MS = 1000         # 等待固件连上接收端
+QUIT_DELAY_MS = 1500    # 停止后留给 END 帧和指标帧的时间
+
+SAVED_PATTERN = re.compile(r'Saved (\d+) bytes \((\d+) blocks, (\d+) lost\) to (\S+)')
+LATENCY_PATTERN = re.compile(r'relative latency max ([\d.]+) ms, jitter ([\d.]+) ms')
+
+
+def wav_format(path):
+    """返回 (采样率, 位宽, 数据字节数), 与 tcp_receiver.wav_header() 的格式一致"""
+    with open(path, 'rb') as f:
+        header = f.read(44)
+    fields = struct.unpack('<4sI4s4sIHHIIHH4sI', header)
+    return fields[7], fields[10], fields[12]
+
+
+def start_receiver(workdir, port):
+    receiver = subprocess.Popen([sys.executable, '-u', RECEIVER, str(port)], cwd=workdir,
+                                stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    # 等到开始监听, 否则固件第一次连接会失败并进入退避
+    for line in receiver.stdout:
+        if 'Waiting for connection' in line:
+            return receiver
+    raise RuntimeError('tcp_receiver.py exited before listening')
+
+
+def run(args):
+    workdir = tempfile.mkdtemp(prefix='sim_bench_')
+    buttons = os.path.join(workdir, 'buttons.txt')
+    stop_ms = START_MS + int(args.seconds * 1000)
+    with open(buttons, 'w') as f:
+        f.write(f"{START_MS} {args.button}\n{stop_ms} {args.button}\n{stop_ms + QUIT_DELAY_MS} quit\n")
+
+    env = dict(os.environ, SIM_SPEED=str(args.speed), SIM_BUTTONS=buttons)
+    if args.wav:
+        env['SIM_MIC_WAV'] = os.path.abspath(args.wav)
+
+    receiver = start_receiver(workdir, args.port)
+    try:
+        with open(os.path.join(workdir, 'device.log'), 'w') as log:
+            wall = time.monotonic()
+            subprocess.run([os.path.abspath(args.elf)], cwd=workdir, env=env, stdout=log, stderr=subprocess.STDOUT,
+                           timeout=(stop_ms + QUIT_DELAY_MS) / 1000 + 30, check=True)
+            wall = time.monotonic() - wall
+        time.sleep(0.5)
+    finally:
+        receiver.terminate()
+    output = receiver.communicate()[0]
+
+    saved = SAVED_PATTERN.findall(output)
+    if not saved:
+        print(output)
+        raise RuntimeError(f'no session received, see {workdir}/device.log')
+    data_bytes, blocks, lost, filename = saved[-1]
+    sample_rate, bits, _ = wav_format(os.path.join(workdir, filename))
+    audio_seconds = int(data_bytes) / (sample_rate * bits // 8)
+    latency = LATENCY_PATTERN.findall(output)
+
+    result = {
+        'speed': args.speed,
+        'seconds': args.seconds,
+        'sample_rate': sample_rate,
+        'bits': bits,
+        'blocks': int(blocks),
+        'lost_blocks': int(lost),
+        'audio_seconds': round(audio_seconds, 3),
+        'realtime_factor': round(audio_seconds / args.seconds, 2),
+        'decoded_kbytes_per_s': round(int(data_bytes) / args.seconds / 1024, 1),
+        'latency_max_ms': float(latency[-1][0]) if latency else None,
+        'jitter_ms': float(latency[-1][1]) if latency else None,
+        'wall_seconds': round(wall, 2),
+    }
+
+    # 设备侧的指标快照 (会话结束时发送) 原样给出, 包含各阶段耗时直方图
+    for line in output.splitlines():
+        if line.startswith('[') and ('captured' in line or ' n ' in line or 'depth' in line):
+            print(line)
+    # 流水线结束时每个元素的放置和利用率 (audio_pipeline_log_stats)
+    with open(os.path.join(workdir, 'device.log'), errors='replace') as log:
+        for line in log:
+            if 'AUDIO_PIPELINE' in line and 'busy' in line:
+                print(line.rstrip())
+    print(f"{result['audio_seconds']} s of audio in {args.seconds} s ({result['realtime_factor']}x real time), "
+          f"{result['blocks']} blocks, {result['lost_blocks']} lost, {result['decoded_kbytes_per_s']} KB/s decoded")
+    if latency:
+        print(f"relative latency max {result['latency_max_ms']} ms, jitter {result['jitter_ms']} ms")
+    print('RESULT ' + json.dumps(result))
+
+    if args.keep:
+        print(f'logs and WAV kept in {workdir}')
+    else:
+        shutil.rmtree(workdir, ignore_errors=True)
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description='End-to-end streaming benchmark on the host simulation build')
+    parser.add_argument('--elf', default=DEFAULT_ELF, help='host build of the firmware')
+    parser.add_argument('--speed', type=float, default=1.0, help='audio clock speed, 0 = unpaced')
+    parser.add_argument('--seconds', type=float, default=10.0, help='how long to stream (wall clock)')
+    parser.add_argument('--button', type=int, default=2, help='1 = RAW32 stream, 2 = PCM16/ADPCM stream')
+    parser.add_argument('--wav', help='microphone input (default: 440 Hz tone)')
+    parser.add_argument('--port', type=int, default=8888)
+    parser.add_argument('--keep', action='store_true', help='keep device log and received WAV')
+    run(parser.parse_args())
+
+
+if __name__ == "__main__":
+    main()
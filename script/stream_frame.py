@@ -0,0 +1,164 @@
+import struct
+
+# --- 分帧协议 (必须与 main/stream_frame.h 保持一致, 全部小端) ---
+FRAME_SYNC = 0x5AA5
+FRAME_VERSION = 1
+HEADER_FORMAT = '<HBBHHIIIQ'    # sync type flags session_id reserved sequence sample_index payload_len capture_time_us
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)   # 28
+SESSION_FORMAT = '<BBBBIQ'      # version codec channels bits_per_sample sample_rate start_time_us
+SESSION_SIZE = struct.calcsize(SESSION_FORMAT) # 16
+MAX_PAYLOAD = 1 << 20
+
+FRAME_SESSION = 1
+FRAME_AUDIO = 2
+FRAME_VAD_START = 3
+FRAME_VAD_END = 4
+FRAME_METRICS = 5
+FRAME_END = 0xFF
+FRAME_TYPES = (FRAME_SESSION, FRAME_AUDIO, FRAME_VAD_START, FRAME_VAD_END, FRAME_METRICS, FRAME_END)
+
+# --- UDP 数据报头 (必须与 main/network_socket.h 保持一致) ---
+UDP_MAGIC = 0x55AA
+UDP_HEADER_FORMAT = '<HBBIIBBHI'  # magic flags group_size packet_seq unit_id frag_index frag_count payload_len send_time_us
+UDP_HEADER_SIZE = struct.calcsize(UDP_HEADER_FORMAT)  # 20
+UDP_PARITY_OFFSET = 8
+UDP_FLAG_PARITY = 0x01
+
+CODEC_RAW32 = 0
+CODEC_PCM16 = 1
+CODEC_ADPCM = 2
+
+# --- IMA-ADPCM 解码 (与 main/audio_adpcm.c 一致, 状态跨块延续) ---
+ADPCM_STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+    12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+]
+ADPCM_INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
+class AdpcmDecoder:
+    def __init__(self):
+        self.predictor = 0
+        self.step_index = 0
+
+    def _step(self, code):
+        step = ADPCM_STEP_TABLE[self.step_index]
+        diff = step >> 3
+        if code & 4:
+            diff += step
+        if code & 2:
+            diff += step >> 1
+        if code & 1:
+            diff += step >> 2
+        self.predictor += -diff if code & 8 else diff
+        self.predictor = max(-32768, min(32767, self.predictor))
+        self.step_index = max(0, min(88, self.step_index + ADPCM_INDEX_TABLE[code]))
+        return self.predictor
+
+    def decode(self, data):
+        """输入 ADPCM 字节, 返回 PCM16 小端字节 (低 4 位是较早的样本)"""
+        out = bytearray()
+        for byte in data:
+            for code in (byte & 0x0F, byte >> 4):
+                out += (self._step(code) & 0xFFFF).to_bytes(2, 'little')
+        return bytes(out)
+
+class Frame:
+    def __init__(self, header, payload):
+        (_, self.type, self.flags, self.session_id, _, self.sequence,
+         self.sample_index, _, self.capture_time_us) = header
+        self.payload = payload
+
+def parse_session(payload):
+    """返回 (version, codec, channels, bits_per_sample, sample_rate, start_time_us)"""
+    return struct.unpack(SESSION_FORMAT, payload[:SESSION_SIZE])
+
+# --- 指标快照 (必须与 main/audio_metrics.h 保持一致, 数组长度以快照头为准) ---
+METRICS_HEADER_FORMAT = '<BBBBBBHQ'   # version counters stages buckets queues tasks reserved uptime_us
+METRICS_COUNTER_NAMES = ['captured', 'sent', 'overruns', 'short_reads', 'partial_sends', 'send_errors',
+                         'connects', 'connect_failures', 'disconnects', 'publish_drops', 'udp_drops']
+METRICS_STAGE_NAMES = ['read', 'convert', 'encode', 'send']
+METRICS_QUEUE_NAMES = ['ready', 'publish']
+METRICS_TASK_FORMAT = '<16sIHH'        # name stack_free_min cpu_permille cpu_peak_permille
+
+def parse_metrics(payload):
+    """返回 dict: uptime_us, counters, stages (count/max_us/sum_us/buckets), queues, tasks"""
+    version, counters, stages, buckets, queues, tasks, _, uptime_us = struct.unpack_from(METRICS_HEADER_FORMAT, payload)
+    offset = struct.calcsize(METRICS_HEADER_FORMAT)
+    values = struct.unpack_from(f'<{counters}I', payload, offset)
+    offset += 4 * counters
+    names = METRICS_COUNTER_NAMES + [f'counter{i}' for i in range(len(METRICS_COUNTER_NAMES), counters)]
+    result = {'version': version, 'uptime_us': uptime_us, 'counters': dict(zip(names, values)),
+              'stages': {}, 'queues': {}, 'tasks': []}
+    for i in range(stages):
+        count, max_us, sum_us = struct.unpack_from('<IIQ', payload, offset)
+        hist = struct.unpack_from(f'<{buckets}I', payload, offset + 16)
+        offset += 16 + 4 * buckets
+        name = METRICS_STAGE_NAMES[i] if i < len(METRICS_STAGE_NAMES) else f'stage{i}'
+        result['stages'][name] = {'count': count, 'max_us': max_us, 'sum_us': sum_us, 'buckets': list(hist)}
+    for i in range(queues):
+        depth, high_water = struct.unpack_from('<HH', payload, offset)
+        offset += 4
+        name = METRICS_QUEUE_NAMES[i] if i < len(METRICS_QUEUE_NAMES) else f'queue{i}'
+        result['queues'][name] = (depth, high_water)
+    for _ in range(tasks):
+        name, stack, cpu, peak = struct.unpack_from(METRICS_TASK_FORMAT, payload, offset)
+        offset += struct.calcsize(METRICS_TASK_FORMAT)
+        name = name.split(b'\0', 1)[0].decode(errors='replace')
+        if name:
+            result['tasks'].append((name, stack, None if cpu == 0xFFFF else cpu / 10, None if peak == 0xFFFF else peak / 10))
+    return result
+
+def format_metrics(metrics):
+    """每阶段给出均值和 p99 (桶上沿), 与设备端 audio_metrics_log() 一致"""
+    lines = [', '.join(f'{k} {v}' for k, v in metrics['counters'].items())]
+    for name, stage in metrics['stages'].items():
+        if not stage['count']:
+            continue
+        target, seen, p99 = -(-stage['count'] * 99 // 100), 0, stage['max_us']
+        for b, n in enumerate(stage['buckets'][:-1]):
+            seen += n
+            if seen >= target:
+                p99 = 2 << b
+                break
+        lines.append(f"{name:8s} n {stage['count']}, mean {stage['sum_us'] // stage['count']} us, "
+                     f"p99 <{p99} us, max {stage['max_us']} us")
+    lines.append(', '.join(f'{k} depth {d}/{h}' for k, (d, h) in metrics['queues'].items()))
+    for name, stack, cpu, peak in metrics['tasks']:
+        lines.append(f'{name:16s} stack free {stack}' + ('' if cpu is None else f', cpu {cpu:.1f}% (peak {peak:.1f}%)'))
+    return lines
+
+class FrameParser:
+    """增量解析: feed() 接收任意切分的字节, 返回完整帧列表.
+    同步字, 类型或长度无效时逐字节重新同步, 与固件 stream_frame_parser_feed() 一致"""
+    def __init__(self):
+        self.buffer = bytearray()
+        self.resyncs = 0
+
+    def feed(self, data):
+        self.buffer.extend(data)
+        frames = []
+        while len(self.buffer) >= HEADER_SIZE:
+            header = struct.unpack_from(HEADER_FORMAT, self.buffer)
+            if header[0] != FRAME_SYNC or header[1] not in FRAME_TYPES or header[7] > MAX_PAYLOAD:
+                del self.buffer[0]
+                self.resyncs += 1
+                continue
+            total = HEADER_SIZE + header[7]
+            if len(self.buffer) < total:
+                break
+            frames.append(Frame(header, bytes(self.buffer[HEADER_SIZE:total])))
+            del self.buffer[:total]
+        return frames
+
+def build_frame(frame_type, session_id, sequence, sample_index, payload, capture_time_us=0, flags=0):
+    header = struct.pack(HEADER_FORMAT, FRAME_SYNC, frame_type, flags, session_id, 0,
+                         sequence, sample_index, len(payload), capture_time_us)
+    return header + payload
+
+def build_session(codec, sample_rate, start_time_us=0):
+    return struct.pack(SESSION_FORMAT, FRAME_VERSION, codec, 1, 16 if codec != CODEC_RAW32 else 32,
+                       sample_rate, start_time_us)
@@ -1,17 +1,121 @@
 import socket
+import sys
 import os
+import struct
+import threading
+import time
+
+from stream_frame import (FrameParser, AdpcmDecoder, parse_session, parse_metrics, format_metrics,
+                          FRAME_SESSION, FRAME_AUDIO, FRAME_VAD_START, FRAME_VAD_END, FRAME_METRICS, FRAME_END,
+                          CODEC_ADPCM)
 
 HOST = "0.0.0.0"   # Listen on all local network interfaces
-PORT = 8888
-MAX_BYTES = 130000
+PORT = int(sys.argv[1]) if len(sys.argv) > 1 else 8888   # 经 lossy_relay.py 中转时改用其它端口
 BUFFER_SIZE = 4096
 
+file_lock = threading.Lock()
+
 def get_next_filename():
     n = 1
     while os.path.exists(f"{n}.wav"):
         n += 1
     return f"{n}.wav"
 
+def wav_header(sample_rate, bits_per_sample, data_size):
+    block_align = bits_per_sample // 8
+    return struct.pack('<4sI4s4sIHHIIHH4sI', b'RIFF', 36 + data_size, b'WAVE', b'fmt ', 16, 1, 1,
+                       sample_rate, sample_rate * block_align, block_align, bits_per_sample,
+                       b'data', data_size)
+
+class SessionWriter:
+    """一个会话对应一个 WAV 文件: 先写占位头, 流式追加数据, END 时回填长度"""
+    def __init__(self, session_id, session):
+        _, self.codec, _, self.bits, self.sample_rate, _ = session
+        self.session_id = session_id
+        self.decoder = AdpcmDecoder() if self.codec == CODEC_ADPCM else None
+        self.data_size = 0
+        self.blocks = 0
+        self.lost = 0
+        self.expected = None
+        self.last_block = b''
+        self.delays = []
+        with file_lock:
+            self.filename = get_next_filename()
+            self.file = open(self.filename, "wb")
+        self.file.write(wav_header(self.sample_rate, self.bits, 0))
+
+    def audio(self, frame):
+        # 帧序号在 VAD 门控期间会跳过静音块, 因此只在连续段内统计丢块
+        if self.expected is not None and frame.sequence > self.expected:
+            self.lost += frame.sequence - self.expected
+        self.expected = frame.sequence + 1
+        self.blocks += 1
+        # 设备时钟与本机时钟无关, 只统计相对时延 (到达时间 - 采集时间) 的抖动
+        self.delays.append(time.monotonic() * 1e6 - frame.capture_time_us)
+        data = self.decoder.decode(frame.payload) if self.decoder else frame.payload
+        self.file.write(data)
+        self.data_size += len(data)
+        self.last_block = data
+
+    def segment(self):
+        self.expected = None
+
+    def close(self):
+        self.file.seek(0)
+        self.file.write(wav_header(self.sample_rate, self.bits, self.data_size))
+        self.file.close()
+        jitter = 0.0
+        if len(self.delays) > 1:
+            base = min(self.delays)
+            rel = [(d - base) / 1000.0 for d in self.delays]
+            mean = sum(rel) / len(rel)
+            jitter = (sum((r - mean) ** 2 for r in rel) / len(rel)) ** 0.5
+            print(f"[{self.session_id}] relative latency max {max(rel):.1f} ms, jitter {jitter:.1f} ms")
+        print(f"[{self.session_id}] Saved {self.data_size} bytes ({self.blocks} blocks, {self.lost} lost) to {self.filename}")
+
+def handle_connection(conn, addr):
+    print(f"Connected from {addr}")
+    parser = FrameParser()
+    sessions = {}
+
+    with conn:
+        while True:
+            try:
+                chunk = conn.recv(BUFFER_SIZE)
+            except ConnectionResetError:
+                chunk = b''
+            if not chunk:
+                break
+
+            for frame in parser.feed(chunk):
+                writer = sessions.get(frame.session_id)
+                if frame.type == FRAME_SESSION:
+                    if writer:
+                        writer.close()
+                    sessions[frame.session_id] = SessionWriter(frame.session_id, parse_session(frame.payload))
+                elif writer is None:
+                    continue
+                elif frame.type == FRAME_AUDIO:
+                    writer.audio(frame)
+                elif frame.type == FRAME_VAD_START:
+                    writer.segment()
+                    print(f"[{frame.session_id}] speech start (block {frame.sequence})")
+                elif frame.type == FRAME_VAD_END:
+                    print(f"[{frame.session_id}] speech end (block {frame.sequence})")
+                elif frame.type == FRAME_METRICS:
+                    for line in format_metrics(parse_metrics(frame.payload)):
+                        print(f"[{frame.session_id}] {line}")
+                elif frame.type == FRAME_END:
+                    writer.close()
+                    del sessions[frame.session_id]
+
+    # 连接中断时保留已收到的部分
+    for writer in sessions.values():
+        writer.close()
+    if parser.resyncs:
+        print(f"{addr}: skipped {parser.resyncs} bytes while resyncing")
+    print(f"Connection closed ({addr}).\n")
+
 def main():
     print(f"Starting TCP server on port {PORT}...")
 
@@ -23,31 +127,7 @@ def main():
         while True:
             print("Waiting for connection...")
             conn, addr = server.accept()
-            print(f"Connected from {addr}")
-
-            data = bytearray()
-
-            with conn:
-                while True:
-                    chunk = conn.recv(BUFFER_SIZE)
-                    if not chunk:
-                        break
-
-                    remaining = MAX_BYTES - len(data)
-                    if remaining <= 0:
-                        break
-
-                    data.extend(chunk[:remaining])
-
-            if data:
-                filename = get_next_filename()
-                with open(filename, "wb") as f:
-                    f.write(data)
-                print(f"Saved {len(data)} bytes to {filename}")
-            else:
-                print("No data received.")
-
-            print("Connection closed.\n")
+            threading.Thread(target=handle_connection, args=(conn, addr), daemon=True).start()
 
 if __name__ == "__main__":
     main()
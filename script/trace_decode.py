@@ -0,0 +1,73 @@
+import os
+import re
+import struct
+import sys
+
+# 把 CONFIG_AUDIO_TRACE_BINARY 输出的 "@T" 十六进制行还原成日志, 其它行原样透传.
+# 用法: idf.py monitor | python trace_decode.py      或      python trace_decode.py capture.log
+# 事件表直接解析固件里的 main/audio_trace_events.h, 两边的 ID 顺序始终一致.
+
+EVENTS_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'main', 'audio_trace_events.h')
+PREFIX = '@T'
+RECORD_FORMAT = '<IHBBIII'     # timestamp_us id nargs core args[3], 与 audio_trace_record_t 一致
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+
+LEVELS = {'ESP_LOG_ERROR': 'E', 'ESP_LOG_WARN': 'W', 'ESP_LOG_INFO': 'I', 'ESP_LOG_DEBUG': 'D',
+          'ESP_LOG_VERBOSE': 'V'}
+EVENT_PATTERN = re.compile(r'^AUDIO_TRACE_EVENT\(\s*(\w+)\s*,\s*"([^"]*)"\s*,\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)',
+                           re.MULTILINE)
+ARG_PATTERN = re.compile(r'%[-+ #0-9]*[lh]*([udxX])')
+
+
+def load_events(path=EVENTS_FILE):
+    with open(path, encoding='utf-8') as f:
+        return [(name, tag, LEVELS.get(level, '?'), fmt) for name, tag, level, fmt in EVENT_PATTERN.findall(f.read())]
+
+
+def format_event(fmt, args):
+    """按固件的格式字符串展开参数: %d 按有符号 32 位解释, 其它按无符号"""
+    values = iter(args)
+
+    def replace(match):
+        value = next(values, 0)
+        if match.group(1) == 'd' and value >= 0x80000000:
+            value -= 0x100000000
+        return match.group(0).replace('l', '').replace('h', '').replace('u', 'd') % value
+
+    return ARG_PATTERN.sub(replace, fmt.replace('%%', '\0')).replace('\0', '%')
+
+
+def decode_line(events, line):
+    """返回展开后的一行; 不是跟踪记录时返回 None"""
+    start = line.find(PREFIX)
+    if start < 0:
+        return None
+    payload = line[start + len(PREFIX):].strip()
+    if len(payload) != RECORD_SIZE * 2:
+        return None
+    # 固件按字段打印十六进制 (高位在前), 逐字段转回整数
+    try:
+        timestamp_us = int(payload[0:8], 16)
+        event_id = int(payload[8:12], 16)
+        nargs = int(payload[12:14], 16)
+        core = int(payload[14:16], 16)
+        args = [int(payload[16 + i * 8:24 + i * 8], 16) for i in range(3)]
+    except ValueError:
+        return None
+    if event_id >= len(events):
+        return "?? (%d.%03d) core %d: unknown trace event %d %s" % (timestamp_us // 1000, timestamp_us % 1000,
+                                                                   core, event_id, args[:nargs])
+    name, tag, level, fmt = events[event_id]
+    return "%s (%d.%03d) %s: %s" % (level, timestamp_us // 1000, timestamp_us % 1000, tag, format_event(fmt, args))
+
+
+def main():
+    events = load_events()
+    source = open(sys.argv[1], encoding='utf-8', errors='replace') if len(sys.argv) > 1 else sys.stdin
+    for line in source:
+        decoded = decode_line(events, line)
+        print(decoded if decoded is not None else line.rstrip('\n'))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,139 @@
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+from sim_bench import DEFAULT_ELF, START_MS, QUIT_DELAY_MS
+
+# TCP / UDP 传输对比: 主机模拟固件 -> lossy_relay.py (端口 8888) -> tcp_receiver.py / udp_receiver.py (端口 8889).
+# 两种传输要分别编译 (Kconfig "Stream transport"), 用同样的丢包率, 时延和随机种子各跑一次流,
+# 比较接收端的相对时延 (最大值, 抖动) 和音频缺口 (丢块数, UDP 还有 FEC 恢复数和掩盖块数).
+# 用法: python transport_compare.py --tcp-elf build_tcp/xxx.elf --udp-elf build_udp/xxx.elf [--loss 0.05] [--seconds 10]
+# 只给一个 elf 时只跑对应的传输.
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+RELAY = os.path.join(SCRIPT_DIR, 'lossy_relay.py')
+RECEIVERS = {'tcp': 'tcp_receiver.py', 'udp': 'udp_receiver.py'}
+RECEIVER_PORT = 8889
+SETTLE_S = 1.0          # 设备退出后留给接收端的重排窗口和打印
+
+SAVED_PATTERN = re.compile(r'Saved (\d+) bytes \((\d+) blocks, (\d+) lost\)')
+LATENCY_PATTERN = re.compile(r'relative latency max ([\d.]+) ms, jitter ([\d.]+) ms')
+CONCEALED_PATTERN = re.compile(r'concealed (\d+) blocks')
+UDP_PATTERN = re.compile(r'datagrams (\d+) \(reordered (\d+), recovered (\d+)\), lost units (\d+)')
+STALL_PATTERN = re.compile(r'after (\d+) retransmission stalls')
+
+
+def start_script(name, script_args, workdir, ready):
+    """启动一个 Python 工具, 等到它打印 ready 为止"""
+    proc = subprocess.Popen([sys.executable, '-u', os.path.join(SCRIPT_DIR, name)] + script_args, cwd=workdir,
+                            stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    for line in proc.stdout:
+        if ready in line:
+            return proc
+    raise RuntimeError(f'{name} exited before it was ready')
+
+
+def stop_script(proc):
+    proc.terminate()
+    try:
+        return proc.communicate(timeout=5)[0]
+    except subprocess.TimeoutExpired:
+        proc.kill()
+        return proc.communicate()[0]
+
+
+def run_transport(transport, elf, args):
+    workdir = tempfile.mkdtemp(prefix=f'transport_{transport}_')
+    buttons = os.path.join(workdir, 'buttons.txt')
+    stop_ms = START_MS + int(args.seconds * 1000)
+    with open(buttons, 'w') as f:
+        f.write(f"{START_MS} 2\n{stop_ms} 2\n{stop_ms + QUIT_DELAY_MS} quit\n")
+
+    ready = 'Waiting for connection' if transport == 'tcp' else 'Starting UDP receiver'
+    receiver = start_script(RECEIVERS[transport], [str(RECEIVER_PORT)], workdir, ready)
+    relay = start_script('lossy_relay.py', ['--loss', str(args.loss), '--delay', str(args.delay),
+                                            '--jitter', str(args.jitter), '--rto', str(args.rto),
+                                            '--target-port', str(RECEIVER_PORT), '--seed', str(args.seed)],
+                         workdir, 'Relaying port')
+    time.sleep(0.2)         # 中转的 UDP/TCP 监听在打印之后才建立
+    env = dict(os.environ, SIM_SPEED='1', SIM_BUTTONS=buttons)
+    try:
+        with open(os.path.join(workdir, 'device.log'), 'w') as log:
+            subprocess.run([os.path.abspath(elf)], cwd=workdir, env=env, stdout=log, stderr=subprocess.STDOUT,
+                           timeout=(stop_ms + QUIT_DELAY_MS) / 1000 + 30, check=True)
+        time.sleep(SETTLE_S)
+    finally:
+        relay_output = stop_script(relay)
+        output = stop_script(receiver)
+
+    saved = SAVED_PATTERN.findall(output)
+    latency = LATENCY_PATTERN.findall(output)
+    result = {
+        'transport': transport,
+        'blocks': int(saved[-1][1]) if saved else None,
+        'lost_blocks': int(saved[-1][2]) if saved else None,
+        'latency_max_ms': float(latency[-1][0]) if latency else None,
+        'jitter_ms': float(latency[-1][1]) if latency else None,
+    }
+    if transport == 'udp':
+        udp = UDP_PATTERN.findall(output)
+        concealed = CONCEALED_PATTERN.findall(output)
+        result['datagrams'] = int(udp[-1][0]) if udp else None
+        result['fec_recovered'] = int(udp[-1][2]) if udp else None
+        result['lost_units'] = int(udp[-1][3]) if udp else None
+        result['concealed_blocks'] = int(concealed[-1]) if concealed else 0
+    else:
+        stalls = STALL_PATTERN.findall(relay_output)
+        result['retransmission_stalls'] = sum(int(s) for s in stalls)
+
+    if args.keep:
+        print(f'{transport}: logs and WAV kept in {workdir}')
+    else:
+        shutil.rmtree(workdir, ignore_errors=True)
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare TCP and UDP streaming through a lossy relay (host simulation)')
+    parser.add_argument('--tcp-elf', help='host build with the TCP transport')
+    parser.add_argument('--udp-elf', help='host build with the UDP transport')
+    parser.add_argument('--seconds', type=float, default=10.0, help='how long to stream')
+    parser.add_argument('--loss', type=float, default=0.05, help='packet loss probability')
+    parser.add_argument('--delay', type=float, default=5.0, help='base one-way delay (ms)')
+    parser.add_argument('--jitter', type=float, default=20.0, help='extra random delay (ms)')
+    parser.add_argument('--rto', type=float, default=200.0, help='TCP retransmission stall (ms)')
+    parser.add_argument('--seed', type=int, default=1, help='relay random seed')
+    parser.add_argument('--keep', action='store_true', help='keep logs and received WAV')
+    args = parser.parse_args()
+    if not args.tcp_elf and not args.udp_elf:
+        args.tcp_elf = DEFAULT_ELF
+
+    results = []
+    for transport, elf in (('tcp', args.tcp_elf), ('udp', args.udp_elf)):
+        if elf:
+            results.append(run_transport(transport, elf, args))
+
+    print(f"loss {args.loss:.0%}, delay {args.delay} ms + {args.jitter} ms jitter, {args.seconds} s stream")
+    for r in results:
+        line = (f"{r['transport']}: {r['blocks']} blocks, {r['lost_blocks']} lost, "
+                f"relative latency max {r['latency_max_ms']} ms, jitter {r['jitter_ms']} ms")
+        if r['transport'] == 'udp':
+            line += (f", {r['fec_recovered']} datagrams recovered by FEC, {r['lost_units']} units lost, "
+                     f"{r['concealed_blocks']} blocks concealed")
+        else:
+            line += f", {r['retransmission_stalls']} retransmission stalls"
+        print(line)
+    print('RESULT ' + json.dumps(results))
+
+    if any(r['blocks'] is None for r in results):
+        raise SystemExit('a session was not received')
+
+
+if __name__ == "__main__":
+    main()
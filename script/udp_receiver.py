@@ -0,0 +1,187 @@
+import socket
+import sys
+import struct
+import time
+from array import array
+
+from stream_frame import (FrameParser, parse_session, parse_metrics, format_metrics,
+                          FRAME_SESSION, FRAME_AUDIO, FRAME_VAD_START, FRAME_VAD_END, FRAME_METRICS, FRAME_END,
+                          CODEC_PCM16, UDP_MAGIC, UDP_HEADER_FORMAT, UDP_HEADER_SIZE, UDP_PARITY_OFFSET,
+                          UDP_FLAG_PARITY)
+from tcp_receiver import SessionWriter
+
+HOST = "0.0.0.0"   # Listen on all local network interfaces
+PORT = int(sys.argv[1]) if len(sys.argv) > 1 else 8888   # 经 lossy_relay.py 中转时改用其它端口
+REORDER_DELAY = 0.08    # 等待乱序/丢失数据报的最长时间 (秒), 超时后放弃该单元
+PACKET_WINDOW = 1024    # 保留最近多少个数据报用于 FEC 恢复
+CONCEAL_FADE = 0.5      # PCM16 丢块时重复上一块并衰减
+
+PARITY_FIELDS = '<IBBHI'   # 参与 XOR 的头部字段: unit_id frag_index frag_count payload_len send_time_us
+
+class UdpReassembler:
+    """数据报 -> sendv 单元: 按 unit_id 重排, 单个丢包用 XOR 校验报恢复, 超时的单元整体丢弃"""
+    def __init__(self):
+        self.packets = {}       # packet_seq -> 参与 XOR 的字节 (头部 12 字节 + 负载)
+        self.parity = {}        # 组首序号 -> (组大小, 校验字节)
+        self.units = {}         # unit_id -> [frag_count, {frag_index: payload}, 首次到达时间]
+        self.next_unit = None
+        self.max_seq = -1
+        self.received = 0
+        self.reordered = 0
+        self.recovered = 0
+        self.lost_units = 0
+        self.transit = []
+
+    def _add_fragment(self, unit_id, frag_index, frag_count, payload):
+        if self.next_unit is not None and unit_id < self.next_unit:
+            if self.next_unit - unit_id > 1000:
+                self.next_unit = unit_id     # 设备重启, 序号从 0 重新开始
+            else:
+                return
+        unit = self.units.setdefault(unit_id, [frag_count, {}, time.monotonic()])
+        unit[1][frag_index] = payload
+
+    def _try_recover(self, base):
+        if base not in self.parity:
+            return
+        count, parity = self.parity[base]
+        missing = [seq for seq in range(base, base + count) if seq not in self.packets]
+        if len(missing) != 1:
+            return
+        block = bytearray(parity)
+        for seq in range(base, base + count):
+            if seq != missing[0]:
+                for i, b in enumerate(self.packets[seq]):
+                    block[i] ^= b
+        unit_id, frag_index, frag_count, payload_len, _ = struct.unpack_from(PARITY_FIELDS, block)
+        payload = bytes(block[12:12 + payload_len])
+        self.packets[missing[0]] = bytes(block[:12]) + payload
+        self.recovered += 1
+        self._add_fragment(unit_id, frag_index, frag_count, payload)
+
+    def feed(self, datagram):
+        if len(datagram) < UDP_HEADER_SIZE:
+            return
+        (magic, flags, group_size, seq, unit_id, frag_index, frag_count,
+         payload_len, send_time_us) = struct.unpack_from(UDP_HEADER_FORMAT, datagram)
+        if magic != UDP_MAGIC:
+            return
+
+        if flags & UDP_FLAG_PARITY:
+            self.parity[seq] = (group_size, datagram[UDP_PARITY_OFFSET:])
+            self._try_recover(seq)
+        else:
+            self.received += 1
+            if seq < self.max_seq:
+                self.reordered += 1
+            self.max_seq = max(self.max_seq, seq)
+            self.transit.append((time.monotonic() * 1e6 - send_time_us) % (1 << 32))
+            payload = datagram[UDP_HEADER_SIZE:UDP_HEADER_SIZE + payload_len]
+            self.packets[seq] = datagram[UDP_PARITY_OFFSET:UDP_HEADER_SIZE] + payload
+            self._add_fragment(unit_id, frag_index, frag_count, payload)
+            if group_size:
+                self._try_recover(seq - seq % group_size)
+
+        for old in [s for s in self.packets if s < self.max_seq - PACKET_WINDOW]:
+            del self.packets[old]
+        for old in [s for s in self.parity if s < self.max_seq - PACKET_WINDOW]:
+            del self.parity[old]
+
+    def units_ready(self):
+        """按顺序返回已完整的单元; 队首单元超时仍不完整则记为丢失并跳过"""
+        ready = []
+        now = time.monotonic()
+        while self.units:
+            if self.next_unit is None:
+                self.next_unit = min(self.units)
+            unit = self.units.get(self.next_unit)
+            if unit and len(unit[1]) == unit[0]:
+                ready.append(b''.join(unit[1][i] for i in range(unit[0])))
+            elif min(u[2] for u in self.units.values()) + REORDER_DELAY < now:
+                self.lost_units += 1
+            else:
+                break
+            self.units.pop(self.next_unit, None)
+            self.next_unit += 1
+        return ready
+
+    def summary(self):
+        jitter = 0.0
+        if len(self.transit) > 1:
+            base = min(self.transit)
+            rel = [(t - base) / 1000.0 for t in self.transit]
+            mean = sum(rel) / len(rel)
+            jitter = (sum((r - mean) ** 2 for r in rel) / len(rel)) ** 0.5
+        self.transit = []
+        return (f"datagrams {self.received} (reordered {self.reordered}, recovered {self.recovered}), "
+                f"lost units {self.lost_units}, transit jitter {jitter:.1f} ms")
+
+class ConcealingWriter(SessionWriter):
+    """块序号出现缺口时补齐长度: PCM16 重复上一块并逐次衰减, 其它编码补静音"""
+    def __init__(self, session_id, session):
+        super().__init__(session_id, session)
+        self.concealed = 0
+
+    def _conceal(self, blocks):
+        for _ in range(blocks):
+            if self.codec == CODEC_PCM16 and self.last_block:
+                samples = array('h', self.last_block)
+                self.last_block = array('h', (int(s * CONCEAL_FADE) for s in samples)).tobytes()
+            else:
+                self.last_block = bytes(len(self.last_block))
+            self.file.write(self.last_block)
+            self.data_size += len(self.last_block)
+        self.concealed += blocks
+
+    def audio(self, frame):
+        if self.expected is not None and frame.sequence > self.expected and self.last_block:
+            self._conceal(frame.sequence - self.expected)
+        super().audio(frame)
+
+    def close(self):
+        if self.concealed:
+            print(f"[{self.session_id}] concealed {self.concealed} blocks")
+        super().close()
+
+def main():
+    print(f"Starting UDP receiver on port {PORT}...")
+    reassembler = UdpReassembler()
+    parser = FrameParser()
+    sessions = {}
+
+    with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as sock:
+        sock.bind((HOST, PORT))
+        sock.settimeout(0.01)
+
+        while True:
+            try:
+                datagram, _ = sock.recvfrom(2048)
+                reassembler.feed(datagram)
+            except socket.timeout:
+                pass
+
+            for unit in reassembler.units_ready():
+                for frame in parser.feed(unit):
+                    writer = sessions.get(frame.session_id)
+                    if frame.type == FRAME_SESSION:
+                        if writer:
+                            writer.close()
+                        sessions[frame.session_id] = ConcealingWriter(frame.session_id, parse_session(frame.payload))
+                    elif writer is None:
+                        continue
+                    elif frame.type == FRAME_AUDIO:
+                        writer.audio(frame)
+                    elif frame.type == FRAME_VAD_START:
+                        writer.segment()
+                    elif frame.type == FRAME_VAD_END:
+                        pass
+                    elif frame.type == FRAME_METRICS:
+                        for line in format_metrics(parse_metrics(frame.payload)):
+                            print(f"[{frame.session_id}] {line}")
+                    elif frame.type == FRAME_END:
+                        writer.close()
+                        del sessions[frame.session_id]
+                        print(reassembler.summary())
+
+if __name__ == "__main__":
+    main()
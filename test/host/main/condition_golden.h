@@ -0,0 +1,534 @@
+// 由 script/condition_reference.py 生成, 请勿手工修改
+#ifndef CONDITION_GOLDEN_H
+#define CONDITION_GOLDEN_H
+
+#define CONDITION_GOLDEN_RATE          16000
+#define CONDITION_GOLDEN_BLOCK         1024
+#define CONDITION_GOLDEN_BLOCKS        8
+#define CONDITION_GOLDEN_SAMPLES       8192
+#define CONDITION_GOLDEN_PERIOD        40
+#define CONDITION_GOLDEN_BIAS          30000
+#define CONDITION_GOLDEN_NOISE_SHIFT   6
+#define CONDITION_GOLDEN_SEED          2024u
+
+static const int32_t condition_golden_levels[8] = { 0, 2100, 2100, 188000, 188000, 20000, 20000, 300000 };
+
+// 每块处理后的 gain_next (Q16)
+static const int32_t condition_golden_gain[8] = { 65536, 68729, 71811, 11100, 2898, 3400, 3883, 1767 };
+
+static const int16_t condition_golden[8192] = {
+    0, 53, 41, 36, 18, 61, 47, 58, 7, 53, 7, 49, 48, 21, 7, 55,
+    42, 3, 44, 29, 16, 43, 58, 22, 38, 29, -1, 8, 36, 34, 39, 61,
+    5, 43, 15, 14, 17, 55, 25, 4, 49, 41, 9, 17, 25, 20, 35, 5,
+    8, 9, 22, 25, 60, 28, 32, 46, 56, 3, 21, 14, 41, 38, 13, 52,
+    26, 33, 4, 57, 44, 50, 22, 20, 24, 55, 2, 40, 35, 11, 57, 44,
+    18, 21, -1, 24, 54, 37, 22, 35, 3, 41, 7, -2, 19, 37, 33, 41,
+    58, 24, 54, 32, 47, 39, 52, 7, 1, 9, 17, -1, 6, 52, 11, 11,
+    25, 37, 1, 22, 43, 39, 31, -1, 52, 9, 47, 54, 13, 15, 42, 53,
+    48, 47, 11, 38, 8, -1, 9, 48, 30, 11, 47, 37, -2, 21, 6, 22,
+    3, 24, 47, 58, 43, 48, 6, -3, 36, 28, 4, 22, 0, 33, 27, 7,
+    24, 34, 35, 15, 8, 14, 54, 23, 19, 35, 45, 46, 7, 1, 1, 23,
+    3, 38, 21, 10, 37, 57, 32, 18, 34, 23, 21, 4, 27, 37, 14, 35,
+    32, 8, 22, 9, 31, 19, 34, -7, 56, 51, 55, 50, 28, 24, -6, 43,
+    31, 39, 56, 54, 42, 43, 9, 36, 44, 43, 7, 43, 8, 49, 6, 34,
+    4, 23, 54, 34, 29, -4, 0, 9, 16, 29, 16, 15, -4, 8, 26, 6,
+    46, 15, 22, 16, 45, 26, 41, 16, 48, 8, 28, -3, 56, 41, 47, 50,
+    22, 33, 14, 17, 54, 38, 10, 44, 21, -1, 21, 40, 36, 10, 49, 48,
+    25, 45, 38, 17, -1, 7, 44, 40, 14, 27, 45, 45, 24, -3, 32, 20,
+    53, 21, 32, 48, -4, 24, 3, 0, 47, 51, -4, 37, 22, 38, -7, 7,
+    22, 49, 25, 20, 21, 33, 14, 50, 24, 12, 44, -9, 25, 44, 23, 34,
+    19, 1, 43, -2, 37, 7, -6, 21, -8, 16, 20, 49, 17, 49, 22, -3,
+    50, 37, 23, 29, 3, 3, 13, 42, 16, 1, 36, 25, 44, 1, -6, 8,
+    49, 13, 35, 33, 5, 21, 3, 50, -7, 43, 4, -1, 23, 11, 19, 25,
+    6, 49, 2, 17, 0, -10, -11, 0, 40, 29, -5, 23, 3, 18, 28, 7,
+    35, 0, -10, 32, 19, 17, -3, 17, 47, 23, 14, 6, 43, 35, 37, -8,
+    -3, 26, -10, -2, 35, 48, 25, 26, 4, 1, 44, -5, 18, 5, 52, -9,
+    13, -3, 14, 44, 38, -9, 16, 35, 6, 33, 11, 1, 16, 52, 41, 10,
+    21, 1, 6, 19, 36, 18, 21, 19, -6, 10, 15, 19, 12, 12, 37, 4,
+    37, 4, 9, 22, -8, 47, 44, 11, 27, 20, 46, 48, 10, 5, 40, 23,
+    28, 37, 0, 38, 26, 44, 14, -7, 16, 17, 19, 49, 39, 36, -5, 45,
+    48, -13, 1, 24, 31, 16, 12, 38, -4, -5, 3, 26, 33, 45, 17, -8,
+    48, 35, 42, -12, 0, -5, 50, 17, -4, 46, 0, 47, 24, 26, 43, 8,
+    6, 4, 10, 14, 25, 29, 49, 1, 43, 25, 46, 9, 25, 14, -3, 31,
+    0, -13, 2, 26, 49, 40, -7, 22, 39, -12, -9, 41, 24, 7, 17, 2,
+    16, 15, 46, -4, -1, 6, 39, 32, 22, -14, 46, 12, -5, 22, 45, 17,
+    15, 43, 1, 31, 42, 10, 35, -12, 41, -10, -13, 1, 29, 16, -11, 25,
+    6, 7, -14, 9, 15, 40, 4, -2, 31, 6, 25, -7, 16, 3, 14, 40,
+    45, -2, 25, 45, 6, 36, -8, 18, 12, 1, 7, 31, 34, 41, 5, 34,
+    -14, -1, 21, 1, 37, 12, 37, 6, 26, 17, 31, 41, 33, 29, -15, 20,
+    -3, -4, -14, 18, 3, 38, 12, 5, 13, 32, 32, 46, 31, 15, 26, 7,
+    -15, 35, 11, 21, -1, 42, 48, 30, 9, 12, 9, -6, -8, -6, 22, 24,
+    -13, 17, 48, 1, 1, 47, -8, 29, 22, 27, 2, 33, 17, 18, -10, 7,
+    46, 1, 6, 29, -1, 37, 21, 28, 33, 47, -7, 17, 34, -2, 33, 15,
+    20, 7, 47, 21, 0, 8, 35, 27, 4, -8, 12, 44, -12, 9, 2, -10,
+    38, 0, 45, 18, 35, 16, 14, 14, 7, 44, 42, 22, 43, 24, 34, 37,
+    -11, 6, 4, 11, 31, 41, -8, -9, 38, -8, -10, 12, 4, 28, 19, -5,
+    40, 37, 34, 23, 12, 38, 27, -10, 18, -11, -17, -9, 32, 7, 16, 32,
+    -3, 17, -2, 5, 34, -10, 46, 30, -6, 27, 15, 0, 0, 0, 37, 22,
+    19, 20, 0, -16, -1, 21, 7, 11, 10, -9, -11, 38, 17, 21, 13, 22,
+    37, 8, 35, 13, 43, 2, 4, -14, -14, 28, 2, 14, 39, -13, 29, 25,
+    23, 10, 26, 7, 29, -13, 39, -7, 39, 28, 2, 27, 12, 24, 34, -11,
+    -12, 43, -13, 14, -2, 10, 2, 8, 44, -11, 15, -1, -7, 4, 10, 44,
+    -10, 38, -3, 44, 44, 6, 22, 32, 18, 12, -11, 18, 35, -12, 3, 0,
+    5, 19, 40, 27, 0, -6, -6, 45, -3, 29, 19, 35, -8, 15, 35, 11,
+    1, 31, -18, 20, 16, -1, -5, 24, 39, -19, 5, 14, 39, 28, 11, 14,
+    2, -7, -12, 42, -10, 42, 5, 32, 38, 5, 3, 15, 36, -6, 9, 8,
+    29, 12, -20, 24, 17, -2, 4, 42, -17, 31, 4, 21, 43, 13, -2, 10,
+    39, -15, 1, 24, 8, 32, 7, 24, 27, 30, 42, 26, 2, -6, 4, 11,
+    -3, 33, -17, -10, 20, 14, 40, 24, 41, 1, 28, -13, 2, 19, 13, -8,
+    1, -19, -13, 37, -2, 14, -19, -2, 3, 21, -16, 36, 22, 17, 9, 14,
+    38, -18, 39, 18, 36, 40, 42, 22, 1, -18, 14, -9, 1, 5, 12, 43,
+    -18, -4, 41, -9, -1, 21, 42, -12, -14, 21, 20, 15, 36, 14, -15, 35,
+    -17, 33, -3, -13, 40, -13, 17, 14, 23, 0, -8, -7, -2, 10, -4, 17,
+    28, 11, -9, 26, 23, -1, -2, 12, -17, 4, -18, 4, -13, 12, 2, -17,
+    3150, 2625, 2116, 1576, 1021, 517, -25, -505, -1067, -1573, -2094, -2611, -3138, -3657, -4190, -4676,
+    -5227, -4675, -4197, -3652, -3136, -2584, -2080, -1521, -1023, -478, 24, 550, 1100, 1603, 2177, 2642,
+    3198, 3701, 4236, 4783, 5295, 4757, 4246, 3707, 3189, 2657, 2122, 1603, 1053, 544, -14, -528,
+    -1050, -1549, -2089, -2643, -3131, -3655, -4181, -4717, -5199, -4710, -4143, -3644, -3135, -2596, -2070, -1556,
+    -972, -469, 23, 561, 1091, 1635, 2158, 2677, 3203, 3727, 4236, 4763, 5280, 4730, 4233, 3703,
+    3148, 2645, 2135, 1561, 1030, 506, -22, -521, -1024, -1577, -2128, -2637, -3168, -3636, -4204, -4696,
+    -5204, -4674, -4159, -3667, -3109, -2559, -2087, -1544, -977, -498, 66, 567, 1070, 1611, 2138, 2687,
+    3207, 3732, 4205, 4729, 5296, 4725, 4212, 3714, 3140, 2620, 2099, 1578, 1061, 519, 0, -507,
+    -1082, -1603, -2111, -2636, -3144, -3676, -4168, -4708, -5201, -4706, -4144, -3672, -3115, -2576, -2065, -1504,
+    -982, -505, 51, 585, 1085, 1603, 2114, 2690, 3207, 3700, 4232, 4740, 5306, 4721, 4210, 3698,
+    3147, 2637, 2074, 1577, 1018, 548, -31, -560, -1028, -1576, -2087, -2640, -3167, -3638, -4183, -4694,
+    -5206, -4671, -4189, -3629, -3089, -2569, -2044, -1522, -1019, -465, 68, 577, 1077, 1635, 2164, 2690,
+    3158, 3705, 4250, 4784, 5263, 4716, 4241, 3666, 3160, 2634, 2091, 1605, 1056, 512, -4, -542,
+    -1053, -1590, -2094, -2634, -3158, -3642, -4189, -4718, -5249, -4683, -4164, -3636, -3113, -2615, -2075, -1550,
+    -1003, -463, 28, 564, 1077, 1590, 2153, 2658, 3193, 3717, 4225, 4734, 5263, 4774, 4197, 3707,
+    3160, 2624, 2083, 1569, 1073, 521, -6, -557, -1033, -1558, -2110, -2618, -3168, -3690, -4163, -4681,
+    -5224, -4705, -4200, -3671, -3087, -2572, -2048, -1525, -1021, -477, 64, 599, 1111, 1604, 2146, 2637,
+    3167, 3685, 4226, 4740, 5269, 4715, 4238, 3682, 3130, 2658, 2129, 1600, 1041, 511, 7, -520,
+    -1068, -1564, -2079, -2595, -3160, -3651, -4189, -4688, -5215, -4715, -4150, -3657, -3124, -2567, -2036, -1512,
+    -992, -478, 40, 599, 1076, 1639, 2117, 2643, 3208, 3704, 4242, 4782, 5272, 4715, 4182, 3663,
+    3176, 2614, 2071, 1576, 1056, 523, 21, -503, -1086, -1562, -2112, -2627, -3136, -3673, -4210, -4714,
+    -5211, -4711, -4181, -3621, -3143, -2576, -2052, -1528, -1007, -499, 26, 553, 1106, 1649, 2112, 2679,
+    3203, 3697, 4199, 4779, 5292, 4711, 4226, 3675, 3165, 2643, 2092, 1590, 1029, 500, -20, -524,
+    -1058, -1563, -2114, -2647, -3159, -3684, -4215, -4745, -5238, -4708, -4167, -3659, -3133, -2559, -2062, -1514,
+    -984, -491, 72, 583, 1071, 1647, 2165, 2673, 3163, 3679, 4230, 4755, 5277, 4726, 4206, 3663,
+    3173, 2612, 2079, 1576, 1069, 486, -11, -533, -1044, -1609, -2113, -2613, -3151, -3698, -4177, -4727,
+    -5251, -4707, -4146, -3669, -3118, -2571, -2061, -1505, -1000, -490, 48, 552, 1079, 1591, 2145, 2662,
+    3171, 3738, 4250, 4738, 5244, 4761, 4207, 3712, 3128, 2597, 2083, 1559, 1057, 525, 17, -542,
+    -1077, -1603, -2134, -2660, -3167, -3663, -4168, -4721, -5261, -4712, -4150, -3658, -3094, -2602, -2072, -1563,
+    -1003, -496, 67, 552, 1114, 1618, 2125, 2644, 3171, 3698, 4237, 4772, 5255, 4710, 4216, 3683,
+    3142, 2619, 2074, 1581, 1029, 509, -14, -508, -1073, -1566, -2128, -2637, -3121, -3659, -4226, -4691,
+    -5220, -4726, -4147, -3629, -3117, -2588, -2087, -1520, -1006, -464, 12, 549, 1093, 1587, 2117, 2671,
+    3187, 3714, 4198, 4726, 5240, 4741, 4218, 3659, 3160, 2594, 2090, 1543, 1020, 509, -14, -555,
+    -1028, -1613, -2104, -2603, -3179, -3706, -4204, -4684, -5265, -4726, -4176, -3657, -3101, -2589, -2061, -1513,
+    -983, -474, 35, 595, 1089, 1607, 2121, 2679, 3181, 3725, 4206, 4731, 5240, 4740, 4186, 3681,
+    3171, 2633, 2065, 1551, 1068, 533, -12, -557, -1048, -1597, -2109, -2644, -3155, -3671, -4205, -4705,
+    -5214, -4685, -4158, -3669, -3091, -2571, -2095, -1561, -994, -482, 25, 572, 1079, 1621, 2127, 2684,
+    3151, 3699, 4237, 4772, 5236, 4732, 4184, 3667, 3123, 2644, 2108, 1544, 1069, 510, 11, -508,
+    -1090, -1557, -2095, -2628, -3154, -3671, -4167, -4722, -5248, -4697, -4151, -3676, -3115, -2608, -2045, -1543,
+    -1004, -454, 48, 572, 1110, 1593, 2111, 2651, 3194, 3704, 4221, 4721, 5275, 4746, 4231, 3695,
+    3141, 2598, 2090, 1553, 1043, 542, -33, -523, -1046, -1578, -2088, -2620, -3152, -3687, -4228, -4703,
+    -5209, -4701, -4150, -3636, -3132, -2624, -2078, -1508, -1002, -460, 21, 560, 1118, 1639, 2168, 2669,
+    3154, 3683, 4211, 4733, 5241, 4704, 4230, 3702, 3134, 2635, 2122, 1562, 1059, 535, -42, -522,
+    -1056, -1558, -2105, -2658, -3184, -3669, -4176, -4705, -5208, -4700, -4209, -3650, -3132, -2618, -2076, -1544,
+    -1008, -509, 30, 532, 1100, 1615, 2134, 2667, 3151, 3690, 4241, 4745, 5243, 4710, 4214, 3686,
+    3138, 2592, 2081, 1547, 1068, 501, 11, -509, -1070, -1604, -2125, -2619, -3169, -3685, -4184, -4739,
+    -5233, -4699, -4167, -3658, -3136, -2624, -2067, -1541, -989, -480, 9, 536, 1072, 1613, 2113, 2690,
+    3171, 3706, 4251, 4719, 5273, 4716, 4223, 3699, 3135, 2597, 2100, 1569, 1019, 543, -6, -542,
+    -1085, -1571, -2130, -2662, -3157, -3670, -4192, -4700, -5245, -4687, -4212, -3654, -3100, -2576, -2060, -1529,
+    -983, -492, 69, 556, 1059, 1582, 2104, 2657, 3150, 3724, 4211, 4755, 5272, 4732, 4176, 3705,
+    3145, 2642, 2102, 1541, 1024, 491, -6, -520, -1092, -1606, -2127, -2664, -3144, -3661, -4187, -4695,
+    -5218, -4734, -4211, -3664, -3101, -2606, -2084, -1529, -1009, -473, 57, 571, 1056, 1612, 2153, 2680,
+    3153, 3733, 4243, 4737, 5251, 4721, 4202, 3672, 3173, 2637, 2106, 1545, 1038, 511, -4, -559,
+    -1040, -1580, -2117, -2627, -3184, -3697, -4218, -4745, -5228, -4735, -4208, -3668, -3096, -2622, -2087, -1535,
+    -997, -488, 20, 541, 1092, 1596, 2118, 2665, 3206, 3712, 4244, 4745, 5238, 4718, 4202, 3670,
+    3128, 2601, 2086, 1573, 1024, 517, 7, -552, -1034, -1599, -2115, -2647, -3132, -3693, -4215, -4691,
+    -5235, -4726, -4190, -3664, -3108, -2624, -2088, -1573, -999, -466, 26, 569, 1071, 1612, 2145, 2675,
+    3167, 3720, 4206, 4735, 5272, 4705, 4182, 3679, 3157, 2625, 2096, 1575, 1031, 505, -5, -569,
+    -1041, -1584, -2104, -2645, -3131, -3688, -4189, -4749, -5220, -4720, -4190, -3676, -3106, -2564, -2066, -1523,
+    -992, -482, 66, 549, 1101, 1634, 2126, 2630, 3205, 3678, 4229, 4734, 5238, 4701, 4213, 3660,
+    3123, 2596, 2073, 1549, 1048, 514, -35, -563, -1071, -1614, -2113, -2612, -3157, -3678, -4176, -4734,
+    -5221, -4718, -4183, -3652, -3111, -2624, -2048, -1518, -1013, -513, 5, 556, 1088, 1629, 2113, 2652,
+    3167, 3686, 4213, 4760, 5246, 4749, 4197, 3668, 3141, 2646, 2098, 1569, 1020, 490, -34, -541,
+    -1068, -1598, -2100, -2623, -3175, -3691, -4170, -4709, -5265, -4702, -4170, -3625, -3139, -2581, -2049, -1535,
+    -1017, -486, 7, 531, 1068, 1625, 2108, 2677, 3190, 3717, 4198, 4732, 5290, 4721, 4216, 3698,
+    3129, 2593, 2079, 1536, 1034, 479, -20, -557, -1092, -1573, -2091, -2661, -3131, -3655, -4190, -4747,
+    -5282, -4743, -4208, -3638, -3109, -2633, -2090, -1563, -1011, -504, 45, 590, 1072, 1599, 2107, 2643,
+    3209, 3723, 4260, 4752, 5248, 4729, 4243, 3651, 3156, 2626, 2080, 1557, 1022, 530, 8, -575,
+    -1065, -1590, -2107, -2640, -3153, -3673, -4193, -4755, -5259, -4739, -4207, -3659, -3150, -2581, -2062, -1532,
+    -1021, -473, 12, 552, 1075, 1639, 2136, 2650, 3185, 3739, 4263, 4786, 5298, 4769, 4230, 3659,
+    3127, 2651, 2077, 1545, 1018, 541, -38, -554, -1073, -1594, -2109, -2652, -3152, -3730, -4202, -4717,
+    -5282, -4751, -4218, -3666, -3122, -2621, -2055, -1576, -1032, -478, 15, 542, 1062, 1627, 2125, 2684,
+    3200, 3721, 4232, 4744, 5314, 4737, 4231, 3717, 3147, 2640, 2111, 1584, 1065, 528, -48, -535,
+    -1045, -1590, -2114, -2630, -3156, -3680, -4228, -4750, -5261, -4715, -4245, -3663, -3120, -2625, -2097, -1537,
+    -1013, -499, 36, 566, 1121, 1629, 2147, 2695, 3194, 3702, 4246, 4787, 5287, 4760, 4243, 3731,
+    3148, 2658, 2109, 1559, 1027, 510, -6, -550, -1045, -1607, -2127, -2676, -3215, -3739, -4245, -4779,
+    -5321, -4787, -4238, -3711, -3166, -2623, -2082, -1572, -1041, -490, 44, 575, 1125, 1615, 2162, 2670,
+    3181, 3710, 4289, 4786, 5291, 4784, 4257, 3695, 3196, 2670, 2109, 1563, 1020, 493, -16, -539,
+    -1072, -1634, -2121, -2686, -3211, -3729, -4233, -4743, -5332, -4759, -4232, -3710, -3192, -2626, -2077, -1550,
+    -1055, -504, 55, 588, 1091, 1638, 2143, 2690, 3187, 3718, 4286, 4805, 5343, 4765, 4241, 3716,
+    3188, 2674, 2091, 1575, 1039, 530, -4, -547, -1084, -1607, -2155, -2641, -3210, -3717, -4278, -4815,
+    -5294, -4750, -4266, -3719, -3178, -2618, -2118, -1556, -1043, -478, 55, 545, 1126, 1651, 2143, 2656,
+    3225, 3734, 4282, 4795, 5309, 4807, 4267, 3714, 3166, 2676, 2145, 1572, 1074, 543, -1, -530,
+    -1051, -1629, -2152, -2703, -3195, -3739, -4283, -4794, -5307, -4780, -4252, -3693, -3192, -2658, -2122, -1571,
+    -1044, -507, 64, 596, 1089, 1605, 2176, 2712, 3235, 3785, 4295, 4790, 5356, 4813, 4241, 3754,
+    3219, 2672, 2117, 1577, 1066, 498, -26, -581, -1097, -1589, -2136, -2690, -3219, -3755, -4254, -4798,
+    -5308, -4771, -4279, -3698, -3192, -2645, -2121, -1547, -1063, -523, 10, 546, 1127, 1625, 2163, 2689,
+    3197, 3727, 4311, 4841, 5347, 4797, 4298, 3712, 3224, 2661, 2108, 1558, 1034, 522, -35, -563,
+    -1094, -1607, -2136, -2656, -3195, -3780, -4260, -4809, -5354, -4789, -4273, -3740, -3191, -2630, -2107, -1562,
+    -1011, -532, 59, 570, 1078, 1631, 2140, 2694, 3210, 3790, 4272, 4798, 5366, 4828, 4283, 3719,
+    3208, 2671, 2129, 1572, 1042, 529, 7, -556, -1120, -1605, -2150, -2706, -3235, -3738, -4262, -4814,
+    -5344, -4816, -4239, -3743, -3181, -2675, -2130, -1603, -1057, -512, 35, 567, 1090, 1621, 2152, 2723,
+    3223, 3774, 4334, 4864, 5380, 4804, 4276, 3737, 3223, 2676, 2150, 1577, 1067, 518, -15, -578,
+    -1109, -1655, -2176, -2698, -3235, -3746, -4320, -4823, -5370, -4822, -4292, -3725, -3222, -2669, -2129, -1608,
+    -1043, -478, 25, 594, 1091, 1655, 2145, 2714, 3256, 3770, 4287, 4837, 5386, 4825, 4285, 3778,
+    3203, 2672, 2159, 1623, 1042, 495, -29, -533, -1106, -1632, -2166, -2730, -3208, -3796, -4282, -4839,
+    -5360, -4816, -4309, -3739, -3234, -2667, -2090, -1598, -1024, -532, 6, 584, 1090, 1662, 2190, 2713,
+    3262, 3788, 4340, 4835, 5402, 4876, 4323, 3785, 3235, 2693, 2149, 1565, 1062, 549, -45, -551,
+    -1106, -1653, -2176, -2735, -3251, -3805, -4316, -4838, -5354, -4814, -4280, -3748, -3200, -2664, -2130, -1618,
+    -1065, -502, 58, 564, 1119, 1655, 2186, 2712, 3229, 3795, 4346, 4837, 5426, 4852, 4296, 3766,
+    3225, 2667, 2123, 1628, 1040, 491, -10, -562, -1101, -1630, -2185, -2732, -3218, -3776, -4323, -4826,
+    -5405, -4854, -4273, -3784, -3213, -2698, -2122, -1566, -1053, -535, 4, 603, 1141, 1648, 2164, 2723,
+    3249, 3778, 4342, 4863, 5376, 4867, 4293, 3774, 3249, 2674, 2156, 1570, 1050, 495, 8, -531,
+    -1110, -1660, -2173, -2709, -3267, -3809, -4335, -4848, -5383, -4851, -4326, -3780, -3221, -2649, -2101, -1615,
+    -1076, -497, 23, 553, 1136, 1651, 2190, 2720, 3298, 3831, 4369, 4882, 5445, 4863, 4349, 3756,
+    3221, 2706, 2138, 1616, 1060, 513, -39, -581, -1089, -1672, -2189, -2703, -3261, -3828, -4308, -4868,
+    -5398, -4836, -4333, -3756, -3253, -2694, -2142, -1606, -1034, -531, 36, 562, 1147, 1623, 2219, 2762,
+    3250, 3787, 4365, 4902, 5393, 4897, 4346, 3775, 3256, 2707, 2183, 1597, 1087, 501, -20, -532,
+    -1079, -1646, -2159, -2699, -3245, -3814, -4318, -4870, -5397, -4839, -4323, -3746, -3222, -2673, -2166, -1566,
+    -1069, -543, -1, 589, 1114, 1645, 2204, 2770, 3252, 3815, 4383, 4920, 5438, 4853, 4316, 3762,
+    3215, 2702, 2178, 1591, 1065, 526, 1, -573, -1109, -1677, -2213, -2747, -3295, -3814, -4345, -4897,
+    -5443, -4884, -4337, -3804, -3215, -2693, -2136, -1581, -1039, -521, 22, 568, 1124, 1647, 2218, 2759,
+    3289, 3829, 4365, 4921, 5423, 4903, 4346, 3787, 3271, 2682, 2132, 1639, 1080, 516, -9, -563,
+    -1141, -1623, -2220, -2748, -3262, -3811, -4331, -4907, -5440, -4897, -4371, -3760, -3216, -2726, -2126, -1615,
+    -1074, -508, 9, 555, 1117, 1690, 2181, 2728, 3305, 3858, 4371, 4933, 5455, 4930, 4362, 3779,
+    3266, 2705, 2131, 1631, 1045, 534, -21, -598, -1095, -1664, -2167, -2722, -3279, -3822, -4349, -4909,
+    -5472, -4929, -4379, -3782, -3260, -2703, -2174, -1607, -1035, -486, 50, 604, 1151, 1668, 2188, 2728,
+    3298, 3830, 4353, 4938, 5472, 4898, 4374, 3841, 3286, 2691, 2170, 1588, 1073, 499, -35, -595,
+    -1116, -1639, -2222, -2761, -3290, -3856, -4386, -4909, -5445, -4888, -4332, -3822, -3277, -2736, -2139, -1643,
+    -1070, -507, 3, 559, 1115, 1697, 2239, 2733, 3325, 3849, 4398, 4903, 5496, 4917, 4401, 3817,
+    3287, 2699, 2179, 1597, 1101, 515, -43, -557, -1127, -1693, -2174, -2722, -3290, -3841, -4380, -4932,
+    -5493, -4914, -4354, -3807, -3235, -2704, -2154, -1619, -1060, -527, 27, 565, 1131, 1660, 2247, 2744,
+    3336, 3825, 4376, 4928, 5468, 4917, 4389, 3839, 3289, 2698, 2193, 1599, 1067, 554, -47, -582,
+    -1088, -1642, -2218, -2733, -3309, -3867, -4383, -4935, -5473, -4944, -4370, -3843, -3249, -2698, -2134, -1631,
+    -1100, -502, 44, 573, 1144, 1702, 2243, 2769, 3320, 3857, 4394, 4921, 5521, 4957, 4414, 3808,
+    3266, 2747, 2192, 1633, 1071, 498, -12, -550, -1140, -1648, -2187, -2782, -3305, -3882, -4395, -4916,
+    -5499, -4914, -4365, -3827, -3247, -2704, -2153, -1600, -1071, -517, 5, 560, 1136, 1689, 2256, 2775,
+    3348, 3836, 4379, 4923, 5480, 4947, 4409, 3853, 3288, 2746, 2210, 1597, 1106, 533, -11, -561,
+    -31950, -32256, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32239,
+    -31903, -30392, 4708, 30986, 31995, 32274, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32258, 31952, 30724, -173, -30743, -31953, -32257, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32240, -31906, -30406, 4626, 30983, 31995, 32274, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32258, 31953, 30724, -219, -30752,
+    -31955, -32259, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32242,
+    -31909, -30422, 4547, 30986, 31996, 32275, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32259, 31954, 30725, -298, -30763, -31958, -32260, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32243, -31911, -30432, 4447, 30987, 31997, 32276, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32260, 31954, 30725, -430, -30773,
+    -31961, -32261, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32244,
+    -31914, -30448, 4406, 30988, 31998, 32276, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32260, 31955, 30727, -474, -30784, -31963, -32262, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32246, -31916, -30461, 4362, 30989, 31999, 32277, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32261, 31956, 30729, -592, -30792,
+    -31965, -32264, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32247,
+    -31919, -30474, 4283, 30988, 32000, 32278, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32262, 31957, 30727, -624, -30803, -31967, -32265, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32248, -31922, -30482, 4196, 30991, 32001, 32278, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32262, 31958, 30727, -675, -30811,
+    -31970, -32266, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32250,
+    -31924, -30492, 4165, 30990, 32002, 32279, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32263, 31959, 30731, -751, -30820, -31972, -32268, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32251, -31927, -30503, 4058, 30993, 32003, 32280, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32264, 31960, 30730, -867, -30828,
+    -31975, -32269, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32252,
+    -31929, -30516, 4009, 30992, 32004, 32281, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32265, 31961, 30733, -877, -30835, -31977, -32270, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32253, -31931, -30528, 3990, 30996, 32005, 32281, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32265, 31962, 30735, -978, -30844,
+    -31979, -32271, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32255,
+    -31933, -30536, 3938, 30996, 32006, 32282, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32266, 31963, 30735, -991, -30852, -31981, -32272, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32256, -31936, -30546, 3885, 30999, 32007, 32283, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32267, 31965, 30738, -1062, -30858,
+    -31983, -32273, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32257,
+    -31938, -30556, 3817, 31000, 32008, 32284, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32268, 31966, 30741, -1131, -30869, -31985, -32274, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32258, -31941, -30567, 3817, 31002, 32009, 32284, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32268, 31967, 30741, -1156, -30875,
+    -31987, -32276, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32259,
+    -31943, -30574, 3721, 31003, 32010, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32269, 31968, 30745, -1256, -30884, -31989, -32277, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32260, -31945, -30586, 3684, 31006, 32011, 32285, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32270, 31969, 30746, -1301, -30888,
+    -31991, -32278, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32261,
+    -31947, -30594, 3643, 31007, 32012, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32271, 31970, 30750, -1330, -30896, -31993, -32279, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32263, -31949, -30605, 3610, 31009, 32013, 32285, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32271, 31972, 30752, -1407, -30902,
+    -31995, -32280, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32264,
+    -31951, -30610, 3556, 31013, 32015, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32272, 31972, 30755, -1405, -30908, -31997, -32281, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32265, -31953, -30618, 3513, 31014, 32016, 32285, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32273, 31974, 30754, -1479, -30918,
+    -31999, -32282, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32266,
+    -31955, -30629, 3533, 31016, 32017, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32274, 31975, 30759, -1494, -30924, -32001, -32283, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32267, -31957, -30636, 3447, 31018, 32018, 32285, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32275, 31976, 30763, -1559, -30930,
+    -32003, -32284, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32268,
+    -31959, -30644, 3461, 31022, 32019, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32275, 31978, 30763, -1584, -30935, -32004, -32285, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32269, -31961, -30651, 3440, 31025, 32020, 32285, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32270, 31968, 30732, -1579, -30907,
+    -31993, -32278, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32254,
+    -31935, -30560, 3270, 30948, 31993, 32275, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32251, 31935, 30624, -1573, -30812, -31961, -32259, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32234, -31900, -30446, 3134, 30853, 31960, 32255, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32230, 31899, 30503, -1550, -30708,
+    -31927, -32239, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32213,
+    -31862, -30312, 3028, 30745, 31924, 32234, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32208, 31859, 30365, -1536, -30595, -31890, -32217, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32189, -31820, -30166, 2891, 30629, 31885, 32211, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32183, 31816, 30216, -1512, -30468,
+    -31849, -32193, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32163,
+    -31775, -29995, 2744, 30498, 31842, 32186, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32156, 31769, 30043, -1497, -30321, -31803, -32166, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32135, -31725, -29804, 2622, 30345, 31796, 32159, 32285, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32127, 31716, 29842, -1442, -30160,
+    -31754, -32137, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32104,
+    -31669, -29580, 2464, 30175, 31744, 32129, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32285, 32095, 31658, 29618, -1411, -29968, -31699, -32106, -32285, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32269, -32070, -31608, -29324, 2351, 29982, 31686, 32096, 32279, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32261, 32059, 31593, 29351, -1353, -29749,
+    -31637, -32071, -32263, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32244, -32033,
+    -31538, -29026, 2238, 29753, 31622, 32059, 32254, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32233, 32019, 31520, 29040, -1325, -29496, -31568, -32032, -32236, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32215, -31990, -31460, -28669, 2134, 29489, 31548, 32018, 32225, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32203, 31975, 31437, 28671, -1281, -29191,
+    -31490, -31988, -32206, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32183, -31943,
+    -31370, -28235, 1972, 29172, 31466, 31972, 32194, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32285, 32169, 31925, 31343, 28207, -1219, -28824, -31401, -31939, -32172, -32285, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32285, -32147, -31889, -31269, -27694, 1858, 28780, 31372, 31920, 32158, 32285,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32276, 32131, 31868, 31235, 27642, -1164, -28380,
+    -31297, -31883, -32134, -32274, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32258, -32106, -31828,
+    -31151, -26990, 1765, 28306, 31262, 31860, 32117, 32260, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32285, 32243, 32088, 31803, 31109, 26897, -1115, -27820, -31179, -31820, -32091, -32241, -32285, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32285, -32223, -32060, -31758, -31012, -26087, 1660, 27699, 31134, 31792, 32071, 32225,
+    32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32207, 32039, 31728, 30959, 25927, -1073, -27083,
+    -31038, -31745, -32041, -32204, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32184, -32007, -31677,
+    -30848, -24836, 1528, 26896, 30983, 31713, 32018, 32185, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32279, 32164, 31981, 31640, 30783, 24534, -997, -26084, -30871, -31659, -31983, -32160, -32272, -32285, -32285, -32285,
+    -32285, -32285, -32285, -32285, -32258, -32138, -31944, -31581, -30649, -23262, 1425, 25808, 30799, 31619, 31956, 32139,
+    32254, 32285, 32285, 32285, 32285, 32285, 32285, 32285, 32240, 32115, 31914, 31536, 30566, 22899, -930, -24671,
+    -30666, -31556, -31916, -32110, -32231, -32285, -32285, -32285, -32285, -32285, -32285, -32285, -32216, -32084, -31871, -31467,
+    -30404, -21665, 1320, 24206, 30575, 31508, 31882, 32084, 32211, 32285, 32285, 32285, 32285, 32285, 32285, 32285,
+    32194, 32057, 31835, 31411, 30295, 21255, -898, -22938, -30412, -31433, -31835, -32050, -32184, -32275, -32285, -32285,
+    -32285, -32285, -32285, -32265, -32166, -32021, -31783, -31328, -30093, -20087, 1233, 22431, 30294, 31372, 31794, 32019,
+    32159, 32255, 32285, 32285, 32285, 32285, 32285, 32243, 32140, 31988, 31738, 31259, 29948, 19629, -817, -21184,
+    -30089, -31282, -31738, -31979, -32128, -32229, -32285, -32285, -32285, -32285, -32285, -32216, -32107, -31944, -31677, -31155,
+    -29692, -18484, 1131, 20629, 29930, 31204, 31687, 31941, 32097, 32203, 32280, 32285, 32285, 32285, 32273, 32190,
+    32075, 31903, 31620, 31066, 29490, 18010, -768, -19418, -29660, -31092, -31618, -31891, -32059, -32172, -32254, -32285,
+    -32285, -32285, -32246, -32158, -32034, -31850, -31544, -30936, -29146, -16899, 1022, 18822, 29438, 30991, 31553, 31844,
+    32021, 32141, 32227, 32285, 32285, 32285, 32218, 32125, 31994, 31798, 31472, 30819, 28856, 16370, -694, -17662,
+    -29071, -30845, -31466, -31782, -31974, -32102, -32194, -32264, -32285, -32260, -32185, -32085, -31944, -31732, -31374, -30648,
+    -28366, -15300, 913, 17034, 28744, 30709, 31381, 31721, 31925, 32062, 32160, 32234, 32285, 32230, 32150, 32043,
+    31892, 31664, 31278, 30486, 27916, 14749, -642, -15907, -28205, -30514, -31268, -31642, -31865, -32014, -32119, -32199,
+    -32260, -32194, -32108, -31992, -31828, -31578, -31150, -30252, -27156, -13717, 815, 15253, 27678, 30320, 31152, 31560,
+    31802, 31962, 32076, 32161, 32227, 32155, 32062, 31937, 31759, 31487, 31018, 30017, 26387, 13109, -576, -14154,
+    -26809, -30044, -30998, -31454, -31722, -31898, -32022, -32115, -32186, -32108, -32007, -31869, -31673, -31370, -30840, -29675,
+    -25034, -12112, 721, 13454, 25859, 29752, 30833, 31341, 31635, 31828, 31963, 32064, 32142, 32057, 31946, 31795,
+    31579, 31243, 30647, 29304, 23575, 11492, -499, -12389, -24190, -29326, -30611, -31193, -31525, -31740, -31890, -32002,
+    -32087, -31993, -31870, -31702, -31458, -31075, -30382, -28753, -21768, -10519, 617, 11665, 22619, 28840, 30357, 31025,
+    31400, 31640, 31807, 31930, 32025, 31920, 31783, 31595, 31320, 30882, 30076, 28092, 20256, 9869, -437, -10633,
+    -20743, -28097, -30004, -30800, -31236, -31512, -31702, -31841, -31947, -31828, -31672, -31456, -31138, -30621, -29640, -27042,
+    -18468, -8921, 518, 9870, 19134, 27139, 29569, 30527, 31040, 31359, 31576, 31734, 31853, 31719, 31540, 31289,
+    30916, 30299, 29083, 25583, 16933, 8239, -361, -8874, -17289, -25497, -28923, -30145, -30772, -31154, -31410, -31594,
+    -8452, -7591, -6729, -5870, -5017, -4164, -3323, -2469, -1627, -788, 63, 897, 1731, 2574, 3400, 4233,
+    5069, 5896, 6722, 7540, 8366, 7516, 6672, 5819, 4985, 4141, 3309, 2469, 1632, 809, -26, -851,
+    -1679, -2498, -3320, -4139, -4953, -5767, -6581, -7400, -8203, -7367, -6541, -5701, -4877, -4054, -3222, -2406,
+    -1582, -756, 56, 869, 1683, 2499, 3302, 4111, 4920, 5718, 6521, 7323, 8121, 7293, 6473, 5651,
+    4831, 4017, 3207, 2393, 1587, 784, -19, -826, -1622, -2428, -3223, -4020, -4814, -5597, -6386, -7181,
+    -7967, -7151, -6339, -5540, -4732, -3931, -3133, -2330, -1537, -743, 53, 842, 1634, 2416, 3204, 3985,
+    4771, 5543, 6322, 7101, 7869, 7073, 6280, 5484, 4692, 3899, 3115, 2329, 1541, 762, -27, -800,
+    -1575, -2357, -3129, -3896, -4665, -5435, -6191, -6956, -7716, -6932, -6152, -5369, -4592, -3804, -3032, -2260,
+    -1488, -712, 53, 820, 1585, 2345, 3108, 3865, 4619, 5377, 6131, 6880, 7624, 6853, 6081, 5313,
+    4546, 3776, 3008, 2251, 1487, 738, -23, -776, -1527, -2280, -3031, -3776, -4519, -5260, -6005, -6737,
+    -7475, -6712, -5960, -5198, -4442, -3687, -2937, -2184, -1445, -697, 48, 793, 1531, 2272, 3002, 3736,
+    4470, 5199, 5927, 6658, 7381, 6629, 5886, 5138, 4396, 3658, 2911, 2173, 1438, 708, -27, -757,
+    -1478, -2206, -2929, -3653, -4369, -5091, -5809, -6516, -7234, -6494, -5764, -5030, -4295, -3568, -2842, -2113,
+    -1389, -676, 45, 764, 1481, 2191, 2903, 3613, 4327, 5027, 5729, 6439, 7131, 6411, 5692, 4964,
+    4246, 3532, 2822, 2109, 1394, 687, -25, -723, -1427, -2134, -2836, -3527, -4225, -4916, -5613, -6304,
+    -6990, -6277, -5566, -4859, -4151, -3449, -2746, -2048, -1342, -646, 48, 734, 1430, 2122, 2810, 3488,
+    4177, 4857, 5540, 6216, 6892, 6193, 5495, 4794, 4101, 3407, 2723, 2028, 1343, 659, -21, -702,
+    -1386, -2062, -2732, -3412, -4080, -4747, -5417, -6079, -6745, -6057, -5370, -4686, -4011, -3326, -2654, -1972,
+    -1300, -624, 47, 712, 1378, 2041, 2708, 3368, 4027, 4688, 5335, 5992, 6644, 5970, 5300, 4624,
+    3952, 3286, 2625, 1956, 1293, 640, -21, -675, -1330, -1989, -2634, -3283, -3932, -4577, -5221, -5862,
+    -6502, -5842, -5178, -4517, -3859, -3209, -2553, -1900, -1253, -603, 39, 688, 1329, 1967, 2603, 3243,
+    3876, 4511, 5147, 5772, 6401, 5748, 5101, 4456, 3813, 3170, 2521, 1882, 1248, 609, -21, -656,
+    -1284, -1910, -2542, -3162, -3782, -4410, -5029, -5644, -6256, -5624, -4983, -4349, -3719, -3086, -2455, -1830,
+    -1207, -579, 38, 663, 1276, 1893, 2509, 3121, 3729, 4339, 4950, 5552, 6151, 5526, 4908, 4285,
+    3659, 3047, 2428, 1815, 1202, 586, -21, -625, -1238, -1842, -2438, -3043, -3635, -4234, -4830, -5421,
+    -6014, -5404, -4789, -4181, -3575, -2966, -2364, -1758, -1162, -559, 39, 636, 1227, 1819, 2411, 2996,
+    3583, 4170, 4749, 5330, 5911, 5306, 4711, 4113, 3514, 2920, 2330, 1737, 1150, 561, -22, -605,
+    -1183, -1766, -2339, -2922, -3493, -4063, -4634, -5202, -5775, -5184, -4597, -4010, -3429, -2848, -2264, -1689,
+    -1115, -540, 35, 605, 1176, 1741, 2306, 2873, 3434, 3994, 4551, 5112, 5667, 5086, 4513, 3942,
+    3367, 2803, 2234, 1668, 1106, 543, -20, -576, -1134, -1691, -2247, -2796, -3345, -3891, -4444, -4983,
+    -5530, -4963, -4400, -3839, -3282, -2722, -2173, -1616, -1065, -511, 32, 582, 1122, 1671, 2208, 2751,
+    3289, 3823, 4358, 4890, 5418, 4866, 4319, 3768, 3223, 2676, 2136, 1595, 1057, 519, -22, -552,
+    -1089, -1615, -2144, -2671, -3197, -3725, -4242, -4766, -5284, -4743, -4210, -3671, -3136, -2605, -2071, -1547,
+    -1019, -495, 31, 551, 1071, 1595, 2111, 2624, 3139, 3652, 4161, 4672, 5175, 4649, 4125, 3599,
+    3077, 2557, 2038, 1520, 1008, 496, -17, -527, -1039, -1546, -2051, -2553, -3054, -3550, -4049, -4543,
+    -5040, -4523, -4016, -3501, -2989, -2482, -1976, -1473, -969, -470, 33, 527, 1025, 1517, 2013, 2501,
+    2988, 3476, 3963, 4450, 4930, 4427, 3924, 3430, 2929, 2436, 1938, 1448, 958, 470, -16, -504,
+    -990, -1468, -1947, -2430, -2903, -3380, -3852, -4326, -4796, -4306, -3821, -3329, -2849, -2363, -1881, -1403,
+    -923, -447, 31, 501, 976, 1446, 1914, 2381, 2844, 3309, 3766, 4225, 4683, 4207, 3730, 3258,
+    2783, 2316, 1843, 1377, 909, 445, -16, -477, -936, -1397, -1853, -2304, -2757, -3211, -3659, -4109,
+    -4554, -4089, -3624, -3164, -2700, -2244, -1786, -1332, -879, -425, 25, 474, 922, 1366, 1810, 2253,
+    2697, 3131, 3570, 4007, 4439, 3987, 3535, 3087, 2638, 2193, 1746, 1304, 862, 423, -16, -451,
+    -890, -1320, -1755, -2182, -2610, -3042, -3462, -3889, -4310, -3867, -3431, -2990, -2556, -2120, -1688, -1261,
+    -831, -401, 26, 449, 870, 1291, 1713, 2132, 2547, 2964, 3372, 3787, 4197, 3768, 3342, 2913,
+    2492, 2067, 1649, 1229, 814, 397, -16, -430, -841, -1250, -1656, -2064, -2463, -2867, -3267, -3669,
+    -4068, -3650, -3236, -2820, -2409, -2000, -1592, -1188, -782, -381, 25, 425, 822, 1220, 1616, 2009,
+    2401, 2790, 3181, 3564, 3951, 3548, 3143, 2743, 2347, 1947, 1553, 1156, 764, 372, -14, -402,
+    -788, -1175, -1560, -1937, -2320, -2697, -3071, -3448, -3824, -3429, -3042, -2654, -2265, -1878, -1497, -1114,
+    -736, -357, 23, 395, 771, 1145, 1513, 1885, 2251, 2618, 2982, 3344, 3706, 3329, 2950, 2576,
+    2200, 1826, 1454, 1083, 715, 349, -12, -377, -740, -1101, -1458, -1814, -2172, -2527, -2879, -3230,
+    -3578, -3211, -2845, -2483, -2119, -1757, -1401, -1041, -685, -334, 18, 369, 719, 1070, 1417, 1760,
+    2103, 2444, 2787, 3126, 3460, 3107, 2754, 2403, 2054, 1704, 1358, 1015, 669, 328, -14, -352,
+    -688, -1025, -1360, -1693, -2027, -2354, -2681, -3011, -3334, -2993, -2651, -2311, -1973, -1638, -1302, -972,
+    -639, -311, 18, 346, 670, 992, 1315, 1638, 1956, 2272, 2592, 2906, 3217, 2886, 2558, 2233,
+    1909, 1585, 1262, 938, 621, 301, -12, -327, -640, -950, -1263, -1570, -1876, -2184, -2486, -2788,
+    -3090, -2774, -2459, -2143, -1830, -1519, -1207, -899, -592, -285, 19, 320, 621, 920, 1217, 1516,
+    1809, 2101, 2395, 2685, 2973, 2667, 2362, 2062, 1760, 1460, 1166, 866, 574, 281, -11, -304,
+    -592, -877, -1163, -1449, -1732, -2013, -2292, -2569, -2845, -2552, -2262, -1973, -1683, -1397, -1110, -827,
+    -546, -264, 14, 293, 569, 843, 1118, 1390, 1661, 1931, 2199, 2465, 2727, 2449, 2168, 1891,
+    1614, 1339, 1066, 794, 525, 257, -12, -278, -540, -804, -1065, -1326, -1585, -1841, -2095, -2349,
+    -2604, -2336, -2066, -1802, -1538, -1275, -1016, -757, -499, -240, 14, 268, 521, 771, 1019, 1266,
+    1514, 1758, 2002, 2243, 2484, 2228, 1972, 1721, 1468, 1219, 970, 724, 477, 233, -11, -252,
+    -491, -729, -967, -1204, -1438, -1670, -1902, -2132, -2360, -2116, -1871, -1632, -1394, -1153, -919, -683,
+    -451, -218, 11, 241, 470, 695, 921, 1145, 1367, 1586, 1805, 2023, 2240, 2009, 1778, 1550,
+    1322, 1098, 877, 654, 432, 211, -9, -231, -452, -672, -893, -1113, -1333, -1554, -1773, -1992,
+    -2211, -1989, -1766, -1542, -1319, -1097, -875, -652, -431, -210, 12, 232, 455, 675, 894, 1114,
+    1336, 1556, 1774, 1995, 2213, 1991, 1766, 1545, 1321, 1098, 876, 656, 434, 212, -9, -231,
+    -450, -673, -894, -1114, -1333, -1553, -1774, -1992, -2210, -1987, -1765, -1540, -1318, -1097, -874, -654,
+    -432, -209, 12, 232, 455, 676, 896, 1116, 1335, 1554, 1773, 1995, 2212, 1989, 1767, 1544,
+    1322, 1099, 878, 654, 434, 211, -10, -232, -452, -673, -893, -1113, -1333, -1552, -1771, -1993,
+    -2210, -1988, -1766, -1543, -1319, -1098, -875, -651, -431, -208, 11, 234, 453, 675, 896, 1115,
+    1336, 1554, 1775, 1994, 2212, 1989, 1768, 1543, 1321, 1098, 876, 654, 432, 212, -9, -232,
+    -452, -673, -894, -1114, -1334, -1553, -1773, -1992, -2211, -1988, -1765, -1541, -1318, -1097, -876, -652,
+    -431, -211, 11, 234, 455, 676, 896, 1114, 1335, 1556, 1775, 1994, 2214, 1990, 1765, 1543,
+    1322, 1100, 877, 656, 434, 213, -11, -230, -452, -672, -894, -1112, -1334, -1553, -1772, -1993,
+    -2210, -1988, -1764, -1541, -1319, -1096, -876, -653, -431, -209, 11, 234, 455, 674, 894, 1115,
+    1334, 1556, 1775, 1993, 2214, 1991, 1767, 1544, 1322, 1098, 876, 654, 432, 211, -10, -232,
+    -453, -671, -893, -1113, -1332, -1554, -1773, -1993, -2211, -1989, -1763, -1543, -1321, -1097, -875, -651,
+    -432, -211, 12, 231, 452, 675, 895, 1116, 1335, 1554, 1774, 1994, 2214, 1990, 1765, 1544,
+    1320, 1100, 877, 654, 434, 211, -9, -232, -452, -673, -893, -1114, -1334, -1554, -1771, -1992,
+    -2212, -1987, -1764, -1541, -1320, -1096, -875, -652, -432, -210, 11, 233, 455, 674, 893, 1116,
+    1334, 1556, 1774, 1995, 2213, 1990, 1767, 1545, 1322, 1098, 877, 655, 434, 210, -10, -231,
+    -451, -672, -892, -1114, -1332, -1552, -1774, -1993, -2213, -1988, -1765, -1543, -1319, -1096, -876, -654,
+    -431, -210, 11, 234, 453, 674, 894, 1115, 1336, 1554, 1776, 1994, 2212, 1988, 1766, 1545,
+    1321, 1097, 875, 656, 433, 213, -11, -232, -451, -673, -894, -1112, -1332, -1554, -1772, -1993,
+    -2210, -1987, -1764, -1543, -1319, -1098, -876, -654, -431, -210, 12, 234, 454, 674, 894, 1115,
+    1335, 1554, 1773, 1994, 2214, 1988, 1768, 1545, 1321, 1098, 877, 656, 433, 213, -11, -232,
+    -453, -672, -894, -1114, -1334, -1554, -1771, -1993, -2212, -1987, -1766, -1542, -1318, -1098, -876, -654,
+    -433, -208, 10, 234, 454, 674, 893, 1115, 1336, 1553, 1774, 1993, 2214, 1991, 1766, 1544,
+    1321, 1100, 876, 654, 433, 211, -9, -231, -453, -674, -893, -1112, -1335, -1554, -1772, -1991,
+    -2210, -1989, -1766, -1541, -1318, -1097, -876, -654, -431, -210, 12, 231, 455, 675, 896, 1114,
+    1334, 1554, 1774, 1994, 2213, 1991, 1768, 1543, 1321, 1099, 875, 656, 433, 210, -10, -231,
+    -452, -673, -892, -1112, -1332, -1553, -1774, -1993, -2211, -1987, -1764, -1543, -1319, -1099, -875, -652,
+    -431, -210, 13, 234, 454, 674, 894, 1113, 1335, 1554, 1775, 1992, 2214, 1989, 1767, 1544,
+    1320, 1098, 878, 654, 434, 212, -9, -232, -451, -673, -893, -1113, -1334, -1553, -1771, -1992,
+    -2211, -1988, -1764, -1543, -1319, -1097, -876, -653, -431, -209, 11, 233, 453, 674, 894, 1115,
+    1335, 1555, 1774, 1992, 2214, 1988, 1768, 1542, 1320, 1097, 876, 655, 434, 211, -9, -231,
+    -452, -673, -893, -1114, -1332, -1554, -1772, -1994, -2213, -1987, -1764, -1543, -1319, -1096, -875, -653,
+    -430, -210, 12, 233, 452, 673, 893, 1115, 1335, 1553, 1775, 1993, 2213, 1988, 1766, 1542,
+    1320, 1098, 875, 654, 432, 211, -11, -230, -452, -672, -893, -1114, -1335, -1553, -1773, -1993,
+    -2212, -1989, -1765, -1543, -1319, -1097, -876, -653, -431, -211, 12, 232, 453, 673, 895, 1115,
+    1336, 1555, 1773, 1993, 2213, 1990, 1766, 1542, 1322, 1099, 876, 654, 433, 211, -9, -232,
+    -452, -672, -892, -1114, -1335, -1553, -1774, -1993, -2212, -1988, -1766, -1541, -1320, -1097, -875, -652,
+    -432, -210, 12, 232, 453, 674, 894, 1115, 1334, 1554, 1774, 1993, 2213, 1988, 1766, 1544,
+    1321, 1099, 875, 655, 431, 212, -10, -232, -451, -672, -895, -1114, -1335, -1552, -1772, -1992,
+    -2211, -1989, -1765, -1542, -1320, -1099, -876, -653, -432, -210, 11, 233, 453, 675, 895, 1114,
+    1336, 1555, 1774, 1994, 2212, 1990, 1766, 1544, 1322, 1097, 875, 654, 432, 210, -9, -230,
+    -451, -674, -894, -1114, -1333, -1555, -1772, -1992, -2212, -1990, -1765, -1542, -1321, -1099, -875, -653,
+    -432, -211, 11, 233, 454, 673, 895, 1115, 1334, 1553, 1775, 1994, 2212, 1990, 1765, 1544,
+    1321, 1098, 877, 654, 433, 209, -11, -233, -454, -672, -894, -1113, -1335, -1554, -1773, -1994,
+    -2213, -1988, -1766, -1543, -1321, -1097, -875, -654, -432, -210, 10, 231, 454, 673, 894, 1115,
+    1336, 1555, 1775, 1993, 2212, 1989, 1765, 1544, 1322, 1097, 876, 653, 433, 211, -12, -231,
+    -451, -672, -893, -1114, -1335, -1553, -1773, -1992, -2212, -1989, -1766, -1544, -1320, -1099, -876, -652,
+    -432, -209, 10, 231, 452, 673, 895, 1114, 1335, 1554, 1774, 1994, 2211, 1990, 1765, 1542,
+    1320, 1098, 876, 654, 432, 210, -12, -232, -452, -672, -894, -1113, -1334, -1552, -1774, -1993,
+    -2212, -1987, -1764, -1542, -1321, -1098, -876, -654, -433, -211, 10, 232, 454, 673, 893, 1114,
+    1334, 1554, 1774, 1993, 2211, 1990, 1766, 1544, 1320, 1099, 875, 655, 432, 211, -11, -232,
+    -451, -672, -892, -1113, -1335, -1554, -1773, -1993, -2212, -1988, -1766, -1543, -1320, -1099, -876, -653,
+    -432, -210, 12, 232, 454, 674, 896, 1115, 1334, 1555, 1774, 1993, 2213, 1988, 1765, 1542,
+    1319, 1100, 875, 654, 431, 210, -12, -231, -452, -674, -893, -1113, -1334, -1554, -1773, -1993,
+    -2213, -1987, -1765, -1543, -1320, -1097, -875, -652, -432, -210, 11, 233, 452, 673, 894, 1115,
+    1335, 1554, 1775, 1993, 2213, 1988, 1767, 1543, 1321, 1098, 875, 654, 431, 210, -11, -233,
+    -454, -674, -893, -1114, -1335, -1553, -1773, -1994, -2212, -1989, -1765, -1542, -1320, -1099, -876, -653,
+    -431, -209, 12, 232, 454, 675, 893, 1115, 1336, 1555, 1775, 1992, 2213, 1989, 1766, 1543,
+    1321, 1098, 875, 654, 432, 209, -10, -233, -452, -673, -895, -1115, -1334, -1553, -1774, -1994,
+    -2211, -1988, -1765, -1543, -1320, -1097, -875, -653, -431, -209, 11, 232, 454, 675, 894, 1114,
+    1335, 1554, 1775, 1992, 2212, 1990, 1766, 1543, 1320, 1098, 876, 655, 431, 211, -11, -231,
+    -451, -673, -893, -1115, -1334, -1554, -1772, -1994, -2212, -1988, -1766, -1542, -1321, -1099, -874, -653,
+    -7771, -3870, 25, 3914, 7803, 11686, 15563, 19439, 23314, 26474, 26458, 26442, 26426, 26411, 26395, 26379,
+    23106, 19193, 15281, 11375, 7475, 3575, -318, -4210, -8095, -11979, -15860, -19733, -23606, -26716, -26734, -26719,
+    -26705, -26690, -26675, -26628, -23395, -19482, -15571, -11664, -7762, -3864, 31, 3921, 7810, 11692, 15573, 19447,
+    23319, 26477, 26462, 26447, 26430, 26415, 26399, 26383, 23111, 19197, 15288, 11384, 7482, 3581, -312, -4202,
+    -8091, -11973, -15852, -19729, -23598, -26713, -26731, -26716, -26701, -26687, -26672, -26624, -23388, -19475, -15564, -11658,
+    -7755, -3858, 36, 3928, 7817, 11698, 15579, 19453, 23326, 26481, 26466, 26450, 26435, 26418, 26403, 26387,
+    23118, 19204, 15295, 11391, 7487, 3590, -305, -4197, -8082, -11966, -15844, -19721, -23593, -26710, -26727, -26712,
+    -26698, -26683, -26668, -26620, -23381, -19467, -15559, -11653, -7750, -3850, 44, 3936, 7822, 11704, 15586, 19459,
+    23333, 26485, 26470, 26454, 26438, 26423, 26406, 26391, 23123, 19210, 15302, 11395, 7493, 3594, -298, -4188,
+    -8076, -11959, -15839, -19715, -23585, -26706, -26724, -26709, -26694, -26679, -26665, -26617, -23377, -19462, -15551, -11646,
+    -7743, -3845, 48, 3942, 7828, 11711, 15592, 19468, 23337, 26489, 26473, 26458, 26442, 26426, 26410, 26394,
+    23132, 19218, 15307, 11400, 7501, 3600, -294, -4184, -8070, -11955, -15832, -19707, -23580, -26702, -26720, -26706,
+    -26691, -26677, -26662, -26612, -23371, -19458, -15547, -11641, -7739, -3838, 54, 3945, 7832, 11716, 15598, 19474,
+    23343, 26492, 26477, 26461, 26445, 26430, 26414, 26398, 23139, 19225, 15313, 11408, 7505, 3608, -286, -4177,
+    -8063, -11948, -15828, -19704, -23573, -26698, -26717, -26702, -26688, -26673, -26658, -26609, -23364, -19452, -15540, -11635,
+    -7732, -3834, 61, 3953, 7840, 11723, 15601, 19479, 23350, 26496, 26480, 26464, 26449, 26433, 26417, 26402,
+    23143, 19229, 15320, 11414, 7510, 3614, -280, -4173, -8060, -11943, -15822, -19697, -23570, -26695, -26714, -26700,
+    -26685, -26670, -26656, -26606, -23360, -19446, -15537, -11630, -7728, -3826, 66, 3959, 7845, 11729, 15608, 19483,
+    23357, 26499, 26483, 26467, 26452, 26436, 26420, 26405, 23146, 19233, 15326, 11419, 7516, 3617, -277, -4168,
+    -8056, -11936, -15816, -19693, -23565, -26694, -26711, -26697, -26682, -26667, -26652, -26604, -23354, -19440, -15530, -11623,
+    -7721, -3822, 71, 3961, 7848, 11734, 15612, 19487, 23361, 26501, 26486, 26471, 26455, 26439, 26423, 26408,
+    23154, 19241, 15328, 11425, 7521, 3622, -272, -4164, -8048, -11933, -15810, -19689, -23559, -26691, -26708, -26694,
+    -26679, -26664, -26649, -26600, -23348, -19433, -15524, -11619, -7716, -3819, 76, 3969, 7856, 11739, 15616, 19493,
+    23364, 26504, 26489, 26474, 26458, 26442, 26426, 26411, 23159, 19243, 15334, 11429, 7527, 3627, -267, -4156,
+    -8044, -11928, -15807, -19684, -23555, -26687, -26706, -26691, -26677, -26662, -26647, -26598, -23342, -19428, -15519, -11614,
+    -7711, -3813, 81, 3974, 7859, 11743, 15624, 19497, 23370, 26507, 26492, 26476, 26461, 26445, 26429, 26414,
+    23163, 19249, 15340, 11435, 7531, 3632, -263, -4154, -8040, -11922, -15801, -19676, -23548, -26685, -26704, -26689,
+    -26674, -26659, -26644, -26596, -23340, -19427, -15517, -11610, -7705, -3808, 85, 3977, 7864, 11748, 15627, 19502,
+    23375, 26510, 26494, 26479, 26464, 26448, 26432, 26416, 23166, 19255, 15343, 11437, 7537, 3636, -258, -4147,
+    -8035, -11918, -15796, -19672, -23543, -26683, -26701, -26686, -26672, -26657, -26642, -26593, -23335, -19421, -15510, -11604,
+    -7703, -3805, 91, 3983, 7870, 11751, 15630, 19507, 23380, 26513, 26497, 26481, 26466, 26451, 26435, 26419,
+    23171, 19257, 15347, 11442, 7541, 3641, -254, -4142, -8029, -11914, -15794, -19670, -23539, -26680, -26699, -26684,
+    -26669, -26654, -26639, -26591, -23331, -19418, -15506, -11599, -7698, -3801, 94, 3986, 7874, 11758, 15637, 19513,
+    23385, 26515, 26500, 26484, 26469, 26453, 26438, 26421, 23174, 19263, 15353, 11447, 7544, 3646, -248, -4138,
+    -8027, -11910, -15790, -19665, -23537, -26678, -26696, -26682, -26667, -26652, -26637, -26589, -23326, -19413, -15501, -11595,
+    -7692, -3794, 99, 3991, 7878, 11761, 15639, 19516, 23389, 26518, 26502, 26487, 26471, 26455, 26440, 26424,
+    23180, 19266, 15356, 11452, 7549, 3649, -244, -4137, -8022, -11905, -15786, -19660, -23531, -26675, -26694, -26679,
+    -26664, -26649, -26635, -26585, -23323, -19407, -15499, -11593, -7689, -3793, 104, 3994, 7882, 11766, 15646, 19520,
+    23390, 26520, 26504, 26489, 26473, 26458, 26442, 26426, 23184, 19270, 15361, 11455, 7553, 3655, -241, -4130,
+    -8018, -11901, -15781, -19656, -23527, -26673, -26692, -26677, -26662, -26647, -26633, -26583, -23319, -19403, -15493, -11587,
+    -7687, -3789, 107, 3999, 7885, 11770, 15648, 19523, 23396, 26522, 26507, 26491, 26476, 26460, 26444, 26429,
+    23187, 19273, 15364, 11460, 7555, 3657, -236, -4127, -8016, -11898, -15776, -19653, -23524, -26671, -26690, -26675,
+    -26660, -26645, -26630, -26582, -23313, -19399, -15490, -11584, -7682, -3785, 111, 4001, 7888, 11771, 15652, 19528,
+    23398, 26524, 26509, 26493, 26478, 26462, 26447, 26431, 23192, 19279, 15367, 11463, 7560, 3663, -233, -4124,
+    -8010, -11893, -15772, -19651, -23522, -26669, -26688, -26673, -26658, -26643, -26628, -26579, -23311, -19398, -15488, -11579,
+    -7680, -3780, 113, 4006, 7893, 11777, 15656, 19530, 23404, 26526, 26511, 26496, 26480, 26464, 26448, 26433,
+    23194, 19282, 15372, 11465, 7562, 3664, -229, -4120, -8008, -11889, -15770, -19646, -23517, -26668, -26686, -26671,
+    -26656, -26642, -26626, -26577, -23307, -19392, -15483, -11579, -7674, -3778, 117, 4009, 7896, 11781, 15657, 19534,
+    23407, 26528, 26513, 26497, 26482, 26466, 26451, 26435, 23199, 19285, 15374, 11470, 7568, 3669, -227, -4116,
+    -8005, -11886, -15768, -19641, -23514, -26665, -26684, -26669, -26654, -26639, -26625, -26576, -23304, -19390, -15480, -11573,
+    -7673, -3772, 121, 4011, 7900, 11781, 15662, 19538, 23411, 26530, 26515, 26499, 26484, 26469, 26453, 26437,
+    23201, 19289, 15378, 11472, 7571, 3670, -224, -4112, -8002, -11883, -15763, -19640, -23512, -26664, -26682, -26668,
+    -26653, -26638, -26622, -26573, -23299, -19388, -15477, -11570, -7669, -3771, 124, 4017, 7904, 11787, 15666, 19541,
+    23412, 26532, 26517, 26501, 26486, 26470, 26454, 26439, 23204, 19290, 15382, 11474, 7572, 3675, -221, -4112,
+    -7998, -11881, -15760, -19636, -23509, -26662, -26680, -26666, -26651, -26636, -26621, -26571, -23299, -19384, -15475, -11570,
+    -7665, -3768, 127, 4017, 7906, 11787, 15667, 19543, 23417, 26534, 26518, 26503, 26487, 26472, 26456, 26441,
+    23207, 19295, 15384, 11477, 7577, 3678, -217, -4107, -7994, -11879, -15758, -19632, -23504, -26659, -26679, -26664,
+    -26649, -26634, -26619, -26571, -23296, -19382, -15470, -11567, -7663, -3764, 130, 4021, 7909, 11793, 15671, 19546,
+    23419, 26535, 26520, 26504, 26489, 26474, 26458, 26442, 23210, 19297, 15386, 11482, 7580, 3681, -213, -4104,
+    -7992, -11876, -15755, -19630, -23502, -26658, -26678, -26663, -26648, -26633, -26618, -26569, -23292, -19380, -15468, -11561,
+    -7660, -3763, 132, 4025, 7912, 11793, 15673, 19551, 23422, 26537, 26522, 26506, 26491, 26475, 26460, 26444,
+    23214, 19299, 15390, 11483, 7582, 3684, -211, -4102, -7989, -11873, -15751, -19627, -23499, -26658, -26676, -26661,
+    -26646, -26631, -26616, -26567, -23288, -19375, -15465, -11559, -7657, -3757, 135, 4027, 7914, 11796, 15675, 19552,
+    23424, 26539, 26523, 26508, 26492, 26477, 26461, 26445, 23216, 19303, 15393, 11486, 7583, 3687, -208, -4100,
+};
+
+#endif // CONDITION_GOLDEN_H
@@ -0,0 +1,36 @@
+#include <stdlib.h>
+#include <time.h>
+#include "host_test.h"
+
+uint64_t host_test_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+uint32_t host_test_rand(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static int host_test_compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+uint64_t host_test_percentile(uint64_t *values, size_t count, int permille)
+{
+    if (count == 0)
+        return 0;
+    qsort(values, count, sizeof(values[0]), host_test_compare_u64);
+    size_t index = (count * (size_t)permille + 999) / 1000;
+    return values[(index > 0) ? index - 1 : 0];
+}
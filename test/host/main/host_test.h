@@ -0,0 +1,47 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+/**
+ * 主机测试公共部分. 每个 test_<模块>.c 提供 test_<模块>_run(), 用 RUN_TEST 运行自己的用例,
+ * 由 test_main.c 依次调用. 基准用 HOST_BENCH 打印一行结果, 不作为通过条件
+ * (主机上的数字只用于同一台机器上前后对比).
+ */
+#define HOST_BENCH(name, fmt, ...)  printf("BENCH %-32s " fmt "\n", name, ##__VA_ARGS__)
+
+uint64_t host_test_now_ns(void);
+
+/**
+ * @brief 确定性伪随机数 (xorshift32), state 不能为 0.
+ */
+uint32_t host_test_rand(uint32_t *state);
+
+/**
+ * @brief 返回第 permille/1000 分位的值, 会对 values 原地排序.
+ */
+uint64_t host_test_percentile(uint64_t *values, size_t count, int permille);
+
+void test_audio_ring_run(void);
+void test_audio_convert_run(void);
+void test_mfcc_feature_run(void);
+void test_kws_inference_run(void);
+void test_audio_vad_run(void);
+void test_audio_adpcm_run(void);
+void test_stream_frame_run(void);
+void test_audio_resample_run(void);
+void test_wav_audio_run(void);
+void test_audio_metrics_run(void);
+void test_audio_trace_run(void);
+void test_gpio_button_run(void);
+void test_audio_pipeline_run(void);
+void test_audio_profile_run(void);
+void test_audio_mixer_run(void);
+void test_audio_jitter_run(void);
+void test_audio_history_run(void);
+void test_audio_pool_run(void);
+void test_audio_recorder_run(void);
+
+#endif // HOST_TEST_H
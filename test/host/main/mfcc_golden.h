@@ -0,0 +1,1469 @@
+// 由 script/mfcc_reference.py 生成, 请勿手工修改
+// mfcc_golden: librosa 0.10 feature.mfcc 路径的 numpy 1.26.4 / scipy 1.11.4 实现
+// mfcc_golden_tables: mfcc_tables.py + float64 DFT
+#ifndef MFCC_GOLDEN_H
+#define MFCC_GOLDEN_H
+
+#define MFCC_GOLDEN_SAMPLES    19200
+#define MFCC_GOLDEN_SEGMENT    1600
+#define MFCC_GOLDEN_FRAMES     121
+
+static const float mfcc_golden[121][40] = {
+  {
+    0.77931f, -1.63415f, -0.99169f, -2.37838f, -3.97683f, -1.54900f, 1.07691f, 1.84897f, 0.15545f, 0.87406f,
+    0.63118f, 0.58422f, -1.30041f, 1.50219f, 1.03673f, 0.89809f, 1.43073f, 1.08954f, 0.20310f, -0.54072f,
+    0.13532f, 0.31042f, 0.49959f, 0.93125f, 0.17350f, 0.68777f, 1.09647f, -0.13233f, -1.02390f, 1.91757f,
+    -0.95053f, 0.35962f, 1.00613f, -0.65281f, -0.16938f, 0.59683f, 0.29306f, -1.56425f, -1.04541f, 0.37843f,
+  },
+  {
+    0.89718f, -2.06813f, -0.77774f, -0.04195f, -0.21138f, 0.72597f, 1.19167f, 1.35317f, 1.42625f, 1.50771f,
+    2.00010f, -1.05981f, -1.46619f, -0.15796f, -0.20661f, -0.21925f, 1.31131f, 1.28123f, -0.25881f, -1.12999f,
+    -0.97591f, -1.17401f, -0.15254f, 0.95373f, 0.34142f, 0.85129f, -1.19517f, -1.75601f, -1.39192f, 1.56813f,
+    -0.48838f, 1.29000f, 0.04661f, -0.44377f, -0.46395f, -0.63290f, 0.41936f, -0.50840f, 0.95928f, 0.48321f,
+  },
+  {
+    0.88471f, -2.01886f, -1.14543f, -2.27542f, -1.41304f, -0.99104f, 0.61502f, 0.95696f, 0.77262f, -0.07336f,
+    0.40578f, 0.21908f, -0.69952f, 0.20120f, -0.33211f, -0.12556f, 1.59400f, 0.39856f, -1.58494f, -0.95088f,
+    -0.87137f, -1.32926f, -0.41653f, 1.16436f, 0.51614f, 0.84098f, -1.17065f, -2.19610f, -0.66648f, 1.38956f,
+    -0.57852f, -0.29821f, -0.50935f, -0.08231f, -0.66772f, -1.56445f, 0.31899f, 0.38282f, 0.60559f, 0.78503f,
+  },
+  {
+    0.93642f, -1.97071f, -1.82653f, -1.87984f, -0.86012f, -0.38793f, 0.58812f, 1.88247f, 2.09100f, 0.11657f,
+    -0.16000f, 0.13641f, -0.12023f, 0.55946f, 0.34443f, 0.11794f, 1.56498f, 0.89806f, 0.35116f, -1.25315f,
+    -0.28218f, -0.24501f, 2.07099f, 0.47740f, -0.68984f, -0.83943f, -0.88558f, -0.93536f, -0.23845f, 1.72466f,
+    -0.28283f, -0.17887f, 0.45424f, 0.40093f, -0.05850f, -0.94650f, -0.00607f, 0.10788f, 1.09327f, 1.33844f,
+  },
+  {
+    0.95281f, -1.69353f, -1.59690f, -1.38745f, -1.02513f, -0.64338f, -0.50904f, 2.16102f, 1.60482f, 0.57174f,
+    -0.22564f, -0.38416f, 0.18851f, 0.46854f, -0.00498f, -0.11653f, 0.56437f, 0.25385f, 0.57354f, -0.39853f,
+    -0.75217f, -1.20180f, 0.64846f, 0.89689f, 0.65054f, 0.30041f, -0.41693f, -1.38191f, -0.50285f, 2.38459f,
+    0.85497f, 0.95991f, -0.64045f, -0.30955f, -1.04312f, -0.54508f, 0.46877f, -0.11009f, 0.96319f, 1.58027f,
+  },
+  {
+    0.96858f, -1.17207f, -0.80975f, -0.34478f, -0.99722f, -0.14888f, -0.96882f, 0.02365f, 1.55691f, 0.22717f,
+    -0.32726f, -1.38690f, -1.79298f, -0.09393f, 0.84968f, 0.64666f, 0.55261f, -0.26811f, -0.46998f, -1.41074f,
+    -0.48041f, -0.60299f, 1.17247f, 0.38471f, -0.88832f, -0.93595f, -1.18930f, 0.11519f, 0.39476f, 1.04055f,
+    -0.95285f, -0.93274f, 0.23177f, -0.11401f, -1.23055f, -1.51894f, 0.90830f, -0.07536f, 0.35930f, 1.36717f,
+  },
+  {
+    0.97103f, -1.69350f, -1.61959f, -1.50797f, -1.40872f, -0.85818f, 0.24743f, 1.44602f, 1.47532f, 1.42118f,
+    0.47610f, -0.21667f, -0.59189f, 0.86038f, 1.76703f, 1.19536f, 0.44073f, 0.64661f, 0.81929f, 0.72544f,
+    0.20086f, -0.53988f, 0.88455f, 0.60457f, -0.11112f, 0.16013f, -1.07589f, -0.84575f, -1.24793f, 0.14437f,
+    -0.24456f, -0.08371f, 0.44351f, -0.39975f, -1.65466f, -0.80616f, -1.15586f, -0.49642f, 0.65267f, 0.62551f,
+  },
+  {
+    0.90718f, -1.84664f, -0.00039f, -0.62989f, -2.00055f, -1.58323f, 1.08926f, 2.08830f, 0.85340f, 1.51022f,
+    -0.94167f, -0.99984f, -0.32474f, 1.20255f, 1.00747f, 1.06852f, 1.49811f, 0.35551f, 0.09325f, 0.20317f,
+    -0.38006f, -0.30397f, 0.49096f, 0.83502f, -0.23008f, -0.05581f, 0.19656f, -0.83735f, 0.05684f, 1.04598f,
+    -1.32515f, -0.17050f, 0.01482f, 0.95646f, -0.57270f, -1.85631f, -0.72068f, 0.05225f, -0.12861f, 0.17630f,
+  },
+  {
+    0.90610f, -2.37451f, -1.65221f, -0.37318f, -0.95682f, -1.07749f, 1.48500f, 1.39060f, 1.49933f, 1.49495f,
+    -0.07645f, 0.06433f, 0.23240f, 0.64709f, -0.43153f, 0.31796f, 0.55466f, -0.39224f, -0.79654f, -0.47254f,
+    -0.55054f, -0.61214f, 0.30113f, 0.98115f, 0.63013f, -0.23246f, -1.94187f, -1.63018f, 0.16217f, 1.91706f,
+    0.25861f, 0.86848f, -0.64855f, 0.09418f, -0.76139f, -0.65241f, 0.97319f, -0.00647f, 0.28620f, 1.43735f,
+  },
+  {
+    0.92904f, -1.86390f, -2.12227f, -1.60304f, -1.62990f, -1.64827f, 1.83409f, 1.22268f, 1.14247f, -0.24381f,
+    -0.55729f, -0.90875f, -0.12953f, 1.11201f, 1.08323f, 1.12623f, 1.00078f, 0.55121f, 0.21076f, -0.81621f,
+    0.00327f, 0.43871f, 0.08431f, 0.73516f, 0.63060f, 0.04102f, -0.95354f, -0.07344f, -1.29447f, 0.66747f,
+    -0.84406f, -0.10597f, 1.21937f, 0.58960f, -1.06024f, -0.21893f, 1.67911f, 0.54527f, -0.23533f, 0.28786f,
+  },
+  {
+    0.93104f, -0.65556f, -1.32305f, -2.94930f, -2.52746f, -1.29958f, 0.35898f, 1.61598f, 1.79863f, 0.79652f,
+    0.79874f, -0.43022f, -0.40529f, 0.94458f, 0.29193f, -0.26756f, -0.36618f, -0.83876f, 0.41249f, 0.69043f,
+    0.29211f, -0.54431f, -0.42583f, 1.47666f, 0.21972f, -0.82757f, 0.82091f, -0.12595f, -1.21618f, -0.15350f,
+    -0.00986f, 0.27490f, -0.33030f, -0.62455f, -1.73859f, -0.40266f, -0.33359f, -1.50859f, -0.49624f, 0.26904f,
+  },
+  {
+    0.68998f, -0.98785f, -0.87087f, -1.59597f, -0.20856f, 0.32057f, -0.76936f, 0.01036f, 1.62208f, 2.43630f,
+    2.13333f, 1.95419f, 1.83676f, -0.17771f, -1.21752f, -0.26179f, -0.55154f, -0.76700f, 1.14553f, 1.28197f,
+    2.51504f, 1.69503f, 0.57194f, 1.54890f, -0.22318f, -1.94945f, 0.65222f, 1.84123f, 0.68439f, -0.42316f,
+    -0.06000f, -0.05557f, 0.83650f, -0.99172f, -1.06223f, -0.06460f, -1.90537f, -1.88274f, -0.28881f, -0.83174f,
+  },
+  {
+    0.70962f, -0.35153f, -0.11948f, 1.02951f, 1.16260f, 0.16173f, -1.15544f, -1.34737f, 0.07221f, 1.08730f,
+    1.94651f, 2.53881f, 2.25416f, -0.69504f, -1.41917f, -1.09649f, -0.94575f, -0.57946f, 0.63518f, 0.87752f,
+    1.74976f, -0.16698f, -0.15550f, 1.53477f, 0.67321f, -1.58022f, -1.76615f, -0.35834f, 0.21151f, 1.12228f,
+    0.98202f, -0.60080f, -0.61748f, -1.64029f, -1.56049f, -0.71866f, -0.23725f, -1.13837f, 1.17105f, -1.19156f,
+  },
+  {
+    0.71866f, -0.19780f, -0.37677f, -2.41460f, -2.54302f, -1.21772f, 0.07915f, 0.20480f, 1.31846f, 1.76197f,
+    0.47797f, 1.52875f, 1.80953f, 0.04581f, -0.46123f, 0.20352f, -0.37179f, -1.62641f, -0.16248f, 1.85290f,
+    3.24935f, 0.64939f, -1.03304f, 0.60139f, -0.06469f, -1.63318f, -1.27363f, -0.22290f, -1.74274f, -0.30866f,
+    1.22779f, -0.58422f, 0.01932f, -0.18855f, -0.16093f, -0.72812f, -0.60258f, -1.23814f, 0.68199f, -1.41693f,
+  },
+  {
+    0.68432f, -0.68699f, -0.26304f, -0.69611f, -1.63194f, -2.64802f, -1.62899f, -0.88285f, -0.12595f, 0.25387f,
+    0.27593f, 0.91159f, 1.27045f, -1.48850f, -1.28206f, -0.06486f, -0.34592f, -0.67909f, 0.06344f, 0.99154f,
+    1.24097f, 0.63481f, -0.16492f, 0.35501f, -1.77639f, -2.28017f, -1.84324f, -1.75851f, -0.31264f, -0.01929f,
+    0.48681f, 0.05541f, 0.37344f, -0.50067f, -0.30504f, 0.69848f, -0.84965f, -0.86827f, 0.21103f, -0.83062f,
+  },
+  {
+    0.70927f, -0.48560f, -0.40655f, 0.21912f, -0.47598f, -2.82711f, -2.07768f, 0.12414f, 1.29543f, 0.89284f,
+    0.92822f, 1.73649f, 2.13252f, 0.19032f, 0.09483f, 0.14785f, 0.15128f, -0.19672f, 0.31618f, 0.06480f,
+    1.68079f, 0.86089f, -0.14136f, 0.22199f, -1.01318f, -2.29575f, -0.90616f, 0.14183f, 0.34529f, 0.30162f,
+    0.71030f, -1.04255f, -0.01565f, 0.25988f, -0.61565f, -0.33576f, -0.73691f, -1.14137f, 0.12252f, -0.86496f,
+  },
+  {
+    0.73996f, -0.11723f, -0.49612f, -1.27156f, -1.68218f, -1.78464f, -1.15565f, 0.21531f, 0.36482f, 1.22437f,
+    1.15058f, 1.84721f, 1.89935f, -0.18403f, -0.67694f, 0.52325f, 0.55969f, -0.31337f, -0.21058f, 0.23836f,
+    2.00264f, 0.96298f, -0.27192f, 0.79223f, -0.57212f, -1.94529f, -1.20066f, 0.16489f, 0.19516f, -0.65650f,
+    1.17213f, 0.94006f, 0.47521f, 0.00733f, -0.02097f, 0.70799f, -0.63076f, -0.92682f, 1.01139f, 1.07390f,
+  },
+  {
+    0.78001f, -0.15488f, -0.46178f, -0.46722f, 0.16521f, -0.52209f, -0.32365f, 0.42148f, 1.43442f, 1.29060f,
+    0.75521f, 1.17772f, 1.42653f, -0.01936f, -0.73225f, -0.47172f, -0.98171f, -0.67713f, 0.38116f, 0.40339f,
+    1.30068f, 0.47725f, -1.01953f, 0.18646f, -0.05256f, -1.05347f, -1.58742f, -0.35902f, 0.83674f, 0.54832f,
+    1.69775f, 0.38886f, 0.86606f, -0.96891f, -0.08600f, 1.06287f, -1.42598f, -2.00104f, -0.19472f, -0.23713f,
+  },
+  {
+    0.67355f, -1.68501f, -1.91139f, -1.60443f, -0.51131f, -1.66760f, -0.94125f, -0.19382f, 0.68969f, 1.28985f,
+    2.90495f, 2.77117f, 1.61618f, -0.61280f, -0.42863f, -0.11884f, -1.64283f, -1.01106f, 0.51856f, 0.67380f,
+    1.33482f, 1.39486f, -0.04642f, -0.06317f, -0.87114f, -2.18741f, -0.58834f, -0.31517f, -0.63597f, -0.37590f,
+    0.75415f, 0.33543f, 0.40433f, -0.55900f, -0.77294f, 0.50508f, -0.42942f, -1.16073f, 1.18191f, -0.94646f,
+  },
+  {
+    0.72587f, -0.78028f, -0.83973f, -0.91436f, -0.64058f, -1.73651f, -1.63762f, -0.47554f, 0.75899f, 1.18249f,
+    2.05496f, 2.36139f, 1.27571f, -0.67139f, -0.95349f, 0.39186f, 0.16481f, -0.18028f, 0.79676f, 0.41487f,
+    1.24391f, 1.71591f, 0.04662f, 0.80204f, 0.10798f, -1.45580f, -1.09275f, -0.89674f, -1.26467f, 0.36442f,
+    0.82508f, 0.37476f, 0.37212f, -0.95595f, -0.59105f, 0.92103f, 0.26133f, -1.63148f, 0.88810f, 1.00954f,
+  },
+  {
+    0.61882f, -0.32065f, -0.09571f, -1.09796f, -2.32759f, -2.73047f, -1.72801f, 0.48616f, 0.93820f, 0.79262f,
+    0.96629f, 1.99157f, 2.30517f, -0.65870f, -1.07604f, -0.59812f, -0.43595f, -0.61066f, -1.07690f, 0.72133f,
+    1.31581f, -0.47537f, -1.36290f, 0.40799f, 0.96291f, 0.14182f, -0.47391f, 0.76160f, 0.28198f, -0.31584f,
+    1.04368f, -0.61877f, -0.19658f, -1.00651f, 1.00548f, 0.27505f, -1.60018f, -1.87291f, 2.29817f, -0.34040f,
+  },
+  {
+    -1.02108f, -1.48158f, 0.11064f, 0.28623f, 0.28127f, -2.11019f, -2.77560f, -0.03021f, 1.00485f, -0.11616f,
+    0.76360f, 0.07914f, 0.81017f, 0.95600f, 1.27154f, 0.01157f, -0.17039f, -0.09304f, 0.01016f, -0.07246f,
+    -0.32782f, -0.87557f, -0.74947f, 0.26081f, 0.00958f, 0.17253f, 0.00179f, 0.55721f, -0.10039f, -0.46453f,
+    -0.41673f, -1.09786f, -0.19341f, -1.14568f, -0.70888f, -1.14504f, -0.12830f, -0.26702f, -0.05317f, -0.17100f,
+  },
+  {
+    -1.75254f, 0.03209f, -0.50450f, 0.52530f, 0.59705f, -0.87217f, -2.12610f, -2.55301f, -1.15019f, 0.70929f,
+    0.81653f, 0.13527f, 0.41373f, 1.90598f, 1.83028f, -0.13124f, -0.76051f, 0.80266f, -1.16849f, -1.38134f,
+    -0.79665f, -2.06936f, -0.30874f, 1.21471f, -1.30998f, 0.20210f, 0.99019f, 1.49612f, 1.93361f, -0.86799f,
+    -0.68157f, -2.47860f, -2.10346f, -0.07546f, -2.11201f, 0.87410f, 1.43461f, 1.80764f, -1.02990f, 0.00854f,
+  },
+  {
+    -1.70252f, 1.01002f, 0.41211f, 0.66598f, -0.19043f, -2.05379f, -2.99143f, -2.17873f, -0.63161f, 1.12734f,
+    0.02849f, -0.14064f, -0.01921f, 0.52406f, 1.08310f, 0.14795f, -0.04064f, 1.54185f, -0.80425f, -1.19879f,
+    -1.52836f, -1.83893f, 0.94367f, 2.15357f, -0.78151f, -0.88563f, 0.15575f, 0.93826f, 1.71039f, -1.39774f,
+    -0.64274f, -1.74813f, -1.25855f, 0.06010f, -3.28014f, -0.38900f, 0.27731f, 1.38726f, -1.34022f, 0.12902f,
+  },
+  {
+    -1.70298f, 0.94210f, 0.00509f, -0.23737f, -0.58059f, -1.09251f, -1.62474f, -2.20967f, -1.20759f, 1.11838f,
+    0.78736f, 0.64025f, 0.52357f, 2.19973f, 2.59993f, -0.03888f, -0.70040f, 0.71681f, -0.41029f, -1.19956f,
+    -1.07708f, -2.17804f, -0.48865f, 1.01040f, -1.24702f, -0.18020f, -1.38990f, -0.08282f, 0.68754f, -0.85544f,
+    0.18170f, -1.44347f, -0.91465f, 0.76484f, -1.61382f, -0.28068f, 0.12302f, 1.39688f, -1.44349f, 0.59191f,
+  },
+  {
+    -1.74435f, 0.06526f, -0.62334f, 0.06916f, 0.17444f, -0.85685f, -2.09727f, -2.14249f, -0.57228f, 1.31031f,
+    0.51068f, -0.42992f, 0.98157f, 2.64899f, 2.02501f, 0.92064f, 0.42351f, 0.20586f, -1.01614f, -0.42818f,
+    -0.59208f, -2.72245f, -1.35331f, 1.04924f, -0.12780f, 0.76594f, 1.03028f, 1.59869f, 0.99146f, -1.42915f,
+    -0.00147f, -1.65413f, -1.02020f, 0.88279f, -1.74971f, 0.05495f, 1.07706f, 2.35207f, -0.79936f, 0.82809f,
+  },
+  {
+    -1.65849f, 1.24390f, -0.32129f, -0.39459f, 0.42435f, 0.18494f, -1.28662f, -1.40018f, -1.20180f, 0.62011f,
+    1.40511f, 0.08101f, 0.22010f, 2.73836f, 2.14773f, 0.29014f, 0.27902f, 0.40947f, -0.67287f, 0.17270f,
+    0.56321f, -2.05204f, -1.41440f, 0.93213f, 0.29501f, 0.75767f, 0.90585f, 2.20833f, 0.86278f, -2.50805f,
+    -0.95265f, -1.48675f, -1.51870f, 0.22115f, -1.68217f, -0.55330f, -0.33859f, 0.61710f, -1.61245f, 0.96217f,
+  },
+  {
+    -1.72366f, 0.60747f, -0.39681f, -0.45539f, -1.06494f, -1.55123f, -1.78363f, -1.36129f, -0.64889f, 0.62000f,
+    0.76773f, 0.58792f, 0.97565f, 2.51551f, 1.87673f, -0.31865f, -0.22157f, 0.44151f, -0.84474f, -0.27768f,
+    -0.87446f, -3.14045f, -1.06534f, 1.06233f, -0.53671f, -0.56724f, 0.29323f, 2.08569f, 2.00504f, -1.96423f,
+    -1.41906f, -0.94453f, -0.47319f, 0.65502f, -1.83897f, -0.42155f, -0.92548f, 0.02240f, -2.59156f, 0.34393f,
+  },
+  {
+    -1.72147f, 0.77533f, 0.07335f, -1.09057f, -0.99599f, -0.88695f, -1.71733f, -1.46961f, -0.74902f, 0.25078f,
+    1.73841f, 1.38997f, 1.25032f, 2.16314f, 1.37989f, -0.31541f, -0.21001f, 0.30505f, -1.42637f, -0.63592f,
+    -0.99081f, -2.92182f, -0.16201f, 1.45893f, -0.72600f, -0.62598f, 0.05949f, 1.78279f, 1.38008f, -1.47649f,
+    0.07632f, -0.24655f, -0.29275f, 1.45110f, -1.57279f, -0.83596f, -1.01767f, 1.79183f, -0.73060f, 1.04838f,
+  },
+  {
+    -1.31336f, 1.41272f, 1.04109f, 1.65157f, 0.24626f, -0.76031f, -2.43882f, -2.08110f, -0.84951f, 1.37600f,
+    1.90079f, -0.50446f, -1.31814f, 1.39522f, 1.21344f, -0.31615f, -0.01366f, 1.22316f, -0.21768f, -0.29506f,
+    0.42577f, -1.21794f, 0.01691f, 0.39089f, -0.69300f, 0.69375f, 0.61910f, -0.64549f, 1.39487f, -0.96016f,
+    -0.22010f, -0.55878f, -0.64705f, 0.06214f, -1.51496f, 0.02421f, -1.05765f, 1.15312f, -0.56371f, 0.08830f,
+  },
+  {
+    0.37030f, 0.57581f, 0.13117f, 0.12135f, 0.34195f, -0.39475f, -0.26915f, -1.40057f, -2.35540f, -1.96081f,
+    0.09906f, 1.32892f, 0.21437f, -0.29545f, 0.55458f, 2.06436f, 1.15137f, 0.17761f, 0.23637f, 0.37733f,
+    -0.15759f, 0.74836f, 2.22838f, -1.20169f, -1.26767f, 1.09521f, -0.71210f, -0.91112f, 0.71046f, -0.91628f,
+    1.17212f, -0.63720f, -0.98037f, 1.03787f, -0.25175f, -0.54130f, -0.50407f, -0.71632f, 0.14100f, -0.56732f,
+  },
+  {
+    0.38324f, 0.57893f, 1.42507f, 0.42806f, 2.07994f, 1.53730f, 0.11935f, -1.35747f, -2.00815f, -1.92862f,
+    0.40429f, 1.71378f, 0.18709f, -0.63770f, 0.29019f, 1.39612f, 1.45328f, 1.49854f, 1.40580f, 0.26887f,
+    -1.30610f, -0.12571f, 0.78386f, -2.25584f, -2.15119f, 0.38013f, 0.71356f, 0.39137f, -0.49805f, -0.31358f,
+    1.59230f, 0.27695f, -0.34212f, 1.33483f, 0.01389f, -0.83755f, 0.60652f, 0.96590f, -1.53713f, -1.49136f,
+  },
+  {
+    0.32451f, -0.30160f, 1.37159f, 1.21381f, 1.12617f, 0.53143f, -0.16380f, -1.10974f, -2.16259f, -2.23721f,
+    0.12864f, 1.24250f, 0.04839f, -0.99285f, 0.29615f, 2.47241f, 2.25857f, 1.04338f, 1.10908f, 0.25484f,
+    -0.37638f, 1.20997f, 0.96990f, -2.07197f, -2.36083f, -0.37631f, 0.40660f, 0.42774f, -1.47437f, 0.18326f,
+    1.80319f, 0.27654f, -0.31903f, 0.07578f, -1.30119f, -1.60396f, -0.70118f, 0.63450f, -0.60318f, -0.88733f,
+  },
+  {
+    0.30447f, -0.70836f, 0.91746f, -0.51523f, -0.30288f, -0.46891f, -0.07202f, -1.85119f, -1.97894f, -1.47007f,
+    -0.24590f, 0.60536f, -0.61960f, -1.39391f, 0.67795f, 2.67671f, 2.61948f, 0.97447f, 0.66144f, 0.44775f,
+    -0.32225f, 0.27264f, 0.70841f, -1.73119f, -2.17836f, -0.24705f, 0.11528f, 0.16662f, -0.70715f, 0.92919f,
+    1.27843f, -0.01215f, 1.59384f, 2.99588f, 0.16975f, -1.59069f, -0.46333f, 1.32653f, -0.62067f, -0.96063f,
+  },
+  {
+    0.33934f, -0.16679f, 1.28790f, -0.06487f, 0.29841f, -0.04810f, 0.59743f, -0.79911f, -2.08465f, -1.32557f,
+    1.49826f, 1.43006f, -0.04397f, -0.44974f, 1.32487f, 2.88123f, 2.05047f, 1.49321f, 1.37351f, 0.21096f,
+    -1.11051f, 0.59128f, 1.53805f, -1.53031f, -1.43238f, 0.68745f, -0.38730f, -1.06273f, -0.87786f, 0.57143f,
+    2.18594f, 0.94062f, 0.39896f, 1.77866f, -0.22723f, -0.84749f, 0.35007f, 0.79194f, -1.38191f, -2.82193f,
+  },
+  {
+    0.32754f, 0.07620f, 1.58673f, 0.93256f, 1.26252f, 0.05899f, 1.02356f, -0.51666f, -1.97788f, -1.92648f,
+    0.40968f, 1.11381f, -0.22046f, -1.00158f, 1.09317f, 2.66844f, 2.46439f, 1.54125f, 0.32932f, -0.94541f,
+    -0.85729f, 1.05941f, 0.96738f, -1.83033f, -1.44127f, 1.13834f, 0.14383f, -0.99955f, -1.30808f, -0.08281f,
+    2.19497f, 1.19384f, 0.98558f, 2.09310f, -0.56396f, -0.91214f, -0.26234f, 1.05468f, -0.80449f, -2.14231f,
+  },
+  {
+    0.26787f, -0.63945f, 1.42826f, 0.89340f, 1.11899f, -0.36989f, -0.34958f, -1.48315f, -2.02647f, -2.18905f,
+    0.22260f, 1.54854f, 0.22364f, -0.18849f, 1.21666f, 2.45965f, 2.27714f, 0.06059f, 0.02769f, 0.11018f,
+    -0.83645f, 0.74271f, 0.61881f, -2.47233f, -2.46828f, -0.39327f, 0.94707f, 1.20133f, -0.68903f, -1.22121f,
+    0.59449f, 0.40005f, 0.66468f, 1.92890f, -0.60936f, -1.57369f, 0.78414f, 2.37029f, -0.12285f, -1.76505f,
+  },
+  {
+    0.36035f, -0.12090f, 1.51112f, 0.89276f, 1.25541f, 0.55252f, -0.35675f, -1.70904f, -2.52688f, -2.29691f,
+    0.28405f, 1.05940f, 0.31706f, -0.31463f, 0.98282f, 1.93979f, 1.45681f, 1.58993f, 1.37670f, 0.21825f,
+    -0.79756f, 0.18305f, -0.05707f, -2.35170f, -2.00843f, 1.31037f, 1.48649f, 0.20405f, -2.07441f, -1.59839f,
+    1.16898f, 0.50498f, -0.45227f, 1.03371f, -0.34613f, -1.05087f, 0.99620f, 1.94755f, -0.09513f, -1.28153f,
+  },
+  {
+    0.37012f, 0.25181f, 1.02095f, -0.73011f, 0.68675f, 0.06082f, -0.60663f, -0.95036f, -1.14411f, -1.59847f,
+    0.12537f, 0.60590f, -0.31298f, -0.29291f, 1.64891f, 2.82275f, 2.15466f, 1.36681f, 1.24723f, 0.96962f,
+    -0.42833f, 0.31556f, 0.92379f, -1.67589f, -1.81244f, 0.22663f, 0.43535f, 0.17669f, -0.96004f, -1.42664f,
+    1.30244f, 1.20477f, 0.46866f, 1.79791f, -1.01832f, -2.71501f, -0.60509f, 1.81357f, -0.00448f, -1.15995f,
+  },
+  {
+    0.35749f, 0.14669f, 1.77587f, 0.57779f, 1.94481f, 1.05409f, -0.85301f, -2.07833f, -1.40719f, -0.51850f,
+    1.79453f, 1.65248f, 0.61354f, -0.34427f, 0.70940f, 2.17147f, 1.60580f, 0.42020f, -0.01749f, -0.44361f,
+    -0.88065f, 1.23083f, 1.34676f, -1.92232f, -2.50931f, -0.64602f, -0.67814f, -0.03873f, -0.05008f, 1.05332f,
+    1.67832f, 0.15801f, 0.96397f, 2.15206f, -0.32689f, -2.11115f, -0.00853f, 0.85264f, -2.16739f, -1.77507f,
+  },
+  {
+    0.83507f, -0.61519f, 0.04639f, 0.83229f, 0.92993f, 1.25486f, -0.72448f, -2.07612f, -1.92223f, -1.37659f,
+    -0.16127f, 0.29066f, 1.46361f, 0.89200f, 0.69359f, -0.06854f, 0.54013f, 0.50025f, 0.94868f, 0.20802f,
+    -0.88066f, -0.25783f, 0.94620f, -0.65631f, -0.74099f, -0.57941f, -0.14877f, 0.02994f, -0.17799f, 0.58480f,
+    1.06187f, -0.80369f, 0.16693f, -0.77034f, 0.16999f, -1.03634f, 1.40341f, 1.96499f, -1.02678f, -1.17573f,
+  },
+  {
+    0.99750f, -0.83531f, -0.83420f, 0.30609f, 0.89037f, 0.08036f, -1.10720f, 0.04343f, -0.30710f, -0.44741f,
+    -0.60625f, -0.36330f, 0.79653f, 0.52750f, -0.02734f, 0.18411f, 0.40210f, 1.96518f, 1.41011f, 0.03120f,
+    0.55850f, -0.12113f, -1.38881f, 0.37799f, 0.07536f, -1.49254f, -1.61802f, -1.90090f, -1.68122f, -0.75208f,
+    -0.44521f, -0.01121f, 0.62944f, -0.47442f, -0.25421f, 0.43308f, 0.97330f, 1.38476f, -0.06916f, -0.46209f,
+  },
+  {
+    0.97570f, -1.28462f, -0.92211f, -0.77911f, -1.02289f, -0.45020f, 0.20458f, -0.17172f, -0.08081f, 0.03831f,
+    -1.96947f, -1.78798f, 0.17330f, 0.29026f, -0.01546f, -0.73580f, 0.44090f, 1.26686f, 1.29688f, 2.17131f,
+    1.93554f, -0.54299f, -0.97625f, 0.23356f, 0.71185f, -0.33157f, -0.59104f, -0.56686f, -0.26728f, -0.82699f,
+    -0.02552f, -0.36913f, -0.73661f, -0.53746f, -0.11330f, 1.21324f, 2.35496f, 1.25586f, -0.02971f, -0.16747f,
+  },
+  {
+    0.95363f, -1.80309f, -1.63562f, -1.54652f, -1.49008f, -0.26155f, -0.26038f, -2.01948f, -1.36895f, -1.65762f,
+    -2.83558f, -1.97761f, 0.65421f, 0.71792f, -0.06279f, -0.47908f, -0.47538f, 0.28607f, 0.98558f, 1.01763f,
+    1.56080f, -0.01278f, 0.31997f, 0.05211f, -0.33957f, -0.90931f, -2.21678f, -1.42625f, -0.72565f, -0.75831f,
+    -0.57800f, -1.85292f, -0.44488f, -0.85986f, -0.79977f, -0.81288f, -0.06168f, 0.72087f, -0.52007f, -0.44221f,
+  },
+  {
+    1.01744f, -0.81180f, -1.15060f, 0.22539f, 0.75993f, 0.98180f, -0.47857f, -0.55323f, -0.65381f, -0.82992f,
+    -0.54403f, -0.80726f, -0.88225f, -0.42005f, 0.46938f, -0.18002f, 0.43972f, 0.81165f, 1.29662f, 0.91428f,
+    0.71264f, 0.90626f, -0.18573f, -0.20075f, 0.15932f, -0.19034f, -0.52809f, -0.50993f, -0.38754f, -1.52074f,
+    -0.26573f, -0.63948f, 0.24782f, 0.33167f, 0.02577f, 0.53044f, 0.26030f, 0.45813f, 0.73371f, 0.25016f,
+  },
+  {
+    0.97279f, -1.47944f, -0.99523f, 0.67913f, 0.55382f, 0.00238f, 0.36193f, 0.06183f, -0.83874f, -1.74430f,
+    -0.95690f, -0.25859f, 1.60528f, 0.64078f, -1.23089f, -0.75146f, 0.30741f, 1.64775f, 1.65366f, 1.65115f,
+    1.16473f, 0.39587f, 0.05501f, -0.09264f, -0.74449f, -1.97835f, -0.92631f, -0.85730f, -1.88112f, -0.69528f,
+    -0.37021f, -0.65402f, 0.24976f, 0.19706f, -0.36853f, 1.13908f, 0.93567f, 0.89250f, 1.06880f, -0.31916f,
+  },
+  {
+    0.99159f, -0.55174f, -0.41796f, -0.17669f, -0.78142f, -0.35646f, 0.35042f, -0.56982f, -0.14964f, -0.24437f,
+    -1.31410f, -0.55817f, 0.13309f, 0.93561f, 0.87771f, 0.74262f, 0.23483f, 0.62056f, 1.73678f, 1.46166f,
+    0.80165f, 0.24174f, 0.47453f, 0.40250f, 1.20644f, -1.05453f, -0.64506f, -1.28776f, -1.40343f, -1.16075f,
+    -0.87364f, -0.10263f, 1.01178f, -0.29860f, 0.48269f, 0.26079f, -0.96402f, 0.00911f, 0.06730f, 0.07019f,
+  },
+  {
+    0.97427f, -1.09699f, -1.19453f, -0.29185f, -0.69111f, -0.10565f, 0.45312f, -0.56748f, -0.24964f, -0.19781f,
+    -1.87284f, -0.95496f, 0.87447f, 0.36670f, -0.38400f, -0.34392f, 0.06638f, 1.92062f, 1.68983f, 2.18634f,
+    0.10884f, -0.11251f, -0.46124f, 1.32575f, 0.43152f, -1.71063f, -0.56336f, -0.54758f, -1.13708f, -1.00441f,
+    -1.44183f, -2.48090f, 0.83327f, -0.46089f, 0.14469f, 0.81142f, 1.24018f, 1.17292f, -0.10336f, -0.41045f,
+  },
+  {
+    0.98190f, -1.11536f, -0.66377f, 0.50057f, 0.35998f, 0.69821f, 1.69157f, 0.32732f, 0.24841f, -1.71240f,
+    -2.41990f, -0.71342f, 0.37820f, -0.09385f, -0.17945f, 0.01569f, 0.21029f, 1.23338f, 1.57993f, 2.08979f,
+    1.46906f, 0.66821f, -0.71362f, -0.55340f, -0.56576f, -1.02213f, -1.69102f, -1.18665f, -0.28643f, -0.19533f,
+    -0.52661f, 0.01410f, -0.26664f, -1.17316f, -0.07124f, 1.50145f, 1.81886f, 1.10196f, -0.85191f, -0.64846f,
+  },
+  {
+    0.93012f, -1.46740f, -0.45747f, -0.03144f, -0.41622f, 0.11036f, 1.03151f, -0.25745f, -1.23280f, -1.34389f,
+    -1.53732f, -1.17837f, -1.41707f, -0.62112f, 0.64650f, 0.19134f, 0.91983f, 1.31335f, 0.72554f, 1.18780f,
+    0.16228f, -0.98473f, -1.67418f, -0.50366f, 1.07441f, 0.70168f, -0.89960f, -1.32355f, -0.82184f, -1.31992f,
+    -0.62548f, -0.40035f, 0.80315f, 0.45938f, -0.59286f, 0.43381f, 1.07834f, 1.59674f, 0.68847f, 0.30524f,
+  },
+  {
+    0.83619f, -0.29494f, -1.09744f, 0.83996f, -0.19079f, 1.35151f, 2.35549f, -0.61154f, -2.52117f, -2.08124f,
+    -1.84737f, -1.00977f, -0.59291f, 0.38200f, 2.03153f, 0.57318f, -0.16093f, 1.38902f, 1.11873f, 0.27747f,
+    -1.60729f, -0.69401f, -1.37291f, 0.46298f, 1.77105f, 0.74747f, -0.85344f, -1.77910f, -0.91985f, -1.60827f,
+    -1.45885f, 0.51682f, 1.12487f, 1.01172f, 0.57648f, 1.41756f, 0.64125f, -1.56776f, -0.38320f, -0.95833f,
+  },
+  {
+    -0.87493f, 1.10923f, -2.03066f, -2.14825f, -0.91615f, -0.09641f, -0.97956f, 0.60597f, -0.92465f, -0.55542f,
+    0.20892f, -0.10244f, -0.09300f, 0.49063f, 0.29377f, -0.08167f, 0.22204f, -0.02580f, 1.24469f, 0.12269f,
+    -0.10449f, 0.39750f, -0.24071f, -0.29711f, 0.69347f, -0.70774f, 0.78638f, -0.29102f, -0.24369f, -0.02155f,
+    -0.72584f, -0.71789f, -0.18969f, -0.63653f, 0.16994f, 0.38022f, -0.26896f, 0.03936f, 0.25659f, -0.02517f,
+  },
+  {
+    -1.44357f, 0.35805f, -0.19988f, -0.77166f, -0.21772f, -0.47189f, -0.30114f, -1.28682f, -1.58988f, -0.96668f,
+    -1.45419f, -0.76484f, 1.32421f, 0.56477f, 0.86100f, 0.31877f, -0.78818f, -0.80951f, 0.58287f, 1.15115f,
+    1.35935f, 1.68240f, 1.67142f, -0.19238f, -0.39918f, 0.43282f, 1.58463f, 1.84920f, 1.28612f, -1.22889f,
+    -1.77013f, -0.89970f, 0.09433f, -2.33297f, -0.85313f, 0.93858f, 1.10782f, 0.39219f, -2.02648f, -0.13120f,
+  },
+  {
+    -1.48711f, 0.14523f, 0.23692f, 0.41563f, 0.53366f, -0.74692f, -1.30634f, -0.51623f, -0.23475f, 0.38210f,
+    -0.15234f, -1.42789f, 0.08394f, 0.13044f, 0.12830f, 0.72106f, 0.59411f, 0.63909f, 1.34176f, 0.76440f,
+    -0.02659f, 1.26118f, 3.03960f, 0.51596f, -0.20904f, -0.04847f, 0.97889f, -0.00290f, -0.27133f, -0.41755f,
+    -0.46040f, 0.31891f, -0.68608f, -1.92561f, -1.24089f, 0.33046f, 1.30777f, -0.26385f, -0.49620f, 0.49672f,
+  },
+  {
+    -1.49376f, -0.02941f, -1.31297f, -2.07064f, -0.74510f, 0.18252f, 0.74847f, -0.37917f, -0.28036f, -0.69541f,
+    -2.44412f, -1.61031f, -0.54531f, -0.02292f, -0.05074f, -0.00577f, 0.21718f, 0.52874f, 1.72721f, 1.26441f,
+    0.46938f, 1.51500f, 3.59463f, 0.49781f, 0.38549f, 0.70093f, 0.72188f, 0.17149f, 1.40873f, -0.63377f,
+    -0.81836f, -0.02540f, -1.27095f, -1.39092f, 1.25768f, 1.69678f, 0.90337f, -0.88080f, -0.55141f, 1.10512f,
+  },
+  {
+    -1.47997f, -0.45790f, -0.21416f, 0.01898f, 0.38349f, 1.06679f, 0.99511f, 1.36259f, 1.18708f, 0.48809f,
+    -1.65437f, -1.24531f, -1.48861f, -1.02864f, 0.04158f, 0.06312f, -0.93463f, 0.89420f, 2.04311f, 1.31750f,
+    0.57808f, 1.13829f, 1.76703f, 0.46462f, 0.22035f, 0.55832f, -0.88718f, -1.26441f, 0.87960f, 0.13196f,
+    -1.35424f, -0.66109f, -0.63703f, -1.36021f, 0.95445f, 1.32574f, -0.14313f, -1.20931f, -1.59153f, -1.07668f,
+  },
+  {
+    -1.43143f, 0.02491f, -0.54559f, -1.43651f, -0.73434f, 0.77438f, 0.83595f, 0.39205f, 0.03117f, -0.79774f,
+    -1.19967f, -1.35746f, -1.03789f, -0.46642f, 0.17995f, -0.04022f, -0.48365f, -0.10790f, 1.46356f, 1.25220f,
+    0.29651f, 1.66799f, 1.47991f, -0.31284f, -0.12085f, 0.09649f, 0.18200f, -0.49711f, 1.22552f, 0.09013f,
+    -1.17929f, -0.39048f, -0.47869f, -1.91702f, -0.57602f, 0.22639f, 0.21723f, -1.10537f, -2.12676f, -0.01795f,
+  },
+  {
+    -1.39277f, 0.30881f, -0.62004f, -0.43262f, 0.24100f, 0.49343f, 0.38610f, 0.94108f, -0.36046f, -0.32824f,
+    -0.24610f, -0.23861f, -0.34837f, -0.43076f, -0.01203f, -0.38025f, -0.54332f, -0.12570f, 0.99669f, 0.82250f,
+    0.15809f, 1.55920f, 1.97864f, -0.64812f, -0.19687f, 0.40441f, 0.75480f, 0.20021f, 1.22452f, 0.28684f,
+    -0.52416f, -1.01283f, -2.11632f, -1.38138f, 0.43119f, -0.09771f, 0.85317f, -0.07038f, -0.72247f, 0.46290f,
+  },
+  {
+    -1.41993f, 0.49451f, -0.23106f, 0.39673f, 0.59028f, 0.57925f, 0.77637f, 1.00145f, 0.08206f, -0.68783f,
+    -0.72088f, -0.15411f, -0.68519f, 0.07661f, 0.97224f, -0.45988f, -0.55676f, -0.52880f, 0.87347f, 0.64147f,
+    0.40481f, 2.07205f, 2.15067f, -0.51550f, 0.00834f, 0.67788f, -0.08358f, 0.88124f, 0.31916f, -0.31288f,
+    -1.43123f, 0.15059f, -1.07017f, -0.52334f, 0.16060f, -1.03407f, -0.60882f, 0.45169f, -0.97627f, 0.66534f,
+  },
+  {
+    -1.06990f, 0.99430f, -0.68299f, -1.37580f, -2.05400f, -1.65581f, -0.65638f, 0.03928f, -1.09857f, -0.90422f,
+    0.06010f, -1.10714f, -0.21321f, 0.04846f, -0.09972f, -0.19902f, -0.14382f, -0.17266f, 1.43253f, 0.19460f,
+    -0.20048f, 0.37062f, 0.09632f, 0.79266f, -0.32263f, 0.19984f, -0.19959f, -0.07319f, -0.84066f, -0.38815f,
+    -0.96522f, 0.05329f, -0.60339f, -1.19724f, -0.31336f, 0.03031f, 0.06155f, 0.00004f, -0.61520f, 0.26455f,
+  },
+  {
+    0.45012f, 1.40176f, 0.77967f, -0.21037f, -0.67505f, 0.09308f, 0.45280f, 0.29824f, -0.27977f, -0.05867f,
+    0.17046f, -1.28469f, -1.63495f, -0.72720f, 0.19803f, 0.77707f, 0.55541f, -1.16468f, 0.42562f, 1.55265f,
+    1.07009f, -0.80175f, -1.57786f, 1.32044f, 1.11928f, -0.27094f, -0.63571f, -0.54883f, -0.72031f, -0.74510f,
+    1.34057f, 1.23307f, -1.62528f, -0.79026f, 0.07320f, -0.81706f, -0.23466f, -0.67916f, -1.37833f, 0.24947f,
+  },
+  {
+    0.49042f, 0.93461f, 1.49603f, 1.03516f, -0.29036f, -0.00971f, 0.73368f, -0.05275f, 0.18733f, -0.36975f,
+    0.03362f, -0.61110f, -2.21168f, -1.87948f, -1.03711f, 0.96035f, 1.39256f, -1.11251f, -1.45950f, 0.03989f,
+    0.90063f, -0.65143f, -0.14757f, 1.73446f, 1.49609f, -0.40730f, -0.77648f, -0.24091f, -1.05914f, -0.80790f,
+    0.66477f, 0.40827f, -1.19653f, 1.07065f, 1.15159f, -0.76496f, -1.99450f, -2.24873f, -0.53973f, 0.96111f,
+  },
+  {
+    0.57707f, 0.98767f, 0.18180f, 0.02743f, -0.58040f, 0.49475f, 1.21961f, 0.16768f, 0.66775f, -0.26566f,
+    -1.02375f, -1.04061f, -1.69204f, -0.92959f, 0.22196f, 0.69279f, 0.53657f, -0.20272f, -0.54580f, 0.66195f,
+    1.21415f, -0.57216f, -0.18707f, 1.74681f, 1.89663f, 0.65842f, -0.12105f, 0.41685f, -1.12211f, -0.46891f,
+    0.49774f, -0.50061f, -1.58965f, -0.10606f, 0.48022f, -1.11730f, -1.28494f, -0.63703f, -0.38564f, 0.64030f,
+  },
+  {
+    0.53257f, 0.78624f, 0.58224f, 0.43088f, 0.06977f, 0.85468f, 0.84664f, 0.17435f, 0.45059f, 0.72777f,
+    -0.76591f, -1.24841f, -1.42633f, -0.31558f, 0.51854f, 0.64495f, 0.14977f, -0.63868f, -0.81533f, -0.07561f,
+    0.31814f, -0.92026f, 0.34786f, 2.57472f, 2.48209f, 0.20202f, 0.16211f, 0.88384f, -0.43806f, -0.43919f,
+    0.77195f, 0.17825f, -1.85194f, -0.45797f, 1.16789f, -0.31384f, -0.85195f, -1.35234f, -0.90042f, 1.36770f,
+  },
+  {
+    0.48422f, 0.90048f, 1.01056f, 0.27238f, 0.47110f, 1.04832f, 1.30698f, 0.59962f, 1.55629f, 1.29590f,
+    -1.12595f, -2.20907f, -2.39699f, -0.77045f, 0.68847f, 0.60865f, 0.12274f, -0.01125f, -0.18335f, 0.63488f,
+    0.52877f, -0.23950f, -0.46942f, 1.48893f, 1.39974f, 0.18071f, 0.50399f, 1.19916f, -0.04128f, -0.67342f,
+    1.00563f, 0.18410f, -2.04962f, 0.04819f, 0.76704f, -1.23778f, -1.38077f, -0.44790f, -0.75220f, 0.96997f,
+  },
+  {
+    0.43331f, 0.36096f, 0.41162f, 1.06904f, -0.47008f, -0.62493f, 0.09373f, 0.46151f, 0.84048f, -0.17147f,
+    -1.63412f, -2.41440f, -2.26278f, -1.27396f, -0.03277f, 0.45482f, -0.19123f, 0.11906f, -0.02123f, 1.42889f,
+    1.08690f, -0.67724f, -0.97721f, 1.41731f, 2.99275f, 0.48640f, 0.20135f, 0.65499f, -0.88492f, 0.05775f,
+    0.56397f, 0.17107f, -2.14214f, 0.08915f, 0.94263f, -0.72023f, -1.00303f, -1.28408f, -0.33099f, 0.93056f,
+  },
+  {
+    0.53117f, 1.12240f, 0.50968f, 1.24276f, 0.14797f, -0.52614f, -0.70337f, -0.20507f, 0.40120f, 0.86937f,
+    0.55410f, -0.56567f, -0.52682f, -1.12741f, 0.03220f, 1.02911f, 0.69184f, 0.37546f, -0.38854f, 0.83586f,
+    1.12931f, 0.50712f, 0.25196f, 0.69601f, 1.30033f, -0.76302f, -0.15743f, 0.82526f, 0.49508f, 0.22448f,
+    0.86332f, 0.26527f, -1.29888f, 0.45611f, 0.49530f, -2.27738f, -2.60735f, -0.67612f, 0.52197f, 2.31475f,
+  },
+  {
+    0.55582f, 0.95988f, 0.14254f, 0.80561f, 0.23319f, -0.26027f, -0.35504f, -0.19642f, 1.04569f, 0.88504f,
+    0.28179f, -0.43975f, -1.76665f, -1.33723f, -0.37342f, 0.86072f, 0.55871f, -0.47737f, -0.31621f, 0.40136f,
+    1.55035f, 0.11330f, -0.02709f, 1.09359f, 1.69233f, 0.36060f, -0.29451f, 0.09198f, -0.66920f, 0.98117f,
+    0.91413f, -0.39095f, -0.73471f, 0.71021f, 0.23888f, -0.93860f, -0.81025f, -1.28524f, -0.40913f, 1.31316f,
+  },
+  {
+    0.52343f, 0.90483f, -0.02759f, 0.51135f, 0.54594f, 0.51248f, 0.02386f, -0.22236f, 0.03396f, -0.18405f,
+    -0.70263f, -1.16523f, -0.96321f, -0.26739f, 0.22489f, 1.16155f, 0.61292f, 0.28567f, -0.74557f, 0.50687f,
+    0.23640f, -1.51386f, -0.26111f, 1.19242f, 2.30878f, 0.76460f, 0.42010f, 0.07608f, -0.72031f, 0.39945f,
+    0.76781f, -0.58982f, -0.84885f, 0.87085f, 0.17169f, -2.00109f, -2.56530f, -1.07177f, -0.32106f, 1.27088f,
+  },
+  {
+    0.53001f, 0.39559f, -0.22882f, 0.00582f, 0.26348f, -0.12813f, -0.10924f, 0.36186f, 0.19775f, -0.01623f,
+    -0.94058f, -1.80072f, -2.08627f, -1.97882f, -1.17054f, 0.45819f, 0.83916f, 0.46727f, -0.78008f, -0.17005f,
+    0.63183f, 0.30003f, -0.15608f, 0.65974f, 0.43626f, -0.55119f, -0.55546f, 1.16751f, -0.32653f, 0.26247f,
+    0.47167f, -0.34608f, -1.57015f, -0.08770f, 0.10308f, -2.11799f, -2.31122f, -1.99560f, -0.07491f, 2.01177f,
+  },
+  {
+    0.69305f, 1.22937f, 0.08296f, 0.14856f, -1.34678f, -1.43059f, -0.38801f, -0.68640f, -0.87301f, -0.63425f,
+    -0.77920f, -1.08456f, -1.01122f, -1.48738f, -0.99556f, -0.28579f, -0.19125f, 1.06860f, 0.47613f, -0.01457f,
+    0.18811f, -0.08671f, -0.22570f, -0.26022f, 1.36455f, 0.12489f, 0.36514f, -0.21240f, 0.14594f, 1.01198f,
+    -0.10685f, -0.56323f, 0.31962f, 1.50910f, 0.77912f, -0.74111f, 0.30761f, 0.10901f, 0.34948f, 1.24481f,
+  },
+  {
+    0.39912f, 0.13352f, 1.19530f, 0.76839f, 1.17181f, 1.46850f, -0.22751f, -0.86825f, -0.41542f, 0.12601f,
+    -0.14251f, 0.40746f, -1.04728f, -2.29333f, -2.27070f, -1.09855f, 0.29890f, 0.92402f, 0.31354f, -0.61342f,
+    -0.50450f, -0.04649f, -0.83287f, -0.75751f, 0.45081f, 1.19925f, 1.24102f, 0.87696f, 2.12692f, 0.56326f,
+    -2.23557f, -0.76688f, 1.33441f, -0.24407f, -0.68749f, -0.14971f, 0.18848f, 0.49504f, 0.98599f, -1.72078f,
+  },
+  {
+    0.40225f, 0.58577f, 1.56238f, 1.05362f, 1.09722f, 1.21049f, 0.66291f, 0.30429f, 0.51405f, 1.36248f,
+    0.80647f, 0.28616f, -1.03969f, -2.45297f, -2.42406f, -1.14892f, 0.74148f, 1.65519f, 0.50752f, -0.55071f,
+    -0.25056f, 1.02129f, 0.36292f, -0.53449f, 1.13768f, 1.19279f, 0.97871f, 1.07975f, 1.81611f, 0.05596f,
+    -2.35469f, -1.02342f, 2.37539f, 0.22455f, -0.74563f, -0.71398f, -0.79465f, 0.07426f, 1.31196f, -1.14002f,
+  },
+  {
+    0.40317f, 0.57632f, 2.04406f, 1.68845f, 1.02489f, 0.45620f, -0.39616f, 0.30987f, 0.34836f, 0.34768f,
+    0.62292f, -0.14818f, -0.86153f, -1.53899f, -1.31850f, -0.61593f, 0.43241f, 1.12108f, -0.15346f, -0.57530f,
+    0.75407f, 1.50826f, 0.05998f, -1.16521f, -0.32792f, 2.47875f, 3.26647f, 0.60789f, 0.44029f, 0.10858f,
+    -1.06795f, 0.57982f, 1.81857f, -0.01807f, -0.88775f, -0.45369f, -0.00961f, 0.71358f, 1.75408f, -1.15464f,
+  },
+  {
+    0.39273f, 0.30078f, 1.76534f, 0.70174f, 0.24386f, 0.45475f, 0.70424f, 0.68532f, 1.06856f, 1.25660f,
+    0.31212f, -0.32044f, -0.95603f, -2.00174f, -2.32123f, -0.86065f, 0.96366f, 1.38107f, 0.08893f, -1.01791f,
+    -0.60646f, 1.66157f, 1.01202f, -0.79283f, 0.32187f, 1.25580f, 1.04878f, 1.09066f, 1.76931f, 0.75335f,
+    -1.87470f, 0.37131f, 2.13838f, 0.27242f, -0.37244f, 0.13272f, 0.79292f, -0.88915f, -1.26404f, -2.20169f,
+  },
+  {
+    0.42782f, 0.59485f, 1.27145f, 0.98785f, 0.71900f, 0.18137f, -0.53027f, -0.65806f, 0.06360f, 0.22545f,
+    0.13621f, -0.04889f, -1.03549f, -1.73593f, -1.48314f, -0.04785f, 0.80636f, 0.46949f, 0.06622f, -0.61792f,
+    0.79775f, 1.65748f, -0.68054f, -1.38213f, 0.27287f, 1.38136f, 1.20001f, 1.82724f, 2.59483f, 0.92266f,
+    -2.02847f, -1.14590f, 0.58865f, -0.55524f, -0.57209f, 0.23543f, -0.04788f, 0.05933f, 0.61376f, -2.33435f,
+  },
+  {
+    0.38712f, 0.41497f, 1.69150f, 0.18914f, 0.73923f, 1.22184f, 0.46765f, 0.81074f, 1.03334f, -0.09534f,
+    -0.78256f, 0.12297f, -0.60994f, -1.96664f, -2.12847f, -0.51353f, 0.40733f, 1.02386f, 0.74023f, -0.26335f,
+    0.43395f, 1.57435f, -0.11785f, -1.42273f, 0.10297f, 2.31840f, 2.40003f, 1.29047f, 1.24497f, 0.57498f,
+    -1.24087f, 0.49558f, 2.47161f, 0.38385f, -0.41759f, -0.24251f, -1.42400f, -0.70787f, 0.95862f, -1.57266f,
+  },
+  {
+    0.41226f, 0.53395f, 2.05694f, 1.15838f, 0.81233f, 1.27974f, 0.69879f, 0.57949f, 0.77096f, 0.68277f,
+    0.42617f, 0.76337f, 0.10480f, -1.40516f, -2.04660f, -0.81356f, 0.32498f, 0.61845f, -0.30155f, -0.61210f,
+    0.24685f, 0.88275f, -0.16340f, -1.23416f, 0.55534f, 3.05969f, 2.49813f, 1.42982f, 1.43448f, 0.43178f,
+    -1.68943f, -0.35559f, 1.64860f, 0.18144f, -0.45336f, 0.36487f, 0.50940f, -0.48377f, -0.14474f, -1.45280f,
+  },
+  {
+    0.44257f, 0.88570f, 1.51615f, 0.13634f, 1.07175f, 1.26843f, 0.68005f, -0.08778f, -0.47124f, 0.34157f,
+    0.87401f, 0.00128f, -0.86073f, -1.81057f, -2.12921f, -0.92359f, 0.57701f, 0.63040f, 0.33320f, -0.44185f,
+    -0.00313f, 1.01086f, -0.62944f, -1.30068f, 0.13235f, 1.76778f, 1.42737f, 0.71986f, 1.20250f, 0.88808f,
+    -1.13317f, -0.51623f, 0.78592f, -0.52139f, -0.34474f, 0.73137f, 0.71846f, -0.20054f, 0.09365f, -1.58542f,
+  },
+  {
+    0.38380f, 0.72733f, 2.37257f, 2.19028f, 1.53031f, 1.18739f, 0.97627f, 0.06266f, 0.13905f, 1.21879f,
+    0.71816f, -0.07602f, -0.50816f, -1.30515f, -1.30148f, -0.04139f, 1.33643f, 1.85100f, -0.03462f, -1.55792f,
+    -0.90886f, 1.55705f, 0.12682f, -1.16972f, 0.40347f, 1.78478f, 2.32898f, 1.48143f, 1.51939f, 1.09146f,
+    -1.92740f, -1.38681f, 0.88580f, -0.45731f, -0.16196f, 0.63556f, 0.93959f, 0.15572f, -0.15454f, -1.78796f,
+  },
+  {
+    0.46565f, 0.94062f, 1.65913f, 0.73393f, 0.80339f, 0.38805f, -0.32334f, -0.64413f, -0.17424f, 0.34549f,
+    0.44580f, -0.51806f, -0.37240f, -0.74013f, -1.14694f, -0.22951f, 0.66998f, 0.70032f, -0.26614f, -0.20715f,
+    0.72165f, 0.31290f, -1.09893f, -0.43649f, 0.64078f, 0.81030f, 0.27428f, 1.25062f, 1.73922f, -0.51329f,
+    -0.86102f, 0.74157f, 0.49909f, -0.37734f, 0.52352f, 0.15494f, -0.64386f, 0.06694f, 0.85536f, -0.68671f,
+  },
+  {
+    -1.02526f, -1.57758f, 0.71883f, 0.71979f, 0.89075f, 0.53490f, 0.12961f, 0.39492f, 0.64011f, 0.81748f,
+    0.73137f, -0.26976f, -0.30852f, -0.09522f, -0.36285f, -0.65351f, -0.47753f, 0.61845f, 1.16958f, 1.03207f,
+    0.57286f, 0.03691f, 0.32520f, 0.00827f, 0.21457f, -0.38548f, -0.82081f, -0.12866f, 0.33619f, 0.25438f,
+    -0.30082f, 0.63298f, 0.66103f, 0.69049f, 0.35803f, -0.24481f, -0.76668f, -0.18540f, -0.50440f, -0.68278f,
+  },
+  {
+    -1.22275f, -0.94782f, -0.33322f, 0.63749f, 0.24024f, 0.36815f, 0.96396f, 0.52322f, 0.20108f, 0.24662f,
+    0.77859f, 0.53811f, 0.93641f, -0.57377f, -1.11069f, -1.90779f, -0.94578f, 0.57337f, -0.15301f, 0.68874f,
+    0.31869f, -0.21310f, 0.33495f, -0.21819f, 0.91258f, 0.46432f, 0.73087f, 0.54109f, 0.36331f, 1.53441f,
+    0.44894f, 1.29296f, -0.26772f, -0.09985f, 0.07255f, 0.97682f, -0.80737f, -0.77325f, -0.65727f, -0.24554f,
+  },
+  {
+    -1.20331f, -0.80509f, -1.56245f, -1.18721f, -1.14182f, 0.48095f, 1.14330f, 0.43951f, 0.49492f, 0.80883f,
+    0.83436f, -0.28872f, 0.15019f, 0.02687f, -0.95167f, -1.15416f, -1.24810f, -0.51012f, 0.10810f, 0.11058f,
+    -0.24851f, 0.43299f, -0.69276f, 0.15057f, 0.57455f, -0.09988f, 1.35096f, 0.86053f, 0.46688f, 1.57257f,
+    1.94804f, 1.14403f, 0.45450f, -1.09539f, 0.40853f, 0.57317f, 0.71586f, -0.59708f, 0.97039f, -0.20888f,
+  },
+  {
+    -1.24399f, -0.96079f, -0.29799f, 0.06742f, 0.07657f, -0.99667f, -0.53371f, 0.31829f, -0.07669f, -0.35620f,
+    -0.37938f, -0.21397f, -0.14248f, -0.49343f, -1.17963f, -1.41228f, -0.77048f, -0.02591f, 0.31048f, 1.17330f,
+    -0.75795f, -1.03042f, -0.36439f, -0.50455f, 0.25796f, 0.19459f, 0.09034f, 0.48595f, 0.97002f, 1.66786f,
+    1.76858f, 2.08045f, 0.23243f, -1.05874f, 0.64856f, 2.86853f, 0.84840f, -1.97625f, -0.18971f, 0.68566f,
+  },
+  {
+    -1.23915f, -1.17306f, -0.84880f, -2.07166f, -0.32295f, 0.75054f, 0.04847f, 0.49927f, -0.32131f, -1.69461f,
+    -0.72651f, -0.53626f, -1.46923f, -0.59494f, -0.14859f, -0.51910f, -0.67417f, -0.82757f, 0.63922f, -0.12890f,
+    -1.49093f, -0.84305f, -0.96320f, 0.56248f, 0.33561f, 0.21704f, -0.27040f, 1.65499f, 1.43218f, 1.02955f,
+    1.02403f, 1.99164f, 0.03630f, -0.80700f, 0.35056f, 0.80829f, -0.45331f, -0.14043f, 0.16208f, -0.12750f,
+  },
+  {
+    -1.20398f, -1.07600f, -0.22665f, -0.14000f, 0.00944f, -0.47475f, -0.34528f, 0.22383f, -0.38580f, -0.73573f,
+    -0.17058f, -0.31916f, -0.38851f, 0.17248f, -0.61685f, -1.14919f, -0.82639f, -0.28758f, 0.40636f, 0.59630f,
+    -0.77454f, -0.13629f, 1.07275f, 0.71936f, 0.05003f, -0.87035f, -0.34743f, 0.18410f, 0.74055f, 1.99986f,
+    0.91371f, -0.76093f, -0.80615f, 0.16903f, 1.56103f, 0.79421f, -0.59947f, 0.06312f, 0.60088f, 1.00322f,
+  },
+  {
+    -1.24392f, -1.09861f, -0.97987f, -0.50540f, 0.00426f, 1.34263f, 0.62798f, -0.03866f, -0.19553f, 0.00584f,
+    0.11080f, -0.50234f, -1.44707f, -0.53597f, -1.21792f, -1.01113f, -0.44832f, 0.20150f, 1.20328f, 0.72083f,
+    0.65017f, -0.81276f, 0.11258f, -0.53918f, -0.61095f, 0.24366f, 0.11543f, -0.19720f, 1.12047f, 1.83341f,
+    1.43640f, 1.31209f, -0.24026f, 0.69249f, 1.46809f, -0.18629f, -0.42145f, -0.30951f, -0.03479f, 1.51058f,
+  },
+  {
+    -1.24461f, -1.36982f, -0.08403f, 1.53700f, -0.96744f, -1.55339f, 0.17556f, 0.48216f, 0.21956f, 0.00521f,
+    -0.39724f, -0.89560f, 0.13254f, 0.43876f, -0.74309f, -1.61495f, -0.66013f, 0.44790f, 0.76202f, 0.32496f,
+    -0.12338f, -0.96415f, -0.36065f, -0.19769f, 0.00856f, 0.87179f, -0.24908f, -0.44597f, 0.46585f, 0.73360f,
+    1.97334f, 0.64466f, -0.59941f, 0.21444f, 1.67954f, 0.56384f, 0.28068f, 0.00661f, -0.68788f, 0.00350f,
+  },
+  {
+    -1.04825f, -1.05800f, -0.09384f, 0.06205f, 0.53917f, 0.80916f, -0.15195f, 0.90268f, 0.46075f, 0.40815f,
+    -0.19031f, -0.04698f, 0.79759f, -0.02642f, -0.91451f, -0.74280f, -0.71984f, 0.11042f, 0.45288f, 0.37593f,
+    0.44032f, 0.06304f, 0.42759f, 0.16339f, 0.50775f, -0.34067f, -0.40551f, -0.14981f, 0.57434f, 1.16466f,
+    0.50544f, -0.39571f, -0.71330f, -0.49613f, 0.26162f, 0.42623f, 0.36785f, 0.22563f, 0.52189f, 0.15888f,
+  },
+  {
+    0.52452f, 0.51261f, -0.55155f, -0.14271f, 0.86951f, 1.10308f, 0.66221f, 0.93648f, 0.87404f, 0.02421f,
+    -0.16252f, -0.03697f, 0.90431f, 0.26538f, -0.92384f, -1.21984f, -1.42559f, -1.44297f, -0.51547f, -0.11205f,
+    -0.27002f, -0.82109f, 1.00351f, -0.57033f, 0.29385f, 0.75715f, 0.47382f, -0.96635f, 0.61225f, 0.10413f,
+    -0.70192f, -0.70094f, -0.21886f, 0.20237f, 0.51526f, -0.67244f, -1.23777f, -1.45814f, -0.25846f, 0.76381f,
+  },
+  {
+    0.75205f, 0.64706f, -0.44397f, -0.15477f, -0.80337f, 0.20652f, 0.23167f, 1.10151f, 1.02587f, 0.03480f,
+    0.27056f, 0.60668f, 1.07093f, 0.10991f, -0.03598f, -0.77384f, -0.86143f, -0.70847f, -0.06193f, 0.41718f,
+    -0.23983f, -0.76787f, -1.05897f, -0.42265f, 0.06345f, 0.02991f, 0.24228f, 0.68370f, 1.12259f, 0.87101f,
+    0.21363f, 2.37056f, 1.81666f, 0.93526f, 1.32724f, 0.26740f, -2.10711f, -1.48787f, 0.63506f, 0.36208f,
+  },
+  {
+    0.73612f, 0.35547f, -0.88815f, -0.75913f, -0.30962f, -0.70832f, -0.01659f, 0.92556f, -0.39666f, -0.60065f,
+    -0.28251f, -0.48083f, -0.14798f, 0.42384f, -0.49321f, -1.00663f, -1.48466f, -0.99545f, 0.16938f, -0.46058f,
+    -1.08748f, -0.63227f, -2.52200f, 0.93469f, 1.41538f, -0.08813f, -1.10864f, -0.36313f, -0.12743f, 0.72868f,
+    0.03596f, 1.62319f, 1.80470f, 1.97374f, 1.66421f, -0.51081f, 0.54336f, -0.32017f, 0.62204f, 0.25730f,
+  },
+  {
+    0.74245f, 0.28293f, -0.67124f, -0.23313f, 0.31834f, 0.10899f, -1.32627f, -1.32795f, -0.33953f, -0.87476f,
+    -0.58152f, 0.67388f, 0.52867f, 0.76571f, -0.64709f, -1.59398f, -2.01582f, -1.12582f, -0.09536f, 0.71422f,
+    0.93572f, -0.10023f, -1.36192f, -0.05963f, 0.18096f, -0.17234f, -1.14692f, 0.01468f, 0.83702f, 1.20883f,
+    0.97303f, 1.24010f, 1.55280f, 0.29013f, 0.16824f, 0.23347f, 1.87610f, 0.20047f, 0.34570f, 1.36678f,
+  },
+  {
+    0.70954f, -0.03335f, -0.52369f, 0.40006f, 0.30729f, 0.44758f, 0.56358f, 0.20764f, -0.01421f, -0.43817f,
+    0.53880f, 0.37891f, -0.29963f, 0.26383f, -0.81622f, -1.27013f, -1.36179f, -1.64390f, -0.72230f, 0.49260f,
+    0.07873f, -0.54885f, -1.05764f, 0.58409f, 1.10846f, -0.22663f, -1.60489f, 0.12921f, 1.02461f, 0.69721f,
+    -0.48010f, 1.99039f, 2.42624f, 0.46462f, 0.03073f, 0.83886f, 0.17196f, -1.12919f, 0.25112f, 0.77076f,
+  },
+  {
+    0.72395f, 0.37474f, 0.08630f, 0.15673f, 0.51426f, 1.27589f, 0.24581f, 0.15698f, 0.24121f, -0.07285f,
+    1.27633f, 1.39613f, 0.57323f, -0.07087f, -1.14521f, -1.62499f, -1.23184f, -0.62440f, -0.34983f, -0.35374f,
+    -1.00855f, -0.44481f, 0.05281f, -0.59585f, 0.35455f, 1.00822f, -0.40275f, -0.66129f, 0.11103f, -1.71901f,
+    -0.07313f, 2.32393f, 0.89871f, -0.43951f, -0.36522f, 0.72576f, -0.62257f, 0.13809f, 0.57365f, 0.03520f,
+  },
+  {
+    0.73871f, 0.08381f, 0.26820f, 0.42055f, 0.40639f, 1.21518f, 0.55507f, -0.31484f, 0.21420f, 0.81091f,
+    0.34035f, 0.55440f, 1.48742f, 0.80395f, -0.71342f, -2.02018f, -1.64005f, -0.71577f, 0.02154f, -0.01986f,
+    -0.14935f, -0.67435f, -1.37445f, 0.42512f, 1.04701f, 0.58105f, -0.16650f, -0.83808f, 0.51410f, 0.49957f,
+    -0.27895f, 1.73149f, 1.56018f, 0.53565f, 0.39172f, -0.00028f, -2.36250f, 0.41738f, 1.18549f, 1.02922f,
+  },
+  {
+    0.72283f, -0.64502f, -1.36393f, -1.03361f, -0.76200f, 0.80425f, 0.45935f, 0.55188f, 0.35749f, -0.44682f,
+    0.12993f, -0.75771f, 0.11430f, 0.16220f, -0.70487f, -2.43082f, -2.50900f, -2.13088f, -0.70726f, -0.23384f,
+    -0.44030f, 0.01724f, -0.19828f, -0.12960f, 0.46886f, -0.88613f, -0.44384f, -0.70333f, 0.46577f, 1.06972f,
+    0.91891f, 1.02854f, -0.09845f, 0.51451f, 0.44231f, -0.60965f, -0.85267f, 0.30694f, 0.28409f, -0.11306f,
+  },
+  {
+    0.75558f, 0.51245f, -0.30394f, -1.15250f, 0.81016f, -0.03174f, 0.29683f, -0.06851f, 0.90705f, 0.03422f,
+    -0.41927f, 0.77505f, 0.18238f, -0.74085f, -0.37741f, -1.05356f, -1.69591f, -1.46856f, 0.25863f, 0.76991f,
+    -0.55473f, -0.00011f, -1.32894f, -0.36085f, 0.42849f, 1.30745f, 1.23208f, 0.37391f, -0.45581f, -0.36115f,
+    0.20325f, 1.35946f, 0.99549f, -0.04985f, 0.53156f, 0.54732f, 0.51155f, -0.29058f, 0.09346f, 0.53913f,
+  },
+  {
+    0.75937f, 0.28051f, 0.06470f, 0.22964f, 0.04071f, -0.01057f, 0.77701f, 0.13267f, 0.05249f, 0.41547f,
+    -1.28573f, -0.18675f, -0.23767f, -0.12832f, 0.08834f, -0.65923f, -0.88300f, -1.76351f, -1.07776f, 0.53701f,
+    0.25312f, -0.04919f, -0.43565f, -0.09436f, 0.27807f, -0.61281f, -2.11699f, -0.87863f, 0.66221f, -0.42932f,
+    0.05542f, 1.47990f, 1.37452f, 0.48735f, 0.28938f, -1.14544f, 0.18935f, -0.17450f, 0.36898f, 0.60264f,
+  },
+  {
+    0.67856f, 0.70076f, -0.19038f, 0.72745f, 1.26035f, 0.32467f, -0.01145f, 0.84116f, 0.65639f, 1.00751f,
+    0.02467f, -0.72882f, -0.48112f, 0.19089f, 0.15230f, 0.37403f, -0.74314f, -1.97289f, -1.26049f, -0.06697f,
+    -0.05552f, -0.14093f, 0.00293f, -0.14394f, 0.25830f, -0.22981f, 0.24897f, 0.57560f, 0.34043f, -1.84647f,
+    -1.07139f, -0.18655f, 0.87183f, 0.87081f, -0.11375f, 0.80727f, 1.25082f, 0.13967f, -0.42402f, -0.23945f,
+  },
+  {
+    0.51059f, 0.64999f, 0.79574f, 0.94598f, 0.68231f, 0.61407f, 0.62086f, 0.55603f, 0.81799f, -0.98484f,
+    -1.49490f, 0.01752f, -0.36188f, -0.07138f, 0.28578f, 0.27667f, -0.97738f, -0.90098f, -0.82283f, -0.39479f,
+    0.27415f, 0.36395f, -1.65678f, -1.34687f, 0.36170f, 1.39874f, 0.91993f, -1.21571f, -0.74914f, -0.63760f,
+    -0.21096f, 0.30298f, 0.42019f, 1.24267f, 1.44307f, 0.18450f, 0.07476f, 0.60192f, -0.11081f, -0.83217f,
+  },
+  {
+    0.55511f, 0.86458f, 0.05264f, 0.65919f, 0.80768f, 0.54500f, 1.02655f, 1.02176f, 0.15748f, -1.07493f,
+    -1.47953f, -0.36988f, 0.13157f, 0.60227f, 0.13152f, -0.14562f, -0.45179f, -1.02828f, -1.19456f, -0.89139f,
+    -0.53864f, -0.31878f, -0.61495f, -0.29725f, 0.13661f, 0.74323f, 0.75394f, -0.26724f, -0.29178f, 0.22038f,
+    0.15186f, -0.15105f, 0.68221f, 1.03127f, 2.02802f, 1.14958f, 1.46857f, -0.12679f, -1.83220f, -1.02894f,
+  },
+  {
+    0.49748f, 0.40260f, 0.13410f, 0.72494f, 0.24331f, 0.12565f, -0.24563f, 0.37101f, 0.47600f, -0.25640f,
+    -0.21267f, 0.74445f, 0.75151f, 1.20071f, 0.83883f, -0.21216f, -1.52217f, -2.23976f, -1.02279f, -0.45862f,
+    -0.14712f, 0.71296f, -0.94065f, -1.56355f, -0.73019f, -0.05782f, -0.93231f, -2.23471f, -1.29736f, 0.37591f,
+    0.41559f, -1.78063f, -1.42638f, 1.68031f, 1.96518f, 0.28119f, 0.15804f, 0.45996f, -0.24115f, 0.34953f,
+  },
+  {
+    0.53882f, 1.36298f, 0.50497f, 0.90295f, -0.00921f, 0.49438f, 1.40897f, -0.06263f, -0.68826f, -1.49697f,
+    -0.82294f, -0.06559f, 0.20020f, 0.73631f, 0.91541f, -0.29263f, -1.70347f, -1.07282f, -0.87684f, -0.31495f,
+    -0.44998f, 0.04452f, -0.52382f, -0.92703f, -0.44296f, -0.44046f, -0.55320f, -2.00179f, -1.59405f, 0.51903f,
+    0.44098f, -1.96353f, -0.99429f, 1.14029f, 1.39655f, -0.06124f, 0.29898f, 0.92925f, -0.85135f, -0.67843f,
+  },
+  {
+    0.53950f, 1.11586f, 0.29820f, 0.52897f, 0.53398f, 0.41551f, 1.10426f, 0.65107f, 1.09207f, 1.15008f,
+    -0.44106f, -0.55486f, 0.33682f, 1.01197f, 0.85820f, -0.28723f, -1.09381f, -2.07423f, -1.87662f, -0.66753f,
+    -0.36953f, -0.34920f, -0.38095f, -1.47801f, 0.13489f, 2.00505f, 1.30807f, -0.73419f, -1.06047f, 1.33144f,
+    0.22455f, -0.98831f, -0.89050f, 0.95302f, 2.06117f, 0.20141f, -0.41096f, 0.72997f, -0.59419f, -0.75465f,
+  },
+  {
+    0.54649f, 1.22722f, 0.59975f, 0.51725f, -0.21340f, 0.26888f, 0.68677f, 0.59422f, 0.59936f, -0.11362f,
+    -0.48179f, 0.15245f, 0.27834f, 0.84886f, 0.46952f, -0.02435f, -0.85889f, -1.01304f, -1.26709f, -1.45453f,
+    -0.10161f, 0.57737f, -0.61587f, -0.81107f, 0.06673f, 0.61031f, 0.32295f, -0.65700f, -0.15838f, 1.21492f,
+    0.34820f, -1.57607f, 0.17969f, 0.23286f, 1.91521f, 0.70119f, 0.92469f, 0.77578f, -0.29171f, -0.38796f,
+  },
+  {
+    0.57598f, 1.35060f, 0.29398f, 0.58210f, 0.46566f, -0.23038f, 0.75317f, 0.90962f, 0.29228f, 0.15458f,
+    -0.92016f, -0.60925f, -0.01015f, 0.87705f, -0.04610f, -0.35261f, -0.97731f, -1.29554f, -1.29042f, -0.66152f,
+    0.30742f, 0.88489f, -1.65093f, -1.08234f, 0.45362f, 1.10234f, 0.32176f, -1.54940f, -1.05332f, -0.20506f,
+    0.05160f, -0.75284f, -0.63107f, 0.91136f, 2.33727f, 1.32479f, -0.31863f, 0.59195f, -0.16790f, 0.37676f,
+  },
+  {
+    0.55281f, 1.04831f, -0.27960f, 0.31955f, 0.80667f, 1.43400f, 0.46125f, 1.26370f, 0.66279f, 1.44609f,
+    0.35384f, -0.31217f, 0.28070f, 0.58651f, 0.02905f, -1.10580f, -1.14574f, -1.27266f, -1.31819f, -0.02781f,
+    -0.78585f, -0.65165f, -0.58216f, -0.21698f, -0.15069f, 0.30047f, 0.21862f, -0.22624f, 0.62483f, 0.68585f,
+    -0.99977f, -1.91803f, -0.74484f, 1.05648f, 2.78199f, 1.12112f, -0.30780f, -0.25597f, -1.32968f, -0.49579f,
+  },
+  {
+    0.57839f, 1.79915f, 0.10579f, 0.24330f, 0.16225f, 0.70753f, -0.37540f, -0.18918f, -0.17225f, -0.35249f,
+    0.11248f, 0.15718f, 0.29597f, 0.39137f, -0.10604f, -1.19238f, -1.26179f, -0.66331f, -0.90426f, -0.19657f,
+    0.14004f, -0.11698f, -0.96021f, -0.81507f, 0.13725f, 0.42002f, -0.60926f, -1.41058f, -1.18616f, -0.03479f,
+    -0.18805f, -0.98113f, 0.06233f, 0.74969f, 1.84130f, 0.96874f, -0.41368f, 0.86884f, -0.07331f, -0.43820f,
+  },
+  {
+    0.50376f, 1.81017f, -0.18713f, 0.76379f, 0.85011f, 1.12053f, 0.67576f, 0.91900f, -0.14410f, 0.14042f,
+    0.01596f, 0.19261f, 1.01660f, 1.02324f, 0.68851f, -0.11122f, -1.18810f, -0.90223f, -0.83048f, -0.97204f,
+    0.43464f, 1.00540f, 0.16867f, -0.02565f, 0.27788f, -0.43469f, 0.45622f, -0.93104f, -1.05410f, 0.27536f,
+    0.38230f, 0.26126f, -0.37748f, 0.42892f, 0.41926f, 0.09586f, -0.18228f, -0.31401f, 0.55779f, 0.03576f,
+  },
+  {
+    -1.03608f, 1.21569f, -1.61738f, -0.72957f, -0.13220f, 1.35799f, -0.39516f, 1.15562f, -0.29719f, 0.25582f,
+    0.47045f, -0.35094f, 0.65460f, 0.49188f, 0.17080f, 0.20501f, 0.12557f, 0.26783f, 0.63330f, 0.11653f,
+    0.04850f, -0.25458f, -0.52164f, -0.30099f, 0.15294f, -0.29641f, 0.22524f, -0.08606f, 0.34759f, 0.28664f,
+    -0.09680f, 0.29585f, -0.06533f, -0.27641f, 0.46259f, 0.29081f, 0.29507f, 0.00734f, 0.78354f, 0.69887f,
+  },
+  {
+    -1.80271f, 0.72117f, 1.47763f, 1.03495f, 1.33458f, 1.76651f, 1.40793f, 0.79791f, 0.47630f, 0.69068f,
+    1.10008f, 0.45331f, 0.15050f, 0.56964f, 0.68837f, 0.36059f, -0.10519f, -0.97172f, -2.40279f, -2.65373f,
+    -1.44881f, -0.00164f, 0.97440f, 0.21975f, -0.23542f, -0.64317f, 0.89746f, 1.35577f, -0.80846f, -1.67356f,
+    -0.09950f, 1.01136f, -0.46440f, -1.66277f, 0.49576f, 1.65878f, 0.16657f, 0.25811f, 1.91188f, 0.68665f,
+  },
+  {
+    -1.79635f, 0.44794f, 0.60410f, 0.74855f, 0.84747f, 0.99317f, 0.42847f, -0.32644f, -0.13735f, 0.15173f,
+    -0.20930f, 0.28653f, 0.65607f, 0.86089f, 0.56805f, 0.27777f, -0.11870f, -1.25274f, -2.39775f, -2.34128f,
+    -2.29744f, -0.68239f, 0.47773f, -0.42191f, -1.40632f, -1.22134f, 0.96905f, 0.64844f, -0.69982f, -0.95877f,
+    0.24810f, 1.58061f, -0.10433f, -1.30360f, 0.20327f, 1.40363f, 0.89931f, 0.57740f, 2.09836f, 0.84142f,
+  },
+  {
+    -1.78328f, 0.53608f, 0.88269f, 0.90988f, 0.29612f, 0.55729f, 1.42879f, 0.82280f, -0.33540f, -0.39363f,
+    0.67819f, 1.43138f, 0.92901f, 0.38063f, 0.18620f, -0.24055f, -0.34188f, -1.34406f, -1.56016f, -2.18169f,
+    -2.55098f, 0.16909f, 1.08143f, -0.76506f, -1.75849f, -1.33369f, 0.61512f, 0.61717f, -0.52749f, -1.08441f,
+    0.10596f, 0.23811f, -1.42356f, -2.18009f, 0.15950f, 1.61192f, 1.43409f, 0.52139f, 1.62320f, 0.68794f,
+  },
+  {
+    -1.77766f, 0.68414f, 1.02501f, 0.76725f, 1.03671f, 1.29063f, 0.95472f, 0.71506f, -0.25943f, -1.12762f,
+    -0.79022f, 0.45403f, 1.00464f, 0.81911f, 0.06760f, -0.44827f, -0.04502f, -0.43945f, -1.67475f, -2.37213f,
+    -2.24907f, -0.54810f, 0.32449f, -0.55099f, -0.99737f, -0.29793f, 0.66602f, 0.45471f, -0.72494f, -1.36862f,
+    -0.30845f, 1.54273f, -0.47388f, -2.06165f, 0.23121f, 1.77355f, 2.00669f, 0.68199f, 1.04333f, 0.10581f,
+  },
+  {
+    -1.76151f, 0.66276f, 1.15744f, 1.12475f, 0.75389f, 0.53863f, 0.16083f, 0.39106f, 0.72101f, 0.50966f,
+    0.26132f, 0.07173f, 0.69093f, 0.55801f, 0.33498f, 0.05797f, -0.05810f, -1.05300f, -2.24909f, -2.30457f,
+    -1.15523f, 0.24538f, 0.68173f, -0.09235f, -1.38266f, -1.44824f, 1.03620f, 1.69321f, -0.07889f, -0.40797f,
+    -0.09397f, 0.69632f, 0.17401f, -1.33212f, 0.12395f, 1.49388f, 0.99956f, 0.64437f, 2.35607f, 1.15269f,
+  },
+  {
+    -1.74966f, 0.87007f, 1.04637f, 1.29402f, 1.68677f, 1.22683f, -0.14978f, -0.38963f, -0.46216f, -0.46764f,
+    0.00321f, -0.00294f, -0.05564f, 0.12619f, 0.57729f, 0.62880f, -0.10171f, -1.06928f, -1.60743f, -2.38106f,
+    -1.68397f, 0.44718f, 1.04238f, 0.30905f, -0.89439f, -1.33793f, 0.14580f, 0.30676f, -0.52374f, -0.48957f,
+    -0.10156f, 0.42280f, -0.29793f, -1.37214f, -0.09088f, 1.11171f, 0.91485f, 0.55607f, 2.26394f, 0.83111f,
+  },
+  {
+    -1.78322f, 0.04370f, -0.19129f, 0.46090f, 0.89086f, -0.06106f, -1.18346f, -0.54294f, -0.11542f, -0.36060f,
+    -0.40087f, -0.35248f, -0.03301f, 0.05196f, -0.01219f, -0.29913f, -0.56586f, -1.34842f, -1.67888f, -2.22493f,
+    -2.11235f, -0.62552f, -0.41237f, -0.34133f, -0.70685f, -0.18630f, 0.88766f, 0.89484f, -0.81009f, -1.22641f,
+    -0.55469f, 0.12088f, 0.10525f, -0.26793f, 0.77968f, 1.28092f, 1.19473f, 1.15685f, 2.91070f, 1.13062f,
+  },
+  {
+    -1.73429f, 1.23503f, 0.63565f, 0.53075f, 0.21819f, -0.18566f, 0.08173f, 0.44056f, -0.15322f, -0.22098f,
+    0.18357f, 0.64507f, 0.28546f, 0.40238f, 0.07065f, -0.51064f, -0.47879f, -0.88796f, -1.55939f, -1.88233f,
+    -1.47605f, -0.20602f, 0.48013f, 0.20455f, 0.06048f, -0.54965f, -0.13328f, 0.26446f, -0.12631f, -0.70442f,
+    -0.42472f, 0.52557f, -0.38569f, -1.49314f, 0.32508f, 1.42216f, 1.27496f, 0.39263f, 1.62968f, 1.16907f,
+  },
+  {
+    -1.81139f, 2.13711f, 1.18901f, 1.40699f, 0.18982f, 0.05056f, 0.54539f, 1.18265f, 0.94737f, 0.74479f,
+    0.76041f, 0.49810f, 0.16300f, 0.42339f, -0.16664f, -0.39278f, -0.47463f, -0.52988f, -0.90445f, -0.70407f,
+    -0.04412f, 0.02949f, -0.18149f, -0.34751f, -0.16805f, 0.11569f, -0.19092f, 0.62741f, -0.21762f, -0.79858f,
+    -0.53783f, 0.01299f, -0.06948f, -0.40718f, 0.11464f, 0.26832f, 0.06983f, -0.03020f, 0.20625f, 0.52649f,
+  },
+};
+
+static const float mfcc_golden_tables[121][40] = {
+  {
+    0.77931f, -1.63415f, -0.99169f, -2.37838f, -3.97683f, -1.54900f, 1.07691f, 1.84897f, 0.15545f, 0.87406f,
+    0.63118f, 0.58422f, -1.30041f, 1.50219f, 1.03673f, 0.89809f, 1.43073f, 1.08954f, 0.20310f, -0.54072f,
+    0.13532f, 0.31042f, 0.49960f, 0.93125f, 0.17350f, 0.68777f, 1.09647f, -0.13233f, -1.02390f, 1.91757f,
+    -0.95053f, 0.35962f, 1.00613f, -0.65281f, -0.16938f, 0.59683f, 0.29306f, -1.56425f, -1.04541f, 0.37843f,
+  },
+  {
+    0.89718f, -2.06813f, -0.77774f, -0.04195f, -0.21138f, 0.72597f, 1.19167f, 1.35317f, 1.42625f, 1.50771f,
+    2.00010f, -1.05981f, -1.46619f, -0.15796f, -0.20661f, -0.21925f, 1.31131f, 1.28123f, -0.25881f, -1.12999f,
+    -0.97591f, -1.17401f, -0.15254f, 0.95373f, 0.34142f, 0.85129f, -1.19517f, -1.75601f, -1.39192f, 1.56813f,
+    -0.48838f, 1.29000f, 0.04660f, -0.44377f, -0.46395f, -0.63290f, 0.41936f, -0.50840f, 0.95928f, 0.48321f,
+  },
+  {
+    0.88471f, -2.01886f, -1.14543f, -2.27541f, -1.41304f, -0.99104f, 0.61502f, 0.95697f, 0.77262f, -0.07335f,
+    0.40578f, 0.21908f, -0.69952f, 0.20120f, -0.33211f, -0.12556f, 1.59400f, 0.39856f, -1.58494f, -0.95088f,
+    -0.87137f, -1.32926f, -0.41653f, 1.16436f, 0.51614f, 0.84098f, -1.17065f, -2.19610f, -0.66648f, 1.38956f,
+    -0.57852f, -0.29821f, -0.50935f, -0.08231f, -0.66772f, -1.56445f, 0.31899f, 0.38282f, 0.60559f, 0.78503f,
+  },
+  {
+    0.93642f, -1.97071f, -1.82653f, -1.87984f, -0.86012f, -0.38793f, 0.58812f, 1.88246f, 2.09100f, 0.11657f,
+    -0.16000f, 0.13641f, -0.12023f, 0.55946f, 0.34443f, 0.11794f, 1.56498f, 0.89806f, 0.35116f, -1.25315f,
+    -0.28218f, -0.24501f, 2.07099f, 0.47740f, -0.68984f, -0.83943f, -0.88558f, -0.93536f, -0.23845f, 1.72466f,
+    -0.28283f, -0.17887f, 0.45423f, 0.40093f, -0.05850f, -0.94650f, -0.00607f, 0.10788f, 1.09327f, 1.33844f,
+  },
+  {
+    0.95281f, -1.69353f, -1.59690f, -1.38745f, -1.02513f, -0.64338f, -0.50904f, 2.16102f, 1.60482f, 0.57174f,
+    -0.22564f, -0.38416f, 0.18851f, 0.46854f, -0.00498f, -0.11653f, 0.56437f, 0.25385f, 0.57354f, -0.39853f,
+    -0.75217f, -1.20180f, 0.64846f, 0.89689f, 0.65054f, 0.30041f, -0.41693f, -1.38191f, -0.50285f, 2.38459f,
+    0.85497f, 0.95991f, -0.64045f, -0.30955f, -1.04312f, -0.54508f, 0.46877f, -0.11009f, 0.96319f, 1.58027f,
+  },
+  {
+    0.96858f, -1.17207f, -0.80975f, -0.34478f, -0.99722f, -0.14888f, -0.96882f, 0.02365f, 1.55690f, 0.22717f,
+    -0.32726f, -1.38690f, -1.79298f, -0.09393f, 0.84968f, 0.64666f, 0.55261f, -0.26811f, -0.46998f, -1.41074f,
+    -0.48041f, -0.60299f, 1.17247f, 0.38471f, -0.88832f, -0.93595f, -1.18930f, 0.11519f, 0.39476f, 1.04055f,
+    -0.95285f, -0.93274f, 0.23177f, -0.11401f, -1.23055f, -1.51894f, 0.90830f, -0.07536f, 0.35930f, 1.36717f,
+  },
+  {
+    0.97103f, -1.69350f, -1.61959f, -1.50797f, -1.40872f, -0.85818f, 0.24743f, 1.44602f, 1.47532f, 1.42118f,
+    0.47610f, -0.21667f, -0.59189f, 0.86038f, 1.76703f, 1.19536f, 0.44073f, 0.64661f, 0.81929f, 0.72544f,
+    0.20086f, -0.53988f, 0.88455f, 0.60457f, -0.11112f, 0.16013f, -1.07589f, -0.84575f, -1.24793f, 0.14437f,
+    -0.24456f, -0.08371f, 0.44351f, -0.39975f, -1.65466f, -0.80616f, -1.15586f, -0.49642f, 0.65267f, 0.62551f,
+  },
+  {
+    0.90718f, -1.84664f, -0.00039f, -0.62989f, -2.00055f, -1.58323f, 1.08926f, 2.08830f, 0.85340f, 1.51022f,
+    -0.94167f, -0.99984f, -0.32474f, 1.20255f, 1.00747f, 1.06852f, 1.49811f, 0.35551f, 0.09325f, 0.20317f,
+    -0.38006f, -0.30397f, 0.49096f, 0.83502f, -0.23008f, -0.05581f, 0.19656f, -0.83735f, 0.05684f, 1.04598f,
+    -1.32515f, -0.17050f, 0.01482f, 0.95646f, -0.57270f, -1.85631f, -0.72068f, 0.05225f, -0.12861f, 0.17630f,
+  },
+  {
+    0.90610f, -2.37451f, -1.65221f, -0.37318f, -0.95682f, -1.07749f, 1.48500f, 1.39060f, 1.49933f, 1.49495f,
+    -0.07645f, 0.06433f, 0.23240f, 0.64709f, -0.43153f, 0.31796f, 0.55466f, -0.39224f, -0.79655f, -0.47254f,
+    -0.55055f, -0.61214f, 0.30113f, 0.98115f, 0.63013f, -0.23246f, -1.94187f, -1.63018f, 0.16217f, 1.91706f,
+    0.25861f, 0.86848f, -0.64855f, 0.09418f, -0.76139f, -0.65241f, 0.97319f, -0.00647f, 0.28620f, 1.43735f,
+  },
+  {
+    0.92904f, -1.86390f, -2.12227f, -1.60304f, -1.62990f, -1.64827f, 1.83409f, 1.22268f, 1.14247f, -0.24381f,
+    -0.55729f, -0.90875f, -0.12953f, 1.11201f, 1.08323f, 1.12623f, 1.00078f, 0.55122f, 0.21076f, -0.81621f,
+    0.00327f, 0.43871f, 0.08431f, 0.73516f, 0.63060f, 0.04102f, -0.95354f, -0.07344f, -1.29447f, 0.66747f,
+    -0.84406f, -0.10597f, 1.21937f, 0.58960f, -1.06024f, -0.21893f, 1.67911f, 0.54527f, -0.23533f, 0.28786f,
+  },
+  {
+    0.93104f, -0.65556f, -1.32305f, -2.94930f, -2.52746f, -1.29958f, 0.35898f, 1.61598f, 1.79863f, 0.79652f,
+    0.79874f, -0.43022f, -0.40529f, 0.94458f, 0.29193f, -0.26756f, -0.36618f, -0.83876f, 0.41249f, 0.69042f,
+    0.29211f, -0.54431f, -0.42583f, 1.47666f, 0.21972f, -0.82757f, 0.82091f, -0.12595f, -1.21618f, -0.15350f,
+    -0.00986f, 0.27490f, -0.33030f, -0.62455f, -1.73859f, -0.40266f, -0.33359f, -1.50859f, -0.49624f, 0.26904f,
+  },
+  {
+    0.68998f, -0.98785f, -0.87087f, -1.59597f, -0.20856f, 0.32057f, -0.76936f, 0.01036f, 1.62208f, 2.43630f,
+    2.13333f, 1.95419f, 1.83676f, -0.17771f, -1.21752f, -0.26179f, -0.55154f, -0.76700f, 1.14553f, 1.28197f,
+    2.51504f, 1.69503f, 0.57194f, 1.54890f, -0.22318f, -1.94945f, 0.65222f, 1.84123f, 0.68438f, -0.42316f,
+    -0.06000f, -0.05557f, 0.83650f, -0.99172f, -1.06223f, -0.06459f, -1.90537f, -1.88274f, -0.28881f, -0.83174f,
+  },
+  {
+    0.70962f, -0.35153f, -0.11948f, 1.02950f, 1.16260f, 0.16173f, -1.15544f, -1.34737f, 0.07221f, 1.08730f,
+    1.94651f, 2.53881f, 2.25416f, -0.69504f, -1.41917f, -1.09649f, -0.94575f, -0.57946f, 0.63518f, 0.87752f,
+    1.74976f, -0.16698f, -0.15550f, 1.53477f, 0.67321f, -1.58022f, -1.76615f, -0.35834f, 0.21151f, 1.12228f,
+    0.98202f, -0.60080f, -0.61748f, -1.64029f, -1.56049f, -0.71866f, -0.23725f, -1.13837f, 1.17105f, -1.19156f,
+  },
+  {
+    0.71866f, -0.19780f, -0.37677f, -2.41460f, -2.54302f, -1.21772f, 0.07915f, 0.20480f, 1.31846f, 1.76197f,
+    0.47797f, 1.52875f, 1.80953f, 0.04581f, -0.46124f, 0.20352f, -0.37179f, -1.62641f, -0.16248f, 1.85290f,
+    3.24935f, 0.64939f, -1.03304f, 0.60139f, -0.06469f, -1.63318f, -1.27363f, -0.22290f, -1.74274f, -0.30866f,
+    1.22779f, -0.58422f, 0.01932f, -0.18855f, -0.16093f, -0.72812f, -0.60258f, -1.23814f, 0.68199f, -1.41693f,
+  },
+  {
+    0.68432f, -0.68699f, -0.26304f, -0.69611f, -1.63194f, -2.64802f, -1.62899f, -0.88285f, -0.12595f, 0.25387f,
+    0.27593f, 0.91159f, 1.27044f, -1.48850f, -1.28206f, -0.06486f, -0.34592f, -0.67909f, 0.06344f, 0.99154f,
+    1.24097f, 0.63481f, -0.16492f, 0.35501f, -1.77639f, -2.28017f, -1.84324f, -1.75851f, -0.31264f, -0.01929f,
+    0.48681f, 0.05541f, 0.37344f, -0.50067f, -0.30504f, 0.69848f, -0.84965f, -0.86827f, 0.21103f, -0.83062f,
+  },
+  {
+    0.70927f, -0.48560f, -0.40655f, 0.21912f, -0.47598f, -2.82711f, -2.07768f, 0.12414f, 1.29543f, 0.89284f,
+    0.92822f, 1.73649f, 2.13252f, 0.19032f, 0.09483f, 0.14785f, 0.15128f, -0.19672f, 0.31618f, 0.06480f,
+    1.68079f, 0.86089f, -0.14136f, 0.22199f, -1.01318f, -2.29575f, -0.90616f, 0.14183f, 0.34529f, 0.30162f,
+    0.71030f, -1.04255f, -0.01565f, 0.25988f, -0.61565f, -0.33576f, -0.73691f, -1.14137f, 0.12252f, -0.86496f,
+  },
+  {
+    0.73996f, -0.11723f, -0.49612f, -1.27156f, -1.68218f, -1.78464f, -1.15565f, 0.21531f, 0.36482f, 1.22437f,
+    1.15058f, 1.84721f, 1.89935f, -0.18403f, -0.67694f, 0.52325f, 0.55969f, -0.31337f, -0.21058f, 0.23836f,
+    2.00264f, 0.96298f, -0.27192f, 0.79223f, -0.57212f, -1.94529f, -1.20066f, 0.16489f, 0.19516f, -0.65650f,
+    1.17213f, 0.94006f, 0.47521f, 0.00733f, -0.02097f, 0.70799f, -0.63076f, -0.92682f, 1.01139f, 1.07390f,
+  },
+  {
+    0.78001f, -0.15488f, -0.46178f, -0.46722f, 0.16521f, -0.52209f, -0.32365f, 0.42148f, 1.43442f, 1.29060f,
+    0.75521f, 1.17772f, 1.42653f, -0.01936f, -0.73225f, -0.47172f, -0.98171f, -0.67713f, 0.38116f, 0.40339f,
+    1.30068f, 0.47725f, -1.01953f, 0.18646f, -0.05256f, -1.05347f, -1.58742f, -0.35902f, 0.83674f, 0.54832f,
+    1.69775f, 0.38886f, 0.86606f, -0.96891f, -0.08600f, 1.06287f, -1.42598f, -2.00104f, -0.19472f, -0.23713f,
+  },
+  {
+    0.67355f, -1.68501f, -1.91139f, -1.60443f, -0.51131f, -1.66760f, -0.94125f, -0.19382f, 0.68969f, 1.28985f,
+    2.90495f, 2.77117f, 1.61618f, -0.61280f, -0.42863f, -0.11884f, -1.64283f, -1.01106f, 0.51856f, 0.67379f,
+    1.33482f, 1.39485f, -0.04642f, -0.06317f, -0.87114f, -2.18741f, -0.58834f, -0.31517f, -0.63596f, -0.37590f,
+    0.75415f, 0.33543f, 0.40433f, -0.55900f, -0.77294f, 0.50508f, -0.42942f, -1.16073f, 1.18191f, -0.94646f,
+  },
+  {
+    0.72587f, -0.78028f, -0.83973f, -0.91436f, -0.64058f, -1.73651f, -1.63762f, -0.47554f, 0.75899f, 1.18249f,
+    2.05496f, 2.36139f, 1.27571f, -0.67139f, -0.95349f, 0.39186f, 0.16481f, -0.18028f, 0.79676f, 0.41487f,
+    1.24391f, 1.71591f, 0.04662f, 0.80204f, 0.10798f, -1.45580f, -1.09275f, -0.89674f, -1.26467f, 0.36442f,
+    0.82508f, 0.37476f, 0.37212f, -0.95595f, -0.59105f, 0.92103f, 0.26133f, -1.63148f, 0.88810f, 1.00954f,
+  },
+  {
+    0.61882f, -0.32065f, -0.09571f, -1.09796f, -2.32759f, -2.73047f, -1.72801f, 0.48616f, 0.93820f, 0.79262f,
+    0.96629f, 1.99157f, 2.30517f, -0.65870f, -1.07604f, -0.59812f, -0.43595f, -0.61066f, -1.07690f, 0.72133f,
+    1.31581f, -0.47537f, -1.36290f, 0.40799f, 0.96291f, 0.14182f, -0.47391f, 0.76160f, 0.28198f, -0.31584f,
+    1.04368f, -0.61877f, -0.19658f, -1.00651f, 1.00548f, 0.27505f, -1.60018f, -1.87291f, 2.29817f, -0.34040f,
+  },
+  {
+    -1.02108f, -1.48158f, 0.11064f, 0.28623f, 0.28127f, -2.11019f, -2.77560f, -0.03021f, 1.00485f, -0.11616f,
+    0.76360f, 0.07914f, 0.81017f, 0.95600f, 1.27154f, 0.01157f, -0.17039f, -0.09304f, 0.01016f, -0.07245f,
+    -0.32782f, -0.87557f, -0.74947f, 0.26081f, 0.00958f, 0.17253f, 0.00179f, 0.55720f, -0.10039f, -0.46453f,
+    -0.41673f, -1.09786f, -0.19341f, -1.14568f, -0.70888f, -1.14504f, -0.12831f, -0.26702f, -0.05317f, -0.17100f,
+  },
+  {
+    -1.75254f, 0.03209f, -0.50450f, 0.52530f, 0.59705f, -0.87217f, -2.12610f, -2.55301f, -1.15019f, 0.70929f,
+    0.81652f, 0.13527f, 0.41373f, 1.90598f, 1.83028f, -0.13124f, -0.76051f, 0.80266f, -1.16849f, -1.38134f,
+    -0.79665f, -2.06936f, -0.30873f, 1.21471f, -1.30998f, 0.20210f, 0.99019f, 1.49612f, 1.93361f, -0.86799f,
+    -0.68157f, -2.47860f, -2.10346f, -0.07546f, -2.11201f, 0.87410f, 1.43461f, 1.80764f, -1.02990f, 0.00854f,
+  },
+  {
+    -1.70252f, 1.01002f, 0.41211f, 0.66598f, -0.19043f, -2.05379f, -2.99143f, -2.17873f, -0.63161f, 1.12734f,
+    0.02849f, -0.14064f, -0.01921f, 0.52406f, 1.08310f, 0.14795f, -0.04064f, 1.54185f, -0.80425f, -1.19879f,
+    -1.52837f, -1.83893f, 0.94367f, 2.15357f, -0.78151f, -0.88563f, 0.15575f, 0.93826f, 1.71039f, -1.39774f,
+    -0.64274f, -1.74813f, -1.25855f, 0.06010f, -3.28014f, -0.38900f, 0.27731f, 1.38726f, -1.34022f, 0.12902f,
+  },
+  {
+    -1.70298f, 0.94210f, 0.00509f, -0.23737f, -0.58059f, -1.09251f, -1.62474f, -2.20967f, -1.20759f, 1.11838f,
+    0.78736f, 0.64025f, 0.52357f, 2.19973f, 2.59993f, -0.03887f, -0.70040f, 0.71681f, -0.41029f, -1.19956f,
+    -1.07708f, -2.17804f, -0.48865f, 1.01040f, -1.24702f, -0.18020f, -1.38990f, -0.08282f, 0.68754f, -0.85544f,
+    0.18170f, -1.44347f, -0.91465f, 0.76484f, -1.61382f, -0.28068f, 0.12302f, 1.39688f, -1.44349f, 0.59191f,
+  },
+  {
+    -1.74435f, 0.06526f, -0.62334f, 0.06916f, 0.17444f, -0.85685f, -2.09727f, -2.14249f, -0.57228f, 1.31031f,
+    0.51068f, -0.42992f, 0.98157f, 2.64899f, 2.02501f, 0.92064f, 0.42351f, 0.20586f, -1.01614f, -0.42819f,
+    -0.59208f, -2.72245f, -1.35331f, 1.04924f, -0.12780f, 0.76594f, 1.03028f, 1.59869f, 0.99146f, -1.42915f,
+    -0.00147f, -1.65413f, -1.02020f, 0.88279f, -1.74971f, 0.05495f, 1.07706f, 2.35208f, -0.79936f, 0.82809f,
+  },
+  {
+    -1.65849f, 1.24390f, -0.32129f, -0.39459f, 0.42435f, 0.18494f, -1.28662f, -1.40018f, -1.20180f, 0.62011f,
+    1.40511f, 0.08101f, 0.22010f, 2.73836f, 2.14773f, 0.29014f, 0.27902f, 0.40947f, -0.67287f, 0.17270f,
+    0.56321f, -2.05204f, -1.41440f, 0.93213f, 0.29501f, 0.75767f, 0.90585f, 2.20833f, 0.86278f, -2.50805f,
+    -0.95265f, -1.48675f, -1.51870f, 0.22116f, -1.68217f, -0.55330f, -0.33858f, 0.61710f, -1.61245f, 0.96217f,
+  },
+  {
+    -1.72366f, 0.60747f, -0.39681f, -0.45539f, -1.06494f, -1.55123f, -1.78362f, -1.36129f, -0.64889f, 0.62000f,
+    0.76773f, 0.58792f, 0.97565f, 2.51551f, 1.87673f, -0.31865f, -0.22157f, 0.44151f, -0.84474f, -0.27767f,
+    -0.87446f, -3.14045f, -1.06534f, 1.06233f, -0.53671f, -0.56724f, 0.29323f, 2.08569f, 2.00504f, -1.96423f,
+    -1.41906f, -0.94453f, -0.47319f, 0.65502f, -1.83897f, -0.42155f, -0.92548f, 0.02240f, -2.59156f, 0.34393f,
+  },
+  {
+    -1.72147f, 0.77533f, 0.07335f, -1.09057f, -0.99599f, -0.88695f, -1.71733f, -1.46961f, -0.74902f, 0.25078f,
+    1.73841f, 1.38997f, 1.25032f, 2.16314f, 1.37989f, -0.31541f, -0.21001f, 0.30505f, -1.42636f, -0.63592f,
+    -0.99081f, -2.92182f, -0.16200f, 1.45893f, -0.72600f, -0.62598f, 0.05949f, 1.78279f, 1.38008f, -1.47649f,
+    0.07632f, -0.24655f, -0.29274f, 1.45110f, -1.57279f, -0.83596f, -1.01767f, 1.79183f, -0.73060f, 1.04838f,
+  },
+  {
+    -1.31336f, 1.41272f, 1.04109f, 1.65157f, 0.24626f, -0.76031f, -2.43882f, -2.08110f, -0.84951f, 1.37600f,
+    1.90079f, -0.50446f, -1.31814f, 1.39522f, 1.21344f, -0.31615f, -0.01366f, 1.22316f, -0.21768f, -0.29506f,
+    0.42577f, -1.21794f, 0.01690f, 0.39089f, -0.69301f, 0.69375f, 0.61910f, -0.64549f, 1.39487f, -0.96016f,
+    -0.22010f, -0.55878f, -0.64705f, 0.06215f, -1.51497f, 0.02421f, -1.05765f, 1.15312f, -0.56371f, 0.08830f,
+  },
+  {
+    0.37030f, 0.57581f, 0.13117f, 0.12135f, 0.34195f, -0.39475f, -0.26915f, -1.40057f, -2.35540f, -1.96081f,
+    0.09906f, 1.32892f, 0.21437f, -0.29545f, 0.55458f, 2.06436f, 1.15137f, 0.17761f, 0.23637f, 0.37733f,
+    -0.15759f, 0.74836f, 2.22838f, -1.20169f, -1.26767f, 1.09521f, -0.71210f, -0.91112f, 0.71046f, -0.91628f,
+    1.17212f, -0.63720f, -0.98037f, 1.03787f, -0.25175f, -0.54130f, -0.50407f, -0.71632f, 0.14100f, -0.56732f,
+  },
+  {
+    0.38324f, 0.57893f, 1.42507f, 0.42806f, 2.07994f, 1.53730f, 0.11935f, -1.35747f, -2.00815f, -1.92862f,
+    0.40428f, 1.71378f, 0.18709f, -0.63770f, 0.29019f, 1.39612f, 1.45328f, 1.49854f, 1.40580f, 0.26887f,
+    -1.30610f, -0.12571f, 0.78386f, -2.25584f, -2.15119f, 0.38013f, 0.71356f, 0.39137f, -0.49805f, -0.31358f,
+    1.59230f, 0.27695f, -0.34212f, 1.33483f, 0.01389f, -0.83755f, 0.60652f, 0.96590f, -1.53713f, -1.49136f,
+  },
+  {
+    0.32451f, -0.30160f, 1.37159f, 1.21381f, 1.12617f, 0.53143f, -0.16380f, -1.10973f, -2.16259f, -2.23721f,
+    0.12864f, 1.24250f, 0.04839f, -0.99285f, 0.29615f, 2.47241f, 2.25857f, 1.04338f, 1.10908f, 0.25484f,
+    -0.37638f, 1.20997f, 0.96990f, -2.07197f, -2.36083f, -0.37631f, 0.40660f, 0.42774f, -1.47437f, 0.18326f,
+    1.80319f, 0.27654f, -0.31903f, 0.07578f, -1.30119f, -1.60396f, -0.70119f, 0.63450f, -0.60318f, -0.88733f,
+  },
+  {
+    0.30447f, -0.70836f, 0.91746f, -0.51523f, -0.30289f, -0.46891f, -0.07202f, -1.85118f, -1.97894f, -1.47007f,
+    -0.24590f, 0.60536f, -0.61960f, -1.39391f, 0.67795f, 2.67671f, 2.61948f, 0.97447f, 0.66144f, 0.44775f,
+    -0.32225f, 0.27264f, 0.70841f, -1.73119f, -2.17836f, -0.24705f, 0.11528f, 0.16662f, -0.70715f, 0.92919f,
+    1.27843f, -0.01214f, 1.59384f, 2.99588f, 0.16975f, -1.59069f, -0.46333f, 1.32653f, -0.62067f, -0.96063f,
+  },
+  {
+    0.33934f, -0.16679f, 1.28790f, -0.06487f, 0.29841f, -0.04810f, 0.59743f, -0.79911f, -2.08465f, -1.32557f,
+    1.49826f, 1.43006f, -0.04397f, -0.44974f, 1.32487f, 2.88123f, 2.05047f, 1.49321f, 1.37351f, 0.21096f,
+    -1.11051f, 0.59128f, 1.53805f, -1.53031f, -1.43238f, 0.68745f, -0.38730f, -1.06273f, -0.87786f, 0.57143f,
+    2.18594f, 0.94062f, 0.39896f, 1.77865f, -0.22723f, -0.84749f, 0.35007f, 0.79194f, -1.38191f, -2.82193f,
+  },
+  {
+    0.32754f, 0.07619f, 1.58673f, 0.93256f, 1.26252f, 0.05899f, 1.02356f, -0.51666f, -1.97788f, -1.92648f,
+    0.40968f, 1.11381f, -0.22046f, -1.00158f, 1.09317f, 2.66844f, 2.46439f, 1.54125f, 0.32932f, -0.94541f,
+    -0.85729f, 1.05941f, 0.96738f, -1.83033f, -1.44127f, 1.13834f, 0.14383f, -0.99955f, -1.30808f, -0.08281f,
+    2.19497f, 1.19384f, 0.98558f, 2.09310f, -0.56396f, -0.91214f, -0.26234f, 1.05468f, -0.80449f, -2.14231f,
+  },
+  {
+    0.26787f, -0.63945f, 1.42826f, 0.89340f, 1.11899f, -0.36989f, -0.34958f, -1.48315f, -2.02647f, -2.18905f,
+    0.22260f, 1.54854f, 0.22364f, -0.18849f, 1.21666f, 2.45965f, 2.27714f, 0.06059f, 0.02769f, 0.11018f,
+    -0.83646f, 0.74271f, 0.61881f, -2.47233f, -2.46828f, -0.39327f, 0.94707f, 1.20133f, -0.68903f, -1.22121f,
+    0.59449f, 0.40005f, 0.66468f, 1.92890f, -0.60936f, -1.57369f, 0.78414f, 2.37029f, -0.12285f, -1.76505f,
+  },
+  {
+    0.36035f, -0.12090f, 1.51112f, 0.89276f, 1.25541f, 0.55252f, -0.35676f, -1.70904f, -2.52688f, -2.29691f,
+    0.28405f, 1.05940f, 0.31706f, -0.31463f, 0.98282f, 1.93979f, 1.45681f, 1.58993f, 1.37670f, 0.21825f,
+    -0.79756f, 0.18305f, -0.05707f, -2.35170f, -2.00843f, 1.31037f, 1.48649f, 0.20405f, -2.07441f, -1.59839f,
+    1.16898f, 0.50498f, -0.45227f, 1.03371f, -0.34613f, -1.05087f, 0.99620f, 1.94755f, -0.09513f, -1.28153f,
+  },
+  {
+    0.37012f, 0.25181f, 1.02095f, -0.73011f, 0.68675f, 0.06082f, -0.60663f, -0.95036f, -1.14411f, -1.59847f,
+    0.12537f, 0.60590f, -0.31298f, -0.29291f, 1.64891f, 2.82275f, 2.15466f, 1.36681f, 1.24723f, 0.96962f,
+    -0.42833f, 0.31556f, 0.92379f, -1.67589f, -1.81244f, 0.22663f, 0.43535f, 0.17669f, -0.96004f, -1.42664f,
+    1.30244f, 1.20476f, 0.46866f, 1.79791f, -1.01832f, -2.71501f, -0.60509f, 1.81357f, -0.00448f, -1.15995f,
+  },
+  {
+    0.35749f, 0.14669f, 1.77587f, 0.57779f, 1.94481f, 1.05409f, -0.85301f, -2.07833f, -1.40719f, -0.51850f,
+    1.79453f, 1.65248f, 0.61354f, -0.34427f, 0.70940f, 2.17147f, 1.60580f, 0.42020f, -0.01749f, -0.44361f,
+    -0.88065f, 1.23083f, 1.34676f, -1.92232f, -2.50931f, -0.64602f, -0.67814f, -0.03873f, -0.05008f, 1.05332f,
+    1.67832f, 0.15801f, 0.96397f, 2.15206f, -0.32690f, -2.11115f, -0.00853f, 0.85264f, -2.16739f, -1.77507f,
+  },
+  {
+    0.83507f, -0.61519f, 0.04639f, 0.83229f, 0.92993f, 1.25486f, -0.72448f, -2.07612f, -1.92223f, -1.37659f,
+    -0.16127f, 0.29066f, 1.46361f, 0.89200f, 0.69359f, -0.06854f, 0.54013f, 0.50025f, 0.94868f, 0.20802f,
+    -0.88066f, -0.25783f, 0.94620f, -0.65631f, -0.74099f, -0.57941f, -0.14877f, 0.02994f, -0.17799f, 0.58480f,
+    1.06187f, -0.80369f, 0.16694f, -0.77034f, 0.16999f, -1.03634f, 1.40341f, 1.96499f, -1.02678f, -1.17573f,
+  },
+  {
+    0.99750f, -0.83531f, -0.83420f, 0.30609f, 0.89037f, 0.08036f, -1.10720f, 0.04343f, -0.30710f, -0.44741f,
+    -0.60625f, -0.36330f, 0.79653f, 0.52750f, -0.02734f, 0.18411f, 0.40210f, 1.96518f, 1.41011f, 0.03120f,
+    0.55850f, -0.12113f, -1.38881f, 0.37799f, 0.07536f, -1.49254f, -1.61802f, -1.90090f, -1.68122f, -0.75208f,
+    -0.44521f, -0.01121f, 0.62944f, -0.47442f, -0.25421f, 0.43308f, 0.97330f, 1.38476f, -0.06916f, -0.46209f,
+  },
+  {
+    0.97570f, -1.28462f, -0.92211f, -0.77911f, -1.02289f, -0.45020f, 0.20458f, -0.17172f, -0.08081f, 0.03831f,
+    -1.96947f, -1.78798f, 0.17330f, 0.29026f, -0.01546f, -0.73580f, 0.44090f, 1.26686f, 1.29688f, 2.17131f,
+    1.93554f, -0.54299f, -0.97625f, 0.23356f, 0.71185f, -0.33157f, -0.59104f, -0.56686f, -0.26728f, -0.82699f,
+    -0.02552f, -0.36913f, -0.73661f, -0.53746f, -0.11330f, 1.21324f, 2.35496f, 1.25586f, -0.02971f, -0.16747f,
+  },
+  {
+    0.95363f, -1.80309f, -1.63562f, -1.54652f, -1.49008f, -0.26155f, -0.26038f, -2.01948f, -1.36895f, -1.65762f,
+    -2.83558f, -1.97761f, 0.65421f, 0.71792f, -0.06279f, -0.47908f, -0.47538f, 0.28607f, 0.98558f, 1.01763f,
+    1.56080f, -0.01278f, 0.31997f, 0.05211f, -0.33957f, -0.90931f, -2.21678f, -1.42625f, -0.72565f, -0.75831f,
+    -0.57800f, -1.85292f, -0.44488f, -0.85986f, -0.79977f, -0.81288f, -0.06168f, 0.72087f, -0.52007f, -0.44221f,
+  },
+  {
+    1.01744f, -0.81180f, -1.15060f, 0.22539f, 0.75993f, 0.98180f, -0.47857f, -0.55323f, -0.65381f, -0.82992f,
+    -0.54403f, -0.80726f, -0.88225f, -0.42005f, 0.46938f, -0.18002f, 0.43972f, 0.81165f, 1.29662f, 0.91428f,
+    0.71264f, 0.90626f, -0.18573f, -0.20075f, 0.15932f, -0.19034f, -0.52809f, -0.50993f, -0.38754f, -1.52074f,
+    -0.26573f, -0.63948f, 0.24782f, 0.33167f, 0.02577f, 0.53044f, 0.26030f, 0.45813f, 0.73371f, 0.25016f,
+  },
+  {
+    0.97279f, -1.47944f, -0.99523f, 0.67913f, 0.55382f, 0.00238f, 0.36193f, 0.06183f, -0.83874f, -1.74430f,
+    -0.95690f, -0.25859f, 1.60528f, 0.64078f, -1.23089f, -0.75146f, 0.30741f, 1.64775f, 1.65366f, 1.65115f,
+    1.16473f, 0.39587f, 0.05501f, -0.09264f, -0.74449f, -1.97835f, -0.92631f, -0.85730f, -1.88112f, -0.69528f,
+    -0.37021f, -0.65402f, 0.24976f, 0.19706f, -0.36853f, 1.13908f, 0.93567f, 0.89250f, 1.06880f, -0.31916f,
+  },
+  {
+    0.99159f, -0.55174f, -0.41796f, -0.17669f, -0.78142f, -0.35646f, 0.35042f, -0.56982f, -0.14964f, -0.24437f,
+    -1.31410f, -0.55817f, 0.13309f, 0.93561f, 0.87771f, 0.74262f, 0.23483f, 0.62056f, 1.73678f, 1.46166f,
+    0.80165f, 0.24174f, 0.47453f, 0.40250f, 1.20644f, -1.05453f, -0.64506f, -1.28776f, -1.40343f, -1.16075f,
+    -0.87364f, -0.10263f, 1.01178f, -0.29860f, 0.48269f, 0.26079f, -0.96402f, 0.00911f, 0.06730f, 0.07019f,
+  },
+  {
+    0.97427f, -1.09699f, -1.19453f, -0.29185f, -0.69111f, -0.10565f, 0.45312f, -0.56748f, -0.24963f, -0.19781f,
+    -1.87284f, -0.95496f, 0.87447f, 0.36670f, -0.38400f, -0.34392f, 0.06638f, 1.92062f, 1.68983f, 2.18634f,
+    0.10884f, -0.11251f, -0.46124f, 1.32575f, 0.43152f, -1.71063f, -0.56336f, -0.54758f, -1.13708f, -1.00441f,
+    -1.44183f, -2.48090f, 0.83327f, -0.46089f, 0.14469f, 0.81142f, 1.24018f, 1.17292f, -0.10336f, -0.41045f,
+  },
+  {
+    0.98190f, -1.11536f, -0.66378f, 0.50057f, 0.35998f, 0.69821f, 1.69157f, 0.32732f, 0.24841f, -1.71240f,
+    -2.41990f, -0.71342f, 0.37820f, -0.09385f, -0.17945f, 0.01569f, 0.21029f, 1.23338f, 1.57993f, 2.08979f,
+    1.46906f, 0.66821f, -0.71362f, -0.55340f, -0.56576f, -1.02213f, -1.69102f, -1.18665f, -0.28643f, -0.19533f,
+    -0.52661f, 0.01410f, -0.26664f, -1.17316f, -0.07124f, 1.50145f, 1.81886f, 1.10196f, -0.85191f, -0.64846f,
+  },
+  {
+    0.93012f, -1.46740f, -0.45747f, -0.03144f, -0.41622f, 0.11036f, 1.03151f, -0.25745f, -1.23280f, -1.34389f,
+    -1.53732f, -1.17837f, -1.41707f, -0.62112f, 0.64650f, 0.19134f, 0.91983f, 1.31335f, 0.72554f, 1.18780f,
+    0.16228f, -0.98473f, -1.67418f, -0.50366f, 1.07441f, 0.70168f, -0.89960f, -1.32355f, -0.82184f, -1.31992f,
+    -0.62548f, -0.40035f, 0.80315f, 0.45938f, -0.59286f, 0.43381f, 1.07834f, 1.59674f, 0.68847f, 0.30524f,
+  },
+  {
+    0.83619f, -0.29494f, -1.09744f, 0.83996f, -0.19079f, 1.35151f, 2.35549f, -0.61154f, -2.52117f, -2.08124f,
+    -1.84737f, -1.00977f, -0.59291f, 0.38200f, 2.03153f, 0.57318f, -0.16093f, 1.38902f, 1.11873f, 0.27747f,
+    -1.60729f, -0.69401f, -1.37291f, 0.46298f, 1.77105f, 0.74747f, -0.85344f, -1.77910f, -0.91985f, -1.60827f,
+    -1.45885f, 0.51682f, 1.12487f, 1.01172f, 0.57648f, 1.41756f, 0.64125f, -1.56776f, -0.38320f, -0.95833f,
+  },
+  {
+    -0.87493f, 1.10923f, -2.03066f, -2.14825f, -0.91615f, -0.09641f, -0.97956f, 0.60597f, -0.92465f, -0.55542f,
+    0.20892f, -0.10244f, -0.09300f, 0.49063f, 0.29377f, -0.08167f, 0.22204f, -0.02580f, 1.24469f, 0.12269f,
+    -0.10449f, 0.39750f, -0.24071f, -0.29711f, 0.69347f, -0.70774f, 0.78638f, -0.29102f, -0.24369f, -0.02154f,
+    -0.72583f, -0.71789f, -0.18969f, -0.63653f, 0.16994f, 0.38022f, -0.26896f, 0.03936f, 0.25659f, -0.02517f,
+  },
+  {
+    -1.44357f, 0.35805f, -0.19988f, -0.77166f, -0.21772f, -0.47189f, -0.30114f, -1.28682f, -1.58988f, -0.96668f,
+    -1.45419f, -0.76484f, 1.32421f, 0.56477f, 0.86100f, 0.31877f, -0.78818f, -0.80951f, 0.58287f, 1.15114f,
+    1.35935f, 1.68240f, 1.67142f, -0.19238f, -0.39918f, 0.43282f, 1.58463f, 1.84920f, 1.28612f, -1.22889f,
+    -1.77013f, -0.89970f, 0.09433f, -2.33297f, -0.85313f, 0.93858f, 1.10782f, 0.39219f, -2.02648f, -0.13120f,
+  },
+  {
+    -1.48711f, 0.14523f, 0.23692f, 0.41562f, 0.53366f, -0.74692f, -1.30634f, -0.51623f, -0.23475f, 0.38210f,
+    -0.15234f, -1.42789f, 0.08394f, 0.13044f, 0.12830f, 0.72106f, 0.59411f, 0.63909f, 1.34176f, 0.76440f,
+    -0.02659f, 1.26118f, 3.03960f, 0.51596f, -0.20904f, -0.04847f, 0.97889f, -0.00290f, -0.27133f, -0.41755f,
+    -0.46040f, 0.31891f, -0.68608f, -1.92561f, -1.24089f, 0.33046f, 1.30777f, -0.26385f, -0.49620f, 0.49672f,
+  },
+  {
+    -1.49376f, -0.02941f, -1.31297f, -2.07064f, -0.74510f, 0.18252f, 0.74847f, -0.37917f, -0.28036f, -0.69541f,
+    -2.44412f, -1.61031f, -0.54531f, -0.02292f, -0.05074f, -0.00577f, 0.21718f, 0.52873f, 1.72721f, 1.26441f,
+    0.46938f, 1.51500f, 3.59463f, 0.49781f, 0.38549f, 0.70093f, 0.72188f, 0.17149f, 1.40873f, -0.63377f,
+    -0.81836f, -0.02540f, -1.27095f, -1.39092f, 1.25768f, 1.69678f, 0.90337f, -0.88080f, -0.55141f, 1.10512f,
+  },
+  {
+    -1.47997f, -0.45790f, -0.21416f, 0.01898f, 0.38349f, 1.06679f, 0.99511f, 1.36259f, 1.18708f, 0.48809f,
+    -1.65437f, -1.24531f, -1.48860f, -1.02864f, 0.04158f, 0.06312f, -0.93463f, 0.89420f, 2.04311f, 1.31750f,
+    0.57808f, 1.13829f, 1.76703f, 0.46462f, 0.22035f, 0.55832f, -0.88718f, -1.26441f, 0.87960f, 0.13196f,
+    -1.35424f, -0.66109f, -0.63703f, -1.36021f, 0.95445f, 1.32574f, -0.14313f, -1.20931f, -1.59153f, -1.07668f,
+  },
+  {
+    -1.43143f, 0.02491f, -0.54559f, -1.43651f, -0.73434f, 0.77438f, 0.83595f, 0.39205f, 0.03117f, -0.79774f,
+    -1.19967f, -1.35746f, -1.03789f, -0.46642f, 0.17995f, -0.04022f, -0.48365f, -0.10790f, 1.46356f, 1.25220f,
+    0.29651f, 1.66799f, 1.47991f, -0.31284f, -0.12085f, 0.09649f, 0.18200f, -0.49711f, 1.22551f, 0.09013f,
+    -1.17929f, -0.39048f, -0.47869f, -1.91702f, -0.57602f, 0.22639f, 0.21723f, -1.10537f, -2.12676f, -0.01796f,
+  },
+  {
+    -1.39277f, 0.30881f, -0.62004f, -0.43262f, 0.24100f, 0.49343f, 0.38610f, 0.94108f, -0.36046f, -0.32824f,
+    -0.24610f, -0.23861f, -0.34837f, -0.43077f, -0.01203f, -0.38025f, -0.54332f, -0.12570f, 0.99669f, 0.82250f,
+    0.15809f, 1.55920f, 1.97864f, -0.64811f, -0.19687f, 0.40441f, 0.75480f, 0.20021f, 1.22452f, 0.28684f,
+    -0.52416f, -1.01283f, -2.11632f, -1.38138f, 0.43119f, -0.09771f, 0.85317f, -0.07038f, -0.72247f, 0.46290f,
+  },
+  {
+    -1.41993f, 0.49451f, -0.23106f, 0.39673f, 0.59028f, 0.57925f, 0.77637f, 1.00145f, 0.08206f, -0.68783f,
+    -0.72088f, -0.15411f, -0.68519f, 0.07661f, 0.97224f, -0.45988f, -0.55676f, -0.52880f, 0.87347f, 0.64147f,
+    0.40481f, 2.07205f, 2.15067f, -0.51550f, 0.00834f, 0.67788f, -0.08358f, 0.88124f, 0.31916f, -0.31288f,
+    -1.43123f, 0.15059f, -1.07017f, -0.52334f, 0.16060f, -1.03407f, -0.60882f, 0.45169f, -0.97627f, 0.66534f,
+  },
+  {
+    -1.06990f, 0.99430f, -0.68299f, -1.37580f, -2.05400f, -1.65581f, -0.65638f, 0.03928f, -1.09857f, -0.90422f,
+    0.06010f, -1.10714f, -0.21321f, 0.04846f, -0.09972f, -0.19902f, -0.14382f, -0.17266f, 1.43253f, 0.19460f,
+    -0.20048f, 0.37062f, 0.09632f, 0.79265f, -0.32263f, 0.19984f, -0.19959f, -0.07319f, -0.84066f, -0.38815f,
+    -0.96522f, 0.05329f, -0.60339f, -1.19724f, -0.31336f, 0.03031f, 0.06155f, 0.00004f, -0.61520f, 0.26455f,
+  },
+  {
+    0.45012f, 1.40176f, 0.77967f, -0.21037f, -0.67505f, 0.09308f, 0.45280f, 0.29824f, -0.27977f, -0.05867f,
+    0.17046f, -1.28469f, -1.63495f, -0.72720f, 0.19803f, 0.77707f, 0.55541f, -1.16468f, 0.42562f, 1.55265f,
+    1.07009f, -0.80175f, -1.57786f, 1.32044f, 1.11928f, -0.27094f, -0.63571f, -0.54883f, -0.72031f, -0.74510f,
+    1.34057f, 1.23307f, -1.62528f, -0.79026f, 0.07320f, -0.81706f, -0.23466f, -0.67916f, -1.37833f, 0.24947f,
+  },
+  {
+    0.49042f, 0.93461f, 1.49603f, 1.03515f, -0.29036f, -0.00971f, 0.73368f, -0.05275f, 0.18733f, -0.36975f,
+    0.03362f, -0.61110f, -2.21168f, -1.87948f, -1.03711f, 0.96035f, 1.39256f, -1.11251f, -1.45950f, 0.03989f,
+    0.90063f, -0.65143f, -0.14757f, 1.73446f, 1.49609f, -0.40730f, -0.77648f, -0.24091f, -1.05914f, -0.80790f,
+    0.66477f, 0.40827f, -1.19653f, 1.07065f, 1.15159f, -0.76496f, -1.99450f, -2.24873f, -0.53973f, 0.96111f,
+  },
+  {
+    0.57707f, 0.98767f, 0.18180f, 0.02743f, -0.58040f, 0.49475f, 1.21961f, 0.16768f, 0.66775f, -0.26566f,
+    -1.02375f, -1.04061f, -1.69204f, -0.92959f, 0.22196f, 0.69279f, 0.53657f, -0.20272f, -0.54580f, 0.66195f,
+    1.21415f, -0.57216f, -0.18707f, 1.74681f, 1.89663f, 0.65842f, -0.12105f, 0.41685f, -1.12211f, -0.46891f,
+    0.49774f, -0.50061f, -1.58965f, -0.10606f, 0.48022f, -1.11730f, -1.28494f, -0.63703f, -0.38564f, 0.64030f,
+  },
+  {
+    0.53257f, 0.78624f, 0.58224f, 0.43088f, 0.06977f, 0.85468f, 0.84665f, 0.17435f, 0.45060f, 0.72777f,
+    -0.76591f, -1.24841f, -1.42633f, -0.31558f, 0.51854f, 0.64495f, 0.14977f, -0.63868f, -0.81533f, -0.07561f,
+    0.31814f, -0.92026f, 0.34786f, 2.57472f, 2.48209f, 0.20202f, 0.16211f, 0.88384f, -0.43806f, -0.43919f,
+    0.77195f, 0.17825f, -1.85194f, -0.45797f, 1.16789f, -0.31384f, -0.85195f, -1.35234f, -0.90042f, 1.36770f,
+  },
+  {
+    0.48422f, 0.90047f, 1.01056f, 0.27238f, 0.47110f, 1.04832f, 1.30698f, 0.59962f, 1.55629f, 1.29590f,
+    -1.12595f, -2.20907f, -2.39699f, -0.77045f, 0.68847f, 0.60865f, 0.12274f, -0.01125f, -0.18335f, 0.63488f,
+    0.52877f, -0.23950f, -0.46942f, 1.48893f, 1.39974f, 0.18071f, 0.50399f, 1.19916f, -0.04128f, -0.67342f,
+    1.00563f, 0.18410f, -2.04962f, 0.04819f, 0.76704f, -1.23778f, -1.38077f, -0.44790f, -0.75220f, 0.96997f,
+  },
+  {
+    0.43331f, 0.36096f, 0.41162f, 1.06904f, -0.47008f, -0.62493f, 0.09374f, 0.46151f, 0.84048f, -0.17147f,
+    -1.63412f, -2.41440f, -2.26278f, -1.27396f, -0.03277f, 0.45482f, -0.19123f, 0.11906f, -0.02123f, 1.42889f,
+    1.08690f, -0.67724f, -0.97721f, 1.41731f, 2.99275f, 0.48640f, 0.20135f, 0.65499f, -0.88492f, 0.05775f,
+    0.56397f, 0.17107f, -2.14214f, 0.08915f, 0.94263f, -0.72023f, -1.00303f, -1.28408f, -0.33099f, 0.93056f,
+  },
+  {
+    0.53117f, 1.12240f, 0.50968f, 1.24276f, 0.14797f, -0.52614f, -0.70337f, -0.20507f, 0.40119f, 0.86937f,
+    0.55410f, -0.56567f, -0.52682f, -1.12741f, 0.03220f, 1.02911f, 0.69184f, 0.37546f, -0.38854f, 0.83586f,
+    1.12931f, 0.50712f, 0.25196f, 0.69601f, 1.30033f, -0.76302f, -0.15742f, 0.82526f, 0.49508f, 0.22448f,
+    0.86332f, 0.26527f, -1.29888f, 0.45611f, 0.49530f, -2.27738f, -2.60735f, -0.67612f, 0.52197f, 2.31475f,
+  },
+  {
+    0.55582f, 0.95988f, 0.14254f, 0.80561f, 0.23319f, -0.26027f, -0.35503f, -0.19642f, 1.04569f, 0.88504f,
+    0.28179f, -0.43975f, -1.76665f, -1.33723f, -0.37342f, 0.86072f, 0.55871f, -0.47737f, -0.31621f, 0.40136f,
+    1.55035f, 0.11330f, -0.02709f, 1.09359f, 1.69233f, 0.36060f, -0.29451f, 0.09198f, -0.66920f, 0.98117f,
+    0.91413f, -0.39095f, -0.73471f, 0.71021f, 0.23888f, -0.93860f, -0.81025f, -1.28524f, -0.40913f, 1.31316f,
+  },
+  {
+    0.52343f, 0.90483f, -0.02759f, 0.51135f, 0.54594f, 0.51248f, 0.02386f, -0.22236f, 0.03396f, -0.18405f,
+    -0.70263f, -1.16523f, -0.96321f, -0.26739f, 0.22489f, 1.16155f, 0.61292f, 0.28567f, -0.74557f, 0.50687f,
+    0.23640f, -1.51386f, -0.26111f, 1.19242f, 2.30878f, 0.76460f, 0.42010f, 0.07608f, -0.72031f, 0.39945f,
+    0.76781f, -0.58983f, -0.84885f, 0.87084f, 0.17169f, -2.00109f, -2.56530f, -1.07177f, -0.32106f, 1.27088f,
+  },
+  {
+    0.53001f, 0.39559f, -0.22882f, 0.00582f, 0.26348f, -0.12813f, -0.10924f, 0.36186f, 0.19775f, -0.01623f,
+    -0.94058f, -1.80072f, -2.08627f, -1.97882f, -1.17054f, 0.45819f, 0.83916f, 0.46727f, -0.78008f, -0.17005f,
+    0.63183f, 0.30003f, -0.15608f, 0.65974f, 0.43626f, -0.55119f, -0.55546f, 1.16751f, -0.32653f, 0.26247f,
+    0.47167f, -0.34608f, -1.57015f, -0.08770f, 0.10308f, -2.11799f, -2.31122f, -1.99560f, -0.07491f, 2.01177f,
+  },
+  {
+    0.69305f, 1.22937f, 0.08296f, 0.14856f, -1.34678f, -1.43059f, -0.38801f, -0.68640f, -0.87301f, -0.63425f,
+    -0.77920f, -1.08456f, -1.01122f, -1.48738f, -0.99556f, -0.28579f, -0.19124f, 1.06860f, 0.47613f, -0.01457f,
+    0.18811f, -0.08671f, -0.22570f, -0.26022f, 1.36455f, 0.12489f, 0.36514f, -0.21240f, 0.14594f, 1.01198f,
+    -0.10685f, -0.56323f, 0.31962f, 1.50910f, 0.77912f, -0.74111f, 0.30761f, 0.10901f, 0.34948f, 1.24481f,
+  },
+  {
+    0.39912f, 0.13352f, 1.19530f, 0.76839f, 1.17181f, 1.46850f, -0.22751f, -0.86825f, -0.41542f, 0.12601f,
+    -0.14251f, 0.40746f, -1.04728f, -2.29333f, -2.27070f, -1.09855f, 0.29890f, 0.92403f, 0.31354f, -0.61342f,
+    -0.50450f, -0.04649f, -0.83287f, -0.75751f, 0.45081f, 1.19925f, 1.24102f, 0.87695f, 2.12692f, 0.56326f,
+    -2.23557f, -0.76688f, 1.33441f, -0.24406f, -0.68749f, -0.14971f, 0.18848f, 0.49504f, 0.98599f, -1.72078f,
+  },
+  {
+    0.40225f, 0.58577f, 1.56238f, 1.05362f, 1.09722f, 1.21049f, 0.66291f, 0.30429f, 0.51405f, 1.36248f,
+    0.80647f, 0.28616f, -1.03969f, -2.45297f, -2.42406f, -1.14892f, 0.74148f, 1.65519f, 0.50752f, -0.55071f,
+    -0.25056f, 1.02129f, 0.36292f, -0.53449f, 1.13768f, 1.19279f, 0.97871f, 1.07975f, 1.81611f, 0.05596f,
+    -2.35469f, -1.02342f, 2.37539f, 0.22455f, -0.74562f, -0.71398f, -0.79465f, 0.07426f, 1.31196f, -1.14002f,
+  },
+  {
+    0.40317f, 0.57632f, 2.04406f, 1.68845f, 1.02489f, 0.45621f, -0.39616f, 0.30987f, 0.34836f, 0.34768f,
+    0.62292f, -0.14818f, -0.86153f, -1.53899f, -1.31850f, -0.61593f, 0.43241f, 1.12108f, -0.15346f, -0.57530f,
+    0.75407f, 1.50826f, 0.05998f, -1.16521f, -0.32792f, 2.47875f, 3.26647f, 0.60789f, 0.44029f, 0.10858f,
+    -1.06795f, 0.57982f, 1.81857f, -0.01807f, -0.88775f, -0.45369f, -0.00961f, 0.71358f, 1.75408f, -1.15464f,
+  },
+  {
+    0.39273f, 0.30078f, 1.76534f, 0.70174f, 0.24386f, 0.45475f, 0.70424f, 0.68532f, 1.06856f, 1.25660f,
+    0.31212f, -0.32044f, -0.95603f, -2.00174f, -2.32123f, -0.86065f, 0.96366f, 1.38107f, 0.08893f, -1.01791f,
+    -0.60646f, 1.66157f, 1.01202f, -0.79283f, 0.32187f, 1.25580f, 1.04878f, 1.09066f, 1.76931f, 0.75336f,
+    -1.87470f, 0.37131f, 2.13838f, 0.27242f, -0.37244f, 0.13272f, 0.79292f, -0.88915f, -1.26404f, -2.20169f,
+  },
+  {
+    0.42782f, 0.59485f, 1.27145f, 0.98785f, 0.71900f, 0.18137f, -0.53027f, -0.65806f, 0.06360f, 0.22545f,
+    0.13621f, -0.04889f, -1.03549f, -1.73593f, -1.48314f, -0.04786f, 0.80636f, 0.46949f, 0.06622f, -0.61792f,
+    0.79775f, 1.65748f, -0.68054f, -1.38213f, 0.27287f, 1.38136f, 1.20001f, 1.82724f, 2.59483f, 0.92266f,
+    -2.02847f, -1.14590f, 0.58865f, -0.55524f, -0.57209f, 0.23543f, -0.04788f, 0.05933f, 0.61376f, -2.33435f,
+  },
+  {
+    0.38712f, 0.41497f, 1.69150f, 0.18914f, 0.73923f, 1.22184f, 0.46765f, 0.81074f, 1.03334f, -0.09534f,
+    -0.78256f, 0.12297f, -0.60994f, -1.96664f, -2.12847f, -0.51353f, 0.40733f, 1.02386f, 0.74023f, -0.26335f,
+    0.43395f, 1.57435f, -0.11785f, -1.42273f, 0.10297f, 2.31840f, 2.40003f, 1.29047f, 1.24497f, 0.57498f,
+    -1.24087f, 0.49558f, 2.47161f, 0.38385f, -0.41759f, -0.24251f, -1.42400f, -0.70787f, 0.95862f, -1.57266f,
+  },
+  {
+    0.41226f, 0.53395f, 2.05694f, 1.15838f, 0.81232f, 1.27974f, 0.69879f, 0.57949f, 0.77096f, 0.68277f,
+    0.42617f, 0.76337f, 0.10480f, -1.40516f, -2.04660f, -0.81356f, 0.32498f, 0.61845f, -0.30155f, -0.61210f,
+    0.24685f, 0.88275f, -0.16340f, -1.23416f, 0.55534f, 3.05969f, 2.49813f, 1.42982f, 1.43448f, 0.43178f,
+    -1.68943f, -0.35559f, 1.64860f, 0.18144f, -0.45336f, 0.36487f, 0.50940f, -0.48377f, -0.14474f, -1.45280f,
+  },
+  {
+    0.44257f, 0.88570f, 1.51615f, 0.13633f, 1.07175f, 1.26843f, 0.68005f, -0.08778f, -0.47124f, 0.34157f,
+    0.87401f, 0.00128f, -0.86074f, -1.81057f, -2.12921f, -0.92359f, 0.57700f, 0.63040f, 0.33320f, -0.44185f,
+    -0.00313f, 1.01086f, -0.62944f, -1.30068f, 0.13235f, 1.76778f, 1.42737f, 0.71986f, 1.20250f, 0.88808f,
+    -1.13317f, -0.51623f, 0.78592f, -0.52139f, -0.34474f, 0.73137f, 0.71846f, -0.20054f, 0.09365f, -1.58541f,
+  },
+  {
+    0.38380f, 0.72733f, 2.37257f, 2.19028f, 1.53031f, 1.18739f, 0.97627f, 0.06266f, 0.13905f, 1.21879f,
+    0.71816f, -0.07602f, -0.50816f, -1.30515f, -1.30148f, -0.04139f, 1.33643f, 1.85100f, -0.03462f, -1.55792f,
+    -0.90886f, 1.55705f, 0.12682f, -1.16972f, 0.40347f, 1.78478f, 2.32898f, 1.48143f, 1.51939f, 1.09146f,
+    -1.92740f, -1.38681f, 0.88580f, -0.45731f, -0.16196f, 0.63556f, 0.93959f, 0.15572f, -0.15454f, -1.78796f,
+  },
+  {
+    0.46565f, 0.94062f, 1.65913f, 0.73393f, 0.80339f, 0.38805f, -0.32334f, -0.64413f, -0.17424f, 0.34549f,
+    0.44580f, -0.51806f, -0.37240f, -0.74013f, -1.14694f, -0.22951f, 0.66998f, 0.70032f, -0.26614f, -0.20715f,
+    0.72165f, 0.31290f, -1.09893f, -0.43649f, 0.64078f, 0.81030f, 0.27428f, 1.25062f, 1.73922f, -0.51328f,
+    -0.86102f, 0.74157f, 0.49909f, -0.37734f, 0.52352f, 0.15494f, -0.64386f, 0.06694f, 0.85537f, -0.68671f,
+  },
+  {
+    -1.02526f, -1.57758f, 0.71883f, 0.71979f, 0.89075f, 0.53490f, 0.12961f, 0.39492f, 0.64011f, 0.81748f,
+    0.73137f, -0.26976f, -0.30852f, -0.09522f, -0.36285f, -0.65351f, -0.47752f, 0.61845f, 1.16958f, 1.03207f,
+    0.57286f, 0.03691f, 0.32520f, 0.00827f, 0.21457f, -0.38548f, -0.82081f, -0.12867f, 0.33619f, 0.25438f,
+    -0.30082f, 0.63298f, 0.66103f, 0.69049f, 0.35803f, -0.24481f, -0.76668f, -0.18540f, -0.50440f, -0.68278f,
+  },
+  {
+    -1.22275f, -0.94782f, -0.33322f, 0.63749f, 0.24024f, 0.36815f, 0.96396f, 0.52322f, 0.20108f, 0.24662f,
+    0.77859f, 0.53811f, 0.93641f, -0.57377f, -1.11069f, -1.90779f, -0.94578f, 0.57337f, -0.15301f, 0.68874f,
+    0.31869f, -0.21310f, 0.33495f, -0.21819f, 0.91258f, 0.46432f, 0.73087f, 0.54109f, 0.36331f, 1.53441f,
+    0.44894f, 1.29296f, -0.26772f, -0.09985f, 0.07255f, 0.97682f, -0.80737f, -0.77325f, -0.65727f, -0.24554f,
+  },
+  {
+    -1.20331f, -0.80509f, -1.56245f, -1.18721f, -1.14182f, 0.48095f, 1.14330f, 0.43951f, 0.49492f, 0.80883f,
+    0.83436f, -0.28872f, 0.15019f, 0.02687f, -0.95167f, -1.15416f, -1.24810f, -0.51012f, 0.10810f, 0.11058f,
+    -0.24851f, 0.43299f, -0.69276f, 0.15057f, 0.57455f, -0.09988f, 1.35096f, 0.86053f, 0.46688f, 1.57257f,
+    1.94804f, 1.14403f, 0.45450f, -1.09539f, 0.40853f, 0.57317f, 0.71586f, -0.59708f, 0.97039f, -0.20888f,
+  },
+  {
+    -1.24399f, -0.96079f, -0.29798f, 0.06742f, 0.07657f, -0.99667f, -0.53371f, 0.31829f, -0.07669f, -0.35620f,
+    -0.37938f, -0.21397f, -0.14248f, -0.49343f, -1.17963f, -1.41228f, -0.77048f, -0.02591f, 0.31048f, 1.17330f,
+    -0.75795f, -1.03042f, -0.36439f, -0.50455f, 0.25796f, 0.19459f, 0.09034f, 0.48595f, 0.97002f, 1.66786f,
+    1.76858f, 2.08045f, 0.23243f, -1.05874f, 0.64856f, 2.86853f, 0.84840f, -1.97625f, -0.18971f, 0.68566f,
+  },
+  {
+    -1.23915f, -1.17306f, -0.84880f, -2.07166f, -0.32295f, 0.75054f, 0.04847f, 0.49927f, -0.32131f, -1.69461f,
+    -0.72651f, -0.53626f, -1.46923f, -0.59494f, -0.14859f, -0.51910f, -0.67417f, -0.82757f, 0.63922f, -0.12890f,
+    -1.49093f, -0.84305f, -0.96320f, 0.56248f, 0.33561f, 0.21704f, -0.27040f, 1.65499f, 1.43218f, 1.02955f,
+    1.02403f, 1.99164f, 0.03630f, -0.80700f, 0.35056f, 0.80829f, -0.45331f, -0.14043f, 0.16208f, -0.12750f,
+  },
+  {
+    -1.20398f, -1.07600f, -0.22665f, -0.14000f, 0.00944f, -0.47475f, -0.34528f, 0.22383f, -0.38580f, -0.73573f,
+    -0.17058f, -0.31916f, -0.38851f, 0.17248f, -0.61685f, -1.14919f, -0.82639f, -0.28758f, 0.40636f, 0.59630f,
+    -0.77454f, -0.13629f, 1.07275f, 0.71936f, 0.05003f, -0.87035f, -0.34744f, 0.18410f, 0.74055f, 1.99986f,
+    0.91371f, -0.76093f, -0.80615f, 0.16903f, 1.56103f, 0.79421f, -0.59947f, 0.06312f, 0.60088f, 1.00322f,
+  },
+  {
+    -1.24392f, -1.09861f, -0.97987f, -0.50540f, 0.00426f, 1.34263f, 0.62798f, -0.03866f, -0.19553f, 0.00584f,
+    0.11080f, -0.50234f, -1.44707f, -0.53597f, -1.21792f, -1.01113f, -0.44832f, 0.20150f, 1.20328f, 0.72083f,
+    0.65017f, -0.81276f, 0.11258f, -0.53917f, -0.61095f, 0.24366f, 0.11543f, -0.19720f, 1.12047f, 1.83341f,
+    1.43639f, 1.31209f, -0.24026f, 0.69249f, 1.46808f, -0.18629f, -0.42145f, -0.30951f, -0.03479f, 1.51058f,
+  },
+  {
+    -1.24461f, -1.36982f, -0.08403f, 1.53700f, -0.96744f, -1.55339f, 0.17556f, 0.48216f, 0.21956f, 0.00521f,
+    -0.39724f, -0.89560f, 0.13254f, 0.43876f, -0.74309f, -1.61495f, -0.66013f, 0.44790f, 0.76202f, 0.32496f,
+    -0.12338f, -0.96415f, -0.36065f, -0.19769f, 0.00856f, 0.87179f, -0.24908f, -0.44597f, 0.46585f, 0.73360f,
+    1.97334f, 0.64466f, -0.59941f, 0.21444f, 1.67954f, 0.56384f, 0.28068f, 0.00661f, -0.68788f, 0.00350f,
+  },
+  {
+    -1.04825f, -1.05800f, -0.09384f, 0.06205f, 0.53918f, 0.80916f, -0.15195f, 0.90268f, 0.46075f, 0.40815f,
+    -0.19031f, -0.04698f, 0.79759f, -0.02642f, -0.91451f, -0.74280f, -0.71984f, 0.11042f, 0.45288f, 0.37593f,
+    0.44032f, 0.06304f, 0.42759f, 0.16339f, 0.50775f, -0.34067f, -0.40551f, -0.14981f, 0.57434f, 1.16466f,
+    0.50544f, -0.39571f, -0.71330f, -0.49612f, 0.26162f, 0.42623f, 0.36785f, 0.22563f, 0.52189f, 0.15887f,
+  },
+  {
+    0.52452f, 0.51261f, -0.55155f, -0.14271f, 0.86951f, 1.10308f, 0.66221f, 0.93648f, 0.87404f, 0.02421f,
+    -0.16252f, -0.03697f, 0.90431f, 0.26538f, -0.92384f, -1.21984f, -1.42559f, -1.44297f, -0.51547f, -0.11205f,
+    -0.27002f, -0.82109f, 1.00351f, -0.57033f, 0.29385f, 0.75715f, 0.47382f, -0.96635f, 0.61225f, 0.10413f,
+    -0.70192f, -0.70094f, -0.21886f, 0.20237f, 0.51526f, -0.67244f, -1.23777f, -1.45814f, -0.25846f, 0.76381f,
+  },
+  {
+    0.75205f, 0.64706f, -0.44397f, -0.15478f, -0.80337f, 0.20652f, 0.23167f, 1.10151f, 1.02587f, 0.03480f,
+    0.27056f, 0.60668f, 1.07093f, 0.10991f, -0.03598f, -0.77384f, -0.86143f, -0.70847f, -0.06193f, 0.41718f,
+    -0.23983f, -0.76787f, -1.05897f, -0.42265f, 0.06345f, 0.02991f, 0.24228f, 0.68370f, 1.12259f, 0.87101f,
+    0.21363f, 2.37056f, 1.81666f, 0.93526f, 1.32724f, 0.26740f, -2.10711f, -1.48787f, 0.63506f, 0.36208f,
+  },
+  {
+    0.73612f, 0.35547f, -0.88815f, -0.75913f, -0.30962f, -0.70832f, -0.01659f, 0.92556f, -0.39666f, -0.60065f,
+    -0.28251f, -0.48083f, -0.14798f, 0.42384f, -0.49321f, -1.00663f, -1.48466f, -0.99545f, 0.16938f, -0.46058f,
+    -1.08748f, -0.63227f, -2.52200f, 0.93469f, 1.41538f, -0.08813f, -1.10864f, -0.36313f, -0.12743f, 0.72868f,
+    0.03596f, 1.62319f, 1.80470f, 1.97374f, 1.66421f, -0.51081f, 0.54336f, -0.32017f, 0.62204f, 0.25730f,
+  },
+  {
+    0.74245f, 0.28293f, -0.67124f, -0.23313f, 0.31834f, 0.10899f, -1.32627f, -1.32795f, -0.33953f, -0.87476f,
+    -0.58152f, 0.67388f, 0.52867f, 0.76571f, -0.64709f, -1.59398f, -2.01582f, -1.12581f, -0.09536f, 0.71422f,
+    0.93572f, -0.10023f, -1.36192f, -0.05963f, 0.18096f, -0.17234f, -1.14692f, 0.01468f, 0.83702f, 1.20883f,
+    0.97303f, 1.24010f, 1.55280f, 0.29013f, 0.16824f, 0.23347f, 1.87610f, 0.20047f, 0.34570f, 1.36678f,
+  },
+  {
+    0.70954f, -0.03335f, -0.52369f, 0.40006f, 0.30729f, 0.44758f, 0.56358f, 0.20764f, -0.01421f, -0.43817f,
+    0.53880f, 0.37891f, -0.29963f, 0.26383f, -0.81622f, -1.27013f, -1.36179f, -1.64390f, -0.72230f, 0.49260f,
+    0.07872f, -0.54885f, -1.05764f, 0.58409f, 1.10846f, -0.22663f, -1.60489f, 0.12921f, 1.02461f, 0.69721f,
+    -0.48010f, 1.99039f, 2.42624f, 0.46462f, 0.03073f, 0.83886f, 0.17196f, -1.12919f, 0.25112f, 0.77076f,
+  },
+  {
+    0.72395f, 0.37474f, 0.08630f, 0.15673f, 0.51426f, 1.27589f, 0.24581f, 0.15698f, 0.24121f, -0.07285f,
+    1.27633f, 1.39613f, 0.57323f, -0.07087f, -1.14521f, -1.62499f, -1.23184f, -0.62440f, -0.34983f, -0.35374f,
+    -1.00855f, -0.44481f, 0.05281f, -0.59585f, 0.35455f, 1.00822f, -0.40275f, -0.66129f, 0.11103f, -1.71901f,
+    -0.07313f, 2.32393f, 0.89871f, -0.43951f, -0.36522f, 0.72576f, -0.62257f, 0.13809f, 0.57365f, 0.03520f,
+  },
+  {
+    0.73871f, 0.08381f, 0.26820f, 0.42055f, 0.40639f, 1.21518f, 0.55507f, -0.31484f, 0.21420f, 0.81091f,
+    0.34035f, 0.55440f, 1.48742f, 0.80395f, -0.71342f, -2.02018f, -1.64005f, -0.71577f, 0.02154f, -0.01986f,
+    -0.14935f, -0.67435f, -1.37445f, 0.42512f, 1.04701f, 0.58105f, -0.16650f, -0.83808f, 0.51410f, 0.49957f,
+    -0.27895f, 1.73149f, 1.56018f, 0.53565f, 0.39172f, -0.00028f, -2.36250f, 0.41738f, 1.18549f, 1.02922f,
+  },
+  {
+    0.72283f, -0.64502f, -1.36393f, -1.03361f, -0.76200f, 0.80425f, 0.45935f, 0.55188f, 0.35749f, -0.44682f,
+    0.12993f, -0.75771f, 0.11430f, 0.16220f, -0.70487f, -2.43082f, -2.50900f, -2.13088f, -0.70726f, -0.23384f,
+    -0.44030f, 0.01724f, -0.19828f, -0.12960f, 0.46886f, -0.88613f, -0.44384f, -0.70333f, 0.46577f, 1.06972f,
+    0.91891f, 1.02854f, -0.09845f, 0.51451f, 0.44231f, -0.60965f, -0.85267f, 0.30694f, 0.28409f, -0.11306f,
+  },
+  {
+    0.75558f, 0.51245f, -0.30394f, -1.15250f, 0.81016f, -0.03174f, 0.29683f, -0.06851f, 0.90705f, 0.03422f,
+    -0.41927f, 0.77505f, 0.18238f, -0.74085f, -0.37741f, -1.05356f, -1.69591f, -1.46856f, 0.25863f, 0.76991f,
+    -0.55473f, -0.00011f, -1.32894f, -0.36085f, 0.42849f, 1.30745f, 1.23208f, 0.37391f, -0.45581f, -0.36115f,
+    0.20325f, 1.35946f, 0.99549f, -0.04985f, 0.53156f, 0.54732f, 0.51155f, -0.29058f, 0.09346f, 0.53913f,
+  },
+  {
+    0.75937f, 0.28051f, 0.06470f, 0.22964f, 0.04071f, -0.01057f, 0.77701f, 0.13267f, 0.05249f, 0.41547f,
+    -1.28573f, -0.18675f, -0.23767f, -0.12832f, 0.08834f, -0.65923f, -0.88300f, -1.76351f, -1.07776f, 0.53701f,
+    0.25312f, -0.04919f, -0.43565f, -0.09436f, 0.27807f, -0.61281f, -2.11699f, -0.87863f, 0.66221f, -0.42932f,
+    0.05542f, 1.47990f, 1.37452f, 0.48735f, 0.28938f, -1.14544f, 0.18935f, -0.17450f, 0.36898f, 0.60264f,
+  },
+  {
+    0.67856f, 0.70076f, -0.19038f, 0.72745f, 1.26035f, 0.32467f, -0.01145f, 0.84116f, 0.65639f, 1.00751f,
+    0.02467f, -0.72882f, -0.48112f, 0.19089f, 0.15230f, 0.37403f, -0.74314f, -1.97289f, -1.26049f, -0.06697f,
+    -0.05552f, -0.14093f, 0.00293f, -0.14394f, 0.25830f, -0.22981f, 0.24897f, 0.57560f, 0.34043f, -1.84647f,
+    -1.07139f, -0.18655f, 0.87183f, 0.87081f, -0.11375f, 0.80727f, 1.25082f, 0.13967f, -0.42402f, -0.23945f,
+  },
+  {
+    0.51059f, 0.64999f, 0.79574f, 0.94598f, 0.68231f, 0.61407f, 0.62086f, 0.55603f, 0.81799f, -0.98484f,
+    -1.49490f, 0.01752f, -0.36188f, -0.07138f, 0.28578f, 0.27667f, -0.97738f, -0.90098f, -0.82283f, -0.39479f,
+    0.27415f, 0.36395f, -1.65678f, -1.34687f, 0.36170f, 1.39874f, 0.91993f, -1.21571f, -0.74914f, -0.63760f,
+    -0.21096f, 0.30298f, 0.42019f, 1.24267f, 1.44307f, 0.18450f, 0.07476f, 0.60192f, -0.11081f, -0.83217f,
+  },
+  {
+    0.55511f, 0.86458f, 0.05264f, 0.65919f, 0.80768f, 0.54500f, 1.02655f, 1.02176f, 0.15748f, -1.07493f,
+    -1.47953f, -0.36988f, 0.13157f, 0.60227f, 0.13152f, -0.14562f, -0.45179f, -1.02828f, -1.19456f, -0.89139f,
+    -0.53864f, -0.31878f, -0.61495f, -0.29725f, 0.13661f, 0.74323f, 0.75394f, -0.26724f, -0.29178f, 0.22038f,
+    0.15186f, -0.15105f, 0.68221f, 1.03127f, 2.02802f, 1.14958f, 1.46857f, -0.12679f, -1.83220f, -1.02894f,
+  },
+  {
+    0.49748f, 0.40260f, 0.13410f, 0.72494f, 0.24331f, 0.12565f, -0.24564f, 0.37101f, 0.47600f, -0.25640f,
+    -0.21267f, 0.74445f, 0.75151f, 1.20071f, 0.83883f, -0.21216f, -1.52217f, -2.23976f, -1.02279f, -0.45862f,
+    -0.14712f, 0.71296f, -0.94065f, -1.56355f, -0.73019f, -0.05782f, -0.93231f, -2.23471f, -1.29736f, 0.37591f,
+    0.41559f, -1.78063f, -1.42638f, 1.68031f, 1.96518f, 0.28119f, 0.15804f, 0.45996f, -0.24115f, 0.34953f,
+  },
+  {
+    0.53882f, 1.36298f, 0.50497f, 0.90295f, -0.00921f, 0.49438f, 1.40897f, -0.06263f, -0.68826f, -1.49697f,
+    -0.82294f, -0.06559f, 0.20020f, 0.73631f, 0.91541f, -0.29263f, -1.70347f, -1.07282f, -0.87684f, -0.31495f,
+    -0.44998f, 0.04452f, -0.52382f, -0.92703f, -0.44296f, -0.44046f, -0.55320f, -2.00179f, -1.59405f, 0.51903f,
+    0.44098f, -1.96353f, -0.99429f, 1.14029f, 1.39655f, -0.06124f, 0.29899f, 0.92925f, -0.85135f, -0.67843f,
+  },
+  {
+    0.53950f, 1.11586f, 0.29820f, 0.52897f, 0.53398f, 0.41551f, 1.10426f, 0.65107f, 1.09207f, 1.15008f,
+    -0.44106f, -0.55486f, 0.33682f, 1.01197f, 0.85820f, -0.28723f, -1.09381f, -2.07423f, -1.87662f, -0.66753f,
+    -0.36953f, -0.34920f, -0.38095f, -1.47801f, 0.13489f, 2.00505f, 1.30807f, -0.73418f, -1.06047f, 1.33144f,
+    0.22455f, -0.98831f, -0.89050f, 0.95303f, 2.06117f, 0.20141f, -0.41096f, 0.72997f, -0.59419f, -0.75465f,
+  },
+  {
+    0.54649f, 1.22722f, 0.59975f, 0.51725f, -0.21340f, 0.26888f, 0.68677f, 0.59422f, 0.59936f, -0.11362f,
+    -0.48179f, 0.15245f, 0.27834f, 0.84886f, 0.46952f, -0.02435f, -0.85889f, -1.01304f, -1.26709f, -1.45453f,
+    -0.10161f, 0.57737f, -0.61587f, -0.81107f, 0.06673f, 0.61031f, 0.32295f, -0.65700f, -0.15838f, 1.21492f,
+    0.34820f, -1.57607f, 0.17969f, 0.23286f, 1.91521f, 0.70119f, 0.92469f, 0.77578f, -0.29171f, -0.38796f,
+  },
+  {
+    0.57598f, 1.35060f, 0.29398f, 0.58210f, 0.46566f, -0.23038f, 0.75317f, 0.90962f, 0.29228f, 0.15458f,
+    -0.92016f, -0.60925f, -0.01015f, 0.87705f, -0.04610f, -0.35261f, -0.97731f, -1.29554f, -1.29042f, -0.66152f,
+    0.30742f, 0.88489f, -1.65092f, -1.08234f, 0.45362f, 1.10234f, 0.32176f, -1.54940f, -1.05332f, -0.20506f,
+    0.05160f, -0.75284f, -0.63106f, 0.91136f, 2.33727f, 1.32479f, -0.31863f, 0.59195f, -0.16790f, 0.37676f,
+  },
+  {
+    0.55281f, 1.04831f, -0.27960f, 0.31955f, 0.80667f, 1.43400f, 0.46125f, 1.26370f, 0.66279f, 1.44609f,
+    0.35384f, -0.31217f, 0.28070f, 0.58651f, 0.02905f, -1.10580f, -1.14574f, -1.27267f, -1.31819f, -0.02781f,
+    -0.78585f, -0.65165f, -0.58216f, -0.21698f, -0.15069f, 0.30047f, 0.21862f, -0.22624f, 0.62483f, 0.68585f,
+    -0.99977f, -1.91803f, -0.74484f, 1.05648f, 2.78199f, 1.12112f, -0.30780f, -0.25597f, -1.32968f, -0.49579f,
+  },
+  {
+    0.57839f, 1.79915f, 0.10579f, 0.24330f, 0.16224f, 0.70753f, -0.37540f, -0.18918f, -0.17225f, -0.35249f,
+    0.11247f, 0.15718f, 0.29597f, 0.39137f, -0.10604f, -1.19238f, -1.26179f, -0.66331f, -0.90426f, -0.19657f,
+    0.14004f, -0.11698f, -0.96021f, -0.81507f, 0.13726f, 0.42002f, -0.60926f, -1.41058f, -1.18616f, -0.03479f,
+    -0.18805f, -0.98113f, 0.06233f, 0.74969f, 1.84130f, 0.96874f, -0.41368f, 0.86884f, -0.07331f, -0.43820f,
+  },
+  {
+    0.50376f, 1.81017f, -0.18713f, 0.76379f, 0.85011f, 1.12053f, 0.67576f, 0.91900f, -0.14410f, 0.14042f,
+    0.01596f, 0.19261f, 1.01660f, 1.02324f, 0.68851f, -0.11122f, -1.18811f, -0.90223f, -0.83048f, -0.97204f,
+    0.43464f, 1.00540f, 0.16867f, -0.02565f, 0.27788f, -0.43469f, 0.45622f, -0.93104f, -1.05410f, 0.27536f,
+    0.38230f, 0.26126f, -0.37748f, 0.42892f, 0.41926f, 0.09586f, -0.18228f, -0.31401f, 0.55779f, 0.03576f,
+  },
+  {
+    -1.03608f, 1.21569f, -1.61738f, -0.72957f, -0.13220f, 1.35799f, -0.39515f, 1.15562f, -0.29720f, 0.25582f,
+    0.47045f, -0.35094f, 0.65460f, 0.49188f, 0.17080f, 0.20501f, 0.12556f, 0.26783f, 0.63330f, 0.11653f,
+    0.04850f, -0.25458f, -0.52164f, -0.30099f, 0.15294f, -0.29641f, 0.22524f, -0.08606f, 0.34759f, 0.28664f,
+    -0.09680f, 0.29585f, -0.06533f, -0.27641f, 0.46259f, 0.29081f, 0.29507f, 0.00734f, 0.78354f, 0.69887f,
+  },
+  {
+    -1.80271f, 0.72117f, 1.47763f, 1.03495f, 1.33458f, 1.76651f, 1.40793f, 0.79791f, 0.47630f, 0.69068f,
+    1.10008f, 0.45331f, 0.15050f, 0.56964f, 0.68837f, 0.36059f, -0.10519f, -0.97172f, -2.40279f, -2.65373f,
+    -1.44881f, -0.00164f, 0.97440f, 0.21975f, -0.23542f, -0.64317f, 0.89746f, 1.35577f, -0.80846f, -1.67356f,
+    -0.09950f, 1.01136f, -0.46440f, -1.66277f, 0.49576f, 1.65878f, 0.16657f, 0.25811f, 1.91188f, 0.68665f,
+  },
+  {
+    -1.79635f, 0.44794f, 0.60410f, 0.74855f, 0.84748f, 0.99317f, 0.42847f, -0.32644f, -0.13736f, 0.15173f,
+    -0.20930f, 0.28653f, 0.65607f, 0.86089f, 0.56805f, 0.27777f, -0.11870f, -1.25274f, -2.39775f, -2.34128f,
+    -2.29744f, -0.68239f, 0.47773f, -0.42191f, -1.40632f, -1.22134f, 0.96905f, 0.64844f, -0.69982f, -0.95877f,
+    0.24810f, 1.58061f, -0.10433f, -1.30360f, 0.20327f, 1.40363f, 0.89931f, 0.57740f, 2.09836f, 0.84142f,
+  },
+  {
+    -1.78328f, 0.53608f, 0.88269f, 0.90988f, 0.29612f, 0.55729f, 1.42879f, 0.82280f, -0.33540f, -0.39363f,
+    0.67819f, 1.43138f, 0.92901f, 0.38063f, 0.18620f, -0.24055f, -0.34188f, -1.34406f, -1.56016f, -2.18169f,
+    -2.55098f, 0.16909f, 1.08143f, -0.76506f, -1.75849f, -1.33369f, 0.61512f, 0.61717f, -0.52749f, -1.08441f,
+    0.10596f, 0.23810f, -1.42356f, -2.18009f, 0.15950f, 1.61192f, 1.43409f, 0.52139f, 1.62320f, 0.68794f,
+  },
+  {
+    -1.77766f, 0.68414f, 1.02501f, 0.76725f, 1.03671f, 1.29063f, 0.95472f, 0.71506f, -0.25943f, -1.12762f,
+    -0.79022f, 0.45403f, 1.00464f, 0.81911f, 0.06760f, -0.44827f, -0.04502f, -0.43945f, -1.67475f, -2.37213f,
+    -2.24907f, -0.54810f, 0.32449f, -0.55099f, -0.99737f, -0.29793f, 0.66602f, 0.45471f, -0.72494f, -1.36862f,
+    -0.30845f, 1.54273f, -0.47388f, -2.06165f, 0.23121f, 1.77355f, 2.00669f, 0.68199f, 1.04333f, 0.10581f,
+  },
+  {
+    -1.76150f, 0.66276f, 1.15744f, 1.12475f, 0.75389f, 0.53863f, 0.16083f, 0.39106f, 0.72101f, 0.50966f,
+    0.26132f, 0.07173f, 0.69093f, 0.55801f, 0.33498f, 0.05797f, -0.05810f, -1.05300f, -2.24909f, -2.30457f,
+    -1.15523f, 0.24538f, 0.68173f, -0.09235f, -1.38266f, -1.44824f, 1.03620f, 1.69321f, -0.07889f, -0.40797f,
+    -0.09397f, 0.69632f, 0.17400f, -1.33212f, 0.12395f, 1.49388f, 0.99956f, 0.64437f, 2.35607f, 1.15269f,
+  },
+  {
+    -1.74966f, 0.87007f, 1.04637f, 1.29402f, 1.68677f, 1.22683f, -0.14978f, -0.38963f, -0.46215f, -0.46764f,
+    0.00321f, -0.00294f, -0.05564f, 0.12619f, 0.57729f, 0.62880f, -0.10170f, -1.06928f, -1.60743f, -2.38106f,
+    -1.68397f, 0.44718f, 1.04238f, 0.30905f, -0.89439f, -1.33793f, 0.14581f, 0.30676f, -0.52374f, -0.48957f,
+    -0.10156f, 0.42280f, -0.29793f, -1.37214f, -0.09088f, 1.11171f, 0.91484f, 0.55607f, 2.26394f, 0.83111f,
+  },
+  {
+    -1.78322f, 0.04370f, -0.19129f, 0.46090f, 0.89086f, -0.06106f, -1.18346f, -0.54294f, -0.11542f, -0.36060f,
+    -0.40087f, -0.35249f, -0.03301f, 0.05196f, -0.01219f, -0.29913f, -0.56586f, -1.34842f, -1.67888f, -2.22493f,
+    -2.11235f, -0.62552f, -0.41237f, -0.34133f, -0.70684f, -0.18630f, 0.88766f, 0.89484f, -0.81009f, -1.22641f,
+    -0.55469f, 0.12088f, 0.10525f, -0.26793f, 0.77968f, 1.28092f, 1.19473f, 1.15685f, 2.91070f, 1.13062f,
+  },
+  {
+    -1.73429f, 1.23503f, 0.63565f, 0.53075f, 0.21818f, -0.18566f, 0.08173f, 0.44056f, -0.15322f, -0.22098f,
+    0.18357f, 0.64507f, 0.28546f, 0.40238f, 0.07065f, -0.51064f, -0.47879f, -0.88796f, -1.55939f, -1.88233f,
+    -1.47605f, -0.20602f, 0.48013f, 0.20455f, 0.06048f, -0.54964f, -0.13328f, 0.26446f, -0.12631f, -0.70442f,
+    -0.42472f, 0.52557f, -0.38569f, -1.49314f, 0.32508f, 1.42216f, 1.27495f, 0.39263f, 1.62968f, 1.16907f,
+  },
+  {
+    -1.81139f, 2.13711f, 1.18901f, 1.40699f, 0.18982f, 0.05056f, 0.54539f, 1.18265f, 0.94737f, 0.74479f,
+    0.76041f, 0.49810f, 0.16300f, 0.42340f, -0.16664f, -0.39278f, -0.47463f, -0.52988f, -0.90445f, -0.70407f,
+    -0.04412f, 0.02949f, -0.18149f, -0.34751f, -0.16805f, 0.11569f, -0.19092f, 0.62741f, -0.21762f, -0.79857f,
+    -0.53783f, 0.01299f, -0.06948f, -0.40718f, 0.11464f, 0.26832f, 0.06983f, -0.03020f, 0.20625f, 0.52649f,
+  },
+};
+
+#endif // MFCC_GOLDEN_H
@@ -0,0 +1,163 @@
+#include <math.h>
+#include <string.h>
+#include "unity.h"
+#include "host_test.h"
+#include "audio_adpcm.h"
+
+#define ADPCM_TEST_RATE         16000
+#define ADPCM_TEST_SAMPLES      (ADPCM_TEST_RATE * 2)
+#define ADPCM_TEST_BLOCK        1024        // I2S_AUDIO_BUFFER_SAMPLES
+#define ADPCM_BENCH_SECONDS     20
+
+static int16_t adpcm_pcm[ADPCM_TEST_SAMPLES];
+static int16_t adpcm_decoded[ADPCM_TEST_SAMPLES];
+static uint8_t adpcm_coded[ADPCM_TEST_SAMPLES / 2];
+
+static void adpcm_test_tone(float freq, float dbfs)
+{
+    float amplitude = 32767.0f * powf(10.0f, dbfs / 20.0f);
+    for (int i = 0; i < ADPCM_TEST_SAMPLES; i++)
+        adpcm_pcm[i] = (int16_t)lrintf(amplitude * sinf(2.0f * (float)M_PI * freq * i / ADPCM_TEST_RATE));
+}
+
+// 浊音样信号: 变化基频的 8 次谐波加 4Hz 包络
+static void adpcm_test_voiced(void)
+{
+    float phase = 0.0f;
+    for (int i = 0; i < ADPCM_TEST_SAMPLES; i++)
+    {
+        float t = (float)i / ADPCM_TEST_RATE;
+        phase += 2.0f * (float)M_PI * (140.0f + 40.0f * sinf(2.0f * (float)M_PI * 1.1f * t)) / ADPCM_TEST_RATE;
+        float v = 0.0f;
+        for (int h = 1; h <= 8; h++)
+            v += sinf(phase * h) / h;
+        adpcm_pcm[i] = (int16_t)lrintf(v * 6000.0f * (0.3f + 0.7f * fabsf(sinf(2.0f * (float)M_PI * 4.0f * t))));
+    }
+}
+
+static float adpcm_test_round_trip_snr(void)
+{
+    audio_adpcm_state_t enc, dec;
+    double signal = 0.0, noise = 0.0;
+
+    audio_adpcm_reset(&enc);
+    audio_adpcm_reset(&dec);
+    for (int i = 0; i < ADPCM_TEST_SAMPLES; i += ADPCM_TEST_BLOCK)
+    {
+        int n = (ADPCM_TEST_SAMPLES - i < ADPCM_TEST_BLOCK) ? ADPCM_TEST_SAMPLES - i : ADPCM_TEST_BLOCK;
+        TEST_ASSERT_EQUAL(n / 2, audio_adpcm_encode(&enc, adpcm_pcm + i, n, adpcm_coded + i / 2));
+        TEST_ASSERT_EQUAL(n, audio_adpcm_decode(&dec, adpcm_coded + i / 2, n / 2, adpcm_decoded + i));
+    }
+    // 解码端与编码端内部的重建值一致
+    TEST_ASSERT_EQUAL_INT16(enc.predictor, dec.predictor);
+    TEST_ASSERT_EQUAL_INT(enc.step_index, dec.step_index);
+
+    // 跳过前 20ms 的步长收敛
+    for (int i = ADPCM_TEST_RATE / 50; i < ADPCM_TEST_SAMPLES; i++)
+    {
+        double e = (double)adpcm_pcm[i] - adpcm_decoded[i];
+        signal += (double)adpcm_pcm[i] * adpcm_pcm[i];
+        noise += e * e;
+    }
+    return (float)(10.0 * log10(signal / (noise + 1e-9)));
+}
+
+static void test_adpcm_tone_snr(void)
+{
+    // IMA-ADPCM 的步长跟不上高频大幅度的斜率, SNR 随频率下降 (主机实测 40.5 / 26.9 / 17.3 dB)
+    const float freqs[] = { 300.0f, 1000.0f, 3000.0f };
+    const float min_snr[] = { 35.0f, 23.0f, 14.0f };
+
+    for (size_t i = 0; i < sizeof(freqs) / sizeof(freqs[0]); i++)
+    {
+        adpcm_test_tone(freqs[i], -6.0f);
+        float snr = adpcm_test_round_trip_snr();
+        char label[48];
+        snprintf(label, sizeof(label), "audio_adpcm SNR %.0f Hz -6 dBFS", freqs[i]);
+        HOST_BENCH(label, "%.1f dB", snr);
+        TEST_ASSERT_GREATER_THAN(min_snr[i], snr);
+    }
+}
+
+static void test_adpcm_voiced_snr(void)
+{
+    adpcm_test_voiced();
+    float snr = adpcm_test_round_trip_snr();
+    HOST_BENCH("audio_adpcm SNR voiced", "%.1f dB", snr);
+    TEST_ASSERT_GREATER_THAN(30.0f, snr);
+}
+
+// 状态在块之间延续: 分块编码与一次编码整段的输出逐字节相同
+static void test_adpcm_blocks_equal_one_shot(void)
+{
+    static uint8_t whole[ADPCM_TEST_SAMPLES / 2];
+    audio_adpcm_state_t state;
+
+    adpcm_test_voiced();
+    audio_adpcm_reset(&state);
+    audio_adpcm_encode(&state, adpcm_pcm, ADPCM_TEST_SAMPLES, whole);
+    audio_adpcm_reset(&state);
+    for (int i = 0; i < ADPCM_TEST_SAMPLES; i += 320)
+    {
+        int n = (ADPCM_TEST_SAMPLES - i < 320) ? ADPCM_TEST_SAMPLES - i : 320;
+        audio_adpcm_encode(&state, adpcm_pcm + i, n, adpcm_coded + i / 2);
+    }
+    TEST_ASSERT_EQUAL_MEMORY(whole, adpcm_coded, sizeof(whole));
+}
+
+// 满幅方波: 预测值不能溢出 int16
+static void test_adpcm_full_scale_clamps(void)
+{
+    audio_adpcm_state_t enc, dec;
+
+    for (int i = 0; i < ADPCM_TEST_SAMPLES; i++)
+        adpcm_pcm[i] = ((i / 40) & 1) ? INT16_MAX : INT16_MIN;
+    audio_adpcm_reset(&enc);
+    audio_adpcm_reset(&dec);
+    audio_adpcm_encode(&enc, adpcm_pcm, ADPCM_TEST_SAMPLES, adpcm_coded);
+    audio_adpcm_decode(&dec, adpcm_coded, ADPCM_TEST_SAMPLES / 2, adpcm_decoded);
+    // 稳定后每个平台的中段应接近满幅且符号正确
+    for (int i = 40 * 10 + 20; i < ADPCM_TEST_SAMPLES; i += 40)
+    {
+        int expected_sign = ((i / 40) & 1) ? 1 : -1;
+        TEST_ASSERT_TRUE(adpcm_decoded[i] * expected_sign > 16000);
+    }
+}
+
+static void bench_adpcm(void)
+{
+    const int blocks = ADPCM_BENCH_SECONDS * ADPCM_TEST_RATE / ADPCM_TEST_BLOCK;
+    audio_adpcm_state_t state;
+    uint64_t encode_ns = 0, decode_ns = 0;
+
+    adpcm_test_voiced();
+    audio_adpcm_reset(&state);
+    for (int b = 0; b < blocks; b++)
+    {
+        int offset = (b * ADPCM_TEST_BLOCK) % (ADPCM_TEST_SAMPLES - ADPCM_TEST_BLOCK);
+        uint64_t t0 = host_test_now_ns();
+        audio_adpcm_encode(&state, adpcm_pcm + offset, ADPCM_TEST_BLOCK, adpcm_coded);
+        encode_ns += host_test_now_ns() - t0;
+    }
+    audio_adpcm_reset(&state);
+    for (int b = 0; b < blocks; b++)
+    {
+        uint64_t t0 = host_test_now_ns();
+        audio_adpcm_decode(&state, adpcm_coded, ADPCM_TEST_BLOCK / 2, adpcm_decoded);
+        decode_ns += host_test_now_ns() - t0;
+    }
+
+    double samples = (double)blocks * ADPCM_TEST_BLOCK;
+    HOST_BENCH("audio_adpcm encode", "%.2f ns/sample, %.3f%% of real time at 16 kHz",
+               encode_ns / samples, encode_ns / (ADPCM_BENCH_SECONDS * 1e7));
+    HOST_BENCH("audio_adpcm decode", "%.2f ns/sample", decode_ns / samples);
+}
+
+void test_audio_adpcm_run(void)
+{
+    RUN_TEST(test_adpcm_tone_snr);
+    RUN_TEST(test_adpcm_voiced_snr);
+    RUN_TEST(test_adpcm_blocks_equal_one_shot);
+    RUN_TEST(test_adpcm_full_scale_clamps);
+    RUN_TEST(bench_adpcm);
+}
@@ -0,0 +1,474 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <dirent.h>
+#include "unity.h"
+#include "host_test.h"
+#include "audio_convert.h"
+#include "condition_golden.h"
+
+#define CONVERT_BLOCK_SAMPLES   1024        // I2S_AUDIO_BUFFER_SAMPLES
+#define CONVERT_BENCH_SECONDS   20
+#define CONDITION_TEST_SECONDS  8
+#define CONDITION_TEST_SAMPLES  (CONDITION_GOLDEN_RATE * CONDITION_TEST_SECONDS)
+#define CONDITION_TEST_TONE_HZ  1000
+#define CONDITION_TEST_MAX_DB_ERR   1.0f    // 收敛判据: 块峰值与期望值相差不超过 1dB
+
+// 逐样本的参考实现: 与内核的约定相同 (算术右移后饱和到 ±INT16_MAX)
+static int16_t convert_reference(int32_t value, int shift)
+{
+    int32_t v = value >> shift;
+    if (v > INT16_MAX)
+        return INT16_MAX;
+    if (v < -INT16_MAX)
+        return -INT16_MAX;
+    return (int16_t)v;
+}
+
+static void convert_fill(int32_t *samples, int count, uint32_t seed)
+{
+    for (int i = 0; i < count; i++)
+        samples[i] = (int32_t)host_test_rand(&seed);
+    // 边界值
+    samples[0] = INT32_MAX;
+    samples[1] = INT32_MIN;
+    samples[2] = -1;
+    samples[3] = 0;
+}
+
+static void test_convert_matches_reference(void)
+{
+    static int32_t input[CONVERT_BLOCK_SAMPLES + 3];
+    static int16_t output[CONVERT_BLOCK_SAMPLES + 3];
+    const int shifts[] = { 8, 12, 16 };
+
+    convert_fill(input, CONVERT_BLOCK_SAMPLES + 3, 0xC0FFEEu);
+    for (size_t s = 0; s < sizeof(shifts) / sizeof(shifts[0]); s++)
+    {
+        // 奇数长度覆盖 4 路展开之后的尾部
+        for (int count = CONVERT_BLOCK_SAMPLES; count <= CONVERT_BLOCK_SAMPLES + 3; count++)
+        {
+            audio_convert_int32_to_int16(input, output, count, shifts[s]);
+            for (int i = 0; i < count; i++)
+                TEST_ASSERT_EQUAL_INT16(convert_reference(input[i], shifts[s]), output[i]);
+        }
+    }
+}
+
+static void test_convert_in_place(void)
+{
+    static int32_t buffer[CONVERT_BLOCK_SAMPLES + 1];
+    static int32_t copy[CONVERT_BLOCK_SAMPLES + 1];
+
+    convert_fill(buffer, CONVERT_BLOCK_SAMPLES + 1, 0xBADC0DEu);
+    memcpy(copy, buffer, sizeof(buffer));
+    audio_convert_int32_to_int16(buffer, (int16_t *)buffer, CONVERT_BLOCK_SAMPLES + 1, AUDIO_CONVERT_DEFAULT_SHIFT);
+    for (int i = 0; i < CONVERT_BLOCK_SAMPLES + 1; i++)
+        TEST_ASSERT_EQUAL_INT16(convert_reference(copy[i], AUDIO_CONVERT_DEFAULT_SHIFT), ((int16_t *)buffer)[i]);
+}
+
+static void test_unpack_in_place(void)
+{
+    static int32_t buffer[CONVERT_BLOCK_SAMPLES];
+    static int32_t expected[CONVERT_BLOCK_SAMPLES];
+    const int widths[] = { 2, 3 };
+
+    for (size_t w = 0; w < sizeof(widths) / sizeof(widths[0]); w++)
+    {
+        int bytes = widths[w];
+        uint8_t *packed = (uint8_t *)buffer + CONVERT_BLOCK_SAMPLES * (4 - bytes);
+        uint32_t seed = 0x1357u + (uint32_t)bytes;
+
+        for (int i = 0; i < CONVERT_BLOCK_SAMPLES; i++)
+        {
+            uint32_t value = host_test_rand(&seed);
+            for (int b = 0; b < bytes; b++)
+                packed[i * bytes + b] = (uint8_t)(value >> (8 * b));
+            expected[i] = (int32_t)(value << (32 - 8 * bytes));
+        }
+        audio_convert_unpack_to_int32(packed, buffer, CONVERT_BLOCK_SAMPLES, bytes);
+        TEST_ASSERT_EQUAL_INT32_ARRAY(expected, buffer, CONVERT_BLOCK_SAMPLES);
+    }
+}
+
+// 与 script/condition_reference.py synth_signal() 逐样本相同
+static void condition_test_signal(int32_t *samples)
+{
+    uint32_t seed = CONDITION_GOLDEN_SEED;
+
+    for (int n = 0; n < CONDITION_GOLDEN_SAMPLES; n++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        int32_t noise = (int32_t)(seed >> 16) - 32768;
+        int32_t phase = n % CONDITION_GOLDEN_PERIOD;
+        int32_t tri = (phase < CONDITION_GOLDEN_PERIOD / 2) ? 4 * phase - CONDITION_GOLDEN_PERIOD
+                                                            : 3 * CONDITION_GOLDEN_PERIOD - 4 * phase;
+        int32_t value = CONDITION_GOLDEN_BIAS + tri * condition_golden_levels[n / CONDITION_GOLDEN_BLOCK] +
+                        (noise >> CONDITION_GOLDEN_NOISE_SHIFT);
+        value = (value > (1 << 23) - 1) ? (1 << 23) - 1 : value;
+        value = (value < -((1 << 23) - 1)) ? -((1 << 23) - 1) : value;
+        samples[n] = (int32_t)((uint32_t)value << 8);
+    }
+}
+
+/**
+ * 调理输出与参考模型逐样本相同 (整数算法, 与机器无关). 块依次是静音, 小声, 接近满幅,
+ * 中等和削顶的过载, 覆盖 DC 初值, 增益保持/回升/下降和软限幅; 原地转换结果相同.
+ */
+static void test_condition_golden(void)
+{
+    static int32_t input[CONDITION_GOLDEN_SAMPLES];
+    static int32_t in_place[CONDITION_GOLDEN_SAMPLES];
+    static int16_t output[CONDITION_GOLDEN_SAMPLES];
+    audio_condition_config_t config;
+    audio_condition_t cond, cond_in_place;
+    char message[48];
+
+    condition_test_signal(input);
+    memcpy(in_place, input, sizeof(input));
+    audio_condition_default_config(&config, CONDITION_GOLDEN_RATE);
+    audio_condition_init(&cond, &config);
+    audio_condition_init(&cond_in_place, &config);
+
+    for (int b = 0; b < CONDITION_GOLDEN_BLOCKS; b++)
+    {
+        int offset = b * CONDITION_GOLDEN_BLOCK;
+        int16_t *block = (int16_t *)(in_place + offset);
+
+        audio_convert_condition_int32_to_int16(&cond, input + offset, output + offset, CONDITION_GOLDEN_BLOCK);
+        audio_convert_condition_int32_to_int16(&cond_in_place, in_place + offset, block, CONDITION_GOLDEN_BLOCK);
+        snprintf(message, sizeof(message), "gain after block %d", b);
+        TEST_ASSERT_EQUAL_INT32_MESSAGE(condition_golden_gain[b], cond.gain_next, message);
+        TEST_ASSERT_EQUAL_INT16_ARRAY(condition_golden + offset, output + offset, CONDITION_GOLDEN_BLOCK);
+        TEST_ASSERT_EQUAL_INT16_ARRAY(condition_golden + offset, block, CONDITION_GOLDEN_BLOCK);
+    }
+
+    // 静音块不改变增益; 过载块的输出被软限幅压在满幅以内
+    TEST_ASSERT_EQUAL_INT32(AUDIO_CONDITION_GAIN_ONE, condition_golden_gain[0]);
+    TEST_ASSERT_LESS_THAN_INT32(AUDIO_CONDITION_GAIN_ONE, condition_golden_gain[CONDITION_GOLDEN_BLOCKS - 1]);
+}
+
+// PCM16 单位增益下的样本值换算到 I2S 的 int32 (24bit 左对齐, 默认转换右移 12 位)
+static int32_t condition_test_sample(float pcm16)
+{
+    return (int32_t)lrintf(pcm16) * (1 << AUDIO_CONVERT_DEFAULT_SHIFT);
+}
+
+// 偏置 + 正弦, 1kHz 在 16kHz 下每周期 16 个样本, 四分之一周期处正好取到峰值
+static void condition_test_tone(int32_t *samples, int count, float amplitude, float bias)
+{
+    for (int n = 0; n < count; n++)
+        samples[n] = condition_test_sample(bias + amplitude * sinf(2.0f * (float)M_PI * CONDITION_TEST_TONE_HZ * n /
+                                                                   CONDITION_GOLDEN_RATE));
+}
+
+static int32_t condition_test_block_peak(const int16_t *block, int count)
+{
+    int32_t peak = 0;
+
+    for (int i = 0; i < count; i++)
+        peak = (abs(block[i]) > peak) ? abs(block[i]) : peak;
+    return peak;
+}
+
+static float condition_test_block_mean(const int16_t *block, int count)
+{
+    int64_t sum = 0;
+
+    for (int i = 0; i < count; i++)
+        sum += block[i];
+    return (float)sum / count;
+}
+
+static int condition_test_limited(const int16_t *block, int count)
+{
+    int limited = 0;
+
+    for (int i = 0; i < count; i++)
+        limited += (abs(block[i]) > AUDIO_CONDITION_LIMIT_KNEE);
+    return limited;
+}
+
+/**
+ * 偏置去除: 不依赖参考模型, 只看输出的块均值. 会话开头用第一个样本作 DC 初值, 没有阶跃;
+ * 稳态残差和偏置跳变后的恢复都在几个时间常数 (2^10 样本) 内.
+ */
+static void test_condition_dc_removal(void)
+{
+    static int32_t input[CONDITION_TEST_SAMPLES];
+    static int16_t output[CONDITION_TEST_SAMPLES];
+    const int block = CONDITION_GOLDEN_BLOCK;
+    const int step_at = CONDITION_TEST_SAMPLES / 2 / block * block;
+    const int settle = CONDITION_GOLDEN_RATE / 2;
+    audio_condition_config_t config;
+    audio_condition_t cond;
+    float residual = 0.0f;
+
+    condition_test_tone(input, step_at, 3000.0f, 3000.0f);
+    condition_test_tone(input + step_at, CONDITION_TEST_SAMPLES - step_at, 3000.0f, -2000.0f);
+    audio_condition_default_config(&config, CONDITION_GOLDEN_RATE);
+    audio_condition_init(&cond, &config);
+    for (int offset = 0; offset < CONDITION_TEST_SAMPLES; offset += block)
+        audio_convert_condition_int32_to_int16(&cond, input + offset, output + offset, block);
+
+    TEST_ASSERT_EQUAL_INT16(0, output[0]);
+    TEST_ASSERT_LESS_THAN_INT32(4000, condition_test_block_peak(output, block));
+
+    for (int offset = 0; offset < CONDITION_TEST_SAMPLES; offset += block)
+    {
+        bool settled = ((offset >= settle) && (offset < step_at)) || (offset >= step_at + settle);
+        float mean = fabsf(condition_test_block_mean(output + offset, block));
+        if (!settled)
+            continue;
+        TEST_ASSERT_FLOAT_WITHIN(16.0f, 0.0f, mean);
+        residual = (mean > residual) ? mean : residual;
+    }
+    HOST_BENCH("condition DC residual", "%.2f LSB max block mean (bias 3000 -> -2000 LSB)", residual);
+}
+
+typedef struct {
+    float amplitude;        // PCM16 单位增益下的峰值
+    int settle_max_ms;
+} condition_test_level_t;
+
+/**
+ * 增益收敛: 稳态正弦的输出块峰值收敛到 target_peak; 需要的增益超过上限时停在 max_gain,
+ * 低于噪声门限时保持单位增益. 收敛时间是此后所有块都在 1dB 以内的第一个块;
+ * 上升按 release, 下降按 attack, 过载的第一块由软限幅兜住.
+ */
+static void test_condition_gain_convergence(void)
+{
+    static int32_t input[CONDITION_TEST_SAMPLES];
+    static int16_t output[CONDITION_TEST_SAMPLES];
+    const condition_test_level_t levels[] = {
+        { 600.0f, 5000 },       // 需要 +26dB, 停在 +24dB 上限
+        { 3000.0f, 5000 },
+        { 11600.0f, 100 },      // 已在目标附近
+        { 30000.0f, 300 },      // 过载
+    };
+    const int block = CONDITION_GOLDEN_BLOCK;
+    const int blocks = CONDITION_TEST_SAMPLES / block;
+    audio_condition_config_t config;
+    audio_condition_t cond;
+    char result[160];
+    int len = 0;
+
+    audio_condition_default_config(&config, CONDITION_GOLDEN_RATE);
+    for (size_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++)
+    {
+        float wanted = fminf((float)config.target_peak,
+                             levels[l].amplitude * config.max_gain / (float)AUDIO_CONDITION_GAIN_ONE);
+        int settled = -1;
+
+        condition_test_tone(input, CONDITION_TEST_SAMPLES, levels[l].amplitude, 0.0f);
+        audio_condition_init(&cond, &config);
+        for (int b = 0; b < blocks; b++)
+        {
+            audio_convert_condition_int32_to_int16(&cond, input + b * block, output + b * block, block);
+            float err_db = 20.0f * log10f(condition_test_block_peak(output + b * block, block) / wanted);
+            if (fabsf(err_db) > CONDITION_TEST_MAX_DB_ERR)
+                settled = -1;
+            else if (settled < 0)
+                settled = b;
+        }
+
+        TEST_ASSERT_GREATER_OR_EQUAL_INT(0, settled);
+        int settle_ms = settled * block * 1000 / CONDITION_GOLDEN_RATE;
+        TEST_ASSERT_LESS_OR_EQUAL_INT(levels[l].settle_max_ms, settle_ms);
+        TEST_ASSERT_EQUAL_INT(0, condition_test_limited(output + (blocks - 1) * block, block));
+        if (levels[l].amplitude * config.max_gain / AUDIO_CONDITION_GAIN_ONE < config.target_peak)
+            TEST_ASSERT_INT32_WITHIN(config.max_gain / 100, config.max_gain, cond.gain_next);
+        if (levels[l].amplitude > AUDIO_CONDITION_LIMIT_KNEE)
+            TEST_ASSERT_GREATER_THAN_INT(0, condition_test_limited(output, block));
+        len += snprintf(result + len, sizeof(result) - len, "%s%.0f: %d ms", l ? ", " : "",
+                        levels[l].amplitude, settle_ms);
+    }
+    HOST_BENCH("condition AGC settle (1 dB)", "%s", result);
+
+    // 低于噪声门限: 增益不动, 不放大底噪
+    condition_test_tone(input, CONDITION_TEST_SAMPLES, 100.0f, 0.0f);
+    audio_condition_init(&cond, &config);
+    for (int b = 0; b < blocks; b++)
+    {
+        audio_convert_condition_int32_to_int16(&cond, input + b * block, output + b * block, block);
+        TEST_ASSERT_EQUAL_INT32(AUDIO_CONDITION_GAIN_ONE, cond.gain_next);
+    }
+}
+
+/**
+ * 数据集模式: 设置 CONDITION_DATA_DIR 为 PCM16/16kHz 的录音目录 (与 AUDIO_VAD_DATA_DIR 相同格式),
+ * 样本按默认转换的移位还原成 I2S 的 int32 后过调理. 对每个文件统计稳态的 DC 残差 (后半段的均值),
+ * AGC 收敛时间 (此后增益都在最终增益 1dB 以内的第一个块) 和进入软限幅的样本数.
+ * 只打印统计, 不作为通过条件.
+ */
+static void test_condition_dataset(void)
+{
+    const char *dir_path = getenv("CONDITION_DATA_DIR");
+    static int16_t pcm[CONDITION_TEST_SAMPLES];
+    static int32_t input[CONDITION_TEST_SAMPLES];
+    static int16_t output[CONDITION_TEST_SAMPLES];
+    static int32_t gains[CONDITION_TEST_SAMPLES / CONDITION_GOLDEN_BLOCK];
+    const int block = CONDITION_GOLDEN_BLOCK;
+    audio_condition_config_t config;
+    audio_condition_t cond;
+    int files = 0, limited_files = 0, limited = 0, settle_ms_max = 0;
+    float dc_in_max = 0.0f, dc_out_max = 0.0f;
+    int64_t settle_ms_sum = 0;
+
+    if (dir_path == NULL)
+    {
+        TEST_MESSAGE("CONDITION_DATA_DIR not set, dataset pass skipped");
+        return;
+    }
+    DIR *dir = opendir(dir_path);
+    TEST_ASSERT_NOT_NULL(dir);
+    audio_condition_default_config(&config, CONDITION_GOLDEN_RATE);
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        const char *ext = strrchr(entry->d_name, '.');
+        if ((ext == NULL) || ((strcmp(ext, ".pcm") != 0) && (strcmp(ext, ".bin") != 0)))
+            continue;
+
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", dir_path, entry->d_name);
+        FILE *f = fopen(path, "rb");
+        if (f == NULL)
+            continue;
+        int blocks = (int)fread(pcm, sizeof(int16_t), CONDITION_TEST_SAMPLES, f) / block;
+        fclose(f);
+        if (blocks < 2)
+            continue;
+
+        for (int i = 0; i < blocks * block; i++)
+            input[i] = condition_test_sample(pcm[i]);
+        audio_condition_init(&cond, &config);
+        for (int b = 0; b < blocks; b++)
+        {
+            audio_convert_condition_int32_to_int16(&cond, input + b * block, output + b * block, block);
+            gains[b] = cond.gain_next;
+        }
+
+        int half = blocks / 2 * block;
+        int64_t sum_in = 0, sum_out = 0;
+        for (int i = half; i < blocks * block; i++)
+        {
+            sum_in += pcm[i];
+            sum_out += output[i];
+        }
+        float dc_in = fabsf((float)sum_in / (blocks * block - half));
+        float dc_out = fabsf((float)sum_out / (blocks * block - half));
+        dc_in_max = (dc_in > dc_in_max) ? dc_in : dc_in_max;
+        dc_out_max = (dc_out > dc_out_max) ? dc_out : dc_out_max;
+
+        int settled = 0;
+        for (int b = 0; b < blocks; b++)
+        {
+            if (fabsf(20.0f * log10f((float)gains[b] / gains[blocks - 1])) > CONDITION_TEST_MAX_DB_ERR)
+                settled = b + 1;
+        }
+        int settle_ms = settled * block * 1000 / CONDITION_GOLDEN_RATE;
+        settle_ms_sum += settle_ms;
+        settle_ms_max = (settle_ms > settle_ms_max) ? settle_ms : settle_ms_max;
+
+        int n = condition_test_limited(output, blocks * block);
+        limited += n;
+        limited_files += (n > 0);
+        files++;
+    }
+    closedir(dir);
+
+    HOST_BENCH("condition dataset", "%d files, DC in %.1f -> out %.2f LSB max, AGC settle mean %d / max %d ms, "
+               "limiter %d samples in %d files", files, dc_in_max, dc_out_max,
+               files ? (int)(settle_ms_sum / files) : 0, settle_ms_max, limited, limited_files);
+}
+
+/**
+ * 每秒音频的转换耗时, 与同样字节数的 memcpy (读 4 字节写 2 字节) 对比:
+ * memcpy 是任何 SIMD 版本都越不过的内存带宽下限.
+ */
+static void bench_convert_rate(int sample_rate)
+{
+    static int32_t input[CONVERT_BLOCK_SAMPLES];
+    static int16_t output[CONVERT_BLOCK_SAMPLES];
+    static uint8_t scratch[CONVERT_BLOCK_SAMPLES * 6];
+    int blocks = sample_rate * CONVERT_BENCH_SECONDS / CONVERT_BLOCK_SAMPLES;
+    char name[48];
+
+    convert_fill(input, CONVERT_BLOCK_SAMPLES, 0x2468u);
+    uint64_t t0 = host_test_now_ns();
+    for (int b = 0; b < blocks; b++)
+    {
+        audio_convert_int32_to_int16(input, output, CONVERT_BLOCK_SAMPLES, AUDIO_CONVERT_DEFAULT_SHIFT);
+        __asm__ volatile("" : : "r"(output) : "memory");
+    }
+    uint64_t t1 = host_test_now_ns();
+    for (int b = 0; b < blocks; b++)
+    {
+        memcpy(scratch, input, sizeof(input));
+        memcpy(scratch + sizeof(input), output, sizeof(output));
+        __asm__ volatile("" : : "r"(scratch) : "memory");
+    }
+    uint64_t t2 = host_test_now_ns();
+
+    double samples = (double)blocks * CONVERT_BLOCK_SAMPLES;
+    snprintf(name, sizeof(name), "convert int32->int16 %d kHz", sample_rate / 1000);
+    HOST_BENCH(name, "%.3f ns/sample, %.4f%% of real time, memcpy bound %.3f ns/sample",
+               (double)(t1 - t0) / samples, (double)(t1 - t0) / (CONVERT_BENCH_SECONDS * 1e7),
+               (double)(t2 - t1) / samples);
+}
+
+static void bench_convert(void)
+{
+    bench_convert_rate(16000);
+    bench_convert_rate(32000);
+}
+
+// 调理 (DC 高通 + 增益 + 软限幅) 比单纯转换多出的开销, 用参考信号 (含限幅的块) 循环
+static void bench_condition(void)
+{
+    static int32_t input[CONDITION_GOLDEN_SAMPLES];
+    static int16_t output[CONDITION_GOLDEN_BLOCK];
+    int blocks = CONDITION_GOLDEN_RATE * CONVERT_BENCH_SECONDS / CONDITION_GOLDEN_BLOCK;
+    audio_condition_config_t config;
+    audio_condition_t cond;
+
+    condition_test_signal(input);
+    audio_condition_default_config(&config, CONDITION_GOLDEN_RATE);
+    audio_condition_init(&cond, &config);
+    uint64_t t0 = host_test_now_ns();
+    for (int b = 0; b < blocks; b++)
+    {
+        const int32_t *block = input + (b % CONDITION_GOLDEN_BLOCKS) * CONDITION_GOLDEN_BLOCK;
+        audio_convert_condition_int32_to_int16(&cond, block, output, CONDITION_GOLDEN_BLOCK);
+        __asm__ volatile("" : : "r"(output) : "memory");
+    }
+    uint64_t t1 = host_test_now_ns();
+    for (int b = 0; b < blocks; b++)
+    {
+        const int32_t *block = input + (b % CONDITION_GOLDEN_BLOCKS) * CONDITION_GOLDEN_BLOCK;
+        audio_convert_int32_to_int16(block, output, CONDITION_GOLDEN_BLOCK, AUDIO_CONVERT_DEFAULT_SHIFT);
+        __asm__ volatile("" : : "r"(output) : "memory");
+    }
+    uint64_t t2 = host_test_now_ns();
+
+    double samples = (double)blocks * CONDITION_GOLDEN_BLOCK;
+    HOST_BENCH("condition int32->int16 16 kHz", "%.3f ns/sample, %.4f%% of real time, %.1fx plain convert",
+               (double)(t1 - t0) / samples, (double)(t1 - t0) / (CONVERT_BENCH_SECONDS * 1e7),
+               (double)(t1 - t0) / (double)(t2 - t1));
+}
+
+void test_audio_convert_run(void)
+{
+    RUN_TEST(test_convert_matches_reference);
+    RUN_TEST(test_convert_in_place);
+    RUN_TEST(test_unpack_in_place);
+    RUN_TEST(test_condition_golden);
+    RUN_TEST(test_condition_dc_removal);
+    RUN_TEST(test_condition_gain_convergence);
+    RUN_TEST(test_condition_dataset);
+    RUN_TEST(bench_convert);
+    RUN_TEST(bench_condition);
+}
@@ -0,0 +1,221 @@
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include "unity.h"
+#include "host_test.h"
+#include "audio_history.h"
+
+#define HISTORY_TEST_SIZE       4096        // 样本, 2 的幂
+#define HISTORY_TEST_PRE        1500        // 触发点前
+#define HISTORY_TEST_POST       900         // 触发点后
+#define HISTORY_TEST_START      (UINT32_MAX - 20000u)   // 测试中途 total 回绕
+#define HISTORY_TEST_WRITES     40000       // 并发测试中写入的块数
+#define HISTORY_TEST_SNAPSHOTS  2000
+
+static int32_t history_test_storage[HISTORY_TEST_SIZE];
+static audio_history_t history;
+
+// 奇数长度的块, 与缓冲区长度互质, 块边界落在各个位置
+static const int history_test_blocks[] = { 37, 1023, 511, 3, 257, 1 };
+
+static volatile bool history_test_done;
+static volatile uint32_t history_test_delay_us;
+
+// 样本值是它的绝对序号, 回绕后仍然连续
+static uint32_t history_test_write_ramp(uint32_t total, int samples)
+{
+    static int32_t block[1024];
+
+    for (int i = 0; i < samples; i++)
+        block[i] = (int32_t)(total + (uint32_t)i);
+    audio_history_write(&history, block, samples);
+    return total + (uint32_t)samples;
+}
+
+static void history_test_init(uint32_t start)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, audio_history_init(&history, history_test_storage, HISTORY_TEST_SIZE));
+    // 模拟已经运行了很久: 从接近回绕的位置开始计数
+    atomic_store(&history.total, start);
+    atomic_store(&history.reserved, start);
+}
+
+static int history_test_check_ramp(const int32_t *samples, uint32_t start, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (samples[i] != (int32_t)(start + (uint32_t)i))
+            return i;
+    }
+    return -1;
+}
+
+/**
+ * 与 i2s_audio_history_snapshot 相同: 以调用时刻为触发点, 取 pre 个历史样本加 post 个后续样本,
+ * 后续样本还没写到时轮询. 返回触发点的序号.
+ */
+static esp_err_t history_test_snapshot(int32_t *buffer, int pre, int post, uint32_t *trigger)
+{
+    esp_err_t err;
+
+    *trigger = audio_history_total(&history);
+    uint32_t start = *trigger - (uint32_t)pre;
+    while ((err = audio_history_copy(&history, start, pre + post, buffer)) == ESP_ERR_NOT_FOUND)
+        usleep(100);
+    return err;
+}
+
+static void test_history_invalid_args(void)
+{
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_history_init(NULL, history_test_storage, HISTORY_TEST_SIZE));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_history_init(&history, NULL, HISTORY_TEST_SIZE));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_history_init(&history, history_test_storage, 0));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_history_init(&history, history_test_storage, 3000));
+}
+
+// 单线程: 奇数块写入跨过 uint32 回绕, 触发点前后的快照是连续的斜坡
+static void test_history_trigger_continuity(void)
+{
+    static int32_t snapshot[HISTORY_TEST_PRE + HISTORY_TEST_POST];
+    uint32_t total = HISTORY_TEST_START;
+    int checked = 0;
+    bool wrapped = false;
+
+    history_test_init(total);
+    for (int n = 0; n < 200; n++)
+    {
+        uint32_t before = total;
+        total = history_test_write_ramp(total, history_test_blocks[n % 6]);
+        wrapped |= (total < before);
+        TEST_ASSERT_EQUAL_UINT32(total, audio_history_total(&history));
+        if ((uint32_t)(total - HISTORY_TEST_START) < HISTORY_TEST_SIZE)
+            continue;
+
+        // 触发点在当前末尾往前 POST 个样本: 前后两部分都已写入
+        uint32_t start = total - HISTORY_TEST_POST - HISTORY_TEST_PRE;
+        TEST_ASSERT_EQUAL(ESP_OK, audio_history_copy(&history, start, HISTORY_TEST_PRE + HISTORY_TEST_POST, snapshot));
+        TEST_ASSERT_EQUAL_INT(-1, history_test_check_ramp(snapshot, start, HISTORY_TEST_PRE + HISTORY_TEST_POST));
+        checked++;
+    }
+    TEST_ASSERT_TRUE(wrapped);
+    TEST_ASSERT_GREATER_THAN(100, checked);
+}
+
+// 还没写到返回 NOT_FOUND, 被覆盖返回 INVALID_STATE, 超过缓冲区长度返回 INVALID_SIZE
+static void test_history_errors(void)
+{
+    static int32_t out[HISTORY_TEST_SIZE + 1];
+    uint32_t total = HISTORY_TEST_START;
+
+    history_test_init(total);
+    total = history_test_write_ramp(total, 1000);
+
+    // 触发点之后的样本还没到
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, audio_history_copy(&history, total - 100, 101, out));
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, audio_history_copy(&history, total + 5, 1, out));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_history_copy(&history, total - 100, 100, out));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, audio_history_copy(&history, total - 100, HISTORY_TEST_SIZE + 1, out));
+
+    // 写满一圈多之后, 最早的样本已被覆盖
+    uint32_t early = total - 1000;
+    for (int n = 0; n < 12; n++)
+        total = history_test_write_ramp(total, 511);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, audio_history_copy(&history, early, 10, out));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, audio_history_copy(&history, total - HISTORY_TEST_SIZE - 1, 10, out));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_history_copy(&history, total - HISTORY_TEST_SIZE, HISTORY_TEST_SIZE, out));
+    TEST_ASSERT_EQUAL_INT(-1, history_test_check_ramp(out, total - HISTORY_TEST_SIZE, HISTORY_TEST_SIZE));
+
+    // 一次写入超过缓冲区长度: 只保留最后 size 个样本, 序号照常推进
+    static int32_t big[HISTORY_TEST_SIZE + 300];
+    for (int i = 0; i < HISTORY_TEST_SIZE + 300; i++)
+        big[i] = (int32_t)(total + (uint32_t)i);
+    audio_history_write(&history, big, HISTORY_TEST_SIZE + 300);
+    total += HISTORY_TEST_SIZE + 300;
+    TEST_ASSERT_EQUAL_UINT32(total, audio_history_total(&history));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_history_copy(&history, total - HISTORY_TEST_SIZE, HISTORY_TEST_SIZE, out));
+    TEST_ASSERT_EQUAL_INT(-1, history_test_check_ramp(out, total - HISTORY_TEST_SIZE, HISTORY_TEST_SIZE));
+}
+
+// 模拟 I2S 读取任务: 按奇数块写入斜坡, 每块之间停 history_test_delay_us
+static void *history_test_writer(void *arg)
+{
+    uint32_t total = HISTORY_TEST_START;
+
+    for (int n = 0; (n < HISTORY_TEST_WRITES) && !history_test_done; n++)
+    {
+        total = history_test_write_ramp(total, history_test_blocks[n % 6]);
+        if (history_test_delay_us)
+            usleep(history_test_delay_us);
+        else if ((n % 8) == 0)
+            sched_yield();
+    }
+    history_test_done = true;
+    return NULL;
+}
+
+/**
+ * 写入线程持续写入时取快照: 成功的快照必须是触发点前后连续的斜坡;
+ * 拷贝期间被覆盖时只能返回 INVALID_STATE, 不能返回撕裂的数据.
+ */
+static void run_concurrent(uint32_t delay_us, uint32_t *ok, uint32_t *overwritten)
+{
+    static int32_t snapshot[HISTORY_TEST_PRE + HISTORY_TEST_POST];
+    pthread_t writer;
+    uint32_t trigger;
+
+    *ok = 0;
+    *overwritten = 0;
+    history_test_init(HISTORY_TEST_START);
+    history_test_done = false;
+    history_test_delay_us = delay_us;
+    TEST_ASSERT_EQUAL(0, pthread_create(&writer, NULL, history_test_writer, NULL));
+    // 先攒够触发点前的历史
+    while (!history_test_done && ((uint32_t)(audio_history_total(&history) - HISTORY_TEST_START) < HISTORY_TEST_PRE))
+        sched_yield();
+
+    for (int s = 0; (s < HISTORY_TEST_SNAPSHOTS) && !history_test_done; s++)
+    {
+        esp_err_t err = history_test_snapshot(snapshot, HISTORY_TEST_PRE, HISTORY_TEST_POST, &trigger);
+        if (err == ESP_OK)
+        {
+            TEST_ASSERT_EQUAL_INT(-1, history_test_check_ramp(snapshot, trigger - HISTORY_TEST_PRE,
+                                                            HISTORY_TEST_PRE + HISTORY_TEST_POST));
+            (*ok)++;
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, err);
+            (*overwritten)++;
+        }
+    }
+    history_test_done = true;
+    pthread_join(writer, NULL);
+}
+
+static void test_history_concurrent_writer(void)
+{
+    uint32_t ok, overwritten;
+    char result[64];
+
+    // 写入速度接近实时: 快照都应成功
+    run_concurrent(20, &ok, &overwritten);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, ok);
+    snprintf(result, sizeof(result), "%lu ok, %lu overwritten", (unsigned long)ok, (unsigned long)overwritten);
+    HOST_BENCH("audio_history snapshot paced", "%s", result);
+
+    // 写入全速: 部分快照在拷贝期间被覆盖, 只检查不出现撕裂
+    run_concurrent(0, &ok, &overwritten);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, ok + overwritten);
+    snprintf(result, sizeof(result), "%lu ok, %lu overwritten", (unsigned long)ok, (unsigned long)overwritten);
+    HOST_BENCH("audio_history snapshot full speed", "%s", result);
+}
+
+void test_audio_history_run(void)
+{
+    RUN_TEST(test_history_invalid_args);
+    RUN_TEST(test_history_trigger_continuity);
+    RUN_TEST(test_history_errors);
+    RUN_TEST(test_history_concurrent_writer);
+}
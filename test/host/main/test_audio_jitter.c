@@ -0,0 +1,268 @@
+#include <string.h>
+#include "unity.h"
+#include "host_test.h"
+#include "audio_jitter.h"
+
+#define JITTER_TEST_RATE        16000
+#define JITTER_TEST_RING_SIZE   32768       // AUDIO_DOWNLINK_RING_SIZE
+#define JITTER_TEST_PACKET      320         // 20ms 一个下行帧
+#define JITTER_TEST_POP         160         // 播放任务 10ms 取一次
+#define JITTER_TEST_PACKETS     500         // 10s
+#define JITTER_TEST_TRANSIT_US  30000       // 基础网络时延
+#define JITTER_TEST_SPREAD_US   2000        // 稳定网络上的随机抖动
+#define JITTER_TEST_BURST_US    100000      // 突发: Wi-Fi 省电, 每 100ms 集中收到 5 帧
+#define JITTER_TEST_SPIKE_AT_US 4000000     // 4s 处停顿 300ms, 之后积压的帧一起到达
+#define JITTER_TEST_SPIKE_US    300000
+#define JITTER_TEST_GAP_AT_US   5000000     // 5s 处服务端暂停 600ms, 之后整体推迟
+#define JITTER_TEST_GAP_US      600000
+#define JITTER_TEST_MS(samples) ((double)(samples) * 1000.0 / JITTER_TEST_RATE)
+
+typedef enum {
+    JITTER_TRACE_STEADY = 0,
+    JITTER_TRACE_BURSTY,
+    JITTER_TRACE_LATE_SPIKE,
+    JITTER_TRACE_GAP,
+} jitter_trace_t;
+
+static const char *jitter_trace_names[] = { "steady", "bursty", "late spike", "gap" };
+
+typedef struct {
+    audio_jitter_stats_t stats;
+    uint32_t underruns_at_end;              // end_session 时的欠载数, 之后播完剩余样本不应再增加
+    uint32_t played;
+    uint32_t skipped;                       // 输出中跳过的样本序号, 应等于 trimmed
+    double latency_sum_ms;                  // 每个播放样本: 播放时刻 - 所在帧的到达时刻
+    double latency_max_ms;
+    double latency_tail_ms;                 // 最后 1s 播放样本的平均值
+    uint32_t tail_count;
+} jitter_test_result_t;
+
+static uint8_t jitter_test_storage[JITTER_TEST_RING_SIZE];
+static int64_t jitter_test_arrival[JITTER_TEST_PACKETS];
+
+// 到达时刻 (us, 相对会话开始的媒体时间), 按帧顺序不减 (TCP 按序交付)
+static void jitter_test_make_trace(jitter_trace_t trace)
+{
+    uint32_t seed = 0x51A7u + (uint32_t)trace;
+    int64_t previous = 0;
+
+    for (int p = 0; p < JITTER_TEST_PACKETS; p++)
+    {
+        int64_t media_us = (int64_t)p * JITTER_TEST_PACKET * 1000000 / JITTER_TEST_RATE;
+        int64_t arrival = media_us + JITTER_TEST_TRANSIT_US + host_test_rand(&seed) % JITTER_TEST_SPREAD_US;
+
+        switch (trace)
+        {
+        case JITTER_TRACE_BURSTY:
+            arrival = (media_us / JITTER_TEST_BURST_US + 1) * JITTER_TEST_BURST_US + JITTER_TEST_TRANSIT_US +
+                      host_test_rand(&seed) % JITTER_TEST_SPREAD_US;
+            break;
+        case JITTER_TRACE_LATE_SPIKE:
+            if ((media_us >= JITTER_TEST_SPIKE_AT_US) && (media_us < JITTER_TEST_SPIKE_AT_US + JITTER_TEST_SPIKE_US))
+                arrival = JITTER_TEST_SPIKE_AT_US + JITTER_TEST_SPIKE_US + JITTER_TEST_TRANSIT_US;
+            break;
+        case JITTER_TRACE_GAP:
+            if (media_us >= JITTER_TEST_GAP_AT_US)
+                arrival += JITTER_TEST_GAP_US;
+            break;
+        default:
+            break;
+        }
+        arrival = (arrival < previous) ? previous : arrival;
+        jitter_test_arrival[p] = arrival;
+        previous = arrival;
+    }
+}
+
+/**
+ * 回放一条到达轨迹: 每 10ms 先推入已到达的帧, 再取 10ms 播放. 样本值是序号的低 15 位,
+ * 由此还原每个播放样本的序号, 检查连续性并统计它在缓冲中等待的时间.
+ */
+static void jitter_test_replay(jitter_trace_t trace, jitter_test_result_t *result)
+{
+    static audio_jitter_t jitter;
+    audio_jitter_config_t config;
+    int16_t packet[JITTER_TEST_PACKET];
+    int16_t out[JITTER_TEST_POP];
+    const uint32_t total = JITTER_TEST_PACKETS * JITTER_TEST_PACKET;
+    uint32_t next_index = 0;
+    int pushed = 0;
+    bool ended = false;
+
+    memset(result, 0, sizeof(*result));
+    jitter_test_make_trace(trace);
+    audio_jitter_default_config(&config);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_jitter_init(&jitter, &config, jitter_test_storage, sizeof(jitter_test_storage)));
+    audio_jitter_start_session(&jitter, JITTER_TEST_RATE);
+
+    int64_t end_us = jitter_test_arrival[JITTER_TEST_PACKETS - 1] + 5000000;
+    for (int64_t now = jitter_test_arrival[0]; now < end_us; now += JITTER_TEST_POP * 1000000 / JITTER_TEST_RATE)
+    {
+        while ((pushed < JITTER_TEST_PACKETS) && (jitter_test_arrival[pushed] <= now))
+        {
+            uint32_t index = (uint32_t)pushed * JITTER_TEST_PACKET;
+            for (int i = 0; i < JITTER_TEST_PACKET; i++)
+                packet[i] = (int16_t)((index + i) & 0x7FFF);
+            TEST_ASSERT_EQUAL(JITTER_TEST_PACKET,
+                              audio_jitter_push(&jitter, packet, JITTER_TEST_PACKET, index, jitter_test_arrival[pushed]));
+            pushed++;
+        }
+        if ((pushed == JITTER_TEST_PACKETS) && !ended)
+        {
+            audio_jitter_end_session(&jitter);
+            audio_jitter_get_stats(&jitter, &result->stats);
+            result->underruns_at_end = result->stats.underruns;
+            ended = true;
+        }
+
+        int got = audio_jitter_pop(&jitter, out, JITTER_TEST_POP);
+        for (int i = 0; i < got; i++)
+        {
+            // 丢弃只会向前跳, 每次不超过请求长度的 1/16
+            uint32_t index = next_index + (((uint32_t)out[i] - next_index) & 0x7FFF);
+            result->skipped += index - next_index;
+            next_index = index + 1;
+
+            double latency = (double)(now + (int64_t)i * 1000000 / JITTER_TEST_RATE -
+                                      jitter_test_arrival[index / JITTER_TEST_PACKET]) / 1000.0;
+            result->latency_sum_ms += latency;
+            result->latency_max_ms = (latency > result->latency_max_ms) ? latency : result->latency_max_ms;
+            if (index >= total - JITTER_TEST_RATE)
+            {
+                result->latency_tail_ms += latency;
+                result->tail_count++;
+            }
+        }
+        result->played += (uint32_t)got;
+        if (ended && (got == 0) && (audio_jitter_depth(&jitter) == 0))
+            break;
+    }
+    audio_jitter_get_stats(&jitter, &result->stats);
+    result->latency_tail_ms /= (result->tail_count > 0) ? result->tail_count : 1;
+
+    // 所有样本要么播放要么为降低时延丢弃, 输出中的跳变正好是丢弃的样本
+    TEST_ASSERT_TRUE(ended);
+    TEST_ASSERT_EQUAL_UINT32(0, result->stats.overflows);
+    TEST_ASSERT_EQUAL_UINT32(total, result->played + result->stats.trimmed);
+    TEST_ASSERT_EQUAL_UINT32(result->stats.trimmed, result->skipped);
+    TEST_ASSERT_EQUAL_UINT32(total, next_index);
+    // 会话结束后播完不足目标深度的尾部, 不算欠载
+    TEST_ASSERT_EQUAL_UINT32(result->underruns_at_end, result->stats.underruns);
+
+    char name[48];
+    snprintf(name, sizeof(name), "audio_jitter %s", jitter_trace_names[trace]);
+    HOST_BENCH(name, "underruns %lu, trimmed %lu, target %.0f ms (J %.1f ms), added latency mean %.0f ms, "
+               "max %.0f ms, last 1 s %.0f ms",
+               (unsigned long)result->stats.underruns, (unsigned long)result->stats.trimmed,
+               JITTER_TEST_MS(result->stats.target), result->stats.jitter_us / 1000.0,
+               result->latency_sum_ms / result->played, result->latency_max_ms, result->latency_tail_ms);
+}
+
+// 稳定网络: 不欠载, 不丢弃, 目标停在下限附近
+static void test_jitter_steady(void)
+{
+    jitter_test_result_t result;
+
+    jitter_test_replay(JITTER_TRACE_STEADY, &result);
+    TEST_ASSERT_EQUAL_UINT32(0, result.stats.underruns);
+    TEST_ASSERT_EQUAL_UINT32(0, result.stats.trimmed);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(JITTER_TEST_RATE * AUDIO_JITTER_DEFAULT_MIN_MS / 1000, result.stats.target);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(JITTER_TEST_RATE * (AUDIO_JITTER_DEFAULT_MIN_MS + 10) / 1000, result.stats.target);
+    TEST_ASSERT_TRUE(result.latency_tail_ms < AUDIO_JITTER_DEFAULT_MIN_MS + 20);
+}
+
+/**
+ * 每 100ms 一次突发: 相邻帧的传输时延差交替为 -20ms 和 +80ms, J 收敛到约 32ms,
+ * 目标约 40 + 3 x 32 = 136ms, 足以跨过突发间隔. 只允许收敛前的一次欠载.
+ */
+static void test_jitter_bursty(void)
+{
+    jitter_test_result_t result;
+
+    jitter_test_replay(JITTER_TRACE_BURSTY, &result);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(1, result.stats.underruns);
+    TEST_ASSERT_UINT32_WITHIN(JITTER_TEST_RATE * 20 / 1000, JITTER_TEST_RATE * 136 / 1000, result.stats.target);
+    TEST_ASSERT_TRUE(result.latency_max_ms < JITTER_TEST_MS(result.stats.target) + JITTER_TEST_BURST_US / 1000.0);
+}
+
+/**
+ * 300ms 停顿后积压的帧一起到达: 停顿中恰好欠载一次, 之后深度远超目标,
+ * 按每次 1/16 丢弃收回大部分积压 (不超过停顿长度), 最后 1s 的附加时延回到目标附近.
+ */
+static void test_jitter_late_spike(void)
+{
+    jitter_test_result_t result;
+
+    jitter_test_replay(JITTER_TRACE_LATE_SPIKE, &result);
+    TEST_ASSERT_EQUAL_UINT32(1, result.stats.underruns);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32((uint64_t)JITTER_TEST_SPIKE_US * JITTER_TEST_RATE / 1000000 * 2 / 3,
+                                        result.stats.trimmed);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32((uint64_t)JITTER_TEST_SPIKE_US * JITTER_TEST_RATE / 1000000, result.stats.trimmed);
+    TEST_ASSERT_TRUE(result.latency_tail_ms < JITTER_TEST_MS(result.stats.target) * 1.5 + 20);
+}
+
+/**
+ * 会话中途 600ms 没有数据 (不是会话结束): 计一次欠载, 重新缓冲后继续播放.
+ * 这一跳把 J 抬高约 37ms, 之后稳定到达, 目标收敛回下限附近.
+ */
+static void test_jitter_gap(void)
+{
+    jitter_test_result_t result;
+
+    jitter_test_replay(JITTER_TRACE_GAP, &result);
+    TEST_ASSERT_EQUAL_UINT32(1, result.stats.underruns);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(JITTER_TEST_RATE * (AUDIO_JITTER_DEFAULT_MIN_MS + 10) / 1000, result.stats.target);
+    TEST_ASSERT_TRUE(result.latency_tail_ms < JITTER_TEST_MS(result.stats.target) * 1.5 + 20);
+}
+
+// 同样取空缓冲: 会话已结束时把不足目标的尾部播完且不计欠载, 会话中取空计一次欠载并重新缓冲
+static void test_jitter_drain_vs_underrun(void)
+{
+    static audio_jitter_t jitter;
+    audio_jitter_config_t config;
+    audio_jitter_stats_t stats;
+    int16_t pcm[JITTER_TEST_PACKET] = { 0 };
+    int16_t out[JITTER_TEST_POP];
+    const uint32_t target = JITTER_TEST_RATE * AUDIO_JITTER_DEFAULT_MIN_MS / 1000;
+
+    audio_jitter_default_config(&config);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_jitter_init(&jitter, &config, jitter_test_storage, sizeof(jitter_test_storage)));
+    audio_jitter_start_session(&jitter, JITTER_TEST_RATE);
+
+    // 不足目标深度: 会话中输出静音等待
+    audio_jitter_push(&jitter, pcm, JITTER_TEST_PACKET, 0, 0);
+    TEST_ASSERT_LESS_THAN_UINT32(target, audio_jitter_depth(&jitter));
+    TEST_ASSERT_EQUAL(0, audio_jitter_pop(&jitter, out, JITTER_TEST_POP));
+
+    // 会话结束: 不足目标也播完, 不算欠载
+    audio_jitter_end_session(&jitter);
+    TEST_ASSERT_EQUAL(JITTER_TEST_POP, audio_jitter_pop(&jitter, out, JITTER_TEST_POP));
+    TEST_ASSERT_EQUAL(JITTER_TEST_POP, audio_jitter_pop(&jitter, out, JITTER_TEST_POP));
+    TEST_ASSERT_EQUAL(0, audio_jitter_pop(&jitter, out, JITTER_TEST_POP));
+    audio_jitter_get_stats(&jitter, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.underruns);
+
+    // 下一会话 (到达时刻与媒体时间一致, 目标不变): 达到目标开始播放, 中途取空计一次欠载, 然后回到缓冲状态
+    audio_jitter_start_session(&jitter, JITTER_TEST_RATE);
+    for (uint32_t index = 0; index < target; index += JITTER_TEST_PACKET)
+        audio_jitter_push(&jitter, pcm, JITTER_TEST_PACKET, index, (int64_t)index * 1000000 / JITTER_TEST_RATE);
+    uint32_t depth = audio_jitter_depth(&jitter);
+    for (uint32_t played = 0; played < depth; played += JITTER_TEST_POP)
+        TEST_ASSERT_EQUAL(JITTER_TEST_POP, audio_jitter_pop(&jitter, out, JITTER_TEST_POP));
+    TEST_ASSERT_EQUAL(0, audio_jitter_pop(&jitter, out, JITTER_TEST_POP));
+    audio_jitter_get_stats(&jitter, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.underruns);
+    audio_jitter_push(&jitter, pcm, JITTER_TEST_PACKET, depth, (int64_t)depth * 1000000 / JITTER_TEST_RATE);
+    TEST_ASSERT_EQUAL(0, audio_jitter_pop(&jitter, out, JITTER_TEST_POP));
+    audio_jitter_get_stats(&jitter, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.underruns);
+}
+
+void test_audio_jitter_run(void)
+{
+    RUN_TEST(test_jitter_steady);
+    RUN_TEST(test_jitter_bursty);
+    RUN_TEST(test_jitter_late_spike);
+    RUN_TEST(test_jitter_gap);
+    RUN_TEST(test_jitter_drain_vs_underrun);
+}
@@ -0,0 +1,185 @@
+#include <pthread.h>
+#include "unity.h"
+#include "host_test.h"
+#include "audio_metrics.h"
+
+#define METRICS_STRESS_THREADS  4
+#define METRICS_STRESS_COUNT    200000
+#define METRICS_BENCH_CALLS     20000000
+
+static void test_audio_metrics_counters(void)
+{
+    audio_metrics_snapshot_t snapshot;
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_metrics_init());
+    audio_metrics_reset();
+    audio_metrics_count(AUDIO_METRICS_FRAMES_CAPTURED);
+    audio_metrics_count(AUDIO_METRICS_FRAMES_CAPTURED);
+    audio_metrics_add(AUDIO_METRICS_PARTIAL_SENDS, 5);
+    audio_metrics_queue_depth(AUDIO_METRICS_QUEUE_READY, 7);
+    audio_metrics_queue_depth(AUDIO_METRICS_QUEUE_READY, 2);
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_metrics_snapshot(&snapshot));
+    TEST_ASSERT_EQUAL_UINT8(AUDIO_METRICS_VERSION, snapshot.version);
+    TEST_ASSERT_EQUAL_UINT8(AUDIO_METRICS_COUNTER_MAX, snapshot.counters);
+    TEST_ASSERT_EQUAL_UINT8(AUDIO_METRICS_BUCKETS, snapshot.buckets);
+    TEST_ASSERT_EQUAL_UINT32(2, snapshot.counter[AUDIO_METRICS_FRAMES_CAPTURED]);
+    TEST_ASSERT_EQUAL_UINT32(5, snapshot.counter[AUDIO_METRICS_PARTIAL_SENDS]);
+    TEST_ASSERT_EQUAL_UINT32(0, snapshot.counter[AUDIO_METRICS_SEND_ERRORS]);
+    TEST_ASSERT_EQUAL_UINT16(2, snapshot.queue[AUDIO_METRICS_QUEUE_READY].depth);
+    TEST_ASSERT_EQUAL_UINT16(7, snapshot.queue[AUDIO_METRICS_QUEUE_READY].high_water);
+
+    // 复位清除计数和高水位, 当前深度保留
+    audio_metrics_reset();
+    audio_metrics_snapshot(&snapshot);
+    TEST_ASSERT_EQUAL_UINT32(0, snapshot.counter[AUDIO_METRICS_FRAMES_CAPTURED]);
+    TEST_ASSERT_EQUAL_UINT16(0, snapshot.queue[AUDIO_METRICS_QUEUE_READY].high_water);
+    TEST_ASSERT_EQUAL_UINT16(2, snapshot.queue[AUDIO_METRICS_QUEUE_READY].depth);
+
+    // 请求标志只被取走一次
+    TEST_ASSERT_FALSE(audio_metrics_take_request());
+    audio_metrics_request();
+    TEST_ASSERT_TRUE(audio_metrics_take_request());
+    TEST_ASSERT_FALSE(audio_metrics_take_request());
+}
+
+// 桶 b 是 [2^b, 2^(b+1)) us, 0 us 进桶 0, 超出范围的进最后一桶
+static void test_audio_metrics_histogram(void)
+{
+    static const struct { uint32_t us; int bucket; } cases[] = {
+        { 0, 0 }, { 1, 0 }, { 2, 1 }, { 3, 1 }, { 4, 2 }, { 1023, 9 }, { 1024, 10 },
+        { 16000, 13 }, { 32767, 14 }, { 32768, 15 }, { 1000000, 15 },
+    };
+    audio_metrics_snapshot_t snapshot;
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        audio_metrics_reset();
+        audio_metrics_record_us(AUDIO_METRICS_STAGE_CONVERT, cases[i].us);
+        audio_metrics_snapshot(&snapshot);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(1, snapshot.stage[AUDIO_METRICS_STAGE_CONVERT].buckets[cases[i].bucket],
+                                         "wrong bucket");
+    }
+
+    audio_metrics_reset();
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        audio_metrics_record_us(AUDIO_METRICS_STAGE_SEND, cases[i].us);
+        sum += cases[i].us;
+    }
+    audio_metrics_snapshot(&snapshot);
+    const audio_metrics_histogram_t *histogram = &snapshot.stage[AUDIO_METRICS_STAGE_SEND];
+    TEST_ASSERT_EQUAL_UINT32(sizeof(cases) / sizeof(cases[0]), histogram->count);
+    TEST_ASSERT_EQUAL_UINT32(1000000, histogram->max_us);
+    TEST_ASSERT_EQUAL_UINT64(sum, histogram->sum_us);
+    TEST_ASSERT_EQUAL_UINT32(0, snapshot.stage[AUDIO_METRICS_STAGE_READ].count);
+}
+
+typedef struct {
+    audio_metrics_stage_t stage;
+    uint32_t seed;
+} metrics_stress_t;
+
+// 计数器被所有线程共享; 直方图每个阶段只有一个线程记录 (与固件相同)
+static void *metrics_stress_thread(void *arg)
+{
+    metrics_stress_t *stress = (metrics_stress_t *)arg;
+
+    for (int i = 0; i < METRICS_STRESS_COUNT; i++)
+    {
+        audio_metrics_count(AUDIO_METRICS_FRAMES_SENT);
+        audio_metrics_add(AUDIO_METRICS_PARTIAL_SENDS, 3);
+        audio_metrics_record_us(stress->stage, host_test_rand(&stress->seed) % 40000);
+        audio_metrics_queue_depth(AUDIO_METRICS_QUEUE_PUBLISH, i % 100);
+        if ((i % 1000) == 0)
+            sched_yield();
+    }
+    return NULL;
+}
+
+static void test_audio_metrics_concurrent(void)
+{
+    pthread_t threads[METRICS_STRESS_THREADS];
+    metrics_stress_t stress[METRICS_STRESS_THREADS];
+    audio_metrics_snapshot_t snapshot;
+
+    audio_metrics_reset();
+    for (int t = 0; t < METRICS_STRESS_THREADS; t++)
+    {
+        stress[t] = (metrics_stress_t){ .stage = (audio_metrics_stage_t)t, .seed = 0x1000u + t };
+        TEST_ASSERT_EQUAL(0, pthread_create(&threads[t], NULL, metrics_stress_thread, &stress[t]));
+    }
+    for (int t = 0; t < METRICS_STRESS_THREADS; t++)
+        pthread_join(threads[t], NULL);
+
+    audio_metrics_snapshot(&snapshot);
+    TEST_ASSERT_EQUAL_UINT32(METRICS_STRESS_THREADS * METRICS_STRESS_COUNT, snapshot.counter[AUDIO_METRICS_FRAMES_SENT]);
+    TEST_ASSERT_EQUAL_UINT32(3 * METRICS_STRESS_THREADS * METRICS_STRESS_COUNT,
+                             snapshot.counter[AUDIO_METRICS_PARTIAL_SENDS]);
+    TEST_ASSERT_EQUAL_UINT16(99, snapshot.queue[AUDIO_METRICS_QUEUE_PUBLISH].high_water);
+    for (int t = 0; t < METRICS_STRESS_THREADS; t++)
+    {
+        const audio_metrics_histogram_t *histogram = &snapshot.stage[t];
+        uint32_t buckets = 0;
+        for (int b = 0; b < AUDIO_METRICS_BUCKETS; b++)
+            buckets += histogram->buckets[b];
+        TEST_ASSERT_EQUAL_UINT32(METRICS_STRESS_COUNT, histogram->count);
+        TEST_ASSERT_EQUAL_UINT32(METRICS_STRESS_COUNT, buckets);
+        TEST_ASSERT_LESS_THAN_UINT32(40000, histogram->max_us);
+    }
+}
+
+static double metrics_bench_ns(uint64_t start)
+{
+    return (double)(host_test_now_ns() - start) / METRICS_BENCH_CALLS;
+}
+
+/**
+ * 每次调用的开销. 流水线每个 64ms 块记录 4 个阶段 (8 次 audio_metrics_now),
+ * 约 3 次计数和 1 次队列深度, 按此估算每块的总开销.
+ */
+static void test_audio_metrics_bench(void)
+{
+    uint32_t seed = 0x5a5a;
+    uint64_t start;
+
+    audio_metrics_reset();
+    start = host_test_now_ns();
+    for (int i = 0; i < METRICS_BENCH_CALLS; i++)
+        audio_metrics_count(AUDIO_METRICS_FRAMES_CAPTURED);
+    double count_ns = metrics_bench_ns(start);
+
+    start = host_test_now_ns();
+    for (int i = 0; i < METRICS_BENCH_CALLS; i++)
+        audio_metrics_record_us(AUDIO_METRICS_STAGE_READ, (uint32_t)i & 0x3fff);
+    double record_ns = metrics_bench_ns(start);
+
+    start = host_test_now_ns();
+    for (int i = 0; i < METRICS_BENCH_CALLS; i++)
+        audio_metrics_queue_depth(AUDIO_METRICS_QUEUE_READY, host_test_rand(&seed) & 7);
+    double depth_ns = metrics_bench_ns(start);
+
+    start = host_test_now_ns();
+    for (int i = 0; i < METRICS_BENCH_CALLS; i++)
+    {
+        int64_t begin = audio_metrics_now();
+        audio_metrics_record_us(AUDIO_METRICS_STAGE_CONVERT, (uint32_t)(audio_metrics_now() - begin));
+    }
+    double timed_ns = metrics_bench_ns(start);
+
+    double block_ns = 4 * timed_ns + 3 * count_ns + depth_ns;
+    HOST_BENCH("audio_metrics_count", "%.2f ns/call", count_ns);
+    HOST_BENCH("audio_metrics_record_us", "%.2f ns/call", record_ns);
+    HOST_BENCH("audio_metrics_queue_depth", "%.2f ns/call (incl. rand)", depth_ns);
+    HOST_BENCH("audio_metrics timed stage", "%.2f ns/call (2x now + record)", timed_ns);
+    HOST_BENCH("audio_metrics per 64 ms block", "%.0f ns, %.5f%% of the block", block_ns, block_ns / 640000.0);
+}
+
+void test_audio_metrics_run(void)
+{
+    RUN_TEST(test_audio_metrics_counters);
+    RUN_TEST(test_audio_metrics_histogram);
+    RUN_TEST(test_audio_metrics_concurrent);
+    RUN_TEST(test_audio_metrics_bench);
+}
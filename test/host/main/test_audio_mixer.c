@@ -0,0 +1,381 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "host_test.h"
+#include "audio_mixer.h"
+
+#define MIXER_TEST_RATE         16000
+#define MIXER_TEST_BLOCK        160         // 16kHz 下 10ms
+#define MIXER_TEST_PULL_LEVEL   1000
+#define MIXER_TEST_MIX_BLOCKS   300         // 离线混音 3s
+#define MIXER_TEST_CLIP_SAMPLES 16000
+#define MIXER_BENCH_BLOCKS      20000
+#define MIXER_BENCH_REPEAT      5
+
+static audio_mixer_t mixer;
+static int16_t out16[AUDIO_MIXER_MAX_BLOCK];
+static int32_t out32[AUDIO_MIXER_MAX_BLOCK];
+
+// 流声部: 每次给 pull_available 个 MIXER_TEST_PULL_LEVEL 的直流样本
+static int pull_available;
+
+static int mixer_test_pull(void *ctx, int16_t *out, int samples)
+{
+    for (int i = 0; i < samples; i++)
+        out[i] = MIXER_TEST_PULL_LEVEL;
+    return (pull_available < samples) ? pull_available : samples;
+}
+
+static void mixer_test_done(void *ctx)
+{
+    (*(int *)ctx)++;
+}
+
+static int mixer_test_max_step(const int16_t *samples, int count)
+{
+    int step = 0;
+    for (int i = 1; i < count; i++)
+    {
+        int d = abs(samples[i] - samples[i - 1]);
+        if (d > step)
+            step = d;
+    }
+    return step;
+}
+
+static void test_mixer_idle(void)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, audio_mixer_init(&mixer, MIXER_TEST_RATE));
+    memset(out32, 0x55, sizeof(out32));
+    TEST_ASSERT_EQUAL(0, audio_mixer_render(&mixer, out32, MIXER_TEST_BLOCK));
+    for (int i = 0; i < MIXER_TEST_BLOCK; i++)
+        TEST_ASSERT_EQUAL_INT32(0, out32[i]);
+    TEST_ASSERT_EQUAL(0, audio_mixer_active_count(&mixer));
+}
+
+// 1kHz 满幅提示音: 长度准确, done 调用一次, 淡入淡出之间与理想正弦的误差在 70dB 以下
+static void test_mixer_tone(void)
+{
+    static int16_t tone[MIXER_TEST_RATE / 10];
+    int done = 0;
+    int pos = 0;
+    audio_mixer_voice_config_t config = { .gain = AUDIO_MIXER_GAIN_UNITY, .done = mixer_test_done, .ctx = &done };
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_mixer_init(&mixer, MIXER_TEST_RATE));
+    int voice = audio_mixer_add_tone(&mixer, &config, 1000, 100);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, voice);
+    while (audio_mixer_voice_active(&mixer, voice) && (pos < (int)(sizeof(tone) / sizeof(tone[0]))))
+    {
+        TEST_ASSERT_EQUAL(1, audio_mixer_render16(&mixer, tone + pos, MIXER_TEST_BLOCK));
+        pos += MIXER_TEST_BLOCK;
+    }
+    TEST_ASSERT_FALSE(audio_mixer_voice_active(&mixer, voice));
+    TEST_ASSERT_EQUAL(MIXER_TEST_RATE / 10, pos);
+    TEST_ASSERT_EQUAL(1, done);
+
+    double error = 0, power = 0;
+    for (int i = AUDIO_MIXER_TONE_FADE * 2; i < pos - AUDIO_MIXER_TONE_FADE * 2; i++)
+    {
+        double ideal = INT16_MAX * sin(2 * M_PI * 1000 * i / MIXER_TEST_RATE);
+        error += (tone[i] - ideal) * (tone[i] - ideal);
+        power += ideal * ideal;
+    }
+    double snr = 10 * log10(power / error);
+    TEST_ASSERT_TRUE(snr > 70);
+    // 起止都经过淡入淡出
+    TEST_ASSERT_EQUAL_INT16(0, tone[0]);
+    TEST_ASSERT_LESS_THAN(600, abs(tone[pos - 1]));
+    HOST_BENCH("audio_mixer tone 1 kHz", "SNR vs ideal sine %.1f dB", snr);
+
+    // 超过奈奎斯特频率的提示音被拒绝
+    TEST_ASSERT_LESS_THAN(0, audio_mixer_add_tone(&mixer, &config, MIXER_TEST_RATE / 2, 10));
+    TEST_ASSERT_EQUAL(1, done);
+}
+
+// 片段: 单位增益时 PCM32 取高 16 位, 半增益时减半并在 int32 输出中保留小数位
+static void test_mixer_pcm(void)
+{
+    static int32_t clip32[1000];
+    static int16_t clip16[MIXER_TEST_BLOCK];
+    uint32_t seed = 0x5EEDu;
+    int done = 0;
+    int pos = 0;
+    audio_mixer_voice_config_t config = { .gain = AUDIO_MIXER_GAIN_UNITY, .done = mixer_test_done, .ctx = &done };
+
+    for (int i = 0; i < 1000; i++)
+        clip32[i] = (int32_t)host_test_rand(&seed);
+    for (int i = 0; i < MIXER_TEST_BLOCK; i++)
+        clip16[i] = (int16_t)host_test_rand(&seed);
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_mixer_init(&mixer, MIXER_TEST_RATE));
+    int voice = audio_mixer_add_pcm32(&mixer, &config, clip32, 1000);
+    while (audio_mixer_voice_active(&mixer, voice))
+    {
+        audio_mixer_render16(&mixer, out16, MIXER_TEST_BLOCK);
+        for (int i = 0; i < MIXER_TEST_BLOCK; i++)
+        {
+            int32_t expected = (pos + i < 1000) ? (clip32[pos + i] >> 16) : 0;
+            if (expected < -INT16_MAX)
+                expected = -INT16_MAX;
+            TEST_ASSERT_EQUAL_INT16(expected, out16[i]);
+        }
+        pos += MIXER_TEST_BLOCK;
+    }
+    TEST_ASSERT_EQUAL(1, done);
+
+    config.gain = AUDIO_MIXER_GAIN_UNITY / 2;
+    audio_mixer_add_pcm32(&mixer, &config, clip32, MIXER_TEST_BLOCK);
+    audio_mixer_render(&mixer, out32, MIXER_TEST_BLOCK);
+    for (int i = 0; i < MIXER_TEST_BLOCK; i++)
+    {
+        int32_t expected = ((clip32[i] >> 16) * (AUDIO_MIXER_GAIN_UNITY / 2)) >> (15 - AUDIO_MIXER_FRAC_BITS);
+        TEST_ASSERT_EQUAL_INT32(expected << (16 - AUDIO_MIXER_FRAC_BITS), out32[i]);
+    }
+    TEST_ASSERT_EQUAL(2, done);
+
+    config.gain = AUDIO_MIXER_GAIN_UNITY;
+    audio_mixer_add_pcm16(&mixer, &config, clip16, MIXER_TEST_BLOCK);
+    audio_mixer_render16(&mixer, out16, MIXER_TEST_BLOCK);
+    for (int i = 0; i < MIXER_TEST_BLOCK; i++)
+        TEST_ASSERT_EQUAL_INT16((clip16[i] < -INT16_MAX) ? -INT16_MAX : clip16[i], out16[i]);
+    TEST_ASSERT_EQUAL(3, done);
+    TEST_ASSERT_EQUAL(0, audio_mixer_active_count(&mixer));
+}
+
+// 两个满幅声部叠加: 统一饱和到 ±INT16_MAX 并计数; 四个声部叠加累加器也不溢出
+static void test_mixer_saturation(void)
+{
+    static int16_t full[MIXER_TEST_BLOCK];
+    audio_mixer_voice_config_t config = { .gain = AUDIO_MIXER_GAIN_UNITY };
+
+    for (int i = 0; i < MIXER_TEST_BLOCK; i++)
+        full[i] = (i & 1) ? 30000 : -30000;
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_mixer_init(&mixer, MIXER_TEST_RATE));
+    audio_mixer_add_pcm16(&mixer, &config, full, MIXER_TEST_BLOCK);
+    audio_mixer_add_pcm16(&mixer, &config, full, MIXER_TEST_BLOCK);
+    TEST_ASSERT_EQUAL(2, audio_mixer_render(&mixer, out32, MIXER_TEST_BLOCK));
+    TEST_ASSERT_EQUAL_INT32(-(INT16_MAX << 16), out32[0]);
+    TEST_ASSERT_EQUAL_INT32(INT16_MAX << 16, out32[1]);
+    TEST_ASSERT_EQUAL_UINT32(MIXER_TEST_BLOCK, mixer.clipped);
+
+    for (int k = 0; k < AUDIO_MIXER_MAX_VOICES; k++)
+        TEST_ASSERT_GREATER_OR_EQUAL(0, audio_mixer_add_pcm16(&mixer, &config, full, MIXER_TEST_BLOCK));
+    TEST_ASSERT_LESS_THAN(0, audio_mixer_add_pcm16(&mixer, &config, full, MIXER_TEST_BLOCK));
+    TEST_ASSERT_EQUAL(AUDIO_MIXER_MAX_VOICES, audio_mixer_render16(&mixer, out16, MIXER_TEST_BLOCK));
+    TEST_ASSERT_EQUAL_INT16(-INT16_MAX, out16[0]);
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, out16[1]);
+    TEST_ASSERT_EQUAL_UINT32(MIXER_TEST_BLOCK * 2, mixer.clipped);
+}
+
+// 流声部: stop 在一块内单调淡出, 旧句柄失效, 槽位复用换代; 增益变化在一块内线性过渡
+static void test_mixer_stream(void)
+{
+    int done = 0;
+    audio_mixer_voice_config_t config = {
+        .gain = AUDIO_MIXER_GAIN_UNITY, .pull = mixer_test_pull, .done = mixer_test_done, .ctx = &done
+    };
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_mixer_init(&mixer, MIXER_TEST_RATE));
+    TEST_ASSERT_LESS_THAN(0, audio_mixer_add_pull(&mixer, &(audio_mixer_voice_config_t){ .gain = AUDIO_MIXER_GAIN_UNITY }));
+    pull_available = MIXER_TEST_BLOCK;
+    int voice = audio_mixer_add_pull(&mixer, &config);
+    audio_mixer_render16(&mixer, out16, MIXER_TEST_BLOCK);
+    TEST_ASSERT_EQUAL_INT16(MIXER_TEST_PULL_LEVEL, out16[0]);
+    TEST_ASSERT_EQUAL_INT16(MIXER_TEST_PULL_LEVEL, out16[MIXER_TEST_BLOCK - 1]);
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_mixer_stop(&mixer, voice));
+    TEST_ASSERT_EQUAL(0, done);
+    audio_mixer_render16(&mixer, out16, MIXER_TEST_BLOCK);
+    for (int i = 1; i < MIXER_TEST_BLOCK; i++)
+        TEST_ASSERT_LESS_OR_EQUAL(out16[i - 1], out16[i]);
+    TEST_ASSERT_GREATER_THAN(MIXER_TEST_PULL_LEVEL - 10, out16[0]);
+    TEST_ASSERT_LESS_OR_EQUAL(8, out16[MIXER_TEST_BLOCK - 1]);
+    TEST_ASSERT_EQUAL(1, done);
+    TEST_ASSERT_FALSE(audio_mixer_voice_active(&mixer, voice));
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, audio_mixer_stop(&mixer, voice));
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, audio_mixer_set_gain(&mixer, voice, AUDIO_MIXER_GAIN_UNITY));
+
+    int reused = audio_mixer_add_pull(&mixer, &config);
+    TEST_ASSERT_NOT_EQUAL(voice, reused);
+    TEST_ASSERT_EQUAL(voice % AUDIO_MIXER_MAX_VOICES, reused % AUDIO_MIXER_MAX_VOICES);
+    TEST_ASSERT_FALSE(audio_mixer_voice_active(&mixer, voice));
+
+    // 来源不足时剩余部分补静音, 声部不结束
+    pull_available = 100;
+    audio_mixer_render16(&mixer, out16, MIXER_TEST_BLOCK);
+    TEST_ASSERT_EQUAL_INT16(MIXER_TEST_PULL_LEVEL, out16[99]);
+    TEST_ASSERT_EQUAL_INT16(0, out16[100]);
+    TEST_ASSERT_TRUE(audio_mixer_voice_active(&mixer, reused));
+
+    pull_available = MIXER_TEST_BLOCK;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_mixer_set_gain(&mixer, reused, AUDIO_MIXER_GAIN_UNITY / 4));
+    audio_mixer_render16(&mixer, out16, MIXER_TEST_BLOCK);
+    TEST_ASSERT_LESS_OR_EQUAL(6, mixer_test_max_step(out16, MIXER_TEST_BLOCK));
+    TEST_ASSERT_INT_WITHIN(2, MIXER_TEST_PULL_LEVEL / 4, out16[MIXER_TEST_BLOCK - 1]);
+    audio_mixer_render16(&mixer, out16, MIXER_TEST_BLOCK);
+    TEST_ASSERT_EQUAL_INT16(MIXER_TEST_PULL_LEVEL / 4, out16[0]);
+    TEST_ASSERT_EQUAL_INT16(MIXER_TEST_PULL_LEVEL / 4, out16[MIXER_TEST_BLOCK - 1]);
+
+    // 有活动声部时不能改采样率
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, audio_mixer_set_rate(&mixer, 8000));
+    audio_mixer_stop(&mixer, reused);
+    audio_mixer_render16(&mixer, out16, MIXER_TEST_BLOCK);
+    TEST_ASSERT_EQUAL(2, done);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_mixer_set_rate(&mixer, 8000));
+}
+
+/**
+ * 离线混音: 下行流 + 一段 220Hz 的调幅片段 + 周期性的提示音, 中途停流, 共 3s.
+ * 相邻样本的最大差不超过各声部自身斜率之和 (1kHz 提示音 0.25 增益约 3216, 片段约 1037),
+ * 即声部的加入, 结束和停止都没有额外的跳变.
+ */
+static void test_mixer_offline_mix(void)
+{
+    static int16_t mix[MIXER_TEST_MIX_BLOCKS * MIXER_TEST_BLOCK];
+    static int32_t speech[MIXER_TEST_CLIP_SAMPLES];
+    int done = 0;
+    audio_mixer_voice_config_t clip_config = { .gain = AUDIO_MIXER_GAIN_UNITY, .done = mixer_test_done, .ctx = &done };
+    audio_mixer_voice_config_t tone_config = { .gain = AUDIO_MIXER_GAIN_UNITY / 4, .done = mixer_test_done, .ctx = &done };
+    audio_mixer_voice_config_t stream_config = {
+        .gain = AUDIO_MIXER_GAIN_UNITY / 2, .pull = mixer_test_pull, .done = mixer_test_done, .ctx = &done
+    };
+
+    for (int i = 0; i < MIXER_TEST_CLIP_SAMPLES; i++)
+    {
+        double envelope = 0.5 + 0.5 * sin(2 * M_PI * 3 * i / MIXER_TEST_RATE);
+        speech[i] = (int32_t)(12000 * sin(2 * M_PI * 220 * i / MIXER_TEST_RATE) * envelope) << 16;
+    }
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_mixer_init(&mixer, MIXER_TEST_RATE));
+    pull_available = MIXER_TEST_BLOCK;
+    int stream = audio_mixer_add_pull(&mixer, &stream_config);
+    int tones = 0;
+    for (int b = 0; b < MIXER_TEST_MIX_BLOCKS; b++)
+    {
+        if (b == 20)
+            TEST_ASSERT_GREATER_OR_EQUAL(0, audio_mixer_add_pcm32(&mixer, &clip_config, speech, MIXER_TEST_CLIP_SAMPLES));
+        if ((b % 50) == 10)
+        {
+            TEST_ASSERT_GREATER_OR_EQUAL(0, audio_mixer_add_tone(&mixer, &tone_config, 1000, 80));
+            tones++;
+        }
+        if (b == 250)
+            TEST_ASSERT_EQUAL(ESP_OK, audio_mixer_stop(&mixer, stream));
+        audio_mixer_render16(&mixer, mix + b * MIXER_TEST_BLOCK, MIXER_TEST_BLOCK);
+    }
+
+    int step = mixer_test_max_step(mix, MIXER_TEST_MIX_BLOCKS * MIXER_TEST_BLOCK);
+    TEST_ASSERT_LESS_OR_EQUAL(3216 + 1037 + 8, step);
+    TEST_ASSERT_EQUAL_UINT32(0, mixer.clipped);
+    // 所有提示音, 片段和流都已结束
+    TEST_ASSERT_EQUAL(tones + 2, done);
+    TEST_ASSERT_EQUAL(0, audio_mixer_active_count(&mixer));
+    HOST_BENCH("audio_mixer offline mix 3 s", "%d voices added, max sample step %d, clipped %lu",
+               tones + 2, step, (unsigned long)mixer.clipped);
+}
+
+static void test_mixer_invalid(void)
+{
+    audio_mixer_voice_config_t config = { .gain = AUDIO_MIXER_GAIN_UNITY };
+
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_mixer_init(NULL, MIXER_TEST_RATE));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_mixer_init(&mixer, MIXER_TEST_RATE));
+    TEST_ASSERT_LESS_THAN(0, audio_mixer_add_pcm16(&mixer, &config, NULL, MIXER_TEST_BLOCK));
+    TEST_ASSERT_LESS_THAN(0, audio_mixer_add_pcm16(&mixer, NULL, out16, MIXER_TEST_BLOCK));
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, audio_mixer_stop(&mixer, 0));
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, audio_mixer_stop(&mixer, -1));
+    TEST_ASSERT_FALSE(audio_mixer_voice_active(&mixer, -1));
+    TEST_ASSERT_EQUAL(0, audio_mixer_active_count(&mixer));
+}
+
+/**
+ * 每个声部的开销: 0 到 4 个同类声部, 10ms 一块, 16kHz 和 48kHz. 每种取多次中最快的一次,
+ * 按 (4 声部 - 0 声部) / 4 / 每块样本数 折算成每声部每样本的 ns. ramp 每块都改一次增益.
+ */
+static void test_mixer_bench(void)
+{
+    static int16_t pcm16[MIXER_TEST_CLIP_SAMPLES * 10];
+    static int32_t pcm32[MIXER_TEST_CLIP_SAMPLES * 10];
+    static const char *kinds[] = { "tone", "pcm16", "pcm32", "pull", "pull ramp" };
+    static const uint32_t rates[] = { 16000, 48000 };
+    const int clip_samples = MIXER_TEST_CLIP_SAMPLES * 10;
+    uint32_t seed = 0xB0A710u;
+    char name[48];
+
+    for (int i = 0; i < clip_samples; i++)
+    {
+        pcm16[i] = (int16_t)host_test_rand(&seed);
+        pcm32[i] = (int32_t)host_test_rand(&seed);
+    }
+
+    for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+    {
+        int block = (int)(rates[r] / 100);
+        for (int kind = 0; kind < (int)(sizeof(kinds) / sizeof(kinds[0])); kind++)
+        {
+            double ns[AUDIO_MIXER_MAX_VOICES + 1];
+            for (int count = 0; count <= AUDIO_MIXER_MAX_VOICES; count++)
+            {
+                ns[count] = 1e18;
+                for (int repeat = 0; repeat < MIXER_BENCH_REPEAT; repeat++)
+                {
+                    audio_mixer_voice_config_t config = { .gain = AUDIO_MIXER_GAIN_UNITY / 3, .pull = mixer_test_pull };
+                    int voices[AUDIO_MIXER_MAX_VOICES];
+                    TEST_ASSERT_EQUAL(ESP_OK, audio_mixer_init(&mixer, rates[r]));
+                    for (int k = 0; k < count; k++)
+                    {
+                        if (kind == 0)
+                            voices[k] = audio_mixer_add_tone(&mixer, &config, 440 + k * 100, UINT32_MAX / 1000);
+                        else if (kind == 1)
+                            voices[k] = audio_mixer_add_pcm16(&mixer, &config, pcm16, clip_samples);
+                        else if (kind == 2)
+                            voices[k] = audio_mixer_add_pcm32(&mixer, &config, pcm32, clip_samples);
+                        else
+                            voices[k] = audio_mixer_add_pull(&mixer, &config);
+                        TEST_ASSERT_GREATER_OR_EQUAL(0, voices[k]);
+                    }
+                    pull_available = block;
+
+                    uint64_t start = host_test_now_ns();
+                    for (int b = 0; b < MIXER_BENCH_BLOCKS; b++)
+                    {
+                        if (kind == 4)
+                        {
+                            for (int k = 0; k < count; k++)
+                                audio_mixer_set_gain(&mixer, voices[k], (b & 1) ? AUDIO_MIXER_GAIN_UNITY / 3 : AUDIO_MIXER_GAIN_UNITY / 2);
+                        }
+                        // 片段快播完时倒回开头, 保持声部数不变
+                        if (((kind == 1) || (kind == 2)) && (((b + 1) * block) % (clip_samples - block) < block))
+                        {
+                            for (int k = 0; k < count; k++)
+                                mixer.voices[voices[k] % AUDIO_MIXER_MAX_VOICES].position = 0;
+                        }
+                        audio_mixer_render(&mixer, out32, block);
+                    }
+                    double t = (double)(host_test_now_ns() - start) / MIXER_BENCH_BLOCKS;
+                    TEST_ASSERT_EQUAL(count, audio_mixer_active_count(&mixer));
+                    if (t < ns[count])
+                        ns[count] = t;
+                }
+            }
+            double per_voice = (ns[AUDIO_MIXER_MAX_VOICES] - ns[0]) / AUDIO_MIXER_MAX_VOICES;
+            snprintf(name, sizeof(name), "audio_mixer %s %lu Hz", kinds[kind], (unsigned long)rates[r]);
+            HOST_BENCH(name, "0/1/2/3/4 voices %.0f/%.0f/%.0f/%.0f/%.0f ns/block, %.2f ns/sample/voice",
+                       ns[0], ns[1], ns[2], ns[3], ns[4], per_voice / block);
+        }
+    }
+}
+
+void test_audio_mixer_run(void)
+{
+    RUN_TEST(test_mixer_idle);
+    RUN_TEST(test_mixer_tone);
+    RUN_TEST(test_mixer_pcm);
+    RUN_TEST(test_mixer_saturation);
+    RUN_TEST(test_mixer_stream);
+    RUN_TEST(test_mixer_offline_mix);
+    RUN_TEST(test_mixer_invalid);
+    RUN_TEST(test_mixer_bench);
+}
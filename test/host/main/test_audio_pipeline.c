@@ -0,0 +1,295 @@
+#include <string.h>
+#include "unity.h"
+#include "host_test.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "audio_pool.h"
+#include "audio_pipeline.h"
+
+#define PIPELINE_TEST_FRAMES        500
+#define PIPELINE_BENCH_FRAMES       20000
+#define PIPELINE_TEST_SAMPLES       (AUDIO_POOL_FRAME_SIZE / sizeof(int32_t))
+#define PIPELINE_TEST_TIMEOUT_MS    60000
+#define PIPELINE_TEST_BLOCK_US      64000       // 16kHz 下一帧 1024 个样本的实时长度
+
+/**
+ * 合成的源 -> 变换 -> 汇: 源按序号填充帧, 变换给每个样本加 1, 汇检查序号连续和内容.
+ * 只测框架本身 (队列转发, 结束标记, 收尾, 统计), 元素里没有 I2S 和网络.
+ */
+typedef struct {
+    uint32_t frames;                    // 源: 产出这么多帧后请求停止
+    uint32_t produced;
+    uint32_t next_sequence;             // 汇: 期望的下一个序号
+    uint32_t bad_frames;
+    uint32_t opens;
+    uint32_t closes;
+    bool fail_open;
+} pipeline_test_ctx_t;
+
+static pipeline_test_ctx_t pipeline_ctx[3];
+
+static esp_err_t pipeline_test_open(audio_element_t *element)
+{
+    pipeline_test_ctx_t *ctx = (pipeline_test_ctx_t *)element->ctx;
+
+    ctx->opens++;
+    if (!ctx->fail_open)
+        return ESP_OK;
+    // 晚一点失败, 让上游先送出一些帧
+    vTaskDelay(pdMS_TO_TICKS(20));
+    return ESP_FAIL;
+}
+
+static void pipeline_test_close(audio_element_t *element)
+{
+    ((pipeline_test_ctx_t *)element->ctx)->closes++;
+}
+
+static esp_err_t pipeline_test_source(audio_element_t *element, audio_block_t **frame)
+{
+    pipeline_test_ctx_t *ctx = (pipeline_test_ctx_t *)element->ctx;
+
+    if (ctx->produced == ctx->frames)
+    {
+        audio_pipeline_stop(element->pipeline);
+        return ESP_OK;
+    }
+    audio_block_t *block = audio_pool_acquire(AUDIO_POOL_FRAME, 1000);
+    if (block == NULL)
+        return ESP_ERR_TIMEOUT;
+
+    int32_t *samples = (int32_t *)block->data;
+    block->sequence = ctx->produced++;
+    block->len = AUDIO_POOL_FRAME_SIZE;
+    for (size_t i = 0; i < PIPELINE_TEST_SAMPLES; i++)
+        samples[i] = (int32_t)(block->sequence + i);
+    *frame = block;
+    return ESP_OK;
+}
+
+static esp_err_t pipeline_test_transform(audio_element_t *element, audio_block_t **frame)
+{
+    int32_t *samples = (int32_t *)(*frame)->data;
+
+    for (size_t i = 0; i < PIPELINE_TEST_SAMPLES; i++)
+        samples[i] += 1;
+    return ESP_OK;
+}
+
+static esp_err_t pipeline_test_sink(audio_element_t *element, audio_block_t **frame)
+{
+    pipeline_test_ctx_t *ctx = (pipeline_test_ctx_t *)element->ctx;
+    const int32_t *samples = (const int32_t *)(*frame)->data;
+    uint32_t sequence = (*frame)->sequence;
+    // 两元素流水线没有变换
+    int32_t offset = (element->pipeline->count == 3) ? 1 : 0;
+
+    if ((sequence != ctx->next_sequence) || (samples[0] != (int32_t)sequence + offset) ||
+        (samples[PIPELINE_TEST_SAMPLES - 1] != (int32_t)(sequence + PIPELINE_TEST_SAMPLES - 1) + offset))
+        ctx->bad_frames++;
+    ctx->next_sequence = sequence + 1;
+    return ESP_OK;
+}
+
+static audio_element_t pipeline_source = {
+    .name = "TestSource",
+    .kind = AUDIO_ELEMENT_SOURCE,
+    .open = pipeline_test_open,
+    .process = pipeline_test_source,
+    .close = pipeline_test_close,
+    .ctx = &pipeline_ctx[0],
+    .core = AUDIO_PIPELINE_CORE_ANY,
+    .priority = 5,
+    .stack_size = 4096,
+    .metrics_queue = -1,
+};
+
+static audio_element_t pipeline_transform = {
+    .name = "TestTransform",
+    .kind = AUDIO_ELEMENT_TRANSFORM,
+    .open = pipeline_test_open,
+    .process = pipeline_test_transform,
+    .close = pipeline_test_close,
+    .ctx = &pipeline_ctx[1],
+    .core = AUDIO_PIPELINE_CORE_ANY,
+    .priority = 5,
+    .stack_size = 4096,
+    .queue_len = AUDIO_POOL_FRAME_COUNT + 1,
+    .metrics_queue = -1,
+};
+
+static audio_element_t pipeline_sink = {
+    .name = "TestSink",
+    .kind = AUDIO_ELEMENT_SINK,
+    .open = pipeline_test_open,
+    .process = pipeline_test_sink,
+    .close = pipeline_test_close,
+    .ctx = &pipeline_ctx[2],
+    .core = AUDIO_PIPELINE_CORE_ANY,
+    .priority = 5,
+    .stack_size = 4096,
+    .queue_len = AUDIO_POOL_FRAME_COUNT + 1,
+    .metrics_queue = -1,
+};
+
+static audio_pipeline_t pipeline_test;
+
+static void pipeline_test_reset(uint32_t frames)
+{
+    memset(pipeline_ctx, 0, sizeof(pipeline_ctx));
+    pipeline_ctx[0].frames = frames;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pool_init());
+}
+
+static bool pipeline_test_wait(void)
+{
+    for (int ms = 0; ms < PIPELINE_TEST_TIMEOUT_MS; ms++)
+    {
+        if (!audio_pipeline_is_active(&pipeline_test))
+            return true;
+        vTaskDelay(pdMS_TO_TICKS(1));
+    }
+    return false;
+}
+
+// 每个元素恰好 open/close 一次, 块全部还回池
+static void pipeline_test_check_closed(int count)
+{
+    audio_pool_stats_t pool;
+
+    for (int i = 0; i < count; i++)
+    {
+        int slot = (i == count - 1) ? 2 : i;
+        TEST_ASSERT_EQUAL_UINT32(1, pipeline_ctx[slot].opens);
+        TEST_ASSERT_EQUAL_UINT32(1, pipeline_ctx[slot].closes);
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pool_get_stats(AUDIO_POOL_FRAME, &pool));
+    TEST_ASSERT_EQUAL_UINT32(0, pool.in_use);
+}
+
+static void test_audio_pipeline_order(void)
+{
+    audio_element_t *elements[] = { &pipeline_source, &pipeline_transform, &pipeline_sink };
+    bool started = false;
+
+    pipeline_test_reset(PIPELINE_TEST_FRAMES);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pipeline_run(&pipeline_test, "Test", elements, 3, &started));
+    TEST_ASSERT_TRUE(started);
+    TEST_ASSERT_TRUE(pipeline_test_wait());
+
+    TEST_ASSERT_EQUAL_UINT32(PIPELINE_TEST_FRAMES, pipeline_ctx[2].next_sequence);
+    TEST_ASSERT_EQUAL_UINT32(0, pipeline_ctx[2].bad_frames);
+    TEST_ASSERT_EQUAL_UINT32(PIPELINE_TEST_FRAMES, pipeline_transform.stats.frames);
+    TEST_ASSERT_EQUAL_UINT32(PIPELINE_TEST_FRAMES, pipeline_sink.stats.frames);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(AUDIO_POOL_FRAME_COUNT, pipeline_sink.stats.queue_high_water);
+    pipeline_test_check_closed(3);
+
+    // 同一组元素可以再跑一次 (队列复用), 也可以去掉变换
+    audio_element_t *direct[] = { &pipeline_source, &pipeline_sink };
+    pipeline_test_reset(PIPELINE_TEST_FRAMES);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pipeline_run(&pipeline_test, "Test", direct, 2, &started));
+    TEST_ASSERT_TRUE(pipeline_test_wait());
+    TEST_ASSERT_EQUAL_UINT32(PIPELINE_TEST_FRAMES, pipeline_ctx[2].next_sequence);
+    TEST_ASSERT_EQUAL_UINT32(0, pipeline_ctx[2].bad_frames);
+    pipeline_test_check_closed(2);
+}
+
+/**
+ * started 告诉调用者由谁收尾: 没启动任何任务时为 false; 一旦汇启动, 即使随后出错, 也由
+ * 流水线自己结束并调用 close(), 与流水线何时变为不活动无关.
+ */
+static void test_audio_pipeline_started(void)
+{
+    audio_element_t *elements[] = { &pipeline_source, &pipeline_transform, &pipeline_sink };
+    audio_element_t *reversed[] = { &pipeline_sink, &pipeline_source };
+    bool started = true;
+
+    pipeline_test_reset(PIPELINE_TEST_FRAMES);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_pipeline_run(&pipeline_test, "Test", reversed, 2, &started));
+    TEST_ASSERT_FALSE(started);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_pipeline_run(&pipeline_test, "Test", elements, 1, &started));
+    TEST_ASSERT_FALSE(started);
+
+    // 运行中再启动
+    pipeline_ctx[0].frames = UINT32_MAX;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pipeline_run(&pipeline_test, "Test", elements, 3, NULL));
+    started = true;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, audio_pipeline_run(&pipeline_test, "Test", elements, 3, &started));
+    TEST_ASSERT_FALSE(started);
+    audio_pipeline_stop(&pipeline_test);
+    TEST_ASSERT_TRUE(pipeline_test_wait());
+    pipeline_test_check_closed(3);
+
+    // 源 open 失败: 整条流水线自行停止, 每个元素仍然 close 一次
+    pipeline_test_reset(PIPELINE_TEST_FRAMES);
+    pipeline_ctx[0].fail_open = true;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pipeline_run(&pipeline_test, "Test", elements, 3, &started));
+    TEST_ASSERT_TRUE(started);
+    TEST_ASSERT_TRUE(pipeline_test_wait());
+    TEST_ASSERT_EQUAL_UINT32(0, pipeline_ctx[2].next_sequence);
+    pipeline_test_check_closed(3);
+}
+
+/**
+ * 下游元素 open 失败: 上游已经送出的帧只被还回池, 失败的元素及其下游都不调用 process(),
+ * 收到结束标记后照常 close().
+ */
+static void test_audio_pipeline_open_failed(void)
+{
+    audio_element_t *elements[] = { &pipeline_source, &pipeline_transform, &pipeline_sink };
+
+    pipeline_test_reset(UINT32_MAX);
+    pipeline_ctx[1].fail_open = true;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pipeline_run(&pipeline_test, "Test", elements, 3, NULL));
+    TEST_ASSERT_TRUE(pipeline_test_wait());
+    TEST_ASSERT_GREATER_THAN_UINT32(0, pipeline_ctx[0].produced);
+    TEST_ASSERT_EQUAL_UINT32(0, pipeline_transform.stats.frames);
+    TEST_ASSERT_EQUAL_UINT32(0, pipeline_sink.stats.frames);
+    pipeline_test_check_closed(3);
+
+    // 汇 open 失败
+    pipeline_test_reset(UINT32_MAX);
+    pipeline_ctx[2].fail_open = true;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pipeline_run(&pipeline_test, "Test", elements, 3, NULL));
+    TEST_ASSERT_TRUE(pipeline_test_wait());
+    TEST_ASSERT_GREATER_THAN_UINT32(0, pipeline_ctx[0].produced);
+    TEST_ASSERT_EQUAL_UINT32(pipeline_ctx[0].produced, pipeline_transform.stats.frames);
+    TEST_ASSERT_EQUAL_UINT32(0, pipeline_sink.stats.frames);
+    pipeline_test_check_closed(3);
+}
+
+/**
+ * 框架本身的吞吐: 源不限速, 每帧 4KB, 变换和汇只做一遍样本访问. 每帧的开销是
+ * 块池取/还加每一级的队列收发和任务切换, 与 64ms 的实时帧长相比.
+ */
+static void test_audio_pipeline_bench(void)
+{
+    audio_element_t *elements[] = { &pipeline_source, &pipeline_transform, &pipeline_sink };
+    audio_element_t *direct[] = { &pipeline_source, &pipeline_sink };
+    audio_element_t **chains[] = { direct, elements };
+    const char *names[] = { "audio_pipeline 2 elements", "audio_pipeline 3 elements" };
+
+    for (int c = 0; c < 2; c++)
+    {
+        int count = c + 2;
+
+        pipeline_test_reset(PIPELINE_BENCH_FRAMES);
+        uint64_t start = host_test_now_ns();
+        TEST_ASSERT_EQUAL(ESP_OK, audio_pipeline_run(&pipeline_test, "Bench", chains[c], count, NULL));
+        TEST_ASSERT_TRUE(pipeline_test_wait());
+        double ns = (double)(host_test_now_ns() - start) / PIPELINE_BENCH_FRAMES;
+
+        TEST_ASSERT_EQUAL_UINT32(PIPELINE_BENCH_FRAMES, pipeline_ctx[2].next_sequence);
+        TEST_ASSERT_EQUAL_UINT32(0, pipeline_ctx[2].bad_frames);
+        HOST_BENCH(names[c], "%.0f frames/s, %.1f us/frame, %.0fx real time (sink queue max %lu)", 1e9 / ns,
+                   ns / 1000.0, PIPELINE_TEST_BLOCK_US * 1000.0 / ns, (unsigned long)pipeline_sink.stats.queue_high_water);
+    }
+}
+
+void test_audio_pipeline_run(void)
+{
+    RUN_TEST(test_audio_pipeline_order);
+    RUN_TEST(test_audio_pipeline_started);
+    RUN_TEST(test_audio_pipeline_open_failed);
+    RUN_TEST(test_audio_pipeline_bench);
+}
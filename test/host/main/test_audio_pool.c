@@ -0,0 +1,326 @@
+#include <string.h>
+#include <malloc.h>
+#include <stdatomic.h>
+#include "unity.h"
+#include "host_test.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "audio_pool.h"
+
+#define POOL_TEST_CYCLES            200000      // 碎片测试中的随机操作数
+#define POOL_TEST_BENCH_OPS         200000
+#define POOL_TEST_RETAINS           500000      // 每个任务对同一块的 retain/release 次数
+#define POOL_TEST_HANDOFFS          50000
+#define POOL_TEST_TIMEOUT_MS        50
+#define POOL_TEST_WAIT_MS           60000
+
+static audio_block_t *pool_test_held[AUDIO_POOL_FRAME_COUNT];
+static uint64_t pool_test_latency[POOL_TEST_BENCH_OPS];
+static atomic_int pool_test_running;
+
+static audio_pool_stats_t pool_test_stats(void)
+{
+    audio_pool_stats_t stats;
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pool_get_stats(AUDIO_POOL_FRAME, &stats));
+    return stats;
+}
+
+// 取空空闲队列数出空闲块个数, 再全部归还; 返回块的数据指针用于比较
+static uint32_t pool_test_count_free(uint8_t **data)
+{
+    uint32_t count = 0;
+    audio_block_t *block;
+
+    while ((count < AUDIO_POOL_FRAME_COUNT) && ((block = audio_pool_acquire(AUDIO_POOL_FRAME, 0)) != NULL))
+    {
+        TEST_ASSERT_EQUAL_INT(1, atomic_load(&block->refs));
+        if (data != NULL)
+            data[block->index] = block->data;
+        pool_test_held[count++] = block;
+    }
+    for (uint32_t i = 0; i < count; i++)
+        audio_pool_release(pool_test_held[i]);
+    return count;
+}
+
+static void pool_test_wait_tasks(void)
+{
+    for (int ms = 0; (ms < POOL_TEST_WAIT_MS) && (atomic_load(&pool_test_running) > 0); ms++)
+        vTaskDelay(pdMS_TO_TICKS(1));
+    TEST_ASSERT_EQUAL_INT(0, atomic_load(&pool_test_running));
+}
+
+static void test_pool_invalid_args(void)
+{
+    audio_pool_stats_t stats;
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pool_init());
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pool_init());   // 重复初始化不重新分配
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_pool_get_stats(AUDIO_POOL_FRAME, NULL));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_pool_get_stats(AUDIO_POOL_CLASS_MAX, &stats));
+    TEST_ASSERT_EQUAL_UINT32(AUDIO_POOL_FRAME_SIZE, audio_pool_block_size(AUDIO_POOL_FRAME));
+    TEST_ASSERT_EQUAL_UINT32(AUDIO_POOL_CLIP_SIZE, audio_pool_block_size(AUDIO_POOL_CLIP));
+
+    // release(NULL) 什么都不做
+    audio_pool_stats_t before = pool_test_stats();
+    audio_pool_release(NULL);
+    audio_pool_stats_t after = pool_test_stats();
+    TEST_ASSERT_EQUAL_UINT32(before.in_use, after.in_use);
+    TEST_ASSERT_EQUAL_UINT32(AUDIO_POOL_FRAME_COUNT, pool_test_count_free(NULL));
+}
+
+// 一块分发给多个持有者: 只有最后一次 release 才把它放回空闲队列
+static void test_pool_refcount_fanout(void)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pool_init());
+    audio_pool_stats_t before = pool_test_stats();
+    TEST_ASSERT_EQUAL_UINT32(0, before.in_use);
+
+    audio_block_t *block = audio_pool_acquire(AUDIO_POOL_FRAME, 0);
+    TEST_ASSERT_NOT_NULL(block);
+    TEST_ASSERT_EQUAL_UINT32(0, block->len);
+    for (int i = 0; i < 3; i++)
+        audio_pool_retain(block);
+    TEST_ASSERT_EQUAL_INT(4, atomic_load(&block->refs));
+
+    for (int i = 0; i < 3; i++)
+    {
+        audio_pool_release(block);
+        TEST_ASSERT_EQUAL_UINT32(1, pool_test_stats().in_use);
+        TEST_ASSERT_EQUAL_UINT32(AUDIO_POOL_FRAME_COUNT - 1, pool_test_count_free(NULL));
+    }
+    audio_pool_release(block);
+    TEST_ASSERT_EQUAL_INT(0, atomic_load(&block->refs));
+    TEST_ASSERT_EQUAL_UINT32(0, pool_test_stats().in_use);
+    TEST_ASSERT_EQUAL_UINT32(AUDIO_POOL_FRAME_COUNT, pool_test_count_free(NULL));
+}
+
+static void pool_test_release_later(void *arg)
+{
+    vTaskDelay(pdMS_TO_TICKS(POOL_TEST_TIMEOUT_MS / 2));
+    audio_pool_release((audio_block_t *)arg);
+    atomic_fetch_sub(&pool_test_running, 1);
+    vTaskDelete(NULL);
+}
+
+// 取完所有块: 不等待和限时等待都返回 NULL 并计数; 等待期间有块归还时取到它
+static void test_pool_exhaustion(void)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pool_init());
+    audio_pool_stats_t before = pool_test_stats();
+
+    for (int i = 0; i < AUDIO_POOL_FRAME_COUNT; i++)
+    {
+        pool_test_held[i] = audio_pool_acquire(AUDIO_POOL_FRAME, 0);
+        TEST_ASSERT_NOT_NULL(pool_test_held[i]);
+    }
+    audio_pool_stats_t full = pool_test_stats();
+    TEST_ASSERT_EQUAL_UINT32(AUDIO_POOL_FRAME_COUNT, full.in_use);
+    TEST_ASSERT_EQUAL_UINT32(AUDIO_POOL_FRAME_COUNT, full.high_water);
+    TEST_ASSERT_EQUAL_UINT32(before.acquire_failures, full.acquire_failures);
+
+    TEST_ASSERT_NULL(audio_pool_acquire(AUDIO_POOL_FRAME, 0));
+    uint64_t start = host_test_now_ns();
+    TEST_ASSERT_NULL(audio_pool_acquire(AUDIO_POOL_FRAME, POOL_TEST_TIMEOUT_MS));
+    uint64_t waited_ms = (host_test_now_ns() - start) / 1000000;
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(POOL_TEST_TIMEOUT_MS - 1, (uint32_t)waited_ms);
+    TEST_ASSERT_EQUAL_UINT32(before.acquire_failures + 2, pool_test_stats().acquire_failures);
+
+    // 另一个任务在超时前归还一块
+    audio_block_t *last = pool_test_held[AUDIO_POOL_FRAME_COUNT - 1];
+    atomic_store(&pool_test_running, 1);
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(pool_test_release_later, "pool_release", 4096, last, 5, NULL));
+    audio_block_t *block = audio_pool_acquire(AUDIO_POOL_FRAME, POOL_TEST_TIMEOUT_MS * 10);
+    pool_test_wait_tasks();
+    TEST_ASSERT_EQUAL_PTR(last, block);
+    TEST_ASSERT_EQUAL_UINT32(before.acquire_failures + 2, pool_test_stats().acquire_failures);
+    TEST_ASSERT_EQUAL_UINT32(AUDIO_POOL_FRAME_COUNT, pool_test_stats().high_water);
+
+    for (int i = 0; i < AUDIO_POOL_FRAME_COUNT; i++)
+        audio_pool_release(pool_test_held[i]);
+    TEST_ASSERT_EQUAL_UINT32(0, pool_test_stats().in_use);
+    TEST_ASSERT_EQUAL_UINT32(AUDIO_POOL_FRAME_COUNT, pool_test_count_free(NULL));
+}
+
+/**
+ * 随机取还 (包括多引用的块) 很多次之后: 空闲块个数, 每块的数据区和堆的占用都与开始时相同.
+ * 池子在初始化时一次性分配, 运行期间不应再碰堆.
+ */
+static void test_pool_no_fragmentation(void)
+{
+    static uint8_t *data_before[AUDIO_POOL_FRAME_COUNT];
+    static uint8_t *data_after[AUDIO_POOL_FRAME_COUNT];
+    static int extra_refs[AUDIO_POOL_FRAME_COUNT];
+    uint32_t seed = 0x5eed1234;
+    int held = 0;
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pool_init());
+    TEST_ASSERT_EQUAL_UINT32(AUDIO_POOL_FRAME_COUNT, pool_test_count_free(data_before));
+    audio_pool_stats_t before = pool_test_stats();
+    struct mallinfo2 heap_before = mallinfo2();
+
+    for (int n = 0; n < POOL_TEST_CYCLES; n++)
+    {
+        uint32_t r = host_test_rand(&seed);
+        if ((held < AUDIO_POOL_FRAME_COUNT) && ((held == 0) || (r & 1)))
+        {
+            audio_block_t *block = audio_pool_acquire(AUDIO_POOL_FRAME, 0);
+            TEST_ASSERT_NOT_NULL(block);
+            extra_refs[held] = (int)((r >> 1) % 3);
+            for (int i = 0; i < extra_refs[held]; i++)
+                audio_pool_retain(block);
+            memset(block->data, (int)(r >> 8), 16);
+            pool_test_held[held++] = block;
+        }
+        else
+        {
+            // 随机挑一个持有的块, 释放它的全部引用
+            int k = (int)((r >> 1) % (uint32_t)held);
+            for (int i = 0; i <= extra_refs[k]; i++)
+                audio_pool_release(pool_test_held[k]);
+            held--;
+            pool_test_held[k] = pool_test_held[held];
+            extra_refs[k] = extra_refs[held];
+        }
+        TEST_ASSERT_EQUAL_UINT32((uint32_t)held, pool_test_stats().in_use);
+    }
+    while (held > 0)
+    {
+        held--;
+        for (int i = 0; i <= extra_refs[held]; i++)
+            audio_pool_release(pool_test_held[held]);
+    }
+
+    struct mallinfo2 heap_after = mallinfo2();
+    audio_pool_stats_t after = pool_test_stats();
+    TEST_ASSERT_EQUAL_UINT32(0, after.in_use);
+    TEST_ASSERT_EQUAL_UINT32(before.acquire_failures, after.acquire_failures);
+    TEST_ASSERT_EQUAL_UINT32(AUDIO_POOL_FRAME_COUNT, pool_test_count_free(data_after));
+    TEST_ASSERT_EQUAL_MEMORY(data_before, data_after, sizeof(data_before));
+    TEST_ASSERT_EQUAL_UINT64(heap_before.uordblks, heap_after.uordblks);
+}
+
+static void test_pool_bench_acquire_release(void)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pool_init());
+
+    uint64_t start = host_test_now_ns();
+    for (int n = 0; n < POOL_TEST_BENCH_OPS; n++)
+    {
+        uint64_t t0 = host_test_now_ns();
+        audio_block_t *block = audio_pool_acquire(AUDIO_POOL_FRAME, 0);
+        audio_pool_release(block);
+        pool_test_latency[n] = host_test_now_ns() - t0;
+        TEST_ASSERT_NOT_NULL(block);
+    }
+    double elapsed_s = (double)(host_test_now_ns() - start) / 1e9;
+    TEST_ASSERT_EQUAL_UINT32(0, pool_test_stats().in_use);
+
+    uint64_t p50 = host_test_percentile(pool_test_latency, POOL_TEST_BENCH_OPS, 500);
+    uint64_t p99 = host_test_percentile(pool_test_latency, POOL_TEST_BENCH_OPS, 990);
+    uint64_t max = host_test_percentile(pool_test_latency, POOL_TEST_BENCH_OPS, 1000);
+    HOST_BENCH("audio_pool acquire+release", "%.2f Mops/s, p50 %llu ns, p99 %llu ns, max %llu ns",
+               POOL_TEST_BENCH_OPS / elapsed_s / 1e6, (unsigned long long)p50, (unsigned long long)p99,
+               (unsigned long long)max);
+}
+
+// 两个任务同时对同一块 retain/release: 引用计数不能丢失或多减
+static void pool_test_retain_task(void *arg)
+{
+    audio_block_t *block = (audio_block_t *)arg;
+
+    for (int n = 0; n < POOL_TEST_RETAINS; n++)
+    {
+        audio_pool_retain(block);
+        audio_pool_release(block);
+        if ((n % 1024) == 0)
+            vTaskDelay(0);
+    }
+    atomic_fetch_sub(&pool_test_running, 1);
+    vTaskDelete(NULL);
+}
+
+// 生产者取块并多持有一份引用交给消费者, 双方各自释放, 谁最后释放谁归还
+static QueueHandle_t pool_test_handoff;
+
+static void pool_test_producer_task(void *arg)
+{
+    for (uint32_t n = 0; n < POOL_TEST_HANDOFFS; n++)
+    {
+        audio_block_t *block = audio_pool_acquire(AUDIO_POOL_FRAME, 1000);
+        if (block == NULL)
+            break;
+        block->sequence = n;
+        audio_pool_retain(block);
+        xQueueSend(pool_test_handoff, &block, portMAX_DELAY);
+        audio_pool_release(block);
+    }
+    atomic_fetch_sub(&pool_test_running, 1);
+    vTaskDelete(NULL);
+}
+
+static void pool_test_consumer_task(void *arg)
+{
+    uint32_t *received = (uint32_t *)arg;
+    audio_block_t *block;
+
+    while ((*received < POOL_TEST_HANDOFFS) && (xQueueReceive(pool_test_handoff, &block, pdMS_TO_TICKS(1000)) == pdPASS))
+    {
+        if (block->sequence == *received)
+            (*received)++;
+        audio_pool_release(block);
+    }
+    atomic_fetch_sub(&pool_test_running, 1);
+    vTaskDelete(NULL);
+}
+
+static void test_pool_bench_two_tasks(void)
+{
+    uint32_t received = 0;
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_pool_init());
+    audio_pool_stats_t before = pool_test_stats();
+
+    audio_block_t *block = audio_pool_acquire(AUDIO_POOL_FRAME, 0);
+    TEST_ASSERT_NOT_NULL(block);
+    atomic_store(&pool_test_running, 2);
+    uint64_t start = host_test_now_ns();
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(pool_test_retain_task, "pool_retain_a", 4096, block, 5, NULL));
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(pool_test_retain_task, "pool_retain_b", 4096, block, 5, NULL));
+    pool_test_wait_tasks();
+    double retain_s = (double)(host_test_now_ns() - start) / 1e9;
+    TEST_ASSERT_EQUAL_INT(1, atomic_load(&block->refs));
+    TEST_ASSERT_EQUAL_UINT32(1, pool_test_stats().in_use);
+    audio_pool_release(block);
+
+    pool_test_handoff = xQueueCreate(AUDIO_POOL_FRAME_COUNT / 2, sizeof(audio_block_t *));
+    TEST_ASSERT_NOT_NULL(pool_test_handoff);
+    atomic_store(&pool_test_running, 2);
+    start = host_test_now_ns();
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(pool_test_consumer_task, "pool_consumer", 4096, &received, 5, NULL));
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(pool_test_producer_task, "pool_producer", 4096, NULL, 5, NULL));
+    pool_test_wait_tasks();
+    double handoff_s = (double)(host_test_now_ns() - start) / 1e9;
+    vQueueDelete(pool_test_handoff);
+
+    audio_pool_stats_t after = pool_test_stats();
+    TEST_ASSERT_EQUAL_UINT32(POOL_TEST_HANDOFFS, received);
+    TEST_ASSERT_EQUAL_UINT32(0, after.in_use);
+    TEST_ASSERT_EQUAL_UINT32(before.acquire_failures, after.acquire_failures);
+    TEST_ASSERT_EQUAL_UINT32(AUDIO_POOL_FRAME_COUNT, pool_test_count_free(NULL));
+
+    HOST_BENCH("audio_pool retain+release 2 tasks", "%.2f Mops/s", 2.0 * POOL_TEST_RETAINS / retain_s / 1e6);
+    HOST_BENCH("audio_pool handoff 2 tasks", "%.0f blocks/s", POOL_TEST_HANDOFFS / handoff_s);
+}
+
+void test_audio_pool_run(void)
+{
+    RUN_TEST(test_pool_invalid_args);
+    RUN_TEST(test_pool_refcount_fanout);
+    RUN_TEST(test_pool_exhaustion);
+    RUN_TEST(test_pool_no_fragmentation);
+    RUN_TEST(test_pool_bench_acquire_release);
+    RUN_TEST(test_pool_bench_two_tasks);
+}
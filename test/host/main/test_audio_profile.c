@@ -0,0 +1,163 @@
+#include "unity.h"
+#include "host_test.h"
+#include "audio_profile.h"
+
+typedef struct {
+    audio_profile_id_t id;
+    int channels;
+    uint32_t desc_num;
+    uint32_t frame_num;
+    uint32_t period_us;
+    uint32_t latency_us;
+    uint32_t dma_bytes;
+} profile_test_case_t;
+
+/**
+ * 手算的期望值. deep 双声道每帧 6 字节, 一个描述符最多 682 帧, 8192 帧需要 13 个描述符,
+ * 每个 631 帧, 实际延迟比目标多 11 帧.
+ */
+static const profile_test_case_t profile_test_cases[] = {
+    { AUDIO_PROFILE_LOW_LATENCY, 1,  4,   64,  4000,  16000,  1024 },
+    { AUDIO_PROFILE_BALANCED,    1,  8,  256, 16000, 128000,  8192 },
+    { AUDIO_PROFILE_BALANCED,    2,  8,  256, 16000, 128000, 16384 },
+    { AUDIO_PROFILE_DEEP,        1,  8, 1024, 64000, 512000, 24576 },
+    { AUDIO_PROFILE_DEEP,        2, 13,  631, 39437, 512687, 49218 },
+    { AUDIO_PROFILE_8K,          1,  8,  128, 16000, 128000,  4096 },
+    { AUDIO_PROFILE_24K,         1,  8,  384, 16000, 128000, 12288 },
+    { AUDIO_PROFILE_48K,         1,  8,  768, 16000, 128000, 24576 },
+    { AUDIO_PROFILE_48K,         2, 13,  473,  9854, 128104, 49192 },
+};
+
+// 任意合法配置都要满足的约束: 延迟不小于目标, 单描述符不超过 DMA 上限, 描述符数和帧数都取最小
+static void profile_test_check(const audio_profile_t *profile, int channels, const audio_profile_dma_t *dma)
+{
+    uint32_t frame_bytes = dma->sample_bytes * (uint32_t)channels;
+    uint64_t frames = ((uint64_t)profile->target_latency_us * profile->sample_rate + 999999) / 1000000;
+    uint32_t min_desc = (profile->min_desc > AUDIO_PROFILE_DMA_MIN_DESC) ? profile->min_desc : AUDIO_PROFILE_DMA_MIN_DESC;
+    uint32_t max_frames = AUDIO_PROFILE_DMA_MAX_BYTES / frame_bytes;
+
+    TEST_ASSERT_EQUAL_UINT32(profile->data_bits / 8, dma->sample_bytes);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(min_desc, dma->desc_num);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2, dma->frame_num);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(AUDIO_PROFILE_DMA_MAX_BYTES, dma->frame_num * frame_bytes);
+    TEST_ASSERT_TRUE((uint64_t)dma->desc_num * dma->frame_num >= frames);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(profile->target_latency_us, dma->latency_us);
+    // 少一个描述符会超过上限 (或低于下限), 每个描述符少一帧会达不到目标
+    TEST_ASSERT_TRUE((dma->desc_num == min_desc) || ((uint64_t)(dma->desc_num - 1) * max_frames < frames));
+    TEST_ASSERT_TRUE((uint64_t)dma->desc_num * (dma->frame_num - 1) < frames);
+    TEST_ASSERT_EQUAL_UINT32(dma->desc_num * dma->frame_num * frame_bytes, dma->dma_bytes);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)((uint64_t)dma->frame_num * 1000000 / profile->sample_rate), dma->period_us);
+}
+
+static void test_audio_profile_table(void)
+{
+    audio_profile_dma_t dma;
+    char message[64];
+
+    for (size_t i = 0; i < sizeof(profile_test_cases) / sizeof(profile_test_cases[0]); i++)
+    {
+        const profile_test_case_t *c = &profile_test_cases[i];
+        const audio_profile_t *profile = audio_profile_get(c->id);
+
+        TEST_ASSERT_NOT_NULL(profile);
+        snprintf(message, sizeof(message), "%s, %d channel(s)", profile->name, c->channels);
+        TEST_ASSERT_EQUAL_MESSAGE(ESP_OK, audio_profile_dma_size(profile, c->channels, &dma), message);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(c->desc_num, dma.desc_num, message);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(c->frame_num, dma.frame_num, message);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(c->period_us, dma.period_us, message);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(c->latency_us, dma.latency_us, message);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(c->dma_bytes, dma.dma_bytes, message);
+        profile_test_check(profile, c->channels, &dma);
+    }
+}
+
+// 所有采样率, 位宽和声道数, 目标延迟从 1ms 到 1s
+static void test_audio_profile_sweep(void)
+{
+    static const uint32_t rates[] = { 8000, 16000, 24000, 48000 };
+    static const uint8_t bits[] = { 16, 24, 32 };
+    static const uint8_t min_desc[] = { 0, 2, 4, 8 };
+    audio_profile_dma_t dma;
+    uint32_t checked = 0;
+
+    for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+    {
+        for (size_t b = 0; b < sizeof(bits) / sizeof(bits[0]); b++)
+        {
+            for (size_t d = 0; d < sizeof(min_desc) / sizeof(min_desc[0]); d++)
+            {
+                for (uint32_t latency_us = 1000; latency_us <= 1000000; latency_us += 997)
+                {
+                    for (int channels = 1; channels <= 2; channels++)
+                    {
+                        audio_profile_t profile = { "sweep", rates[r], bits[b], min_desc[d], latency_us };
+                        if (audio_profile_dma_size(&profile, channels, &dma) != ESP_OK)
+                        {
+                            // 只有不足一个描述符两帧时才拒绝
+                            uint32_t desc = (min_desc[d] > AUDIO_PROFILE_DMA_MIN_DESC) ? min_desc[d] : AUDIO_PROFILE_DMA_MIN_DESC;
+                            TEST_ASSERT_TRUE((uint64_t)latency_us * rates[r] <= (uint64_t)desc * 1000000);
+                            continue;
+                        }
+                        profile_test_check(&profile, channels, &dma);
+                        checked++;
+                    }
+                }
+            }
+        }
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0, checked);
+}
+
+static void test_audio_profile_invalid(void)
+{
+    audio_profile_dma_t dma;
+    const audio_profile_t *balanced = audio_profile_get(AUDIO_PROFILE_BALANCED);
+    audio_profile_t profile = *balanced;
+
+    TEST_ASSERT_NULL(audio_profile_get(AUDIO_PROFILE_MAX));
+    TEST_ASSERT_NULL(audio_profile_get((audio_profile_id_t)-1));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_profile_dma_size(NULL, 1, &dma));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_profile_dma_size(balanced, 1, NULL));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_profile_dma_size(balanced, 0, &dma));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_profile_dma_size(balanced, 3, &dma));
+
+    profile.sample_rate = 44100;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_profile_dma_size(&profile, 1, &dma));
+    profile = *balanced;
+    profile.data_bits = 20;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_profile_dma_size(&profile, 1, &dma));
+    // 8kHz 下 1ms 只有 8 帧, 8 个描述符分不到两帧
+    profile = *balanced;
+    profile.sample_rate = 8000;
+    profile.target_latency_us = 1000;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_profile_dma_size(&profile, 1, &dma));
+}
+
+// 各配置的 DMA 占用和时序, 供选择配置时对照 (计算值, 与机器无关)
+static void test_audio_profile_report(void)
+{
+    audio_profile_dma_t dma;
+    char name[40];
+
+    for (int id = 0; id < AUDIO_PROFILE_MAX; id++)
+    {
+        const audio_profile_t *profile = audio_profile_get((audio_profile_id_t)id);
+        for (int channels = 1; channels <= 2; channels++)
+        {
+            TEST_ASSERT_EQUAL(ESP_OK, audio_profile_dma_size(profile, channels, &dma));
+            snprintf(name, sizeof(name), "audio_profile %s %s", profile->name, (channels == 1) ? "mono" : "stereo");
+            HOST_BENCH(name, "%2lu x %4lu frames, period %6.2f ms, latency %6.2f ms, DMA %5lu bytes, %5lu irq/s",
+                       (unsigned long)dma.desc_num, (unsigned long)dma.frame_num, dma.period_us / 1000.0,
+                       dma.latency_us / 1000.0, (unsigned long)dma.dma_bytes,
+                       (unsigned long)(profile->sample_rate / dma.frame_num));
+        }
+    }
+}
+
+void test_audio_profile_run(void)
+{
+    RUN_TEST(test_audio_profile_table);
+    RUN_TEST(test_audio_profile_sweep);
+    RUN_TEST(test_audio_profile_invalid);
+    RUN_TEST(test_audio_profile_report);
+}
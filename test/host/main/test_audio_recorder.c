@@ -0,0 +1,241 @@
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "unity.h"
+#include "host_test.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "audio_recorder.h"
+#include "audio_storage.h"
+#include "stream_frame.h"
+#include "wav_audio.h"
+
+#define RECORDER_TEST_SAMPLES       1024                // 每帧样本数, 与 I2S 读取块相同
+#define RECORDER_TEST_FRAME_BYTES   (RECORDER_TEST_SAMPLES * sizeof(int32_t))
+#define RECORDER_TEST_PACED_FRAMES  2000
+#define RECORDER_TEST_FAST_FRAMES   5000
+#define RECORDER_TEST_CLOSE_MS      10000
+#define RECORDER_TEST_FRAME_US      64000               // 16kHz 下一帧的实时长度
+
+static int32_t recorder_test_payload[RECORDER_TEST_SAMPLES];
+static uint8_t recorder_test_file[RECORDER_TEST_FAST_FRAMES * RECORDER_TEST_FRAME_BYTES + WAV_AUDIO_HEADER_SIZE];
+
+static uint32_t recorder_test_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// ./sdcard 只给主机测试和模拟固件用, 先清掉以前留下的录音
+static void recorder_test_clean(void)
+{
+    char path[AUDIO_RECORDER_PATH_MAX + 16];
+    DIR *dir = opendir(audio_storage_base_path());
+    struct dirent *entry;
+
+    if (dir == NULL)
+        return;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if ((entry->d_name[0] != 'R') || (strlen(entry->d_name) != 12))
+            continue;
+        snprintf(path, sizeof(path), "%s/%s", audio_storage_base_path(), entry->d_name);
+        unlink(path);
+    }
+    closedir(dir);
+}
+
+// 序号最大的 WAV 录音, 即最近完成的一个
+static bool recorder_test_latest(char *path, size_t size)
+{
+    DIR *dir = opendir(audio_storage_base_path());
+    struct dirent *entry;
+    unsigned long latest = 0;
+    bool found = false;
+
+    if (dir == NULL)
+        return false;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        unsigned long value;
+        if ((sscanf(entry->d_name, "R%7lu.WAV", &value) != 1) || (found && (value < latest)))
+            continue;
+        latest = value;
+        found = true;
+    }
+    closedir(dir);
+    snprintf(path, size, "%s/R%07lu.WAV", audio_storage_base_path(), latest);
+    return found;
+}
+
+static audio_recorder_stats_t recorder_test_stats(void)
+{
+    audio_recorder_stats_t stats;
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_get_stats(&stats));
+    return stats;
+}
+
+/**
+ * 按流发送路径的顺序送入 SESSION + frames 个 AUDIO + END. 每帧的样本是全局递增的斜坡,
+ * 从文件里能看出丢了哪些帧. pace 帧一次 vTaskDelay(1), 0 表示全速.
+ */
+static void recorder_test_stream(uint32_t frames, uint32_t pace)
+{
+    stream_frame_header_t header;
+    stream_frame_session_t session;
+    uint16_t session_id = stream_frame_next_session_id();
+
+    stream_frame_build_session(&session, STREAM_CODEC_RAW32, 16000, 0);
+    stream_frame_build_header(&header, STREAM_FRAME_SESSION, session_id, 0, 0, sizeof(session), 0);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_record_frame(&header, &session, sizeof(session)));
+    TEST_ASSERT_TRUE(audio_recorder_is_recording());
+
+    for (uint32_t n = 0; n < frames; n++)
+    {
+        for (int i = 0; i < RECORDER_TEST_SAMPLES; i++)
+            recorder_test_payload[i] = (int32_t)(n * RECORDER_TEST_SAMPLES + i);
+        stream_frame_build_header(&header, STREAM_FRAME_AUDIO, session_id, n, n * RECORDER_TEST_SAMPLES,
+                                  RECORDER_TEST_FRAME_BYTES, (uint64_t)n * RECORDER_TEST_FRAME_US);
+        // 没有空闲缓冲区时返回 NO_MEM 并整帧丢弃, 不阻塞
+        esp_err_t err = audio_recorder_record_frame(&header, recorder_test_payload, RECORDER_TEST_FRAME_BYTES);
+        TEST_ASSERT_TRUE((err == ESP_OK) || (err == ESP_ERR_NO_MEM));
+        if (pace && ((n % pace) == 0))
+            vTaskDelay(1);
+    }
+
+    stream_frame_build_header(&header, STREAM_FRAME_END, session_id, frames, frames * RECORDER_TEST_SAMPLES, 0, 0);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_record_frame(&header, NULL, 0));
+    TEST_ASSERT_FALSE(audio_recorder_is_recording());
+}
+
+static void recorder_test_wait_close(uint32_t files)
+{
+    for (int ms = 0; (ms < RECORDER_TEST_CLOSE_MS) && (recorder_test_stats().files < files); ms++)
+        vTaskDelay(pdMS_TO_TICKS(1));
+    TEST_ASSERT_EQUAL_UINT32(files, recorder_test_stats().files);
+}
+
+static int recorder_test_fd_read(void *ctx, void *data, size_t len)
+{
+    return (int)read(*(int *)ctx, data, len);
+}
+
+/**
+ * 检查收尾后的文件: RIFF/data 大小已回写且与文件长度一致, 数据由完整的帧组成, 帧按顺序出现.
+ * 返回文件里的帧数.
+ */
+static uint32_t recorder_test_check_file(uint32_t frames_sent)
+{
+    char path[AUDIO_RECORDER_PATH_MAX];
+    struct stat st;
+    wav_audio_reader_t reader;
+
+    TEST_ASSERT_TRUE(recorder_test_latest(path, sizeof(path)));
+    TEST_ASSERT_EQUAL(0, stat(path, &st));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(sizeof(recorder_test_file), (uint32_t)st.st_size);
+
+    int fd = open(path, O_RDONLY);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, fd);
+    TEST_ASSERT_EQUAL((ssize_t)st.st_size, read(fd, recorder_test_file, st.st_size));
+    lseek(fd, 0, SEEK_SET);
+    wav_audio_source_t source = { .read = recorder_test_fd_read, .ctx = &fd };
+    TEST_ASSERT_EQUAL(ESP_OK, wav_audio_reader_open(&reader, &source));
+    close(fd);
+
+    uint32_t data_size = (uint32_t)st.st_size - WAV_AUDIO_HEADER_SIZE;
+    TEST_ASSERT_FALSE(reader.streaming);
+    TEST_ASSERT_EQUAL_UINT32(data_size, reader.data_size);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)st.st_size - 8, recorder_test_le32(recorder_test_file + WAV_AUDIO_RIFF_SIZE_OFFSET));
+    TEST_ASSERT_EQUAL_UINT32(data_size, recorder_test_le32(recorder_test_file + WAV_AUDIO_DATA_SIZE_OFFSET));
+    TEST_ASSERT_EQUAL_UINT32(16000, reader.format.sample_rate);
+    TEST_ASSERT_EQUAL_UINT16(32, reader.format.bits_per_sample);
+    TEST_ASSERT_EQUAL_UINT32(0, data_size % RECORDER_TEST_FRAME_BYTES);
+
+    // 丢弃只能是整帧: 每帧内部是连续的斜坡, 帧序号严格递增
+    const int32_t *samples = (const int32_t *)(recorder_test_file + WAV_AUDIO_HEADER_SIZE);
+    uint32_t frames = data_size / RECORDER_TEST_FRAME_BYTES;
+    int64_t last = -1;
+    for (uint32_t f = 0; f < frames; f++)
+    {
+        const int32_t *frame = samples + (size_t)f * RECORDER_TEST_SAMPLES;
+        TEST_ASSERT_EQUAL_INT32(0, frame[0] % RECORDER_TEST_SAMPLES);
+        TEST_ASSERT_GREATER_THAN_INT64(last, (int64_t)(frame[0] / RECORDER_TEST_SAMPLES));
+        TEST_ASSERT_LESS_THAN_UINT32(frames_sent, (uint32_t)(frame[0] / RECORDER_TEST_SAMPLES));
+        for (int i = 1; i < RECORDER_TEST_SAMPLES; i++)
+            TEST_ASSERT_EQUAL_INT32(frame[0] + i, frame[i]);
+        last = frame[0] / RECORDER_TEST_SAMPLES;
+    }
+    return frames;
+}
+
+static void recorder_test_report(const char *name, uint32_t frames, double seconds,
+                                 const audio_recorder_stats_t *before, const audio_recorder_stats_t *after)
+{
+    uint32_t bytes = after->bytes_written - before->bytes_written;
+
+    HOST_BENCH(name, "%.1f MB/s (%.0fx real time), %lu/%lu frames dropped, max stall %lu us, max write %lu us",
+               bytes / seconds / 1e6, bytes / seconds / (16000.0 * sizeof(int32_t)),
+               (unsigned long)(after->frames_dropped - before->frames_dropped), (unsigned long)frames,
+               (unsigned long)after->max_stall_us, (unsigned long)after->max_write_us);
+}
+
+static void test_recorder_init(void)
+{
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_recorder_get_stats(NULL));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_storage_mount());
+    recorder_test_clean();
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_init(AUDIO_RECORDER_FORMAT_WAV));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_init(AUDIO_RECORDER_FORMAT_WAV));
+    TEST_ASSERT_FALSE(audio_recorder_is_recording());
+}
+
+// 写入速度远高于实时 (每毫秒一帧, 约 60 倍): 不丢帧, 文件是完整的斜坡
+static void test_recorder_paced(void)
+{
+    audio_recorder_stats_t before = recorder_test_stats();
+
+    uint64_t start = host_test_now_ns();
+    recorder_test_stream(RECORDER_TEST_PACED_FRAMES, 1);
+    recorder_test_wait_close(before.files + 1);
+    double seconds = (double)(host_test_now_ns() - start) / 1e9;
+
+    audio_recorder_stats_t after = recorder_test_stats();
+    TEST_ASSERT_EQUAL_UINT32(before.frames_dropped, after.frames_dropped);
+    TEST_ASSERT_EQUAL_UINT32(before.write_errors, after.write_errors);
+    TEST_ASSERT_EQUAL_UINT32(WAV_AUDIO_HEADER_SIZE + RECORDER_TEST_PACED_FRAMES * RECORDER_TEST_FRAME_BYTES,
+                             after.bytes_written - before.bytes_written);
+    TEST_ASSERT_EQUAL_UINT32(RECORDER_TEST_PACED_FRAMES, recorder_test_check_file(RECORDER_TEST_PACED_FRAMES));
+    recorder_test_report("audio_recorder paced", RECORDER_TEST_PACED_FRAMES, seconds, &before, &after);
+}
+
+/**
+ * 全速送帧: 写任务跟不上时整帧丢弃并计数, 采集侧不阻塞.
+ * 文件头的大小必须等于实际写入的数据, 文件里的帧数加上丢弃数等于送入的帧数.
+ */
+static void test_recorder_full_speed(void)
+{
+    audio_recorder_stats_t before = recorder_test_stats();
+
+    uint64_t start = host_test_now_ns();
+    recorder_test_stream(RECORDER_TEST_FAST_FRAMES, 0);
+    recorder_test_wait_close(before.files + 1);
+    double seconds = (double)(host_test_now_ns() - start) / 1e9;
+
+    audio_recorder_stats_t after = recorder_test_stats();
+    uint32_t frames = recorder_test_check_file(RECORDER_TEST_FAST_FRAMES);
+    TEST_ASSERT_EQUAL_UINT32(before.write_errors, after.write_errors);
+    TEST_ASSERT_EQUAL_UINT32(WAV_AUDIO_HEADER_SIZE + frames * RECORDER_TEST_FRAME_BYTES,
+                             after.bytes_written - before.bytes_written);
+    TEST_ASSERT_EQUAL_UINT32(RECORDER_TEST_FAST_FRAMES, frames + (after.frames_dropped - before.frames_dropped));
+    recorder_test_report("audio_recorder full speed", RECORDER_TEST_FAST_FRAMES, seconds, &before, &after);
+}
+
+void test_audio_recorder_run(void)
+{
+    RUN_TEST(test_recorder_init);
+    RUN_TEST(test_recorder_paced);
+    RUN_TEST(test_recorder_full_speed);
+}
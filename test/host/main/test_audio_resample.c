@@ -0,0 +1,223 @@
+#include <math.h>
+#include <string.h>
+#include "unity.h"
+#include "host_test.h"
+#include "audio_resample.h"
+
+#define RESAMPLE_TEST_IN_MAX    30000       // 24kHz 下 1.25 s
+#define RESAMPLE_TEST_OUT_MAX   (20000 + RESAMPLE_TEST_BLOCK)
+#define RESAMPLE_TEST_BLOCK     1024        // I2S_AUDIO_BUFFER_SAMPLES
+#define RESAMPLE_TEST_SKIP      400         // 跳过滤波器起振
+#define RESAMPLE_TEST_WINDOW    8000        // 分析长度, 所有测试频率在其中都是整数个周期
+#define RESAMPLE_BENCH_SECONDS  20
+
+typedef struct {
+    uint32_t in_rate;
+    uint32_t out_rate;
+    float stop_hz;          // 下采样: 输出奈奎斯特频率以上的输入音; 上采样为 0, 改用 1kHz
+    float alias_hz;         // 混叠或镜像在输出端的频率
+    float sinad_floor_db;   // 1kHz -6dBFS 的 SINAD 下限
+    float reject_floor_db;  // 混叠 (下采样) 或镜像 (上采样) 的抑制下限
+} resample_test_case_t;
+
+/**
+ * 下限比实测值 (24k->16k / 16k->8k / 8k->16k: SINAD 83.1 / 79.0 / 81.7 dB,
+ * 抑制 87.6 / 82.3 / 93.3 dB) 各留约 3 dB, 滤波器或定点处理变差时失败.
+ * 重采样本身是整数运算, 与机器无关.
+ */
+static const resample_test_case_t resample_test_cases[] = {
+    { 24000, 16000, 10000.0f, 6000.0f, 80.0f, 84.0f },
+    { 16000,  8000,  6000.0f, 2000.0f, 76.0f, 79.0f },
+    {  8000, 16000,     0.0f, 7000.0f, 78.0f, 90.0f },
+};
+
+static int16_t resample_in[RESAMPLE_TEST_IN_MAX];
+static int16_t resample_out[RESAMPLE_TEST_OUT_MAX];
+static int16_t resample_ref[RESAMPLE_TEST_OUT_MAX];
+
+static int resample_test_in_samples(const resample_test_case_t *c)
+{
+    return (int)(c->in_rate * 5 / 4);
+}
+
+static void resample_test_tone(uint32_t rate, int samples, float freq, float amplitude)
+{
+    for (int i = 0; i < samples; i++)
+        resample_in[i] = (int16_t)lrintf(amplitude * sinf(2.0f * (float)M_PI * freq * i / rate));
+}
+
+// 按 I2S 块大小送入, 返回输出样本数
+static int resample_test_run(audio_resample_t *rs, int in_samples, int block)
+{
+    int produced = 0;
+    for (int i = 0; i < in_samples; i += block)
+    {
+        int n = (in_samples - i < block) ? in_samples - i : block;
+        int out = audio_resample_process(rs, resample_in + i, n, resample_out + produced,
+                                         RESAMPLE_TEST_OUT_MAX - produced);
+        TEST_ASSERT_GREATER_OR_EQUAL(0, out);
+        produced += out;
+    }
+    return produced;
+}
+
+// 分析窗内 freq 分量的幅度 (窗长是整数个周期, sin/cos 投影正交)
+static double resample_test_amplitude(const int16_t *y, int n, float freq, uint32_t rate)
+{
+    double s = 0.0, c = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        double w = 2.0 * M_PI * freq * i / rate;
+        s += y[i] * sin(w);
+        c += y[i] * cos(w);
+    }
+    return 2.0 * sqrt(s * s + c * c) / n;
+}
+
+// 去掉 freq 分量和直流后的残差作为噪声加失真
+static double resample_test_sinad(const int16_t *y, int n, float freq, uint32_t rate)
+{
+    double s = 0.0, c = 0.0, dc = 0.0, total = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        double w = 2.0 * M_PI * freq * i / rate;
+        s += y[i] * sin(w);
+        c += y[i] * cos(w);
+        dc += y[i];
+        total += (double)y[i] * y[i];
+    }
+    s *= 2.0 / n;
+    c *= 2.0 / n;
+    dc /= n;
+    double signal = (s * s + c * c) / 2.0;
+    double residual = total / n - signal - dc * dc;
+    return 10.0 * log10(signal / residual);
+}
+
+static void test_audio_resample_passband(void)
+{
+    audio_resample_t rs;
+    char message[96];
+
+    for (size_t k = 0; k < sizeof(resample_test_cases) / sizeof(resample_test_cases[0]); k++)
+    {
+        const resample_test_case_t *c = &resample_test_cases[k];
+        int in_samples = resample_test_in_samples(c);
+
+        TEST_ASSERT_EQUAL(ESP_OK, audio_resample_init(&rs, c->in_rate, c->out_rate));
+        resample_test_tone(c->in_rate, in_samples, 1000.0f, 16384.0f);
+        int produced = resample_test_run(&rs, in_samples, RESAMPLE_TEST_BLOCK);
+        TEST_ASSERT_GREATER_OR_EQUAL(RESAMPLE_TEST_SKIP + RESAMPLE_TEST_WINDOW, produced);
+
+        const int16_t *y = resample_out + RESAMPLE_TEST_SKIP;
+        double gain_db = 20.0 * log10(resample_test_amplitude(y, RESAMPLE_TEST_WINDOW, 1000.0f, c->out_rate) / 16384.0);
+        double sinad = resample_test_sinad(y, RESAMPLE_TEST_WINDOW, 1000.0f, c->out_rate);
+        snprintf(message, sizeof(message), "%lu -> %lu Hz: gain %.2f dB, SINAD %.1f dB", (unsigned long)c->in_rate,
+                 (unsigned long)c->out_rate, gain_db, sinad);
+        TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.5f, 0.0f, (float)gain_db, message);
+        TEST_ASSERT_GREATER_OR_EQUAL_MESSAGE(c->sinad_floor_db, (float)sinad, message);
+        HOST_BENCH("audio_resample passband 1 kHz", "%s", message);
+    }
+}
+
+static void test_audio_resample_alias_rejection(void)
+{
+    audio_resample_t rs;
+    char message[96];
+
+    for (size_t k = 0; k < sizeof(resample_test_cases) / sizeof(resample_test_cases[0]); k++)
+    {
+        const resample_test_case_t *c = &resample_test_cases[k];
+        int in_samples = resample_test_in_samples(c);
+        // 下采样: 输入放在输出奈奎斯特以上, 测混叠; 上采样: 输入 1kHz, 测 7kHz 的镜像
+        float in_hz = (c->stop_hz > 0.0f) ? c->stop_hz : 1000.0f;
+
+        TEST_ASSERT_EQUAL(ESP_OK, audio_resample_init(&rs, c->in_rate, c->out_rate));
+        resample_test_tone(c->in_rate, in_samples, in_hz, 16384.0f);
+        resample_test_run(&rs, in_samples, RESAMPLE_TEST_BLOCK);
+
+        const int16_t *y = resample_out + RESAMPLE_TEST_SKIP;
+        double leak = resample_test_amplitude(y, RESAMPLE_TEST_WINDOW, c->alias_hz, c->out_rate);
+        double reject_db = (leak > 0.0) ? 20.0 * log10(16384.0 / leak) : 120.0;
+        snprintf(message, sizeof(message), "%lu -> %lu Hz: %.0f Hz in, %.1f dB below at %.0f Hz",
+                 (unsigned long)c->in_rate, (unsigned long)c->out_rate, in_hz, reject_db, c->alias_hz);
+        TEST_ASSERT_GREATER_OR_EQUAL_MESSAGE(c->reject_floor_db, (float)reject_db, message);
+        HOST_BENCH(c->stop_hz > 0.0f ? "audio_resample aliasing" : "audio_resample imaging", "%s", message);
+    }
+}
+
+// 状态跨块保存: 任意切分的输出必须和一次处理完全一致
+static void test_audio_resample_block_independent(void)
+{
+    const int blocks[] = { 1, 3, 7, 160, 1023 };
+    audio_resample_t rs;
+    uint32_t seed = 0xace1;
+
+    for (size_t k = 0; k < sizeof(resample_test_cases) / sizeof(resample_test_cases[0]); k++)
+    {
+        const resample_test_case_t *c = &resample_test_cases[k];
+        int in_samples = (int)c->in_rate / 4;
+
+        for (int i = 0; i < in_samples; i++)
+            resample_in[i] = (int16_t)host_test_rand(&seed);
+        audio_resample_init(&rs, c->in_rate, c->out_rate);
+        int expected = resample_test_run(&rs, in_samples, in_samples);
+        memcpy(resample_ref, resample_out, expected * sizeof(int16_t));
+        TEST_ASSERT_EQUAL_INT((int)(c->out_rate / 4), expected);
+
+        for (size_t b = 0; b < sizeof(blocks) / sizeof(blocks[0]); b++)
+        {
+            audio_resample_reset(&rs);
+            TEST_ASSERT_EQUAL_INT(expected, resample_test_run(&rs, in_samples, blocks[b]));
+            TEST_ASSERT_EQUAL_INT16_ARRAY(resample_ref, resample_out, expected);
+        }
+    }
+}
+
+static void test_audio_resample_capacity(void)
+{
+    audio_resample_t rs;
+
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_SUPPORTED, audio_resample_init(&rs, 44100, 16000));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_resample_init(&rs, 8000, 16000));
+    // 输出空间不足时不处理, 状态不变
+    TEST_ASSERT_EQUAL_INT(-1, audio_resample_process(&rs, resample_in, 100, resample_out, 200));
+    TEST_ASSERT_EQUAL_INT(0, rs.phase);
+    TEST_ASSERT_EQUAL_INT(0, rs.pos);
+    TEST_ASSERT_EQUAL_INT(200, audio_resample_process(&rs, resample_in, 100, resample_out,
+                                                      audio_resample_max_output(&rs, 100)));
+}
+
+static void test_audio_resample_bench(void)
+{
+    audio_resample_t rs;
+    char name[40];
+
+    for (size_t k = 0; k < sizeof(resample_test_cases) / sizeof(resample_test_cases[0]); k++)
+    {
+        const resample_test_case_t *c = &resample_test_cases[k];
+        int in_samples = resample_test_in_samples(c);
+        uint64_t produced = 0;
+
+        audio_resample_init(&rs, c->in_rate, c->out_rate);
+        resample_test_tone(c->in_rate, in_samples, 1000.0f, 16384.0f);
+        uint64_t start = host_test_now_ns();
+        for (int s = 0; s < RESAMPLE_BENCH_SECONDS * 4 / 5; s++)
+            produced += resample_test_run(&rs, in_samples, RESAMPLE_TEST_BLOCK);
+        double ns = (double)(host_test_now_ns() - start) / produced;
+
+        // 每个输出样本一次 taps 点积, S3 上约 1 个 MAC/周期加循环开销
+        snprintf(name, sizeof(name), "audio_resample %lu->%lu", (unsigned long)c->in_rate, (unsigned long)c->out_rate);
+        HOST_BENCH(name, "%.2f ns/output sample, %d MAC/output sample, %.4f%% of real time", ns, rs.taps,
+                   ns * c->out_rate / 1e7);
+    }
+}
+
+void test_audio_resample_run(void)
+{
+    RUN_TEST(test_audio_resample_passband);
+    RUN_TEST(test_audio_resample_alias_rejection);
+    RUN_TEST(test_audio_resample_block_independent);
+    RUN_TEST(test_audio_resample_capacity);
+    RUN_TEST(test_audio_resample_bench);
+}
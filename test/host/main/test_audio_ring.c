@@ -0,0 +1,293 @@
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <stdbool.h>
+#include "unity.h"
+#include "host_test.h"
+#include "audio_ring.h"
+
+#define RING_STRESS_SIZE        256             // 小环: 回绕和满/空竞争最频繁
+#define RING_STRESS_BYTES       (32u << 20)
+#define RING_BENCH_SIZE         8192
+#define RING_BENCH_CHUNK        640             // 16kHz 下 10ms 的 PCM32 块
+#define RING_BENCH_BYTES        (256u << 20)
+#define RING_BENCH_LATENCY_OPS  200000
+
+typedef struct {
+    audio_ring_t *ring;
+    uint32_t bytes;
+    size_t max_chunk;
+    bool use_span;                              // 交替使用拷贝接口和零拷贝接口
+    uint32_t errors;                            // 消费者看到的错位字节数
+    uint32_t first_error;
+} ring_stress_t;
+
+// 字节流内容由位置决定, 消费者可以独立校验
+static inline uint8_t ring_stress_byte(uint32_t position)
+{
+    return (uint8_t)((position * 2654435761u) >> 24);
+}
+
+static void *ring_stress_producer(void *arg)
+{
+    ring_stress_t *stress = (ring_stress_t *)arg;
+    uint8_t chunk[RING_STRESS_SIZE];
+    uint32_t seed = 0x1234567u;
+    uint32_t position = 0;
+
+    while (position < stress->bytes)
+    {
+        size_t want = 1 + host_test_rand(&seed) % stress->max_chunk;
+        if (want > stress->bytes - position)
+            want = stress->bytes - position;
+
+        if (stress->use_span && (host_test_rand(&seed) & 1))
+        {
+            void *span;
+            size_t n = audio_ring_write_span(stress->ring, &span);
+            n = (n < want) ? n : want;
+            for (size_t i = 0; i < n; i++)
+                ((uint8_t *)span)[i] = ring_stress_byte(position + (uint32_t)i);
+            audio_ring_write_commit(stress->ring, n);
+            position += (uint32_t)n;
+            if (n == 0)
+                sched_yield();
+        }
+        else
+        {
+            for (size_t i = 0; i < want; i++)
+                chunk[i] = ring_stress_byte(position + (uint32_t)i);
+            size_t n = audio_ring_write(stress->ring, chunk, want);
+            position += (uint32_t)n;
+            if (n == 0)
+                sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void *ring_stress_consumer(void *arg)
+{
+    ring_stress_t *stress = (ring_stress_t *)arg;
+    uint8_t chunk[RING_STRESS_SIZE];
+    uint32_t seed = 0x7654321u;
+    uint32_t position = 0;
+
+    while (position < stress->bytes)
+    {
+        size_t want = 1 + host_test_rand(&seed) % stress->max_chunk;
+        const uint8_t *data;
+        size_t n;
+
+        if (stress->use_span && (host_test_rand(&seed) & 1))
+        {
+            const void *span;
+            n = audio_ring_read_span(stress->ring, &span);
+            n = (n < want) ? n : want;
+            data = (const uint8_t *)span;
+        }
+        else
+        {
+            n = audio_ring_read(stress->ring, chunk, want);
+            data = chunk;
+        }
+
+        for (size_t i = 0; i < n; i++)
+        {
+            if ((data[i] != ring_stress_byte(position + (uint32_t)i)) && (stress->errors++ == 0))
+                stress->first_error = position + (uint32_t)i;
+        }
+        if (data != chunk)
+            audio_ring_read_consume(stress->ring, n);
+        position += (uint32_t)n;
+        // 单核主机上对端只有被调度才能推进
+        if (n == 0)
+            sched_yield();
+    }
+    return NULL;
+}
+
+static void ring_stress_run(bool use_span)
+{
+    static uint8_t storage[RING_STRESS_SIZE];
+    audio_ring_t ring;
+    ring_stress_t stress = { .ring = &ring, .bytes = RING_STRESS_BYTES, .max_chunk = RING_STRESS_SIZE,
+                             .use_span = use_span };
+    pthread_t producer, consumer;
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_ring_init(&ring, storage, sizeof(storage)));
+    TEST_ASSERT_EQUAL(0, pthread_create(&producer, NULL, ring_stress_producer, &stress));
+    TEST_ASSERT_EQUAL(0, pthread_create(&consumer, NULL, ring_stress_consumer, &stress));
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, stress.errors, "corrupted bytes in SPSC stream");
+    TEST_ASSERT_EQUAL(0, audio_ring_used(&ring));
+}
+
+static void test_ring_init_rejects_bad_size(void)
+{
+    uint8_t storage[96];
+    audio_ring_t ring;
+
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_ring_init(&ring, storage, 96));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_ring_init(&ring, storage, 0));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_ring_init(&ring, NULL, 64));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_ring_init(&ring, storage, 64));
+    TEST_ASSERT_EQUAL(64, audio_ring_free(&ring));
+}
+
+static void test_ring_copy_wraps_and_limits(void)
+{
+    uint8_t storage[64];
+    uint8_t in[48], out[48];
+    audio_ring_t ring;
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_ring_init(&ring, storage, sizeof(storage)));
+    // 48 与 64 互质于回绕点, 每一轮的读写都跨越不同的位置
+    for (int round = 0; round < 100; round++)
+    {
+        for (int i = 0; i < 48; i++)
+            in[i] = (uint8_t)(round * 48 + i);
+        TEST_ASSERT_EQUAL(48, audio_ring_write(&ring, in, sizeof(in)));
+        TEST_ASSERT_EQUAL(48, audio_ring_used(&ring));
+        // 满了只写入剩余空间
+        TEST_ASSERT_EQUAL(16, audio_ring_write(&ring, in, sizeof(in)));
+        TEST_ASSERT_EQUAL(0, audio_ring_free(&ring));
+
+        TEST_ASSERT_EQUAL(48, audio_ring_read(&ring, out, sizeof(out)));
+        TEST_ASSERT_EQUAL_MEMORY(in, out, sizeof(in));
+        TEST_ASSERT_EQUAL(16, audio_ring_read(&ring, out, sizeof(out)));
+        TEST_ASSERT_EQUAL_MEMORY(in, out, 16);
+        TEST_ASSERT_EQUAL(0, audio_ring_read(&ring, out, sizeof(out)));
+    }
+}
+
+static void test_ring_span_stops_at_wrap(void)
+{
+    uint8_t storage[64];
+    uint8_t data[40] = { 0 };
+    audio_ring_t ring;
+    void *wspan;
+    const void *rspan;
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_ring_init(&ring, storage, sizeof(storage)));
+    TEST_ASSERT_EQUAL(40, audio_ring_write(&ring, data, sizeof(data)));
+    TEST_ASSERT_EQUAL(40, audio_ring_read(&ring, data, sizeof(data)));
+
+    // 偏移 40: 可写 64 字节, 但连续的只有 24 字节
+    TEST_ASSERT_EQUAL(24, audio_ring_write_span(&ring, &wspan));
+    TEST_ASSERT_EQUAL_PTR(storage + 40, wspan);
+    audio_ring_write_commit(&ring, 24);
+    TEST_ASSERT_EQUAL(40, audio_ring_write_span(&ring, &wspan));
+    TEST_ASSERT_EQUAL_PTR(storage, wspan);
+    audio_ring_write_commit(&ring, 10);
+
+    TEST_ASSERT_EQUAL(24, audio_ring_read_span(&ring, &rspan));
+    TEST_ASSERT_EQUAL_PTR(storage + 40, rspan);
+    audio_ring_read_consume(&ring, 24);
+    TEST_ASSERT_EQUAL(10, audio_ring_read_span(&ring, &rspan));
+    TEST_ASSERT_EQUAL_PTR(storage, rspan);
+    audio_ring_read_consume(&ring, 10);
+    TEST_ASSERT_EQUAL(0, audio_ring_read_span(&ring, &rspan));
+}
+
+static void test_ring_stress_copy(void)
+{
+    ring_stress_run(false);
+}
+
+static void test_ring_stress_mixed_span(void)
+{
+    ring_stress_run(true);
+}
+
+typedef struct {
+    audio_ring_t *ring;
+    uint64_t bytes;
+} ring_bench_t;
+
+static void *ring_bench_consumer(void *arg)
+{
+    ring_bench_t *bench = (ring_bench_t *)arg;
+    uint8_t chunk[RING_BENCH_CHUNK];
+    uint64_t done = 0;
+
+    while (done < bench->bytes)
+    {
+        size_t n = audio_ring_read(bench->ring, chunk, sizeof(chunk));
+        done += n;
+        if (n == 0)
+            sched_yield();
+    }
+    return NULL;
+}
+
+static void bench_ring_throughput(void)
+{
+    static uint8_t storage[RING_BENCH_SIZE];
+    uint8_t chunk[RING_BENCH_CHUNK];
+    audio_ring_t ring;
+    ring_bench_t bench = { .ring = &ring, .bytes = RING_BENCH_BYTES };
+    pthread_t consumer;
+    uint64_t done = 0;
+
+    memset(chunk, 0x5A, sizeof(chunk));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_ring_init(&ring, storage, sizeof(storage)));
+    uint64_t start = host_test_now_ns();
+    TEST_ASSERT_EQUAL(0, pthread_create(&consumer, NULL, ring_bench_consumer, &bench));
+    while (done < bench.bytes)
+    {
+        size_t n = audio_ring_write(&ring, chunk, sizeof(chunk));
+        done += n;
+        if (n == 0)
+            sched_yield();
+    }
+    pthread_join(consumer, NULL);
+    uint64_t elapsed = host_test_now_ns() - start;
+
+    HOST_BENCH("audio_ring 2-thread throughput", "%.0f MB/s (%d B chunks, %d B ring)",
+               (double)RING_BENCH_BYTES * 1000.0 / (double)elapsed, RING_BENCH_CHUNK, RING_BENCH_SIZE);
+}
+
+static void bench_ring_latency(void)
+{
+    static uint8_t storage[RING_BENCH_SIZE];
+    static uint64_t write_ns[RING_BENCH_LATENCY_OPS], read_ns[RING_BENCH_LATENCY_OPS];
+    uint8_t chunk[RING_BENCH_CHUNK];
+    audio_ring_t ring;
+
+    memset(chunk, 0x5A, sizeof(chunk));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_ring_init(&ring, storage, sizeof(storage)));
+    // 单线程交替写读, 测单次调用的耗时分布 (包含一次 clock_gettime 的开销)
+    for (int i = 0; i < RING_BENCH_LATENCY_OPS; i++)
+    {
+        uint64_t t0 = host_test_now_ns();
+        size_t w = audio_ring_write(&ring, chunk, sizeof(chunk));
+        uint64_t t1 = host_test_now_ns();
+        size_t r = audio_ring_read(&ring, chunk, sizeof(chunk));
+        uint64_t t2 = host_test_now_ns();
+        TEST_ASSERT_EQUAL(sizeof(chunk), w);
+        TEST_ASSERT_EQUAL(sizeof(chunk), r);
+        write_ns[i] = t1 - t0;
+        read_ns[i] = t2 - t1;
+    }
+
+    HOST_BENCH("audio_ring write 640 B", "p50 %llu ns, p99 %llu ns",
+               (unsigned long long)host_test_percentile(write_ns, RING_BENCH_LATENCY_OPS, 500),
+               (unsigned long long)host_test_percentile(write_ns, RING_BENCH_LATENCY_OPS, 990));
+    HOST_BENCH("audio_ring read 640 B", "p50 %llu ns, p99 %llu ns",
+               (unsigned long long)host_test_percentile(read_ns, RING_BENCH_LATENCY_OPS, 500),
+               (unsigned long long)host_test_percentile(read_ns, RING_BENCH_LATENCY_OPS, 990));
+}
+
+void test_audio_ring_run(void)
+{
+    RUN_TEST(test_ring_init_rejects_bad_size);
+    RUN_TEST(test_ring_copy_wraps_and_limits);
+    RUN_TEST(test_ring_span_stops_at_wrap);
+    RUN_TEST(test_ring_stress_copy);
+    RUN_TEST(test_ring_stress_mixed_span);
+    RUN_TEST(bench_ring_throughput);
+    RUN_TEST(bench_ring_latency);
+}
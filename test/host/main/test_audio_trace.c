@@ -0,0 +1,230 @@
+#include <stdarg.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "unity.h"
+#include "host_test.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "audio_trace.h"
+
+#define TRACE_STRESS_WRITERS    3
+#define TRACE_STRESS_EVENTS     50000
+#define TRACE_BENCH_CALLS       2000000
+#define TRACE_LOG_CALLS         200000
+#define TRACE_UART_BAUD         115200
+
+static const char *TAG = "TEST_TRACE";
+
+/**
+ * 通过 esp_log_set_vprintf 截获展开后的日志行. 测试事件用 STREAM_PROGRESS,
+ * 两个参数分别是写入者编号和它的序号; TRACE_LOST 行累计丢失数.
+ */
+typedef struct {
+    pthread_mutex_t lock;
+    uint32_t emitted;
+    uint32_t lost;
+    uint32_t out_of_order;
+    uint32_t next[TRACE_STRESS_WRITERS + 1];
+    char last[192];
+} trace_capture_t;
+
+static trace_capture_t trace_capture = { .lock = PTHREAD_MUTEX_INITIALIZER };
+static volatile bool trace_stress_done;
+
+static void trace_capture_reset(void)
+{
+    pthread_mutex_lock(&trace_capture.lock);
+    trace_capture.emitted = 0;
+    trace_capture.lost = 0;
+    trace_capture.out_of_order = 0;
+    memset(trace_capture.next, 0, sizeof(trace_capture.next));
+    trace_capture.last[0] = '\0';
+    pthread_mutex_unlock(&trace_capture.lock);
+}
+
+static int trace_capture_vprintf(const char *format, va_list args)
+{
+    char line[192];
+    unsigned a, b;
+    const char *message;
+    int len = vsnprintf(line, sizeof(line), format, args);
+
+    pthread_mutex_lock(&trace_capture.lock);
+    if (((message = strstr(line, "Successfully sent ")) != NULL) &&
+        (sscanf(message, "Successfully sent %u samples, %u overruns!", &a, &b) == 2) && (a <= TRACE_STRESS_WRITERS))
+    {
+        // 同一写入者的记录按预留顺序展开, 丢失只会跳过序号
+        if (b < trace_capture.next[a])
+            trace_capture.out_of_order++;
+        trace_capture.next[a] = b + 1;
+        trace_capture.emitted++;
+    }
+    else if (((message = strstr(line, "] ")) != NULL) &&
+             (sscanf(message + 2, "%u trace records lost on core %u", &a, &b) == 2))
+    {
+        trace_capture.lost += a;
+    }
+    snprintf(trace_capture.last, sizeof(trace_capture.last), "%s", line);
+    pthread_mutex_unlock(&trace_capture.lock);
+    return len;
+}
+
+// 只做格式化, 不输出: ESP_LOG 在 UART 之前的开销
+static int trace_discard_vprintf(const char *format, va_list args)
+{
+    char line[192];
+    return vsnprintf(line, sizeof(line), format, args);
+}
+
+static void test_audio_trace_format(void)
+{
+    unsigned long ms, us;
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_trace_init());
+    vprintf_like_t previous = esp_log_set_vprintf(trace_capture_vprintf);
+    audio_trace_flush();
+    trace_capture_reset();
+
+    uint32_t event_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    AUDIO_TRACE3(BUTTON_EVENT, 2, 1, 130);
+    usleep(20000);
+    audio_trace_flush();
+    TEST_ASSERT_NOT_NULL(strstr(trace_capture.last, "GPIO_BUTTON"));
+    TEST_ASSERT_NOT_NULL(strstr(trace_capture.last, "Button 2 event 1 detected 130 ms after the first edge."));
+    TEST_ASSERT_NOT_NULL(strstr(trace_capture.last, "I ("));
+
+    // 打印的是事件发生的时间, 不是展开的时间
+    const char *stamp = strchr(trace_capture.last, '[');
+    TEST_ASSERT_NOT_NULL(stamp);
+    TEST_ASSERT_EQUAL(2, sscanf(stamp, "[%lu.%lu]", &ms, &us));
+    TEST_ASSERT_UINT32_WITHIN(1, event_ms, (uint32_t)ms);
+
+    AUDIO_TRACE1(SOCKET_SEND_ERROR, -104);
+    audio_trace_flush();
+    TEST_ASSERT_NOT_NULL(strstr(trace_capture.last, "E ("));
+    TEST_ASSERT_NOT_NULL(strstr(trace_capture.last, "Error occurred during sending: -104"));
+
+    esp_log_set_vprintf(previous);
+}
+
+// 环满时覆盖最旧的记录, 展开时报告丢失数; 展开 + 丢失 = 写入
+static void test_audio_trace_overflow(void)
+{
+    const uint32_t total = AUDIO_TRACE_RING_RECORDS + 100;
+
+    vprintf_like_t previous = esp_log_set_vprintf(trace_capture_vprintf);
+    audio_trace_flush();
+    trace_capture_reset();
+
+    for (uint32_t i = 0; i < total; i++)
+        AUDIO_TRACE2(STREAM_PROGRESS, 0, i);
+    audio_trace_flush();
+    esp_log_set_vprintf(previous);
+
+    // 后台任务可能在写入中途展开过一次, 丢失数只会更少
+    TEST_ASSERT_EQUAL_UINT32(total, trace_capture.emitted + trace_capture.lost);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(AUDIO_TRACE_RING_RECORDS, trace_capture.emitted);
+    TEST_ASSERT_EQUAL_UINT32(0, trace_capture.out_of_order);
+    TEST_ASSERT_EQUAL_UINT32(total, trace_capture.next[0]);
+}
+
+static void *trace_stress_writer(void *arg)
+{
+    uint32_t writer = (uint32_t)(uintptr_t)arg;
+
+    for (uint32_t i = 0; i < TRACE_STRESS_EVENTS; i++)
+    {
+        AUDIO_TRACE2(STREAM_PROGRESS, writer, i);
+        if ((i % 64) == 0)
+            sched_yield();
+    }
+    return NULL;
+}
+
+static void *trace_stress_flusher(void *arg)
+{
+    while (!trace_stress_done)
+    {
+        audio_trace_flush();
+        sched_yield();
+    }
+    return NULL;
+}
+
+// 多个写入者共用一个环 (主机上只有核 0), 同时不断展开: 不能出现重复, 乱序或丢失未报告的记录
+static void test_audio_trace_concurrent(void)
+{
+    pthread_t writers[TRACE_STRESS_WRITERS], flusher;
+
+    vprintf_like_t previous = esp_log_set_vprintf(trace_capture_vprintf);
+    audio_trace_flush();
+    trace_capture_reset();
+
+    trace_stress_done = false;
+    TEST_ASSERT_EQUAL(0, pthread_create(&flusher, NULL, trace_stress_flusher, NULL));
+    for (uint32_t w = 0; w < TRACE_STRESS_WRITERS; w++)
+        TEST_ASSERT_EQUAL(0, pthread_create(&writers[w], NULL, trace_stress_writer, (void *)(uintptr_t)(w + 1)));
+    for (uint32_t w = 0; w < TRACE_STRESS_WRITERS; w++)
+        pthread_join(writers[w], NULL);
+    trace_stress_done = true;
+    pthread_join(flusher, NULL);
+    audio_trace_flush();
+    esp_log_set_vprintf(previous);
+
+    char message[96];
+    snprintf(message, sizeof(message), "emitted %lu, lost %lu", (unsigned long)trace_capture.emitted,
+             (unsigned long)trace_capture.lost);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(TRACE_STRESS_WRITERS * TRACE_STRESS_EVENTS,
+                                     trace_capture.emitted + trace_capture.lost, message);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, trace_capture.out_of_order, message);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, trace_capture.emitted);
+    HOST_BENCH("audio_trace 3 writers + flusher", "%s", message);
+}
+
+/**
+ * 热路径上的单次开销: 二进制记录 vs ESP_LOGI. ESP_LOGI 这里只算格式化 (输出被丢弃),
+ * 设备上还要加上 UART 发送这一行的时间; 跟踪记录的展开在后台任务中进行, 单独计时.
+ */
+static void test_audio_trace_bench(void)
+{
+    char line[192];
+    uint64_t start;
+
+    vprintf_like_t previous = esp_log_set_vprintf(trace_discard_vprintf);
+    audio_trace_flush();
+
+    start = host_test_now_ns();
+    for (uint32_t i = 0; i < TRACE_BENCH_CALLS; i++)
+        AUDIO_TRACE2(STREAM_PROGRESS, i, 0);
+    double trace_ns = (double)(host_test_now_ns() - start) / TRACE_BENCH_CALLS;
+
+    audio_trace_flush();
+    for (uint32_t i = 0; i < AUDIO_TRACE_RING_RECORDS; i++)
+        AUDIO_TRACE2(STREAM_PROGRESS, i, 0);
+    start = host_test_now_ns();
+    audio_trace_flush();
+    double expand_ns = (double)(host_test_now_ns() - start) / AUDIO_TRACE_RING_RECORDS;
+
+    start = host_test_now_ns();
+    for (uint32_t i = 0; i < TRACE_LOG_CALLS; i++)
+        ESP_LOGI(TAG, "Successfully sent %u samples, %u overruns!", (unsigned)i, 0u);
+    double log_ns = (double)(host_test_now_ns() - start) / TRACE_LOG_CALLS;
+    esp_log_set_vprintf(previous);
+
+    // 每字节 10 位 (8N1)
+    int len = snprintf(line, sizeof(line), "I (123456) I2S_AUDIO: Successfully sent 1638400 samples, 0 overruns!\n");
+    double uart_us = len * 10 * 1e6 / TRACE_UART_BAUD;
+    HOST_BENCH("AUDIO_TRACE2", "%.1f ns/call", trace_ns);
+    HOST_BENCH("audio_trace expansion (background)", "%.0f ns/record", expand_ns);
+    HOST_BENCH("ESP_LOGI format only", "%.0f ns/call, %.1fx the trace call", log_ns, log_ns / trace_ns);
+    HOST_BENCH("ESP_LOGI UART at 115200 baud", "%d bytes, %.0f us/line", len, uart_us);
+}
+
+void test_audio_trace_run(void)
+{
+    RUN_TEST(test_audio_trace_format);
+    RUN_TEST(test_audio_trace_overflow);
+    RUN_TEST(test_audio_trace_concurrent);
+    RUN_TEST(test_audio_trace_bench);
+}
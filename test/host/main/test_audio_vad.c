@@ -0,0 +1,293 @@
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include "unity.h"
+#include "host_test.h"
+#include "audio_vad.h"
+
+#define VAD_TEST_RATE           16000
+#define VAD_TEST_BLOCK          1024        // I2S_AUDIO_BUFFER_SAMPLES, 64ms
+#define VAD_TEST_MAX_SAMPLES    (VAD_TEST_RATE * 12)
+#define VAD_TEST_MAX_BURSTS     4
+#define VAD_TEST_ONSET_WINDOW   160         // 数据集模式下用 10ms 窗的能量找真实起点
+
+typedef struct {
+    int start;                              // 样本
+    int length;
+    float amplitude;
+} vad_test_burst_t;
+
+/**
+ * 门控结果, 与 i2s_audio_vad_gate() 的发送规则相同: 语音段内的块发送,
+ * START 时补发最多 preroll_blocks 个之前被门控的块.
+ */
+typedef struct {
+    int blocks;
+    int sent_blocks;
+    int segments;
+    int first_sent[VAD_TEST_MAX_BURSTS * 4]; // 每段第一个发送的样本 (含预录)
+    int start_block[VAD_TEST_MAX_BURSTS * 4];
+    uint64_t process_ns;
+} vad_test_gate_t;
+
+static void vad_test_noise(int16_t *pcm, int samples, float rms, uint32_t seed)
+{
+    float lowpass = 0.0f;
+
+    // 一阶低通的白噪声, 增益按输出 RMS 近似归一
+    for (int i = 0; i < samples; i++)
+    {
+        float white = (float)(int32_t)host_test_rand(&seed) / 2147483648.0f;
+        lowpass += 0.3f * (white - lowpass);
+        pcm[i] = (int16_t)lrintf(lowpass * rms * 4.4f);
+    }
+}
+
+/**
+ * 浊音样的突发: 基频在 110-180Hz 间缓慢变化的 6 次谐波, 10ms 起音, 4Hz 的音节包络.
+ */
+static void vad_test_add_burst(int16_t *pcm, const vad_test_burst_t *burst)
+{
+    float phase = 0.0f;
+
+    for (int i = 0; i < burst->length; i++)
+    {
+        float t = (float)i / VAD_TEST_RATE;
+        float f0 = 145.0f + 35.0f * sinf(2.0f * (float)M_PI * 1.3f * t);
+        phase += 2.0f * (float)M_PI * f0 / VAD_TEST_RATE;
+        float voiced = 0.0f;
+        for (int h = 1; h <= 6; h++)
+            voiced += sinf(phase * h) / h;
+        float attack = (i < VAD_TEST_RATE / 100) ? (float)i / (VAD_TEST_RATE / 100) : 1.0f;
+        float release = (burst->length - i < VAD_TEST_RATE / 100) ? (float)(burst->length - i) / (VAD_TEST_RATE / 100) : 1.0f;
+        float envelope = attack * release * (0.55f + 0.45f * fabsf(sinf(2.0f * (float)M_PI * 4.0f * t + 0.5f)));
+        int32_t value = pcm[burst->start + i] + (int32_t)lrintf(voiced * envelope * burst->amplitude * 0.6f);
+        value = (value > INT16_MAX) ? INT16_MAX : value;
+        value = (value < -INT16_MAX) ? -INT16_MAX : value;
+        pcm[burst->start + i] = (int16_t)value;
+    }
+}
+
+static void vad_test_gate(const int16_t *pcm, int samples, vad_test_gate_t *gate)
+{
+    audio_vad_config_t config;
+    audio_vad_t vad;
+    int gated_run = 0;                      // 连续被门控的块数, 预录最多补发其中 preroll_blocks 个
+
+    audio_vad_default_config(&config);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_vad_init(&vad, &config));
+    memset(gate, 0, sizeof(*gate));
+
+    for (int b = 0; (b + 1) * VAD_TEST_BLOCK <= samples; b++)
+    {
+        uint64_t t0 = host_test_now_ns();
+        audio_vad_event_t event = audio_vad_process(&vad, pcm + b * VAD_TEST_BLOCK, VAD_TEST_BLOCK);
+        gate->process_ns += host_test_now_ns() - t0;
+        gate->blocks++;
+
+        if (event == AUDIO_VAD_EVENT_START)
+        {
+            int preroll = (gated_run < config.preroll_blocks) ? gated_run : config.preroll_blocks;
+            if (gate->segments < (int)(sizeof(gate->first_sent) / sizeof(gate->first_sent[0])))
+            {
+                gate->first_sent[gate->segments] = (b - preroll) * VAD_TEST_BLOCK;
+                gate->start_block[gate->segments] = b;
+            }
+            gate->segments++;
+            gate->sent_blocks += preroll;
+        }
+        if (audio_vad_is_speech(&vad))
+        {
+            gate->sent_blocks++;
+            gated_run = 0;
+        }
+        else
+        {
+            gated_run++;
+        }
+    }
+}
+
+/**
+ * 在噪声中放入几段已知起点的突发, 第一段从 lead 开始, 检查: 每段都检出, 检出的块不晚于起点后 1 块,
+ * 加上预录后第一个发送的样本不晚于真实起点 (起音不被截掉), 静音部分不误触发.
+ */
+static void vad_test_scenario(const char *name, float noise_rms, const float *snr_db, int bursts, int lead)
+{
+    static int16_t pcm[VAD_TEST_MAX_SAMPLES];
+    vad_test_burst_t burst[VAD_TEST_MAX_BURSTS];
+    vad_test_gate_t gate;
+    int position = lead;
+    int speech_samples = 0;
+
+    vad_test_noise(pcm, VAD_TEST_MAX_SAMPLES, noise_rms, 0xA5A5u);
+    for (int i = 0; i < bursts; i++)
+    {
+        burst[i].start = position;
+        burst[i].length = VAD_TEST_RATE * (5 + 3 * i) / 10;
+        burst[i].amplitude = noise_rms * powf(10.0f, snr_db[i] / 20.0f) * 1.41f;
+        vad_test_add_burst(pcm, &burst[i]);
+        speech_samples += burst[i].length;
+        position += burst[i].length + VAD_TEST_RATE * 2 + 517;
+    }
+    TEST_ASSERT_LESS_OR_EQUAL(VAD_TEST_MAX_SAMPLES, position);
+
+    vad_test_gate(pcm, VAD_TEST_MAX_SAMPLES, &gate);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(bursts, gate.segments, name);
+
+    int worst_latency = 0;
+    for (int i = 0; i < bursts; i++)
+    {
+        int onset_block = burst[i].start / VAD_TEST_BLOCK;
+        int latency = gate.start_block[i] - onset_block;
+        worst_latency = (latency > worst_latency) ? latency : worst_latency;
+        TEST_ASSERT_GREATER_OR_EQUAL_MESSAGE(0, latency, name);
+        TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(1, latency, name);
+        TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(burst[i].start, gate.first_sent[i], name);
+    }
+
+    char label[48];
+    snprintf(label, sizeof(label), "audio_vad gate %s", name);
+    HOST_BENCH(label, "sent %d / %d blocks (%.0f%%, speech %.0f%%), onset latency <= %d blocks, no clipping",
+               gate.sent_blocks, gate.blocks, 100.0 * gate.sent_blocks / gate.blocks,
+               100.0 * speech_samples / (gate.blocks * VAD_TEST_BLOCK), worst_latency);
+}
+
+static void test_vad_quiet_room(void)
+{
+    const float snr_db[] = { 30.0f, 20.0f, 25.0f };
+    vad_test_scenario("quiet room", 20.0f, snr_db, 3, 2 * VAD_TEST_RATE + 333);
+}
+
+static void test_vad_noisy_room(void)
+{
+    const float snr_db[] = { 15.0f, 10.0f, 12.0f };
+    vad_test_scenario("noisy room", 200.0f, snr_db, 3, 2 * VAD_TEST_RATE + 333);
+}
+
+/**
+ * 门控流从按键开始, 用户往往已经在说话: 第一块就是语音, 噪声底还不知道.
+ * 第一段必须从第 0 块开门, 后面的段照常检出.
+ */
+static void test_vad_starts_with_speech(void)
+{
+    const float quiet_snr_db[] = { 25.0f, 20.0f, 30.0f };
+    const float noisy_snr_db[] = { 15.0f, 10.0f, 12.0f };
+    vad_test_scenario("speech first, quiet", 20.0f, quiet_snr_db, 3, 0);
+    vad_test_scenario("speech first, noisy", 200.0f, noisy_snr_db, 3, 0);
+}
+
+static void test_vad_noise_only_stays_closed(void)
+{
+    static int16_t pcm[VAD_TEST_MAX_SAMPLES];
+    vad_test_gate_t gate;
+    const float levels[] = { 10.0f, 100.0f, 1000.0f };
+
+    for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++)
+    {
+        vad_test_noise(pcm, VAD_TEST_MAX_SAMPLES, levels[i], 0x1234u + (uint32_t)i);
+        vad_test_gate(pcm, VAD_TEST_MAX_SAMPLES, &gate);
+        TEST_ASSERT_EQUAL(0, gate.segments);
+        TEST_ASSERT_EQUAL(0, gate.sent_blocks);
+    }
+}
+
+static void bench_vad_process(void)
+{
+    static int16_t pcm[VAD_TEST_MAX_SAMPLES];
+    vad_test_gate_t gate;
+
+    vad_test_noise(pcm, VAD_TEST_MAX_SAMPLES, 300.0f, 0x77u);
+    vad_test_gate(pcm, VAD_TEST_MAX_SAMPLES, &gate);
+    HOST_BENCH("audio_vad_process 1024 samples", "%.2f us/block", (double)gate.process_ns / 1000.0 / gate.blocks);
+}
+
+/**
+ * 数据集模式: 设置 AUDIO_VAD_DATA_DIR 为 PCM16/16kHz 的片段目录 (例如 p0_audio_collect.py
+ * 采集的 data/0_raw_collection/01_keyword), 每个片段前补 1s 静音后过门控,
+ * 真实起点取第一个能量超过片段最大 10ms 能量 -20dB 的窗口. 只打印统计, 不作为通过条件.
+ */
+static void test_vad_dataset(void)
+{
+    const char *dir_path = getenv("AUDIO_VAD_DATA_DIR");
+    static int16_t pcm[VAD_TEST_MAX_SAMPLES];
+    int files = 0, detected = 0, clipped = 0, sent = 0, blocks = 0;
+    int clipped_ms_max = 0;
+
+    if (dir_path == NULL)
+    {
+        TEST_MESSAGE("AUDIO_VAD_DATA_DIR not set, dataset pass skipped");
+        return;
+    }
+    DIR *dir = opendir(dir_path);
+    TEST_ASSERT_NOT_NULL(dir);
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        const char *ext = strrchr(entry->d_name, '.');
+        if ((ext == NULL) || ((strcmp(ext, ".pcm") != 0) && (strcmp(ext, ".bin") != 0)))
+            continue;
+
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", dir_path, entry->d_name);
+        FILE *f = fopen(path, "rb");
+        if (f == NULL)
+            continue;
+        memset(pcm, 0, VAD_TEST_RATE * sizeof(int16_t));
+        int samples = VAD_TEST_RATE + (int)fread(pcm + VAD_TEST_RATE, sizeof(int16_t),
+                                                 VAD_TEST_MAX_SAMPLES - VAD_TEST_RATE, f);
+        fclose(f);
+
+        uint64_t peak = 0;
+        for (int w = VAD_TEST_RATE; w + VAD_TEST_ONSET_WINDOW <= samples; w += VAD_TEST_ONSET_WINDOW)
+        {
+            uint64_t energy = 0;
+            for (int i = 0; i < VAD_TEST_ONSET_WINDOW; i++)
+                energy += (int64_t)pcm[w + i] * pcm[w + i];
+            peak = (energy > peak) ? energy : peak;
+        }
+        int onset = -1;
+        for (int w = VAD_TEST_RATE; (onset < 0) && (w + VAD_TEST_ONSET_WINDOW <= samples); w += VAD_TEST_ONSET_WINDOW)
+        {
+            uint64_t energy = 0;
+            for (int i = 0; i < VAD_TEST_ONSET_WINDOW; i++)
+                energy += (int64_t)pcm[w + i] * pcm[w + i];
+            if (energy * 100 >= peak)
+                onset = w;
+        }
+        if (onset < 0)
+            continue;
+
+        vad_test_gate_t gate;
+        vad_test_gate(pcm, samples, &gate);
+        files++;
+        blocks += gate.blocks;
+        sent += gate.sent_blocks;
+        if (gate.segments == 0)
+            continue;
+        detected++;
+        if (gate.first_sent[0] > onset)
+        {
+            int ms = (gate.first_sent[0] - onset) * 1000 / VAD_TEST_RATE;
+            clipped++;
+            clipped_ms_max = (ms > clipped_ms_max) ? ms : clipped_ms_max;
+        }
+    }
+    closedir(dir);
+
+    HOST_BENCH("audio_vad dataset", "%d files, %d detected, %d clipped (max %d ms), sent %d / %d blocks",
+               files, detected, clipped, clipped_ms_max, sent, blocks);
+}
+
+void test_audio_vad_run(void)
+{
+    RUN_TEST(test_vad_quiet_room);
+    RUN_TEST(test_vad_noisy_room);
+    RUN_TEST(test_vad_starts_with_speech);
+    RUN_TEST(test_vad_noise_only_stays_closed);
+    RUN_TEST(bench_vad_process);
+    RUN_TEST(test_vad_dataset);
+}
@@ -0,0 +1,287 @@
+#include <string.h>
+#include "unity.h"
+#include "host_test.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "host_sim.h"
+#include "gpio_button.h"
+
+// 判定在定时器到期后的下一个 tick 执行, 主机上再加上线程调度的抖动
+#define GESTURE_SLACK_MS        (2 * portTICK_PERIOD_MS + 20)
+#define GESTURE_CLICK_MS        80
+#define GESTURE_IDLE_MS         (DOUBLE_CLICK_TIME_MS + 2 * DEBOUNCE_TIME_MS + GESTURE_SLACK_MS)
+#define GESTURE_LONG_JOB_MS     1500
+#define GESTURE_SHORT_JOB_MS    500
+#define GESTURE_BUSY_PRESSES    8
+
+/**
+ * 按键 0 挂长动作 (模拟按键录音), 按键 1/2 挂记录时间的短动作. 边沿由 host_sim_button_set
+ * 在测试任务中产生, 与固件中的中断一样进入 gpio_button 的队列.
+ */
+typedef struct {
+    volatile int count[GPIO_BUTTON_NUM][BUTTON_EVENT_MAX];
+    volatile int64_t start_us[GPIO_BUTTON_NUM];
+    volatile int cancelled;
+} gesture_log_t;
+
+static gesture_log_t gesture_log;
+
+static int gesture_index(uint8_t gpio_num)
+{
+    return (gpio_num == GPIO_BUTTON_0) ? 0 : (gpio_num == GPIO_BUTTON_1) ? 1 : 2;
+}
+
+static void gesture_record(uint8_t gpio_num, button_event_type_t event)
+{
+    int index = gesture_index(gpio_num);
+
+    gesture_log.start_us[index] = esp_timer_get_time();
+    gesture_log.count[index][event]++;
+}
+
+static void gesture_on_press(uint8_t gpio_num)
+{
+    gesture_record(gpio_num, BUTTON_EVENT_PRESS);
+}
+
+static void gesture_on_long_press(uint8_t gpio_num)
+{
+    gesture_record(gpio_num, BUTTON_EVENT_LONG_PRESS);
+}
+
+static void gesture_on_double_click(uint8_t gpio_num)
+{
+    gesture_record(gpio_num, BUTTON_EVENT_DOUBLE_CLICK);
+}
+
+static void gesture_job(uint8_t gpio_num, uint32_t duration_ms)
+{
+    gesture_record(gpio_num, BUTTON_EVENT_PRESS);
+    for (uint32_t ms = 0; ms < duration_ms; ms += 10)
+    {
+        if (gpio_button_action_cancelled(gpio_num))
+        {
+            gesture_log.cancelled++;
+            return;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+
+static void gesture_long_job(uint8_t gpio_num)
+{
+    gesture_job(gpio_num, GESTURE_LONG_JOB_MS);
+}
+
+static void gesture_short_job(uint8_t gpio_num)
+{
+    gesture_job(gpio_num, GESTURE_SHORT_JOB_MS);
+}
+
+// 第一次调用时启动按键任务; 之后每个用例清空所有动作, 只挂自己需要的
+static void gesture_setup(void)
+{
+    static bool started = false;
+
+    if (!started)
+    {
+        TEST_ASSERT_EQUAL(ESP_OK, gpio_button_init());
+        TEST_ASSERT_EQUAL(ESP_OK, gpio_button_start());
+        started = true;
+    }
+    for (int i = 0; i < GPIO_BUTTON_NUM; i++)
+    {
+        for (int e = 0; e < BUTTON_EVENT_MAX; e++)
+            gpio_button_set_action(i, (button_event_type_t)e, NULL, BUTTON_ACTION_COALESCE);
+    }
+    memset((void *)&gesture_log, 0, sizeof(gesture_log));
+}
+
+// 返回按下沿的时间
+static int64_t gesture_click(int button, uint32_t hold_ms)
+{
+    int64_t edge_us = esp_timer_get_time();
+
+    TEST_ASSERT_EQUAL(ESP_OK, host_sim_button_set(button, true));
+    vTaskDelay(pdMS_TO_TICKS(hold_ms));
+    host_sim_button_set(button, false);
+    return edge_us;
+}
+
+static bool gesture_wait(int button, button_event_type_t event, int count, uint32_t timeout_ms)
+{
+    int64_t deadline_us = esp_timer_get_time() + (int64_t)timeout_ms * 1000;
+
+    while (gesture_log.count[button][event] < count)
+    {
+        if (esp_timer_get_time() > deadline_us)
+            return false;
+        vTaskDelay(1);
+    }
+    return true;
+}
+
+static uint32_t gesture_latency_ms(int button, int64_t edge_us)
+{
+    return (uint32_t)((gesture_log.start_us[button] - edge_us) / 1000);
+}
+
+// 不早于定时, 也不晚于一个调度余量
+static void gesture_assert_latency(uint32_t expected_ms, uint32_t actual_ms)
+{
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(expected_ms, actual_ms);
+    TEST_ASSERT_LESS_THAN_UINT32(expected_ms + GESTURE_SLACK_MS, actual_ms);
+}
+
+// 只挂了单击: 稳定 DEBOUNCE_TIME_MS 后触发, 不等松开; 抖动推迟判定, 毛刺不触发
+static void test_gpio_button_press(void)
+{
+    gesture_setup();
+    gpio_button_set_action(1, BUTTON_EVENT_PRESS, gesture_on_press, BUTTON_ACTION_COALESCE);
+
+    int64_t edge_us = esp_timer_get_time();
+    host_sim_button_set(1, true);
+    TEST_ASSERT_TRUE(gesture_wait(1, BUTTON_EVENT_PRESS, 1, 500));
+    gesture_assert_latency(DEBOUNCE_TIME_MS, gesture_latency_ms(1, edge_us));
+    host_sim_button_set(1, false);
+    vTaskDelay(pdMS_TO_TICKS(GESTURE_IDLE_MS));
+
+    // 抖动 3 次, 每次 5ms: 从最后一个边沿重新计时
+    edge_us = esp_timer_get_time();
+    for (int i = 0; i < 3; i++)
+    {
+        host_sim_button_set(1, true);
+        vTaskDelay(pdMS_TO_TICKS(5));
+        host_sim_button_set(1, false);
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+    int64_t settle_us = esp_timer_get_time();
+    host_sim_button_set(1, true);
+    TEST_ASSERT_TRUE(gesture_wait(1, BUTTON_EVENT_PRESS, 2, 500));
+    gesture_assert_latency(DEBOUNCE_TIME_MS, gesture_latency_ms(1, settle_us));
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(DEBOUNCE_TIME_MS + 30, gesture_latency_ms(1, edge_us));
+    host_sim_button_set(1, false);
+    vTaskDelay(pdMS_TO_TICKS(GESTURE_IDLE_MS));
+
+    // 短于去抖时间的毛刺
+    gesture_click(1, DEBOUNCE_TIME_MS / 3);
+    vTaskDelay(pdMS_TO_TICKS(GESTURE_IDLE_MS));
+    TEST_ASSERT_EQUAL_INT(2, gesture_log.count[1][BUTTON_EVENT_PRESS]);
+}
+
+// 挂了长按和双击: 单击要等双击窗口结束, 长按在按住期间触发, 双击在第二次按下确认时触发
+static void test_gpio_button_gestures(void)
+{
+    gesture_setup();
+    gpio_button_set_action(2, BUTTON_EVENT_PRESS, gesture_on_press, BUTTON_ACTION_COALESCE);
+    gpio_button_set_action(2, BUTTON_EVENT_LONG_PRESS, gesture_on_long_press, BUTTON_ACTION_COALESCE);
+    gpio_button_set_action(2, BUTTON_EVENT_DOUBLE_CLICK, gesture_on_double_click, BUTTON_ACTION_COALESCE);
+
+    host_sim_button_set(2, true);
+    vTaskDelay(pdMS_TO_TICKS(GESTURE_CLICK_MS));
+    int64_t release_us = esp_timer_get_time();
+    host_sim_button_set(2, false);
+    TEST_ASSERT_TRUE(gesture_wait(2, BUTTON_EVENT_PRESS, 1, 1000));
+    uint32_t press_ms = gesture_latency_ms(2, release_us);
+    gesture_assert_latency(DEBOUNCE_TIME_MS + DOUBLE_CLICK_TIME_MS, press_ms);
+    vTaskDelay(pdMS_TO_TICKS(GESTURE_IDLE_MS));
+
+    int64_t edge_us = esp_timer_get_time();
+    host_sim_button_set(2, true);
+    TEST_ASSERT_TRUE(gesture_wait(2, BUTTON_EVENT_LONG_PRESS, 1, 2000));
+    uint32_t long_ms = gesture_latency_ms(2, edge_us);
+    gesture_assert_latency(LONG_PRESS_TIME_MS, long_ms);
+    vTaskDelay(pdMS_TO_TICKS(200));
+    host_sim_button_set(2, false);
+    vTaskDelay(pdMS_TO_TICKS(GESTURE_IDLE_MS));
+
+    gesture_click(2, GESTURE_CLICK_MS);
+    vTaskDelay(pdMS_TO_TICKS(DOUBLE_CLICK_TIME_MS / 3));
+    edge_us = gesture_click(2, GESTURE_CLICK_MS);
+    TEST_ASSERT_TRUE(gesture_wait(2, BUTTON_EVENT_DOUBLE_CLICK, 1, 1000));
+    uint32_t double_ms = gesture_latency_ms(2, edge_us);
+    gesture_assert_latency(DEBOUNCE_TIME_MS, double_ms);
+    vTaskDelay(pdMS_TO_TICKS(GESTURE_IDLE_MS));
+
+    // 每个手势只触发自己的事件, 长按和双击之后不再补发单击
+    TEST_ASSERT_EQUAL_INT(1, gesture_log.count[2][BUTTON_EVENT_PRESS]);
+    TEST_ASSERT_EQUAL_INT(1, gesture_log.count[2][BUTTON_EVENT_LONG_PRESS]);
+    TEST_ASSERT_EQUAL_INT(1, gesture_log.count[2][BUTTON_EVENT_DOUBLE_CLICK]);
+    HOST_BENCH("gpio_button click (after release)", "%lu ms", (unsigned long)press_ms);
+    HOST_BENCH("gpio_button long press", "%lu ms", (unsigned long)long_ms);
+    HOST_BENCH("gpio_button double click", "%lu ms after the second edge", (unsigned long)double_ms);
+}
+
+/**
+ * 按键 0 的长动作执行期间, 按键 1 的动作延迟不受影响 (动作在执行任务中运行, 按键任务不阻塞);
+ * 再按按键 0 (BUTTON_ACTION_RESTART) 取消当前动作, 新动作在取消轮询后开始.
+ */
+static void test_gpio_button_busy_latency(void)
+{
+    uint64_t latency_us[GESTURE_BUSY_PRESSES];
+
+    gesture_setup();
+    gpio_button_set_action(0, BUTTON_EVENT_PRESS, gesture_long_job, BUTTON_ACTION_RESTART);
+    gpio_button_set_action(1, BUTTON_EVENT_PRESS, gesture_on_press, BUTTON_ACTION_COALESCE);
+
+    gesture_click(0, GESTURE_CLICK_MS);
+    TEST_ASSERT_TRUE(gesture_wait(0, BUTTON_EVENT_PRESS, 1, 500));
+    for (int i = 0; i < GESTURE_BUSY_PRESSES; i++)
+    {
+        // 松开后等过去抖, 否则下一次按下会被当作松开时的抖动
+        int64_t edge_us = gesture_click(1, DEBOUNCE_TIME_MS + 20);
+        TEST_ASSERT_TRUE(gesture_wait(1, BUTTON_EVENT_PRESS, i + 1, 500));
+        latency_us[i] = (uint64_t)(gesture_log.start_us[1] - edge_us);
+        vTaskDelay(pdMS_TO_TICKS(DEBOUNCE_TIME_MS + GESTURE_SLACK_MS));
+    }
+    // 全部发生在长动作期间
+    TEST_ASSERT_EQUAL_INT(1, gesture_log.count[0][BUTTON_EVENT_PRESS]);
+    TEST_ASSERT_EQUAL_INT(0, gesture_log.cancelled);
+
+    int64_t edge_us = gesture_click(0, GESTURE_CLICK_MS);
+    TEST_ASSERT_TRUE(gesture_wait(0, BUTTON_EVENT_PRESS, 2, 500));
+    uint32_t restart_ms = gesture_latency_ms(0, edge_us);
+    TEST_ASSERT_EQUAL_INT(1, gesture_log.cancelled);
+    // 取消要等动作下一次轮询 (10ms)
+    gesture_assert_latency(DEBOUNCE_TIME_MS, restart_ms);
+    TEST_ASSERT_LESS_THAN_UINT32(DEBOUNCE_TIME_MS + 10 + GESTURE_SLACK_MS, restart_ms);
+    vTaskDelay(pdMS_TO_TICKS(GESTURE_LONG_JOB_MS + GESTURE_SLACK_MS));
+
+    uint64_t max_us = host_test_percentile(latency_us, GESTURE_BUSY_PRESSES, 1000);
+    uint64_t p50_us = host_test_percentile(latency_us, GESTURE_BUSY_PRESSES, 500);
+    gesture_assert_latency(DEBOUNCE_TIME_MS, (uint32_t)(max_us / 1000));
+    HOST_BENCH("gpio_button press->action, busy", "p50 %.1f ms, max %.1f ms (%d presses during a %d ms job)",
+               p50_us / 1000.0, max_us / 1000.0, GESTURE_BUSY_PRESSES, GESTURE_LONG_JOB_MS);
+    HOST_BENCH("gpio_button restart (cancel+start)", "%lu ms", (unsigned long)restart_ms);
+}
+
+// BUTTON_ACTION_COALESCE: 动作执行期间同一事件的按键被丢弃, 不会在结束后连续补执行
+static void test_gpio_button_coalesce(void)
+{
+    gesture_setup();
+    gpio_button_set_action(1, BUTTON_EVENT_PRESS, gesture_short_job, BUTTON_ACTION_COALESCE);
+
+    // 4 次按下都在第一次的动作期间被确认
+    for (int i = 0; i < 4; i++)
+    {
+        gesture_click(1, DEBOUNCE_TIME_MS + 20);
+        vTaskDelay(pdMS_TO_TICKS(DEBOUNCE_TIME_MS + GESTURE_SLACK_MS));
+    }
+    vTaskDelay(pdMS_TO_TICKS(GESTURE_SHORT_JOB_MS));
+    TEST_ASSERT_EQUAL_INT(1, gesture_log.count[1][BUTTON_EVENT_PRESS]);
+    TEST_ASSERT_EQUAL_INT(0, gesture_log.cancelled);
+
+    // 动作结束后再按照常执行
+    gesture_click(1, GESTURE_CLICK_MS);
+    TEST_ASSERT_TRUE(gesture_wait(1, BUTTON_EVENT_PRESS, 2, 500));
+    vTaskDelay(pdMS_TO_TICKS(GESTURE_SHORT_JOB_MS + GESTURE_SLACK_MS));
+}
+
+void test_gpio_button_run(void)
+{
+    RUN_TEST(test_gpio_button_press);
+    RUN_TEST(test_gpio_button_gestures);
+    RUN_TEST(test_gpio_button_busy_latency);
+    RUN_TEST(test_gpio_button_coalesce);
+}
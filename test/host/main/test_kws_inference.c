@@ -0,0 +1,278 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "host_test.h"
+#include "kws_inference.h"
+
+#define KWS_TEST_BLOB_SIZE      (64 * 1024)
+#define KWS_BENCH_RUNS          50
+
+/**
+ * 在内存中拼装模型: 先占好文件头和层描述的位置, 权重和偏置依次追加在后面.
+ */
+typedef struct {
+    uint8_t *blob;
+    size_t size;
+    int layers;
+} kws_test_builder_t;
+
+static void kws_test_begin(kws_test_builder_t *b, int layers, uint16_t h, uint16_t w, uint16_t c)
+{
+    kws_model_header_t header = {
+        .magic = KWS_MODEL_MAGIC, .version = KWS_MODEL_VERSION, .layer_count = (uint16_t)layers,
+        .input_h = h, .input_w = w, .input_c = c, .input_scale = 1.0f / 32, .input_zero_point = 0,
+    };
+
+    b->blob = calloc(1, KWS_TEST_BLOB_SIZE);
+    TEST_ASSERT_NOT_NULL(b->blob);
+    memcpy(b->blob, &header, sizeof(header));
+    b->size = sizeof(header) + layers * sizeof(kws_layer_desc_t);
+    b->layers = 0;
+}
+
+static uint32_t kws_test_append(kws_test_builder_t *b, const void *data, size_t len)
+{
+    b->size = (b->size + 3) & ~(size_t)3;
+    TEST_ASSERT_LESS_OR_EQUAL(KWS_TEST_BLOB_SIZE, b->size + len);
+    memcpy(b->blob + b->size, data, len);
+    b->size += len;
+    return (uint32_t)(b->size - len);
+}
+
+static void kws_test_layer(kws_test_builder_t *b, kws_layer_desc_t *desc, const int8_t *weights, size_t weight_count,
+                           const int32_t *bias, size_t bias_count)
+{
+    if (weights)
+        desc->weights_offset = kws_test_append(b, weights, weight_count);
+    if (bias)
+        desc->bias_offset = kws_test_append(b, bias, bias_count * sizeof(int32_t));
+    memcpy(b->blob + sizeof(kws_model_header_t) + b->layers * sizeof(kws_layer_desc_t), desc, sizeof(*desc));
+    b->layers++;
+}
+
+// 随机权重 (|w| <= 15) 的 conv 类层, 乘数按输入扇入缩放, 让激活保持在 int8 的中段
+static void kws_test_random_layer(kws_test_builder_t *b, kws_layer_desc_t *desc, size_t weight_count, int fan_in,
+                                  uint32_t *seed)
+{
+    int8_t *weights = malloc(weight_count);
+    int32_t bias[64];
+
+    TEST_ASSERT_NOT_NULL(weights);
+    for (size_t i = 0; i < weight_count; i++)
+        weights[i] = (int8_t)((int)(host_test_rand(seed) % 31) - 15);
+    for (int i = 0; i < desc->out_c; i++)
+        bias[i] = (int32_t)(host_test_rand(seed) % 256) - 128;
+    desc->multiplier = (int32_t)((1u << 31) / (uint32_t)(fan_in * 8));
+    desc->shift = 0;
+    kws_test_layer(b, desc, weights, weight_count, bias, desc->out_c);
+    free(weights);
+}
+
+/**
+ * DS-CNN 结构的基准模型, 输入 121x40x1 (mfcc_feature 的窗口):
+ * conv 10x4/(3,2) x24 → 2 组 (dw 3x3 + pw 1x1) → 全局平均池化 → dense 4 → softmax.
+ */
+static void kws_test_build_dscnn(kws_test_builder_t *b, size_t *macs)
+{
+    const int channels = 24;
+    uint32_t seed = 0xC0DEu;
+    kws_layer_desc_t d;
+
+    kws_test_begin(b, 8, 121, 40, 1);
+    memset(&d, 0, sizeof(d));
+    d.type = KWS_LAYER_CONV2D;
+    d.activation = KWS_ACTIVATION_RELU;
+    d.kernel_h = 10, d.kernel_w = 4, d.stride_h = 3, d.stride_w = 2;
+    d.out_h = 38, d.out_w = 19, d.out_c = channels;
+    kws_test_random_layer(b, &d, (size_t)channels * 10 * 4, 10 * 4, &seed);
+    *macs = (size_t)38 * 19 * channels * 10 * 4;
+
+    for (int block = 0; block < 2; block++)
+    {
+        memset(&d, 0, sizeof(d));
+        d.type = KWS_LAYER_DEPTHWISE_CONV2D;
+        d.activation = KWS_ACTIVATION_RELU;
+        d.kernel_h = 3, d.kernel_w = 3, d.stride_h = 1, d.stride_w = 1, d.pad_top = 1, d.pad_left = 1;
+        d.out_h = 38, d.out_w = 19, d.out_c = channels;
+        kws_test_random_layer(b, &d, (size_t)9 * channels, 9, &seed);
+
+        memset(&d, 0, sizeof(d));
+        d.type = KWS_LAYER_CONV2D;
+        d.activation = KWS_ACTIVATION_RELU;
+        d.kernel_h = 1, d.kernel_w = 1, d.stride_h = 1, d.stride_w = 1;
+        d.out_h = 38, d.out_w = 19, d.out_c = channels;
+        kws_test_random_layer(b, &d, (size_t)channels * channels, channels, &seed);
+        *macs += (size_t)38 * 19 * channels * (9 + channels);
+    }
+
+    memset(&d, 0, sizeof(d));
+    d.type = KWS_LAYER_AVG_POOL2D;
+    kws_test_layer(b, &d, NULL, 0, NULL, 0);
+
+    memset(&d, 0, sizeof(d));
+    d.type = KWS_LAYER_DENSE;
+    d.out_c = 4;
+    kws_test_random_layer(b, &d, (size_t)4 * channels, channels, &seed);
+
+    memset(&d, 0, sizeof(d));
+    d.type = KWS_LAYER_SOFTMAX;
+    d.input_scale = 1.0f / 16;
+    kws_test_layer(b, &d, NULL, 0, NULL, 0);
+}
+
+/**
+ * 2x2 输入的小模型, 每层的结果可以手算. 只保留前 layers 层, 这样每一层的输出都是模型输出
+ * (中间层的激活会被后面的层覆盖).
+ */
+static void kws_test_known_model(int layers, const int8_t **out, size_t *size)
+{
+    static const int8_t conv_w[] = { 2 };
+    static const int32_t conv_b[] = { 1 };
+    static const int8_t dense_w[] = { 1, -1 };
+    static const int8_t input_values[] = { 10, -3, 0, 7 };
+    static kws_model_t model;
+    kws_test_builder_t b;
+    kws_layer_desc_t d[4];
+
+    memset(d, 0, sizeof(d));
+    // conv 1x1: (2x + 1) * 0.5, 四舍五入
+    d[0].type = KWS_LAYER_CONV2D;
+    d[0].kernel_h = 1, d[0].kernel_w = 1, d[0].stride_h = 1, d[0].stride_w = 1;
+    d[0].out_h = 2, d[0].out_w = 2, d[0].out_c = 1;
+    d[0].multiplier = 1 << 30;
+    // 平均池化
+    d[1].type = KWS_LAYER_AVG_POOL2D;
+    // dense: [x, -x], 乘数 0.5 左移 1 位等于 1
+    d[2].type = KWS_LAYER_DENSE;
+    d[2].out_c = 2;
+    d[2].multiplier = 1 << 30;
+    d[2].shift = 1;
+    d[3].type = KWS_LAYER_SOFTMAX;
+    d[3].input_scale = 1.0f;
+
+    kws_test_begin(&b, layers, 2, 2, 1);
+    kws_test_layer(&b, &d[0], conv_w, 1, conv_b, 1);
+    if (layers > 1)
+        kws_test_layer(&b, &d[1], NULL, 0, NULL, 0);
+    if (layers > 2)
+        kws_test_layer(&b, &d[2], dense_w, 2, NULL, 0);
+    if (layers > 3)
+        kws_test_layer(&b, &d[3], NULL, 0, NULL, 0);
+
+    TEST_ASSERT_EQUAL(ESP_OK, kws_inference_load(&model, b.blob, b.size));
+    int8_t *input = kws_inference_input(&model, size);
+    TEST_ASSERT_EQUAL(4, *size);
+    memcpy(input, input_values, sizeof(input_values));
+    TEST_ASSERT_EQUAL(ESP_OK, kws_inference_invoke(&model));
+    *out = kws_inference_output(&model, size);
+    free(b.blob);
+}
+
+static void test_kws_known_answer(void)
+{
+    const int8_t *out;
+    size_t size;
+
+    kws_test_known_model(1, &out, &size);
+    TEST_ASSERT_EQUAL(4, size);
+    TEST_ASSERT_EQUAL_INT8(11, out[0]);
+    TEST_ASSERT_EQUAL_INT8(-2, out[1]);
+    TEST_ASSERT_EQUAL_INT8(1, out[2]);
+    TEST_ASSERT_EQUAL_INT8(8, out[3]);
+
+    // (11 - 2 + 1 + 8) / 4 = 4.5 → 5
+    kws_test_known_model(2, &out, &size);
+    TEST_ASSERT_EQUAL(1, size);
+    TEST_ASSERT_EQUAL_INT8(5, out[0]);
+
+    kws_test_known_model(3, &out, &size);
+    TEST_ASSERT_EQUAL(2, size);
+    TEST_ASSERT_EQUAL_INT8(5, out[0]);
+    TEST_ASSERT_EQUAL_INT8(-5, out[1]);
+
+    // softmax(5, -5): 第一类概率 1 - 4.5e-5, 量化后饱和到 127
+    kws_test_known_model(4, &out, &size);
+    TEST_ASSERT_EQUAL(2, size);
+    TEST_ASSERT_EQUAL_INT8(127, out[0]);
+    TEST_ASSERT_EQUAL_INT8(-128, out[1]);
+}
+
+static void test_kws_rejects_bad_blob(void)
+{
+    kws_test_builder_t b;
+    kws_model_t model;
+    size_t macs;
+
+    kws_test_build_dscnn(&b, &macs);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, kws_inference_load(&model, b.blob, b.size - 1));
+    ((kws_model_header_t *)b.blob)->magic ^= 1;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_VERSION, kws_inference_load(&model, b.blob, b.size));
+    free(b.blob);
+}
+
+// 相邻层的输入和输出分在 arena 两端, 不能重叠
+static void test_kws_arena_plan(void)
+{
+    kws_test_builder_t b;
+    kws_model_t model;
+    size_t macs;
+
+    kws_test_build_dscnn(&b, &macs);
+    TEST_ASSERT_EQUAL(ESP_OK, kws_inference_load(&model, b.blob, b.size));
+    for (int i = 0; i < model.layer_count; i++)
+    {
+        const kws_layer_t *layer = &model.layers[i];
+        size_t in_size = (size_t)layer->in_h * layer->in_w * layer->in_c;
+        size_t out_size = (size_t)layer->desc.out_h * layer->desc.out_w * layer->desc.out_c;
+        bool disjoint = (layer->input + in_size <= layer->output) || (layer->output + out_size <= layer->input);
+        TEST_ASSERT_TRUE_MESSAGE(disjoint, "layer input and output overlap");
+        TEST_ASSERT_LESS_OR_EQUAL(kws_inference_arena_used(&model), in_size + out_size);
+    }
+    free(b.blob);
+}
+
+static void bench_kws_dscnn(void)
+{
+    static uint64_t runs_ns[KWS_BENCH_RUNS];
+    static float features[121 * 40];
+    kws_test_builder_t b;
+    kws_model_t model;
+    size_t macs;
+    uint32_t seed = 0x5EEDu;
+
+    kws_test_build_dscnn(&b, &macs);
+    TEST_ASSERT_EQUAL(ESP_OK, kws_inference_load(&model, b.blob, b.size));
+    for (int i = 0; i < 121 * 40; i++)
+        features[i] = (float)((int)(host_test_rand(&seed) % 200) - 100) / 50.0f;
+    TEST_ASSERT_EQUAL(ESP_OK, kws_inference_quantize_input(&model, features, 121 * 40));
+
+    for (int r = 0; r < KWS_BENCH_RUNS; r++)
+    {
+        uint64_t t0 = host_test_now_ns();
+        TEST_ASSERT_EQUAL(ESP_OK, kws_inference_invoke(&model));
+        runs_ns[r] = host_test_now_ns() - t0;
+    }
+
+    // softmax 输出 (scale 1/256, 零点 -128) 之和约为 1
+    size_t classes;
+    const int8_t *out = kws_inference_output(&model, &classes);
+    int sum = 0;
+    for (size_t i = 0; i < classes; i++)
+        sum += out[i] + 128;
+    TEST_ASSERT_INT_WITHIN(4, 256, sum);
+
+    HOST_BENCH("kws_inference DS-CNN 121x40", "p50 %.0f us, p99 %.0f us, %.2f MMAC, arena %u / %u bytes, blob %u bytes",
+               host_test_percentile(runs_ns, KWS_BENCH_RUNS, 500) / 1000.0,
+               host_test_percentile(runs_ns, KWS_BENCH_RUNS, 990) / 1000.0, macs / 1e6,
+               (unsigned)kws_inference_arena_used(&model), (unsigned)KWS_INFERENCE_ARENA_SIZE, (unsigned)b.size);
+    free(b.blob);
+}
+
+void test_kws_inference_run(void)
+{
+    RUN_TEST(test_kws_known_answer);
+    RUN_TEST(test_kws_rejects_bad_blob);
+    RUN_TEST(test_kws_arena_plan);
+    RUN_TEST(bench_kws_dscnn);
+}
@@ -0,0 +1,37 @@
+#include <stdlib.h>
+#include "unity.h"
+#include "host_test.h"
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void app_main(void)
+{
+    UNITY_BEGIN();
+    test_audio_ring_run();
+    test_audio_convert_run();
+    test_mfcc_feature_run();
+    test_kws_inference_run();
+    test_audio_vad_run();
+    test_audio_adpcm_run();
+    test_stream_frame_run();
+    test_audio_resample_run();
+    test_wav_audio_run();
+    test_audio_metrics_run();
+    test_audio_trace_run();
+    test_gpio_button_run();
+    test_audio_pipeline_run();
+    test_audio_profile_run();
+    test_audio_mixer_run();
+    test_audio_jitter_run();
+    test_audio_history_run();
+    test_audio_pool_run();
+    test_audio_recorder_run();
+    int failures = UNITY_END();
+    exit(failures ? 1 : 0);
+}
@@ -0,0 +1,150 @@
+#include <math.h>
+#include <stdlib.h>
+#include "unity.h"
+#include "host_test.h"
+#include "mfcc_feature.h"
+#include "mfcc_golden.h"
+
+#define MFCC_TEST_CHUNK         37          // 与帧移互质, 覆盖帧跨越 push 边界
+#define MFCC_TEST_TOLERANCE     2e-3f       // 标准化后的系数 (量级 1), float32 与参考的差
+#define MFCC_BENCH_WINDOWS      20
+
+// 与 script/mfcc_reference.py synth_signal() 逐样本相同
+static void mfcc_test_signal(int16_t *samples)
+{
+    uint32_t seed = 12345;
+    int32_t lowpass = 0;
+
+    for (int n = 0; n < MFCC_GOLDEN_SAMPLES; n++)
+    {
+        int segment = n / MFCC_GOLDEN_SEGMENT;
+        seed = seed * 1664525u + 1013904223u;
+        int32_t noise = (int32_t)(seed >> 16) - 32768;
+        lowpass += (noise - lowpass) >> (1 + segment % 4);
+        int period = 20 + 7 * segment;
+        int32_t value = (lowpass >> 2) + (((n % period) < (period >> 1)) ? 3000 : -3000);
+        if (segment % 3 == 2)
+            value >>= 6;
+        value = (value > INT16_MAX) ? INT16_MAX : value;
+        value = (value < INT16_MIN) ? INT16_MIN : value;
+        samples[n] = (int16_t)value;
+    }
+}
+
+static int mfcc_test_run(mfcc_feature_t *mfcc, const int16_t *pcm, float *frames)
+{
+    int count = 0;
+
+    mfcc_feature_reset(mfcc);
+    for (int i = 0; i < MFCC_GOLDEN_SAMPLES; i += MFCC_TEST_CHUNK)
+    {
+        int n = (MFCC_GOLDEN_SAMPLES - i < MFCC_TEST_CHUNK) ? MFCC_GOLDEN_SAMPLES - i : MFCC_TEST_CHUNK;
+        count += mfcc_feature_push(mfcc, pcm + i, n, frames + count * MFCC_FEATURE_N_MFCC,
+                                   MFCC_GOLDEN_FRAMES - count);
+    }
+    count += mfcc_feature_flush(mfcc, frames + count * MFCC_FEATURE_N_MFCC, MFCC_GOLDEN_FRAMES - count);
+    return count;
+}
+
+// 流式算出 121x40 窗口, 与 golden 逐项比较
+static void mfcc_test_compare(const float golden[MFCC_GOLDEN_FRAMES][MFCC_FEATURE_N_MFCC], const char *name)
+{
+    int16_t *pcm = malloc(MFCC_GOLDEN_SAMPLES * sizeof(int16_t));
+    float *frames = malloc(MFCC_GOLDEN_FRAMES * MFCC_FEATURE_N_MFCC * sizeof(float));
+    float *window = malloc(MFCC_GOLDEN_FRAMES * MFCC_FEATURE_N_MFCC * sizeof(float));
+    mfcc_feature_t mfcc;
+    float max_error = 0.0f;
+    int worst = 0;
+
+    TEST_ASSERT_NOT_NULL(pcm);
+    TEST_ASSERT_NOT_NULL(frames);
+    TEST_ASSERT_NOT_NULL(window);
+    TEST_ASSERT_EQUAL(ESP_OK, mfcc_feature_init(&mfcc));
+    mfcc_test_signal(pcm);
+
+    // 1.2s 输入加 center 尾部填充正好是 121 帧
+    TEST_ASSERT_EQUAL(MFCC_GOLDEN_FRAMES, mfcc_test_run(&mfcc, pcm, frames));
+    TEST_ASSERT_EQUAL(ESP_OK, mfcc_feature_get_window(&mfcc, window));
+
+    for (int i = 0; i < MFCC_GOLDEN_FRAMES * MFCC_FEATURE_N_MFCC; i++)
+    {
+        float error = fabsf(window[i] - (&golden[0][0])[i]);
+        if (error > max_error)
+        {
+            max_error = error;
+            worst = i;
+        }
+    }
+    printf("mfcc window vs %s: max error %.6f at frame %d coef %d\n", name, max_error,
+           worst / MFCC_FEATURE_N_MFCC, worst % MFCC_FEATURE_N_MFCC);
+    TEST_ASSERT_FLOAT_WITHIN(MFCC_TEST_TOLERANCE, golden[worst / MFCC_FEATURE_N_MFCC][worst % MFCC_FEATURE_N_MFCC],
+                             window[worst]);
+
+    mfcc_feature_deinit(&mfcc);
+    free(window);
+    free(frames);
+    free(pcm);
+}
+
+// 训练管线 (mfcc_process.extract_mfcc / librosa.feature.mfcc) 的输出
+static void test_mfcc_window_matches_librosa(void)
+{
+    mfcc_test_compare(mfcc_golden, "librosa");
+}
+
+// 与 mfcc_tables.py 的窗, 滤波器组和 DCT 一致 (C 编进去的表)
+static void test_mfcc_window_matches_tables(void)
+{
+    mfcc_test_compare(mfcc_golden_tables, "tables");
+}
+
+static void test_mfcc_window_needs_full_history(void)
+{
+    int16_t silence[MFCC_FEATURE_HOP_LENGTH] = { 0 };
+    float frame[MFCC_FEATURE_N_MFCC];
+    float window[MFCC_GOLDEN_FRAMES * MFCC_FEATURE_N_MFCC];
+    mfcc_feature_t mfcc;
+
+    TEST_ASSERT_EQUAL(ESP_OK, mfcc_feature_init(&mfcc));
+    mfcc_feature_push(&mfcc, silence, MFCC_FEATURE_HOP_LENGTH, frame, 1);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, mfcc_feature_get_window(&mfcc, window));
+    mfcc_feature_deinit(&mfcc);
+}
+
+static void bench_mfcc(void)
+{
+    int16_t *pcm = malloc(MFCC_GOLDEN_SAMPLES * sizeof(int16_t));
+    float *frames = malloc(MFCC_GOLDEN_FRAMES * MFCC_FEATURE_N_MFCC * sizeof(float));
+    float *window = malloc(MFCC_GOLDEN_FRAMES * MFCC_FEATURE_N_MFCC * sizeof(float));
+    mfcc_feature_t mfcc;
+    uint64_t push_ns = 0, window_ns = 0;
+
+    TEST_ASSERT_EQUAL(ESP_OK, mfcc_feature_init(&mfcc));
+    mfcc_test_signal(pcm);
+    for (int r = 0; r < MFCC_BENCH_WINDOWS; r++)
+    {
+        uint64_t t0 = host_test_now_ns();
+        mfcc_test_run(&mfcc, pcm, frames);
+        uint64_t t1 = host_test_now_ns();
+        mfcc_feature_get_window(&mfcc, window);
+        uint64_t t2 = host_test_now_ns();
+        push_ns += t1 - t0;
+        window_ns += t2 - t1;
+    }
+    HOST_BENCH("mfcc_feature frame (10 ms hop)", "%.1f us",
+               (double)push_ns / 1000.0 / (MFCC_BENCH_WINDOWS * MFCC_GOLDEN_FRAMES));
+    HOST_BENCH("mfcc_feature get_window 121x40", "%.1f us", (double)window_ns / 1000.0 / MFCC_BENCH_WINDOWS);
+
+    mfcc_feature_deinit(&mfcc);
+    free(window);
+    free(frames);
+    free(pcm);
+}
+
+void test_mfcc_feature_run(void)
+{
+    RUN_TEST(test_mfcc_window_matches_librosa);
+    RUN_TEST(test_mfcc_window_matches_tables);
+    RUN_TEST(test_mfcc_window_needs_full_history);
+    RUN_TEST(bench_mfcc);
+}
@@ -0,0 +1,264 @@
+#include <string.h>
+#include "unity.h"
+#include "host_test.h"
+#include "stream_frame.h"
+
+#define FRAME_TEST_BUFFER       2048        // audio_downlink 的负载缓冲区大小
+#define FRAME_TEST_MAX_FRAMES   64
+#define FRAME_TEST_STREAM       (64 * 1024)
+#define FRAME_BENCH_BYTES       (32 * 1024 * 1024)
+
+typedef struct {
+    int count;
+    uint8_t type[FRAME_TEST_MAX_FRAMES];
+    uint32_t sequence[FRAME_TEST_MAX_FRAMES];
+    uint32_t payload_len[FRAME_TEST_MAX_FRAMES];
+    uint32_t checksum[FRAME_TEST_MAX_FRAMES];
+} frame_test_log_t;
+
+static uint8_t frame_test_buffer[FRAME_TEST_BUFFER];
+static uint8_t frame_test_stream[FRAME_TEST_STREAM];
+static size_t frame_test_len;
+static frame_test_log_t frame_test_expected;
+static frame_test_log_t frame_test_received;
+
+static uint32_t frame_test_checksum(const uint8_t *data, uint32_t len)
+{
+    uint32_t sum = 2166136261u;
+    for (uint32_t i = 0; i < len; i++)
+        sum = (sum ^ data[i]) * 16777619u;
+    return sum;
+}
+
+static void frame_test_log(frame_test_log_t *log, const stream_frame_header_t *header, const uint8_t *payload)
+{
+    TEST_ASSERT_LESS_THAN(FRAME_TEST_MAX_FRAMES, log->count);
+    log->type[log->count] = header->type;
+    log->sequence[log->count] = header->sequence;
+    log->payload_len[log->count] = header->payload_len;
+    log->checksum[log->count] = frame_test_checksum(payload, header->payload_len);
+    log->count++;
+}
+
+static void frame_test_callback(const stream_frame_header_t *header, const uint8_t *payload, void *ctx)
+{
+    frame_test_log((frame_test_log_t *)ctx, header, payload);
+}
+
+static void frame_test_reset(void)
+{
+    frame_test_len = 0;
+    memset(&frame_test_expected, 0, sizeof(frame_test_expected));
+    memset(&frame_test_received, 0, sizeof(frame_test_received));
+}
+
+static void frame_test_append_bytes(const void *data, size_t len)
+{
+    TEST_ASSERT_LESS_OR_EQUAL(FRAME_TEST_STREAM, frame_test_len + len);
+    memcpy(frame_test_stream + frame_test_len, data, len);
+    frame_test_len += len;
+}
+
+// 追加一个帧头, 不检查类型和长度, 用来构造假帧头
+static void frame_test_append_header(uint8_t type, uint32_t sequence, uint32_t payload_len)
+{
+    stream_frame_header_t header;
+    stream_frame_build_header(&header, type, 7, sequence, 0, payload_len, 0);
+    frame_test_append_bytes(&header, sizeof(header));
+}
+
+// 追加一个合法帧, 并记入期望收到的帧
+static void frame_test_append_frame(uint8_t type, uint32_t sequence, uint32_t payload_len, uint32_t *seed)
+{
+    stream_frame_header_t header;
+    frame_test_append_header(type, sequence, payload_len);
+    memcpy(&header, frame_test_stream + frame_test_len - sizeof(header), sizeof(header));
+    uint8_t *payload = frame_test_stream + frame_test_len;
+    for (uint32_t i = 0; i < payload_len; i++)
+        payload[i] = (uint8_t)host_test_rand(seed);
+    frame_test_len += payload_len;
+    frame_test_log(&frame_test_expected, &header, payload);
+}
+
+// 不含 0xA5 的随机字节, 不会和后面帧头的同步字拼成新的同步字, resyncs 可以精确断言
+static void frame_test_append_garbage(size_t len, uint32_t *seed)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        uint8_t b = (uint8_t)host_test_rand(seed);
+        frame_test_stream[frame_test_len++] = (b == 0xA5) ? 0x00 : b;
+    }
+}
+
+// 按随机长度切分送入, 返回第一个非 ESP_OK 的结果
+static esp_err_t frame_test_feed(stream_frame_parser_t *parser, int max_chunk, uint32_t *seed)
+{
+    esp_err_t result = ESP_OK;
+    size_t offset = 0;
+
+    while (offset < frame_test_len)
+    {
+        size_t n = 1 + host_test_rand(seed) % max_chunk;
+        n = (n < frame_test_len - offset) ? n : frame_test_len - offset;
+        esp_err_t err = stream_frame_parser_feed(parser, frame_test_stream + offset, n);
+        if (result == ESP_OK)
+            result = err;
+        offset += n;
+    }
+    return result;
+}
+
+static void frame_test_assert_received(void)
+{
+    TEST_ASSERT_EQUAL_INT(frame_test_expected.count, frame_test_received.count);
+    for (int i = 0; i < frame_test_expected.count; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT8(frame_test_expected.type[i], frame_test_received.type[i]);
+        TEST_ASSERT_EQUAL_UINT32(frame_test_expected.sequence[i], frame_test_received.sequence[i]);
+        TEST_ASSERT_EQUAL_UINT32(frame_test_expected.payload_len[i], frame_test_received.payload_len[i]);
+        TEST_ASSERT_EQUAL_HEX32(frame_test_expected.checksum[i], frame_test_received.checksum[i]);
+    }
+}
+
+static void frame_test_append_session(uint32_t *seed)
+{
+    frame_test_append_frame(STREAM_FRAME_SESSION, 0, STREAM_FRAME_SESSION_SIZE, seed);
+    for (uint32_t seq = 1; seq <= 8; seq++)
+        frame_test_append_frame(STREAM_FRAME_AUDIO, seq, 1 + host_test_rand(seed) % FRAME_TEST_BUFFER, seed);
+    frame_test_append_frame(STREAM_FRAME_METRICS, 9, 0, seed);
+    frame_test_append_frame(STREAM_FRAME_END, 9, 0, seed);
+}
+
+static void test_stream_frame_split_feeds(void)
+{
+    stream_frame_parser_t parser;
+    uint32_t seed = 0x1234567;
+
+    TEST_ASSERT_EQUAL(ESP_OK, stream_frame_parser_init(&parser, frame_test_buffer, sizeof(frame_test_buffer),
+                                                       frame_test_callback, &frame_test_received));
+    // 逐字节和随机切分都要得到同样的帧
+    for (int max_chunk = 1; max_chunk <= 4096; max_chunk *= 8)
+    {
+        frame_test_reset();
+        frame_test_append_session(&seed);
+        TEST_ASSERT_EQUAL(ESP_OK, frame_test_feed(&parser, max_chunk, &seed));
+        frame_test_assert_received();
+        TEST_ASSERT_EQUAL_UINT32(0, parser.resyncs);
+    }
+}
+
+static void test_stream_frame_garbage_between_frames(void)
+{
+    stream_frame_parser_t parser;
+    uint32_t seed = 0x2468ace;
+    size_t garbage = 0;
+
+    stream_frame_parser_init(&parser, frame_test_buffer, sizeof(frame_test_buffer), frame_test_callback,
+                             &frame_test_received);
+    frame_test_reset();
+    for (int i = 0; i < 6; i++)
+    {
+        size_t n = host_test_rand(&seed) % 300;
+        frame_test_append_garbage(n, &seed);
+        garbage += n;
+        frame_test_append_frame(STREAM_FRAME_AUDIO, i, 100 + i, &seed);
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, frame_test_feed(&parser, 64, &seed));
+    frame_test_assert_received();
+    TEST_ASSERT_EQUAL_UINT32(garbage, parser.resyncs);
+}
+
+/**
+ * 同步字碰巧出现在错位的数据里: 假帧头的长度远超 STREAM_FRAME_MAX_PAYLOAD (0xFFFFFFE4 在 32 位上
+ * 还会让 HEADER_SIZE + payload_len 回绕成 0) 或类型未知, 都只丢一个字节, 后面的真帧不受影响.
+ */
+static void test_stream_frame_bogus_headers(void)
+{
+    const uint32_t lengths[] = { 0xFFFFFFE4u, STREAM_FRAME_MAX_PAYLOAD + 1, 0x7FFFFFFFu };
+    stream_frame_parser_t parser;
+    uint32_t seed = 0x5eed;
+
+    for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++)
+    {
+        stream_frame_parser_init(&parser, frame_test_buffer, sizeof(frame_test_buffer), frame_test_callback,
+                                 &frame_test_received);
+        frame_test_reset();
+        frame_test_append_header(STREAM_FRAME_AUDIO, 1, lengths[i]);
+        frame_test_append_session(&seed);
+        TEST_ASSERT_EQUAL(ESP_OK, frame_test_feed(&parser, 512, &seed));
+        frame_test_assert_received();
+        TEST_ASSERT_EQUAL_UINT32(STREAM_FRAME_HEADER_SIZE, parser.resyncs);
+    }
+
+    // 未知类型, 长度正好覆盖后面的真帧: 以前会把它们当作负载吞掉
+    stream_frame_parser_init(&parser, frame_test_buffer, sizeof(frame_test_buffer), frame_test_callback,
+                             &frame_test_received);
+    frame_test_reset();
+    frame_test_append_header(0x42, 1, 200);
+    frame_test_append_frame(STREAM_FRAME_VAD_START, 2, 0, &seed);
+    frame_test_append_frame(STREAM_FRAME_AUDIO, 3, 160, &seed);
+    frame_test_append_frame(STREAM_FRAME_VAD_END, 4, 0, &seed);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_test_feed(&parser, 7, &seed));
+    frame_test_assert_received();
+    TEST_ASSERT_EQUAL_UINT32(STREAM_FRAME_HEADER_SIZE, parser.resyncs);
+}
+
+static void test_stream_frame_oversize_frame_skipped(void)
+{
+    uint8_t small[64];
+    stream_frame_parser_t parser;
+    uint32_t seed = 0xbeef;
+
+    stream_frame_parser_init(&parser, small, sizeof(small), frame_test_callback, &frame_test_received);
+    frame_test_reset();
+    frame_test_append_frame(STREAM_FRAME_AUDIO, 1, 32, &seed);
+    // 合法但放不下的帧: 整帧跳过, 报 INVALID_SIZE, 不算失步
+    frame_test_append_header(STREAM_FRAME_AUDIO, 2, 1000);
+    for (int i = 0; i < 1000; i++)
+        frame_test_stream[frame_test_len++] = 0xA5;
+    frame_test_append_frame(STREAM_FRAME_END, 3, 0, &seed);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, frame_test_feed(&parser, 100, &seed));
+    frame_test_assert_received();
+    TEST_ASSERT_EQUAL_UINT32(0, parser.resyncs);
+}
+
+static void test_stream_frame_bench(void)
+{
+    stream_frame_parser_t parser;
+    frame_test_log_t sink;
+    uint32_t seed = 0xfeed;
+
+    // 20ms 的 16kHz PCM16 帧 (640 字节), 按 TCP 常见的 1460 字节切分送入
+    frame_test_reset();
+    while (frame_test_len + STREAM_FRAME_HEADER_SIZE + 640 <= FRAME_TEST_STREAM)
+    {
+        frame_test_append_header(STREAM_FRAME_AUDIO, 0, 640);
+        frame_test_append_garbage(640, &seed);
+    }
+    stream_frame_parser_init(&parser, frame_test_buffer, sizeof(frame_test_buffer), frame_test_callback, &sink);
+
+    size_t fed = 0;
+    uint64_t start = host_test_now_ns();
+    while (fed < FRAME_BENCH_BYTES)
+    {
+        for (size_t offset = 0; offset < frame_test_len; offset += 1460)
+        {
+            size_t n = (frame_test_len - offset < 1460) ? frame_test_len - offset : 1460;
+            sink.count = 0;
+            stream_frame_parser_feed(&parser, frame_test_stream + offset, n);
+        }
+        fed += frame_test_len;
+    }
+    double ns = (double)(host_test_now_ns() - start);
+    TEST_ASSERT_EQUAL_UINT32(0, parser.resyncs);
+    HOST_BENCH("stream_frame_parser_feed", "%.1f MB/s (640 B frames, 1460 B chunks)", fed / ns * 1e3);
+}
+
+void test_stream_frame_run(void)
+{
+    RUN_TEST(test_stream_frame_split_feeds);
+    RUN_TEST(test_stream_frame_garbage_between_frames);
+    RUN_TEST(test_stream_frame_bogus_headers);
+    RUN_TEST(test_stream_frame_oversize_frame_skipped);
+    RUN_TEST(test_stream_frame_bench);
+}
@@ -0,0 +1,362 @@
+#include <string.h>
+#include "unity.h"
+#include "host_test.h"
+#include "wav_audio.h"
+
+#define WAV_TEST_MAX_FRAMES     4801
+#define WAV_TEST_MAX_FRAME      (6 * 8)     // 6 声道 float64
+#define WAV_TEST_MAX_DATA       (WAV_TEST_MAX_FRAMES * WAV_TEST_MAX_FRAME)
+#define WAV_TEST_FILE_SIZE      (WAV_TEST_MAX_DATA + 256)
+#define WAV_BENCH_BYTES         (64u * 1024 * 1024)
+
+static const wav_audio_format_t wav_test_formats[] = {
+    { WAV_AUDIO_FORMAT_PCM,   1, 16000,  8 },
+    { WAV_AUDIO_FORMAT_PCM,   1, 16000, 16 },
+    { WAV_AUDIO_FORMAT_PCM,   2, 44100, 16 },
+    { WAV_AUDIO_FORMAT_PCM,   1, 24000, 24 },
+    { WAV_AUDIO_FORMAT_PCM,   2, 48000, 24 },
+    { WAV_AUDIO_FORMAT_PCM,   1, 16000, 32 },
+    { WAV_AUDIO_FORMAT_FLOAT, 1,  8000, 32 },
+    { WAV_AUDIO_FORMAT_FLOAT, 6, 48000, 64 },
+};
+
+// 包含 0 帧, 1 帧, 奇数长度 (8/24 bit 单声道需要填充字节) 和 I2S 块附近的长度
+static const int wav_test_frames[] = { 0, 1, 2, 3, 159, 160, 1023, 1024, 1025, WAV_TEST_MAX_FRAMES };
+
+static uint8_t wav_test_data[WAV_TEST_MAX_DATA];
+static uint8_t wav_test_read[WAV_TEST_MAX_DATA + WAV_TEST_MAX_FRAME];    // 留一帧, 读到结尾时还能请求整帧
+static uint8_t wav_test_file[WAV_TEST_FILE_SIZE];
+
+static uint32_t wav_test_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t wav_test_le16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static void wav_test_fill(uint32_t *seed, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+        wav_test_data[i] = (uint8_t)host_test_rand(seed);
+}
+
+// 按随机长度分块写入, 返回文件长度
+static size_t wav_test_write(const wav_audio_format_t *format, size_t data_size, bool seekable, uint32_t *seed)
+{
+    wav_audio_mem_t mem;
+    wav_audio_sink_t sink;
+    wav_audio_writer_t writer;
+
+    wav_audio_mem_init(&mem, wav_test_file, sizeof(wav_test_file), 0);
+    wav_audio_mem_sink(&mem, &sink);
+    if (!seekable)
+        sink.seek = NULL;
+
+    TEST_ASSERT_EQUAL(ESP_OK, wav_audio_writer_open(&writer, &sink, format));
+    for (size_t pos = 0; pos < data_size;)
+    {
+        size_t n = 1 + host_test_rand(seed) % 2000;
+        if (n > data_size - pos)
+            n = data_size - pos;
+        TEST_ASSERT_EQUAL(ESP_OK, wav_audio_writer_write(&writer, wav_test_data + pos, n));
+        pos += n;
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, wav_audio_writer_close(&writer));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, wav_audio_writer_write(&writer, wav_test_data, 1));
+    return mem.length;
+}
+
+// 按随机长度分块读出, 返回读到的字节数
+static size_t wav_test_read_all(wav_audio_reader_t *reader, size_t file_size, uint32_t *seed)
+{
+    wav_audio_mem_t mem;
+    wav_audio_source_t source;
+    size_t total = 0;
+
+    wav_audio_mem_init(&mem, wav_test_file, sizeof(wav_test_file), file_size);
+    wav_audio_mem_source(&mem, &source);
+    TEST_ASSERT_EQUAL(ESP_OK, wav_audio_reader_open(reader, &source));
+
+    while (1)
+    {
+        size_t len = 1 + host_test_rand(seed) % 3000;
+        if (len > sizeof(wav_test_read) - total)
+            len = sizeof(wav_test_read) - total;
+        int n = wav_audio_reader_read(reader, wav_test_read + total, len);
+        TEST_ASSERT_GREATER_OR_EQUAL(0, n);
+        TEST_ASSERT_EQUAL(0, n % reader->block_align);
+        // 请求不足一帧时返回 0 不代表结束
+        if ((n == 0) && (len >= reader->block_align))
+            break;
+        total += n;
+    }
+    return total;
+}
+
+static void wav_test_check_header(const wav_audio_format_t *format, size_t data_size, uint32_t expect_data)
+{
+    uint16_t block_align = format->channels * format->bits_per_sample / 8;
+    uint32_t expect_riff = (expect_data == WAV_AUDIO_STREAMING_SIZE) ?
+                           WAV_AUDIO_STREAMING_SIZE : 36 + data_size + (data_size & 1);
+
+    TEST_ASSERT_EQUAL_MEMORY("RIFF", wav_test_file, 4);
+    TEST_ASSERT_EQUAL_UINT32(expect_riff, wav_test_le32(wav_test_file + 4));
+    TEST_ASSERT_EQUAL_MEMORY("WAVEfmt ", wav_test_file + 8, 8);
+    TEST_ASSERT_EQUAL_UINT32(16, wav_test_le32(wav_test_file + 16));
+    TEST_ASSERT_EQUAL_UINT16(format->format, wav_test_le16(wav_test_file + 20));
+    TEST_ASSERT_EQUAL_UINT16(format->channels, wav_test_le16(wav_test_file + 22));
+    TEST_ASSERT_EQUAL_UINT32(format->sample_rate, wav_test_le32(wav_test_file + 24));
+    TEST_ASSERT_EQUAL_UINT32(format->sample_rate * block_align, wav_test_le32(wav_test_file + 28));
+    TEST_ASSERT_EQUAL_UINT16(block_align, wav_test_le16(wav_test_file + 32));
+    TEST_ASSERT_EQUAL_UINT16(format->bits_per_sample, wav_test_le16(wav_test_file + 34));
+    TEST_ASSERT_EQUAL_MEMORY("data", wav_test_file + 36, 4);
+    TEST_ASSERT_EQUAL_UINT32(expect_data, wav_test_le32(wav_test_file + 40));
+}
+
+static void test_wav_audio_round_trip(void)
+{
+    uint32_t seed = 0x5eed;
+    wav_audio_reader_t reader;
+
+    for (size_t f = 0; f < sizeof(wav_test_formats) / sizeof(wav_test_formats[0]); f++)
+    {
+        const wav_audio_format_t *format = &wav_test_formats[f];
+        size_t block_align = format->channels * format->bits_per_sample / 8;
+
+        for (size_t k = 0; k < sizeof(wav_test_frames) / sizeof(wav_test_frames[0]); k++)
+        {
+            size_t data_size = wav_test_frames[k] * block_align;
+            wav_test_fill(&seed, data_size);
+
+            size_t file_size = wav_test_write(format, data_size, true, &seed);
+            TEST_ASSERT_EQUAL(WAV_AUDIO_HEADER_SIZE + data_size + (data_size & 1), file_size);
+            wav_test_check_header(format, data_size, (uint32_t)data_size);
+
+            TEST_ASSERT_EQUAL(data_size, wav_test_read_all(&reader, file_size, &seed));
+            TEST_ASSERT_FALSE(reader.streaming);
+            TEST_ASSERT_EQUAL_UINT16(format->format, reader.format.format);
+            TEST_ASSERT_EQUAL_UINT16(format->channels, reader.format.channels);
+            TEST_ASSERT_EQUAL_UINT32(format->sample_rate, reader.format.sample_rate);
+            TEST_ASSERT_EQUAL_UINT16(format->bits_per_sample, reader.format.bits_per_sample);
+            if (data_size > 0)
+                TEST_ASSERT_EQUAL_MEMORY(wav_test_data, wav_test_read, data_size);
+        }
+    }
+}
+
+// 不可寻址的输出: 头保留流式大小, 读取端读到数据源结束, 不写填充字节
+static void test_wav_audio_streaming(void)
+{
+    uint32_t seed = 0xbeef;
+    wav_audio_reader_t reader;
+
+    for (size_t f = 0; f < sizeof(wav_test_formats) / sizeof(wav_test_formats[0]); f++)
+    {
+        const wav_audio_format_t *format = &wav_test_formats[f];
+        size_t data_size = 1025 * format->channels * format->bits_per_sample / 8;
+
+        wav_test_fill(&seed, data_size);
+        size_t file_size = wav_test_write(format, data_size, false, &seed);
+        TEST_ASSERT_EQUAL(WAV_AUDIO_HEADER_SIZE + data_size, file_size);
+        wav_test_check_header(format, data_size, WAV_AUDIO_STREAMING_SIZE);
+
+        TEST_ASSERT_EQUAL(data_size, wav_test_read_all(&reader, file_size, &seed));
+        TEST_ASSERT_TRUE(reader.streaming);
+        TEST_ASSERT_EQUAL_MEMORY(wav_test_data, wav_test_read, data_size);
+    }
+}
+
+// 与 script/tcp_receiver.py 的 wav_header() 逐字节一致
+static void test_wav_audio_header_layout(void)
+{
+    static const uint8_t expected[WAV_AUDIO_HEADER_SIZE] = {
+        'R', 'I', 'F', 'F', 0x24, 0x00, 0x01, 0x00, 'W', 'A', 'V', 'E',
+        'f', 'm', 't', ' ', 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+        0x80, 0x3e, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00,
+        'd', 'a', 't', 'a', 0x00, 0x00, 0x01, 0x00,
+    };
+    wav_audio_format_t format = { WAV_AUDIO_FORMAT_PCM, 1, 16000, 16 };
+    uint8_t header[WAV_AUDIO_HEADER_SIZE];
+
+    TEST_ASSERT_EQUAL(ESP_OK, wav_audio_build_header(&format, WAV_AUDIO_DEFAULT_DATA_SIZE, header));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, header, sizeof(header));
+    TEST_ASSERT_EQUAL(ESP_OK, wav_audio_init());
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, wav_audio_get_default_header(), sizeof(header));
+
+    format.bits_per_sample = 12;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, wav_audio_build_header(&format, 0, header));
+    format.bits_per_sample = 16;
+    format.format = WAV_AUDIO_FORMAT_FLOAT;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, wav_audio_build_header(&format, 0, header));
+    format.format = WAV_AUDIO_FORMAT_PCM;
+    format.channels = 0;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, wav_audio_build_header(&format, 0, header));
+}
+
+static size_t wav_test_put(size_t pos, const void *data, size_t len)
+{
+    memcpy(wav_test_file + pos, data, len);
+    return pos + len;
+}
+
+static size_t wav_test_put_chunk(size_t pos, const char *id, uint32_t size)
+{
+    uint8_t le[4] = { (uint8_t)size, (uint8_t)(size >> 8), (uint8_t)(size >> 16), (uint8_t)(size >> 24) };
+    pos = wav_test_put(pos, id, 4);
+    return wav_test_put(pos, le, 4);
+}
+
+static esp_err_t wav_test_open(wav_audio_reader_t *reader, size_t file_size)
+{
+    wav_audio_mem_t mem;
+    wav_audio_source_t source;
+
+    wav_audio_mem_init(&mem, wav_test_file, sizeof(wav_test_file), file_size);
+    wav_audio_mem_source(&mem, &source);
+    return wav_audio_reader_open(reader, &source);
+}
+
+// 其它工具写出的文件: LIST/奇数长度块在 fmt 前后, WAVE_FORMAT_EXTENSIBLE 的 fmt
+static void test_wav_audio_foreign_chunks(void)
+{
+    static const uint8_t fmt_ext[40] = {
+        0xfe, 0xff, 0x02, 0x00, 0x80, 0xbb, 0x00, 0x00, 0x00, 0x65, 0x04, 0x00, 0x06, 0x00, 0x18, 0x00,
+        0x16, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x00,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xaa, 0x00, 0x38, 0x9b, 0x71,
+    };
+    uint8_t info[7] = { 'I', 'N', 'F', 'O', 'a', 'b', 'c' };
+    uint8_t pad = 0;
+    uint32_t seed = 0x1234;
+    wav_audio_reader_t reader;
+
+    size_t pos = wav_test_put_chunk(0, "RIFF", 0);
+    pos = wav_test_put(pos, "WAVE", 4);
+    pos = wav_test_put_chunk(pos, "LIST", sizeof(info));
+    pos = wav_test_put(pos, info, sizeof(info));
+    pos = wav_test_put(pos, &pad, 1);
+    pos = wav_test_put_chunk(pos, "fmt ", sizeof(fmt_ext));
+    pos = wav_test_put(pos, fmt_ext, sizeof(fmt_ext));
+    pos = wav_test_put_chunk(pos, "fact", 4);
+    pos = wav_test_put(pos, "\x10\x00\x00\x00", 4);
+    pos = wav_test_put_chunk(pos, "data", 96);
+    wav_test_fill(&seed, 96);
+    pos = wav_test_put(pos, wav_test_data, 96);
+
+    TEST_ASSERT_EQUAL(96, wav_test_read_all(&reader, pos, &seed));
+    TEST_ASSERT_EQUAL_UINT16(WAV_AUDIO_FORMAT_PCM, reader.format.format);
+    TEST_ASSERT_EQUAL_UINT16(2, reader.format.channels);
+    TEST_ASSERT_EQUAL_UINT32(48000, reader.format.sample_rate);
+    TEST_ASSERT_EQUAL_UINT16(24, reader.format.bits_per_sample);
+    TEST_ASSERT_EQUAL_MEMORY(wav_test_data, wav_test_read, 96);
+}
+
+static void test_wav_audio_invalid(void)
+{
+    wav_audio_format_t format = { WAV_AUDIO_FORMAT_PCM, 2, 16000, 16 };
+    wav_audio_reader_t reader;
+    uint32_t seed = 0x777;
+
+    // 不是 RIFF/WAVE
+    memset(wav_test_file, 0, 64);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_RESPONSE, wav_test_open(&reader, 64));
+    size_t pos = wav_test_put_chunk(0, "RIFF", 4);
+    pos = wav_test_put(pos, "AVI ", 4);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_RESPONSE, wav_test_open(&reader, pos));
+
+    // data 在 fmt 之前
+    pos = wav_test_put_chunk(0, "RIFF", 0);
+    pos = wav_test_put(pos, "WAVE", 4);
+    pos = wav_test_put_chunk(pos, "data", 0);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_RESPONSE, wav_test_open(&reader, pos));
+
+    // 头不完整: 截在 fmt 块中间和 data 块头之前
+    TEST_ASSERT_EQUAL(ESP_OK, wav_audio_build_header(&format, 0, wav_test_file));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_RESPONSE, wav_test_open(&reader, 30));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_RESPONSE, wav_test_open(&reader, 36));
+    TEST_ASSERT_EQUAL(ESP_OK, wav_test_open(&reader, WAV_AUDIO_HEADER_SIZE));
+
+    // 不支持的编码: ADPCM, 12 bit, blockAlign 与声道/位宽不符
+    wav_test_file[20] = 2;
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_SUPPORTED, wav_test_open(&reader, WAV_AUDIO_HEADER_SIZE));
+    wav_test_file[20] = WAV_AUDIO_FORMAT_PCM;
+    wav_test_file[34] = 12;
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_SUPPORTED, wav_test_open(&reader, WAV_AUDIO_HEADER_SIZE));
+    wav_test_file[34] = 16;
+    wav_test_file[32] = 3;
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_SUPPORTED, wav_test_open(&reader, WAV_AUDIO_HEADER_SIZE));
+
+    // 截断的文件: 只读出完整的帧, 末尾半帧丢弃
+    wav_test_fill(&seed, 400);
+    size_t file_size = wav_test_write(&format, 400, true, &seed);
+    TEST_ASSERT_EQUAL(396, wav_test_read_all(&reader, file_size - 2, &seed));
+    TEST_ASSERT_EQUAL_MEMORY(wav_test_data, wav_test_read, 396);
+
+    // 输出写满时写入失败
+    wav_audio_mem_t mem;
+    wav_audio_sink_t sink;
+    wav_audio_writer_t writer;
+    wav_audio_mem_init(&mem, wav_test_file, WAV_AUDIO_HEADER_SIZE + 100, 0);
+    wav_audio_mem_sink(&mem, &sink);
+    TEST_ASSERT_EQUAL(ESP_OK, wav_audio_writer_open(&writer, &sink, &format));
+    TEST_ASSERT_EQUAL(ESP_OK, wav_audio_writer_write(&writer, wav_test_data, 100));
+    TEST_ASSERT_EQUAL(ESP_FAIL, wav_audio_writer_write(&writer, wav_test_data, 4));
+    TEST_ASSERT_EQUAL(ESP_OK, wav_audio_writer_close(&writer));
+    TEST_ASSERT_EQUAL_UINT32(100, wav_test_le32(wav_test_file + WAV_AUDIO_DATA_SIZE_OFFSET));
+}
+
+// 10ms 块 (16kHz 单声道 PCM16) 写入内存再读出的吞吐
+static void test_wav_audio_bench(void)
+{
+    const wav_audio_format_t format = { WAV_AUDIO_FORMAT_PCM, 1, 16000, 16 };
+    const size_t block = 320;
+    size_t blocks = (WAV_TEST_MAX_DATA / block);
+    size_t rounds = WAV_BENCH_BYTES / (blocks * block);
+    uint64_t write_ns = 0, read_ns = 0;
+    wav_audio_mem_t mem;
+    wav_audio_sink_t sink;
+    wav_audio_source_t source;
+    wav_audio_writer_t writer;
+    wav_audio_reader_t reader;
+    uint32_t seed = 0x42;
+
+    wav_test_fill(&seed, blocks * block);
+    for (size_t r = 0; r < rounds; r++)
+    {
+        uint64_t start = host_test_now_ns();
+        wav_audio_mem_init(&mem, wav_test_file, sizeof(wav_test_file), 0);
+        wav_audio_mem_sink(&mem, &sink);
+        wav_audio_writer_open(&writer, &sink, &format);
+        for (size_t b = 0; b < blocks; b++)
+            wav_audio_writer_write(&writer, wav_test_data + b * block, block);
+        wav_audio_writer_close(&writer);
+        uint64_t mid = host_test_now_ns();
+
+        wav_audio_mem_init(&mem, wav_test_file, sizeof(wav_test_file), mem.length);
+        wav_audio_mem_source(&mem, &source);
+        wav_audio_reader_open(&reader, &source);
+        while (wav_audio_reader_read(&reader, wav_test_read, block) > 0)
+            ;
+        read_ns += host_test_now_ns() - mid;
+        write_ns += mid - start;
+    }
+    TEST_ASSERT_EQUAL_MEMORY(wav_test_data + (blocks - 1) * block, wav_test_read, block);
+
+    double bytes = (double)rounds * blocks * block;
+    HOST_BENCH("wav_audio write 320 B blocks", "%.0f MB/s, %.1f ns/block", bytes * 1e3 / write_ns,
+               (double)write_ns / (rounds * blocks));
+    HOST_BENCH("wav_audio read 320 B blocks", "%.0f MB/s, %.1f ns/block", bytes * 1e3 / read_ns,
+               (double)read_ns / (rounds * blocks));
+}
+
+void test_wav_audio_run(void)
+{
+    RUN_TEST(test_wav_audio_round_trip);
+    RUN_TEST(test_wav_audio_streaming);
+    RUN_TEST(test_wav_audio_header_layout);
+    RUN_TEST(test_wav_audio_foreign_chunks);
+    RUN_TEST(test_wav_audio_invalid);
+    RUN_TEST(test_wav_audio_bench);
+}